@@ -37,7 +37,7 @@ QStringList uniqueRequiredKeys(const QStringList &requiredServerKeys)
 QList<BackendAvailabilityStatus>
 AvailabilityService::pollAll() const
 {
-    Scenario::ServerStatusProbe probe;
+    Scenario::ServerStatusProbe probe(m_controller);
     const auto                  statuses = probe.pollAll();
 
     QList<BackendAvailabilityStatus> result;
@@ -124,9 +124,9 @@ QStringList AvailabilityService::requiredServerKeysForScenario(
         }
     };
 
-    for (const auto &connection : document.connections)
+    for (const auto &connection : document.connections())
         addModeKey(connection.mode);
-    for (const auto &globalLink : document.globalLinks)
+    for (const auto &globalLink : document.globalLinks())
         addModeKey(globalLink.mode);
 
     return QStringList(requiredKeys.begin(), requiredKeys.end());
@@ -7,6 +7,8 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
+
 namespace Backend
 {
 namespace Scenario
@@ -37,7 +39,13 @@ struct AvailabilityWaitResult
 class AvailabilityService
 {
 public:
-    AvailabilityService() = default;
+    /// Reports on the clients of @p controller; null reports on the
+    /// default instance.
+    explicit AvailabilityService(
+        CargoNetSim::CargoNetSimController *controller = nullptr)
+        : m_controller(controller)
+    {
+    }
 
     QList<BackendAvailabilityStatus> pollAll() const;
 
@@ -54,6 +62,9 @@ public:
     static QStringList missingCommandServers(
         const QStringList                    &requiredServerKeys,
         const QList<BackendAvailabilityStatus> &statuses);
+
+private:
+    CargoNetSim::CargoNetSimController *m_controller = nullptr;
 };
 
 } // namespace Application
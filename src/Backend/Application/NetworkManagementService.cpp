@@ -102,7 +102,7 @@ bool networkNodeOccupied(const Scenario::ScenarioDocument &doc,
                          const QString                    &networkName,
                          int                               nodeId)
 {
-    for (const Scenario::NodeLinkage &linkage : doc.linkages)
+    for (const Scenario::NodeLinkage &linkage : doc.linkages())
     {
         const auto terminalIt =
             doc.terminals.constFind(linkage.terminalId);
@@ -127,7 +127,7 @@ bool terminalLinkedToRequestedKind(
     if (regionIt == doc.regions.constEnd())
         return false;
 
-    for (const Scenario::NodeLinkage &linkage : doc.linkages)
+    for (const Scenario::NodeLinkage &linkage : doc.linkages())
     {
         if (linkage.excluded
             || linkage.terminalId != terminal.id)
@@ -52,6 +52,8 @@ struct LinkTerminalToNodeResult
 class NetworkManagementService
 {
 public:
+    /// Manages the networks of @p controller; null means the default
+    /// instance. Named runtime contexts must be passed explicitly.
     explicit NetworkManagementService(
         ::CargoNetSim::CargoNetSimController *controller = nullptr);
 
@@ -65,6 +65,8 @@ class NetworkViewService : public QObject
     Q_OBJECT
 
 public:
+    /// Views the networks of @p controller; null means the default
+    /// instance. Named runtime contexts must be passed explicitly.
     explicit NetworkViewService(
         ::CargoNetSim::CargoNetSimController *controller = nullptr,
         QObject *parent = nullptr);
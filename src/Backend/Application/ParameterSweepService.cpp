@@ -0,0 +1,86 @@
+#include "ParameterSweepService.h"
+
+#include "Backend/Commons/LogCategories.h"
+#include "Backend/Controllers/CargoNetSimController.h"
+#include "Backend/Controllers/ConfigController.h"
+#include "Backend/Scenario/ScenarioRuntime.h"
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Application
+{
+
+ParameterSweepService::ParameterSweepService(
+    ::CargoNetSim::CargoNetSimController *controller)
+    : m_controller(controller)
+    , m_baseConfig(controller ? controller->getAllConfigParams()
+                              : QVariantMap{})
+{
+}
+
+ParameterSweepServiceResult ParameterSweepService::evaluate(
+    const Scenario::ScenarioRuntime &runtime,
+    const Scenario::ParameterGrid   &grid,
+    int                              selectPerPair) const
+{
+    ParameterSweepServiceResult result;
+    auto *config =
+        m_controller ? m_controller->getConfigController() : nullptr;
+    if (!config)
+    {
+        result.status  = ParameterSweepServiceStatus::BackendUnavailable;
+        result.message = QStringLiteral("ConfigController unavailable");
+        return result;
+    }
+    if (selectPerPair <= 0)
+    {
+        result.status  = ParameterSweepServiceStatus::InvalidRequest;
+        result.message = QStringLiteral(
+            "at least one path per OD pair must be selected");
+        return result;
+    }
+    if (runtime.preparedPaths().isEmpty())
+    {
+        result.status  = ParameterSweepServiceStatus::NoPreparedPaths;
+        result.message = QStringLiteral("no prepared paths to re-score");
+        return result;
+    }
+
+    result.variants = Scenario::ParameterSweep::evaluate(
+        runtime.preparedPaths(), runtime.document(), *config, grid,
+        selectPerPair);
+    for (const auto &variant : result.variants)
+    {
+        if (variant.needsSimulation())
+            ++result.simulatedVariantCount;
+    }
+
+    qCInfo(lcScenario) << "ParameterSweepService::evaluate:"
+                       << result.variants.size() << "variant(s),"
+                       << result.simulatedVariantCount
+                       << "need simulation";
+    result.status = ParameterSweepServiceStatus::Success;
+    return result;
+}
+
+bool ParameterSweepService::applyVariant(
+    const Scenario::ParameterSweepVariant &variant) const
+{
+    if (!m_controller || !m_controller->getConfigController())
+        return false;
+    m_controller->updateConfig(Scenario::ParameterGrid::applyPoint(
+        m_baseConfig, variant.parameters));
+    return true;
+}
+
+void ParameterSweepService::restoreBaseConfig() const
+{
+    if (m_controller)
+        m_controller->updateConfig(m_baseConfig);
+}
+
+} // namespace Application
+} // namespace Backend
+} // namespace CargoNetSim
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <QVariantMap>
+
+#include "Backend/Scenario/ParameterSweep.h"
+
+namespace CargoNetSim
+{
+class CargoNetSimController;
+
+namespace Backend
+{
+namespace Scenario
+{
+class ScenarioRuntime;
+}
+
+namespace Application
+{
+
+enum class ParameterSweepServiceStatus
+{
+    Success,
+    InvalidRequest,
+    NoPreparedPaths,
+    BackendUnavailable
+};
+
+struct ParameterSweepServiceResult
+{
+    ParameterSweepServiceStatus status =
+        ParameterSweepServiceStatus::InvalidRequest;
+    QString                                 message;
+    QList<Scenario::ParameterSweepVariant>  variants;
+    int                                     simulatedVariantCount = 0;
+
+    bool succeeded() const
+    {
+        return status == ParameterSweepServiceStatus::Success;
+    }
+};
+
+/**
+ * @brief Re-scores a runtime's prepared paths over a parameter grid.
+ *
+ * The runtime must already hold prepared paths (see
+ * PreparedPathService); discovery, distances and estimated physics
+ * are not repeated per grid point. Before simulating a variant,
+ * applyVariant() installs its overrides on the controller's config
+ * so the simulated costs use the same weights as the ranking;
+ * restoreBaseConfig() puts back the parameters the controller had
+ * when the service was constructed, so construct it after the
+ * scenario has been applied.
+ */
+class ParameterSweepService
+{
+public:
+    explicit ParameterSweepService(
+        ::CargoNetSim::CargoNetSimController *controller);
+
+    ParameterSweepServiceResult evaluate(
+        const Scenario::ScenarioRuntime &runtime,
+        const Scenario::ParameterGrid   &grid,
+        int                              selectPerPair) const;
+
+    bool applyVariant(const Scenario::ParameterSweepVariant &variant) const;
+    void restoreBaseConfig() const;
+
+private:
+    ::CargoNetSim::CargoNetSimController *m_controller = nullptr;
+    QVariantMap                           m_baseConfig;
+};
+
+} // namespace Application
+} // namespace Backend
+} // namespace CargoNetSim
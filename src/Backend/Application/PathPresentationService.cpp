@@ -699,11 +699,11 @@ QList<QJsonObject> PathPresentationService::buildComparisonSnapshots(
     topology[QStringLiteral("terminals")] =
         doc.terminals.size();
     topology[QStringLiteral("linkages")] =
-        doc.linkages.size();
+        doc.linkages().size();
     topology[QStringLiteral("connections")] =
-        doc.connections.size();
+        doc.connections().size();
     topology[QStringLiteral("global_links")] =
-        doc.globalLinks.size();
+        doc.globalLinks().size();
 
     const QString discoveredAtUtc =
         QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
@@ -46,6 +46,7 @@ PreparedPathService::PreparedPathService(
           controller ? controller->getNetworkController() : nullptr,
           controller ? controller->getRegionDataController() : nullptr)
 {
+    m_controller = controller;
 }
 
 PreparedPathService::PreparedPathService(
@@ -58,6 +59,26 @@ PreparedPathService::PreparedPathService(
 {
 }
 
+void PreparedPathService::setDistanceCacheEnabled(bool enabled)
+{
+    m_distanceCacheEnabled = enabled;
+}
+
+bool PreparedPathService::distanceCacheEnabled() const
+{
+    return m_distanceCacheEnabled;
+}
+
+void PreparedPathService::setPathCacheDirectory(const QString &directory)
+{
+    m_pathCacheDirectory = directory;
+}
+
+QString PreparedPathService::pathCacheDirectory() const
+{
+    return m_pathCacheDirectory;
+}
+
 PreparedPathServiceResult PreparedPathService::discoverAndPrepare(
     const Scenario::ScenarioDocument &document,
     const Scenario::ScenarioRegistry &registry,
@@ -82,7 +103,7 @@ PreparedPathServiceResult PreparedPathService::discoverAndPrepare(
         return result;
     }
 
-    AvailabilityService availabilityService;
+    AvailabilityService availabilityService(m_controller);
     const auto availabilityResult =
         availabilityService.waitForCommandAvailability(
             {QStringLiteral("terminal")}, /*timeoutMs=*/10000);
@@ -104,9 +125,14 @@ PreparedPathServiceResult PreparedPathService::discoverAndPrepare(
     }
 
     QString err;
+    Scenario::NetworkDistanceEngine::Options distanceOptions;
+    distanceOptions.diskCache = m_distanceCacheEnabled;
+    Scenario::PathDiscovery::Options discoveryOptions;
+    discoveryOptions.cacheDirectory = m_pathCacheDirectory;
+    discoveryOptions.controller = m_controller;
     auto prepared = Scenario::PathPreparationService::discoverAndPreparePaths(
         document, registry, topN, m_config, m_networks, m_regionData,
-        &err);
+        &err, distanceOptions, discoveryOptions);
 
     if (prepared.isEmpty())
     {
@@ -65,10 +65,23 @@ public:
         Scenario::ScenarioRuntime &runtime,
         int                        topN) const;
 
+    /// Persist memoized network leg distances beside each network's input
+    /// files so later invocations skip the searches (off by default).
+    void setDistanceCacheEnabled(bool enabled);
+    bool distanceCacheEnabled() const;
+
+    /// Serve top-N answers for an unchanged terminal graph from this
+    /// TopPathCache directory (empty = off, the default).
+    void setPathCacheDirectory(const QString &directory);
+    QString pathCacheDirectory() const;
+
 private:
+    ::CargoNetSim::CargoNetSimController *m_controller = nullptr;
     ConfigController     *m_config = nullptr;
     NetworkController    *m_networks = nullptr;
     RegionDataController *m_regionData = nullptr;
+    bool                  m_distanceCacheEnabled = false;
+    QString               m_pathCacheDirectory;
 };
 
 } // namespace Application
@@ -683,7 +683,7 @@ bool ScenarioEditService::restoreLinkage(
 {
     if (!doc)
         return false;
-    for (const auto &l : doc->linkages)
+    for (const auto &l : doc->linkages())
     {
         if (l.terminalId == snapshot.terminalId
             && l.networkName == snapshot.networkName
@@ -3,6 +3,7 @@
 #include <QObject>
 
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Scenario/ScenarioCache.h"
 #include "Backend/Scenario/ScenarioDocument.h"
 #include "Backend/Scenario/ScenarioRuntime.h"
 #include "Backend/Scenario/ScenarioSerializer.h"
@@ -54,9 +55,35 @@ ScenarioParseServiceResult ScenarioLoadService::parseAndValidateYaml(
         return result;
     }
 
+    std::unique_ptr<Scenario::ScenarioDocument> document;
+    if (m_scenarioCacheEnabled)
+    {
+        QString missReason;
+        document = Scenario::ScenarioCache::load(
+            scenarioPath, Scenario::ScenarioCache::Stage::Parsed,
+            &missReason);
+        if (!document)
+            qCDebug(lcScenario)
+                << "ScenarioLoadService::parseAndValidateYaml: cache miss -"
+                << missReason;
+    }
+
     QString parseError;
-    auto document = Scenario::ScenarioSerializer::fromYaml(
-        scenarioPath, &parseError);
+    if (!document)
+    {
+        document = Scenario::ScenarioSerializer::fromYaml(
+            scenarioPath, &parseError);
+        QString cacheError;
+        if (document && m_scenarioCacheEnabled
+            && !Scenario::ScenarioCache::store(
+                scenarioPath, Scenario::ScenarioCache::Stage::Parsed,
+                *document, &cacheError))
+        {
+            qCDebug(lcScenario)
+                << "ScenarioLoadService::parseAndValidateYaml: cache not written -"
+                << cacheError;
+        }
+    }
     if (!document)
     {
         result.status = ScenarioLoadServiceStatus::ParseFailed;
@@ -66,7 +93,10 @@ ScenarioParseServiceResult ScenarioLoadService::parseAndValidateYaml(
         return result;
     }
 
-    result.issues = Scenario::ScenarioValidator::validate(*document);
+    Scenario::ValidationOptions validationOptions;
+    validationOptions.errorBudget = m_validationErrorBudget;
+    result.issues = Scenario::ScenarioValidator::validate(
+        *document, validationOptions, &result.issuesTruncated);
     if (hasValidationErrors(result.issues))
     {
         result.status = ScenarioLoadServiceStatus::ValidationFailed;
@@ -138,7 +168,11 @@ ScenarioLoadServiceResult ScenarioLoadService::loadValidatedDocument(
     }
 
     auto runtime =
-        std::make_unique<Scenario::ScenarioRuntime>(std::move(document));
+        m_controller
+            ? std::make_unique<Scenario::ScenarioRuntime>(
+                  std::move(document), m_controller)
+            : std::make_unique<Scenario::ScenarioRuntime>(
+                  std::move(document));
     QString runtimeLoadError;
     const auto runtimeFailureConnection = QObject::connect(
         runtime.get(), &Scenario::ScenarioRuntime::failed,
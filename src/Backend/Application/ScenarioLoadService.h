@@ -8,6 +8,8 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
+
 namespace Backend
 {
 namespace Scenario
@@ -49,6 +51,9 @@ struct ScenarioParseServiceResult
         ScenarioLoadServiceStatus::ParseFailed;
     QString                                      message;
     QList<Scenario::ValidationIssue>             issues;
+    /// True when validation stopped at the error budget; `issues` then
+    /// holds only the first errors and more may exist.
+    bool                                         issuesTruncated = false;
     std::unique_ptr<Scenario::ScenarioDocument>  document;
 
     bool succeeded() const
@@ -63,6 +68,30 @@ class ScenarioLoadService
 public:
     ScenarioLoadService() = default;
 
+    /// Runtimes created by this service apply to and run on
+    /// @p controller; null means the default instance.
+    explicit ScenarioLoadService(
+        CargoNetSim::CargoNetSimController *controller)
+        : m_controller(controller)
+    {
+    }
+
+    /// When enabled, parseAndValidateYaml reuses the binary ScenarioCache
+    /// entry beside the YAML on a content-hash hit and refreshes it on a
+    /// miss. Validation always runs. Off by default; the CLI turns it on.
+    void setScenarioCacheEnabled(bool enabled)
+    {
+        m_scenarioCacheEnabled = enabled;
+    }
+    bool scenarioCacheEnabled() const { return m_scenarioCacheEnabled; }
+
+    /// Stop parseAndValidateYaml's validation after this many errors
+    /// (see ValidationOptions::errorBudget). 0 = report every issue.
+    void setValidationErrorBudget(int budget)
+    {
+        m_validationErrorBudget = budget;
+    }
+
     ScenarioParseServiceResult parseAndValidateYaml(
         const QString &scenarioPath) const;
 
@@ -74,6 +103,11 @@ public:
 
     ScenarioLoadServiceResult loadValidatedDocument(
         std::unique_ptr<Scenario::ScenarioDocument> document) const;
+
+private:
+    CargoNetSim::CargoNetSimController *m_controller = nullptr;
+    bool m_scenarioCacheEnabled  = false;
+    int  m_validationErrorBudget = 0;
 };
 
 } // namespace Application
@@ -1,6 +1,8 @@
 #include "ScenarioPreviewService.h"
 
 #include "Backend/Application/ScenarioPersistenceService.h"
+#include "Backend/Commons/LogCategories.h"
+#include "Backend/Scenario/ScenarioCache.h"
 #include "Backend/Scenario/ScenarioDocument.h"
 #include "Backend/Scenario/ScenarioLinker.h"
 #include "Backend/Scenario/ScenarioRegistry.h"
@@ -48,7 +50,8 @@ QString firstValidationError(
 
 ScenarioPreviewServiceResult
 ScenarioPreviewService::buildPreviewJson(
-    std::unique_ptr<Scenario::ScenarioDocument> document) const
+    std::unique_ptr<Scenario::ScenarioDocument> document,
+    const QString                              &scenarioPath) const
 {
     ScenarioPreviewServiceResult result;
 
@@ -59,27 +62,67 @@ ScenarioPreviewService::buildPreviewJson(
         return result;
     }
 
-    Scenario::ScenarioRegistry registry;
-    QString                    loadError;
-    if (!Scenario::ScenarioLinker::loadNetworksForPreview(
-            *document, registry, &loadError))
+    // Keyed on the caller's document, not only on the YAML, so edits
+    // made in memory since the file was read are never replaced by a
+    // cached resolution of the file.
+    const bool useCache = !scenarioPath.isEmpty();
+    QByteArray inputDigest;
+    std::unique_ptr<Scenario::ScenarioDocument> cached;
+    if (useCache)
     {
-        result.status = ScenarioPreviewServiceStatus::NetworkLoadFailed;
-        result.message = loadError.isEmpty()
-            ? QStringLiteral("Failed to load preview networks")
-            : loadError;
-        return result;
+        inputDigest = Scenario::ScenarioCache::documentDigest(*document);
+        QString missReason;
+        cached = Scenario::ScenarioCache::load(
+            scenarioPath, Scenario::ScenarioCache::Stage::PreviewResolved,
+            &missReason, inputDigest);
+        if (!cached)
+            qCDebug(lcScenario)
+                << "ScenarioPreviewService::buildPreviewJson: cache miss -"
+                << missReason;
     }
 
-    document->linkages =
-        Scenario::ScenarioLinker::resolveLinkages(*document,
-                                                  registry);
-    document->connections =
-        Scenario::ScenarioLinker::resolveConnections(*document,
-                                                     registry);
-    document->globalLinks =
-        Scenario::ScenarioLinker::resolveGlobalLinks(*document,
-                                                     registry);
+    if (cached)
+    {
+        document = std::move(cached);
+    }
+    else
+    {
+        Scenario::ScenarioRegistry registry;
+        QString                    loadError;
+        if (!Scenario::ScenarioLinker::loadNetworksForPreview(
+                *document, registry, &loadError))
+        {
+            result.status = ScenarioPreviewServiceStatus::NetworkLoadFailed;
+            result.message = loadError.isEmpty()
+                ? QStringLiteral("Failed to load preview networks")
+                : loadError;
+            return result;
+        }
+
+        // Route metrics are enriched from the resolved linkages, so those
+        // go in before the connections and global links are resolved.
+        document->replaceRelationships(
+            Scenario::ScenarioLinker::resolveLinkages(*document, registry),
+            document->connections(), document->globalLinks());
+        document->replaceRelationships(
+            document->linkages(),
+            Scenario::ScenarioLinker::resolveConnections(*document,
+                                                         registry),
+            Scenario::ScenarioLinker::resolveGlobalLinks(*document,
+                                                         registry));
+
+        QString cacheError;
+        if (useCache
+            && !Scenario::ScenarioCache::store(
+                scenarioPath,
+                Scenario::ScenarioCache::Stage::PreviewResolved,
+                *document, &cacheError, inputDigest))
+        {
+            qCDebug(lcScenario)
+                << "ScenarioPreviewService::buildPreviewJson: cache not written -"
+                << cacheError;
+        }
+    }
 
     result.issues = Scenario::ScenarioValidator::validate(*document);
     if (hasValidationErrors(result.issues))
@@ -47,8 +47,14 @@ class ScenarioPreviewService
 public:
     ScenarioPreviewService() = default;
 
+    /// When @p scenarioPath is non-empty, the linker-resolved document is
+    /// read from / written to the ScenarioCache PreviewResolved stage for
+    /// that YAML, so an unchanged scenario skips network loading and
+    /// auto-rule resolution on the next preview. The entry is also keyed
+    /// by the content of @p document, so an edited document misses.
     ScenarioPreviewServiceResult buildPreviewJson(
-        std::unique_ptr<Scenario::ScenarioDocument> document) const;
+        std::unique_ptr<Scenario::ScenarioDocument> document,
+        const QString &scenarioPath = QString()) const;
 };
 
 } // namespace Application
@@ -222,10 +222,24 @@ void registerAllMetatypes()
         "CargoNetSim::Backend::SimulationTime*");
 }
 
-BackendBootstrapResult requireController()
+} // namespace
+
+BackendBootstrapService::BackendBootstrapService(
+    CargoNetSimController *controller)
+    : m_controller(controller)
+{
+}
+
+CargoNetSimController *BackendBootstrapService::controller() const
+{
+    return m_controller ? m_controller
+                        : CargoNetSim::CargoNetSimController::instance();
+}
+
+BackendBootstrapResult BackendBootstrapService::requireController() const
 {
     BackendBootstrapResult result;
-    if (CargoNetSim::CargoNetSimController::instance() == nullptr)
+    if (controller() == nullptr)
     {
         result.status = BackendBootstrapStatus::ControllerMissing;
         result.message = QStringLiteral(
@@ -234,8 +248,6 @@ BackendBootstrapResult requireController()
     return result;
 }
 
-} // namespace
-
 void BackendBootstrapService::registerMetatypesOnce()
 {
     static bool metatypesRegistered = false;
@@ -263,7 +275,7 @@ BackendBootstrapService::initializeController(
     if (!controllerCheck.succeeded())
         return controllerCheck;
 
-    auto &controller = CargoNetSim::CargoNetSimController::getInstance();
+    auto &controller = *this->controller();
     if (!controller.initialize(integrationExePath))
     {
         BackendBootstrapResult result;
@@ -286,7 +298,7 @@ BackendBootstrapResult BackendBootstrapService::startController() const
     if (!controllerCheck.succeeded())
         return controllerCheck;
 
-    auto &controller = CargoNetSim::CargoNetSimController::getInstance();
+    auto &controller = *this->controller();
     if (!controller.startAll())
     {
         BackendBootstrapResult result;
@@ -4,6 +4,8 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
+
 namespace Backend
 {
 
@@ -30,6 +32,10 @@ struct BackendBootstrapResult
 class BackendBootstrapService
 {
 public:
+    /// Bootstraps @p controller, or the default instance when null.
+    explicit BackendBootstrapService(
+        CargoNetSimController *controller = nullptr);
+
     static void registerMetatypesOnce();
 
     BackendBootstrapResult registerOnly() const;
@@ -41,6 +47,12 @@ public:
 
     BackendBootstrapResult initializeAndStartController(
         const QString &integrationExePath = QString()) const;
+
+private:
+    CargoNetSimController *controller() const;
+    BackendBootstrapResult requireController() const;
+
+    CargoNetSimController *m_controller = nullptr;
 };
 
 } // namespace Backend
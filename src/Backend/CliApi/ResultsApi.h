@@ -8,4 +8,5 @@
 #include "Backend/Scenario/PathKey.h"
 #include "Backend/Scenario/PathMetrics.h"
 #include "Backend/Scenario/PathSimulationResult.h"
+#include "Backend/Scenario/ScenarioExecutionResult.h"
 #include "Backend/Scenario/PropertyKeys.h"
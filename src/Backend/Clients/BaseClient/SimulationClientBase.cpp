@@ -17,6 +17,7 @@
 #include "Backend/Models/SimulationTime.h"
 #include "Backend/Utils/Utils.h"
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Commons/Trace.h"
 #include "QtWidgets/qmessagebox.h"
 
 namespace CargoNetSim
@@ -92,6 +93,20 @@ void SimulationClientBase::initializeClient(
     // Load RabbitMQ configuration from file and keychain
     loadRabbitMQConfig();
 
+    // Keep runtime contexts apart on a shared exchange
+    if (!m_routingNamespace.isEmpty())
+    {
+        const QString suffix = QLatin1Char('.') + m_routingNamespace;
+        m_commandQueue += suffix;
+        m_responseQueue += suffix;
+        m_sendingRoutingKey += suffix;
+        for (QString &key : m_receivingRoutingKeys)
+            key += suffix;
+        qCDebug(lcClient) << "SimulationClientBase::initializeClient:"
+                          << getClientTypeString()
+                          << "routing namespace" << m_routingNamespace;
+    }
+
     // Create RabbitMQ handler
     m_rabbitMQHandler = new RabbitMQHandler(
         nullptr, m_host, m_port, m_username, m_password,
@@ -154,6 +169,25 @@ void SimulationClientBase::setController(
     m_controller = controller;
 }
 
+void SimulationClientBase::setRoutingNamespace(
+    const QString &routingNamespace)
+{
+    if (m_rabbitMQHandler)
+    {
+        qCWarning(lcClient)
+            << "SimulationClientBase::setRoutingNamespace:"
+            << getClientTypeString()
+            << "already initialized; namespace ignored";
+        return;
+    }
+    m_routingNamespace = routingNamespace;
+}
+
+QString SimulationClientBase::routingNamespace() const
+{
+    return m_routingNamespace;
+}
+
 /**
  * Checks if the client is connected to the server.
  */
@@ -308,6 +342,31 @@ bool SimulationClientBase::sendCommandAndWait(
     const QStringList &expectedEvents, int timeoutMs,
     const QString &routingKey)
 {
+    return sendCommandAndWaitImpl(command, params, expectedEvents,
+                                  timeoutMs, routingKey,
+                                  /*reportFailures=*/true);
+}
+
+/**
+ * Sends a capability probe; no answer is not an error
+ */
+bool SimulationClientBase::probeCommandAndWait(
+    const QString &command, const QJsonObject &params,
+    const QStringList &expectedEvents, int timeoutMs)
+{
+    return sendCommandAndWaitImpl(command, params, expectedEvents,
+                                  timeoutMs, QString(),
+                                  /*reportFailures=*/false);
+}
+
+bool SimulationClientBase::sendCommandAndWaitImpl(
+    const QString &command, const QJsonObject &params,
+    const QStringList &expectedEvents, int timeoutMs,
+    const QString &routingKey, bool reportFailures)
+{
+    CNS_TRACE_SCOPE_DETAIL(Messaging, "SimulationClientBase::sendCommandAndWait",
+                           command);
+
     // Early check to avoid unnecessary work
     if (expectedEvents.isEmpty())
     {
@@ -365,6 +424,13 @@ bool SimulationClientBase::sendCommandAndWait(
     bool received = waitForEvent(waitEvents, timeoutMs);
     if (!received)
     {
+        if (!reportFailures)
+        {
+            qCDebug(lcClient)
+                << "No response to probe command:" << command
+                << "within" << timeoutMs << "ms";
+            return false;
+        }
         qCWarning(lcClient)
             << "Timeout waiting for response to command:"
             << command;
@@ -398,6 +464,13 @@ bool SimulationClientBase::sendCommandAndWait(
                             "Server reported an error"));
             }
 
+            if (!reportFailures)
+            {
+                qCDebug(lcClient)
+                    << "Server rejected probe command:" << command
+                    << "-" << errorMsg;
+                return false;
+            }
             qCWarning(lcClient)
                 << "Server reported error for command:" << command
                 << "-" << errorMsg;
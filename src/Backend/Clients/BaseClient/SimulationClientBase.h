@@ -158,6 +158,25 @@ public:
     virtual void
     setController(CargoNetSimController *controller);
 
+    /**
+     * @brief Sets the routing namespace of this client
+     *
+     * A non-empty namespace is appended to the command and
+     * response queue names and to every routing key when the
+     * client is initialized, so clients of different runtime
+     * contexts can share one exchange. Must be called before
+     * initializeClient(); empty keeps the default names.
+     * @param routingNamespace Namespace, usually the runtime
+     * context name
+     */
+    void setRoutingNamespace(const QString &routingNamespace);
+
+    /**
+     * @brief Gets the routing namespace
+     * @return Namespace, empty for the default context
+     */
+    QString routingNamespace() const;
+
     /**
      * @brief Checks if client is connected to server
      * @return True if connected
@@ -283,6 +302,25 @@ protected:
         int                timeoutMs  = 7200000, // 2 hour
         const QString     &routingKey = QString());
 
+    /**
+     * @brief Send a capability probe and wait for its response
+     *
+     * Same as sendCommandAndWait(), except that a timeout or a
+     * server-reported error is an expected "not supported" answer:
+     * it is logged at debug level and not reported to the logger.
+     *
+     * @param command Command name
+     * @param params Command parameters
+     * @param expectedEvents Events to wait for (at least
+     * one needed)
+     * @param timeoutMs Timeout in milliseconds; keep it short
+     * @return True if the server answered with an expected event
+     */
+    bool probeCommandAndWait(const QString     &command,
+                             const QJsonObject &params,
+                             const QStringList &expectedEvents,
+                             int                timeoutMs);
+
     /**
      * @brief Send a command without waiting for response
      * @param command Command name
@@ -449,6 +487,7 @@ protected:
     QString     m_responseQueue;
     QString     m_sendingRoutingKey;
     QStringList m_receivingRoutingKeys;
+    QString     m_routingNamespace;
 
     // Logging interface
     LoggerInterface *m_logger = nullptr;
@@ -482,6 +521,18 @@ private:
      */
     void loadRabbitMQConfig();
 
+    /**
+     * @brief Shared body of sendCommandAndWait() and
+     * probeCommandAndWait(); @p reportFailures selects whether
+     * timeouts and server errors are warnings or debug output.
+     */
+    bool sendCommandAndWaitImpl(const QString     &command,
+                                const QJsonObject &params,
+                                const QStringList &expectedEvents,
+                                int                timeoutMs,
+                                const QString     &routingKey,
+                                bool               reportFailures);
+
     // Command serialization
     QReadWriteLock m_commandSerializationMutex;
 
@@ -73,6 +73,19 @@ QString previewContainers(const QJsonArray &containers)
             .toJson(QJsonDocument::Compact));
 }
 
+QJsonArray shipsToJson(const QList<Ship *> &ships)
+{
+    QJsonArray shipsArray;
+    for (const auto *ship : ships)
+    {
+        if (ship)
+        {
+            shipsArray.append(ship->toJson());
+        }
+    }
+    return shipsArray;
+}
+
 QString finalDestinationHandledKey(const QString &networkName,
                                    const QString &shipId)
 {
@@ -282,25 +295,44 @@ bool ShipSimulationClient::defineSimulator(
     const QMap<QString, QStringList>
                   &destinationTerminalIds,
     const QString &networkPath)
+{
+    if (!defineSimulator(networkName, timeStep,
+                         shipsToJson(ships),
+                         destinationTerminalIds, networkPath))
+    {
+        return false;
+    }
+    adoptShips(ships);
+    return true;
+}
+
+/**
+ * @brief Defines a new ship simulator from serialized ships
+ *
+ * @param networkName Network name
+ * @param timeStep Simulation time step
+ * @param shipDefinitions Ship::toJson() objects
+ * @param destinationTerminalIds Ship ID to terminal IDs map
+ * @param networkPath Network file path
+ * @return True if successful
+ */
+bool ShipSimulationClient::defineSimulator(
+    const QString &networkName, const double timeStep,
+    const QJsonArray &shipDefinitions,
+    const QMap<QString, QStringList>
+                  &destinationTerminalIds,
+    const QString &networkPath)
 {
     return executeSerializedCommand([&]() {
         try
         {
-            QJsonArray shipsArray;
-            for (const auto *ship : ships)
-            {
-                if (ship)
-                {
-                    shipsArray.append(ship->toJson());
-                }
-            }
             QJsonObject params;
             params["networkFilePath"] = networkPath;
             params["networkName"]     = networkName;
             params["timeStep"]        = timeStep;
-            if (!ships.isEmpty())
+            if (!shipDefinitions.isEmpty())
             {
-                params["ships"] = shipsArray;
+                params["ships"] = shipDefinitions;
             }
             bool success = sendCommandAndWait(
                 "defineSimulator", params,
@@ -310,22 +342,9 @@ bool ShipSimulationClient::defineSimulator(
                 CargoNetSim::Backend::Commons::
                     ScopedWriteLock locker(
                         m_dataAccessMutex);
-                for (auto *ship : ships)
-                {
-                    if (ship)
-                    {
-                        m_loadedShips[ship->getUserId()] =
-                            ship;
-                        auto terminals =
-                            destinationTerminalIds.value(
-                                ship->getUserId());
-                        m_shipsDestinationTerminals
-                            [ship->getUserId()] = terminals;
-                        m_finalDestinationHandledShips.remove(
-                            finalDestinationHandledKey(
-                                networkName, ship->getUserId()));
-                    }
-                }
+                registerShipsLocked(networkName,
+                                    shipDefinitions,
+                                    destinationTerminalIds);
             }
             return success;
         }
@@ -552,19 +571,33 @@ bool ShipSimulationClient::addShipsToSimulator(
     const QString &networkName, const QList<Ship *> &ships,
     const QMap<QString, QStringList>
         &destinationTerminalIds)
+{
+    if (!addShipsToSimulator(networkName, shipsToJson(ships),
+                             destinationTerminalIds))
+    {
+        return false;
+    }
+    adoptShips(ships);
+    return true;
+}
+
+/**
+ * @brief Adds serialized ships to an existing simulator
+ *
+ * @param networkName Target network name
+ * @param shipDefinitions Ship::toJson() objects
+ * @param destinationTerminalIds Ship ID to terminal IDs map
+ * @return True if successful
+ */
+bool ShipSimulationClient::addShipsToSimulator(
+    const QString &networkName, const QJsonArray &shipDefinitions,
+    const QMap<QString, QStringList>
+        &destinationTerminalIds)
 {
     return executeSerializedCommand([&]() {
-        QJsonArray shipsArray;
-        for (const auto *ship : ships)
-        {
-            if (ship)
-            {
-                shipsArray.append(ship->toJson());
-            }
-        }
         QJsonObject params;
         params["networkName"] = networkName;
-        params["ships"]       = shipsArray;
+        params["ships"]       = shipDefinitions;
         bool success          = sendCommandAndWait(
             "addShipsToSimulator", params,
             {"shipaddedtosimulator"});
@@ -572,21 +605,8 @@ bool ShipSimulationClient::addShipsToSimulator(
         {
             CargoNetSim::Backend::Commons::ScopedWriteLock
                 locker(m_dataAccessMutex);
-            for (auto *ship : ships)
-            {
-                if (ship)
-                {
-                    m_loadedShips[ship->getUserId()] = ship;
-                    auto terminals =
-                        destinationTerminalIds.value(
-                            ship->getUserId());
-                    m_shipsDestinationTerminals
-                        [ship->getUserId()] = terminals;
-                    m_finalDestinationHandledShips.remove(
-                        finalDestinationHandledKey(
-                            networkName, ship->getUserId()));
-                }
-            }
+            registerShipsLocked(networkName, shipDefinitions,
+                                destinationTerminalIds);
             if (m_logger)
             {
                 m_logger->log(
@@ -598,6 +618,34 @@ bool ShipSimulationClient::addShipsToSimulator(
     });
 }
 
+void ShipSimulationClient::adoptShips(const QList<Ship *> &ships)
+{
+    CargoNetSim::Backend::Commons::ScopedWriteLock locker(
+        m_dataAccessMutex);
+    for (auto *ship : ships)
+    {
+        if (ship)
+        {
+            m_loadedShips[ship->getUserId()] = ship;
+        }
+    }
+}
+
+void ShipSimulationClient::registerShipsLocked(
+    const QString &networkName, const QJsonArray &shipDefinitions,
+    const QMap<QString, QStringList> &destinationTerminalIds)
+{
+    for (const QJsonValue &definition : shipDefinitions)
+    {
+        const QString shipId =
+            definition.toObject().value("ID").toString();
+        m_shipsDestinationTerminals[shipId] =
+            destinationTerminalIds.value(shipId);
+        m_finalDestinationHandledShips.remove(
+            finalDestinationHandledKey(networkName, shipId));
+    }
+}
+
 /**
  * @brief Adds containers to a ship
  *
@@ -185,6 +185,32 @@ public:
                                   &destinationTerminalIds,
                     const QString &networkPath = "Default");
 
+    /**
+     * @brief Defines a new ship simulator from serialized ships
+     *
+     * Same as the Ship overload, but takes the ships as
+     * Ship::toJson() objects so callers can send shared
+     * vehicle templates without building Ship copies. The
+     * client takes no ownership of anything.
+     *
+     * @param networkName Unique name for the simulation
+     * network
+     * @param timeStep Time increment for simulation steps
+     * @param shipDefinitions Ship::toJson() objects
+     * @param destinationTerminalIds Map of ship IDs to
+     * terminal IDs
+     * @param networkPath Path to network file, defaults to
+     * "Default"
+     * @return True if the simulator is defined successfully
+     */
+    bool
+    defineSimulator(const QString    &networkName,
+                    const double      timeStep,
+                    const QJsonArray &shipDefinitions,
+                    const QMap<QString, QStringList>
+                                  &destinationTerminalIds,
+                    const QString &networkPath = "Default");
+
     /**
      * @brief Runs the simulator for a bounded interactive chunk
      *
@@ -273,6 +299,21 @@ public:
                         const QMap<QString, QStringList>
                             &destinationTerminalIds);
 
+    /**
+     * @brief Adds serialized ships to an existing simulator
+     *
+     * @param networkName Target network name
+     * @param shipDefinitions Ship::toJson() objects
+     * @param destinationTerminalIds Map of ship IDs to
+     * terminal IDs
+     * @return True if ships are added successfully
+     */
+    bool
+    addShipsToSimulator(const QString    &networkName,
+                        const QJsonArray &shipDefinitions,
+                        const QMap<QString, QStringList>
+                            &destinationTerminalIds);
+
     /**
      * @brief Adds containers to a ship
      *
@@ -440,6 +481,28 @@ signals:
                                double         eventTimeSeconds);
 
 private:
+    /**
+     * @brief Takes ownership of ships the simulator accepted
+     * @param ships Ships from a successful define or add
+     */
+    void adoptShips(const QList<Ship *> &ships);
+
+    /**
+     * @brief Records destinations of newly added ships
+     *
+     * Caller holds the data write lock.
+     *
+     * @param networkName Network the ships were added to
+     * @param shipDefinitions Ship::toJson() objects
+     * @param destinationTerminalIds Map of ship IDs to
+     * terminal IDs
+     */
+    void registerShipsLocked(
+        const QString    &networkName,
+        const QJsonArray &shipDefinitions,
+        const QMap<QString, QStringList>
+            &destinationTerminalIds);
+
     /**
      * @brief Internal method to unload containers
      *
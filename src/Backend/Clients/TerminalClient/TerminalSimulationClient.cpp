@@ -28,6 +28,25 @@ QJsonArray jsonArrayFromStringList(const QStringList &values)
 
 } // namespace
 
+TerminalSimulationClient::TopPathView
+TerminalSimulationClient::TopPathView::fromJson(
+    const QJsonObject &pathObj)
+{
+    TopPathView view;
+    view.pathId        = pathObj.value("path_id").toInt();
+    view.pathUid       = pathObj.value("path_uid").toString();
+    view.rank          = pathObj.value("rank").toInt(0);
+    view.totalPathCost =
+        pathObj.value("total_path_cost").toDouble(0.0);
+    view.rankingCost =
+        pathObj.value("ranking_cost")
+            .toDouble(view.totalPathCost);
+    view.segmentCount =
+        pathObj.value("segments").toArray().size();
+    view.json = pathObj;
+    return view;
+}
+
 QString TerminalSimulationClient::makeTopPathsCacheKey(
     const QString &start, const QString &end, int mode,
     int requestedTopN,
@@ -135,14 +154,7 @@ TerminalSimulationClient::~TerminalSimulationClient()
     }
     m_shortestPaths.clear();
 
-    // Clean up top paths (Path destructor handles segments)
-    for (const QList<Path *> &paths : m_topPaths.values())
-    {
-        for (Path *path : paths)
-        {
-            delete path;
-        }
-    }
+    // Top paths are views on the server payload
     m_topPaths.clear();
 
     // Clean up only dequeued containers
@@ -356,44 +368,50 @@ bool TerminalSimulationClient::addTerminal(
 bool TerminalSimulationClient::addTerminals(
     const QList<Terminal *> &terminals)
 {
-    // Execute command with serialization
-    return executeSerializedCommand([&]() {
-        // Validate input
-        if (terminals.isEmpty())
-        {
-            qCCritical(lcClientTerminal) << "Empty terminals list";
-            return false;
-        }
-
-        // Prepare parameters for bulk addition
-        QJsonObject params;
-        QJsonArray  terminalsArray;
+    // Validate input
+    if (terminals.isEmpty())
+    {
+        qCCritical(lcClientTerminal) << "Empty terminals list";
+        return false;
+    }
 
-        // Convert each terminal to JSON
-        for (const Terminal *terminal : terminals)
+    QList<const Terminal *> valid;
+    valid.reserve(terminals.size());
+    for (const Terminal *terminal : terminals)
+    {
+        if (!terminal)
         {
-            if (!terminal)
-            {
-                qCWarning(lcClientTerminal)
-                    << "Skipping null terminal pointer";
-                continue;
-            }
-            terminalsArray.append(terminal->toJson());
+            qCWarning(lcClientTerminal)
+                << "Skipping null terminal pointer";
+            continue;
         }
+        valid.append(terminal);
+    }
 
-        // Skip if no valid terminals
-        if (terminalsArray.isEmpty())
-        {
-            qCCritical(lcClientTerminal) << "No valid terminals to add";
-            return false;
-        }
+    // Skip if no valid terminals
+    if (valid.isEmpty())
+    {
+        qCCritical(lcClientTerminal) << "No valid terminals to add";
+        return false;
+    }
 
-        params["terminals"] = terminalsArray;
+    return addTerminals(
+        valid.size(),
+        [&valid](int begin, int end) {
+            QJsonArray terminalsArray;
+            for (int i = begin; i < end; ++i)
+                terminalsArray.append(valid[i]->toJson());
+            return terminalsArray;
+        },
+        Commons::ChunkedUpload());
+}
 
-        // Send command to server
-        return sendCommandAndWait("add_terminals", params,
-                                  {"terminalsAdded"});
-    });
+bool TerminalSimulationClient::addTerminals(
+    int count, const std::function<QJsonArray(int, int)> &encode,
+    const Commons::ChunkedUpload &upload)
+{
+    return sendInChunks("add_terminals", "terminals", QJsonObject(),
+                        count, encode, {"terminalsAdded"}, upload);
 }
 
 // Add terminal alias
@@ -518,43 +536,49 @@ bool TerminalSimulationClient::addRoute(
 bool TerminalSimulationClient::addRoutes(
     const QList<PathSegment *> &routes)
 {
-    // Execute command with serialization
-    return executeSerializedCommand([&]() {
-        // Validate input
-        if (routes.isEmpty())
-        {
-            qCCritical(lcClientTerminal) << "Empty routes list";
-            return false;
-        }
-
-        // Prepare parameters for bulk addition
-        QJsonObject params;
-        QJsonArray  routesArray;
+    // Validate input
+    if (routes.isEmpty())
+    {
+        qCCritical(lcClientTerminal) << "Empty routes list";
+        return false;
+    }
 
-        // Convert each route to JSON
-        for (const PathSegment *route : routes)
+    QList<const PathSegment *> valid;
+    valid.reserve(routes.size());
+    for (const PathSegment *route : routes)
+    {
+        if (!route)
         {
-            if (!route)
-            {
-                qCWarning(lcClientTerminal) << "Skipping null route pointer";
-                continue;
-            }
-            routesArray.append(route->toJson());
+            qCWarning(lcClientTerminal) << "Skipping null route pointer";
+            continue;
         }
+        valid.append(route);
+    }
 
-        // Skip if no valid routes
-        if (routesArray.isEmpty())
-        {
-            qCCritical(lcClientTerminal) << "No valid routes to add";
-            return false;
-        }
+    // Skip if no valid routes
+    if (valid.isEmpty())
+    {
+        qCCritical(lcClientTerminal) << "No valid routes to add";
+        return false;
+    }
 
-        params["routes"] = routesArray;
+    return addRoutes(
+        valid.size(),
+        [&valid](int begin, int end) {
+            QJsonArray routesArray;
+            for (int i = begin; i < end; ++i)
+                routesArray.append(valid[i]->toJson());
+            return routesArray;
+        },
+        Commons::ChunkedUpload());
+}
 
-        // Send command to server
-        return sendCommandAndWait("add_routes", params,
-                                  {"routesAdded"});
-    });
+bool TerminalSimulationClient::addRoutes(
+    int count, const std::function<QJsonArray(int, int)> &encode,
+    const Commons::ChunkedUpload &upload)
+{
+    return sendInChunks("add_routes", "routes", QJsonObject(), count,
+                        encode, {"routesAdded"}, upload);
 }
 
 // Change route weight
@@ -649,6 +673,34 @@ QList<Path *> TerminalSimulationClient::findTopPaths(
     const QString &start, const QString &end, int n,
     TransportationTypes::TransportationMode mode,
     bool                                    skipDelays)
+{
+    const QList<TopPathView> views =
+        findTopPathViews(start, end, n, mode, skipDelays);
+    // Terminal snapshots read m_terminalStatus
+    Commons::ScopedReadLock locker(m_dataMutex);
+    QList<Path *>           out;
+    out.reserve(views.size());
+    for (const TopPathView &view : views)
+    {
+        // A path whose JSON cannot be materialized is skipped rather
+        // than handed out as nullptr
+        if (Path *path = materializeTopPathLocked(view, nullptr))
+            out.append(path);
+        else
+            qCWarning(lcClientTerminal)
+                << "TerminalSimulationClient::findTopPaths:"
+                << "skipping path" << view.pathId << "that failed to"
+                << "materialize";
+    }
+    return out;
+}
+
+// Find top path views
+QList<TerminalSimulationClient::TopPathView>
+TerminalSimulationClient::findTopPathViews(
+    const QString &start, const QString &end, int n,
+    TransportationTypes::TransportationMode mode,
+    bool                                    skipDelays)
 {
     int modeInt = TransportationTypes::toInt(mode);
     // Execute top paths finding serially
@@ -667,14 +719,32 @@ QList<Path *> TerminalSimulationClient::findTopPaths(
     });
     // Access paths thread-safely
     Commons::ScopedReadLock locker(m_dataMutex);
-    const QString key = makeTopPathsCacheKey(
-        start, end, modeInt, n, skipDelays);
-    QList<Path *> out;
-    const auto cached = m_topPaths.value(key);
-    out.reserve(cached.size());
-    for (const auto *path : cached)
-        out.append(path ? path->clone() : nullptr);
-    return out;
+    return m_topPaths.value(makeTopPathsCacheKey(
+        start, end, modeInt, n, skipDelays));
+}
+
+Path *TerminalSimulationClient::materializeTopPath(
+    const TopPathView &view, QObject *parent) const
+{
+    Commons::ScopedReadLock locker(m_dataMutex);
+    return materializeTopPathLocked(view, parent);
+}
+
+Path *TerminalSimulationClient::materializeTopPathLocked(
+    const TopPathView &view, QObject *parent) const
+{
+    try
+    {
+        return Path::fromJson(view.json, m_terminalStatus,
+                              parent);
+    }
+    catch (const std::exception &e)
+    {
+        qCWarning(lcClientTerminal)
+            << "TerminalSimulationClient::materializeTopPath:"
+            << "path" << view.pathId << "-" << e.what();
+        return nullptr;
+    }
 }
 
 // Add single container
@@ -786,44 +856,90 @@ bool TerminalSimulationClient::addContainers(
     const QString                     &arrivalMode,
     const QString                     &arrivalSemantics)
 {
-    // Execute containers addition serially
-    return executeSerializedCommand([&]() {
-        // Prepare parameters for containers addition
-        QJsonObject params;
-        params["terminal_id"] = terminalId;
-        QJsonArray containersArray;
-        for (const auto *container : containers)
-        {
-            if (container)
-            {
-                containersArray.append(container->toJson());
-            }
-        }
-        params["containers"] = containersArray;
-        if (addTime >= 0.0)
-        {
-            params["adding_time"] = addTime;
-        }
-        if (!arrivalMode.isEmpty())
-        {
-            params["arrival_mode"] = arrivalMode;
-        }
-        if (!arrivalSemantics.isEmpty())
-        {
-            params["arrival_semantics"] = arrivalSemantics;
-        }
-        // Send containers addition command
-        const bool success = sendCommandAndWait(
-            "add_containers", params, {"containersAdded"});
-        if (!success)
+    QList<const ContainerCore::Container *> valid;
+    valid.reserve(containers.size());
+    for (const auto *container : containers)
+    {
+        if (container)
         {
-            return false;
+            valid.append(container);
         }
+    }
+    return addContainers(
+        terminalId, valid.size(),
+        [&valid](int begin, int end) {
+            QJsonArray containersArray;
+            for (int i = begin; i < end; ++i)
+                containersArray.append(valid[i]->toJson());
+            return containersArray;
+        },
+        addTime, arrivalMode, arrivalSemantics,
+        Commons::ChunkedUpload());
+}
+
+// Add containers in chunks
+bool TerminalSimulationClient::addContainers(
+    const QString &terminalId, int count,
+    const std::function<QJsonArray(int, int)> &encode,
+    double addTime, const QString &arrivalMode,
+    const QString                &arrivalSemantics,
+    const Commons::ChunkedUpload &upload)
+{
+    QJsonObject params;
+    params["terminal_id"] = terminalId;
+    if (addTime >= 0.0)
+    {
+        params["adding_time"] = addTime;
+    }
+    if (!arrivalMode.isEmpty())
+    {
+        params["arrival_mode"] = arrivalMode;
+    }
+    if (!arrivalSemantics.isEmpty())
+    {
+        params["arrival_semantics"] = arrivalSemantics;
+    }
+    return sendInChunks(
+        "add_containers", "containers", params, count, encode,
+        {"containersAdded"}, upload, [&]() {
+            return didContainersAddedEventSucceed(
+                QStringLiteral(
+                    "TerminalSimulationClient::addContainers(chunked):"),
+                terminalId, arrivalMode);
+        });
+}
 
-        return didContainersAddedEventSucceed(
-            QStringLiteral(
-                "TerminalSimulationClient::addContainers(list):"),
-            terminalId, arrivalMode);
+bool TerminalSimulationClient::sendInChunks(
+    const QString &command, const QString &itemsKey,
+    const QJsonObject &params, int count,
+    const std::function<QJsonArray(int, int)> &encode,
+    const QStringList                          &expectedEvents,
+    const Commons::ChunkedUpload               &upload,
+    const std::function<bool()>                &accepted)
+{
+    // One serialized command stream for all chunks, so no other
+    // command interleaves with a partial upload
+    return executeSerializedCommand([&]() {
+        return Commons::runChunkedUpload<QJsonArray>(
+            count, upload, encode,
+            [&](QJsonArray items, int begin, int end) {
+                QJsonObject chunkParams = params;
+                chunkParams[itemsKey]   = std::move(items);
+                if (!sendCommandAndWait(command, chunkParams,
+                                        expectedEvents)
+                    || (accepted && !accepted()))
+                {
+                    qCWarning(lcClientTerminal)
+                        << "TerminalSimulationClient::sendInChunks:"
+                        << command << "failed for items" << begin
+                        << "-" << end << "of" << count;
+                    return false;
+                }
+                qCDebug(lcClientTerminal)
+                    << "TerminalSimulationClient::sendInChunks:"
+                    << command << end << "/" << count;
+                return true;
+            });
     });
 }
 
@@ -979,6 +1095,102 @@ QJsonObject TerminalSimulationClient::releaseContainerReservation(
     return eventData.value(QStringLiteral("result")).toObject();
 }
 
+QJsonArray TerminalSimulationClient::reserveContainerBatch(
+    const QJsonArray &reservations)
+{
+    const bool success = executeSerializedCommand([&]() {
+        QJsonObject params;
+        params["reservations"] = reservations;
+        return sendCommandAndWait(
+            "reserve_containers_batch", params,
+            {"containersReservedBatch"});
+    });
+    if (!success)
+        return {};
+
+    const QJsonObject eventData =
+        getEventData(QStringLiteral("containersReservedBatch"));
+    if (!eventData.value(QStringLiteral("success")).toBool(false))
+        return {};
+    return eventData.value(QStringLiteral("result"))
+        .toObject()
+        .value(QStringLiteral("reservations"))
+        .toArray();
+}
+
+QJsonArray TerminalSimulationClient::commitContainerReservationBatch(
+    const QJsonArray &reservations,
+    double operationTimeSeconds)
+{
+    const bool success = executeSerializedCommand([&]() {
+        QJsonObject params;
+        params["reservations"] = reservations;
+        if (operationTimeSeconds >= 0.0)
+            params["operation_time"] = operationTimeSeconds;
+        return sendCommandAndWait(
+            "commit_container_reservations_batch", params,
+            {"containerReservationsCommittedBatch"});
+    });
+    if (!success)
+        return {};
+
+    const QJsonObject eventData = getEventData(
+        QStringLiteral("containerReservationsCommittedBatch"));
+    if (!eventData.value(QStringLiteral("success")).toBool(false))
+        return {};
+    return eventData.value(QStringLiteral("result"))
+        .toObject()
+        .value(QStringLiteral("reservations"))
+        .toArray();
+}
+
+QJsonArray TerminalSimulationClient::releaseContainerReservationBatch(
+    const QJsonArray &reservations)
+{
+    const bool success = executeSerializedCommand([&]() {
+        QJsonObject params;
+        params["reservations"] = reservations;
+        return sendCommandAndWait(
+            "release_container_reservations_batch", params,
+            {"containerReservationsReleasedBatch"});
+    });
+    if (!success)
+        return {};
+
+    const QJsonObject eventData = getEventData(
+        QStringLiteral("containerReservationsReleasedBatch"));
+    if (!eventData.value(QStringLiteral("success")).toBool(false))
+        return {};
+    return eventData.value(QStringLiteral("result"))
+        .toObject()
+        .value(QStringLiteral("reservations"))
+        .toArray();
+}
+
+bool TerminalSimulationClient::supportsReservationBatches(int timeoutMs)
+{
+    {
+        Commons::ScopedReadLock locker(m_dataMutex);
+        if (m_reservationBatchSupport.has_value())
+            return m_reservationBatchSupport.value();
+    }
+
+    const bool supported = executeSerializedCommand([&]() {
+        QJsonObject params;
+        params["reservations"] = QJsonArray();
+        return probeCommandAndWait(
+            "reserve_containers_batch", params,
+            {"containersReservedBatch"}, timeoutMs);
+    });
+    qCDebug(lcClientTerminal)
+        << "TerminalSimulationClient::supportsReservationBatches:"
+        << "supported=" << supported;
+
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    m_reservationBatchSupport = supported;
+    return supported;
+}
+
 // Get container count
 int TerminalSimulationClient::getContainerCount(
     const QString &terminalId)
@@ -1391,7 +1603,10 @@ void TerminalSimulationClient::onEventReceived(
     }
     else if (normEvent == "containersreserved"
              || normEvent == "containerreservationcommitted"
-             || normEvent == "containerreservationreleased")
+             || normEvent == "containerreservationreleased"
+             || normEvent == "containersreservedbatch"
+             || normEvent == "containerreservationscommittedbatch"
+             || normEvent == "containerreservationsreleasedbatch")
     {
         // Reservation responses are returned through getEventData() by the
         // synchronous caller; no additional typed cache is needed here.
@@ -1608,29 +1823,17 @@ void TerminalSimulationClient::onPathsFound(
     const QString key = makeTopPathsCacheKey(
         start, end, mode, requestedTopN, skipDelays);
 
-    // Lock mutex for thread-safe update
-    Commons::ScopedWriteLock locker(m_dataMutex);
-
-    // Clean up old top paths
-    QList<Path *> oldPaths = m_topPaths.value(key);
-    for (Path *oldPath : oldPaths)
+    // Keep the decoded payload; Paths are built on demand
+    QList<TopPathView> views;
+    views.reserve(paths.size());
+    for (const QJsonValue &pathVal : paths)
     {
-        delete oldPath;
+        views.append(TopPathView::fromJson(pathVal.toObject()));
     }
-    m_topPaths[key]
-        .clear(); // Clear the list after deleting
 
-    // Handle top paths
-    if (paths.size() > 0)
-    {
-        for (const QJsonValue &pathVal : paths)
-        {
-            QJsonObject pathObj = pathVal.toObject();
-            Path       *path    = Path::fromJson(
-                pathObj, m_terminalStatus, this);
-            m_topPaths[key].push_back(path);
-        }
-    }
+    // Lock mutex for thread-safe update
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    m_topPaths.insert(key, std::move(views));
 
     // Log event for auditing
     qCInfo(lcClientTerminal) << "Path found from" << start << "to"
@@ -1664,6 +1867,8 @@ void TerminalSimulationClient::onServerReset(
 {
     // Lock mutex for thread-safe cleanup
     Commons::ScopedWriteLock locker(m_dataMutex);
+    // A reset may come from a different server build
+    m_reservationBatchSupport.reset();
     // Clean up all terminal status objects
     for (auto it = m_terminalStatus.constBegin();
          it != m_terminalStatus.constEnd(); ++it)
@@ -1684,14 +1889,7 @@ void TerminalSimulationClient::onServerReset(
     }
     m_shortestPaths.clear();
 
-    // Clean up all top paths
-    for (const QList<Path *> &paths : m_topPaths.values())
-    {
-        for (Path *path : paths)
-        {
-            delete path;
-        }
-    }
+    // Drop all top path views
     m_topPaths.clear();
 
     // Clean up dequeued containers only
@@ -18,6 +18,7 @@
  */
 
 #include "Backend/Clients/BaseClient/SimulationClientBase.h"
+#include "Backend/Commons/ChunkedUpload.h"
 #include "Backend/Commons/ThreadSafetyUtils.h"
 #include "Backend/Models/Path.h"
 #include "Backend/Models/PathSegment.h"
@@ -31,6 +32,8 @@
 #include <QString>
 #include <QStringList>
 #include <containerLib/container.h>
+#include <functional>
+#include <optional>
 
 namespace CargoNetSim
 {
@@ -67,6 +70,29 @@ class TerminalSimulationClient : public SimulationClientBase
     Q_OBJECT
 
 public:
+    /**
+     * @struct TopPathView
+     * @brief One path of a cached pathFound payload
+     *
+     * Shares the decoded server JSON (implicitly shared, so
+     * copying a view never copies the payload) and exposes
+     * the ranking fields. No Path or PathSegment exists until
+     * materializeTopPath() is called.
+     */
+    struct TopPathView
+    {
+        int         pathId        = 0;   ///< Server path ID
+        QString     pathUid;             ///< Stable path UID
+        int         rank          = 0;   ///< Rank within pair
+        double      totalPathCost = 0.0; ///< Total cost
+        double      rankingCost   = 0.0; ///< Ranking cost
+        int         segmentCount  = 0;   ///< Segments in path
+        QJsonObject json;                ///< Raw path payload
+
+        /// View on one entry of a pathFound "paths" array.
+        static TopPathView fromJson(const QJsonObject &pathObj);
+    };
+
     /**
      * @brief Constructs the client instance
      * @param parent Parent QObject, defaults to nullptr
@@ -147,10 +173,27 @@ public:
      * @brief Add multiple terminals at once
      * @param terminals List of terminals to add
      * @return True if the operation was successful
+     *
+     * Sent in add_terminals commands of at most
+     * Commons::ChunkedUpload::kDefaultMaxItems terminals.
      */
     Q_INVOKABLE bool
     addTerminals(const QList<Terminal *> &terminals);
 
+    /**
+     * @brief Adds terminals in bounded add_terminals commands
+     * @param count Number of terminals
+     * @param encode Builds the JSON of terminals [begin, end);
+     * runs on a worker thread for the next chunk while the
+     * previous one is in flight
+     * @param upload Chunk size and progress hook
+     * @return True if every chunk was added
+     */
+    bool addTerminals(
+        int count,
+        const std::function<QJsonArray(int, int)> &encode,
+        const Commons::ChunkedUpload               &upload);
+
     /**
      * @brief Adds an alias to a terminal
      * @param terminalId Terminal identifier
@@ -222,10 +265,27 @@ public:
      * @brief Add multiple routes at once
      * @param routes List of routes to add
      * @return True if the operation was successful
+     *
+     * Sent in add_routes commands of at most
+     * Commons::ChunkedUpload::kDefaultMaxItems routes.
      */
     Q_INVOKABLE bool
     addRoutes(const QList<PathSegment *> &routes);
 
+    /**
+     * @brief Adds routes in bounded add_routes commands
+     * @param count Number of routes
+     * @param encode Builds the JSON of routes [begin, end);
+     * runs on a worker thread for the next chunk while the
+     * previous one is in flight
+     * @param upload Chunk size and progress hook
+     * @return True if every chunk was added
+     */
+    bool addRoutes(
+        int count,
+        const std::function<QJsonArray(int, int)> &encode,
+        const Commons::ChunkedUpload               &upload);
+
     /**
      * @brief Updates route weight attributes
      * @param start Starting terminal ID
@@ -291,16 +351,57 @@ public:
      * @param n Number of paths to return
      * @param mode Transportation mode
      * @param skipDelays Skip same mode delays, default true
-     * @return List of Path pointers
+     * @return List of Path pointers, never containing nullptr
      * @note Caller must delete each pointer
      *
-     * Retrieves the top N shortest paths.
+     * Retrieves the top N shortest paths. Each Path is built
+     * once from the cached payload; a path that fails to
+     * build is logged and left out. Prefer findTopPathViews()
+     * when only some of the paths are needed.
      */
     Q_INVOKABLE QList<Path *> findTopPaths(
         const QString &start, const QString &end, int n,
         TransportationTypes::TransportationMode mode,
         bool skipDelays = true);
 
+    /**
+     * @brief Finds top N shortest paths without building them
+     * @param start Starting terminal ID
+     * @param end Ending terminal ID
+     * @param n Number of paths to return
+     * @param mode Transportation mode
+     * @param skipDelays Skip same mode delays, default true
+     * @return Views in server rank order
+     *
+     * Same request as findTopPaths(); pass the views that are
+     * actually used to materializeTopPath().
+     */
+    QList<TopPathView> findTopPathViews(
+        const QString &start, const QString &end, int n,
+        TransportationTypes::TransportationMode mode,
+        bool skipDelays = true);
+
+    /**
+     * @brief Builds the Path a view refers to
+     * @param view View from findTopPathViews()
+     * @param parent Parent QObject, defaults to nullptr
+     * @return New Path, or nullptr if the payload is invalid
+     * @note Caller owns the returned pointer
+     */
+    Path *materializeTopPath(const TopPathView &view,
+                             QObject *parent = nullptr) const;
+
+    /**
+     * @brief Key of one find_top_paths request
+     *
+     * Identifies the pair and every request option, so one
+     * discovery variant never answers for another.
+     */
+    static QString makeTopPathsCacheKey(
+        const QString &start, const QString &end, int mode,
+        int requestedTopN,
+        bool skipSameModeTerminalDelaysAndCosts);
+
     // Container Management
     /**
      * @brief Adds a container to a terminal
@@ -351,6 +452,29 @@ public:
         const QString                     &arrivalMode = "",
         const QString                     &arrivalSemantics = "");
 
+    /**
+     * @brief Adds containers to a terminal in bounded
+     * add_containers commands
+     * @param terminalId Terminal identifier
+     * @param count Number of containers
+     * @param encode Builds the JSON of containers
+     * [begin, end); runs on a worker thread for the next
+     * chunk while the previous one is in flight
+     * @param addTime Addition time, -1.0 for none
+     * @param arrivalMode Transportation mode string
+     * @param arrivalSemantics Arrival semantics wire value
+     * @param upload Chunk size and progress hook
+     * @return True if every chunk was added
+     */
+    bool addContainers(
+        const QString                             &terminalId,
+        int                                        count,
+        const std::function<QJsonArray(int, int)> &encode,
+        double                                     addTime,
+        const QString                             &arrivalMode,
+        const QString                             &arrivalSemantics,
+        const Commons::ChunkedUpload              &upload);
+
     /**
      * @brief Adds containers from JSON data
      * @param terminalId Terminal identifier
@@ -426,6 +550,45 @@ public:
     releaseContainerReservation(const QString &terminalId,
                                 const QString &reservationId);
 
+    /**
+     * @brief Reserves containers for a whole dispatch wave in one command.
+     * @param reservations Objects with terminal_id, reservation_id and
+     *        criteria, as for reserveContainers()
+     * @return One entry per reservation, in order: terminal_id,
+     *         reservation_id, success, and on success the single-item
+     *         result under "result" (otherwise "error"). Empty when the
+     *         command itself failed.
+     */
+    Q_INVOKABLE QJsonArray
+    reserveContainerBatch(const QJsonArray &reservations);
+
+    /**
+     * @brief Commits several reservations as pickup departures in one
+     * command; entries and result as for reserveContainerBatch().
+     */
+    Q_INVOKABLE QJsonArray
+    commitContainerReservationBatch(const QJsonArray &reservations,
+                                    double operationTimeSeconds = -1.0);
+
+    /**
+     * @brief Releases several reservations in one command; entries and
+     * result as for reserveContainerBatch().
+     */
+    Q_INVOKABLE QJsonArray
+    releaseContainerReservationBatch(const QJsonArray &reservations);
+
+    /**
+     * @brief Whether the server accepts the reservation batch commands
+     *
+     * Asked once per server session with an empty
+     * reserve_containers_batch, which has no side effects; the answer
+     * is remembered until the server resets. A server that rejects the
+     * command or does not answer within @p timeoutMs is treated as not
+     * supporting any of the three batch commands; that is an expected
+     * answer from older servers, so it is logged at debug level only.
+     */
+    bool supportsReservationBatches(int timeoutMs = 1000);
+
     /**
      * @brief Gets container count for a terminal
      * @param terminalId Terminal identifier
@@ -584,10 +747,20 @@ protected:
                          const QJsonObject &message) override;
 
 private:
-    static QString makeTopPathsCacheKey(
-        const QString &start, const QString &end, int mode,
-        int requestedTopN,
-        bool skipSameModeTerminalDelaysAndCosts);
+    /// Sends @p count items under @p itemsKey of @p params as
+    /// one @p command per chunk; @p accepted (if set) vets each
+    /// acknowledged chunk.
+    bool sendInChunks(
+        const QString &command, const QString &itemsKey,
+        const QJsonObject &params, int count,
+        const std::function<QJsonArray(int, int)> &encode,
+        const QStringList                          &expectedEvents,
+        const Commons::ChunkedUpload               &upload,
+        const std::function<bool()> &accepted = {});
+
+    /// Path materialization; caller holds m_dataMutex.
+    Path *materializeTopPathLocked(const TopPathView &view,
+                                   QObject *parent) const;
 
     bool didContainersAddedEventSucceed(
         const QString &operation,
@@ -703,9 +876,9 @@ private:
     QMap<QString, QList<PathSegment *>> m_shortestPaths;
 
     /**
-     * @brief Map of path keys to Path lists
+     * @brief Map of path keys to pathFound path views
      */
-    QMap<QString, QList<Path *>> m_topPaths;
+    QMap<QString, QList<TopPathView>> m_topPaths;
 
     /**
      * @brief Map of terminal IDs to container lists
@@ -734,6 +907,12 @@ private:
      */
     QJsonObject m_pingResponse;
 
+    /**
+     * @brief Reservation batch support of the current server session;
+     *        unset until supportsReservationBatches() asks.
+     */
+    std::optional<bool> m_reservationBatchSupport;
+
     /**
      * @brief Dedicated low-level probe transport
      *
@@ -2,6 +2,7 @@
 #include "Backend/Commons/LogCategories.h"
 #include "Backend/Commons/Units.h"
 #include <QFile>
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -720,7 +721,8 @@ NeTrainSimNetwork::getVariables() const
 }
 
 void NeTrainSimNetwork::loadNetwork(
-    const QString &nodesFile, const QString &linksFile)
+    const QString &nodesFile, const QString &linksFile,
+    std::shared_ptr<const NetworkImage> image)
 {
     qCDebug(lcRail) << "[RailLoad] loadNetwork start"
              << "nodes=" << nodesFile
@@ -736,6 +738,7 @@ void NeTrainSimNetwork::loadNetwork(
 
     // Clear the graph
     m_graph->clear();
+    m_image.reset();
 
     try
     {
@@ -761,10 +764,19 @@ void NeTrainSimNetwork::loadNetwork(
         qCDebug(lcRail) << "[RailLoad] generateLinks ok, links="
                  << m_links.size();
 
-        // Build graph representation
-        qCDebug(lcRail) << "[RailLoad] buildGraph begin";
-        buildGraph();
-        qCDebug(lcRail) << "[RailLoad] buildGraph ok";
+        // Build graph representation, unless a shared image
+        // already carries it
+        if (image && adoptImage(std::move(image)))
+        {
+            qCDebug(lcRail) << "[RailLoad] using network image"
+                            << m_image->filePath();
+        }
+        else
+        {
+            qCDebug(lcRail) << "[RailLoad] buildGraph begin";
+            buildGraph();
+            qCDebug(lcRail) << "[RailLoad] buildGraph ok";
+        }
 
         qCDebug(lcRail) << "[RailLoad] emit signals";
         emit networkChanged();
@@ -1069,8 +1081,7 @@ ShortestPathResult NeTrainSimNetwork::findShortestPath(
     int startNodeId, int endNodeId,
     const QString &optimizeFor)
 {
-    QMutexLocker       locker(&m_mutex);
-    ShortestPathResult result;
+    QMutexLocker locker(&m_mutex);
 
     if (optimizeFor != "distance" && optimizeFor != "time")
     {
@@ -1079,12 +1090,58 @@ ShortestPathResult NeTrainSimNetwork::findShortestPath(
             "'distance' or 'time'");
     }
 
-    result.optimizationCriterion = optimizeFor;
+    if (m_image)
+        return m_image->findShortestPath(
+            startNodeId, endNodeId,
+            optimizeFor == "time" ? NetworkImage::Metric::Time
+                                  : NetworkImage::Metric::Distance);
 
     // Find shortest path using the directed graph
-    result.pathNodes = m_graph->findShortestPath(
-        startNodeId, endNodeId, optimizeFor);
+    return pathResultFor(m_graph->findShortestPath(
+                             startNodeId, endNodeId, optimizeFor),
+                         optimizeFor);
+}
+
+QMap<int, ShortestPathResult> NeTrainSimNetwork::findShortestPaths(
+    int startNodeId, const QVector<int> &endNodeIds,
+    const QString &optimizeFor)
+{
+    if (optimizeFor != "distance" && optimizeFor != "time")
+    {
+        throw std::invalid_argument(
+            "optimize_for must be either "
+            "'distance' or 'time'");
+    }
+
+    const DirectedGraph<int>           *graph = nullptr;
+    std::shared_ptr<const NetworkImage> image;
+    {
+        QMutexLocker locker(&m_mutex);
+        graph = m_graph;
+        image = m_image;
+    }
+    if (image)
+        return image->findShortestPaths(
+            startNodeId, endNodeIds,
+            optimizeFor == "time" ? NetworkImage::Metric::Time
+                                  : NetworkImage::Metric::Distance);
+
+    const QMap<int, QVector<int>> paths =
+        graph->findShortestPaths(startNodeId, endNodeIds, optimizeFor);
+
+    QMutexLocker                  locker(&m_mutex);
+    QMap<int, ShortestPathResult> results;
+    for (auto it = paths.constBegin(); it != paths.constEnd(); ++it)
+        results.insert(it.key(), pathResultFor(it.value(), optimizeFor));
+    return results;
+}
 
+ShortestPathResult NeTrainSimNetwork::pathResultFor(
+    const QVector<int> &pathNodes, const QString &optimizeFor) const
+{
+    ShortestPathResult result;
+    result.optimizationCriterion = optimizeFor;
+    result.pathNodes             = pathNodes;
     // If no path found, return empty result (already
     // initialized with infinity values)
     if (result.pathNodes.isEmpty())
@@ -1297,9 +1354,132 @@ void NeTrainSimNetwork::setNodesAndLinksFromJson(
 
 void NeTrainSimNetwork::initializeGraph()
 {
+    m_image.reset();
     buildGraph();
 }
 
+bool NeTrainSimNetwork::attachImage(
+    std::shared_ptr<const NetworkImage> image)
+{
+    QMutexLocker locker(&m_mutex);
+    return image && adoptImage(std::move(image));
+}
+
+std::shared_ptr<const NetworkImage> NeTrainSimNetwork::image() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_image;
+}
+
+bool NeTrainSimNetwork::adoptImage(
+    std::shared_ptr<const NetworkImage> image)
+{
+    if (image->nodeCount() != m_nodes.size()
+        || image->linkCount() != m_links.size())
+    {
+        qCWarning(lcRail)
+            << "NeTrainSimNetwork::adoptImage:" << image->filePath()
+            << "has" << image->nodeCount() << "nodes /"
+            << image->linkCount() << "links, network has"
+            << m_nodes.size() << "/" << m_links.size();
+        return false;
+    }
+
+    // The image carries everything the searches need, so the
+    // per-edge attribute maps of the graph can go.
+    m_image = std::move(image);
+    m_graph->clear();
+    return true;
+}
+
+void NeTrainSimNetwork::writeImage(
+    NetworkImage::Builder &builder) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    QVector<double> isTerminal, dwellTime;
+    for (const NeTrainSimNode *node : m_nodes)
+    {
+        builder.addNode(node->getUserId(), node->getX(),
+                        node->getY());
+        isTerminal.append(node->isTerminal() ? 1.0 : 0.0);
+        dwellTime.append(node->dwellTimeUnits().value());
+    }
+    builder.addAttribute(NetworkImage::Scope::Node,
+                         QStringLiteral("is_terminal"), isTerminal);
+    builder.addAttribute(NetworkImage::Scope::Node,
+                         QStringLiteral("dwell_time"), dwellTime);
+
+    // A path reports, per hop, the first link in m_links that
+    // joins the two nodes (getPathLinks) and the travel time of
+    // the first link carrying that id (pathResultFor).
+    QHash<quint64, const NeTrainSimLink *> linkForHop;
+    QHash<int, const NeTrainSimLink *>     linkForId;
+    auto hop = [](int from, int to) {
+        return (static_cast<quint64>(static_cast<quint32>(from)) << 32)
+               | static_cast<quint32>(to);
+    };
+    QVector<double> directions, grade, curvature, hasCatenary;
+    for (const NeTrainSimLink *link : m_links)
+    {
+        const int from = link->getFromNode()->getUserId();
+        const int to   = link->getToNode()->getUserId();
+        builder.addLink(link->getUserId(), from, to,
+                        link->lengthUnits().value(),
+                        link->maxSpeedUnits().value());
+        directions.append(link->getNumDirections());
+        grade.append(link->getGrade());
+        curvature.append(link->getCurvature());
+        hasCatenary.append(link->hasCatenary() ? 1.0 : 0.0);
+
+        if (!linkForHop.contains(hop(from, to)))
+            linkForHop.insert(hop(from, to), link);
+        if (link->getNumDirections() == 2
+            && !linkForHop.contains(hop(to, from)))
+            linkForHop.insert(hop(to, from), link);
+        if (!linkForId.contains(link->getUserId()))
+            linkForId.insert(link->getUserId(), link);
+    }
+    builder.addAttribute(NetworkImage::Scope::Link,
+                         QStringLiteral("directions"), directions);
+    builder.addAttribute(NetworkImage::Scope::Link,
+                         QStringLiteral("grade"), grade);
+    builder.addAttribute(NetworkImage::Scope::Link,
+                         QStringLiteral("curvature"), curvature);
+    builder.addAttribute(NetworkImage::Scope::Link,
+                         QStringLiteral("has_catenary"), hasCatenary);
+
+    for (int from : m_graph->getNodes())
+    {
+        for (const QPair<int, float> &edge :
+             m_graph->getOutgoingEdges(from))
+        {
+            const float speed =
+                m_graph->getEdgeAttributes(from, edge.first)
+                    .value("max_speed")
+                    .toFloat();
+            const NeTrainSimLink *link =
+                linkForHop.value(hop(from, edge.first), nullptr);
+            if (!link)
+            {
+                builder.addEdge(from, edge.first, edge.second, speed,
+                                -1, 0.0, 0.0);
+                continue;
+            }
+            const double metres = static_cast<float>(
+                link->lengthUnits().value());
+            const double timeSpeed = std::max(
+                linkForId.value(link->getUserId())
+                    ->maxSpeedUnits()
+                    .value(),
+                0.01);
+            builder.addEdge(from, edge.first, edge.second, speed,
+                            link->getUserId(), metres,
+                            metres / timeSpeed);
+        }
+    }
+}
+
 } // namespace TrainClient
 } // namespace Backend
 } // namespace CargoNetSim
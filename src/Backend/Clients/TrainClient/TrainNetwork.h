@@ -21,8 +21,10 @@
 #include <QTextStream>
 #include <QVariant>
 #include <QVector>
+#include <memory>
 
 #include "Backend/Commons/DirectedGraph.h"
+#include "Backend/Commons/NetworkImage.h"
 #include "Backend/Commons/ShortestPathResult.h"
 #include "Backend/Commons/Units.h"
 #include "Backend/Models/BaseNetwork.h"
@@ -754,9 +756,33 @@ public:
      * @brief Loads a network from node and link files
      * @param nodesFile Path to the nodes data file
      * @param linksFile Path to the links data file
+     * @param image Image of the same files; when given and
+     * consistent, the in-memory graph is not built and
+     * searches run on the image instead
      */
     void loadNetwork(const QString &nodesFile,
-                     const QString &linksFile);
+                     const QString &linksFile,
+                     std::shared_ptr<const NetworkImage> image =
+                         nullptr);
+
+    /**
+     * @brief Serves findShortestPath(s) from @p image and
+     * releases the in-memory graph
+     * @return False (image not attached) when the image does
+     * not match the loaded nodes and links
+     */
+    bool attachImage(std::shared_ptr<const NetworkImage> image);
+
+    /**
+     * @brief Image searches run on, or nullptr
+     */
+    std::shared_ptr<const NetworkImage> image() const;
+
+    /**
+     * @brief Adds nodes, links and the routing graph to
+     * @p builder; call before attachImage()
+     */
+    void writeImage(NetworkImage::Builder &builder) const;
 
     /**
      * @brief Gets all nodes in the network as JSON objects
@@ -822,6 +848,26 @@ public:
         int startNodeId, int endNodeId,
         const QString &optimizeFor = "distance");
 
+    /**
+     * @brief Finds shortest paths from one node to many
+     * targets with a single search
+     *
+     * Each result equals findShortestPath(startNodeId,
+     * target, optimizeFor). The graph search runs outside
+     * the network mutex so sources can be evaluated
+     * concurrently; the network must not be reloaded while
+     * a call is in flight.
+     *
+     * @param startNodeId Starting node ID
+     * @param endNodeIds Target node IDs
+     * @param optimizeFor Optimization criteria ("distance"
+     * or "time")
+     * @return Results keyed by target node ID
+     */
+    QMap<int, ShortestPathResult> findShortestPaths(
+        int startNodeId, const QVector<int> &endNodeIds,
+        const QString &optimizeFor = "distance");
+
     /**
      * @brief Converts all nodes to a JSON object
      * @return JSON object containing all nodes
@@ -894,11 +940,27 @@ private:
      */
     void buildGraph();
 
+    /**
+     * @brief Builds a path result (links, metres, seconds)
+     * from a node sequence; caller holds m_mutex
+     */
+    ShortestPathResult
+    pathResultFor(const QVector<int> &pathNodes,
+                  const QString      &optimizeFor) const;
+
+    /**
+     * @brief Attaches @p image if it matches the loaded
+     * nodes and links; caller holds m_mutex
+     */
+    bool adoptImage(std::shared_ptr<const NetworkImage> image);
+
     QString m_networkName;             ///< Network name
     QVector<NeTrainSimNode *> m_nodes; ///< Node objects
     QVector<NeTrainSimLink *> m_links; ///< Link objects
     DirectedGraph<int>
         *m_graph; ///< Directed graph of network
+    std::shared_ptr<const NetworkImage>
+        m_image; ///< Shared image searches run on, if any
 
     mutable QMutex
         m_mutex; ///< Thread synchronization mutex
@@ -42,6 +42,19 @@ QString previewContainers(const QJsonArray &containers)
             .toJson(QJsonDocument::Compact));
 }
 
+QJsonArray trainsToJson(const QList<Train *> &trains)
+{
+    QJsonArray trainsArray;
+    for (const auto *train : trains)
+    {
+        if (train)
+        {
+            trainsArray.append(train->toJson());
+        }
+    }
+    return trainsArray;
+}
+
 } // namespace
 
 TrainSimulationClient::TrainSimulationClient(
@@ -233,32 +246,47 @@ bool TrainSimulationClient::defineSimulator(
                            networkName, timeStep, trains);
 }
 
+bool TrainSimulationClient::defineSimulator(
+    const NeTrainSimNetwork *network, const double timeStep,
+    const QJsonArray &trainDefinitions)
+{
+    return defineSimulator(network->nodesToJson(),
+                           network->linksToJson(),
+                           network->getNetworkName(), timeStep,
+                           trainDefinitions);
+}
+
 bool TrainSimulationClient::defineSimulator(
     const QJsonObject &nodesJson,
     const QJsonObject &linksJson,
     const QString &networkName, const double timeStep,
     const QList<Train *> &trains)
 {
-    return executeSerializedCommand([&]() {
-        // Prepare train data for JSON
-        QJsonArray trainsArray;
-        for (const auto *train : trains)
-        {
-            if (train)
-            {
-                trainsArray.append(train->toJson());
-            }
-        }
+    if (!defineSimulator(nodesJson, linksJson, networkName,
+                         timeStep, trainsToJson(trains)))
+    {
+        return false;
+    }
+    adoptTrains(trains);
+    return true;
+}
 
+bool TrainSimulationClient::defineSimulator(
+    const QJsonObject &nodesJson,
+    const QJsonObject &linksJson,
+    const QString &networkName, const double timeStep,
+    const QJsonArray &trainDefinitions)
+{
+    return executeSerializedCommand([&]() {
         // Build command parameters
         QJsonObject params;
         params["nodesJson"]   = nodesJson;
         params["linksJson"]   = linksJson;
         params["networkName"] = networkName;
         params["timeStep"]    = timeStep;
-        if (!trains.isEmpty())
+        if (!trainDefinitions.isEmpty())
         {
-            params["trains"] = trainsArray;
+            params["trains"] = trainDefinitions;
         }
 
         // Send command and wait for response
@@ -266,19 +294,8 @@ bool TrainSimulationClient::defineSimulator(
             sendCommandAndWait("defineSimulator", params,
                                {"simulationCreated"});
 
-        // If successful, store train objects
         if (success)
         {
-            Commons::ScopedWriteLock locker(
-                m_dataAccessMutex);
-            for (const auto *train : trains)
-            {
-                if (train)
-                {
-                    m_loadedTrains[train->getUserId()] =
-                        const_cast<Train *>(train);
-                }
-            }
             if (m_logger)
             {
                 m_logger->log(
@@ -465,40 +482,31 @@ bool TrainSimulationClient::addTrainsToSimulator(
     const QString        &networkName,
     const QList<Train *> &trains)
 {
-    return executeSerializedCommand([&]() {
-        // Prepare train data for JSON
-        QJsonArray trainsArray;
-        for (const auto *train : trains)
-        {
-            if (train)
-            {
-                trainsArray.append(train->toJson());
-            }
-        }
+    if (!addTrainsToSimulator(networkName, trainsToJson(trains)))
+    {
+        return false;
+    }
+    adoptTrains(trains);
+    return true;
+}
 
+bool TrainSimulationClient::addTrainsToSimulator(
+    const QString    &networkName,
+    const QJsonArray &trainDefinitions)
+{
+    return executeSerializedCommand([&]() {
         // Build command parameters
         QJsonObject params;
         params["network"] = networkName;
-        params["trains"]  = trainsArray;
+        params["trains"]  = trainDefinitions;
 
         // Send command and wait for response
         bool success = sendCommandAndWait(
             "addTrainsToSimulator", params,
             {"trainAddedToSimulator"});
 
-        // If successful, store train objects
         if (success)
         {
-            Commons::ScopedWriteLock locker(
-                m_dataAccessMutex);
-            for (const auto *train : trains)
-            {
-                if (train)
-                {
-                    m_loadedTrains[train->getUserId()] =
-                        const_cast<Train *>(train);
-                }
-            }
             if (m_logger)
             {
                 m_logger->log(
@@ -517,6 +525,19 @@ bool TrainSimulationClient::addTrainsToSimulator(
     });
 }
 
+void TrainSimulationClient::adoptTrains(
+    const QList<Train *> &trains)
+{
+    Commons::ScopedWriteLock locker(m_dataAccessMutex);
+    for (auto *train : trains)
+    {
+        if (train)
+        {
+            m_loadedTrains[train->getUserId()] = train;
+        }
+    }
+}
+
 bool TrainSimulationClient::addContainersToTrain(
     const QString &networkName, const QString &trainId,
     const QList<ContainerCore::Container *> &containers)
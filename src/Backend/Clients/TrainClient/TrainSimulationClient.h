@@ -166,6 +166,40 @@ public:
                          const double       timeStep  = 1.0,
                          const QList<Train *> &trains = {});
 
+    /**
+     * @brief Defines a simulator from serialized trains
+     *
+     * Same as the Train overload, but takes the trains as
+     * Train::toJson() objects so callers can send shared
+     * vehicle templates without building Train copies. The
+     * client takes no ownership of anything.
+     *
+     * @param network Network to simulate
+     * @param timeStep Simulation time increment
+     * @param trainDefinitions Train::toJson() objects
+     * @return True if simulator definition succeeds
+     */
+    bool defineSimulator(const NeTrainSimNetwork *network,
+                         const double             timeStep,
+                         const QJsonArray &trainDefinitions);
+
+    /**
+     * @brief Defines a simulator with custom topology from
+     * serialized trains
+     *
+     * @param nodesJson JSON object of network nodes
+     * @param linksJson JSON object of network links
+     * @param networkName Unique identifier for the network
+     * @param timeStep Simulation time increment
+     * @param trainDefinitions Train::toJson() objects
+     * @return True if simulator definition succeeds
+     */
+    bool defineSimulator(const QJsonObject &nodesJson,
+                         const QJsonObject &linksJson,
+                         const QString     &networkName,
+                         const double       timeStep,
+                         const QJsonArray  &trainDefinitions);
+
     /**
      * @brief Runs the simulator for a bounded interactive chunk
      *
@@ -236,6 +270,16 @@ public:
     bool addTrainsToSimulator(const QString &networkName,
                               const QList<Train *> &trains);
 
+    /**
+     * @brief Adds serialized trains to an existing simulator
+     *
+     * @param networkName Target network identifier
+     * @param trainDefinitions Train::toJson() objects
+     * @return True if trains are added successfully
+     */
+    bool addTrainsToSimulator(const QString    &networkName,
+                              const QJsonArray &trainDefinitions);
+
     /**
      * @brief Adds containers to a specified train
      *
@@ -346,6 +390,13 @@ signals:
 private:
     SimulatorHealthProbeTransport *m_healthProbeTransport =
         nullptr;
+
+    /**
+     * @brief Takes ownership of trains the simulator accepted
+     * @param trains Trains from a successful define or add
+     */
+    void adoptTrains(const QList<Train *> &trains);
+
     /**
      * @brief Internal method to unload containers from a
      * train
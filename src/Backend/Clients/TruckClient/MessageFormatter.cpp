@@ -172,6 +172,48 @@ QString MessageFormatter::formatAddTrip(
                          MessageCode::ADD_TRIP, content);
 }
 
+QString MessageFormatter::formatAddTrips(
+    int msgId, const QList<TripSpec> &trips)
+{
+    if (trips.size() == 1)
+    {
+        const TripSpec &trip = trips.first();
+        return formatAddTrip(msgId, trip.tripId, trip.originId,
+                             trip.destinationId, trip.startTime,
+                             trip.linkIds);
+    }
+
+    qCDebug(lcClientTruck)
+        << "MessageFormatter::formatAddTrips:"
+        << "msgId=" << msgId
+        << "tripCount=" << trips.size();
+
+    QString content = QString::number(trips.size());
+    for (const TripSpec &trip : trips)
+    {
+        if (trip.linkIds.isEmpty())
+        {
+            qCWarning(lcClientTruck)
+                << "MessageFormatter::formatAddTrips:"
+                << "empty linkIds for tripId=" << trip.tripId;
+        }
+        content += QString("/%1/%2/%3/%4/%5")
+                       .arg(trip.tripId)
+                       .arg(trip.originId)
+                       .arg(trip.destinationId)
+                       .arg(static_cast<int>(trip.startTime))
+                       .arg(trip.linkIds.size());
+        for (int linkId : trip.linkIds)
+        {
+            content += QString("/%1").arg(linkId);
+        }
+    }
+
+    return formatMessage(msgId, false,
+                         MessageType::TRIP_CTRL,
+                         MessageCode::ADD_TRIPS, content);
+}
+
 QJsonObject
 MessageFormatter::parseMessage(const QString &message)
 {
@@ -56,6 +56,7 @@ public:
         // Trip control codes
         ADD_TRIP    = 0, ///< Add a new trip
         CANCEL_TRIP = 1, ///< Cancel an existing trip
+        ADD_TRIPS   = 2, ///< Add several trips at once
 
         // Trip info codes
         TRIP_INFO = 0, ///< Trip information update
@@ -124,6 +125,33 @@ public:
                                  double startTime,
                                  const QList<int> &linkIds);
 
+    /**
+     * @struct TripSpec
+     * @brief One trip of a multi-trip add message
+     */
+    struct TripSpec
+    {
+        int        tripId        = 0;
+        int        originId      = 0;
+        int        destinationId = 0;
+        double     startTime     = 0.0;
+        QList<int> linkIds;
+    };
+
+    /**
+     * @brief Formats one message that adds several trips
+     *
+     * The content is the trip count followed by each trip
+     * laid out as in formatAddTrip():
+     * count/tripId/origin/dest/start/linkCount/links.../...
+     * A single trip is formatted as a plain ADD_TRIP.
+     * @param msgId Message identifier
+     * @param trips Trips to add, in order
+     * @return Formatted message string
+     */
+    static QString formatAddTrips(int                    msgId,
+                                  const QList<TripSpec> &trips);
+
     /**
      * @brief Parses a message string into components
      * @param message The message to parse
@@ -8,6 +8,7 @@
 #include "TruckNetwork.h"
 #include <QDir>
 #include <QFile>
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QRegularExpression>
@@ -31,11 +32,19 @@ class IntegrationLink;
 
 IntegrationNetwork::IntegrationNetwork(QObject *parent)
     : BaseNetwork(parent)
+    , m_handle(std::make_shared<IntegrationNetworkHandle>())
 {
+    m_handle->network = this;
 }
 
 IntegrationNetwork::~IntegrationNetwork()
 {
+    {
+        // Wait for searches running through handle()
+        QWriteLocker locker(&m_handle->lock);
+        m_handle->network = nullptr;
+    }
+
     // Clean up resources
     qDeleteAll(m_nodeObjects);
     qDeleteAll(m_linkObjects);
@@ -70,6 +79,7 @@ void IntegrationNetwork::initializeNetwork(
         m_graph = nullptr;
     }
     m_graph = new TransportationGraph<int>(); // Reset graph
+    m_image.reset();
 
     // Store nodes and links
     m_nodeObjects = nodes;
@@ -133,25 +143,149 @@ IntegrationNetwork::findShortestPath(int startNodeId,
     qCDebug(lcClientTruck) << "IntegrationNetwork::findShortestPath:"
                            << "from=" << startNodeId
                            << "to=" << endNodeId;
-    QMutexLocker       locker(&m_mutex);
-    ShortestPathResult result;
+    QMutexLocker locker(&m_mutex);
 
-    result.optimizationCriterion =
-        "distance"; // Default optimization criterion
+    if (m_image)
+        return m_image->findShortestPath(
+            startNodeId, endNodeId, NetworkImage::Metric::Distance);
 
     // Find path using transportation graph
-    result.pathNodes = m_graph->findShortestPath(
+    const QVector<int> pathNodes = m_graph->findShortestPath(
         startNodeId, endNodeId, "distance");
 
     // If no path found, return empty result (already
     // initialized with infinity values)
-    if (result.pathNodes.isEmpty())
+    if (pathNodes.isEmpty())
     {
         qCWarning(lcClientTruck) << "IntegrationNetwork::findShortestPath:"
                                  << "no path found from" << startNodeId
                                  << "to" << endNodeId;
-        return result;
     }
+    return pathResultFor(pathNodes);
+}
+
+QMap<int, ShortestPathResult>
+IntegrationNetwork::findShortestPaths(int                 startNodeId,
+                                      const QVector<int> &endNodeIds)
+{
+    qCDebug(lcClientTruck) << "IntegrationNetwork::findShortestPaths:"
+                           << "from=" << startNodeId
+                           << "targets=" << endNodeIds.size();
+    const TransportationGraph<int>     *graph = nullptr;
+    std::shared_ptr<const NetworkImage> image;
+    {
+        QMutexLocker locker(&m_mutex);
+        graph = m_graph;
+        image = m_image;
+    }
+    if (image)
+        return image->findShortestPaths(startNodeId, endNodeIds,
+                                        NetworkImage::Metric::Distance);
+
+    const QMap<int, QVector<int>> paths =
+        graph->findShortestPaths(startNodeId, endNodeIds, "distance");
+
+    QMutexLocker                  locker(&m_mutex);
+    QMap<int, ShortestPathResult> results;
+    for (auto it = paths.constBegin(); it != paths.constEnd(); ++it)
+        results.insert(it.key(), pathResultFor(it.value()));
+    return results;
+}
+
+bool IntegrationNetwork::attachImage(
+    std::shared_ptr<const NetworkImage> image)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!image)
+        return false;
+    if (image->nodeCount() != m_nodeObjects.size()
+        || image->linkCount() != m_linkObjects.size())
+    {
+        qCWarning(lcClientTruck)
+            << "IntegrationNetwork::attachImage:" << image->filePath()
+            << "has" << image->nodeCount() << "nodes /"
+            << image->linkCount() << "links, network has"
+            << m_nodeObjects.size() << "/" << m_linkObjects.size();
+        return false;
+    }
+    m_image = std::move(image);
+    return true;
+}
+
+std::shared_ptr<const NetworkImage> IntegrationNetwork::image() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_image;
+}
+
+void IntegrationNetwork::writeImage(NetworkImage::Builder &builder) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    // Native units: kilometres and hours.
+    builder.setUnitScales(
+        Units::toMeters(Units::kilometers(1.0)).value(),
+        Units::toSeconds(Units::hours(1.0)).value());
+
+    QVector<double> nodeType;
+    for (const IntegrationNode *node : m_nodeObjects)
+    {
+        builder.addNode(node->getNodeId(), node->getXCoordinate(),
+                        node->getYCoordinate());
+        nodeType.append(node->getNodeType());
+    }
+    builder.addAttribute(NetworkImage::Scope::Node,
+                         QStringLiteral("type"), nodeType);
+
+    // Paths report the edge's link_id, the length of the first
+    // link with that id (getPathLengthByLinks) and the graph's
+    // own per-edge time metric (pathResultFor).
+    QHash<int, const IntegrationLink *> linkForId;
+    QVector<double>                     lanes;
+    for (const IntegrationLink *link : m_linkObjects)
+    {
+        builder.addLink(link->getLinkId(), link->getUpstreamNodeId(),
+                        link->getDownstreamNodeId(),
+                        link->lengthUnits().value(),
+                        link->freeSpeedUnits().value());
+        lanes.append(link->getLanes());
+        if (!linkForId.contains(link->getLinkId()))
+            linkForId.insert(link->getLinkId(), link);
+    }
+    builder.addAttribute(NetworkImage::Scope::Link,
+                         QStringLiteral("lanes"), lanes);
+
+    for (int from : m_graph->getNodes())
+    {
+        for (const QPair<int, float> &edge :
+             m_graph->getOutgoingEdges(from))
+        {
+            const QMap<QString, QVariant> attributes =
+                m_graph->getEdgeAttributes(from, edge.first);
+            const int linkId =
+                attributes.contains("link_id")
+                    ? attributes.value("link_id").toInt()
+                    : -1;
+            const IntegrationLink *link = linkForId.value(linkId);
+            builder.addEdge(
+                from, edge.first, edge.second,
+                attributes.value("free_speed").toFloat(), linkId,
+                link ? link->lengthUnits().value() : 0.0,
+                m_graph->calculatePathMetric({from, edge.first},
+                                             "time"));
+        }
+    }
+}
+
+ShortestPathResult
+IntegrationNetwork::pathResultFor(const QVector<int> &pathNodes) const
+{
+    ShortestPathResult result;
+    result.optimizationCriterion =
+        "distance"; // Default optimization criterion
+    result.pathNodes = pathNodes;
+    if (result.pathNodes.isEmpty())
+        return result;
 
     // Get corresponding links
     result.pathLinks = getPathLinks(result.pathNodes);
@@ -15,12 +15,16 @@
 #include "MessageFormatter.h"
 #include "TransportationGraph.h"
 #include <QJsonObject>
+#include <QMap>
 #include <QMutex>
 #include <QObject>
+#include <QReadWriteLock>
 #include <QSharedPointer>
 #include <QString>
 #include <QVector>
+#include <memory>
 
+#include "Backend/Commons/NetworkImage.h"
 #include "Backend/Commons/ShortestPathResult.h"
 #include "Backend/Models/BaseObject.h"
 
@@ -31,6 +35,24 @@ namespace Backend
 namespace TruckClient
 {
 
+class IntegrationNetwork;
+
+/**
+ * @struct IntegrationNetworkHandle
+ * @brief Lets other threads search a network without
+ * racing its destruction
+ *
+ * Holders take the read lock for the whole search and use
+ * network only while it is non-null. The network's
+ * destructor takes the write lock and clears it, so it
+ * waits for searches already running.
+ */
+struct IntegrationNetworkHandle
+{
+    QReadWriteLock      lock;
+    IntegrationNetwork *network = nullptr;
+};
+
 /**
  * @class SharedIntegrationNetwork
  * @brief Represents a shared truck network model
@@ -80,6 +102,51 @@ public:
     ShortestPathResult findShortestPath(int startNodeId,
                                         int endNodeId);
 
+    /**
+     * @brief Find shortest paths from one node to many
+     * targets with a single search
+     *
+     * Each result equals findShortestPath(startNodeId,
+     * target). The graph search runs outside the network
+     * mutex so sources can be evaluated concurrently; the
+     * network must not be re-initialized meanwhile.
+     * @param startNodeId Starting node ID
+     * @param endNodeIds Target node IDs
+     * @return Results keyed by target node ID
+     */
+    QMap<int, ShortestPathResult>
+    findShortestPaths(int startNodeId,
+                      const QVector<int> &endNodeIds);
+
+    /**
+     * @brief Serve findShortestPath(s) from @p image
+     *
+     * The transportation graph stays in place for the other
+     * queries (start/end nodes, k-shortest paths).
+     * @return False (image not attached) when the image does
+     * not match the loaded nodes and links
+     */
+    bool attachImage(std::shared_ptr<const NetworkImage> image);
+
+    /**
+     * @brief Image searches run on, or nullptr
+     */
+    std::shared_ptr<const NetworkImage> image() const;
+
+    /**
+     * @brief Handle searches from other threads go through
+     */
+    std::shared_ptr<IntegrationNetworkHandle> handle() const
+    {
+        return m_handle;
+    }
+
+    /**
+     * @brief Add nodes, links and the routing graph to
+     * @p builder
+     */
+    void writeImage(NetworkImage::Builder &builder) const;
+
     /**
      * @brief Get terminal nodes (those with no outgoing
      * edges)
@@ -190,6 +257,10 @@ private:
     QString m_networkName;
     // Transportation graph for path-finding
     TransportationGraph<int> *m_graph = nullptr;
+    // Shared image shortest-path searches run on, if any
+    std::shared_ptr<const NetworkImage> m_image;
+    // Outlives the network; cleared by the destructor
+    std::shared_ptr<IntegrationNetworkHandle> m_handle;
 
     // Node objects owned by this network
     QVector<IntegrationNode *> m_nodeObjects;
@@ -215,6 +286,15 @@ private:
      */
     double
     getPathLengthByLinks(const QVector<int> &linkIds) const;
+
+    /**
+     * @brief Build a path result (links, metres, seconds)
+     * from a node sequence; caller holds m_mutex
+     * @param pathNodes Vector of node IDs in the path
+     * @return ShortestPathResult for the path
+     */
+    ShortestPathResult
+    pathResultFor(const QVector<int> &pathNodes) const;
 };
 
 /**
@@ -6,6 +6,7 @@
  */
 
 #include "TruckSimulationClient.h"
+#include "Backend/Clients/TruckClient/TruckNetwork.h"
 #include "Backend/Commons/LogCategories.h"
 #include "Backend/Commons/LoggerInterface.h"
 #include <QDir>
@@ -49,6 +50,16 @@ TruckSimulationClient::~TruckSimulationClient()
         << "destroying, processes=" << m_processes.size();
     Commons::ScopedWriteLock locker(m_dataMutex);
 
+    // Hand pooled processes back; the pool decides whether
+    // they can serve another client
+    if (m_simulatorPool)
+    {
+        for (const QString &name : m_processes.keys())
+        {
+            releaseProcessLocked(name, /*replenish=*/false);
+        }
+    }
+
     // Terminate and clean up all processes
     for (auto *process : m_processes.values())
     {
@@ -129,6 +140,36 @@ bool TruckSimulationClient::defineSimulator(
         << "masterFile=" << masterFilePath
         << "simTime=" << simTime;
 
+    const QStringList args = simulatorArguments(
+        masterFilePath, simTime, configUpdates, argsUpdates,
+        routingNamespace());
+
+    // Launch the simulator
+    bool success = launchSimulator(
+        networkName, masterFilePath, simTime, args);
+
+    if (success)
+    {
+        Commons::ScopedWriteLock locker(m_dataMutex);
+        m_totalSimTimes[networkName] = simTime;
+    }
+    else
+    {
+        qCWarning(lcClientTruck)
+            << "TruckSimulationClient::defineSimulator:"
+            << "failed to launch simulator for"
+            << networkName;
+    }
+
+    return success;
+}
+
+QStringList TruckSimulationClient::simulatorArguments(
+    const QString &masterFilePath, double simTime,
+    const QMap<QString, QVariant> &configUpdates,
+    const QStringList             &argsUpdates,
+    const QString                 &routingNamespace)
+{
     // Prepare standard command-line arguments
     QStringList args = {
         "--mode",     "controlled",
@@ -151,24 +192,34 @@ bool TruckSimulationClient::defineSimulator(
              << port;
     }
 
-    // Launch the simulator
-    bool success = launchSimulator(
-        networkName, masterFilePath, simTime, args);
+    // Namespaced runtime contexts: the simulator must use the same
+    // queue and routing-key suffix as this client.
+    if (!routingNamespace.isEmpty())
+        args << "--amq_namespace" << routingNamespace;
 
-    if (success)
-    {
-        Commons::ScopedWriteLock locker(m_dataMutex);
-        m_totalSimTimes[networkName] = simTime;
-    }
-    else
-    {
-        qCWarning(lcClientTruck)
-            << "TruckSimulationClient::defineSimulator:"
-            << "failed to launch simulator for"
-            << networkName;
-    }
+    return args;
+}
 
-    return success;
+void TruckSimulationClient::setSimulatorPool(
+    TruckSimulatorPool *pool)
+{
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    m_simulatorPool = pool;
+}
+
+void TruckSimulationClient::setBatchTripsEnabled(bool enabled)
+{
+    qCDebug(lcClientTruck)
+        << "TruckSimulationClient::setBatchTripsEnabled:"
+        << "enabled=" << enabled;
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    m_batchTrips = enabled;
+}
+
+bool TruckSimulationClient::batchTripsEnabled() const
+{
+    Commons::ScopedReadLock locker(m_dataMutex);
+    return m_batchTrips;
 }
 
 bool TruckSimulationClient::runSimulator(
@@ -178,8 +229,8 @@ bool TruckSimulationClient::runSimulator(
         << "TruckSimulationClient::runSimulator:"
         << "networks=" << networkNames;
 
-    Commons::ScopedReadLock locker(m_dataMutex);
-    bool                    allSucceeded = true;
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    bool                     allSucceeded = true;
 
     for (const QString &name : networkNames)
     {
@@ -187,10 +238,11 @@ bool TruckSimulationClient::runSimulator(
             && m_simulationTimes[name]
                    < m_simulationHorizons[name])
         {
+            m_usedNetworks.insert(name);
 
             // Format sync message using the new formatter
             QString msg = MessageFormatter::formatSyncGo(
-                m_lastRequestId, m_simulationTimes[name],
+                syncRequestIdLocked(name), m_simulationTimes[name],
                 m_simulationHorizons[name]);
 
             // Send command
@@ -206,6 +258,10 @@ bool TruckSimulationClient::runSimulator(
                     << name;
                 allSucceeded = false;
             }
+            else
+            {
+                m_awaitingSync.remove(name);
+            }
         }
     }
 
@@ -221,6 +277,14 @@ bool TruckSimulationClient::advanceByTimeStep(
         << "networks=" << networkNames
         << "deltaT=" << deltaT;
 
+    {
+        Commons::ScopedWriteLock locker(m_dataMutex);
+        for (const QString &name : networkNames)
+        {
+            m_usedNetworks.insert(name);
+        }
+    }
+
     return executeSerializedCommand([&]() {
         QJsonObject params;
 
@@ -268,11 +332,17 @@ bool TruckSimulationClient::endSimulator(
 
     for (const QString &name : networkNames)
     {
-        if (m_processes.contains(name))
+        if (m_processes.contains(name) && m_simulatorPool
+            && !m_usedNetworks.contains(name))
+        {
+            // Untouched: keep it waiting for the next client
+            releaseProcessLocked(name);
+        }
+        else if (m_processes.contains(name))
         {
             // Format end message using the new formatter
             QString msg = MessageFormatter::formatSyncEnd(
-                m_lastRequestId, m_simulationTimes[name]);
+                syncRequestIdLocked(name), m_simulationTimes[name]);
 
             // Send command
             bool sent =
@@ -289,7 +359,14 @@ bool TruckSimulationClient::endSimulator(
             }
 
             // Terminate process
-            m_processes[name]->terminate();
+            if (m_simulatorPool)
+            {
+                releaseProcessLocked(name);
+            }
+            else
+            {
+                m_processes[name]->terminate();
+            }
         }
     }
 
@@ -313,22 +390,18 @@ QString TruckSimulationClient::addTrip(
     QString tripIdStr = QString::number(tripId);
 
     // Find route links
-    QList<int> linkIds;
-    if (m_networkGraph)
-    {
-        QVector<QString> nodes =
-            m_networkGraph->findShortestPath(originId,
-                                             destinationId);
-
-        linkIds =
-            m_networkGraph->convertNodePathToLinkPath(nodes)
-                .toList();
-    }
-    else
+    const int        origin      = originId.toInt();
+    const int        destination = destinationId.toInt();
+    const QList<int> linkIds =
+        resolveRoutes(networkName, {{origin, destination}})
+            .value(routeKey(origin, destination));
+    if (linkIds.isEmpty())
     {
-        // Fallback to default link IDs if no graph is
-        // available
-        linkIds = {1, 2, 3};
+        qCWarning(lcClientTruck)
+            << "TruckSimulationClient::addTrip:"
+            << "no route from" << origin << "to" << destination
+            << "on network" << networkName;
+        return QString();
     }
 
     // Get current simulation time as start time
@@ -337,8 +410,8 @@ QString TruckSimulationClient::addTrip(
 
     // Create add trip message
     QString msg = MessageFormatter::formatAddTrip(
-        m_sentMsgCounter++, tripId, originId.toInt(),
-        destinationId.toInt(), startTime, linkIds);
+        m_sentMsgCounter++, tripId, origin, destination,
+        startTime, linkIds);
 
     // Send the command
     bool sent = sendCommand(msg.toUtf8(), QJsonObject(),
@@ -354,6 +427,7 @@ QString TruckSimulationClient::addTrip(
     }
 
     Commons::ScopedWriteLock locker(m_dataMutex);
+    m_usedNetworks.insert(networkName);
 
     // Create new truck state
     auto *state = new TruckState(
@@ -372,6 +446,260 @@ QString TruckSimulationClient::addTrip(
     return tripIdStr;
 }
 
+QStringList TruckSimulationClient::addTrips(
+    const QString &networkName, const QList<TripRequest> &trips)
+{
+    qCDebug(lcClientTruck)
+        << "TruckSimulationClient::addTrips:"
+        << "network=" << networkName
+        << "trips=" << trips.size();
+
+    if (trips.isEmpty())
+    {
+        return QStringList();
+    }
+
+    QList<QPair<int, int>> pairs;
+    pairs.reserve(trips.size());
+    for (const TripRequest &trip : trips)
+    {
+        pairs.append({trip.originId, trip.destinationId});
+    }
+    const QHash<quint64, QList<int>> routes =
+        resolveRoutes(networkName, pairs);
+
+    // Get current simulation time as start time
+    const double startTime =
+        m_simulationHorizons.value(networkName, 0.0);
+
+    // The simulator cannot run a trip without links
+    for (const TripRequest &trip : trips)
+    {
+        if (!routes.contains(
+                routeKey(trip.originId, trip.destinationId)))
+        {
+            qCWarning(lcClientTruck)
+                << "TruckSimulationClient::addTrips:"
+                << "no route from" << trip.originId << "to"
+                << trip.destinationId << "on network"
+                << networkName << "; no trips sent";
+            return QStringList();
+        }
+    }
+
+    QList<MessageFormatter::TripSpec> specs;
+    specs.reserve(trips.size());
+    for (const TripRequest &trip : trips)
+    {
+        MessageFormatter::TripSpec spec;
+        spec.tripId        = m_tripIdCounter++;
+        spec.originId      = trip.originId;
+        spec.destinationId = trip.destinationId;
+        spec.startTime     = startTime;
+        spec.linkIds       = routes.value(
+            routeKey(trip.originId, trip.destinationId));
+        specs.append(spec);
+    }
+
+    // Trips the simulator has received, in request order
+    const bool batch     = batchTripsEnabled();
+    qsizetype  sentCount = 0;
+    if (batch)
+    {
+        QString msg = MessageFormatter::formatAddTrips(
+            m_sentMsgCounter++, specs);
+        if (sendCommand(msg.toUtf8(), QJsonObject(),
+                        m_sendingRoutingKey))
+        {
+            sentCount = specs.size();
+        }
+    }
+    else
+    {
+        for (const MessageFormatter::TripSpec &spec : specs)
+        {
+            QString msg = MessageFormatter::formatAddTrip(
+                m_sentMsgCounter++, spec.tripId, spec.originId,
+                spec.destinationId, spec.startTime, spec.linkIds);
+            if (!sendCommand(msg.toUtf8(), QJsonObject(),
+                             m_sendingRoutingKey))
+            {
+                break;
+            }
+            ++sentCount;
+        }
+    }
+
+    if (sentCount < specs.size())
+    {
+        qCWarning(lcClientTruck)
+            << "TruckSimulationClient::addTrips:"
+            << "failed to send add trip command(s), sent="
+            << sentCount << "of" << specs.size()
+            << "batch=" << batch;
+        if (sentCount == 0)
+        {
+            return QStringList();
+        }
+    }
+
+    QStringList tripIds;
+    tripIds.reserve(trips.size());
+
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    m_usedNetworks.insert(networkName);
+    for (qsizetype i = 0; i < sentCount; ++i)
+    {
+        const MessageFormatter::TripSpec &spec = specs.at(i);
+        const QString tripIdStr = QString::number(spec.tripId);
+
+        auto *state = new TruckState(
+            networkName, spec.tripId,
+            QString::number(spec.originId),
+            QString::number(spec.destinationId), this);
+        m_truckStates[networkName].append(state);
+
+        if (!trips.at(i).containers.isEmpty())
+        {
+            m_containerManager->assignContainersToVehicle(
+                QString("Truck_%1").arg(tripIdStr),
+                trips.at(i).containers);
+        }
+        tripIds.append(tripIdStr);
+    }
+
+    if (sentCount < specs.size())
+    {
+        return QStringList();
+    }
+    return tripIds;
+}
+
+QHash<quint64, QList<int>> TruckSimulationClient::resolveRoutes(
+    const QString &networkName, const QList<QPair<int, int>> &pairs)
+{
+    QHash<quint64, QList<int>>                routes;
+    QMap<int, QVector<int>>                   missing; // origin -> destinations
+    std::shared_ptr<IntegrationNetworkHandle> handle;
+    quint64                                   generation = 0;
+    {
+        QMutexLocker locker(&m_routeMutex);
+        const RoutingNetwork routing =
+            m_routingNetworks.value(networkName);
+        handle     = routing.handle;
+        generation = routing.generation;
+        const QHash<quint64, QList<int>> &cache = routing.routes;
+        for (const auto &[origin, destination] : pairs)
+        {
+            const quint64 key = routeKey(origin, destination);
+            if (routes.contains(key))
+            {
+                continue;
+            }
+            auto hit = cache.constFind(key);
+            if (hit != cache.constEnd())
+            {
+                routes.insert(key, hit.value());
+            }
+            else if (!missing[origin].contains(destination))
+            {
+                missing[origin].append(destination);
+            }
+        }
+    }
+
+    if (missing.isEmpty())
+    {
+        return routes;
+    }
+
+    // Held for every search so the network outlives them
+    QReadLocker handleLocker(handle ? &handle->lock : nullptr);
+    IntegrationNetwork *network = handle ? handle->network : nullptr;
+
+    QHash<quint64, QList<int>> resolved;
+    int                        unreachable = 0;
+    for (auto it = missing.constBegin(); it != missing.constEnd();
+         ++it)
+    {
+        if (network)
+        {
+            // One search serves every destination of this origin
+            const QMap<int, ShortestPathResult> results =
+                network->findShortestPaths(it.key(), it.value());
+            for (int destination : it.value())
+            {
+                const QList<int> links =
+                    results.value(destination).pathLinks;
+                if (links.isEmpty())
+                {
+                    ++unreachable;
+                    continue;
+                }
+                resolved.insert(routeKey(it.key(), destination),
+                                links);
+            }
+        }
+        else if (m_networkGraph)
+        {
+            for (int destination : it.value())
+            {
+                QVector<QString> nodes =
+                    m_networkGraph->findShortestPath(
+                        QString::number(it.key()),
+                        QString::number(destination));
+                const QList<int> links =
+                    m_networkGraph->convertNodePathToLinkPath(nodes)
+                        .toList();
+                if (links.isEmpty())
+                {
+                    ++unreachable;
+                    continue;
+                }
+                routes.insert(routeKey(it.key(), destination), links);
+            }
+        }
+        else
+        {
+            // Fallback to default link IDs if no graph is
+            // available
+            for (int destination : it.value())
+            {
+                routes.insert(routeKey(it.key(), destination),
+                              {1, 2, 3});
+            }
+        }
+    }
+
+    qCDebug(lcClientTruck)
+        << "TruckSimulationClient::resolveRoutes:"
+        << "network=" << networkName
+        << "cached=" << routes.size()
+        << "searched=" << resolved.size()
+        << "unreachable=" << unreachable
+        << "origins=" << missing.size();
+    handleLocker.unlock();
+
+    if (!resolved.isEmpty())
+    {
+        QMutexLocker locker(&m_routeMutex);
+        // Only memoize against the network that produced them
+        auto routing = m_routingNetworks.find(networkName);
+        if (routing != m_routingNetworks.end()
+            && routing->generation == generation && network)
+        {
+            for (auto r = resolved.constBegin(); r != resolved.constEnd();
+                 ++r)
+            {
+                routing->routes.insert(r.key(), r.value());
+            }
+        }
+        routes.insert(resolved);
+    }
+
+    return routes;
+}
+
 QFuture<TripResult> TruckSimulationClient::addTripAsync(
     const QString &networkName, const QString &originId,
     const QString                           &destinationId,
@@ -467,6 +795,34 @@ double TruckSimulationClient::getProgressPercentage(
     return pct;
 }
 
+bool TruckSimulationClient::isAwaitingSync(
+    const QString &networkName) const
+{
+    Commons::ScopedReadLock locker(m_dataMutex);
+    return m_awaitingSync.contains(networkName);
+}
+
+void TruckSimulationClient::setLockstep(
+    const QStringList &networkNames, bool enabled)
+{
+    qCDebug(lcClientTruck)
+        << "TruckSimulationClient::setLockstep:"
+        << "networks=" << networkNames
+        << "enabled=" << enabled;
+    Commons::ScopedWriteLock locker(m_dataMutex);
+    for (const QString &name : networkNames)
+    {
+        if (enabled)
+        {
+            m_lockstepNetworks.insert(name);
+        }
+        else
+        {
+            m_lockstepNetworks.remove(name);
+        }
+    }
+}
+
 double TruckSimulationClient::getSimulationTime(
     const QString &networkName) const
 {
@@ -487,6 +843,51 @@ void TruckSimulationClient::setNetworkGraph(
     m_networkGraph = graph;
 }
 
+void TruckSimulationClient::setRoutingNetwork(
+    const QString &networkName, IntegrationNetwork *network)
+{
+    qCDebug(lcClientTruck)
+        << "TruckSimulationClient::setRoutingNetwork:"
+        << "network=" << networkName
+        << "graph=" << (network ? "valid" : "null");
+    QMutexLocker locker(&m_routeMutex);
+    auto current = m_routingNetworks.find(networkName);
+    if (current != m_routingNetworks.end() && current->network
+        && current->network == network)
+    {
+        return; // keep the memoized routes
+    }
+    if (current != m_routingNetworks.end())
+    {
+        disconnect(current->destroyedConnection);
+        m_routingNetworks.erase(current);
+    }
+    if (!network)
+    {
+        return;
+    }
+
+    RoutingNetwork routing;
+    routing.network    = network;
+    routing.handle     = network->handle();
+    routing.generation = ++m_routingGeneration;
+    // Direct: the network may be destroyed on any thread
+    routing.destroyedConnection = connect(
+        network, &QObject::destroyed, this,
+        [this, networkName,
+         generation = routing.generation]() {
+            QMutexLocker locker(&m_routeMutex);
+            auto it = m_routingNetworks.find(networkName);
+            if (it != m_routingNetworks.end()
+                && it->generation == generation)
+            {
+                m_routingNetworks.erase(it);
+            }
+        },
+        Qt::DirectConnection);
+    m_routingNetworks.insert(networkName, routing);
+}
+
 void TruckSimulationClient::registerTripEndCallback(
     const QString                           &callbackId,
     std::function<void(const TripEndData &)> callback)
@@ -566,18 +967,35 @@ void TruckSimulationClient::processMessage(
     {
         qCDebug(lcClientTruck) << "TruckSimulationClient::processMessage:"
                                << "sync_req for network=" << networkName;
+        const double simTime = parts[8].toDouble();
+        const double horizon = parts[9].toDouble();
+        bool         held    = false;
+
         // First, update data with the lock held
         {
             Commons::ScopedWriteLock locker(m_dataMutex);
-            m_simulationTimes[networkName] =
-                parts[8].toDouble();
-            m_simulationHorizons[networkName] =
-                parts[9].toDouble();
+            m_simulationTimes[networkName]    = simTime;
+            m_simulationHorizons[networkName] = horizon;
             m_lastRequestId = parts[0].toInt();
+            m_awaitingSync.insert(networkName);
+            if (QProcess *process = m_processes.value(networkName))
+            {
+                TruckSimulatorPool::SyncPoint &syncPoint =
+                    m_processSyncPoints[process];
+                syncPoint.valid     = true;
+                syncPoint.simTime   = simTime;
+                syncPoint.horizon   = horizon;
+                syncPoint.requestId = m_lastRequestId;
+            }
+            held = m_lockstepNetworks.contains(networkName);
         }
 
         // Then, run simulator without holding the lock
-        runSimulator({networkName});
+        if (!held)
+        {
+            runSimulator({networkName});
+        }
+        emit syncReached(networkName, simTime, horizon);
         return;
     }
 
@@ -686,30 +1104,52 @@ bool TruckSimulationClient::launchSimulator(
         << "masterFile=" << masterFilePath
         << "simTime=" << simTime;
 
-    // Get directory and file information
-    QDir    dir(QFileInfo(masterFilePath).absolutePath());
-    QString newExePath =
-        dir.filePath(QFileInfo(m_exePath).fileName());
-
-    // Copy executable to working directory if needed
-    if (!QFile::exists(newExePath))
+    if (m_simulatorPool)
     {
-        if (!QFile::copy(m_exePath, newExePath))
+        TruckSimulatorPool::SyncPoint syncPoint;
+        QString                       error;
+        QProcess *process = m_simulatorPool->acquire(
+            m_exePath, masterFilePath, args, &syncPoint,
+            &error);
+        if (!process)
         {
             if (m_logger)
             {
                 m_logger->logError(
-                    "Failed to copy executable to working "
-                    "directory",
-                    static_cast<int>(m_clientType));
+                    error, static_cast<int>(m_clientType));
             }
             return false;
         }
 
-        // Set executable permissions
-        QFile::setPermissions(
-            newExePath, QFile::ExeUser | QFile::ReadUser
-                            | QFile::WriteUser);
+        Commons::ScopedWriteLock locker(m_dataMutex);
+        resetNetworkSyncLocked(networkName);
+        m_processes[networkName] = process;
+        m_usedNetworks.remove(networkName);
+        if (syncPoint.valid)
+        {
+            // A reused process already reported where it
+            // waits; that message went to its previous client.
+            m_simulationTimes[networkName]    = syncPoint.simTime;
+            m_simulationHorizons[networkName] = syncPoint.horizon;
+            m_awaitingSync.insert(networkName);
+            m_processSyncPoints.insert(process, syncPoint);
+        }
+        return true;
+    }
+
+    // Get directory and file information
+    QDir    dir(QFileInfo(masterFilePath).absolutePath());
+    QString error;
+    QString newExePath =
+        TruckSimulatorPool::stageExecutable(m_exePath, dir, &error);
+    if (newExePath.isEmpty())
+    {
+        if (m_logger)
+        {
+            m_logger->logError(error,
+                               static_cast<int>(m_clientType));
+        }
+        return false;
     }
 
     // Create process
@@ -731,11 +1171,53 @@ bool TruckSimulationClient::launchSimulator(
     }
 
     Commons::ScopedWriteLock locker(m_dataMutex);
+    resetNetworkSyncLocked(networkName);
     m_processes[networkName] = process;
 
     return true;
 }
 
+void TruckSimulationClient::releaseProcessLocked(
+    const QString &networkName, bool replenish)
+{
+    QProcess *process = m_processes.take(networkName);
+    if (!process)
+    {
+        return;
+    }
+
+    // Only what this process itself reported travels with it
+    const TruckSimulatorPool::SyncPoint syncPoint =
+        m_processSyncPoints.take(process);
+
+    m_simulatorPool->release(
+        process, !m_usedNetworks.contains(networkName),
+        syncPoint, replenish);
+    m_usedNetworks.remove(networkName);
+    resetNetworkSyncLocked(networkName);
+}
+
+void TruckSimulationClient::resetNetworkSyncLocked(
+    const QString &networkName)
+{
+    if (QProcess *previous = m_processes.value(networkName))
+    {
+        m_processSyncPoints.remove(previous);
+    }
+    m_simulationTimes.remove(networkName);
+    m_simulationHorizons.remove(networkName);
+    m_awaitingSync.remove(networkName);
+}
+
+int TruckSimulationClient::syncRequestIdLocked(
+    const QString &networkName) const
+{
+    const TruckSimulatorPool::SyncPoint syncPoint =
+        m_processSyncPoints.value(m_processes.value(networkName));
+    return syncPoint.valid ? syncPoint.requestId
+                           : m_lastRequestId;
+}
+
 } // namespace TruckClient
 } // namespace Backend
 } // namespace CargoNetSim
@@ -17,12 +17,18 @@
 #include "Backend/Commons/ThreadSafetyUtils.h"
 #include "ContainerManager.h"
 #include "TransportationGraph.h"
+#include "TruckSimulatorPool.h"
+#include <QHash>
 #include <QMap>
+#include <QMutex>
 #include <QReadWriteLock>
 #include <QObject>
+#include <QPointer>
 #include <QProcess>
+#include <QSet>
 #include <QStringList>
 #include <containerLib/container.h>
+#include <memory>
 
 namespace CargoNetSim
 {
@@ -31,6 +37,9 @@ namespace Backend
 namespace TruckClient
 {
 
+class IntegrationNetwork;
+struct IntegrationNetworkHandle;
+
 /**
  * @class TruckSimulationClient
  * @brief Manages truck simulations with INTEGRATION
@@ -102,6 +111,51 @@ public:
         const QMap<QString, QVariant> &configUpdates = {},
         const QStringList             &argsUpdates   = {});
 
+    /**
+     * @brief Command line defineSimulator() launches the
+     * simulator with
+     * @param masterFilePath Path to master configuration
+     * file
+     * @param simTime Simulation duration in seconds
+     * @param configUpdates Custom configuration parameters
+     * @param argsUpdates Additional command-line arguments
+     * @param routingNamespace Routing namespace of the
+     * client
+     * @return Simulator arguments
+     */
+    static QStringList simulatorArguments(
+        const QString &masterFilePath, double simTime,
+        const QMap<QString, QVariant> &configUpdates,
+        const QStringList             &argsUpdates,
+        const QString                 &routingNamespace);
+
+    /**
+     * @brief Leases simulator processes from @p pool
+     * instead of starting and terminating them
+     *
+     * Set before defineSimulator(); the pool must outlive
+     * the client.
+     * @param pool Process pool, or nullptr
+     */
+    void setSimulatorPool(TruckSimulatorPool *pool);
+
+    /**
+     * @brief Lets addTrips() send a wave as one ADD_TRIPS
+     * message
+     *
+     * Off by default: the INTEGRATION bridge has to accept
+     * TRIP_CTRL/ADD_TRIPS, and the simulator offers no way
+     * to ask. When off, addTrips() sends one ADD_TRIP per
+     * trip. Set before the first addTrips().
+     * @param enabled True if the bridge accepts ADD_TRIPS
+     */
+    void setBatchTripsEnabled(bool enabled);
+
+    /**
+     * @brief Whether addTrips() sends ADD_TRIPS
+     */
+    bool batchTripsEnabled() const;
+
     /**
      * @brief Synchronously runs the simulator
      * @param networkNames List of network names to run
@@ -157,6 +211,27 @@ public:
                     const QList<ContainerCore::Container *>
                         &containers = {});
 
+    /**
+     * @brief Adds a wave of trips with one message
+     *
+     * Routes are resolved once per origin (one search for
+     * all of its uncached destinations) and memoized per
+     * (origin, destination) until the routing network
+     * changes. With batchTripsEnabled() all trips go out
+     * in a single ADD_TRIPS message, otherwise as one
+     * ADD_TRIP each. Every trip then gets its own truck
+     * state, container assignment and trip end callbacks
+     * exactly as if it had been added with addTrip().
+     * @param networkName Network identifier
+     * @param trips Trips to add; networkName of each
+     * request is ignored
+     * @return Trip identifiers in request order, or an
+     * empty list if any message could not be sent; trips
+     * sent before the failure are still tracked
+     */
+    QStringList addTrips(const QString            &networkName,
+                         const QList<TripRequest> &trips);
+
     /**
      * @brief Adds a trip asynchronously
      * @param networkName Network identifier
@@ -200,6 +275,28 @@ public:
     double
     getProgressPercentage(const QString &networkName) const;
 
+    /**
+     * @brief Whether @p networkName reported a sync point
+     * that has not been answered with SYNC_GO yet
+     * @param networkName Network identifier
+     * @return True if the simulator waits for runSimulator()
+     */
+    bool isAwaitingSync(const QString &networkName) const;
+
+    /**
+     * @brief Leaves answering sync requests of
+     * @p networkNames to the caller
+     *
+     * By default a sync request is answered with SYNC_GO as
+     * soon as it arrives. Under lockstep the client only
+     * records it and emits syncReached(); the caller decides
+     * when to call runSimulator().
+     * @param networkNames Network identifiers
+     * @param enabled True to hold sync requests
+     */
+    void setLockstep(const QStringList &networkNames,
+                     bool               enabled);
+
     /**
      * @brief Gets simulation time
      * @param networkName Network identifier
@@ -215,6 +312,21 @@ public:
     void setNetworkGraph(
         const TransportationGraph<QString> *graph);
 
+    /**
+     * @brief Sets the network trips on @p networkName are
+     * routed through
+     *
+     * Takes precedence over setNetworkGraph(). Routes are
+     * memoized per network name and generation; they are
+     * dropped when a different network is set or the
+     * current one is destroyed, even if a new network is
+     * later allocated at the same address.
+     * @param networkName Network identifier
+     * @param network Loaded truck network, or nullptr
+     */
+    void setRoutingNetwork(const QString      &networkName,
+                           IntegrationNetwork *network);
+
     /**
      * @brief Registers a callback for trip end events
      * @param callbackId Unique callback identifier
@@ -270,12 +382,72 @@ private:
                          double             simTime,
                          const QStringList &args);
 
+    /**
+     * @brief Route link IDs for each (origin, destination)
+     * of @p pairs, memoized per network
+     * @param networkName Network identifier
+     * @param pairs Origin and destination node IDs
+     * @return Link IDs keyed by routeKey(); pairs without a
+     * route are missing and never memoized
+     */
+    QHash<quint64, QList<int>>
+    resolveRoutes(const QString              &networkName,
+                  const QList<QPair<int, int>> &pairs);
+
+    static quint64 routeKey(int originId, int destinationId)
+    {
+        return (quint64(quint32(originId)) << 32)
+               | quint32(destinationId);
+    }
+
+    /**
+     * @brief Hands a network's process back to the pool
+     *
+     * Caller holds m_dataMutex for writing.
+     * @param networkName Network identifier
+     * @param replenish False to keep the pool from starting
+     * a replacement, e.g. while this client is destroyed
+     */
+    void releaseProcessLocked(const QString &networkName,
+                              bool           replenish = true);
+
+    /**
+     * @brief Drops the sync times, horizon and pending sync
+     * of a network whose process changes; caller holds the
+     * write lock
+     */
+    void resetNetworkSyncLocked(const QString &networkName);
+
+    /**
+     * @brief Request id to echo when answering the sync
+     * request of a network's current process; caller holds
+     * the lock
+     */
+    int syncRequestIdLocked(const QString &networkName) const;
+
     /** Path to simulation executable */
     QString m_exePath;
 
     /** Map of network names to simulator processes */
     QMap<QString, QProcess *> m_processes;
 
+    /** Pool processes are leased from, or nullptr */
+    TruckSimulatorPool *m_simulatorPool = nullptr;
+
+    /** Networks with an unanswered sync request */
+    QSet<QString> m_awaitingSync;
+
+    /** Last sync request each current process reported */
+    QHash<QProcess *, TruckSimulatorPool::SyncPoint>
+        m_processSyncPoints;
+
+    /** Networks whose sync requests the caller answers */
+    QSet<QString> m_lockstepNetworks;
+
+    /** Networks whose process received trips or sync
+     * commands and so cannot be reused */
+    QSet<QString> m_usedNetworks;
+
     /** Map of network names to truck states */
     QMap<QString, QList<TruckState *>> m_truckStates;
 
@@ -297,6 +469,9 @@ private:
     /** Counter for sent messages */
     int m_sentMsgCounter = 0;
 
+    /** Whether the bridge accepts ADD_TRIPS */
+    bool m_batchTrips = false;
+
     /** Read-write lock for thread synchronization 
      * 
      * Protects internal data structures from concurrent access.
@@ -314,6 +489,37 @@ private:
     const TransportationGraph<QString> *m_networkGraph =
         nullptr;
 
+    /** Routing network of one simulator network and the
+     * route link IDs memoized against it */
+    struct RoutingNetwork
+    {
+        /** Loaded network; null once it is destroyed */
+        QPointer<IntegrationNetwork> network;
+
+        /** What searches hold, so the network cannot be
+         * destroyed under them */
+        std::shared_ptr<IntegrationNetworkHandle> handle;
+
+        /** Bumped whenever the network is replaced, so a
+         * search started on the old one is not memoized */
+        quint64 generation = 0;
+
+        /** Drops the entry when the network is destroyed */
+        QMetaObject::Connection destroyedConnection;
+
+        /** Memoized route link IDs, keyed by routeKey() */
+        QHash<quint64, QList<int>> routes;
+    };
+
+    /** Routing networks by network name */
+    QMap<QString, RoutingNetwork> m_routingNetworks;
+
+    /** Source of RoutingNetwork::generation */
+    quint64 m_routingGeneration = 0;
+
+    /** Guards m_routingNetworks and m_routingGeneration */
+    mutable QMutex m_routeMutex;
+
     /** Manager for trip end callbacks */
     TripEndCallbackManager *m_tripEndCallbackManager;
 
@@ -337,6 +543,19 @@ signals:
      * @param tripData Trip end data
      */
     void tripEndedWithData(const TripEndData &tripData);
+
+    /**
+     * @brief Signal emitted when a simulator reports a sync
+     * point
+     *
+     * Emitted from the thread that processed the message,
+     * after the client state has been updated.
+     * @param networkName Network identifier
+     * @param simTime Simulator time reached
+     * @param horizon Horizon the simulator asks to run to
+     */
+    void syncReached(const QString &networkName,
+                     double simTime, double horizon);
 };
 
 } // namespace TruckClient
@@ -7,7 +7,9 @@
 
 #include "TruckSimulationManager.h"
 #include "Backend/Commons/LogCategories.h"
+#include <QElapsedTimer>
 #include <QThread>
+#include <limits>
 #include <stdexcept>
 
 namespace CargoNetSim
@@ -20,6 +22,7 @@ namespace TruckClient
 TruckSimulationManager::TruckSimulationManager(
     QObject *parent)
     : QObject(parent)
+    , m_simulatorPool(std::make_unique<TruckSimulatorPool>())
 {
 }
 
@@ -81,6 +84,13 @@ void TruckSimulationManager::initializeManager(
         << "logger=" << (logger != nullptr);
 }
 
+void TruckSimulationManager::setRoutingNamespace(
+    const QString &routingNamespace)
+{
+    Commons::ScopedWriteLock locker(m_mutex);
+    m_routingNamespace = routingNamespace;
+}
+
 bool TruckSimulationManager::resetServer()
 {
     qCInfo(lcClientTruck)
@@ -235,11 +245,26 @@ bool TruckSimulationManager::createClient(
     TruckSimulationClient *client =
         new TruckSimulationClient(config.exePath, nullptr,
                                   config.host, config.port);
+    {
+        Commons::ScopedReadLock locker(m_mutex);
+        client->setRoutingNamespace(m_routingNamespace);
+    }
+    client->setSimulatorPool(m_simulatorPool.get());
+    client->setBatchTripsEnabled(config.batchTrips);
 
     connect(client, &TruckSimulationClient::tripEnded,
             this, &TruckSimulationManager::tripEnded);
     connect(client, &TruckSimulationClient::tripEndedWithData,
             this, &TruckSimulationManager::tripEndedWithData);
+    // Direct: runSimulationSync blocks this object's thread
+    connect(
+        client, &TruckSimulationClient::syncReached, this,
+        [this]() {
+            QMutexLocker locker(&m_syncMutex);
+            ++m_syncGeneration;
+            m_syncCondition.wakeAll();
+        },
+        Qt::DirectConnection);
 
     // Store client and configuration
     {
@@ -285,6 +310,36 @@ bool TruckSimulationManager::createClient(
     return success;
 }
 
+int TruckSimulationManager::prewarmSimulators(
+    const ClientConfiguration &config, int count)
+{
+    if (!config.isValid())
+    {
+        throw std::invalid_argument(
+            "Invalid client configuration");
+    }
+
+    QString routingNamespace;
+    {
+        Commons::ScopedReadLock locker(m_mutex);
+        routingNamespace = m_routingNamespace;
+    }
+
+    const QStringList args =
+        TruckSimulationClient::simulatorArguments(
+            config.masterFilePath, config.simTime,
+            config.configUpdates, config.argsUpdates,
+            routingNamespace);
+    return m_simulatorPool->prewarm(
+        config.exePath, config.masterFilePath, args, count);
+}
+
+void TruckSimulationManager::setMaxSimulatorProcesses(
+    int maxProcesses)
+{
+    m_simulatorPool->setMaxProcesses(maxProcesses);
+}
+
 bool TruckSimulationManager::removeClient(
     const QString &networkName)
 {
@@ -528,20 +583,96 @@ bool TruckSimulationManager::runSimulationSync(
         << "starting sync simulation"
         << "networks=" << networkNames;
 
+    QMap<QString, TruckSimulationClient *> clients;
+    {
+        Commons::ScopedReadLock locker(m_mutex);
+        const QStringList effectiveNames =
+            networkNames.contains("*") ? m_clients.keys()
+                                       : networkNames;
+        for (const QString &name : effectiveNames)
+        {
+            if (m_clients.contains(name))
+            {
+                clients[name] = m_clients[name];
+            }
+        }
+    }
+
+    auto slowestTime = [&clients]() {
+        double slowest = std::numeric_limits<double>::infinity();
+        for (auto it = clients.cbegin(); it != clients.cend();
+             ++it)
+        {
+            slowest = qMin(slowest,
+                           it.value()->getSimulationTime(it.key()));
+        }
+        return clients.isEmpty() ? 0.0 : slowest;
+    };
+
+    for (auto it = clients.cbegin(); it != clients.cend(); ++it)
+    {
+        it.value()->setLockstep({it.key()}, true);
+    }
+
+    QElapsedTimer wall;
+    wall.start();
+    const double startTime = slowestTime();
+    int          rounds    = 0;
+
     while (keepGoing(networkNames))
     {
-        syncGoOnce(networkNames);
-        QThread::msleep(
-            static_cast<long>(WAIT_INTERVAL * 1000));
+        quint64 seen = 0;
+        {
+            QMutexLocker locker(&m_syncMutex);
+            seen = m_syncGeneration;
+        }
+
+        advanceLaggards(clients);
+        ++rounds;
+
+        // Sleep until any simulator reports its next sync
+        // point; the timeout only guards against a lost one.
+        QMutexLocker locker(&m_syncMutex);
+        if (m_syncGeneration == seen)
+        {
+            m_syncCondition.wait(
+                &m_syncMutex,
+                static_cast<unsigned long>(WAIT_INTERVAL
+                                           * 1000));
+        }
+    }
+
+    for (auto it = clients.cbegin(); it != clients.cend(); ++it)
+    {
+        it.value()->setLockstep({it.key()}, false);
+    }
+
+    const double wallSeconds = wall.elapsed() / 1000.0;
+    const double simulated   = slowestTime() - startTime;
+    const double throughput =
+        wallSeconds > 0.0 ? simulated / wallSeconds : 0.0;
+    {
+        QMutexLocker locker(&m_syncMutex);
+        m_lastSyncThroughput = throughput;
     }
 
     qCInfo(lcClientTruck)
         << "TruckSimulationManager::runSimulationSync:"
         << "sync simulation completed"
-        << "networks=" << networkNames;
+        << "networks=" << networkNames
+        << "rounds=" << rounds
+        << "simulatedSeconds=" << simulated
+        << "wallSeconds=" << wallSeconds
+        << "simSecondsPerWallSecond=" << throughput;
     return true;
 }
 
+double TruckSimulationManager::lastSyncThroughput() const
+{
+    QMutexLocker locker(&m_syncMutex);
+    return m_lastSyncThroughput;
+}
+
 bool TruckSimulationManager::runSimulationAsync(
     const QStringList &networkNames)
 {
@@ -599,56 +730,40 @@ bool TruckSimulationManager::runSimulationAsync(
     return allSucceeded;
 }
 
-void TruckSimulationManager::syncGoOnce(
-    const QStringList &networkNames)
+double TruckSimulationManager::advanceLaggards(
+    const QMap<QString, TruckSimulationClient *> &clients)
 {
-    qCDebug(lcClientTruck)
-        << "TruckSimulationManager::syncGoOnce:"
-        << "networks=" << networkNames;
+    double                slowest =
+        std::numeric_limits<double>::infinity();
+    QMap<QString, double> times;
 
-    double                                 maxTime = 0.0;
-    QStringList                            effectiveNames;
-    QMap<QString, double>                  currentTimes;
-    QMap<QString, TruckSimulationClient *> relevantClients;
-
-    // Collect data with read lock
+    for (auto it = clients.cbegin(); it != clients.cend(); ++it)
     {
-        Commons::ScopedReadLock locker(m_mutex);
-        effectiveNames = networkNames.contains("*")
-                             ? m_clients.keys()
-                             : networkNames;
-
-        // Calculate max time across all clients
-        for (const QString &name : effectiveNames)
+        if (it.value()->getProgressPercentage(it.key()) >= 100.0)
         {
-            if (m_clients.contains(name))
-            {
-                double time =
-                    m_clients[name]->getProgressPercentage(
-                        name)
-                    * m_clients[name]->getSimulationTime(
-                        name)
-                    / 100.0;
-                maxTime               = qMax(maxTime, time);
-                currentTimes[name]    = time;
-                relevantClients[name] = m_clients[name];
-            }
+            continue; // finished networks do not hold others
         }
+        const double time =
+            it.value()->getSimulationTime(it.key());
+        times[it.key()] = time;
+        slowest         = qMin(slowest, time);
     }
 
-    // Process without holding the lock
-    for (const QString &name : effectiveNames)
+    for (auto it = times.cbegin(); it != times.cend(); ++it)
     {
-        if (relevantClients.contains(name))
+        TruckSimulationClient *client = clients.value(it.key());
+        if (it.value() <= slowest
+            && client->isAwaitingSync(it.key()))
         {
-            double current = currentTimes[name];
-            if (current >= maxTime)
-            {
-                relevantClients[name]->runSimulator({name});
-                return; // Exit early after sending command
-            }
+            qCDebug(lcClientTruck)
+                << "TruckSimulationManager::advanceLaggards:"
+                << "network=" << it.key()
+                << "time=" << it.value();
+            client->runSimulator({it.key()});
         }
     }
+
+    return slowest;
 }
 
 bool TruckSimulationManager::keepGoing(
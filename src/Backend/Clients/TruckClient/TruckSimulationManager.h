@@ -12,12 +12,14 @@
 #include "Backend/Commons/ThreadSafetyUtils.h"
 #include "TruckSimulationClient.h"
 #include <QMap>
+#include <QMutex>
 #include <QObject>
 #include <QReadWriteLock>
 #include <QString>
 #include <QStringList>
 #include <QThread>
 #include <QVariant>
+#include <QWaitCondition>
 #include <memory>
 
 namespace CargoNetSim
@@ -47,6 +49,7 @@ struct ClientConfiguration
         configUpdates; ///< Custom configuration parameters
     QStringList
         argsUpdates; ///< Additional command-line arguments
+    bool batchTrips = false; ///< Bridge accepts ADD_TRIPS
 
     bool isValid() const
     {
@@ -90,6 +93,13 @@ public:
         TerminalSimulationClient *terminalClient,
         LoggerInterface          *logger);
 
+    /**
+     * @brief Routing namespace applied to every client created
+     * afterwards (see SimulationClientBase::setRoutingNamespace)
+     * @param routingNamespace Namespace, empty for the default
+     */
+    void setRoutingNamespace(const QString &routingNamespace);
+
     /**
      * @brief Forcefully resets all clients and their
      * processes
@@ -118,6 +128,31 @@ public:
     bool createClient(const QString &networkName,
                       const ClientConfiguration &config);
 
+    /**
+     * @brief Starts simulator processes for @p config
+     * ahead of createClient()
+     *
+     * Clients lease their processes from a pool shared by
+     * this manager: a process that never received trips or
+     * sync commands returns to the pool when its client is
+     * removed or reset, and a used one is replaced in the
+     * background, so defining the same network again does
+     * not wait for a process start.
+     * @param config Configuration a client will be created
+     * with
+     * @param count Number of idle processes to keep ready
+     * @return Number of processes started
+     */
+    int prewarmSimulators(const ClientConfiguration &config,
+                          int                        count = 1);
+
+    /**
+     * @brief Caps the simulator processes the pool keeps
+     * alive, leased or idle
+     * @param maxProcesses Cap; 0 = none (the default)
+     */
+    void setMaxSimulatorProcesses(int maxProcesses);
+
     /**
      * @brief Removes a client
      * @param networkName Network name of client to remove
@@ -164,12 +199,25 @@ public:
     /**
      * @brief Run simulation synchronously for specified
      * networks
+     *
+     * Runs the networks in lockstep: whenever a simulator
+     * reports a sync point, every waiting network that is not
+     * ahead of the slowest unfinished one gets its next
+     * horizon right away; networks that are ahead wait. The
+     * call returns once every network has finished.
      * @param networkNames List of network names to run, "*"
      * for all
      * @return True if simulation started successfully
      */
     bool runSimulationSync(const QStringList &networkNames);
 
+    /**
+     * @brief Simulated seconds per wall-clock second
+     * achieved by the last runSimulationSync() call
+     * @return Throughput, or 0 before the first run
+     */
+    double lastSyncThroughput() const;
+
     /**
      * @brief Run simulation asynchronously for specified
      * networks
@@ -227,10 +275,17 @@ private:
     bool keepGoing(const QStringList &networkNames) const;
 
     /**
-     * @brief Run one synchronization step
-     * @param networkNames List of network names to sync
+     * @brief Run one lockstep round
+     *
+     * Sends SYNC_GO to every network that waits at a sync
+     * point and is not ahead of the slowest unfinished
+     * network.
+     * @param clients Clients by network name
+     * @return Time of the slowest unfinished network, or
+     * infinity when all have finished
      */
-    void syncGoOnce(const QStringList &networkNames);
+    double advanceLaggards(
+        const QMap<QString, TruckSimulationClient *> &clients);
 
     /**
      * @brief Create and initialize a new thread for a
@@ -250,12 +305,18 @@ private:
     initializeClientInThread(TruckSimulationClient *client,
                              const QString &networkName);
 
+    /** Simulator processes shared by all clients */
+    std::unique_ptr<TruckSimulatorPool> m_simulatorPool;
+
     /** Global simulation time reference */
     SimulationTime *m_defaultSimulationTime = nullptr;
 
     /** Global logger reference */
     LoggerInterface *m_defaultLogger = nullptr;
 
+    /** Routing namespace for new clients */
+    QString m_routingNamespace;
+
     /** Global terminal client reference */
     TerminalSimulationClient *m_defaultTerminalClient =
         nullptr;
@@ -272,8 +333,21 @@ private:
     /** Mutex for thread-safe access to internal data */
     mutable QReadWriteLock m_mutex;
 
-    /** Wait interval for synchronous simulation (seconds)
-     */
+    /** Guards the lockstep barrier state below */
+    mutable QMutex m_syncMutex;
+
+    /** Signalled whenever a client reports a sync point */
+    QWaitCondition m_syncCondition;
+
+    /** Sync points reported so far; lets the lockstep loop
+     * detect reports that arrived while it was busy */
+    quint64 m_syncGeneration = 0;
+
+    /** Throughput of the last runSimulationSync() call */
+    double m_lastSyncThroughput = 0.0;
+
+    /** Longest wait for a sync point before the lockstep
+     * loop re-checks progress anyway (seconds) */
     static constexpr double WAIT_INTERVAL = 0.1;
 
 signals:
@@ -0,0 +1,492 @@
+/**
+ * @file TruckSimulatorPool.cpp
+ * @brief Implements the simulator process pool
+ * @author Ahmed Aredah
+ * @date 2026-10-19
+ */
+
+#include "TruckSimulatorPool.h"
+#include "Backend/Commons/LogCategories.h"
+#include <QCryptographicHash>
+#include <QFile>
+#include <QFileInfo>
+#include <QThread>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace TruckClient
+{
+
+TruckSimulatorPool::TruckSimulatorPool(int maxProcesses)
+{
+    setMaxProcesses(maxProcesses);
+    m_ownerThread.setObjectName(QStringLiteral("TruckSimulatorPool"));
+    m_owner.moveToThread(&m_ownerThread);
+    m_ownerThread.start();
+}
+
+TruckSimulatorPool::~TruckSimulatorPool()
+{
+    if (!m_leased.isEmpty())
+    {
+        qCWarning(lcClientTruck)
+            << "TruckSimulatorPool::~TruckSimulatorPool:"
+            << m_leased.size() << "processes still leased";
+    }
+    // Also drains retirements queued by earlier releases
+    clear();
+    m_ownerThread.quit();
+    m_ownerThread.wait();
+}
+
+QByteArray TruckSimulatorPool::launchKey(
+    const QString &exePath, const QString &masterFilePath,
+    const QStringList &args)
+{
+    QFile master(masterFilePath);
+    if (!master.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(QFileInfo(exePath).absoluteFilePath().toUtf8());
+    hash.addData(QFileInfo(masterFilePath)
+                     .absoluteFilePath()
+                     .toUtf8());
+    if (!hash.addData(&master))
+    {
+        return QByteArray();
+    }
+    for (const QString &arg : args)
+    {
+        hash.addData(QByteArrayView("\0", 1));
+        hash.addData(arg.toUtf8());
+    }
+    return hash.result();
+}
+
+QString TruckSimulatorPool::stageExecutable(
+    const QString &exePath, const QDir &dir, QString *error)
+{
+    const QString stagedPath =
+        dir.filePath(QFileInfo(exePath).fileName());
+
+    // Copy executable to working directory if needed
+    if (!QFile::exists(stagedPath))
+    {
+        if (!QFile::copy(exePath, stagedPath))
+        {
+            if (error)
+            {
+                *error = QStringLiteral(
+                    "Failed to copy executable to working "
+                    "directory");
+            }
+            return QString();
+        }
+
+        // Set executable permissions
+        QFile::setPermissions(
+            stagedPath, QFile::ExeUser | QFile::ReadUser
+                            | QFile::WriteUser);
+    }
+    return stagedPath;
+}
+
+QProcess *TruckSimulatorPool::acquire(
+    const QString &exePath, const QString &masterFilePath,
+    const QStringList &args, SyncPoint *syncPoint,
+    QString *error)
+{
+    Launch launch{launchKey(exePath, masterFilePath, args),
+                  exePath, masterFilePath, args};
+    if (launch.key.isEmpty())
+    {
+        if (error)
+        {
+            *error = QStringLiteral("Cannot read master file %1")
+                         .arg(masterFilePath);
+        }
+        return nullptr;
+    }
+    if (syncPoint)
+    {
+        *syncPoint = SyncPoint();
+    }
+
+    QList<QProcess *> retired;
+    QProcess         *process = nullptr;
+    {
+        QMutexLocker locker(&m_mutex);
+        QList<Idle> &idle = m_idle[launch.key];
+        while (!idle.isEmpty())
+        {
+            Idle entry = idle.takeFirst();
+            if (entry.process->state() == QProcess::NotRunning)
+            {
+                retired.append(entry.process); // exited while idle
+                continue;
+            }
+            process = entry.process;
+            if (syncPoint)
+            {
+                *syncPoint = entry.syncPoint;
+            }
+            break;
+        }
+
+        if (process)
+        {
+            m_leased.insert(process, launch);
+        }
+        else if (atCapLocked() && !evictLocked(launch.key, retired))
+        {
+            locker.unlock();
+            retire(retired, false);
+            qCWarning(lcClientTruck)
+                << "TruckSimulatorPool::acquire:"
+                << "all" << m_maxProcesses
+                << "processes are leased";
+            if (error)
+            {
+                *error = QStringLiteral(
+                    "Simulator process limit reached");
+            }
+            return nullptr;
+        }
+        else
+        {
+            ++m_starting[launch.key]; // hold the slot
+        }
+    }
+    retire(retired, false);
+
+    if (process)
+    {
+        qCDebug(lcClientTruck)
+            << "TruckSimulatorPool::acquire:"
+            << "reusing idle process pid="
+            << process->processId();
+        return process;
+    }
+
+    // Same budget as the unpooled launch
+    process = spawn(launch, true, error);
+    {
+        QMutexLocker locker(&m_mutex);
+        if (--m_starting[launch.key] == 0)
+        {
+            m_starting.remove(launch.key);
+        }
+        if (process)
+        {
+            m_leased.insert(process, launch);
+        }
+    }
+    if (!process)
+    {
+        return nullptr;
+    }
+
+    qCDebug(lcClientTruck)
+        << "TruckSimulatorPool::acquire:"
+        << "started process pid=" << process->processId();
+    return process;
+}
+
+void TruckSimulatorPool::release(QProcess *process,
+                                 bool reusable,
+                                 const SyncPoint &syncPoint,
+                                 bool             replenish)
+{
+    if (!process)
+    {
+        return;
+    }
+
+    Launch launch;
+    bool   keep = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_leased.find(process);
+        if (it == m_leased.end())
+        {
+            qCWarning(lcClientTruck)
+                << "TruckSimulatorPool::release:"
+                << "process was not leased from this pool";
+            locker.unlock();
+            retire({process}, false);
+            return;
+        }
+        launch = it.value();
+        m_leased.erase(it);
+
+        QList<Idle> &idle = m_idle[launch.key];
+        keep = reusable
+               && process->state() == QProcess::Running;
+        if (keep)
+        {
+            idle.append({process, syncPoint});
+        }
+        else
+        {
+            // The retired process frees the slot its
+            // replacement takes.
+            replenish = replenish && idle.isEmpty()
+                        && m_clearing == 0;
+        }
+    }
+
+    qCDebug(lcClientTruck)
+        << "TruckSimulatorPool::release:"
+        << (keep ? "kept" : "retiring")
+        << "pid=" << process->processId();
+
+    if (keep)
+    {
+        return;
+    }
+    retire({process}, false);
+
+    if (replenish)
+    {
+        prewarm(launch.exePath, launch.masterFilePath,
+                launch.args, 1);
+    }
+}
+
+int TruckSimulatorPool::prewarm(const QString     &exePath,
+                                const QString     &masterFilePath,
+                                const QStringList &args,
+                                int                count)
+{
+    const Launch launch{launchKey(exePath, masterFilePath, args),
+                        exePath, masterFilePath, args};
+    if (launch.key.isEmpty())
+    {
+        return 0;
+    }
+
+    int started = 0;
+    while (true)
+    {
+        {
+            QMutexLocker locker(&m_mutex);
+            if (m_clearing > 0 || atCapLocked()
+                || m_idle.value(launch.key).size()
+                           + m_starting.value(launch.key)
+                       >= count)
+            {
+                break;
+            }
+            ++m_starting[launch.key]; // hold the slot
+        }
+
+        QString   error;
+        QProcess *process = spawn(launch, false, &error);
+
+        bool kept = false;
+        {
+            QMutexLocker locker(&m_mutex);
+            if (--m_starting[launch.key] == 0)
+            {
+                m_starting.remove(launch.key);
+            }
+            if (process && m_clearing == 0)
+            {
+                m_idle[launch.key].append({process, SyncPoint()});
+                kept = true;
+            }
+        }
+        if (!process)
+        {
+            qCWarning(lcClientTruck)
+                << "TruckSimulatorPool::prewarm:" << error;
+            break;
+        }
+        if (!kept)
+        {
+            retire({process}, false); // cleared meanwhile
+            break;
+        }
+        ++started;
+    }
+
+    if (started > 0)
+    {
+        qCInfo(lcClientTruck)
+            << "TruckSimulatorPool::prewarm:"
+            << "started" << started << "processes for"
+            << masterFilePath;
+    }
+    return started;
+}
+
+void TruckSimulatorPool::clear()
+{
+    QList<QProcess *> retired;
+    {
+        QMutexLocker locker(&m_mutex);
+        ++m_clearing;
+        for (const QList<Idle> &idle : std::as_const(m_idle))
+        {
+            for (const Idle &entry : idle)
+            {
+                retired.append(entry.process);
+            }
+        }
+        m_idle.clear();
+    }
+    retire(retired, true);
+
+    QMutexLocker locker(&m_mutex);
+    --m_clearing;
+}
+
+void TruckSimulatorPool::setMaxProcesses(int maxProcesses)
+{
+    QMutexLocker locker(&m_mutex);
+    m_maxProcesses = qMax(0, maxProcesses);
+}
+
+int TruckSimulatorPool::maxProcesses() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_maxProcesses;
+}
+
+int TruckSimulatorPool::idleCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    int idle = 0;
+    for (const QList<Idle> &entries : m_idle)
+    {
+        idle += entries.size();
+    }
+    return idle;
+}
+
+int TruckSimulatorPool::leasedCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_leased.size();
+}
+
+QProcess *TruckSimulatorPool::spawn(const Launch &launch,
+                                    bool          waitForStarted,
+                                    QString      *error)
+{
+    const QDir dir(
+        QFileInfo(launch.masterFilePath).absolutePath());
+    const QString stagedPath =
+        stageExecutable(launch.exePath, dir, error);
+    if (stagedPath.isEmpty())
+    {
+        return nullptr;
+    }
+
+    QProcess *process = nullptr;
+    runOnOwnerThread([&]() {
+        auto *started = new QProcess();
+        started->setWorkingDirectory(dir.path());
+        started->start(stagedPath, launch.args);
+        if (waitForStarted && started->state() != QProcess::Running
+            && !started->waitForStarted(5000))
+        {
+            delete started;
+            return;
+        }
+        process = started;
+    });
+    if (!process && error)
+    {
+        *error = QStringLiteral("Failed to start simulator process");
+    }
+    return process;
+}
+
+void TruckSimulatorPool::retire(const QList<QProcess *> &processes,
+                                bool                     wait)
+{
+    if (processes.isEmpty())
+    {
+        return;
+    }
+
+    auto work = [processes]() {
+        for (QProcess *process : processes)
+        {
+            if (process->state() != QProcess::NotRunning)
+            {
+                process->terminate();
+                process->waitForFinished(3000);
+                if (process->state() != QProcess::NotRunning)
+                {
+                    process->kill();
+                }
+            }
+            delete process;
+        }
+    };
+    if (wait)
+    {
+        runOnOwnerThread(work);
+    }
+    else
+    {
+        QMetaObject::invokeMethod(&m_owner, work,
+                                  Qt::QueuedConnection);
+    }
+}
+
+void TruckSimulatorPool::runOnOwnerThread(
+    const std::function<void()> &fn)
+{
+    if (QThread::currentThread() == &m_ownerThread)
+    {
+        fn();
+        return;
+    }
+    QMetaObject::invokeMethod(&m_owner, fn,
+                              Qt::BlockingQueuedConnection);
+}
+
+int TruckSimulatorPool::liveCountLocked() const
+{
+    int live = m_leased.size();
+    for (const QList<Idle> &idle : m_idle)
+    {
+        live += idle.size();
+    }
+    for (int starting : m_starting)
+    {
+        live += starting;
+    }
+    return live;
+}
+
+bool TruckSimulatorPool::atCapLocked() const
+{
+    return m_maxProcesses > 0 && liveCountLocked() >= m_maxProcesses;
+}
+
+bool TruckSimulatorPool::evictLocked(
+    const QByteArray &key, QList<QProcess *> &retired)
+{
+    for (auto it = m_idle.begin(); it != m_idle.end(); ++it)
+    {
+        if (it.key() != key && !it.value().isEmpty())
+        {
+            retired.append(it.value().takeFirst().process);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace TruckClient
+} // namespace Backend
+} // namespace CargoNetSim
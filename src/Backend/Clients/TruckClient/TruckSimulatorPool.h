@@ -0,0 +1,218 @@
+/**
+ * @file TruckSimulatorPool.h
+ * @brief Pool of pre-spawned INTEGRATION simulator processes
+ * @author Ahmed Aredah
+ * @date 2026-10-19
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QDir>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QProcess>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+
+#include <functional>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace TruckClient
+{
+
+/**
+ * @class TruckSimulatorPool
+ * @brief Hands out running simulator processes by launch key
+ *
+ * A simulator process is bound to its executable, master
+ * file and command line, so processes are pooled under a
+ * launch key: the SHA-256 of the executable path, the
+ * master file contents and the arguments. acquire() returns
+ * an idle process with that key when there is one and only
+ * spawns (and waits for) a new process otherwise.
+ *
+ * INTEGRATION cannot rewind a controlled run, so a released
+ * process goes back to the pool only when it never received
+ * trips or sync commands; it keeps the sync point it last
+ * reported so the next client can pick up from there. Any
+ * other process is retired and, while the key has no idle
+ * process, replaced by a fresh one that starts (and connects
+ * to the broker) in the background before anyone asks.
+ *
+ * With a maxProcesses() cap, leased plus idle processes
+ * never exceed it; idle processes of other keys are retired
+ * to make room. There is no cap by default.
+ *
+ * Every process is created, started and retired on the
+ * pool's own thread, so callers on any thread only hold a
+ * handle and must not do I/O on it. Retiring a released
+ * process is queued there and does not block the caller.
+ *
+ * Thread-safe.
+ */
+class TruckSimulatorPool
+{
+public:
+    /**
+     * @struct SyncPoint
+     * @brief Last sync request an idle process reported
+     */
+    struct SyncPoint
+    {
+        bool   valid     = false; ///< False if none received yet
+        double simTime   = 0.0;   ///< Simulator time
+        double horizon   = 0.0;   ///< Simulator horizon
+        int    requestId = -1;    ///< Id the answer must echo
+    };
+
+    /**
+     * @brief Constructor, starts the owner thread
+     * @param maxProcesses Cap on live processes; 0 = none
+     */
+    explicit TruckSimulatorPool(int maxProcesses = 0);
+
+    /**
+     * @brief Destructor, retires every idle process and
+     * stops the owner thread
+     *
+     * Leased processes must have been released before.
+     */
+    ~TruckSimulatorPool();
+
+    TruckSimulatorPool(const TruckSimulatorPool &) = delete;
+    TruckSimulatorPool &
+    operator=(const TruckSimulatorPool &) = delete;
+
+    /**
+     * @brief Launch key for a simulator command line
+     * @return Key, or empty if the master file is unreadable
+     */
+    static QByteArray launchKey(const QString     &exePath,
+                                const QString     &masterFilePath,
+                                const QStringList &args);
+
+    /**
+     * @brief Copies the executable into @p dir unless it is
+     * already there
+     * @param exePath Path to the simulator executable
+     * @param dir Working directory of the simulator
+     * @param error Receives the reason on failure
+     * @return Path of the staged executable, or empty
+     */
+    static QString stageExecutable(const QString &exePath,
+                                   const QDir    &dir,
+                                   QString *error = nullptr);
+
+    /**
+     * @brief Leases a running simulator process
+     * @param exePath Path to the simulator executable
+     * @param masterFilePath Path to the master file; the
+     * process runs in its directory
+     * @param args Command-line arguments
+     * @param syncPoint Receives the sync point of a reused
+     * process (invalid for a new one)
+     * @param error Receives the reason on failure
+     * @return Process, or nullptr if it cannot be started or
+     * the pool is at its cap with every process leased
+     */
+    QProcess *acquire(const QString     &exePath,
+                      const QString     &masterFilePath,
+                      const QStringList &args,
+                      SyncPoint         *syncPoint = nullptr,
+                      QString           *error     = nullptr);
+
+    /**
+     * @brief Returns a leased process
+     * @param process Process from acquire()
+     * @param reusable True if the process never received
+     * trips or sync commands
+     * @param syncPoint Sync point to hand to the next lease
+     * @param replenish False to skip starting a replacement
+     * for a retired process, e.g. while the lessee is being
+     * destroyed
+     */
+    void release(QProcess *process, bool reusable,
+                 const SyncPoint &syncPoint = SyncPoint(),
+                 bool             replenish = true);
+
+    /**
+     * @brief Starts processes in the background until
+     * @p count are idle for this launch (or the cap is hit)
+     * @return Number of processes started
+     */
+    int prewarm(const QString &exePath,
+                const QString &masterFilePath,
+                const QStringList &args, int count);
+
+    /**
+     * @brief Retires every idle process
+     *
+     * Blocks until they are gone; releases and prewarms
+     * meanwhile start no new processes.
+     */
+    void clear();
+
+    /// Caps live processes; 0 or less removes the cap.
+    void setMaxProcesses(int maxProcesses);
+    int  maxProcesses() const;
+    int  idleCount() const;
+    int  leasedCount() const;
+
+private:
+    struct Launch
+    {
+        QByteArray  key;
+        QString     exePath;
+        QString     masterFilePath;
+        QStringList args;
+    };
+
+    struct Idle
+    {
+        QProcess *process = nullptr;
+        SyncPoint syncPoint;
+    };
+
+    /// Starts @p launch on the owner thread, optionally
+    /// waiting until it runs.
+    QProcess *spawn(const Launch &launch, bool waitForStarted,
+                    QString *error);
+
+    /// Terminates (then kills) and deletes @p processes on
+    /// the owner thread; @p wait blocks until that is done.
+    void retire(const QList<QProcess *> &processes, bool wait);
+
+    /// Runs @p fn on the owner thread and waits for it.
+    void runOnOwnerThread(const std::function<void()> &fn);
+
+    int  liveCountLocked() const;
+    bool atCapLocked() const;
+
+    /// Moves an idle process of another key to @p retired;
+    /// false if there is none.
+    bool evictLocked(const QByteArray  &key,
+                     QList<QProcess *> &retired);
+
+    mutable QMutex                 m_mutex;
+    int                            m_maxProcesses = 0; ///< 0 = no cap
+    QHash<QByteArray, QList<Idle>> m_idle; ///< Oldest first
+    QHash<QProcess *, Launch>      m_leased;
+    QHash<QByteArray, int>         m_starting; ///< Slots being spawned
+    int                            m_clearing = 0;
+
+    /// Thread every process lives on
+    QThread m_ownerThread;
+    /// Context object on m_ownerThread for queued calls
+    QObject m_owner;
+};
+
+} // namespace TruckClient
+} // namespace Backend
+} // namespace CargoNetSim
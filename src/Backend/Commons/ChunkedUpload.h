@@ -0,0 +1,94 @@
+/**
+ * @file ChunkedUpload.h
+ * @brief Bounded, pipelined bulk uploads
+ * @author Ahmed Aredah
+ * @date 2026-10-19
+ */
+
+#pragma once
+
+#include <QThreadPool>
+#include <QtGlobal>
+#include <functional>
+#include <utility>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Commons
+{
+
+/**
+ * @struct ChunkedUpload
+ * @brief Message bound and progress hook for a bulk upload
+ */
+struct ChunkedUpload
+{
+    static constexpr int kDefaultMaxItems = 2000;
+
+    int maxItems = kDefaultMaxItems; ///< Items per message
+
+    /// Called after each acknowledged chunk with the number
+    /// of items sent so far.
+    std::function<void(int sent, int total)> progress;
+};
+
+/**
+ * @brief Sends @p total items in chunks of at most
+ * upload.maxItems, one chunk ahead
+ *
+ * encode(begin, end) builds the message for items
+ * [begin, end); send(chunk, begin, end) delivers it and
+ * returns false to stop. While one chunk is being sent the
+ * next is encoded on a worker thread, so encode must only
+ * read state that send does not modify.
+ *
+ * @return True if every chunk was sent
+ */
+template <typename Chunk, typename Encode, typename Send>
+bool runChunkedUpload(int total, const ChunkedUpload &upload,
+                      Encode encode, Send send)
+{
+    if (total <= 0)
+    {
+        return true;
+    }
+    const int step = qMax(1, upload.maxItems);
+
+    // Declared before the pool so the worker never outlives
+    // the chunk it writes.
+    Chunk       current = encode(0, qMin(step, total));
+    Chunk       next;
+    QThreadPool encoder;
+    encoder.setMaxThreadCount(1);
+
+    for (int begin = 0; begin < total; begin += step)
+    {
+        const int end = qMin(begin + step, total);
+        if (end < total)
+        {
+            const int nextEnd = qMin(end + step, total);
+            encoder.start([&next, &encode, end, nextEnd]() {
+                next = encode(end, nextEnd);
+            });
+        }
+        const bool sent = send(std::move(current), begin, end);
+        encoder.waitForDone();
+        if (!sent)
+        {
+            return false;
+        }
+        if (upload.progress)
+        {
+            upload.progress(end, total);
+        }
+        current = std::move(next);
+        next    = Chunk();
+    }
+    return true;
+}
+
+} // namespace Commons
+} // namespace Backend
+} // namespace CargoNetSim
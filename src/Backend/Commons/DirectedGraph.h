@@ -244,6 +244,26 @@ public:
         const T &startNodeId, const T &endNodeId,
         const QString &optimizeFor = "distance") const;
 
+    /**
+     * @brief Finds the shortest paths from one node to many
+     * targets with a single Dijkstra run.
+     *
+     * The search stops once every reachable target has been
+     * settled. Expansion order and tie-breaking match
+     * findShortestPath(), so each returned path is identical
+     * to the point-to-point result for the same pair.
+     *
+     * @param startNodeId The starting node identifier.
+     * @param endNodeIds The destination node identifiers.
+     * @param optimizeFor The criterion to optimize for
+     * (default: "distance").
+     * @return Paths keyed by destination; unreachable or
+     * unknown destinations map to an empty vector.
+     */
+    QMap<T, QVector<T>> findShortestPaths(
+        const T &startNodeId, const QVector<T> &endNodeIds,
+        const QString &optimizeFor = "distance") const;
+
     /**
      * @brief Clears all nodes and edges from the graph.
      */
@@ -768,6 +788,113 @@ QVector<T> DirectedGraph<T>::findShortestPath(
     return path;
 }
 
+template <typename T>
+QMap<T, QVector<T>> DirectedGraph<T>::findShortestPaths(
+    const T &startNodeId, const QVector<T> &endNodeIds,
+    const QString &optimizeFor) const
+{
+    QMap<T, QVector<T>> paths;
+    QSet<T>             pending;
+    for (const T &endNodeId : endNodeIds)
+    {
+        paths.insert(endNodeId, QVector<T>());
+        if (hasNode(endNodeId))
+            pending.insert(endNodeId);
+    }
+    if (!hasNode(startNodeId) || pending.isEmpty())
+    {
+        return paths;
+    }
+
+    QMap<T, float> costs;
+    QMap<T, T>     predecessors;
+    QSet<T>        visited;
+    QSet<T>        settled;
+
+    for (const T &nodeId : getNodes())
+    {
+        costs[nodeId] =
+            std::numeric_limits<float>::infinity();
+        predecessors[nodeId] = nodeId;
+    }
+    costs[startNodeId] = 0.0f;
+
+    QVector<PriorityQueueEntry<T>> pq;
+    pq.append({0.0f, startNodeId});
+
+    while (!pq.isEmpty() && !pending.isEmpty())
+    {
+        auto it = std::min_element(
+            pq.begin(), pq.end(),
+            [](const PriorityQueueEntry<T> &a,
+               const PriorityQueueEntry<T> &b) {
+                return a.cost < b.cost;
+            });
+
+        float currentCost = it->cost;
+        T     currentNode = it->nodeId;
+        pq.erase(it);
+
+        // The first pop of a target fixes its predecessor
+        // chain, exactly where findShortestPath() would stop.
+        if (pending.remove(currentNode))
+        {
+            settled.insert(currentNode);
+            if (pending.isEmpty())
+                break;
+        }
+
+        if (visited.contains(currentNode)
+            || currentCost > costs[currentNode])
+        {
+            continue;
+        }
+        visited.insert(currentNode);
+
+        for (const QPair<T, float> &edge :
+             getOutgoingEdges(currentNode))
+        {
+            T neighborId = edge.first;
+            if (visited.contains(neighborId))
+            {
+                continue;
+            }
+
+            float edgeCost = calculateEdgeCost(
+                currentNode, neighborId, optimizeFor);
+            float totalCost = costs[currentNode] + edgeCost;
+
+            if (totalCost < costs[neighborId])
+            {
+                costs[neighborId]        = totalCost;
+                predecessors[neighborId] = currentNode;
+                pq.append({totalCost, neighborId});
+            }
+        }
+    }
+
+    for (const T &endNodeId : std::as_const(settled))
+    {
+        if (predecessors[endNodeId] == endNodeId
+            && endNodeId != startNodeId)
+        {
+            continue;
+        }
+
+        QVector<T> path;
+        T          current = endNodeId;
+        while (current != startNodeId)
+        {
+            path.prepend(current);
+            current = predecessors[current];
+        }
+        path.prepend(startNodeId);
+        paths[endNodeId] = path;
+    }
+
+    return paths;
+}
+
 template <typename T> void DirectedGraph<T>::clear()
 {
     m_nodeAttributes.clear();
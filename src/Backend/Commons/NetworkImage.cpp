@@ -0,0 +1,676 @@
+#include "NetworkImage.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QSysInfo>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+
+namespace
+{
+
+constexpr int    kDigestSize = 32; // SHA-256
+constexpr qint64 kAlignment  = 8;
+
+/// Columns are written and mapped in host order; the format is
+/// little-endian, so other hosts neither write nor read images.
+bool hostIsLittleEndian()
+{
+    return QSysInfo::ByteOrder == QSysInfo::LittleEndian;
+}
+
+qint64 aligned(qint64 pos)
+{
+    return (pos + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+class ImageWriter
+{
+public:
+    template <typename T> void value(T v)
+    {
+        m_bytes.append(reinterpret_cast<const char *>(&v), sizeof(T));
+    }
+
+    void bytes(const QByteArray &data) { m_bytes.append(data); }
+
+    template <typename T> void column(const QVector<T> &values)
+    {
+        m_bytes.append(reinterpret_cast<const char *>(values.constData()),
+                       values.size() * static_cast<qsizetype>(sizeof(T)));
+        align();
+    }
+
+    void align()
+    {
+        m_bytes.append(aligned(m_bytes.size()) - m_bytes.size(), '\0');
+    }
+
+    QByteArray take() { return std::move(m_bytes); }
+
+private:
+    QByteArray m_bytes;
+};
+
+class ImageReader
+{
+public:
+    ImageReader(const uchar *data, qint64 size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    bool ok() const { return m_ok; }
+
+    template <typename T> T value()
+    {
+        T v{};
+        if (!reserve(sizeof(T)))
+            return v;
+        std::memcpy(&v, m_data + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return v;
+    }
+
+    QByteArray bytes(qint64 count)
+    {
+        if (!reserve(count))
+            return QByteArray();
+        const QByteArray out(reinterpret_cast<const char *>(m_data + m_pos),
+                             static_cast<qsizetype>(count));
+        m_pos += count;
+        return out;
+    }
+
+    /// Pointer to @p count values of T in place; the cursor then moves
+    /// to the next 8-byte boundary.
+    template <typename T> const T *column(qint64 count)
+    {
+        if (count < 0 || !reserve(count * static_cast<qint64>(sizeof(T))))
+            return nullptr;
+        const T *out = reinterpret_cast<const T *>(m_data + m_pos);
+        m_pos += count * static_cast<qint64>(sizeof(T));
+        align();
+        return out;
+    }
+
+    void align() { m_pos = std::min(aligned(m_pos), m_size); }
+
+private:
+    bool reserve(qint64 count)
+    {
+        if (!m_ok || count < 0 || count > m_size - m_pos)
+            m_ok = false;
+        return m_ok;
+    }
+
+    const uchar *m_data;
+    qint64       m_size;
+    qint64       m_pos = 0;
+    bool         m_ok  = true;
+};
+
+struct Registry
+{
+    QMutex                                             mutex;
+    QHash<QString, std::weak_ptr<const NetworkImage>> images;
+};
+
+Registry &registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+} // namespace
+
+void NetworkImage::Builder::setUnitScales(double metresPerLengthUnit,
+                                          double secondsPerTimeUnit)
+{
+    m_metresPerLengthUnit = metresPerLengthUnit;
+    m_secondsPerTimeUnit  = secondsPerTimeUnit;
+}
+
+void NetworkImage::Builder::addNode(int id, double x, double y)
+{
+    m_nodeIds.append(id);
+    m_nodeX.append(x);
+    m_nodeY.append(y);
+}
+
+void NetworkImage::Builder::addLink(int id, int fromNodeId, int toNodeId,
+                                    double length, double speed)
+{
+    m_linkIds.append(id);
+    m_linkFrom.append(fromNodeId);
+    m_linkTo.append(toNodeId);
+    m_linkLength.append(length);
+    m_linkSpeed.append(speed);
+}
+
+void NetworkImage::Builder::addEdge(int fromNodeId, int toNodeId,
+                                    float weight, float speed, int linkId,
+                                    double length, double time)
+{
+    m_edges.append(
+        Edge{fromNodeId, toNodeId, weight, speed, linkId, length, time});
+}
+
+void NetworkImage::Builder::addAttribute(Scope scope, const QString &name,
+                                         const QVector<double> &values)
+{
+    m_attributes.append(Attribute{scope, name, values});
+}
+
+QByteArray NetworkImage::Builder::serialize(const QByteArray &digest,
+                                            QString          *error) const
+{
+    auto fail = [error](const QString &why) {
+        if (error) *error = why;
+        return QByteArray();
+    };
+    if (!hostIsLittleEndian())
+        return fail(QStringLiteral("big-endian host"));
+    if (digest.size() != kDigestSize)
+        return fail(QStringLiteral("digest must be %1 bytes")
+                        .arg(kDigestSize));
+
+    // Nodes in ascending id order so lookups are a binary search.
+    const int    nodeCount = static_cast<int>(m_nodeIds.size());
+    QVector<int> order(nodeCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](int a, int b) {
+        return m_nodeIds.at(a) < m_nodeIds.at(b);
+    });
+    QVector<qint32>   nodeIds(nodeCount);
+    QVector<double>   nodeX(nodeCount), nodeY(nodeCount);
+    QHash<int, int>   indexOfNode;
+    QVector<int>      permutation(nodeCount);
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        const int from = order.at(i);
+        nodeIds[i]     = m_nodeIds.at(from);
+        nodeX[i]       = m_nodeX.at(from);
+        nodeY[i]       = m_nodeY.at(from);
+        permutation[i] = from;
+        if (i > 0 && nodeIds.at(i) == nodeIds.at(i - 1))
+            return fail(QStringLiteral("duplicate node %1")
+                            .arg(nodeIds.at(i)));
+        indexOfNode.insert(nodeIds.at(i), i);
+    }
+
+    const int       linkCount = static_cast<int>(m_linkIds.size());
+    QVector<qint32> linkFrom(linkCount), linkTo(linkCount);
+    QHash<int, int> indexOfLink; // first link with each id
+    for (int i = 0; i < linkCount; ++i)
+    {
+        linkFrom[i] = indexOfNode.value(m_linkFrom.at(i), -1);
+        linkTo[i]   = indexOfNode.value(m_linkTo.at(i), -1);
+        if (linkFrom.at(i) < 0 || linkTo.at(i) < 0)
+            return fail(QStringLiteral("link %1 references an unknown node")
+                            .arg(m_linkIds.at(i)));
+        if (!indexOfLink.contains(m_linkIds.at(i)))
+            indexOfLink.insert(m_linkIds.at(i), i);
+    }
+
+    struct IndexedEdge
+    {
+        int         from = 0;
+        int         to   = 0;
+        const Edge *edge = nullptr;
+    };
+    QVector<IndexedEdge> indexed;
+    indexed.reserve(m_edges.size());
+    for (const Edge &edge : m_edges)
+    {
+        const int from = indexOfNode.value(edge.from, -1);
+        const int to   = indexOfNode.value(edge.to, -1);
+        if (from < 0 || to < 0)
+            return fail(QStringLiteral("edge %1 -> %2 references an "
+                                       "unknown node")
+                            .arg(edge.from)
+                            .arg(edge.to));
+        indexed.append(IndexedEdge{from, to, &edge});
+    }
+    std::stable_sort(indexed.begin(), indexed.end(),
+                     [](const IndexedEdge &a, const IndexedEdge &b) {
+                         return a.from != b.from ? a.from < b.from
+                                                 : a.to < b.to;
+                     });
+    // A graph holds one edge per node pair; like DirectedGraph::addEdge
+    // the last one added wins.
+    QVector<IndexedEdge> edges;
+    edges.reserve(indexed.size());
+    for (const IndexedEdge &edge : std::as_const(indexed))
+    {
+        if (!edges.isEmpty() && edges.constLast().from == edge.from
+            && edges.constLast().to == edge.to)
+            edges.last() = edge;
+        else
+            edges.append(edge);
+    }
+
+    const int        edgeCount = static_cast<int>(edges.size());
+    QVector<quint32> edgeOffset(nodeCount + 1, 0);
+    QVector<qint32>  edgeTarget(edgeCount), edgeLink(edgeCount);
+    QVector<float>   edgeWeight(edgeCount), edgeSpeed(edgeCount);
+    QVector<double>  edgeLength(edgeCount), edgeTime(edgeCount);
+    for (int i = 0; i < edgeCount; ++i)
+    {
+        const IndexedEdge &edge = edges.at(i);
+        ++edgeOffset[edge.from + 1];
+        edgeTarget[i] = edge.to;
+        edgeLink[i]   = edge.edge->linkId < 0
+                            ? -1
+                            : indexOfLink.value(edge.edge->linkId, -1);
+        edgeWeight[i] = edge.edge->weight;
+        edgeSpeed[i]  = edge.edge->speed;
+        edgeLength[i] = edge.edge->length;
+        edgeTime[i]   = edge.edge->time;
+    }
+    std::partial_sum(edgeOffset.begin(), edgeOffset.end(),
+                     edgeOffset.begin());
+
+    ImageWriter out;
+    out.value(kMagic);
+    out.value(kFormatVersion);
+    out.value(static_cast<quint16>(0));
+    out.bytes(digest);
+    out.value(m_metresPerLengthUnit);
+    out.value(m_secondsPerTimeUnit);
+    out.value(static_cast<quint32>(nodeCount));
+    out.value(static_cast<quint32>(linkCount));
+    out.value(static_cast<quint32>(edgeCount));
+    out.value(static_cast<quint32>(m_attributes.size()));
+    for (const Attribute &attribute : m_attributes)
+    {
+        const int expected =
+            attribute.scope == Scope::Node ? nodeCount : linkCount;
+        if (attribute.values.size() != expected)
+            return fail(QStringLiteral("attribute '%1' has %2 values, "
+                                       "expected %3")
+                            .arg(attribute.name)
+                            .arg(attribute.values.size())
+                            .arg(expected));
+        const QByteArray name = attribute.name.toUtf8();
+        out.value(static_cast<quint8>(attribute.scope));
+        out.value(static_cast<quint8>(0));
+        out.value(static_cast<quint16>(0));
+        out.value(static_cast<quint32>(name.size()));
+        out.bytes(name);
+        out.align();
+    }
+
+    out.column(nodeX);
+    out.column(nodeY);
+    out.column(m_linkLength);
+    out.column(m_linkSpeed);
+    out.column(edgeLength);
+    out.column(edgeTime);
+    for (const Attribute &attribute : m_attributes)
+    {
+        if (attribute.scope != Scope::Node)
+        {
+            out.column(attribute.values);
+            continue;
+        }
+        QVector<double> sorted(nodeCount);
+        for (int i = 0; i < nodeCount; ++i)
+            sorted[i] = attribute.values.at(permutation.at(i));
+        out.column(sorted);
+    }
+    out.column(edgeWeight);
+    out.column(edgeSpeed);
+    out.column(nodeIds);
+    out.column(m_linkIds);
+    out.column(linkFrom);
+    out.column(linkTo);
+    out.column(edgeTarget);
+    out.column(edgeLink);
+    out.column(edgeOffset);
+    return out.take();
+}
+
+bool NetworkImage::store(const QString &path, const Builder &builder,
+                         const QByteArray &digest, QString *error)
+{
+    const QByteArray bytes = builder.serialize(digest, error);
+    if (bytes.isEmpty())
+        return false;
+
+    // QSaveFile renames over the old file, so mappings of a previous
+    // image stay valid for whoever still holds them.
+    QSaveFile out(path);
+    if (!out.open(QIODevice::WriteOnly)
+        || out.write(bytes) != bytes.size() || !out.commit())
+    {
+        if (error) *error = out.errorString();
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<const NetworkImage>
+NetworkImage::open(const QString &path, const QByteArray &digest,
+                   QString *reason)
+{
+    auto miss = [reason](const QString &why) {
+        if (reason) *reason = why;
+        return std::shared_ptr<const NetworkImage>();
+    };
+    if (!hostIsLittleEndian())
+        return miss(QStringLiteral("big-endian host"));
+
+    Registry    &shared = registry();
+    QMutexLocker locker(&shared.mutex);
+    if (auto live = shared.images.value(path).lock())
+    {
+        if (live->digest() == digest)
+            return live;
+    }
+
+    std::shared_ptr<NetworkImage> image(new NetworkImage);
+    image->m_file.setFileName(path);
+    if (!image->m_file.exists())
+        return miss(QStringLiteral("no image"));
+    if (!image->m_file.open(QIODevice::ReadOnly))
+        return miss(image->m_file.errorString());
+    const qint64 size   = image->m_file.size();
+    const uchar *mapped = size > 0 ? image->m_file.map(0, size) : nullptr;
+    if (!mapped)
+        return miss(QStringLiteral("cannot map %1").arg(path));
+    if (!image->bind(mapped, size, reason))
+        return nullptr;
+    if (image->digest() != digest)
+        return miss(QStringLiteral("inputs changed"));
+
+    shared.images.insert(path, image);
+    return image;
+}
+
+NetworkImage::~NetworkImage()
+{
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+}
+
+QByteArray NetworkImage::digest() const
+{
+    // The digest follows magic, version and the reserved field.
+    return QByteArray::fromRawData(
+        reinterpret_cast<const char *>(m_data) + 8, kDigestSize);
+}
+
+bool NetworkImage::bind(const uchar *data, qint64 size, QString *reason)
+{
+    auto fail = [reason](const QString &why) {
+        if (reason) *reason = why;
+        return false;
+    };
+    m_data = data;
+    m_size = size;
+
+    ImageReader in(data, size);
+    const quint32 magic  = in.value<quint32>();
+    const quint16 format = in.value<quint16>();
+    in.value<quint16>();
+    in.bytes(kDigestSize);
+    m_metresPerLengthUnit         = in.value<double>();
+    m_secondsPerTimeUnit          = in.value<double>();
+    const quint32 nodeCount       = in.value<quint32>();
+    const quint32 linkCount       = in.value<quint32>();
+    const quint32 edgeCount       = in.value<quint32>();
+    const quint32 attributeCount  = in.value<quint32>();
+    if (!in.ok() || magic != kMagic || format != kFormatVersion)
+        return fail(QStringLiteral("incompatible image header"));
+    if (nodeCount > static_cast<quint32>(std::numeric_limits<int>::max())
+        || linkCount > static_cast<quint32>(std::numeric_limits<int>::max())
+        || edgeCount > static_cast<quint32>(std::numeric_limits<int>::max()))
+        return fail(QStringLiteral("image too large"));
+    m_nodeCount = static_cast<int>(nodeCount);
+    m_linkCount = static_cast<int>(linkCount);
+    m_edgeCount = static_cast<int>(edgeCount);
+
+    for (quint32 i = 0; i < attributeCount && in.ok(); ++i)
+    {
+        AttributeColumn column;
+        const quint8 scope = in.value<quint8>();
+        in.value<quint8>();
+        in.value<quint16>();
+        const quint32 nameLength = in.value<quint32>();
+        column.name  = QString::fromUtf8(in.bytes(nameLength));
+        column.scope = static_cast<Scope>(scope);
+        in.align();
+        if (scope > static_cast<quint8>(Scope::Link))
+            return fail(QStringLiteral("unknown attribute scope"));
+        m_attributes.append(column);
+    }
+
+    m_nodeX      = in.column<double>(m_nodeCount);
+    m_nodeY      = in.column<double>(m_nodeCount);
+    m_linkLength = in.column<double>(m_linkCount);
+    m_linkSpeed  = in.column<double>(m_linkCount);
+    m_edgeLength = in.column<double>(m_edgeCount);
+    m_edgeTime   = in.column<double>(m_edgeCount);
+    for (AttributeColumn &column : m_attributes)
+        column.values = in.column<double>(
+            column.scope == Scope::Node ? m_nodeCount : m_linkCount);
+    m_edgeWeight = in.column<float>(m_edgeCount);
+    m_edgeSpeed  = in.column<float>(m_edgeCount);
+    m_nodeId     = in.column<qint32>(m_nodeCount);
+    m_linkId     = in.column<qint32>(m_linkCount);
+    m_linkFrom   = in.column<qint32>(m_linkCount);
+    m_linkTo     = in.column<qint32>(m_linkCount);
+    m_edgeTarget = in.column<qint32>(m_edgeCount);
+    m_edgeLink   = in.column<qint32>(m_edgeCount);
+    m_edgeOffset = in.column<quint32>(qint64(m_nodeCount) + 1);
+    if (!in.ok())
+        return fail(QStringLiteral("truncated image"));
+
+    // Everything below is trusted by the accessors and the search.
+    for (int i = 1; i < m_nodeCount; ++i)
+        if (m_nodeId[i] <= m_nodeId[i - 1])
+            return fail(QStringLiteral("node ids not ascending"));
+    for (int i = 0; i < m_linkCount; ++i)
+        if (m_linkFrom[i] < 0 || m_linkFrom[i] >= m_nodeCount
+            || m_linkTo[i] < 0 || m_linkTo[i] >= m_nodeCount)
+            return fail(QStringLiteral("link endpoint out of range"));
+    if (m_edgeOffset[0] != 0
+        || m_edgeOffset[m_nodeCount] != static_cast<quint32>(m_edgeCount))
+        return fail(QStringLiteral("corrupt edge offsets"));
+    for (int i = 0; i < m_nodeCount; ++i)
+        if (m_edgeOffset[i + 1] < m_edgeOffset[i])
+            return fail(QStringLiteral("corrupt edge offsets"));
+    for (int i = 0; i < m_edgeCount; ++i)
+        if (m_edgeTarget[i] < 0 || m_edgeTarget[i] >= m_nodeCount
+            || m_edgeLink[i] < -1 || m_edgeLink[i] >= m_linkCount)
+            return fail(QStringLiteral("edge out of range"));
+    return true;
+}
+
+int NetworkImage::nodeIndex(int id) const
+{
+    const qint32 *end = m_nodeId + m_nodeCount;
+    const qint32 *it  = std::lower_bound(m_nodeId, end, id);
+    return it != end && *it == id ? static_cast<int>(it - m_nodeId) : -1;
+}
+
+QStringList NetworkImage::attributeNames(Scope scope) const
+{
+    QStringList names;
+    for (const AttributeColumn &column : m_attributes)
+        if (column.scope == scope)
+            names.append(column.name);
+    return names;
+}
+
+const double *NetworkImage::attribute(Scope          scope,
+                                      const QString &name) const
+{
+    for (const AttributeColumn &column : m_attributes)
+        if (column.scope == scope && column.name == name)
+            return column.values;
+    return nullptr;
+}
+
+ShortestPathResult NetworkImage::findShortestPath(int    startNodeId,
+                                                  int    endNodeId,
+                                                  Metric metric) const
+{
+    return findShortestPaths(startNodeId, {endNodeId}, metric)
+        .value(endNodeId);
+}
+
+QMap<int, ShortestPathResult>
+NetworkImage::findShortestPaths(int startNodeId,
+                                const QVector<int> &endNodeIds,
+                                Metric              metric) const
+{
+    QMap<int, ShortestPathResult> results;
+    QVector<char> pending(m_nodeCount, 0);
+    int           pendingCount = 0;
+    for (int endNodeId : endNodeIds)
+    {
+        results.insert(endNodeId, pathResultFor({}, metric));
+        const int index = nodeIndex(endNodeId);
+        if (index >= 0 && !pending.at(index))
+        {
+            pending[index] = 1;
+            ++pendingCount;
+        }
+    }
+    const int start = nodeIndex(startNodeId);
+    if (start < 0 || pendingCount == 0)
+        return results;
+
+    // Same search as DirectedGraph::findShortestPaths: float costs,
+    // neighbours in ascending id order, and among equal costs the entry
+    // queued first is expanded first, so ties break identically.
+    struct Entry
+    {
+        float   cost;
+        quint64 sequence;
+        int     node;
+    };
+    struct Later
+    {
+        bool operator()(const Entry &a, const Entry &b) const
+        {
+            return a.cost != b.cost ? a.cost > b.cost
+                                    : a.sequence > b.sequence;
+        }
+    };
+
+    QVector<float> costs(m_nodeCount,
+                         std::numeric_limits<float>::infinity());
+    QVector<int>   predecessors(m_nodeCount);
+    std::iota(predecessors.begin(), predecessors.end(), 0);
+    QVector<char>  visited(m_nodeCount, 0);
+    QVector<int>   settled;
+    std::priority_queue<Entry, std::vector<Entry>, Later> queue;
+    quint64 sequence = 0;
+    costs[start]     = 0.0f;
+    queue.push({0.0f, sequence++, start});
+
+    while (!queue.empty() && pendingCount > 0)
+    {
+        const Entry current = queue.top();
+        queue.pop();
+        if (pending.at(current.node))
+        {
+            pending[current.node] = 0;
+            settled.append(current.node);
+            if (--pendingCount == 0)
+                break;
+        }
+        if (visited.at(current.node)
+            || current.cost > costs.at(current.node))
+            continue;
+        visited[current.node] = 1;
+
+        for (int edge = edgeBegin(current.node);
+             edge < edgeEnd(current.node); ++edge)
+        {
+            const int neighbour = m_edgeTarget[edge];
+            if (visited.at(neighbour))
+                continue;
+            const float weight = m_edgeWeight[edge];
+            const float edgeCost =
+                metric == Metric::Time && m_edgeSpeed[edge] > 0.0f
+                    ? weight / m_edgeSpeed[edge]
+                    : weight;
+            const float total = costs.at(current.node) + edgeCost;
+            if (total < costs.at(neighbour))
+            {
+                costs[neighbour]        = total;
+                predecessors[neighbour] = current.node;
+                queue.push({total, sequence++, neighbour});
+            }
+        }
+    }
+
+    for (int end : std::as_const(settled))
+    {
+        if (predecessors.at(end) == end && end != start)
+            continue;
+        QVector<int> path;
+        for (int node = end; node != start; node = predecessors.at(node))
+            path.append(node);
+        path.append(start);
+        std::reverse(path.begin(), path.end());
+        results.insert(m_nodeId[end], pathResultFor(path, metric));
+    }
+    return results;
+}
+
+ShortestPathResult
+NetworkImage::pathResultFor(const QVector<int> &pathIndices,
+                            Metric              metric) const
+{
+    ShortestPathResult result;
+    result.optimizationCriterion = metric == Metric::Time
+                                       ? QStringLiteral("time")
+                                       : QStringLiteral("distance");
+    if (pathIndices.isEmpty())
+        return result;
+
+    double length = 0.0;
+    double time   = 0.0;
+    result.pathNodes.reserve(pathIndices.size());
+    for (int i = 0; i < pathIndices.size(); ++i)
+    {
+        result.pathNodes.append(m_nodeId[pathIndices.at(i)]);
+        if (i == 0)
+            continue;
+        const qint32 *first = m_edgeTarget + edgeBegin(pathIndices.at(i - 1));
+        const qint32 *last  = m_edgeTarget + edgeEnd(pathIndices.at(i - 1));
+        const qint32 *it    = std::lower_bound(first, last, pathIndices.at(i));
+        if (it == last || *it != pathIndices.at(i))
+            continue;
+        const int edge = static_cast<int>(it - m_edgeTarget);
+        if (m_edgeLink[edge] < 0)
+            continue;
+        result.pathLinks.append(m_linkId[m_edgeLink[edge]]);
+        length += m_edgeLength[edge];
+        time += m_edgeTime[edge];
+    }
+    result.setTotalLength(Units::meters(length * m_metresPerLengthUnit));
+    result.setMinTravelTime(Units::seconds(time * m_secondsPerTimeUnit));
+    return result;
+}
+
+} // namespace Backend
+} // namespace CargoNetSim
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "Backend/Commons/ShortestPathResult.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <memory>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+
+/**
+ * @brief Immutable, memory-mapped snapshot of a transport network.
+ *
+ * An image holds the node and link tables of one network as flat
+ * columns plus its routing graph in CSR form (per-node offsets into
+ * sorted edge arrays). It is written once by a Builder and then only
+ * ever read straight from a read-only file mapping, so every runtime
+ * in a process — and every process on a host — that opens the same
+ * file shares one physical copy through the page cache. open() keeps
+ * one live mapping per file in a process-wide registry.
+ *
+ * findShortestPath()/findShortestPaths() run on the CSR graph and
+ * return exactly what the owning network's DirectedGraph search
+ * would: the builder records the graph's edge weights and search
+ * speeds, and the per-edge link id, length and travel time the
+ * network itself reports for a path.
+ *
+ * File layout (little-endian, every column 8-byte aligned):
+ * @code
+ * u32 magic 'CNSI' (0x49534E43), u16 format version, u16 reserved,
+ * 32 × u8 sha256, f64 metresPerLengthUnit, f64 secondsPerTimeUnit,
+ * u32 nodeCount, u32 linkCount, u32 edgeCount, u32 attributeCount,
+ * attributeCount × { u8 scope, 3 × u8 pad, u32 nameLen, name (pad 8) },
+ * f64 nodeX[n], f64 nodeY[n],
+ * f64 linkLength[m], f64 linkSpeed[m],
+ * f64 edgeLength[e], f64 edgeTime[e],
+ * attributeCount × f64 column[n or m],
+ * f32 edgeWeight[e], f32 edgeSpeed[e],
+ * i32 nodeId[n] (ascending), i32 linkId[m], i32 linkFrom[m],
+ * i32 linkTo[m], i32 edgeTarget[e], i32 edgeLink[e], u32 edgeOffset[n+1]
+ * @endcode
+ * Lengths and times are in the network's native units; the two header
+ * scales convert them to canonical metres and seconds. linkFrom,
+ * linkTo and edgeTarget are node indices; edgeLink is a link index or
+ * -1 when the network reports no link for that edge.
+ */
+class NetworkImage
+{
+public:
+    static constexpr quint32 kMagic         = 0x49534E43u; // "CNSI"
+    static constexpr quint16 kFormatVersion = 1;
+
+    enum class Metric : quint8
+    {
+        Distance = 0,
+        Time     = 1
+    };
+
+    enum class Scope : quint8
+    {
+        Node = 0,
+        Link = 1
+    };
+
+    /// Collects a network's tables in memory and serializes them.
+    class Builder
+    {
+    public:
+        /// Scales from the network's native length and time units
+        /// to metres and seconds (default 1, 1).
+        void setUnitScales(double metresPerLengthUnit,
+                           double secondsPerTimeUnit);
+
+        void addNode(int id, double x, double y);
+        void addLink(int id, int fromNodeId, int toNodeId,
+                     double length, double speed);
+
+        /// One directed graph edge. @p weight and @p speed are the
+        /// search inputs (speed <= 0 means "no speed"; time search
+        /// then falls back to the weight). @p linkId, @p length and
+        /// @p time are what a path across this edge reports; pass
+        /// @p linkId -1 when no link is reported.
+        void addEdge(int fromNodeId, int toNodeId, float weight,
+                     float speed, int linkId, double length,
+                     double time);
+
+        void addAttribute(Scope scope, const QString &name,
+                          const QVector<double> &values);
+
+        /// Serialized image, or empty (with @p error) when an edge or
+        /// link names an unknown node or a column has the wrong size.
+        QByteArray serialize(const QByteArray &digest,
+                             QString          *error = nullptr) const;
+
+    private:
+        struct Edge
+        {
+            int    from   = 0;
+            int    to     = 0;
+            float  weight = 0.0f;
+            float  speed  = 0.0f;
+            int    linkId = -1;
+            double length = 0.0;
+            double time   = 0.0;
+        };
+
+        struct Attribute
+        {
+            Scope           scope = Scope::Node;
+            QString         name;
+            QVector<double> values;
+        };
+
+        double             m_metresPerLengthUnit = 1.0;
+        double             m_secondsPerTimeUnit  = 1.0;
+        QVector<int>       m_nodeIds;
+        QVector<double>    m_nodeX;
+        QVector<double>    m_nodeY;
+        QVector<int>       m_linkIds;
+        QVector<int>       m_linkFrom;
+        QVector<int>       m_linkTo;
+        QVector<double>    m_linkLength;
+        QVector<double>    m_linkSpeed;
+        QVector<Edge>      m_edges;
+        QVector<Attribute> m_attributes;
+    };
+
+    /// Writes @p builder to @p path atomically.
+    static bool store(const QString &path, const Builder &builder,
+                      const QByteArray &digest, QString *error = nullptr);
+
+    /// Maps @p path, or returns the mapping another caller already
+    /// holds. Returns nullptr on a missing, incompatible or corrupt file
+    /// and when the stored digest differs from @p digest; @p reason (if
+    /// given) receives a short explanation for logging.
+    static std::shared_ptr<const NetworkImage>
+    open(const QString &path, const QByteArray &digest,
+         QString *reason = nullptr);
+
+    ~NetworkImage();
+
+    NetworkImage(const NetworkImage &)            = delete;
+    NetworkImage &operator=(const NetworkImage &) = delete;
+
+    QString    filePath() const { return m_file.fileName(); }
+    QByteArray digest() const;
+
+    int nodeCount() const { return m_nodeCount; }
+    int linkCount() const { return m_linkCount; }
+    int edgeCount() const { return m_edgeCount; }
+
+    int    nodeId(int index) const { return m_nodeId[index]; }
+    double nodeX(int index) const { return m_nodeX[index]; }
+    double nodeY(int index) const { return m_nodeY[index]; }
+    /// Index of node @p id, or -1.
+    int  nodeIndex(int id) const;
+    bool hasNode(int id) const { return nodeIndex(id) >= 0; }
+
+    int    linkId(int index) const { return m_linkId[index]; }
+    int    linkFromIndex(int index) const { return m_linkFrom[index]; }
+    int    linkToIndex(int index) const { return m_linkTo[index]; }
+    double linkLength(int index) const { return m_linkLength[index]; }
+    double linkSpeed(int index) const { return m_linkSpeed[index]; }
+
+    /// Outgoing edges of node @p index are [edgeBegin, edgeEnd), sorted
+    /// by target node.
+    int edgeBegin(int index) const
+    {
+        return static_cast<int>(m_edgeOffset[index]);
+    }
+    int edgeEnd(int index) const
+    {
+        return static_cast<int>(m_edgeOffset[index + 1]);
+    }
+    int edgeTarget(int edge) const { return m_edgeTarget[edge]; }
+    int edgeLink(int edge) const { return m_edgeLink[edge]; }
+
+    QStringList attributeNames(Scope scope) const;
+    /// Column @p name of @p scope (nodeCount or linkCount values), or
+    /// nullptr.
+    const double *attribute(Scope scope, const QString &name) const;
+
+    ShortestPathResult findShortestPath(int startNodeId, int endNodeId,
+                                        Metric metric) const;
+
+    /// One single-source search; each result equals
+    /// findShortestPath(startNodeId, target, metric). Every requested
+    /// target gets an entry. Safe to call from any thread.
+    QMap<int, ShortestPathResult>
+    findShortestPaths(int startNodeId, const QVector<int> &endNodeIds,
+                      Metric metric) const;
+
+private:
+    NetworkImage() = default;
+
+    bool bind(const uchar *data, qint64 size, QString *reason);
+    ShortestPathResult pathResultFor(const QVector<int> &pathIndices,
+                                     Metric              metric) const;
+
+    QFile        m_file;
+    const uchar *m_data = nullptr;
+    qint64       m_size = 0;
+
+    double m_metresPerLengthUnit = 1.0;
+    double m_secondsPerTimeUnit  = 1.0;
+    int    m_nodeCount           = 0;
+    int    m_linkCount           = 0;
+    int    m_edgeCount           = 0;
+
+    const double  *m_nodeX      = nullptr;
+    const double  *m_nodeY      = nullptr;
+    const double  *m_linkLength = nullptr;
+    const double  *m_linkSpeed  = nullptr;
+    const double  *m_edgeLength = nullptr;
+    const double  *m_edgeTime   = nullptr;
+    const float   *m_edgeWeight = nullptr;
+    const float   *m_edgeSpeed  = nullptr;
+    const qint32  *m_nodeId     = nullptr;
+    const qint32  *m_linkId     = nullptr;
+    const qint32  *m_linkFrom   = nullptr;
+    const qint32  *m_linkTo     = nullptr;
+    const qint32  *m_edgeTarget = nullptr;
+    const qint32  *m_edgeLink   = nullptr;
+    const quint32 *m_edgeOffset = nullptr;
+
+    struct AttributeColumn
+    {
+        Scope         scope = Scope::Node;
+        QString       name;
+        const double *values = nullptr;
+    };
+    QVector<AttributeColumn> m_attributes;
+};
+
+} // namespace Backend
+} // namespace CargoNetSim
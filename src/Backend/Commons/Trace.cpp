@@ -0,0 +1,455 @@
+#include "Trace.h"
+
+#include "LogCategories.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QThread>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Trace
+{
+
+namespace
+{
+
+struct Span
+{
+    const char *name     = nullptr;
+    Category    category = Messaging;
+    qint64      startNs  = 0;
+    qint64      endNs    = 0;
+    quint8      detailLength = 0;
+    char        detail[kDetailCapacity];
+};
+
+/// Spare ring buffers kept for threads started later; more are freed.
+constexpr std::size_t kMaxSpareRings = 4;
+
+/// Bumped by start(). A ring whose epoch is older holds spans from an
+/// earlier session and is reset by its own thread on the next record.
+std::atomic<quint64> g_epoch{1};
+
+/// One live thread's ring. Only the owning thread writes `spans`,
+/// `written` and `epoch`; the exporter copies them with `snapshot`.
+struct ThreadRing
+{
+    int                     tid = 0;
+    QString                 threadName;
+    std::unique_ptr<Span[]> spans;
+    std::atomic<quint64>    written{0};
+    std::atomic<quint64>    epoch{0};
+};
+
+/// The spans of a thread that exited, trimmed to what it recorded.
+struct RetiredSpans
+{
+    int               tid = 0;
+    QString           threadName;
+    std::vector<Span> spans; ///< oldest first
+    quint64           overwritten = 0;
+};
+
+struct Registry
+{
+    QMutex                                   mutex;
+    std::vector<std::unique_ptr<ThreadRing>> rings; // live threads
+    std::vector<RetiredSpans>                retired;
+    std::vector<std::unique_ptr<Span[]>>     spare;
+    int                                      nextTid  = 0;
+    qint64                                   originNs = 0;
+};
+
+Registry &registry()
+{
+    static Registry r;
+    return r;
+}
+
+/// Spans @p ring recorded this session, or 0 for an older session.
+quint64 currentWritten(const ThreadRing &ring)
+{
+    if (ring.epoch.load(std::memory_order_acquire)
+        != g_epoch.load(std::memory_order_acquire))
+        return 0;
+    return ring.written.load(std::memory_order_acquire);
+}
+
+/// Copies the spans @p ring recorded this session, oldest first. The
+/// owning thread may still be recording: afterwards `written` is read
+/// again, and the slots it could have overwritten during the copy are
+/// dropped (paired with the release fence in `detail::record`). The
+/// epoch cannot change meanwhile; start() needs the registry mutex the
+/// caller holds.
+RetiredSpans snapshot(const ThreadRing &ring)
+{
+    RetiredSpans kept;
+    kept.tid        = ring.tid;
+    kept.threadName = ring.threadName;
+    const quint64 written = currentWritten(ring);
+    if (written == 0)
+        return kept;
+
+    const quint64 capacity = static_cast<quint64>(kRingCapacity);
+    quint64       first    = written > capacity ? written - capacity : 0;
+    kept.spans.reserve(static_cast<std::size_t>(written - first));
+    for (quint64 i = first; i < written; ++i)
+        kept.spans.push_back(ring.spans[i % capacity]);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // Span `after` may be half written over the slot of `after - capacity`
+    const quint64 after  = ring.written.load(std::memory_order_relaxed);
+    const quint64 stable = after >= capacity ? after - capacity + 1 : 0;
+    if (stable > first)
+    {
+        const quint64 torn = qMin(stable - first, written - first);
+        kept.spans.erase(kept.spans.begin(),
+                         kept.spans.begin()
+                             + static_cast<std::ptrdiff_t>(torn));
+        first += torn;
+    }
+    kept.overwritten = first;
+    return kept;
+}
+
+/// Keeps spans recorded this session and recycles the ring's buffer.
+/// Caller holds the registry mutex.
+void retireLocked(Registry &r, ThreadRing *ring)
+{
+    RetiredSpans kept = snapshot(*ring);
+    if (!kept.spans.empty())
+        r.retired.push_back(std::move(kept));
+    if (r.spare.size() < kMaxSpareRings)
+        r.spare.push_back(std::move(ring->spans));
+
+    for (auto it = r.rings.begin(); it != r.rings.end(); ++it)
+    {
+        if (it->get() == ring)
+        {
+            r.rings.erase(it);
+            break;
+        }
+    }
+}
+
+/// Owns the calling thread's ring and retires it at thread exit.
+struct RingHandle
+{
+    ThreadRing *ring = nullptr;
+
+    ~RingHandle()
+    {
+        if (!ring)
+            return;
+        Registry    &r = registry();
+        QMutexLocker lock(&r.mutex);
+        retireLocked(r, ring);
+        ring = nullptr;
+    }
+};
+
+thread_local RingHandle t_ring;
+
+ThreadRing *ringForCurrentThread()
+{
+    if (t_ring.ring)
+        return t_ring.ring;
+
+    auto        ring = std::make_unique<ThreadRing>();
+    QThread    *thread = QThread::currentThread();
+    Registry   &r = registry();
+    QMutexLocker lock(&r.mutex);
+    ring->tid = ++r.nextTid;
+    if (!r.spare.empty())
+    {
+        ring->spans = std::move(r.spare.back());
+        r.spare.pop_back();
+    }
+    else
+    {
+        ring->spans.reset(new Span[kRingCapacity]);
+    }
+    if (thread && !thread->objectName().isEmpty())
+        ring->threadName = thread->objectName();
+    else if (QCoreApplication::instance()
+             && thread == QCoreApplication::instance()->thread())
+        ring->threadName = QStringLiteral("main");
+    else
+        ring->threadName = QStringLiteral("thread %1").arg(ring->tid);
+    t_ring.ring = ring.get();
+    r.rings.push_back(std::move(ring));
+    return t_ring.ring;
+}
+
+/// Encodes @p text as UTF-8 into @p out without allocating, stopping
+/// before the first code point that does not fit in @p capacity bytes.
+/// Unpaired surrogates become U+FFFD. Returns the bytes written.
+int encodeUtf8(const QString &text, char *out, int capacity)
+{
+    const QChar *it  = text.constData();
+    const QChar *end = it + text.size();
+    int          length = 0;
+    while (it != end)
+    {
+        char32_t cp = it->unicode();
+        ++it;
+        if (QChar::isHighSurrogate(cp) && it != end
+            && it->isLowSurrogate())
+        {
+            cp = QChar::surrogateToUcs4(static_cast<char16_t>(cp),
+                                        it->unicode());
+            ++it;
+        }
+        else if (QChar::isSurrogate(cp))
+        {
+            cp = 0xFFFD;
+        }
+
+        const int bytes = cp < 0x80      ? 1
+                        : cp < 0x800     ? 2
+                        : cp < 0x10000   ? 3
+                                         : 4;
+        if (length + bytes > capacity)
+            break;
+        auto *p = reinterpret_cast<unsigned char *>(out + length);
+        switch (bytes)
+        {
+        case 1:
+            p[0] = static_cast<unsigned char>(cp);
+            break;
+        case 2:
+            p[0] = static_cast<unsigned char>(0xC0 | (cp >> 6));
+            p[1] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+            break;
+        case 3:
+            p[0] = static_cast<unsigned char>(0xE0 | (cp >> 12));
+            p[1] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+            p[2] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+            break;
+        default:
+            p[0] = static_cast<unsigned char>(0xF0 | (cp >> 18));
+            p[1] = static_cast<unsigned char>(0x80 | ((cp >> 12) & 0x3F));
+            p[2] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+            p[3] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+            break;
+        }
+        length += bytes;
+    }
+    return length;
+}
+
+void appendJsonString(QByteArray &out, const QByteArray &utf8)
+{
+    out.append('"');
+    for (char c : utf8)
+    {
+        switch (c)
+        {
+        case '"':  out.append("\\\""); break;
+        case '\\': out.append("\\\\"); break;
+        case '\n': out.append("\\n");  break;
+        case '\r': out.append("\\r");  break;
+        case '\t': out.append("\\t");  break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                out.append(QByteArray("\\u00")
+                           + QByteArray::number(static_cast<int>(c), 16)
+                                 .rightJustified(2, '0'));
+            else
+                out.append(c);
+        }
+    }
+    out.append('"');
+}
+
+const char *categoryName(Category category)
+{
+    switch (category)
+    {
+    case Messaging: return "messaging";
+    case Execution: return "execution";
+    case Discovery: return "discovery";
+    case Results:   return "results";
+    case Scenario:  return "scenario";
+    }
+    return "other";
+}
+
+/// Microseconds with nanosecond precision, as Chrome expects.
+QByteArray micros(qint64 ns)
+{
+    return QByteArray::number(static_cast<double>(ns) / 1000.0, 'f', 3);
+}
+
+} // namespace
+
+namespace detail
+{
+
+qint64 nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void record(Category category, const char *name, qint64 startNs,
+            qint64 endNs, const QString *detailText)
+{
+    ThreadRing    *ring  = ringForCurrentThread();
+    const quint64  epoch = g_epoch.load(std::memory_order_acquire);
+    if (ring->epoch.load(std::memory_order_relaxed) != epoch)
+    {
+        // First span of a new session; only this thread resets its ring
+        ring->written.store(0, std::memory_order_relaxed);
+        ring->epoch.store(epoch, std::memory_order_release);
+    }
+    const quint64  index = ring->written.load(std::memory_order_relaxed);
+    Span          &span  = ring->spans[index % kRingCapacity];
+    // Orders the publication of `index` before the slot is overwritten,
+    // so a concurrent snapshot() can tell which copies may be torn.
+    std::atomic_thread_fence(std::memory_order_release);
+    span.name     = name;
+    span.category = category;
+    span.startNs  = startNs;
+    span.endNs    = endNs;
+    span.detailLength = 0;
+    if (detailText)
+        span.detailLength = static_cast<quint8>(
+            encodeUtf8(*detailText, span.detail, kDetailCapacity));
+    ring->written.store(index + 1, std::memory_order_release);
+}
+
+} // namespace detail
+
+void start()
+{
+    Registry    &r = registry();
+    QMutexLocker lock(&r.mutex);
+    // Live rings are reset by their own threads when they next record
+    g_epoch.fetch_add(1, std::memory_order_acq_rel);
+    r.retired.clear();
+    r.originNs = detail::nowNs();
+    detail::g_running.store(true, std::memory_order_release);
+    qCInfo(lcInit) << "Trace::start: tracing enabled for categories"
+                   << Qt::hex << CARGONETSIM_TRACE_CATEGORIES;
+}
+
+void stop()
+{
+    detail::g_running.store(false, std::memory_order_release);
+}
+
+int recordedSpanCount()
+{
+    Registry    &r = registry();
+    QMutexLocker lock(&r.mutex);
+    quint64 total = 0;
+    for (const auto &ring : r.rings)
+        total += qMin<quint64>(currentWritten(*ring), kRingCapacity);
+    for (const RetiredSpans &retired : r.retired)
+        total += retired.spans.size();
+    return static_cast<int>(total);
+}
+
+bool writeChromeTrace(const QString &path, QString *error)
+{
+    QSaveFile out(path);
+    if (!out.open(QIODevice::WriteOnly))
+    {
+        if (error)
+            *error = QStringLiteral("Cannot open %1: %2")
+                         .arg(path, out.errorString());
+        return false;
+    }
+
+    Registry    &r = registry();
+    QMutexLocker lock(&r.mutex);
+    const QByteArray pid =
+        QByteArray::number(QCoreApplication::applicationPid());
+
+    QByteArray chunk;
+    chunk.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    auto separator = [&chunk, &first]() {
+        if (!first)
+            chunk.append(",\n");
+        first = false;
+    };
+
+    quint64 exported = 0, overwritten = 0;
+    auto appendThread = [&](const RetiredSpans &thread) {
+        overwritten += thread.overwritten;
+        if (thread.spans.empty())
+            return;
+        const QByteArray tid = QByteArray::number(thread.tid);
+
+        separator();
+        chunk.append("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" + pid
+                     + ",\"tid\":" + tid + ",\"args\":{\"name\":");
+        appendJsonString(chunk, thread.threadName.toUtf8());
+        chunk.append("}}");
+
+        for (const Span &span : thread.spans)
+        {
+            separator();
+            chunk.append("{\"ph\":\"X\",\"name\":");
+            appendJsonString(chunk, QByteArray(span.name));
+            chunk.append(",\"cat\":\"");
+            chunk.append(categoryName(span.category));
+            chunk.append("\",\"pid\":" + pid + ",\"tid\":" + tid
+                         + ",\"ts\":" + micros(span.startNs - r.originNs)
+                         + ",\"dur\":"
+                         + micros(span.endNs - span.startNs));
+            if (span.detailLength > 0)
+            {
+                chunk.append(",\"args\":{\"detail\":");
+                appendJsonString(chunk,
+                                 QByteArray(span.detail, span.detailLength));
+                chunk.append('}');
+            }
+            chunk.append('}');
+            ++exported;
+
+            if (chunk.size() >= (1 << 16))
+            {
+                out.write(chunk);
+                chunk.clear();
+            }
+        }
+    };
+
+    // Live rings are copied first: their threads may still be recording
+    for (const auto &ring : r.rings)
+        appendThread(snapshot(*ring));
+    for (const RetiredSpans &retired : r.retired)
+        appendThread(retired);
+    chunk.append("]}\n");
+    out.write(chunk);
+
+    if (!out.commit())
+    {
+        if (error)
+            *error = QStringLiteral("Cannot write %1: %2")
+                         .arg(path, out.errorString());
+        return false;
+    }
+    qCInfo(lcInit) << "Trace::writeChromeTrace: wrote" << exported
+                   << "span(s) to" << path << "(" << overwritten
+                   << "overwritten by ring wrap-around )";
+    return true;
+}
+
+} // namespace Trace
+} // namespace Backend
+} // namespace CargoNetSim
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+#include <atomic>
+#include <utility>
+
+/// Bitmask of trace categories compiled in. Spans in a category whose
+/// bit is clear compile to nothing. Set via the CARGONET_TRACE_CATEGORIES
+/// CMake cache variable (0 strips every span).
+#ifndef CARGONETSIM_TRACE_CATEGORIES
+#define CARGONETSIM_TRACE_CATEGORIES 0xFFFFFFFFu
+#endif
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+
+// Low-overhead span tracing with Chrome trace export.
+//
+// Each thread records completed spans into its own fixed-size ring
+// buffer: the owning thread is the only writer, so recording takes no
+// lock and allocates nothing after the thread's first span. When the
+// ring wraps, the oldest spans are overwritten. When a thread exits,
+// the spans it recorded are kept at their actual size and its buffer is
+// recycled for the next new thread. `writeChromeTrace`
+// merges every ring into a Chrome/Perfetto "traceEvents" JSON file. It
+// copies live rings while their threads may still record, dropping the
+// slots overwritten during the copy; call it after `stop()` once traced
+// work has finished for a complete trace.
+//
+// While tracing is stopped a span costs one relaxed atomic load. Spans
+// are added with CNS_TRACE_SCOPE / CNS_TRACE_SCOPE_DETAIL; the span name
+// must be a string literal (it is stored by pointer).
+namespace Trace
+{
+
+enum Category : quint32
+{
+    Messaging = 1u << 0, ///< Client command round trips
+    Execution = 1u << 1, ///< Session stepping, wave building
+    Discovery = 1u << 2, ///< Path discovery and preparation
+    Results   = 1u << 3, ///< Results extraction
+    Scenario  = 1u << 4, ///< Scenario parsing and validation
+};
+
+/// Spans kept per thread before the oldest are overwritten.
+constexpr int kRingCapacity = 1 << 15;
+/// Bytes of per-span detail text kept (UTF-8, cut at a code point).
+constexpr int kDetailCapacity = 47;
+
+namespace detail
+{
+inline std::atomic<bool> g_running{false};
+
+qint64 nowNs();
+void   record(Category category, const char *name, qint64 startNs,
+              qint64 endNs, const QString *detail);
+} // namespace detail
+
+/// Starts a new recording session. Spans from earlier sessions are
+/// dropped; each live ring is reset by its own thread on its next span.
+void start();
+/// Stops recording; rings keep their contents for export.
+void stop();
+
+inline bool isRunning()
+{
+    return detail::g_running.load(std::memory_order_relaxed);
+}
+
+/// Writes every recorded span as Chrome trace JSON
+/// (chrome://tracing, ui.perfetto.dev).
+bool writeChromeTrace(const QString &path, QString *error = nullptr);
+
+/// Spans currently held across all rings.
+int recordedSpanCount();
+
+/// RAII span. The disabled specialization is empty, so spans in
+/// categories compiled out vanish entirely.
+template <bool Compiled>
+class Scope
+{
+public:
+    Scope(Category category, const char *name)
+    {
+        if (isRunning())
+            begin(category, name);
+    }
+
+    /// @p makeDetail (returning QString) runs only while tracing.
+    template <typename DetailFn>
+    Scope(Category category, const char *name, DetailFn &&makeDetail)
+    {
+        if (isRunning())
+        {
+            m_detail = std::forward<DetailFn>(makeDetail)();
+            begin(category, name);
+        }
+    }
+
+    ~Scope()
+    {
+        if (m_name)
+            detail::record(m_category, m_name, m_startNs, detail::nowNs(),
+                           m_detail.isEmpty() ? nullptr : &m_detail);
+    }
+
+    Scope(const Scope &)            = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    void begin(Category category, const char *name)
+    {
+        m_category = category;
+        m_name     = name;
+        m_startNs  = detail::nowNs();
+    }
+
+    Category    m_category = Messaging;
+    const char *m_name     = nullptr;
+    qint64      m_startNs  = 0;
+    QString     m_detail;
+};
+
+template <>
+class Scope<false>
+{
+public:
+    Scope(Category, const char *) {}
+    template <typename DetailFn>
+    Scope(Category, const char *, DetailFn &&)
+    {
+    }
+};
+
+} // namespace Trace
+} // namespace Backend
+} // namespace CargoNetSim
+
+#define CNS_TRACE_CONCAT_INNER(a, b) a##b
+#define CNS_TRACE_CONCAT(a, b) CNS_TRACE_CONCAT_INNER(a, b)
+#define CNS_TRACE_COMPILED(category)                                       \
+    ((CARGONETSIM_TRACE_CATEGORIES                                         \
+      & ::CargoNetSim::Backend::Trace::category)                           \
+     != 0)
+
+/// Traces the enclosing scope as @p name in @p category (an unqualified
+/// Trace::Category enumerator, e.g. Execution).
+#define CNS_TRACE_SCOPE(category, name)                                    \
+    ::CargoNetSim::Backend::Trace::Scope<CNS_TRACE_COMPILED(category)>     \
+    CNS_TRACE_CONCAT(cnsTraceScope_, __LINE__)(                            \
+        ::CargoNetSim::Backend::Trace::category, name)
+
+/// As CNS_TRACE_SCOPE, with a QString detail (shown as the span's
+/// "detail" argument) evaluated only while tracing is running.
+#define CNS_TRACE_SCOPE_DETAIL(category, name, detailExpr)                 \
+    ::CargoNetSim::Backend::Trace::Scope<CNS_TRACE_COMPILED(category)>     \
+    CNS_TRACE_CONCAT(cnsTraceScope_, __LINE__)(                            \
+        ::CargoNetSim::Backend::Trace::category, name,                     \
+        [&]() -> QString { return (detailExpr); })
@@ -117,7 +117,15 @@ std::atomic<CargoNetSimController *>
 
 CargoNetSimController::CargoNetSimController(
     Backend::LoggerInterface *logger, QObject *parent)
+    : CargoNetSimController(QString(), logger, parent)
+{
+}
+
+CargoNetSimController::CargoNetSimController(
+    const QString &contextName, Backend::LoggerInterface *logger,
+    QObject *parent)
     : QObject(parent)
+    , m_contextName(contextName)
     , m_truckThread(nullptr)
     , m_shipThread(nullptr)
     , m_trainThread(nullptr)
@@ -145,17 +153,24 @@ CargoNetSimController::CargoNetSimController(
     // Atomically claim the single-instance slot. compare_exchange
     // both asserts s_instance was nullptr AND publishes 'this' in
     // one operation. Release ordering so downstream reads see a
-    // fully-constructed object.
-    CargoNetSimController *expected = nullptr;
-    if (!s_instance.compare_exchange_strong(
-            expected, this, std::memory_order_release,
-            std::memory_order_relaxed))
+    // fully-constructed object. Named contexts live beside the
+    // default instance and never claim the slot.
+    if (m_contextName.isEmpty())
     {
-        qFatal("CargoNetSimController: attempted to construct a "
-               "second instance. Only one may live at a time.");
+        CargoNetSimController *expected = nullptr;
+        if (!s_instance.compare_exchange_strong(
+                expected, this, std::memory_order_release,
+                std::memory_order_relaxed))
+        {
+            qFatal("CargoNetSimController: attempted to construct a "
+                   "second instance. Only one may live at a time.");
+        }
     }
 
-    qCInfo(lcController) << "CargoNetSimController: initializing";
+    qCInfo(lcController) << "CargoNetSimController: initializing"
+                         << (m_contextName.isEmpty()
+                                 ? QStringLiteral("default context")
+                                 : m_contextName);
 
     // Create the NetworkController first
     m_networkController =
@@ -238,7 +253,8 @@ CargoNetSimController::~CargoNetSimController()
     // Release store: pairs with acquire loads in instance() /
     // getInstance(). Any worker thread still running after the
     // 3s wait timeout will see the nullptr with proper ordering.
-    s_instance.store(nullptr, std::memory_order_release);
+    if (m_contextName.isEmpty())
+        s_instance.store(nullptr, std::memory_order_release);
 }
 
 bool CargoNetSimController::initialize(
@@ -446,6 +462,35 @@ QString CargoNetSimController::truckExecutablePath() const
     return m_truckExecutablePath;
 }
 
+QString CargoNetSimController::contextName() const
+{
+    return m_contextName;
+}
+
+bool CargoNetSimController::isDefaultContext() const
+{
+    return m_contextName.isEmpty();
+}
+
+void CargoNetSimController::setNamespacedClients(
+    const QList<Backend::ClientType> &clientTypes)
+{
+    m_namespacedClients = clientTypes;
+}
+
+QList<Backend::ClientType>
+CargoNetSimController::namespacedClients() const
+{
+    return m_namespacedClients;
+}
+
+QString CargoNetSimController::routingNamespaceFor(
+    Backend::ClientType clientType) const
+{
+    return m_namespacedClients.contains(clientType) ? m_contextName
+                                                    : QString();
+}
+
 bool CargoNetSimController::loadConfig()
 {
     return m_configController
@@ -841,6 +886,8 @@ bool CargoNetSimController::initializeTruckClient(
     m_truckManager =
         new Backend::TruckClient::TruckSimulationManager(
             nullptr);
+    m_truckManager->setRoutingNamespace(
+        routingNamespaceFor(Backend::ClientType::TruckClient));
 
     // Move truck manager to truck thread
     m_truckManager->moveToThread(m_truckThread);
@@ -874,6 +921,8 @@ bool CargoNetSimController::initializeShipClient()
     m_shipClient =
         new Backend::ShipClient::ShipSimulationClient(
             nullptr);
+    m_shipClient->setRoutingNamespace(
+        routingNamespaceFor(Backend::ClientType::ShipClient));
     m_shipClient->moveToThread(m_shipThread);
 
     // Connect thread signals
@@ -904,6 +953,8 @@ bool CargoNetSimController::initializeTrainClient()
     m_trainClient =
         new Backend::TrainClient::TrainSimulationClient(
             nullptr);
+    m_trainClient->setRoutingNamespace(
+        routingNamespaceFor(Backend::ClientType::TrainClient));
     m_trainClient->moveToThread(m_trainThread);
 
     // Connect thread signals
@@ -935,6 +986,8 @@ bool CargoNetSimController::initializeTerminalClient()
     // Create terminal client
     m_terminalClient =
         new Backend::TerminalSimulationClient(nullptr);
+    m_terminalClient->setRoutingNamespace(
+        routingNamespaceFor(Backend::ClientType::TerminalClient));
     m_terminalClient->moveToThread(m_terminalThread);
 
     // Connect thread signals
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <QList>
 #include <QMap>
 #include <QObject>
 #include <QString>
@@ -19,6 +20,7 @@
 #include "Backend/Clients/TrainClient/TrainSimulationClient.h"
 #include "Backend/Clients/TruckClient/TruckSimulationClient.h"
 #include "Backend/Clients/TruckClient/TruckSimulationManager.h"
+#include "Backend/Commons/ClientType.h"
 #include "Backend/Controllers/ConfigController.h"
 #include "Backend/Controllers/NetworkController.h"
 #include "Backend/Controllers/RegionDataController.h"
@@ -60,9 +62,28 @@ namespace CargoNetSim
  * synchronization (construction happens-before worker spawn,
  * destruction happens-after worker join).
  *
+ * @par Runtime contexts
+ * Besides the default instance, a process may hold any number of
+ * named runtime contexts (see the contextName constructor). Each
+ * context owns its own client set, client threads, configuration
+ * and network/vehicle stores. The queues and routing keys of the
+ * clients listed by setNamespacedClients() carry the context name, so
+ * those clients never see another context's traffic on a shared
+ * broker. Only the truck simulator can follow a namespace (it is
+ * launched with --amq_namespace), so it is the only client namespaced
+ * by default; the others keep the default keys unless their servers
+ * were started with the same namespace.
+ *
+ * instance() / getInstance() always return the default instance.
+ * Code serving a named context is handed its controller explicitly
+ * (ScenarioRuntime, ScenarioLoadService, BackendBootstrapService,
+ * PreparedPathService, ...); a ScenarioRegistry remembers the
+ * controller it was applied from for the lookups below it.
+ *
  * @par Invariants
- * - Exactly one instance exists at any time; double construction
- *   fires qFatal (release-safe).
+ * - Exactly one default instance exists at any time; double
+ *   construction fires qFatal (release-safe). Named contexts are
+ *   not counted.
  * - Construction and destruction are main-thread only; off-thread
  *   fires qFatal.
  * - instance() returns nullptr before construction and after
@@ -100,6 +121,18 @@ public:
         Backend::LoggerInterface *logger = nullptr,
         QObject                  *parent = nullptr);
 
+    /**
+     * @brief Constructs an independent named runtime context.
+     *
+     * An empty @p contextName constructs the default instance, exactly
+     * like the logger-only constructor. A non-empty name never
+     * registers as the default; @p contextName becomes the routing
+     * namespace of the clients listed by namespacedClients().
+     */
+    CargoNetSimController(const QString            &contextName,
+                          Backend::LoggerInterface *logger,
+                          QObject                  *parent = nullptr);
+
     /**
      * @brief Destructor
      */
@@ -205,6 +238,27 @@ public:
      */
     QString truckExecutablePath() const;
 
+    /**
+     * @brief Name of this runtime context; empty for the default
+     *        instance. Doubles as the client routing namespace.
+     */
+    QString contextName() const;
+
+    bool isDefaultContext() const;
+
+    /**
+     * @brief Selects the clients whose queues and routing keys carry
+     *        the context name. Takes effect for clients created
+     *        afterwards, i.e. call it before initialize().
+     *
+     * Defaults to the truck client only. List another client type
+     * only when its server consumes the namespaced keys.
+     */
+    void setNamespacedClients(
+        const QList<Backend::ClientType> &clientTypes);
+
+    QList<Backend::ClientType> namespacedClients() const;
+
     // ==========================================
     // GUI/CLI Façade Operations
     // ==========================================
@@ -443,6 +497,9 @@ private:
      */
     bool initializeTerminalClient();
 
+    /// Context name when @p clientType is namespaced, else empty.
+    QString routingNamespaceFor(Backend::ClientType clientType) const;
+
     void queueTruckManagerStartup();
     void queueShipClientStartup();
     void queueTrainClientStartup();
@@ -455,6 +512,9 @@ private:
     Backend::SimulationTime *m_simulationTime;
 
     QString m_truckExecutablePath;
+    QString m_contextName;
+    QList<Backend::ClientType> m_namespacedClients{
+        Backend::ClientType::TruckClient};
 
     // Client threads
     QThread *m_truckThread;
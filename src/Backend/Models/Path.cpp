@@ -70,9 +70,9 @@ Path::Path(int id, double totalCost, double edgeCost,
     // instance
 }
 
-Path::Path(const QJsonObject              &json,
-           const QMap<QString, Terminal *> terminalDB,
-           QObject                        *parent)
+Path::Path(const QJsonObject               &json,
+           const QMap<QString, Terminal *> &terminalDB,
+           QObject                         *parent)
     : QObject(parent)
     , m_pathId(0)
     , m_totalPathCost(0.0)
@@ -328,9 +328,9 @@ void Path::setTotalTerminalCosts(double cost)
 }
 
 Path *
-Path::fromJson(const QJsonObject              &json,
-               const QMap<QString, Terminal *> terminalDB,
-               QObject                        *parent)
+Path::fromJson(const QJsonObject               &json,
+               const QMap<QString, Terminal *> &terminalDB,
+               QObject                         *parent)
 {
     return new Path(json, terminalDB, parent);
 }
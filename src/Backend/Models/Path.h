@@ -108,9 +108,9 @@ public:
      * server.
      */
     explicit Path(
-        const QJsonObject              &json,
-        const QMap<QString, Terminal *> terminalDB,
-        QObject                        *parent = nullptr);
+        const QJsonObject               &json,
+        const QMap<QString, Terminal *> &terminalDB,
+        QObject                         *parent = nullptr);
 
     /**
      * @brief Creates a Path from a JSON object
@@ -125,8 +125,8 @@ public:
      * Static factory method to create a Path from JSON.
      */
     static Path *
-    fromJson(const QJsonObject              &json,
-             const QMap<QString, Terminal *> terminalDB,
+    fromJson(const QJsonObject               &json,
+             const QMap<QString, Terminal *> &terminalDB,
              QObject *parent = nullptr);
 
     /**
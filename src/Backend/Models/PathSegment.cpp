@@ -13,68 +13,84 @@ namespace PK = Scenario::PropertyKeys;
 
 namespace {
 
-double subValue(const QJsonObject &attrs,
-                const QString &sub, const QString &key)
+/// Sub-object key of each EstimateRecord field, in Field order.
+const QString &fieldKey(int field)
 {
-    if (!attrs.contains(sub)) return 0.0;
-    const auto obj = attrs.value(sub).toObject();
-    return obj.value(key).toDouble(0.0);
+    static const QString keys[] = {
+        PK::Segment::TravelTime,      PK::Segment::Distance,
+        PK::Segment::CarbonEmissions, PK::Segment::EnergyConsumption,
+        PK::Segment::Risk,            PK::Segment::Cost};
+    return keys[field];
 }
 
-PathSegment::SegmentMetricSnapshot metricSnapshot(
-    const QJsonObject &attrs, const QString &subObject)
+QJsonObject scenarioSegmentAttributes(QJsonObject attributes)
 {
-    PathSegment::SegmentMetricSnapshot out;
-    if (!attrs.contains(subObject)
-        || !attrs.value(subObject).isObject())
+    // PathSegment is scenario-definition data; runtime actuals live in
+    // ScenarioExecutionResult and must not persist in segment attributes.
+    attributes.remove(QStringLiteral("actual_values"));
+    attributes.remove(QStringLiteral("actual_cost"));
+    return attributes;
+}
+
+} // namespace
+
+PathSegment::EstimateRecord
+PathSegment::EstimateRecord::fromJson(const QJsonObject &json)
+{
+    EstimateRecord record;
+    record.exists = true;
+    for (auto it = json.constBegin(); it != json.constEnd(); ++it)
     {
-        return out;
+        int field = 0;
+        while (field < FieldCount && it.key() != fieldKey(field))
+            ++field;
+        if (field < FieldCount && it.value().isDouble())
+            record.set(static_cast<Field>(field),
+                       it.value().toDouble());
+        else
+            record.extra.insert(it.key(), it.value());
     }
-
-    out.available = true;
-    out.travelTime = subValue(attrs, subObject, PK::Segment::TravelTime);
-    out.distance = subValue(attrs, subObject, PK::Segment::Distance);
-    out.carbonEmissions =
-        subValue(attrs, subObject, PK::Segment::CarbonEmissions);
-    out.energyConsumption =
-        subValue(attrs, subObject, PK::Segment::EnergyConsumption);
-    out.risk = subValue(attrs, subObject, PK::Segment::Risk);
-    return out;
+    return record;
 }
 
-PathSegment::SegmentCostSnapshot costSnapshot(
-    const QJsonObject &attrs, const QString &subObject)
+QJsonObject PathSegment::EstimateRecord::toJson() const
 {
-    PathSegment::SegmentCostSnapshot out;
-    if (!attrs.contains(subObject)
-        || !attrs.value(subObject).isObject())
+    QJsonObject json = extra;
+    for (int field = 0; field < FieldCount; ++field)
     {
-        return out;
+        if (present & (1u << field))
+            json[fieldKey(field)] = values[field];
     }
+    return json;
+}
 
-    out.available = true;
-    out.travelTime = subValue(attrs, subObject, PK::Segment::TravelTime);
-    out.distance = subValue(attrs, subObject, PK::Segment::Distance);
-    out.carbonEmissions =
-        subValue(attrs, subObject, PK::Segment::CarbonEmissions);
-    out.energyConsumption =
-        subValue(attrs, subObject, PK::Segment::EnergyConsumption);
-    out.risk = subValue(attrs, subObject, PK::Segment::Risk);
-    out.directCost = subValue(attrs, subObject, PK::Segment::Cost);
+PathSegment::SegmentMetricSnapshot
+PathSegment::EstimateRecord::metrics() const
+{
+    SegmentMetricSnapshot out;
+    out.available = exists;
+    out.travelTime = values[TravelTime];
+    out.distance = values[Distance];
+    out.carbonEmissions = values[CarbonEmissions];
+    out.energyConsumption = values[EnergyConsumption];
+    out.risk = values[Risk];
     return out;
 }
 
-QJsonObject scenarioSegmentAttributes(QJsonObject attributes)
+PathSegment::SegmentCostSnapshot
+PathSegment::EstimateRecord::costs() const
 {
-    // PathSegment is scenario-definition data; runtime actuals live in
-    // ScenarioExecutionResult and must not persist in segment attributes.
-    attributes.remove(QStringLiteral("actual_values"));
-    attributes.remove(QStringLiteral("actual_cost"));
-    return attributes;
+    SegmentCostSnapshot out;
+    out.available = exists;
+    out.travelTime = values[TravelTime];
+    out.distance = values[Distance];
+    out.carbonEmissions = values[CarbonEmissions];
+    out.energyConsumption = values[EnergyConsumption];
+    out.risk = values[Risk];
+    out.directCost = values[Cost];
+    return out;
 }
 
-} // namespace
-
 // PathSegment constructor
 PathSegment::PathSegment(
     const QString &pathSegmentId, const QString &start,
@@ -86,8 +102,8 @@ PathSegment::PathSegment(
     , m_start(start)
     , m_end(end)
     , m_mode(mode)
-    , m_attributes(scenarioSegmentAttributes(attributes))
 {
+    assignAttributes(attributes);
     // Validate input parameters for construction
     if (pathSegmentId.isEmpty() || start.isEmpty()
         || end.isEmpty())
@@ -148,11 +164,11 @@ PathSegment::PathSegment(const QJsonObject &json,
                  QString::number(static_cast<int>(m_mode)));
 
     // Extract optional attributes
+    QJsonObject attributes;
     if (json.contains("attributes")
         && json["attributes"].isObject())
     {
-        m_attributes = scenarioSegmentAttributes(
-            json["attributes"].toObject());
+        attributes = json["attributes"].toObject();
     }
 
     if (json.contains("sequence_index")
@@ -187,18 +203,20 @@ PathSegment::PathSegment(const QJsonObject &json,
     if (json.contains("weight")
         && json["weight"].isDouble())
     {
-        m_attributes["weight"] = json["weight"].toDouble();
+        attributes["weight"] = json["weight"].toDouble();
     }
 
     // Normalize TerminalSim's wire shape once at parse time. Downstream
-    // code reads the canonical `estimated` key; GUI/report compatibility
-    // still keeps `estimated_cost` in the raw attributes bag.
-    if (m_attributes.contains("estimated_values")
-        && m_attributes["estimated_values"].isObject())
+    // code reads the canonical `estimated` record, so the wire copy is
+    // not kept.
+    if (attributes.contains("estimated_values")
+        && attributes["estimated_values"].isObject())
     {
-        m_attributes[PK::Segment::Estimated] =
-            m_attributes["estimated_values"].toObject();
+        attributes[PK::Segment::Estimated] =
+            attributes.take("estimated_values");
     }
+
+    assignAttributes(attributes);
 }
 
 // Convert PathSegment to JSON
@@ -215,9 +233,10 @@ QJsonObject PathSegment::toJson() const
     json["mode"] = TransportationTypes::toInt(m_mode);
 
     // Include attributes only if not empty
-    if (!m_attributes.isEmpty())
+    const QJsonObject attributes = getAttributes();
+    if (!attributes.isEmpty())
     {
-        json["attributes"] = m_attributes;
+        json["attributes"] = attributes;
     }
 
     // Return constructed JSON object
@@ -238,6 +257,9 @@ PathSegment *PathSegment::clone(QObject *parent) const
     auto *segment = new PathSegment(
         m_pathSegmentId, m_start, m_end, m_mode, m_attributes,
         parent);
+    segment->m_estimated = m_estimated;
+    segment->m_estimatedAllocated = m_estimatedAllocated;
+    segment->m_estimatedCost = m_estimatedCost;
     segment->m_sequenceIndex = m_sequenceIndex;
     segment->m_rankingCostContribution =
         m_rankingCostContribution;
@@ -254,71 +276,94 @@ void PathSegment::setAttributes(
                      << m_pathSegmentId
                      << "keys=" << attributes.keys().size();
     // Set the attributes of the path segment
-    m_attributes = scenarioSegmentAttributes(attributes);
+    assignAttributes(attributes);
+}
+
+void PathSegment::assignAttributes(QJsonObject attributes)
+{
+    attributes = scenarioSegmentAttributes(std::move(attributes));
+    auto takeRecord = [&attributes](const QString &key) {
+        const auto it = attributes.constFind(key);
+        if (it == attributes.constEnd() || !it.value().isObject())
+            return EstimateRecord(); // non-objects stay in the bag
+        return EstimateRecord::fromJson(attributes.take(key).toObject());
+    };
+    m_estimated = takeRecord(PK::Segment::Estimated);
+    m_estimatedAllocated = takeRecord(PK::Segment::EstimatedAllocated);
+    m_estimatedCost = takeRecord(PK::Segment::EstimatedCost);
+    m_attributes = std::move(attributes);
+}
+
+QJsonObject PathSegment::getAttributes() const
+{
+    QJsonObject attributes = m_attributes;
+    if (m_estimated.exists)
+        attributes[PK::Segment::Estimated] = m_estimated.toJson();
+    if (m_estimatedAllocated.exists)
+        attributes[PK::Segment::EstimatedAllocated] =
+            m_estimatedAllocated.toJson();
+    if (m_estimatedCost.exists)
+        attributes[PK::Segment::EstimatedCost] = m_estimatedCost.toJson();
+    return attributes;
 }
 
 double PathSegment::estimatedDistance() const
-{ return subValue(m_attributes, PK::Segment::Estimated, PK::Segment::Distance); }
+{ return m_estimated.values[EstimateRecord::Distance]; }
 
 double PathSegment::estimatedTravelTime() const
-{ return subValue(m_attributes, PK::Segment::Estimated, PK::Segment::TravelTime); }
+{ return m_estimated.values[EstimateRecord::TravelTime]; }
 
 PathSegment::SegmentMetricSnapshot PathSegment::estimatedValues() const
 {
-    return metricSnapshot(m_attributes, PK::Segment::Estimated);
+    return m_estimated.metrics();
 }
 
 PathSegment::SegmentMetricSnapshot
 PathSegment::estimatedAllocatedValues() const
 {
-    return metricSnapshot(m_attributes,
-                          PK::Segment::EstimatedAllocated);
+    return m_estimatedAllocated.metrics();
 }
 
 PathSegment::SegmentCostSnapshot PathSegment::estimatedCosts() const
 {
-    return costSnapshot(m_attributes, PK::Segment::EstimatedCost);
+    return m_estimatedCost.costs();
 }
 
 void PathSegment::setEstimatedDistanceAndTravelTime(
     double distanceMeters, double travelTimeSeconds)
 {
-    QJsonObject est = m_attributes.value(PK::Segment::Estimated).toObject();
-    est[PK::Segment::Distance]   = distanceMeters;
-    est[PK::Segment::TravelTime] = travelTimeSeconds;
-    m_attributes[PK::Segment::Estimated] = est;
+    m_estimated.set(EstimateRecord::Distance, distanceMeters);
+    m_estimated.set(EstimateRecord::TravelTime, travelTimeSeconds);
 }
 
 void PathSegment::setEstimatedPhysicalMetrics(
     double energyKWh, double carbonTonnes, double risk)
 {
-    QJsonObject est = m_attributes.value(PK::Segment::Estimated).toObject();
-    est[PK::Segment::EnergyConsumption] = energyKWh;
-    est[PK::Segment::CarbonEmissions]   = carbonTonnes;
-    est[PK::Segment::Risk]              = risk;
-    m_attributes[PK::Segment::Estimated] = est;
+    m_estimated.set(EstimateRecord::EnergyConsumption, energyKWh);
+    m_estimated.set(EstimateRecord::CarbonEmissions, carbonTonnes);
+    m_estimated.set(EstimateRecord::Risk, risk);
 }
 
 void PathSegment::setEstimatedAllocatedPhysicalMetrics(
     double energyKWh, double carbonTonnes, double risk)
 {
-    QJsonObject allocated =
-        m_attributes.value(PK::Segment::Estimated).toObject();
-    allocated[PK::Segment::EnergyConsumption] = energyKWh;
-    allocated[PK::Segment::CarbonEmissions]   = carbonTonnes;
-    allocated[PK::Segment::Risk]              = risk;
-    m_attributes[PK::Segment::EstimatedAllocated] =
-        allocated;
+    // Starts from the estimate so distance and travel time carry over
+    m_estimatedAllocated = m_estimated;
+    m_estimatedAllocated.set(EstimateRecord::EnergyConsumption,
+                             energyKWh);
+    m_estimatedAllocated.set(EstimateRecord::CarbonEmissions,
+                             carbonTonnes);
+    m_estimatedAllocated.set(EstimateRecord::Risk, risk);
 }
 
 double PathSegment::estimatedEnergyConsumption() const
-{ return subValue(m_attributes, PK::Segment::Estimated, PK::Segment::EnergyConsumption); }
+{ return m_estimated.values[EstimateRecord::EnergyConsumption]; }
 
 double PathSegment::estimatedCarbonEmissions() const
-{ return subValue(m_attributes, PK::Segment::Estimated, PK::Segment::CarbonEmissions); }
+{ return m_estimated.values[EstimateRecord::CarbonEmissions]; }
 
 double PathSegment::estimatedRisk() const
-{ return subValue(m_attributes, PK::Segment::Estimated, PK::Segment::Risk); }
+{ return m_estimated.values[EstimateRecord::Risk]; }
 
 } // namespace Backend
 } // namespace CargoNetSim
@@ -189,12 +189,11 @@ public:
      * @brief Retrieves the segment attributes
      * @return Attributes as QJsonObject
      *
-     * Returns additional properties of the segment.
+     * Returns additional properties of the segment, with the
+     * typed estimate records written back under their keys.
+     * Builds a new object; prefer the typed accessors.
      */
-    QJsonObject getAttributes() const
-    {
-        return m_attributes;
-    }
+    QJsonObject getAttributes() const;
 
     int sequenceIndex() const
     {
@@ -308,6 +307,52 @@ public:
     QJsonObject toJson() const;
 
 private:
+    /**
+     * @brief Typed form of one estimate sub-object
+     *
+     * Holds `estimated`, `estimated_allocated` or
+     * `estimated_cost` as doubles instead of a nested
+     * QJsonObject. Presence bits keep the JSON form
+     * key-for-key; keys that are not metrics, or metrics that
+     * are not numbers, stay in @c extra.
+     */
+    struct EstimateRecord
+    {
+        enum Field : quint8
+        {
+            TravelTime,
+            Distance,
+            CarbonEmissions,
+            EnergyConsumption,
+            Risk,
+            Cost,
+            FieldCount
+        };
+
+        double      values[FieldCount] = {};
+        quint8      present = 0;     ///< Bit per field set
+        bool        exists  = false; ///< Sub-object present
+        QJsonObject extra;           ///< Usually empty
+
+        void set(Field field, double value)
+        {
+            values[field] = value;
+            present |= quint8(1u << field);
+            exists = true;
+        }
+
+        static EstimateRecord fromJson(const QJsonObject &json);
+        QJsonObject           toJson() const;
+        SegmentMetricSnapshot metrics() const;
+        SegmentCostSnapshot   costs() const;
+    };
+
+    /**
+     * @brief Stores @p attributes, moving the estimate
+     * sub-objects into their typed records
+     */
+    void assignAttributes(QJsonObject attributes);
+
     /**
      * @brief Unique identifier for the path segment
      */
@@ -328,8 +373,13 @@ private:
     double                                  m_rankingCostContribution = 0.0;
     double                                  m_weightedEdgeCost = 0.0;
     double m_weightedTerminalCostEmbeddedInSegment = 0.0;
+    EstimateRecord m_estimated;
+    EstimateRecord m_estimatedAllocated;
+    EstimateRecord m_estimatedCost;
     /**
-     * @brief Additional attributes of the segment
+     * @brief Rare extension attributes of the segment
+     *
+     * Everything but the estimate sub-objects.
      */
     QJsonObject m_attributes;
 };
@@ -1,6 +1,7 @@
 #include "Terminal.h"
 #include "Backend/Commons/LogCategories.h"
 #include <QJsonArray>
+#include <algorithm>
 #include <stdexcept>
 
 namespace CargoNetSim
@@ -42,11 +43,20 @@ QJsonObject Terminal::toJson() const
     for (auto it = m_interfaces.constBegin();
          it != m_interfaces.constEnd(); ++it)
     {
-        QJsonArray modesArray;
+        // Sorted: set order varies between processes, and the
+        // payload is fingerprinted for the top-path cache
+        QList<int> modes;
+        modes.reserve(it.value().size());
         for (TransportationTypes::TransportationMode mode :
              it.value())
         {
-            modesArray.append(static_cast<int>(mode));
+            modes.append(static_cast<int>(mode));
+        }
+        std::sort(modes.begin(), modes.end());
+        QJsonArray modesArray;
+        for (int mode : modes)
+        {
+            modesArray.append(mode);
         }
         interfacesJson[QString::number(
             static_cast<int>(it.key()))] = modesArray;
@@ -0,0 +1,65 @@
+#include "CacheLocation.h"
+#include "Backend/Commons/LogCategories.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+namespace
+{
+// Hex digits of the source-directory hash used as subdirectory name.
+constexpr int kDirectoryKeyLength = 16;
+} // namespace
+
+QString CacheLocation::root()
+{
+    const QString overridden =
+        qEnvironmentVariable("CARGONETSIM_CACHE_DIR").trimmed();
+    if (!overridden.isEmpty())
+        return QDir(overridden).absolutePath();
+    const QString base = QStandardPaths::writableLocation(
+        QStandardPaths::GenericCacheLocation);
+    return base.isEmpty() ? QString()
+                          : QDir(base).filePath(QStringLiteral("cargonetsim"));
+}
+
+QString CacheLocation::directoryFor(const QString &inputPath)
+{
+    const QString cacheRoot = root();
+    if (inputPath.isEmpty() || cacheRoot.isEmpty())
+        return QString();
+
+    const QString sourceDir = QFileInfo(inputPath).absolutePath();
+    const QByteArray key =
+        QCryptographicHash::hash(sourceDir.toUtf8(),
+                                 QCryptographicHash::Sha256)
+            .toHex()
+            .left(kDirectoryKeyLength);
+    const QString dir = QDir(cacheRoot).filePath(QString::fromLatin1(key));
+    if (!QDir().mkpath(dir))
+    {
+        qCDebug(lcScenario) << "CacheLocation: cannot create" << dir
+                            << "for" << sourceDir;
+        return QString();
+    }
+    return dir;
+}
+
+QString CacheLocation::filePathFor(const QString &inputPath,
+                                   const QString &fileName)
+{
+    const QString dir = directoryFor(inputPath);
+    return dir.isEmpty() ? QString() : QDir(dir).filePath(fileName);
+}
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
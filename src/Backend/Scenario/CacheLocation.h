@@ -0,0 +1,41 @@
+#pragma once
+
+#include <QString>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+/// Where the on-disk scenario, network image, network distance and
+/// top-path caches live.
+///
+/// Caches never go into the input directories. The root is
+/// `$CARGONETSIM_CACHE_DIR` when set, otherwise `cargonetsim` under the
+/// per-user generic cache location (e.g. `~/.cache/cargonetsim`), shared
+/// by the GUI and the CLI. Inputs get one subdirectory per source
+/// directory, named after a hash of its absolute path, so equally named
+/// scenarios or networks in different directories never collide.
+///
+/// Stateless — all methods are static.
+class CacheLocation
+{
+public:
+    /// Cache root, or empty when no writable location is known.
+    static QString root();
+
+    /// Cache directory for inputs that live next to @p inputPath,
+    /// created on demand. Empty when @p inputPath is empty or the
+    /// directory cannot be created; callers then skip caching.
+    static QString directoryFor(const QString &inputPath);
+
+    /// `directoryFor(inputPath)/fileName`, or empty when that is empty.
+    static QString filePathFor(const QString &inputPath,
+                               const QString &fileName);
+};
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
@@ -1,12 +1,17 @@
 #include "DispatchableWaveBuilder.h"
 
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Commons/Trace.h"
 #include "Backend/Commons/TransportationMode.h"
 #include "Backend/Controllers/ConfigController.h"
 #include "Backend/Controllers/VehicleController.h"
 #include "Backend/Scenario/NetworkLookup.h"
 #include "PropertyKeys.h"
 
+#include <QHash>
+#include <QThread>
+#include <QThreadPool>
+
 #include <containerLib/container.h>
 
 namespace CargoNetSim
@@ -44,6 +49,10 @@ DispatchableWaveBuildResult DispatchableWaveBuilder::build(
     const ExecutionLedger &ledger,
     const QVector<DispatchableSegmentRef> &dispatchableSegments) const
 {
+    CNS_TRACE_SCOPE_DETAIL(
+        Execution, "DispatchableWaveBuilder::build",
+        QStringLiteral("%1 segment(s)").arg(dispatchableSegments.size()));
+
     if (!m_config)
     {
         return fail(QStringLiteral(
@@ -56,7 +65,6 @@ DispatchableWaveBuildResult DispatchableWaveBuilder::build(
     }
 
     DispatchableWaveBuildResult result;
-    SegmentDispatchCursor cursor;
     auto releaseReservedPickups = [&]() {
         if (!m_pickupCoordinator
             || result.pickupReservations.isEmpty())
@@ -94,6 +102,13 @@ DispatchableWaveBuildResult DispatchableWaveBuilder::build(
             return blocked;
         };
 
+    // Validate the whole wave first so that its pickups can be
+    // reserved with one terminal round trip.
+    QVector<StagedSegment>         staged;
+    QVector<TerminalPickupRequest> pickupRequests;
+    staged.reserve(dispatchableSegments.size());
+    pickupRequests.reserve(dispatchableSegments.size());
+
     for (const auto &segmentRef : dispatchableSegments)
     {
         const auto *pathPlan =
@@ -126,7 +141,6 @@ DispatchableWaveBuildResult DispatchableWaveBuilder::build(
         }
 
         int eligibleContainerCount = 0;
-        QList<ContainerCore::Container *> eligibleContainers;
         for (const auto &containerState : stateIt.value())
         {
             if (containerState.segmentIndex
@@ -144,149 +158,198 @@ DispatchableWaveBuildResult DispatchableWaveBuilder::build(
 
         if (eligibleContainerCount <= 0)
         {
-            return failAfterReservations(QStringLiteral(
+            return fail(QStringLiteral(
                 "No dispatchable containers are staged for path %1 segment %2")
                             .arg(pathPlan->executionPathKey)
                             .arg(segmentRef.segmentIndex));
         }
 
+        StagedSegment segment;
+        segment.pathPlan = pathPlan;
+        segment.segmentPlan = &segmentPlan;
+        segment.capacity = capacityForMode(segmentPlan.mode);
+        if (segment.capacity <= 0)
         {
-            TerminalPickupRequest pickupRequest;
-            pickupRequest.executionId = plan.executionId;
-            pickupRequest.executionPathKey = pathPlan->executionPathKey;
-            pickupRequest.canonicalPathKey =
-                pathPlan->canonicalPathKey;
-            pickupRequest.terminalId = segmentPlan.startTerminalId;
-            pickupRequest.segmentIndex = segmentRef.segmentIndex;
-            pickupRequest.containerCount = eligibleContainerCount;
-
-            auto pickupBatch =
-                m_pickupCoordinator->reserveForDispatch(
-                    pickupRequest);
-            if (pickupBatch.blocked)
-            {
-                return blockedAfterReservations(*pathPlan,
-                                                segmentPlan);
-            }
-            if (!pickupBatch.isSuccess())
-            {
-                return failAfterReservations(
-                    pickupBatch.errorMessage);
-            }
-            result.pickupReservations.append(pickupBatch.handle);
-            eligibleContainers = pickupBatch.containers;
-        }
-
-        QVector<VehicleLoadManifest> loads;
-        QString err;
-        bool success = false;
-        const int capacity =
-            capacityForMode(segmentPlan.mode);
-        if (capacity <= 0)
-        {
-            qDeleteAll(eligibleContainers);
-            return failAfterReservations(QStringLiteral(
+            return fail(QStringLiteral(
                 "Invalid configured vehicle capacity for mode %1")
                             .arg(transportationModeToString(
                                 segmentPlan.mode)));
         }
-
-        switch (segmentPlan.mode)
-        {
-        case TransportationTypes::TransportationMode::Train:
+        // Registry lookups stay on this thread.
+        if (segmentPlan.mode
+            == TransportationTypes::TransportationMode::Train)
         {
-            auto *network = NetworkLookup::findRail(
+            segment.trainNetwork = NetworkLookup::findRail(
                 m_registry, segmentPlan.regionName,
                 segmentPlan.networkName);
-            TrainSegmentDispatchRequest request;
-            request.pathId = pathPlan->pathId;
-            request.executionPathKey = pathPlan->executionPathKey;
-            request.canonicalPathKey =
-                pathPlan->canonicalPathKey;
-            request.segmentIndex = segmentPlan.segmentIndex;
-            request.startTerminalId =
-                segmentPlan.startTerminalId;
-            request.endTerminalId =
-                segmentPlan.endTerminalId;
-            request.networkName = segmentPlan.networkName;
-            request.runtimeStartNodeId =
-                segmentPlan.runtimeStartNodeId;
-            request.runtimeEndNodeId =
-                segmentPlan.runtimeEndNodeId;
-            request.trainContainerCapacity = capacity;
-            request.containersAvailable = eligibleContainers;
-            request.network = network;
-            success = m_dispatchFactory.appendTrainSegment(
-                request, cursor, result.bundle, &loads, &err);
-            break;
         }
-        case TransportationTypes::TransportationMode::Truck:
+        else if (segmentPlan.mode
+                 == TransportationTypes::TransportationMode::Truck)
         {
-            auto *network = NetworkLookup::findTruck(
+            segment.truckNetwork = NetworkLookup::findTruck(
                 m_registry, segmentPlan.regionName,
                 segmentPlan.networkName);
-            TruckSegmentDispatchRequest request;
-            request.pathId = pathPlan->pathId;
-            request.executionPathKey = pathPlan->executionPathKey;
-            request.canonicalPathKey =
-                pathPlan->canonicalPathKey;
-            request.segmentIndex = segmentPlan.segmentIndex;
-            request.startTerminalId =
-                segmentPlan.startTerminalId;
-            request.endTerminalId =
-                segmentPlan.endTerminalId;
-            request.networkName = segmentPlan.networkName;
-            request.runtimeStartNodeId =
-                segmentPlan.runtimeStartNodeId;
-            request.runtimeEndNodeId =
-                segmentPlan.runtimeEndNodeId;
-            request.runtimeStartLocationName =
-                segmentPlan.runtimeStartLocationName;
-            request.runtimeEndLocationName =
-                segmentPlan.runtimeEndLocationName;
-            request.truckContainerCapacity = capacity;
-            request.containersAvailable = eligibleContainers;
-            request.network = network;
-            success = m_dispatchFactory.appendTruckSegment(
-                request, cursor, result.bundle, &loads, &err);
-            break;
         }
-        case TransportationTypes::TransportationMode::Ship:
+
+        TerminalPickupRequest pickupRequest;
+        pickupRequest.executionId = plan.executionId;
+        pickupRequest.executionPathKey = pathPlan->executionPathKey;
+        pickupRequest.canonicalPathKey =
+            pathPlan->canonicalPathKey;
+        pickupRequest.terminalId = segmentPlan.startTerminalId;
+        pickupRequest.segmentIndex = segmentRef.segmentIndex;
+        pickupRequest.containerCount = eligibleContainerCount;
+        pickupRequests.append(pickupRequest);
+        staged.append(segment);
+    }
+
+    QVector<TerminalPickupBatch> pickupBatches =
+        m_pickupCoordinator->reserveForDispatch(pickupRequests);
+    auto deletePickupContainers = [&]() {
+        for (auto &pickupBatch : pickupBatches)
         {
-            ShipSegmentDispatchRequest request;
-            request.pathId = pathPlan->pathId;
-            request.executionPathKey = pathPlan->executionPathKey;
-            request.canonicalPathKey =
-                pathPlan->canonicalPathKey;
-            request.segmentIndex = segmentPlan.segmentIndex;
-            request.startTerminalId =
-                segmentPlan.startTerminalId;
-            request.endTerminalId =
-                segmentPlan.endTerminalId;
-            request.networkName = segmentPlan.networkName;
-            request.startGlobalPosition =
-                segmentPlan.startGlobalPosition;
-            request.endGlobalPosition =
-                segmentPlan.endGlobalPosition;
-            request.shipContainerCapacity = capacity;
-            request.containersAvailable = eligibleContainers;
-            success = m_dispatchFactory.appendShipSegment(
-                request, cursor, result.bundle, &loads, &err);
-            break;
+            qDeleteAll(pickupBatch.containers);
+            pickupBatch.containers.clear();
         }
-        default:
-            err = QStringLiteral(
-                "Unsupported dispatch mode in execution plan");
-            success = false;
-            break;
+    };
+    for (const auto &pickupBatch : pickupBatches)
+    {
+        if (pickupBatch.isSuccess())
+            result.pickupReservations.append(pickupBatch.handle);
+    }
+    for (int i = 0; i < pickupBatches.size(); ++i)
+    {
+        if (pickupBatches[i].blocked)
+        {
+            deletePickupContainers();
+            return blockedAfterReservations(*staged[i].pathPlan,
+                                            *staged[i].segmentPlan);
         }
+        if (!pickupBatches[i].isSuccess())
+        {
+            deletePickupContainers();
+            return failAfterReservations(
+                pickupBatches[i].errorMessage);
+        }
+    }
 
-        qDeleteAll(eligibleContainers);
+    // Fix every segment's ids in wave order, then group the segments
+    // by network. Partitions share no network key, so each one fills
+    // its own bundle and merging them restores the sequential result.
+    struct Partition
+    {
+        QVector<int>            stagedIndices;
+        SimulationRequestBundle bundle;
+        int                     failedIndex = -1;
+        QString                 error;
+    };
+    QVector<Partition>  partitions;
+    QHash<QString, int> partitionByNetwork;
+    SegmentDispatchCursor cursor;
+    for (int i = 0; i < staged.size(); ++i)
+    {
+        const auto &segmentPlan = *staged[i].segmentPlan;
+        staged[i].cursor = cursor;
+        SegmentDispatchFactory::advanceCursor(
+            segmentPlan.mode, pickupBatches[i].containers.size(),
+            staged[i].capacity, cursor);
 
-        if (!success)
-            return failAfterReservations(err);
+        const QString networkKey =
+            QStringLiteral("%1|%2").arg(
+                transportationModeToString(segmentPlan.mode),
+                segmentPlan.networkName);
+        auto it = partitionByNetwork.constFind(networkKey);
+        if (it == partitionByNetwork.constEnd())
+        {
+            it = partitionByNetwork.insert(networkKey,
+                                           partitions.size());
+            partitions.append(Partition());
+        }
+        partitions[it.value()].stagedIndices.append(i);
+    }
+
+    QVector<QVector<VehicleLoadManifest>> segmentLoads(staged.size());
+    // Container copies belong to the thread that merges and dispatches
+    // the bundle, whichever worker builds them.
+    QThread *const mergeThread = QThread::currentThread();
+    // Each task touches only its own partition and the pickup batches
+    // and load lists of its segments.
+    auto buildPartition = [&](Partition &partition) {
+        for (int n = 0; n < partition.stagedIndices.size(); ++n)
+        {
+            const int i = partition.stagedIndices[n];
+            const QList<ContainerCore::Container *> containers =
+                pickupBatches[i].containers;
+            pickupBatches[i].containers.clear();
+            QString err;
+            const bool success =
+                buildSegment(staged[i], containers, partition.bundle,
+                             &segmentLoads[i], mergeThread, &err);
+            qDeleteAll(containers);
+            if (!success)
+            {
+                partition.failedIndex = i;
+                partition.error = err;
+                for (int rest = n + 1;
+                     rest < partition.stagedIndices.size(); ++rest)
+                {
+                    auto &pickupBatch =
+                        pickupBatches[partition.stagedIndices[rest]];
+                    qDeleteAll(pickupBatch.containers);
+                    pickupBatch.containers.clear();
+                }
+                break;
+            }
+        }
+    };
+
+    const int threads = m_maxThreads > 0 ? m_maxThreads
+                                         : QThread::idealThreadCount();
+    qCDebug(lcScenario)
+        << "DispatchableWaveBuilder::build:" << staged.size()
+        << "segment(s) in" << partitions.size() << "partition(s) on"
+        << qMax(1, qMin(threads, int(partitions.size())))
+        << "thread(s)";
+    if (threads <= 1 || partitions.size() <= 1)
+    {
+        for (Partition &partition : partitions)
+            buildPartition(partition);
+    }
+    else
+    {
+        QThreadPool pool;
+        pool.setMaxThreadCount(threads);
+        for (Partition &partition : partitions)
+        {
+            Partition *target = &partition;
+            pool.start([&buildPartition, target]() {
+                buildPartition(*target);
+            });
+        }
+        pool.waitForDone();
+    }
 
-        for (const auto &load : loads)
+    // Report the failure the sequential build would have hit first.
+    const Partition *failed = nullptr;
+    for (const Partition &partition : std::as_const(partitions))
+    {
+        if (partition.failedIndex >= 0
+            && (!failed || partition.failedIndex < failed->failedIndex))
+        {
+            failed = &partition;
+        }
+    }
+    if (failed)
+        return failAfterReservations(failed->error);
+
+    for (const Partition &partition : std::as_const(partitions))
+        result.bundle.merge(partition.bundle);
+
+    for (int i = 0; i < staged.size(); ++i)
+    {
+        const auto *pathPlan = staged[i].pathPlan;
+        const auto &segmentPlan = *staged[i].segmentPlan;
+        for (const auto &load : std::as_const(segmentLoads[i]))
         {
             VehicleDispatchAssignment assignment;
             assignment.executionPathKey = pathPlan->executionPathKey;
@@ -309,6 +372,108 @@ DispatchableWaveBuildResult DispatchableWaveBuilder::build(
     return result;
 }
 
+void DispatchableWaveBuilder::setMaxThreads(int maxThreads)
+{
+    m_maxThreads = maxThreads;
+}
+
+bool DispatchableWaveBuilder::buildSegment(
+    const StagedSegment                     &segment,
+    const QList<ContainerCore::Container *> &containers,
+    SimulationRequestBundle                 &bundle,
+    QVector<VehicleLoadManifest>            *loads,
+    QThread                                 *containerThread,
+    QString                                 *err) const
+{
+    const auto *pathPlan = segment.pathPlan;
+    const auto &segmentPlan = *segment.segmentPlan;
+    SegmentDispatchCursor cursor = segment.cursor;
+
+    switch (segmentPlan.mode)
+    {
+    case TransportationTypes::TransportationMode::Train:
+    {
+        TrainSegmentDispatchRequest request;
+        request.pathId = pathPlan->pathId;
+        request.executionPathKey = pathPlan->executionPathKey;
+        request.canonicalPathKey =
+            pathPlan->canonicalPathKey;
+        request.segmentIndex = segmentPlan.segmentIndex;
+        request.startTerminalId =
+            segmentPlan.startTerminalId;
+        request.endTerminalId =
+            segmentPlan.endTerminalId;
+        request.networkName = segmentPlan.networkName;
+        request.runtimeStartNodeId =
+            segmentPlan.runtimeStartNodeId;
+        request.runtimeEndNodeId =
+            segmentPlan.runtimeEndNodeId;
+        request.trainContainerCapacity = segment.capacity;
+        request.containersAvailable = containers;
+        request.containerThread = containerThread;
+        request.network = segment.trainNetwork;
+        return m_dispatchFactory.appendTrainSegment(
+            request, cursor, bundle, loads, err);
+    }
+    case TransportationTypes::TransportationMode::Truck:
+    {
+        TruckSegmentDispatchRequest request;
+        request.pathId = pathPlan->pathId;
+        request.executionPathKey = pathPlan->executionPathKey;
+        request.canonicalPathKey =
+            pathPlan->canonicalPathKey;
+        request.segmentIndex = segmentPlan.segmentIndex;
+        request.startTerminalId =
+            segmentPlan.startTerminalId;
+        request.endTerminalId =
+            segmentPlan.endTerminalId;
+        request.networkName = segmentPlan.networkName;
+        request.runtimeStartNodeId =
+            segmentPlan.runtimeStartNodeId;
+        request.runtimeEndNodeId =
+            segmentPlan.runtimeEndNodeId;
+        request.runtimeStartLocationName =
+            segmentPlan.runtimeStartLocationName;
+        request.runtimeEndLocationName =
+            segmentPlan.runtimeEndLocationName;
+        request.truckContainerCapacity = segment.capacity;
+        request.containersAvailable = containers;
+        request.containerThread = containerThread;
+        request.network = segment.truckNetwork;
+        return m_dispatchFactory.appendTruckSegment(
+            request, cursor, bundle, loads, err);
+    }
+    case TransportationTypes::TransportationMode::Ship:
+    {
+        ShipSegmentDispatchRequest request;
+        request.pathId = pathPlan->pathId;
+        request.executionPathKey = pathPlan->executionPathKey;
+        request.canonicalPathKey =
+            pathPlan->canonicalPathKey;
+        request.segmentIndex = segmentPlan.segmentIndex;
+        request.startTerminalId =
+            segmentPlan.startTerminalId;
+        request.endTerminalId =
+            segmentPlan.endTerminalId;
+        request.networkName = segmentPlan.networkName;
+        request.startGlobalPosition =
+            segmentPlan.startGlobalPosition;
+        request.endGlobalPosition =
+            segmentPlan.endGlobalPosition;
+        request.shipContainerCapacity = segment.capacity;
+        request.containersAvailable = containers;
+        request.containerThread = containerThread;
+        return m_dispatchFactory.appendShipSegment(
+            request, cursor, bundle, loads, err);
+    }
+    default:
+        if (err)
+            *err = QStringLiteral(
+                "Unsupported dispatch mode in execution plan");
+        return false;
+    }
+}
+
 int DispatchableWaveBuilder::capacityForMode(
     TransportationTypes::TransportationMode mode) const
 {
@@ -33,6 +33,14 @@ struct DispatchableWaveBuildResult
     }
 };
 
+/// Turns a wave of dispatchable segments into simulator requests.
+///
+/// The wave is validated and its terminal pickups are reserved in one
+/// batched call; the segments are then partitioned by network and each
+/// partition's vehicles are built on its own thread. Vehicle and
+/// container ids are fixed per segment before the build starts and the
+/// partitions are merged in wave order, so the result does not depend
+/// on the thread count.
 class DispatchableWaveBuilder
 {
 public:
@@ -47,7 +55,27 @@ public:
         const ExecutionLedger                 &ledger,
         const QVector<DispatchableSegmentRef> &dispatchableSegments) const;
 
+    /// 0 = QThread::idealThreadCount(); 1 = build every partition inline.
+    void setMaxThreads(int maxThreads);
+
 private:
+    struct StagedSegment
+    {
+        const PathExecutionPlan    *pathPlan = nullptr;
+        const SegmentExecutionPlan *segmentPlan = nullptr;
+        int                         capacity = -1;
+        TrainClient::NeTrainSimNetwork  *trainNetwork = nullptr;
+        TruckClient::IntegrationNetwork *truckNetwork = nullptr;
+        SegmentDispatchCursor       cursor;
+    };
+
+    bool buildSegment(const StagedSegment               &segment,
+                      const QList<ContainerCore::Container *> &containers,
+                      SimulationRequestBundle           &bundle,
+                      QVector<VehicleLoadManifest>      *loads,
+                      QThread                           *containerThread,
+                      QString                           *err) const;
+
     int capacityForMode(
         TransportationTypes::TransportationMode mode) const;
 
@@ -62,6 +90,7 @@ private:
     ConfigController       *m_config = nullptr;
     SegmentDispatchFactory  m_dispatchFactory;
     TerminalPickupCoordinator *m_pickupCoordinator = nullptr;
+    int                     m_maxThreads = 0;
 };
 
 } // namespace Scenario
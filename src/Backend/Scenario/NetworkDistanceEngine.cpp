@@ -0,0 +1,480 @@
+#include "NetworkDistanceEngine.h"
+
+#include "Backend/Clients/TrainClient/TrainNetwork.h"
+#include "Backend/Clients/TruckClient/TruckNetwork.h"
+#include "Backend/Commons/LogCategories.h"
+#include "Backend/Commons/Trace.h"
+#include "Backend/Controllers/NetworkController.h"
+#include "Backend/Scenario/ScenarioDocument.h"
+#include "CacheLocation.h"
+#include "NetworkImageCache.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
+
+#include <atomic>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+namespace
+{
+
+using Metric = NetworkDistanceEngine::Metric;
+
+constexpr int kDigestSize = 32; // SHA-256
+// magic + format version + digest
+constexpr qint64 kHeaderSize = 4 + 2 + kDigestSize;
+// from + to + metric + metres + seconds
+constexpr qint64 kRecordSize = 4 + 4 + 1 + 8 + 8;
+
+void configureStream(QDataStream &ds)
+{
+    ds.setByteOrder(QDataStream::LittleEndian);
+    ds.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+const NetworkSpec *specFor(const ScenarioDocument &doc,
+                           const QString          &region,
+                           const QString          &network)
+{
+    const auto regionIt = doc.regions.constFind(region);
+    if (regionIt == doc.regions.constEnd())
+        return nullptr;
+    const auto networkIt = regionIt->networks.constFind(network);
+    return networkIt == regionIt->networks.constEnd() ? nullptr
+                                                      : &networkIt.value();
+}
+
+/// One single-source search: every pending target of @p source.
+struct SourceBatch
+{
+    QString                                networkKey;
+    NetworkSpec::Type                      type = NetworkSpec::Type::Rail;
+    QString                                region;
+    QString                                network;
+    int                                    source = -1;
+    Metric                                 metric = Metric::Distance;
+    QVector<int>                           targets;
+    QMap<int, NetworkDistanceEngine::Leg>  results;
+    bool                                   networkFound = false;
+};
+
+void runBatch(const NetworkController &networks, SourceBatch &batch)
+{
+    CNS_TRACE_SCOPE_DETAIL(
+        Discovery, "NetworkDistanceEngine::search",
+        QStringLiteral("%1 -> %2 target(s)")
+            .arg(batch.source)
+            .arg(batch.targets.size()));
+    QMap<int, ShortestPathResult> paths;
+    if (batch.type == NetworkSpec::Type::Rail)
+    {
+        auto *g = networks.trainNetwork(batch.network, batch.region);
+        if (!g)
+            return;
+        paths = g->findShortestPaths(
+            batch.source, batch.targets,
+            batch.metric == Metric::Time ? QStringLiteral("time")
+                                         : QStringLiteral("distance"));
+    }
+    else
+    {
+        auto *g = networks.truckNetwork(batch.network, batch.region);
+        if (!g)
+            return;
+        paths = g->findShortestPaths(batch.source, batch.targets);
+    }
+
+    batch.networkFound = true;
+    for (auto it = paths.constBegin(); it != paths.constEnd(); ++it)
+    {
+        NetworkDistanceEngine::Leg leg;
+        leg.distanceMeters    = it->totalLength;
+        leg.travelTimeSeconds = it->minTravelTime;
+        batch.results.insert(it.key(), leg);
+    }
+}
+
+} // namespace
+
+NetworkDistanceEngine::NetworkDistanceEngine(
+    const ScenarioDocument  &doc,
+    const NetworkController &networks,
+    Options                  options)
+    : m_doc(doc)
+    , m_networks(networks)
+    , m_options(options)
+{
+}
+
+QString NetworkDistanceEngine::networkKey(NetworkSpec::Type type,
+                                          const QString    &region,
+                                          const QString    &network)
+{
+    return networkKindToString(type) + QLatin1Char('\x1f') + region
+           + QLatin1Char('\x1f') + network;
+}
+
+quint64 NetworkDistanceEngine::legKey(int fromNode, int toNode)
+{
+    return (static_cast<quint64>(static_cast<quint32>(fromNode)) << 32)
+           | static_cast<quint32>(toNode);
+}
+
+QString NetworkDistanceEngine::cachePathFor(const NetworkSpec &spec)
+{
+    if (spec.files.isEmpty())
+        return QString();
+    return CacheLocation::filePathFor(
+        spec.files.first(),
+        QStringLiteral("%1.%2.distances.cnscache")
+            .arg(spec.name, networkKindToString(spec.type).toLower()));
+}
+
+void NetworkDistanceEngine::request(NetworkSpec::Type type,
+                                    const QString    &region,
+                                    const QString    &network,
+                                    int fromNode, int toNode, Metric metric)
+{
+    NetworkLegs &legs = m_byNetwork[networkKey(type, region, network)];
+    legs.type    = type;
+    legs.region  = region;
+    legs.network = network;
+
+    const int     slot = static_cast<int>(metric);
+    const quint64 key  = legKey(fromNode, toNode);
+    legs.used[slot].insert(key);
+    if (!legs.legs[slot].contains(key))
+        legs.pending[slot].insert(key);
+}
+
+void NetworkDistanceEngine::resolve()
+{
+    CNS_TRACE_SCOPE(Discovery, "NetworkDistanceEngine::resolve");
+
+    QList<SourceBatch> batches;
+    QHash<QString, int> batchBySource;
+    int legsRequested = 0;
+
+    for (auto it = m_byNetwork.begin(); it != m_byNetwork.end(); ++it)
+    {
+        NetworkLegs &legs = it.value();
+        if (legs.pending[0].isEmpty() && legs.pending[1].isEmpty())
+            continue;
+        if (m_options.diskCache && !legs.diskChecked)
+            loadDiskCache(legs);
+
+        for (int slot = 0; slot < 2; ++slot)
+        {
+            for (quint64 key : std::as_const(legs.pending[slot]))
+            {
+                if (legs.legs[slot].contains(key))
+                {
+                    ++m_diskCacheHits;
+                    continue;
+                }
+                const int from = static_cast<int>(key >> 32);
+                const int to   = static_cast<int>(key & 0xffffffffu);
+                const QString sourceKey = it.key() + QLatin1Char('\x1f')
+                                          + QString::number(slot)
+                                          + QLatin1Char('\x1f')
+                                          + QString::number(from);
+                auto batchIt = batchBySource.constFind(sourceKey);
+                if (batchIt == batchBySource.constEnd())
+                {
+                    SourceBatch batch;
+                    batch.networkKey = it.key();
+                    batch.type       = legs.type;
+                    batch.region     = legs.region;
+                    batch.network    = legs.network;
+                    batch.source     = from;
+                    batch.metric     = static_cast<Metric>(slot);
+                    batchIt = batchBySource.insert(
+                        sourceKey, static_cast<int>(batches.size()));
+                    batches.append(batch);
+                }
+                batches[batchIt.value()].targets.append(to);
+                ++legsRequested;
+            }
+            legs.pending[slot].clear();
+        }
+    }
+
+    if (!batches.isEmpty())
+    {
+        const int threads = m_options.maxThreads > 0
+                                ? m_options.maxThreads
+                                : QThread::idealThreadCount();
+        qCInfo(lcScenario) << "NetworkDistanceEngine::resolve:"
+                           << legsRequested << "leg(s) from"
+                           << batches.size() << "source(s) on" << threads
+                           << "thread(s)";
+
+        // Each task writes only its own batch; the list is not resized
+        // until every task has finished.
+        if (threads <= 1 || batches.size() == 1)
+        {
+            for (SourceBatch &batch : batches)
+                runBatch(m_networks, batch);
+        }
+        else
+        {
+            // Up to `threads` workers on the global pool, this thread
+            // included, pull batches in order. The pool's threads are
+            // reused across calls rather than started per call.
+            std::atomic<qsizetype> next(0);
+            auto drain = [this, &batches, &next]() {
+                for (qsizetype i = next++; i < batches.size(); i = next++)
+                    runBatch(m_networks, batches[i]);
+            };
+            const int helpers =
+                static_cast<int>(qMin<qsizetype>(threads, batches.size())) - 1;
+            QSemaphore helpersDone;
+            for (int i = 0; i < helpers; ++i)
+            {
+                QThreadPool::globalInstance()->start([&drain, &helpersDone]() {
+                    drain();
+                    helpersDone.release();
+                });
+            }
+            drain();
+            helpersDone.acquire(helpers);
+        }
+        m_searchCount += static_cast<int>(batches.size());
+    }
+
+    for (const SourceBatch &batch : std::as_const(batches))
+    {
+        if (!batch.networkFound)
+        {
+            qCDebug(lcScenario) << "NetworkDistanceEngine::resolve:"
+                                << networkKindToString(batch.type)
+                                << "network" << batch.network
+                                << "not found in region" << batch.region;
+            continue;
+        }
+        NetworkLegs &legs = m_byNetwork[batch.networkKey];
+        const int    slot = static_cast<int>(batch.metric);
+        for (auto it = batch.results.constBegin();
+             it != batch.results.constEnd(); ++it)
+        {
+            const quint64 key = legKey(batch.source, it.key());
+            legs.legs[slot].insert(key, it.value());
+            legs.unsaved[slot].append(key);
+        }
+    }
+
+    if (!m_options.diskCache)
+        return;
+    for (auto it = m_byNetwork.begin(); it != m_byNetwork.end(); ++it)
+    {
+        if (!it->unsaved[0].isEmpty() || !it->unsaved[1].isEmpty())
+            storeDiskCache(it.value());
+    }
+}
+
+bool NetworkDistanceEngine::lookup(NetworkSpec::Type type,
+                                   const QString    &region,
+                                   const QString    &network,
+                                   int fromNode, int toNode, Leg *leg,
+                                   Metric metric) const
+{
+    const auto it = m_byNetwork.constFind(networkKey(type, region, network));
+    if (it == m_byNetwork.constEnd())
+        return false;
+    const auto &legs  = it->legs[static_cast<int>(metric)];
+    const auto  legIt = legs.constFind(legKey(fromNode, toNode));
+    if (legIt == legs.constEnd())
+        return false;
+    if (leg)
+        *leg = legIt.value();
+    return true;
+}
+
+QByteArray NetworkDistanceEngine::contentDigest(const NetworkLegs &legs) const
+{
+    const NetworkSpec *spec = specFor(m_doc, legs.region, legs.network);
+    return spec ? NetworkImageCache::contentDigest(*spec) : QByteArray();
+}
+
+void NetworkDistanceEngine::loadDiskCache(NetworkLegs &legs)
+{
+    legs.diskChecked = true;
+    const NetworkSpec *spec = specFor(m_doc, legs.region, legs.network);
+    if (!spec)
+        return;
+    const QString cachePath = cachePathFor(*spec);
+    QFile         f(cachePath);
+    if (cachePath.isEmpty() || !f.exists()
+        || !f.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream ds(&f);
+    configureStream(ds);
+    quint32    magic  = 0;
+    quint16    format = 0;
+    QByteArray digest(kDigestSize, Qt::Uninitialized);
+    ds >> magic >> format;
+    if (ds.status() != QDataStream::Ok || magic != kCacheMagic
+        || format != kCacheFormatVersion
+        || ds.readRawData(digest.data(), kDigestSize) != kDigestSize
+        || digest != contentDigest(legs))
+    {
+        qCDebug(lcScenario) << "NetworkDistanceEngine::loadDiskCache:"
+                            << "stale or incompatible" << cachePath;
+        return;
+    }
+
+    // A torn trailing record (interrupted append) is ignored here and
+    // replaced by the next rewrite.
+    const qint64 count = (f.size() - kHeaderSize) / kRecordSize;
+    QHash<quint64, Leg> loaded[2];
+    for (qint64 i = 0; i < count; ++i)
+    {
+        qint32 from = 0, to = 0;
+        quint8 metric = 0;
+        Leg    leg;
+        ds >> from >> to >> metric >> leg.distanceMeters
+           >> leg.travelTimeSeconds;
+        if (ds.status() != QDataStream::Ok
+            || metric > static_cast<quint8>(Metric::Time))
+            return;
+        loaded[metric].insert(legKey(from, to), leg);
+    }
+
+    for (int slot = 0; slot < 2; ++slot)
+        for (auto it = loaded[slot].constBegin();
+             it != loaded[slot].constEnd(); ++it)
+            legs.legs[slot].insert(it.key(), it.value());
+    legs.diskLegs = f.size() == kHeaderSize + count * kRecordSize ? count
+                                                                  : -1;
+    qCInfo(lcScenario) << "NetworkDistanceEngine::loadDiskCache: hit"
+                       << cachePath << "-" << count << "leg(s)";
+}
+
+void NetworkDistanceEngine::storeDiskCache(NetworkLegs &legs) const
+{
+    const NetworkSpec *spec = specFor(m_doc, legs.region, legs.network);
+    if (!spec)
+        return;
+    const QString    cachePath = cachePathFor(*spec);
+    const QByteArray digest    = contentDigest(legs);
+    if (cachePath.isEmpty() || digest.size() != kDigestSize)
+        return;
+
+    const qint64 fresh = legs.unsaved[0].size() + legs.unsaved[1].size();
+    const bool   fits  = legs.diskLegs >= 0
+                      && legs.diskLegs + fresh <= m_options.diskCacheMaxLegs;
+    if (!(fits && appendDiskCache(cachePath, legs))
+        && !rewriteDiskCache(cachePath, digest, legs))
+        return;
+    legs.unsaved[0].clear();
+    legs.unsaved[1].clear();
+}
+
+bool NetworkDistanceEngine::appendDiskCache(const QString &cachePath,
+                                            NetworkLegs   &legs) const
+{
+    QFile out(cachePath);
+    // Another process may have rewritten or extended the file since we
+    // read it; only append onto exactly what we loaded.
+    if (out.size() != kHeaderSize + legs.diskLegs * kRecordSize
+        || !out.open(QIODevice::WriteOnly | QIODevice::Append))
+        return false;
+
+    QDataStream ds(&out);
+    configureStream(ds);
+    qint64 written = 0;
+    for (int slot = 0; slot < 2; ++slot)
+    {
+        for (quint64 key : std::as_const(legs.unsaved[slot]))
+        {
+            const Leg &leg = legs.legs[slot].value(key);
+            ds << static_cast<qint32>(key >> 32)
+               << static_cast<qint32>(key & 0xffffffffu)
+               << static_cast<quint8>(slot) << leg.distanceMeters
+               << leg.travelTimeSeconds;
+            ++written;
+        }
+    }
+    out.close();
+    if (ds.status() != QDataStream::Ok
+        || out.error() != QFileDevice::NoError)
+    {
+        qCDebug(lcScenario) << "NetworkDistanceEngine::appendDiskCache:"
+                            << "append failed for" << cachePath;
+        return false;
+    }
+    legs.diskLegs += written;
+    qCDebug(lcScenario) << "NetworkDistanceEngine::appendDiskCache:"
+                        << "appended" << written << "leg(s) to"
+                        << cachePath;
+    return true;
+}
+
+bool NetworkDistanceEngine::rewriteDiskCache(const QString    &cachePath,
+                                             const QByteArray &digest,
+                                             NetworkLegs      &legs) const
+{
+    // Over the cap, keep only what this engine requested; the rest was
+    // left by earlier runs and has not been needed since.
+    const qint64 total = legs.legs[0].size() + legs.legs[1].size();
+    const bool   evict = total > m_options.diskCacheMaxLegs;
+
+    QSaveFile out(cachePath);
+    if (!out.open(QIODevice::WriteOnly))
+    {
+        qCDebug(lcScenario) << "NetworkDistanceEngine::rewriteDiskCache:"
+                            << "cannot write" << cachePath
+                            << out.errorString();
+        return false;
+    }
+
+    QDataStream ds(&out);
+    configureStream(ds);
+    ds << kCacheMagic << kCacheFormatVersion;
+    ds.writeRawData(digest.constData(), digest.size());
+    qint64 written = 0;
+    for (int slot = 0; slot < 2; ++slot)
+    {
+        for (auto it = legs.legs[slot].constBegin();
+             it != legs.legs[slot].constEnd()
+             && written < m_options.diskCacheMaxLegs;
+             ++it)
+        {
+            if (evict && !legs.used[slot].contains(it.key()))
+                continue;
+            ds << static_cast<qint32>(it.key() >> 32)
+               << static_cast<qint32>(it.key() & 0xffffffffu)
+               << static_cast<quint8>(slot) << it->distanceMeters
+               << it->travelTimeSeconds;
+            ++written;
+        }
+    }
+    if (ds.status() != QDataStream::Ok || !out.commit())
+    {
+        qCDebug(lcScenario) << "NetworkDistanceEngine::rewriteDiskCache:"
+                            << "write failed for" << cachePath;
+        return false;
+    }
+    legs.diskLegs = written;
+    qCDebug(lcScenario) << "NetworkDistanceEngine::rewriteDiskCache: wrote"
+                        << written << "of" << total << "leg(s) to"
+                        << cachePath;
+    return true;
+}
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
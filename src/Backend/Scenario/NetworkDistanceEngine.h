@@ -0,0 +1,138 @@
+#pragma once
+
+#include "NetworkSpec.h"
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <limits>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+
+class NetworkController;
+
+namespace Scenario
+{
+
+class ScenarioDocument;
+
+/// Memoized network distances keyed by (network, fromNode, toNode, metric).
+///
+/// Callers `request()` every leg they need, call `resolve()` once, then
+/// `lookup()` the results. `resolve()` groups the pending legs by source
+/// node and runs one single-source search per source
+/// (`findShortestPaths`), which settles all of that source's targets at
+/// once and returns exactly what the point-to-point `findShortestPath`
+/// would. Sources run in parallel on the global QThreadPool. Resolved legs stay
+/// memoized for the engine's lifetime, so one engine can serve several
+/// populate passes.
+///
+/// With `Options::diskCache` set, each network's legs also persist to
+/// `<network>.<rail|truck>.distances.cnscache` in the CacheLocation
+/// directory of the network's first input file. The entry is keyed by the
+/// SHA-256 of the network input files; any content change discards it.
+/// Layout (little-endian):
+/// @code
+/// u32 magic 'CNSD' (0x44534E43), u16 format version, 32 × u8 sha256,
+/// then records to end of file: { i32 from, i32 to, u8 metric,
+///                                f64 metres, f64 seconds }
+/// @endcode
+/// Newly resolved legs are appended; a torn trailing record is ignored.
+/// Once the file would exceed `Options::diskCacheMaxLegs`, it is rewritten
+/// with only the legs this engine requested, so legs no recent run used
+/// are evicted. Unreachable legs are cached too (infinite metres/seconds).
+/// Failing to read or write a cache file is never an error for the caller.
+class NetworkDistanceEngine
+{
+public:
+    static constexpr quint32 kCacheMagic         = 0x44534E43u; // "CNSD"
+    static constexpr quint16 kCacheFormatVersion = 2;
+    static constexpr int     kDefaultDiskCacheMaxLegs = 1 << 20;
+
+    /// Search criterion. Truck networks only support Distance.
+    enum class Metric : quint8
+    {
+        Distance = 0,
+        Time     = 1
+    };
+
+    /// Metrics of one resolved leg, in canonical metres/seconds. An
+    /// unreachable leg keeps the ShortestPathResult defaults (infinity).
+    struct Leg
+    {
+        double distanceMeters    = std::numeric_limits<double>::infinity();
+        double travelTimeSeconds = std::numeric_limits<double>::infinity();
+    };
+
+    struct Options
+    {
+        bool diskCache        = false;
+        int  diskCacheMaxLegs = kDefaultDiskCacheMaxLegs; ///< per network
+        int  maxThreads       = 0; ///< 0 = QThread::idealThreadCount()
+    };
+
+    NetworkDistanceEngine(const ScenarioDocument  &doc,
+                          const NetworkController &networks,
+                          Options                  options = Options());
+
+    void request(NetworkSpec::Type type, const QString &region,
+                 const QString &network, int fromNode, int toNode,
+                 Metric metric = Metric::Distance);
+
+    /// Computes every pending leg not already memoized or cached on disk.
+    void resolve();
+
+    /// False when the leg was never requested and resolved, or when its
+    /// network is not loaded.
+    bool lookup(NetworkSpec::Type type, const QString &region,
+                const QString &network, int fromNode, int toNode,
+                Leg *leg, Metric metric = Metric::Distance) const;
+
+    /// Single-source searches run so far (one per distinct source node).
+    int searchCount() const { return m_searchCount; }
+    /// Legs served from disk cache entries so far.
+    int diskCacheHits() const { return m_diskCacheHits; }
+
+    /// Cache file path for @p spec, or empty when it has no input files.
+    static QString cachePathFor(const NetworkSpec &spec);
+
+private:
+    struct NetworkLegs
+    {
+        NetworkSpec::Type   type = NetworkSpec::Type::Rail;
+        QString             region;
+        QString             network;
+        QHash<quint64, Leg> legs[2];    ///< indexed by Metric
+        QSet<quint64>       pending[2]; ///< requested, not yet resolved
+        QSet<quint64>       used[2];    ///< requested by this engine
+        QList<quint64>      unsaved[2]; ///< resolved, not yet on disk
+        bool                diskChecked = false;
+        qint64              diskLegs    = -1; ///< records on disk; -1 = none
+    };
+
+    static QString networkKey(NetworkSpec::Type type, const QString &region,
+                              const QString &network);
+    static quint64 legKey(int fromNode, int toNode);
+
+    void loadDiskCache(NetworkLegs &legs);
+    void storeDiskCache(NetworkLegs &legs) const;
+    bool appendDiskCache(const QString &cachePath, NetworkLegs &legs) const;
+    bool rewriteDiskCache(const QString &cachePath, const QByteArray &digest,
+                          NetworkLegs &legs) const;
+    QByteArray contentDigest(const NetworkLegs &legs) const;
+
+    const ScenarioDocument     &m_doc;
+    const NetworkController    &m_networks;
+    Options                     m_options;
+    QHash<QString, NetworkLegs> m_byNetwork;
+    int                         m_searchCount   = 0;
+    int                         m_diskCacheHits = 0;
+};
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
@@ -5,6 +5,7 @@
 #include "Backend/Clients/TruckClient/TruckNetwork.h"
 #include "Backend/Clients/TruckClient/TruckSimulationManager.h"
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Commons/Trace.h"
 #include "Backend/Controllers/RegionDataController.h"
 #include "Backend/Scenario/NetworkLookup.h"
 #include "Backend/Scenario/SimulatorCommandAvailability.h"
@@ -35,13 +36,15 @@ NetworkExecutionSessionManager::NetworkExecutionSessionManager(
     TrainClient::TrainSimulationClient  *trainClient,
     ShipClient::ShipSimulationClient    *shipClient,
     TruckClient::TruckSimulationManager *truckManager,
-    const QString                       &truckExecutablePath)
+    const QString                       &truckExecutablePath,
+    bool                                 truckBatchTrips)
     : m_registry(registry)
     , m_regionDataController(regionDataController)
     , m_trainClient(trainClient)
     , m_shipClient(shipClient)
     , m_truckManager(truckManager)
     , m_truckExecutablePath(truckExecutablePath)
+    , m_truckBatchTrips(truckBatchTrips)
 {
 }
 
@@ -164,6 +167,9 @@ bool NetworkExecutionSessionManager::registerAssignments(
 bool NetworkExecutionSessionManager::advanceActiveSessions(
     double deltaTSeconds, QString *err)
 {
+    CNS_TRACE_SCOPE(Execution,
+                    "NetworkExecutionSessionManager::advanceActiveSessions");
+
     if (deltaTSeconds <= 0.0)
     {
         if (err)
@@ -468,9 +474,9 @@ bool NetworkExecutionSessionManager::dispatchTrainWave(
         record.state.mode =
             TransportationTypes::TransportationMode::Train;
 
-        QList<CargoNetSim::Backend::Train *> trains;
+        QJsonArray trains;
         for (const auto &dispatch : it.value())
-            trains.append(dispatch.train);
+            trains.append(dispatch.toJson());
 
         if (!record.state.defined)
         {
@@ -516,15 +522,14 @@ bool NetworkExecutionSessionManager::dispatchTrainWave(
         {
             if (!dispatch.containers.isEmpty()
                 && !m_trainClient->addContainersToTrain(
-                    networkName, dispatch.train->getUserId(),
+                    networkName, dispatch.trainId,
                     dispatch.containers))
             {
                 if (err)
                 {
                     *err = QStringLiteral(
                         "Failed to add containers to train %1 on %2")
-                               .arg(dispatch.train->getUserId(),
-                                    networkName);
+                               .arg(dispatch.trainId, networkName);
                 }
                 return false;
             }
@@ -554,12 +559,12 @@ bool NetworkExecutionSessionManager::dispatchShipWave(
         record.state.mode =
             TransportationTypes::TransportationMode::Ship;
 
-        QList<CargoNetSim::Backend::Ship *> ships;
+        QJsonArray ships;
         QMap<QString, QStringList> destinationTerminals;
         for (const auto &dispatch : it.value())
         {
-            ships.append(dispatch.ship);
-            destinationTerminals.insert(dispatch.ship->getUserId(),
+            ships.append(dispatch.toJson());
+            destinationTerminals.insert(dispatch.shipId,
                                         {dispatch.destinationTerminal});
         }
 
@@ -596,15 +601,14 @@ bool NetworkExecutionSessionManager::dispatchShipWave(
         {
             if (!dispatch.containers.isEmpty()
                 && !m_shipClient->addContainersToShip(
-                    networkName, dispatch.ship->getUserId(),
+                    networkName, dispatch.shipId,
                     dispatch.containers))
             {
                 if (err)
                 {
                     *err = QStringLiteral(
                         "Failed to add containers to ship %1 on %2")
-                               .arg(dispatch.ship->getUserId(),
-                                    networkName);
+                               .arg(dispatch.shipId, networkName);
                 }
                 return false;
             }
@@ -682,6 +686,7 @@ bool NetworkExecutionSessionManager::dispatchTruckWave(
             clientConfig.exePath = m_truckExecutablePath;
             clientConfig.masterFilePath = masterConfigPath;
             clientConfig.simTime = config->getSimTime();
+            clientConfig.batchTrips = m_truckBatchTrips;
             if (!m_truckManager->createClient(networkName,
                                               clientConfig))
             {
@@ -708,23 +713,31 @@ bool NetworkExecutionSessionManager::dispatchTruckWave(
             return false;
         }
 
+        client->setRoutingNetwork(networkName, config->getNetwork());
+
+        // One addTrips() per network per wave; a single message
+        // only when the bridge accepts ADD_TRIPS
+        QList<TruckClient::TripRequest> trips;
+        trips.reserve(it.value().size());
         for (const auto &dispatch : it.value())
         {
-            const QString tripId = client->addTrip(
-                networkName,
-                QString::number(dispatch.originNode),
-                QString::number(dispatch.destinationNode),
-                dispatch.containers);
-            if (tripId.isEmpty())
+            TruckClient::TripRequest trip;
+            trip.networkName   = networkName;
+            trip.originId      = dispatch.originNode;
+            trip.destinationId = dispatch.destinationNode;
+            trip.containers    = dispatch.containers;
+            trips.append(trip);
+        }
+        if (!trips.isEmpty()
+            && client->addTrips(networkName, trips).isEmpty())
+        {
+            if (err)
             {
-                if (err)
-                {
-                    *err = QStringLiteral(
-                        "Failed to add trip to truck session %1")
-                               .arg(networkName);
-                }
-                return false;
+                *err = QStringLiteral(
+                    "Failed to add trips to truck session %1")
+                           .arg(networkName);
             }
+            return false;
         }
     }
 
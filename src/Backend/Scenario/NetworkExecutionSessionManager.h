@@ -40,7 +40,8 @@ public:
         TrainClient::TrainSimulationClient        *trainClient,
         ShipClient::ShipSimulationClient          *shipClient,
         TruckClient::TruckSimulationManager       *truckManager,
-        const QString                             &truckExecutablePath = QString());
+        const QString                             &truckExecutablePath = QString(),
+        bool                                       truckBatchTrips = false);
 
     void clear();
 
@@ -103,6 +104,7 @@ private:
     ShipClient::ShipSimulationClient    *m_shipClient = nullptr;
     TruckClient::TruckSimulationManager *m_truckManager = nullptr;
     QString                              m_truckExecutablePath;
+    bool                                 m_truckBatchTrips = false;
     bool                                 m_trainModeInitialized = false;
     bool                                 m_shipModeInitialized = false;
     bool                                 m_truckModeInitialized = false;
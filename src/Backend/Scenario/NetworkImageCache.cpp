@@ -0,0 +1,160 @@
+#include "NetworkImageCache.h"
+#include "CacheLocation.h"
+
+#include "Backend/Clients/TrainClient/TrainNetwork.h"
+#include "Backend/Clients/TruckClient/TruckNetwork.h"
+#include "Backend/Commons/LogCategories.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+namespace
+{
+
+constexpr int kDigestSize = 32; // SHA-256
+
+bool addFile(QCryptographicHash &hash, const QString &role,
+             const QString &path)
+{
+    QFile f(path);
+    if (!f.open(QIODevice::ReadOnly))
+        return false;
+    hash.addData(role.toUtf8());
+    return hash.addData(&f);
+}
+
+/// Truck configs name further inputs; the graph comes from these two.
+QByteArray truckDigest(const NetworkSpec                              &spec,
+                       const TruckClient::IntegrationSimulationConfig &config)
+{
+    const QByteArray base = NetworkImageCache::contentDigest(spec);
+    if (base.size() != kDigestSize)
+        return QByteArray();
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(base);
+    try
+    {
+        for (const char *role : {"node_coordinates", "link_structure"})
+        {
+            const QString key = QString::fromLatin1(role);
+            if (!addFile(hash, key, config.getInputFilePath(key)))
+                return QByteArray();
+        }
+    }
+    catch (const std::exception &)
+    {
+        return QByteArray(); // config without those inputs
+    }
+    return hash.result();
+}
+
+template <typename Network>
+std::shared_ptr<const NetworkImage>
+openOrBuild(const NetworkSpec &spec, const QByteArray &digest,
+            const Network &network)
+{
+    const QString path = NetworkImageCache::imagePathFor(spec);
+    if (path.isEmpty() || digest.size() != kDigestSize)
+        return nullptr;
+
+    QString reason;
+    if (auto image = NetworkImage::open(path, digest, &reason))
+        return image;
+    qCDebug(lcScenario) << "NetworkImageCache: miss for" << spec.name
+                        << "-" << reason;
+
+    NetworkImage::Builder builder;
+    network.writeImage(builder);
+    QString error;
+    if (!NetworkImage::store(path, builder, digest, &error))
+    {
+        qCDebug(lcScenario) << "NetworkImageCache: cannot write" << path
+                            << "-" << error;
+        return nullptr;
+    }
+    auto image = NetworkImage::open(path, digest, &reason);
+    if (!image)
+        qCWarning(lcScenario) << "NetworkImageCache: wrote" << path
+                              << "but cannot open it -" << reason;
+    return image;
+}
+
+} // namespace
+
+QString NetworkImageCache::imagePathFor(const NetworkSpec &spec)
+{
+    if (spec.files.isEmpty())
+        return QString();
+    return CacheLocation::filePathFor(
+        spec.files.first(),
+        QStringLiteral("%1.%2.image.cnscache")
+            .arg(spec.name, networkKindToString(spec.type).toLower()));
+}
+
+QByteArray NetworkImageCache::contentDigest(const NetworkSpec &spec)
+{
+    if (spec.files.isEmpty())
+        return QByteArray();
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(networkKindToString(spec.type).toUtf8());
+    for (auto it = spec.files.constBegin(); it != spec.files.constEnd();
+         ++it)
+    {
+        if (!addFile(hash, it.key(), it.value()))
+            return QByteArray(); // never key against a missing input
+    }
+    return hash.result();
+}
+
+std::shared_ptr<const NetworkImage>
+NetworkImageCache::openRail(const NetworkSpec &spec)
+{
+    const QString path = imagePathFor(spec);
+    if (path.isEmpty() || !QFileInfo::exists(path))
+        return nullptr;
+    QString reason;
+    auto    image = NetworkImage::open(path, contentDigest(spec), &reason);
+    if (image)
+        qCInfo(lcScenario) << "NetworkImageCache::openRail: hit" << path
+                           << "-" << image->nodeCount() << "nodes,"
+                           << image->edgeCount() << "edges";
+    else
+        qCDebug(lcScenario) << "NetworkImageCache::openRail: miss" << path
+                            << "-" << reason;
+    return image;
+}
+
+bool NetworkImageCache::attach(const NetworkSpec              &spec,
+                               TrainClient::NeTrainSimNetwork &network)
+{
+    if (network.image())
+        return true;
+    auto image = openOrBuild(spec, contentDigest(spec), network);
+    return image && network.attachImage(std::move(image));
+}
+
+bool NetworkImageCache::attach(
+    const NetworkSpec                        &spec,
+    TruckClient::IntegrationSimulationConfig &config)
+{
+    TruckClient::IntegrationNetwork *network = config.getNetwork();
+    if (!network)
+        return false;
+    if (network->image())
+        return true;
+    auto image = openOrBuild(spec, truckDigest(spec, config), *network);
+    return image && network->attachImage(std::move(image));
+}
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
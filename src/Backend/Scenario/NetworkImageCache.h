@@ -0,0 +1,69 @@
+#pragma once
+
+#include "NetworkSpec.h"
+
+#include "Backend/Commons/NetworkImage.h"
+
+#include <QByteArray>
+#include <QString>
+#include <memory>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+
+namespace TrainClient
+{
+class NeTrainSimNetwork;
+}
+namespace TruckClient
+{
+class IntegrationSimulationConfig;
+}
+
+namespace Scenario
+{
+
+/// NetworkImage files for scenario networks, in the per-user cache
+/// directory (see CacheLocation).
+///
+/// Each rail or truck network gets `<network>.<rail|truck>.image.cnscache`
+/// in the CacheLocation directory of its first input file, keyed by the
+/// SHA-256 of its input files (for truck networks also the node and link
+/// files the config names).
+/// attach() opens a fresh image — shared with every other runtime and
+/// process that mapped it — or builds one from the loaded network and
+/// writes it, then points the network's shortest-path searches at it.
+/// Rail networks also drop their in-memory graph; truck networks keep
+/// theirs for the queries the image does not serve.
+///
+/// Failing to read, build or write an image is never an error for the
+/// caller: the network simply keeps searching its own graph.
+///
+/// Stateless — all methods are static.
+class NetworkImageCache
+{
+public:
+    /// Image path for @p spec, or empty when it has no input files.
+    static QString imagePathFor(const NetworkSpec &spec);
+
+    /// SHA-256 over the network kind and every input file (role name and
+    /// contents); empty when an input cannot be read.
+    static QByteArray contentDigest(const NetworkSpec &spec);
+
+    /// Fresh image of a rail network's inputs, or nullptr. Pass it to
+    /// NeTrainSimNetwork::loadNetwork to skip building the graph.
+    static std::shared_ptr<const NetworkImage>
+    openRail(const NetworkSpec &spec);
+
+    /// No-op returning true when @p network already has an image.
+    static bool attach(const NetworkSpec              &spec,
+                       TrainClient::NeTrainSimNetwork &network);
+    static bool attach(const NetworkSpec                      &spec,
+                       TruckClient::IntegrationSimulationConfig &config);
+};
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
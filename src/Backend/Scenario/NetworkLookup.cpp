@@ -14,6 +14,21 @@ namespace Scenario
 namespace NetworkLookup
 {
 
+namespace
+{
+
+/// Region data of the runtime context the registry was applied from.
+Backend::RegionData *liveRegionData(const ScenarioRegistry &registry,
+                                    const QString          &regionName)
+{
+    auto *controller = registry.controller();
+    auto *rdc = controller ? controller->getRegionDataController()
+                           : nullptr;
+    return rdc ? rdc->getRegionData(regionName) : nullptr;
+}
+
+} // namespace
+
 QMap<QString, TrainClient::NeTrainSimNetwork *>
 collectRail(const ScenarioRegistry &registry,
             const QString          &regionName)
@@ -32,10 +47,7 @@ collectRail(const ScenarioRegistry &registry,
                             << "preview rail networks";
         return result;
     }
-    auto *rdc =
-        CargoNetSim::CargoNetSimController::getInstance()
-            .getRegionDataController();
-    auto *rd = rdc ? rdc->getRegionData(regionName) : nullptr;
+    auto *rd = liveRegionData(registry, regionName);
     if (!rd)
     {
         qCWarning(lcScenario) << "NetworkLookup::collectRail:"
@@ -69,10 +81,7 @@ collectTruck(const ScenarioRegistry &registry,
                             << "preview truck networks";
         return result;
     }
-    auto *rdc =
-        CargoNetSim::CargoNetSimController::getInstance()
-            .getRegionDataController();
-    auto *rd = rdc ? rdc->getRegionData(regionName) : nullptr;
+    auto *rd = liveRegionData(registry, regionName);
     if (!rd)
     {
         qCWarning(lcScenario) << "NetworkLookup::collectTruck:"
@@ -144,10 +153,7 @@ findTruckConfig(const ScenarioRegistry &registry,
         return cfg;
     }
 
-    auto *rdc =
-        CargoNetSim::CargoNetSimController::getInstance()
-            .getRegionDataController();
-    auto *rd = rdc ? rdc->getRegionData(regionName) : nullptr;
+    auto *rd = liveRegionData(registry, regionName);
     if (!rd)
     {
         qCWarning(lcScenario) << "NetworkLookup::findTruckConfig:"
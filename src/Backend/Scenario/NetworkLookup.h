@@ -28,7 +28,7 @@ class RegionData;
  * Preferred resolution order:
  *   1. If the registry holds preview networks (CLI preview / headless
  *      path), return those.
- *   2. Otherwise walk CargoNetSimController::getInstance() →
+ *   2. Otherwise walk the registry's controller →
  *      RegionDataController::getRegionData(regionName) → network.
  *
  * Stateless — free functions. No caching; callers pace the lookups.
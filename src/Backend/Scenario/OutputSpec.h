@@ -14,7 +14,9 @@ namespace Scenario
 struct OutputSpec
 {
     QString     directory        = QStringLiteral("./results");
-    QStringList formats          = { QStringLiteral("json") };  ///< "json" | "csv"
+    /// "json" | "csv" | "ndjson" | "columnar". `ndjson` and `columnar`
+    /// are streamed per path during the run; see the CLI output writers.
+    QStringList formats          = { QStringLiteral("json") };
     bool        containerTracking = true;
 };
 
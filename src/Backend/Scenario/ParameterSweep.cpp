@@ -0,0 +1,385 @@
+#include "ParameterSweep.h"
+
+#include "Backend/Commons/LogCategories.h"
+#include "Backend/Controllers/ConfigController.h"
+#include "Backend/Models/Path.h"
+#include "EstimatedPathCostCalculator.h"
+#include "PathDemandResolver.h"
+#include "PathPreparationService.h"
+#include "PropertyKeys.h"
+#include "ScenarioDocument.h"
+#include "SegmentCostMath.h"
+
+#include <QHash>
+#include <QScopeGuard>
+#include <QStringList>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+namespace
+{
+
+namespace PK = PropertyKeys;
+
+/// Upper bound on values produced by one `start:stop:step` range.
+constexpr int kMaxRangeValues = 10000;
+
+/// Upper bound on grid points; each one re-scores every prepared path.
+constexpr int kMaxGridPoints = 100000;
+
+QVariant parseToken(const QString &token)
+{
+    if (token.compare(QLatin1String("true"), Qt::CaseInsensitive) == 0)
+        return true;
+    if (token.compare(QLatin1String("false"), Qt::CaseInsensitive) == 0)
+        return false;
+    bool         ok = false;
+    const double number = token.toDouble(&ok);
+    if (ok)
+        return number;
+    return token;
+}
+
+bool parseRange(const QStringList &parts, QVariantList *values,
+                QString *err)
+{
+    bool         okStart = false;
+    bool         okStop  = false;
+    bool         okStep  = false;
+    const double start   = parts.at(0).trimmed().toDouble(&okStart);
+    const double stop    = parts.at(1).trimmed().toDouble(&okStop);
+    const double step    = parts.at(2).trimmed().toDouble(&okStep);
+    if (!okStart || !okStop || !okStep || step <= 0.0 || stop < start)
+    {
+        if (err)
+            *err = QStringLiteral(
+                "range must be start:stop:step with step > 0 "
+                "and stop >= start");
+        return false;
+    }
+
+    const double count = std::floor((stop - start) / step + 1e-9) + 1.0;
+    if (count > kMaxRangeValues)
+    {
+        if (err)
+            *err = QStringLiteral("range yields more than %1 values")
+                       .arg(kMaxRangeValues);
+        return false;
+    }
+    for (int i = 0; i < static_cast<int>(count); ++i)
+        values->append(start + step * i);
+    return true;
+}
+
+void setValueAt(QVariantMap &map, const QStringList &path, int depth,
+                const QVariant &value)
+{
+    const QString &key = path.at(depth);
+    if (depth == path.size() - 1)
+    {
+        map.insert(key, value);
+        return;
+    }
+    QVariantMap child = map.value(key).toMap();
+    setValueAt(child, path, depth + 1, value);
+    map.insert(key, child);
+}
+
+struct Candidate
+{
+    const PreparedPathRecord *record = nullptr;
+    PathKey                   key;
+    int                       previewContainerCount = 0;
+};
+
+} // namespace
+
+bool ParameterGrid::parseAxis(const QString      &spec,
+                              ParameterSweepAxis *axis,
+                              QString            *err)
+{
+    const int eq = spec.indexOf(QLatin1Char('='));
+    const QString key =
+        eq < 0 ? QString() : spec.left(eq).trimmed();
+    if (key.isEmpty())
+    {
+        if (err)
+            *err = QStringLiteral("expected KEY=VALUES, got '%1'")
+                       .arg(spec);
+        return false;
+    }
+
+    const QString valueSpec = spec.mid(eq + 1).trimmed();
+    QVariantList  values;
+    const QStringList rangeParts = valueSpec.split(QLatin1Char(':'));
+    if (rangeParts.size() == 3)
+    {
+        if (!parseRange(rangeParts, &values, err))
+            return false;
+    }
+    else
+    {
+        for (const QString &part :
+             valueSpec.split(QLatin1Char(','), Qt::SkipEmptyParts))
+        {
+            const QString token = part.trimmed();
+            if (!token.isEmpty())
+                values.append(parseToken(token));
+        }
+    }
+
+    if (values.isEmpty())
+    {
+        if (err)
+            *err = QStringLiteral("'%1' has no values").arg(key);
+        return false;
+    }
+
+    axis->key    = key;
+    axis->values = std::move(values);
+    return true;
+}
+
+bool ParameterGrid::isCostOnlyKey(const QString &key)
+{
+    const QStringList parts = key.split(QLatin1Char('.'));
+    if (parts.size() == 2)
+    {
+        if (parts.at(0) == QLatin1String("carbon_taxes")
+            || parts.at(0) == QLatin1String("fuel_prices"))
+            return !parts.at(1).isEmpty();
+        if (parts.at(0) == QLatin1String("simulation"))
+            return parts.at(1) == PK::Simulation::TimeValueOfMoney
+                || parts.at(1) == PK::Simulation::UseModeSpecific;
+        return false;
+    }
+    if (parts.size() == 3 && parts.at(0) == QLatin1String("transport_modes"))
+    {
+        static const QStringList modes{QStringLiteral("ship"),
+                                       QStringLiteral("rail"),
+                                       QStringLiteral("truck")};
+        return modes.contains(parts.at(1))
+            && (parts.at(2) == PK::Mode::RiskFactor
+                || parts.at(2) == PK::Mode::TimeValueOfMoney);
+    }
+    return false;
+}
+
+QVariantMap ParameterGrid::applyPoint(const QVariantMap &config,
+                                      const QVariantMap &point)
+{
+    QVariantMap out = config;
+    for (auto it = point.constBegin(); it != point.constEnd(); ++it)
+        setValueAt(out, it.key().split(QLatin1Char('.')), 0, it.value());
+    return out;
+}
+
+bool ParameterGrid::addAxis(const ParameterSweepAxis &axis, QString *err)
+{
+    if (!isCostOnlyKey(axis.key))
+    {
+        if (err)
+            *err = QStringLiteral(
+                       "'%1' cannot be swept: only carbon_taxes.*, "
+                       "fuel_prices.*, simulation.time_value_of_money, "
+                       "simulation.use_mode_specific and "
+                       "transport_modes.<mode>.{risk_factor,"
+                       "time_value_of_money} leave the prepared "
+                       "estimates valid")
+                       .arg(axis.key);
+        return false;
+    }
+    if (axis.values.isEmpty())
+    {
+        if (err)
+            *err = QStringLiteral("'%1' has no values").arg(axis.key);
+        return false;
+    }
+    if (pointCount() > kMaxGridPoints / axis.values.size())
+    {
+        if (err)
+            *err = QStringLiteral("grid would exceed %1 points")
+                       .arg(kMaxGridPoints);
+        return false;
+    }
+    for (const auto &existing : m_axes)
+    {
+        if (existing.key == axis.key)
+        {
+            if (err)
+                *err = QStringLiteral("'%1' is swept twice").arg(axis.key);
+            return false;
+        }
+    }
+    m_axes.append(axis);
+    return true;
+}
+
+int ParameterGrid::pointCount() const
+{
+    int count = 1;
+    for (const auto &axis : m_axes)
+        count *= axis.values.size();
+    return count;
+}
+
+QVariantMap ParameterGrid::pointAt(int index) const
+{
+    QVariantMap point;
+    for (int i = m_axes.size() - 1; i >= 0; --i)
+    {
+        const auto &axis = m_axes.at(i);
+        const int   n    = axis.values.size();
+        point.insert(axis.key, axis.values.at(index % n));
+        index /= n;
+    }
+    return point;
+}
+
+namespace ParameterSweep
+{
+
+QList<ParameterSweepVariant> evaluate(
+    const PreparedPathSet  &prepared,
+    const ScenarioDocument &doc,
+    ConfigController       &config,
+    const ParameterGrid    &grid,
+    int                     selectPerPair)
+{
+    QList<ParameterSweepVariant> variants;
+
+    // Demand and OD identity do not depend on the weights; resolve
+    // them once for the whole grid.
+    QVector<Candidate> candidates;
+    candidates.reserve(prepared.size());
+    const auto &keys = prepared.pathKeysByExecutionPathKey();
+    for (const auto &record : prepared.records())
+    {
+        if (!record.path || record.path->getSegments().isEmpty())
+            continue;
+        Candidate candidate;
+        candidate.record = &record;
+        candidate.key    = keys.value(record.executionPathKey);
+        candidate.previewContainerCount =
+            PathDemandResolver::previewContainerCount(doc, *record.path);
+        candidates.append(candidate);
+    }
+
+    const QVariantMap base = config.getAllParams();
+    auto restoreConfig = qScopeGuard([&] { config.updateConfig(base); });
+
+    QHash<QString, int> variantBySelection;
+    const int pointCount = grid.pointCount();
+    variants.reserve(pointCount);
+    for (int index = 0; index < pointCount; ++index)
+    {
+        ParameterSweepVariant variant;
+        variant.index      = index;
+        variant.parameters = grid.pointAt(index);
+
+        config.updateConfig(
+            ParameterGrid::applyPoint(base, variant.parameters));
+        variant.costFunctionWeights = config.getCostFunctionWeights();
+        variant.transportModes      = config.getTransportModes();
+        const QVariantMap &weights = variant.costFunctionWeights;
+        const QVariantMap &modes   = variant.transportModes;
+
+        variant.paths.reserve(candidates.size());
+        for (const auto &candidate : candidates)
+        {
+            const auto cost = EstimatedPathCostCalculator::compute(
+                *candidate.record->path, weights, modes,
+                candidate.previewContainerCount);
+            RescoredPath rescored;
+            rescored.executionPathKey =
+                candidate.record->executionPathKey;
+            rescored.key          = candidate.key;
+            rescored.edgeCost     = cost.edgeCost;
+            rescored.terminalCost = cost.terminalCost;
+            rescored.totalCost    = cost.totalCost;
+            rescored.metrics      = cost.metrics;
+            variant.paths.append(std::move(rescored));
+        }
+
+        std::stable_sort(
+            variant.paths.begin(), variant.paths.end(),
+            [](const RescoredPath &a, const RescoredPath &b) {
+                if (a.key.originId != b.key.originId)
+                    return a.key.originId < b.key.originId;
+                if (a.key.destinationId != b.key.destinationId)
+                    return a.key.destinationId < b.key.destinationId;
+                if (a.totalCost != b.totalCost)
+                    return a.totalCost < b.totalCost;
+                return a.key.rank < b.key.rank;
+            });
+
+        QStringList signature;
+        for (int i = 0; i < variant.paths.size(); ++i)
+        {
+            auto &path = variant.paths[i];
+            const bool samePair =
+                i > 0
+                && variant.paths.at(i - 1).key.originId
+                       == path.key.originId
+                && variant.paths.at(i - 1).key.destinationId
+                       == path.key.destinationId;
+            path.sweepRank =
+                samePair ? variant.paths.at(i - 1).sweepRank + 1 : 0;
+            if (path.sweepRank < selectPerPair)
+            {
+                variant.selectedExecutionPathKeys.append(
+                    path.executionPathKey);
+                signature.append(path.executionPathKey);
+            }
+        }
+
+        signature.sort();
+        const QString selection = signature.join(QLatin1Char('\n'));
+        variant.simulatedByVariant =
+            variantBySelection.value(selection, index);
+        if (variant.simulatedByVariant == index)
+            variantBySelection.insert(selection, index);
+
+        variants.append(std::move(variant));
+    }
+
+    qCDebug(lcScenario) << "ParameterSweep::evaluate:" << pointCount
+                        << "point(s) over" << candidates.size()
+                        << "path(s)," << variantBySelection.size()
+                        << "distinct selection(s)";
+    return variants;
+}
+
+QHash<QString, double> simulatedTotalCosts(
+    const ParameterSweepVariant      &variant,
+    const ParameterSweepVariant      &simulatedBy,
+    const QList<PathExecutionResult> &results)
+{
+    QHash<QString, double> costs;
+    costs.reserve(results.size());
+    for (const auto &result : results)
+    {
+        const double totalCost =
+            variant.index == simulatedBy.index
+                ? result.totalCost
+                : SegmentCostMath::recostPathExecutionResult(
+                      result, variant.costFunctionWeights,
+                      variant.transportModes, simulatedBy.transportModes)
+                      .totalCost;
+        costs.insert(result.executionPathKey, totalCost);
+    }
+    return costs;
+}
+
+} // namespace ParameterSweep
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QVariantList>
+#include <QVariantMap>
+#include <QVector>
+
+#include "PathKey.h"
+#include "PathMetrics.h"
+#include "ScenarioExecutionResult.h"
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+
+class ConfigController;
+
+namespace Scenario
+{
+
+class PreparedPathSet;
+class ScenarioDocument;
+
+/// One swept configuration value: a dotted path into the
+/// ConfigController parameter map (e.g. `carbon_taxes.rate`,
+/// `fuel_prices.diesel_2`, `transport_modes.truck.risk_factor`) and
+/// the values to try, in order.
+struct ParameterSweepAxis
+{
+    QString      key;
+    QVariantList values;
+};
+
+/**
+ * @brief Cartesian product of sweep axes.
+ *
+ * Points are numbered row-major: the last axis varies fastest, so a
+ * grid over `a=1,2` and `b=x,y` yields (1,x) (1,y) (2,x) (2,y).
+ *
+ * Only keys that feed the cost function weights alone can be swept
+ * (see isCostOnlyKey()); anything that changes estimated physics —
+ * speeds, fuel consumption, fuel energy or carbon content — would
+ * invalidate the shared preparation.
+ */
+class ParameterGrid
+{
+public:
+    /// Parse `key=v1,v2,...` or `key=start:stop:step`. Numeric and
+    /// boolean tokens become numbers/bools, anything else a string.
+    static bool parseAxis(const QString      &spec,
+                          ParameterSweepAxis *axis,
+                          QString            *err = nullptr);
+
+    static bool isCostOnlyKey(const QString &key);
+
+    /// Copy of @p config with every `key -> value` of @p point set.
+    static QVariantMap applyPoint(const QVariantMap &config,
+                                  const QVariantMap &point);
+
+    bool addAxis(const ParameterSweepAxis &axis,
+                 QString                  *err = nullptr);
+
+    const QList<ParameterSweepAxis> &axes() const { return m_axes; }
+    bool isEmpty() const { return m_axes.isEmpty(); }
+
+    int         pointCount() const;
+    QVariantMap pointAt(int index) const;
+
+private:
+    QList<ParameterSweepAxis> m_axes;
+};
+
+/// Estimated cost of one prepared path at one grid point.
+struct RescoredPath
+{
+    QString     executionPathKey;
+    PathKey     key;            ///< OD pair and discovery rank
+    int         sweepRank = 0;  ///< 0-based rank within the OD pair
+    double      edgeCost = 0.0;
+    double      terminalCost = 0.0;
+    double      totalCost = 0.0;
+    PathMetrics metrics;
+};
+
+struct ParameterSweepVariant
+{
+    int         index = 0;
+    QVariantMap parameters;
+
+    /// Cost function weights and transport modes the config derives
+    /// from `parameters`; used to re-price a shared simulation.
+    QVariantMap costFunctionWeights;
+    QVariantMap transportModes;
+
+    /// Every prepared path, ordered by OD pair then sweepRank.
+    QList<RescoredPath> paths;
+
+    /// The best `selectPerPair` paths of every OD pair, in the order
+    /// of `paths`.
+    QVector<QString> selectedExecutionPathKeys;
+
+    /// Index of the first variant with the same selection. Only that
+    /// variant is simulated; the others re-price its results with
+    /// their own weights (see simulatedTotalCosts()).
+    int simulatedByVariant = 0;
+
+    bool needsSimulation() const { return simulatedByVariant == index; }
+};
+
+namespace ParameterSweep
+{
+
+/**
+ * @brief Re-score and re-rank @p prepared at every point of @p grid.
+ *
+ * Distances and estimated physics on the prepared paths are reused
+ * as-is; only EstimatedPathCostCalculator runs per point, with the
+ * weights @p config derives from the point's overrides. @p config is
+ * restored to its original parameters before returning, and the
+ * prepared paths themselves are not modified.
+ */
+QList<ParameterSweepVariant> evaluate(
+    const PreparedPathSet  &prepared,
+    const ScenarioDocument &doc,
+    ConfigController       &config,
+    const ParameterGrid    &grid,
+    int                     selectPerPair);
+
+/**
+ * @brief Simulated total cost of each path, priced for @p variant.
+ *
+ * @p results come from the run of @p simulatedBy, the variant named by
+ * `variant.simulatedByVariant`. Their actual metrics are re-costed
+ * with @p variant's weights and transport modes, so a variant that
+ * shares another's run still reports its own carbon tax and fuel
+ * prices. Keyed by execution path key.
+ */
+QHash<QString, double> simulatedTotalCosts(
+    const ParameterSweepVariant       &variant,
+    const ParameterSweepVariant       &simulatedBy,
+    const QList<PathExecutionResult>  &results);
+
+} // namespace ParameterSweep
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
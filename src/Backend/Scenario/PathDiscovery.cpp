@@ -3,6 +3,7 @@
 #include "Backend/Clients/BaseClient/RabbitMQHandler.h"
 #include "Backend/Clients/TerminalClient/TerminalSimulationClient.h"
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Commons/Trace.h"
 #include "Backend/Commons/TransportationMode.h"
 #include "Backend/Controllers/CargoNetSimController.h"
 #include "Backend/Models/Path.h"
@@ -10,7 +11,9 @@
 #include "Backend/Scenario/ScenarioRegistry.h"
 #include "Backend/Scenario/SimulatorCommandAvailability.h"
 #include "Backend/Scenario/TerminalGraphBootstrap.h"
+#include "Backend/Scenario/TopPathCache.h"
 
+#include <QJsonArray>
 #include <QThread>
 
 namespace CargoNetSim {
@@ -40,15 +43,19 @@ bool isTerminalKnownToServer(TerminalSimulationClient *client,
 
 } // namespace
 
-QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
+PathDiscovery::DiscoveredPaths PathDiscovery::findTopPathViews(
     const ScenarioDocument &doc,
     const ScenarioRegistry &registry,
     int                     n,
-    QString                *err)
+    QString                *err,
+    const Options          &options)
 {
-    QList<Path *> result;
+    CNS_TRACE_SCOPE_DETAIL(Discovery, "PathDiscovery::findTopPathViews",
+                           QStringLiteral("topN=%1").arg(n));
+
+    DiscoveredPaths result;
 
-    qCInfo(lcScenario) << "PathDiscovery::findTopPaths:"
+    qCInfo(lcScenario) << "PathDiscovery::findTopPathViews:"
                        << "topN =" << n;
 
     // --- Origin/destination pairs from the document ----------------------
@@ -63,32 +70,36 @@ QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
     // `destinations: [{t,f}]` resolves to the explicit split list.
     // Terminal roles are presentation metadata and are not used for demand.
     const QStringList originIds = doc.originTerminalIds();
-    qCInfo(lcScenario) << "PathDiscovery::findTopPaths:"
+    qCInfo(lcScenario) << "PathDiscovery::findTopPathViews:"
                        << "origin count =" << originIds.size();
     if (originIds.isEmpty())
     {
-        qCWarning(lcScenario) << "PathDiscovery::findTopPaths:"
+        qCWarning(lcScenario) << "PathDiscovery::findTopPathViews:"
                               << "no origin terminals — returning early";
         return result;
     }
 
     // --- Controller + client presence ------------------------------------
-    auto &controller     = CargoNetSim::CargoNetSimController::getInstance();
+    auto &controller =
+        options.controller
+            ? *options.controller
+            : CargoNetSim::CargoNetSimController::getInstance();
     auto *terminalClient = controller.getTerminalClient();
     if (!terminalClient)
     {
-        qCCritical(lcScenario) << "PathDiscovery::findTopPaths:"
+        qCCritical(lcScenario) << "PathDiscovery::findTopPathViews:"
                                << "TerminalSim client unavailable";
         if (err) *err = QStringLiteral("TerminalSim client unavailable");
         return result;
     }
+    result.client = terminalClient;
 
     if (!isCommandAvailable(terminalClient))
     {
         auto *handler = terminalClient->getRabbitMQHandler();
         auto *clientThread =
             qobject_cast<QThread *>(terminalClient->thread());
-        qCCritical(lcScenario) << "PathDiscovery::findTopPaths:"
+        qCCritical(lcScenario) << "PathDiscovery::findTopPathViews:"
                                << "TerminalSim command queue is unavailable"
                                << "clientThread=" << terminalClient->thread()
                                << "clientThreadRunning="
@@ -109,11 +120,17 @@ QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
         return result;
     }
 
+    // The graph is loaded even when every pair is cached: execution
+    // runs against the TerminalSim state discovery leaves behind.
+    const TopPathCache cache(options.cacheDirectory,
+                             options.cacheCapacity);
+    QByteArray         fingerprint;
     if (!TerminalGraphBootstrap::resetAndLoad(
             doc, registry, controller, err,
-            QStringLiteral("PathDiscovery::findTopPaths")))
+            QStringLiteral("PathDiscovery::findTopPathViews"),
+            cache.isEnabled() ? &fingerprint : nullptr))
     {
-        qCCritical(lcScenario) << "PathDiscovery::findTopPaths:"
+        qCCritical(lcScenario) << "PathDiscovery::findTopPathViews:"
                                << "failed to load TerminalSim baseline"
                                << (err ? *err : QString());
         return result;
@@ -126,11 +143,15 @@ QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
     // set of distinct endpoints. Option X invariant (2026-04-14): the
     // origin-level DestinationRoute is the single source; per-container
     // destinations do not exist.
+    const int anyMode = TransportationTypes::toInt(
+        TransportationTypes::TransportationMode::Any);
+    int cacheHits   = 0;
+    int cacheStores = 0;
     for (const QString &originId : originIds)
     {
         if (!isTerminalKnownToServer(terminalClient, originId))
         {
-            qCWarning(lcScenario) << "PathDiscovery::findTopPaths:"
+            qCWarning(lcScenario) << "PathDiscovery::findTopPathViews:"
                                   << "origin" << originId
                                   << "not found on graph server";
             if (err) *err = QStringLiteral(
@@ -144,7 +165,7 @@ QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
             const QString &destId = route.terminal;
             if (!isTerminalKnownToServer(terminalClient, destId))
             {
-                qCWarning(lcScenario) << "PathDiscovery::findTopPaths:"
+                qCWarning(lcScenario) << "PathDiscovery::findTopPathViews:"
                                       << "destination" << destId
                                       << "(from origin" << originId
                                       << ") not found on graph server";
@@ -154,29 +175,69 @@ QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
                     .arg(destId, originId);
                 return result;
             }
-            qCDebug(lcScenario) << "PathDiscovery::findTopPaths:"
+            qCDebug(lcScenario) << "PathDiscovery::findTopPathViews:"
                                << "exploring" << originId << "->" << destId;
-            const auto pairPaths = terminalClient->findTopPaths(
-                originId, destId, n,
-                TransportationTypes::TransportationMode::Any,
-                /*skipDelays=*/true);
-            pathsForOrigin += pairPaths.size();
-            result.append(pairPaths);
+            const QString pairKey =
+                TerminalSimulationClient::makeTopPathsCacheKey(
+                    originId, destId, anyMode, n, /*skipDelays=*/true);
+            QList<TerminalSimulationClient::TopPathView> views;
+            QJsonArray                                   cached;
+            if (cache.load(fingerprint, pairKey, &cached))
+            {
+                ++cacheHits;
+                for (const QJsonValue &value : std::as_const(cached))
+                    views.append(TerminalSimulationClient::TopPathView::
+                                     fromJson(value.toObject()));
+            }
+            else
+            {
+                views = terminalClient->findTopPathViews(
+                    originId, destId, n,
+                    TransportationTypes::TransportationMode::Any,
+                    /*skipDelays=*/true);
+                // An empty answer may be a failed request; ask again
+                // next time rather than caching it.
+                if (cache.isEnabled() && !views.isEmpty())
+                {
+                    QJsonArray payload;
+                    for (const auto &view : std::as_const(views))
+                        payload.append(view.json);
+                    QString storeError;
+                    if (cache.store(fingerprint, pairKey, payload,
+                                    &storeError))
+                        ++cacheStores;
+                    else
+                        qCDebug(lcScenario)
+                            << "PathDiscovery::findTopPathViews:"
+                            << "cannot cache" << pairKey << "-"
+                            << storeError;
+                }
+            }
+            pathsForOrigin += views.size();
+            result.views.append(views);
         }
-        qCDebug(lcScenario) << "PathDiscovery::findTopPaths:"
+        qCDebug(lcScenario) << "PathDiscovery::findTopPathViews:"
                             << "origin" << originId
                             << "-> paths found =" << pathsForOrigin;
         if (pathsForOrigin == 0)
-            qCWarning(lcScenario) << "PathDiscovery::findTopPaths:"
+            qCWarning(lcScenario) << "PathDiscovery::findTopPathViews:"
                                   << "no paths found for origin" << originId;
     }
 
-    qCInfo(lcScenario) << "PathDiscovery::findTopPaths:"
-                       << "total paths discovered =" << result.size();
+    qCInfo(lcScenario) << "PathDiscovery::findTopPathViews:"
+                       << "total paths discovered =" << result.views.size();
+    if (cache.isEnabled())
+    {
+        qCInfo(lcScenario) << "PathDiscovery::findTopPathViews:"
+                           << "path cache hits =" << cacheHits
+                           << "stored =" << cacheStores;
+        if (cacheStores > 0)
+            cache.trim();
+    }
 
-    if (result.isEmpty())
+    if (result.views.isEmpty())
     {
-        qCWarning(lcScenario) << "PathDiscovery::findTopPaths:"
+        qCWarning(lcScenario) << "PathDiscovery::findTopPathViews:"
                               << "returning with no paths discovered";
         if (err)
             *err = QStringLiteral(
@@ -185,6 +246,26 @@ QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
     return result;
 }
 
+QList<CargoNetSim::Backend::Path *> PathDiscovery::findTopPaths(
+    const ScenarioDocument &doc,
+    const ScenarioRegistry &registry,
+    int                     n,
+    QString                *err,
+    const Options          &options)
+{
+    const DiscoveredPaths discovered =
+        findTopPathViews(doc, registry, n, err, options);
+
+    QList<Path *> result;
+    result.reserve(discovered.views.size());
+    for (const auto &view : discovered.views)
+    {
+        if (Path *path = discovered.client->materializeTopPath(view))
+            result.append(path);
+    }
+    return result;
+}
+
 } // namespace Scenario
 } // namespace Backend
 } // namespace CargoNetSim
@@ -1,9 +1,14 @@
 #pragma once
 
+#include "Backend/Clients/TerminalClient/TerminalSimulationClient.h"
+#include "TopPathCache.h"
+
 #include <QList>
 #include <QString>
 
 namespace CargoNetSim {
+class CargoNetSimController;
+
 namespace Backend {
 
 class Path;
@@ -29,13 +34,48 @@ class ScenarioRegistry;
  *
  * Stateless: the class holds no members. All dependencies are either
  * injected via `findTopPaths` (document + registry) or obtained from
- * `CargoNetSimController::getInstance()` at call time (TerminalSim
- * client + ConfigController weights). Callers must ensure the
- * controller is initialized and `startAll()` has completed.
+ * the controller named in `Options` at call time (TerminalSim client +
+ * ConfigController weights). Callers must ensure the controller is
+ * initialized and `startAll()` has completed.
  */
 class PathDiscovery
 {
 public:
+    struct Options
+    {
+        /// TopPathCache directory; empty disables the cache.
+        QString cacheDirectory;
+        int     cacheCapacity = TopPathCache::kDefaultCapacity;
+        /// Runtime context to discover with; null uses the default
+        /// CargoNetSimController instance.
+        CargoNetSim::CargoNetSimController *controller = nullptr;
+    };
+
+    /// Top-N answers for every pair, in discovery order, before any
+    /// `Path` is built. `client` answered them and builds one with
+    /// `materializeTopPath()`; it stays valid while the controller
+    /// that owns it runs.
+    struct DiscoveredPaths
+    {
+        QList<TerminalSimulationClient::TopPathView> views;
+        TerminalSimulationClient                    *client = nullptr;
+    };
+
+    /**
+     * @brief Same discovery as `findTopPaths`, without materializing.
+     *
+     * Preparation builds each `Path` from its view only when it keeps
+     * the path, so unbuildable answers never become `Path` objects.
+     * Empty `views` with @p err set on failure, or with @p err
+     * untouched when the document declares no origins.
+     */
+    DiscoveredPaths findTopPathViews(
+        const ScenarioDocument &doc,
+        const ScenarioRegistry &registry,
+        int                     n,
+        QString                *err,
+        const Options          &options = Options());
+
     /**
      * @brief Submit the scenario's terminals + routes to TerminalSim
      *        and return the top-N shortest paths for every declared
@@ -55,10 +95,14 @@ public:
      *                  message. Caller can pass nullptr if the
      *                  distinction between "empty success" and
      *                  "failed" is not needed.
+     * @param options   With a cache directory, pairs already answered
+     *                  for the same graph fingerprint are served from
+     *                  `TopPathCache` instead of `find_top_paths`.
      *
-     * @return Aggregated `Path*` list across all pairs (caller owns
-     *         each pointer — `Path` is a QObject and can be reparented
-     *         or deleted via `qDeleteAll`). Empty list with @p err set
+     * @return Aggregated `Path*` list across all pairs, built from
+     *         `findTopPathViews()`; views that fail to build are left
+     *         out (caller owns each pointer — `Path` is a QObject
+     *         and can be reparented or deleted via `qDeleteAll`). Empty list with @p err set
      *         on failure; empty list with @p err untouched when the
      *         document declares no origins (not an error — used by
      *         headless unit tests).
@@ -67,7 +111,8 @@ public:
         const ScenarioDocument &doc,
         const ScenarioRegistry &registry,
         int                     n,
-        QString                *err);
+        QString                *err,
+        const Options          &options = Options());
 };
 
 } // namespace Scenario
@@ -19,6 +19,7 @@
 #include <QPointF>
 #include <algorithm>
 #include <cmath>
+#include <optional>
 
 namespace CargoNetSim {
 namespace Backend {
@@ -56,58 +57,120 @@ QString regionOf(const ScenarioDocument &doc,
     return doc.terminals.value(terminalId).region;
 }
 
+/// Network and node ids a rail/truck segment resolves to.
+struct LegEndpoints
+{
+    QString region;
+    QString network;
+    int     fromNode = -1;
+    int     toNode   = -1;
+
+    bool isValid() const
+    {
+        return !network.isEmpty() && fromNode >= 0 && toNode >= 0;
+    }
+};
+
+LegEndpoints endpointsFor(const PathSegment      *seg,
+                          const ScenarioDocument &doc,
+                          NetworkSpec::Type       netType)
+{
+    LegEndpoints e;
+    e.region   = regionOf(doc, seg->getStart());
+    e.network  = networkNameFor(doc, seg->getStart(), netType);
+    e.fromNode = nodeIdFor(doc, seg->getStart(), netType);
+    e.toNode   = nodeIdFor(doc, seg->getEnd(),   netType);
+    return e;
+}
+
+bool networkLoaded(const NetworkController &networks,
+                   NetworkSpec::Type        netType,
+                   const LegEndpoints      &e)
+{
+    return netType == NetworkSpec::Type::Rail
+               ? networks.trainNetwork(e.network, e.region) != nullptr
+               : networks.truckNetwork(e.network, e.region) != nullptr;
+}
+
+bool needsEstimate(const PathSegment *seg)
+{
+    return !(seg->estimatedDistance() > 0.0
+             && seg->estimatedTravelTime() > 0.0);
+}
+
+bool netTypeFor(Mode mode, NetworkSpec::Type *netType)
+{
+    switch (mode)
+    {
+    case Mode::Train: *netType = NetworkSpec::Type::Rail;  return true;
+    case Mode::Truck: *netType = NetworkSpec::Type::Truck; return true;
+    default:                                               return false;
+    }
+}
+
+/// First pass: queue every rail/truck leg so the engine can batch the
+/// searches by source node before any segment is written.
+void requestLegs(const QList<Path *>     &paths,
+                 const ScenarioDocument  &doc,
+                 const NetworkController &networks,
+                 NetworkDistanceEngine   &engine)
+{
+    for (auto *p : paths)
+    {
+        if (!p) continue;
+        for (auto *seg : p->getSegments())
+        {
+            NetworkSpec::Type netType;
+            if (!seg || !needsEstimate(seg)
+                || !netTypeFor(seg->getMode(), &netType))
+                continue;
+            const LegEndpoints e = endpointsFor(seg, doc, netType);
+            if (e.isValid() && networkLoaded(networks, netType, e))
+                engine.request(netType, e.region, e.network, e.fromNode,
+                               e.toNode);
+        }
+    }
+}
+
 bool populateRailOrTruck(
     PathSegment                          *seg,
     const ScenarioDocument               &doc,
     const NetworkController              &networks,
+    const NetworkDistanceEngine          &engine,
     NetworkSpec::Type                     netType)
 {
-    const QString region = regionOf(doc, seg->getStart());
-    const QString net    = networkNameFor(doc, seg->getStart(), netType);
-    const int     a      = nodeIdFor(doc, seg->getStart(), netType);
-    const int     b      = nodeIdFor(doc, seg->getEnd(),   netType);
-    if (net.isEmpty() || a < 0 || b < 0)
+    const LegEndpoints e = endpointsFor(seg, doc, netType);
+    if (!e.isValid())
     {
         qCWarning(lcScenario) << "PathDistancePopulator::populateRailOrTruck:"
                               << "missing network data for segment"
                               << seg->getStart() << "->" << seg->getEnd()
-                              << "(net=" << net << ", nodeA=" << a
-                              << ", nodeB=" << b << ")";
+                              << "(net=" << e.network << ", nodeA="
+                              << e.fromNode << ", nodeB=" << e.toNode << ")";
         return false;
     }
-
-    ShortestPathResult r;
-    if (netType == NetworkSpec::Type::Rail)
-    {
-        auto *g = networks.trainNetwork(net, region);
-        if (!g)
-        {
-            qCWarning(lcScenario) << "PathDistancePopulator::populateRailOrTruck:"
-                                  << "rail network" << net
-                                  << "not found in region" << region;
-            return false;
-        }
-        r = g->findShortestPath(a, b, QStringLiteral("distance"));
-    }
-    else  // Truck
+    if (!networkLoaded(networks, netType, e))
     {
-        auto *g = networks.truckNetwork(net, region);
-        if (!g)
-        {
-            qCWarning(lcScenario) << "PathDistancePopulator::populateRailOrTruck:"
-                                  << "truck network" << net
-                                  << "not found in region" << region;
-            return false;
-        }
-        r = g->findShortestPath(a, b);
+        qCWarning(lcScenario) << "PathDistancePopulator::populateRailOrTruck:"
+                              << (netType == NetworkSpec::Type::Rail
+                                      ? "rail network" : "truck network")
+                              << e.network << "not found in region"
+                              << e.region;
+        return false;
     }
-    if (r.totalLength <= 0.0) return false;
+
+    NetworkDistanceEngine::Leg leg;
+    if (!engine.lookup(netType, e.region, e.network, e.fromNode, e.toNode,
+                       &leg))
+        return false;
+    if (leg.distanceMeters <= 0.0) return false;
 
     qCDebug(lcScenario) << "PathDistancePopulator::populateRailOrTruck:"
                         << seg->getStart() << "->" << seg->getEnd()
-                        << "distance=" << r.totalLength << "m"
-                        << "time=" << r.minTravelTime << "s";
-    seg->setEstimatedDistanceAndTravelTime(r.totalLength, r.minTravelTime);
+                        << "distance=" << leg.distanceMeters << "m"
+                        << "time=" << leg.travelTimeSeconds << "s";
+    seg->setEstimatedDistanceAndTravelTime(leg.distanceMeters,
+                                           leg.travelTimeSeconds);
     return true;
 }
 
@@ -153,11 +216,18 @@ int populate(const QList<Path *>                &paths,
              const ScenarioDocument             &doc,
              const NetworkController            &networks,
              const ConfigController             &config,
-             const RegionDataController         * /*regionData*/)
+             const RegionDataController         * /*regionData*/,
+             NetworkDistanceEngine              *engine)
 {
     qCDebug(lcScenario) << "PathDistancePopulator::populate:"
                         << "path count =" << paths.size();
 
+    std::optional<NetworkDistanceEngine> localEngine;
+    if (!engine)
+        engine = &localEngine.emplace(doc, networks);
+    requestLegs(paths, doc, networks, *engine);
+    engine->resolve();
+
     int count = 0;
     for (auto *p : paths)
     {
@@ -168,8 +238,7 @@ int populate(const QList<Path *>                &paths,
         for (auto *seg : segments)
         {
             if (!seg) continue;
-            if (seg->estimatedDistance() > 0.0
-                && seg->estimatedTravelTime() > 0.0)
+            if (!needsEstimate(seg))
             {
                 ++count;
                 ++segOk;
@@ -180,12 +249,12 @@ int populate(const QList<Path *>                &paths,
             switch (seg->getMode())
             {
             case Mode::Train:
-                ok = populateRailOrTruck(seg, doc, networks,
-                                          NetworkSpec::Type::Rail);
+                ok = populateRailOrTruck(seg, doc, networks, *engine,
+                                         NetworkSpec::Type::Rail);
                 break;
             case Mode::Truck:
-                ok = populateRailOrTruck(seg, doc, networks,
-                                          NetworkSpec::Type::Truck);
+                ok = populateRailOrTruck(seg, doc, networks, *engine,
+                                         NetworkSpec::Type::Truck);
                 break;
             case Mode::Ship:
                 ok = populateShip(seg, doc, config);
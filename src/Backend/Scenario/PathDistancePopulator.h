@@ -3,6 +3,8 @@
 
 #include <QList>
 
+#include "NetworkDistanceEngine.h"
+
 namespace CargoNetSim {
 namespace Backend {
 
@@ -20,6 +22,10 @@ class ScenarioRegistry;
 /// segment of the given paths by dispatching per segment mode to
 /// the appropriate mode module.
 ///
+/// Rail and truck legs are resolved in one batch through a
+/// NetworkDistanceEngine, so a terminal-to-terminal leg shared by
+/// many paths is searched once.
+///
 /// Stateless, pure-ish (reads from controllers via their public
 /// APIs; writes only to segment attributes). Safe to call multiple
 /// times — a second call overwrites the prior estimate.
@@ -30,12 +36,16 @@ namespace PathDistancePopulator
     /// linkage (e.g. ship segments) are populated via
     /// GeoDistance + config-average-speed. Returns the number of
     /// segments populated successfully.
+    ///
+    /// Pass @p engine to share memoized legs across calls; when null
+    /// a call-local engine with default options is used.
     int populate(
         const QList<Path *>                &paths,
         const ScenarioDocument             &doc,
         const NetworkController            &networks,
         const ConfigController             &config,
-        const RegionDataController         *regionData);
+        const RegionDataController         *regionData,
+        NetworkDistanceEngine              *engine = nullptr);
 } // namespace PathDistancePopulator
 
 } // namespace Scenario
@@ -1,5 +1,6 @@
 #include "PathPreparationService.h"
 
+#include "Backend/Clients/TerminalClient/TerminalSimulationClient.h"
 #include "Backend/Commons/TransportationMode.h"
 #include "Backend/Commons/LogCategories.h"
 #include "Backend/Controllers/ConfigController.h"
@@ -207,12 +208,29 @@ PreparedPathSet::pathKeysByCanonicalPath() const
     return m_pathKeysByCanonicalPath;
 }
 
+void PathPreparationService::appendRecord(
+    PreparedPathSet &prepared, CargoNetSim::Backend::Path *path)
+{
+    PreparedPathRecord record;
+    record.path = std::shared_ptr<CargoNetSim::Backend::Path>(path);
+    record.canonicalPathKey = path->canonicalPathKey();
+    record.requirements =
+        PreparedPathEligibilityService::requirementsFor(*path);
+    record.executionPathKey = makeUniquePreparedExecutionPathKey(
+        basePreparedExecutionPathKey(*path),
+        prepared.m_pathsByExecutionPathKey);
+    prepared.m_pathsByExecutionPathKey.insert(record.executionPathKey,
+                                          record.path);
+    prepared.m_records.push_back(std::move(record));
+}
+
 PreparedPathSet PathPreparationService::prepareDiscoveredPaths(
     QList<CargoNetSim::Backend::Path *>        discoveredPaths,
     const ScenarioDocument                    &doc,
     ConfigController                          *config,
     NetworkController                         *networks,
-    RegionDataController                      *regionData)
+    RegionDataController                      *regionData,
+    const NetworkDistanceEngine::Options      &distanceOptions)
 {
     PreparedPathSet prepared;
     prepared.m_records.reserve(
@@ -220,29 +238,58 @@ PreparedPathSet PathPreparationService::prepareDiscoveredPaths(
 
     for (auto *path : discoveredPaths)
     {
-        if (!path)
-            continue;
-        PreparedPathRecord record;
-        record.path = std::shared_ptr<CargoNetSim::Backend::Path>(path);
-        record.canonicalPathKey = path->canonicalPathKey();
-        record.requirements =
-            PreparedPathEligibilityService::requirementsFor(*path);
-        record.executionPathKey = makeUniquePreparedExecutionPathKey(
-            basePreparedExecutionPathKey(*path),
-            prepared.m_pathsByExecutionPathKey);
-        prepared.m_pathsByExecutionPathKey.insert(record.executionPathKey,
-                                              record.path);
-        prepared.m_records.push_back(std::move(record));
+        if (path)
+            appendRecord(prepared, path);
+    }
+    return completePreparation(std::move(prepared), doc, config,
+                               networks, regionData, distanceOptions);
+}
+
+PreparedPathSet PathPreparationService::prepareDiscoveredPaths(
+    const PathDiscovery::DiscoveredPaths      &discovered,
+    const ScenarioDocument                    &doc,
+    ConfigController                          *config,
+    NetworkController                         *networks,
+    RegionDataController                      *regionData,
+    const NetworkDistanceEngine::Options      &distanceOptions)
+{
+    PreparedPathSet prepared;
+    prepared.m_records.reserve(
+        static_cast<size_t>(discovered.views.size()));
+
+    // Each view becomes a Path only here, straight into the record
+    // that owns it; an answer that cannot be built is dropped.
+    for (const auto &view : discovered.views)
+    {
+        if (auto *path = discovered.client->materializeTopPath(view))
+            appendRecord(prepared, path);
+        else
+            qCWarning(lcScenario)
+                << "PathPreparationService::prepareDiscoveredPaths:"
+                << "skipping path" << view.pathId
+                << "that failed to materialize";
     }
+    return completePreparation(std::move(prepared), doc, config,
+                               networks, regionData, distanceOptions);
+}
 
+PreparedPathSet PathPreparationService::completePreparation(
+    PreparedPathSet                            prepared,
+    const ScenarioDocument                    &doc,
+    ConfigController                          *config,
+    NetworkController                         *networks,
+    RegionDataController                      *regionData,
+    const NetworkDistanceEngine::Options      &distanceOptions)
+{
     const auto paths = rawPreparedRecordPaths(prepared.m_records);
     if (paths.isEmpty())
         return prepared;
 
     if (config && networks)
     {
+        NetworkDistanceEngine distances(doc, *networks, distanceOptions);
         PathDistancePopulator::populate(paths, doc, *networks,
-                                        *config, regionData);
+                                        *config, regionData, &distances);
     }
 
     const auto allocation = ContainerAllocator::allocate(doc, paths);
@@ -341,12 +388,15 @@ PreparedPathSet PathPreparationService::discoverAndPreparePaths(
     ConfigController                          *config,
     NetworkController                         *networks,
     RegionDataController                      *regionData,
-    QString                                   *err)
+    QString                                   *err,
+    const NetworkDistanceEngine::Options      &distanceOptions,
+    const PathDiscovery::Options              &discoveryOptions)
 {
     PathDiscovery discovery;
-    auto paths = discovery.findTopPaths(doc, registry, topN, err);
-    return prepareDiscoveredPaths(std::move(paths), doc, config,
-                                  networks, regionData);
+    const auto discovered = discovery.findTopPathViews(
+        doc, registry, topN, err, discoveryOptions);
+    return prepareDiscoveredPaths(discovered, doc, config, networks,
+                                  regionData, distanceOptions);
 }
 
 } // namespace Scenario
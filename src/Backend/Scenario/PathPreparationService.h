@@ -10,6 +10,8 @@
 
 #include "PreparedPathStatus.h"
 #include "Backend/Models/PathSegment.h"
+#include "NetworkDistanceEngine.h"
+#include "PathDiscovery.h"
 #include "PathKey.h"
 #include "PathMetrics.h"
 
@@ -79,7 +81,20 @@ public:
         const ScenarioDocument                    &doc,
         ConfigController                          *config,
         NetworkController                         *networks,
-        RegionDataController                      *regionData);
+        RegionDataController                      *regionData,
+        const NetworkDistanceEngine::Options      &distanceOptions =
+            NetworkDistanceEngine::Options());
+
+    /// Builds each view's `Path` only as its record is created;
+    /// views that fail to build are skipped.
+    static PreparedPathSet prepareDiscoveredPaths(
+        const PathDiscovery::DiscoveredPaths      &discovered,
+        const ScenarioDocument                    &doc,
+        ConfigController                          *config,
+        NetworkController                         *networks,
+        RegionDataController                      *regionData,
+        const NetworkDistanceEngine::Options      &distanceOptions =
+            NetworkDistanceEngine::Options());
 
     static PreparedPathSet discoverAndPreparePaths(
         const ScenarioDocument                    &doc,
@@ -88,7 +103,22 @@ public:
         ConfigController                          *config,
         NetworkController                         *networks,
         RegionDataController                      *regionData,
-        QString                                   *err = nullptr);
+        QString                                   *err = nullptr,
+        const NetworkDistanceEngine::Options      &distanceOptions =
+            NetworkDistanceEngine::Options(),
+        const PathDiscovery::Options              &discoveryOptions =
+            PathDiscovery::Options());
+
+private:
+    static void appendRecord(PreparedPathSet            &prepared,
+                             CargoNetSim::Backend::Path *path);
+    static PreparedPathSet completePreparation(
+        PreparedPathSet                            prepared,
+        const ScenarioDocument                    &doc,
+        ConfigController                          *config,
+        NetworkController                         *networks,
+        RegionDataController                      *regionData,
+        const NetworkDistanceEngine::Options      &distanceOptions);
 };
 
 } // namespace Scenario
@@ -32,11 +32,11 @@ QString displayIdentity(const PreparedPathRecord &record)
 } // namespace
 
 SimulatorAvailability
-PreparedPathEligibilityService::currentAvailability()
+PreparedPathEligibilityService::currentAvailability(
+    CargoNetSim::CargoNetSimController *controller)
 {
     SimulatorAvailability availability;
 
-    auto *controller = CargoNetSim::CargoNetSimController::instance();
     if (!controller)
         return availability;
 
@@ -7,6 +7,8 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
+
 namespace Backend
 {
 class Path;
@@ -19,7 +21,9 @@ class PreparedPathSet;
 class PreparedPathEligibilityService
 {
 public:
-    static SimulatorAvailability currentAvailability();
+    /// Simulators and fleets currently usable through @p controller.
+    static SimulatorAvailability currentAvailability(
+        CargoNetSim::CargoNetSimController *controller);
 
     static PreparedPathRequirements requirementsFor(
         const CargoNetSim::Backend::Path &path);
@@ -67,6 +67,7 @@ namespace Segment {
 namespace Simulation {
     inline const QString TimeValueOfMoney  = QStringLiteral("time_value_of_money");
     inline const QString UseModeSpecific   = QStringLiteral("use_mode_specific");
+    inline const QString TruckBatchTrips   = QStringLiteral("truck_batch_trips");
 } // namespace Simulation
 
 } // namespace PropertyKeys
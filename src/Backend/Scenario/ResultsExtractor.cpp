@@ -4,6 +4,7 @@
 
 #include "Backend/Clients/TerminalClient/TerminalSimulationClient.h"
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Commons/Trace.h"
 #include "Backend/Controllers/ConfigController.h"
 #include "Backend/Models/Path.h"
 #include "PropertyKeys.h"
@@ -243,13 +244,38 @@ ScenarioExecutionResultSet ResultsExtractor::extractExecutionResults(
     const PathAllocation                      *allocation,
     const QString                            &executionId)
 {
+    ScenarioExecutionResultSet results;
+    emit statusMessage(
+        QStringLiteral("Extracting simulation results..."));
+    streamExecutionResults(
+        paths, executionPathKeys, allocation, executionId,
+        [&results](const PathExecutionResult &result) {
+            results.addPathResult(result);
+        });
+    qCInfo(lcScenario) << "ResultsExtractor::extractExecutionResults: completed, results:" << results.size();
+    clearTerminalExecutionRecords(executionId);
+    emit statusMessage(QStringLiteral(
+        "Results extraction completed successfully"));
+    return results;
+}
+
+void ResultsExtractor::streamExecutionResults(
+    const QList<CargoNetSim::Backend::Path *> &paths,
+    const QVector<QString>                    &executionPathKeys,
+    const PathAllocation                      *allocation,
+    const QString                            &executionId,
+    const PathResultSink                      &sink)
+{
+    CNS_TRACE_SCOPE_DETAIL(
+        Results, "ResultsExtractor::streamExecutionResults",
+        QStringLiteral("%1 path(s)").arg(paths.size()));
+
     qCInfo(lcScenario) << "ResultsExtractor::extract: paths:" << paths.size()
                        << "(per-path container counts carried on Path snapshots)";
-    ScenarioExecutionResultSet results;
     if (!m_config)
     {
         qCWarning(lcScenario) << "ResultsExtractor::extract: config is null, returning empty";
-        return results;
+        return;
     }
 
     const QVariantMap costWeights =
@@ -277,9 +303,6 @@ ScenarioExecutionResultSet ResultsExtractor::extractExecutionResults(
         << terminalResultsByCanonicalPath.size()
         << "executionId=" << executionId;
 
-    emit statusMessage(
-        QStringLiteral("Extracting simulation results..."));
-
     for (int index = 0; index < paths.size(); ++index)
     {
         auto *path = paths[index];
@@ -331,7 +354,8 @@ ScenarioExecutionResultSet ResultsExtractor::extractExecutionResults(
             result.totalCost = result.edgeCosts + result.terminalCosts;
         }
         const auto summary = result.toSimulationResult();
-        results.addPathResult(result);
+        if (sink)
+            sink(result);
         qCDebug(lcScenario) << "ResultsExtractor::extractExecutionResults: pathId:" << summary.pathId
                             << "pathKey:" << summary.canonicalPathKey
                             << "totalCost:" << summary.totalCost
@@ -346,21 +370,20 @@ ScenarioExecutionResultSet ResultsExtractor::extractExecutionResults(
                                .arg(summary.edgeCosts,     0, 'f', 2)
                                .arg(summary.terminalCosts, 0, 'f', 2));
     }
+}
 
-    qCInfo(lcScenario) << "ResultsExtractor::extractExecutionResults: completed, results:" << results.size();
-    if (m_terminalClient && !executionId.isEmpty())
-    {
-        const int cleared =
-            m_terminalClient->clearTerminalExecutionResults(
-                executionId);
-        qCDebug(lcScenario)
-            << "ResultsExtractor::extractExecutionResults:"
-            << "cleared terminal execution records:" << cleared
-            << "for executionId =" << executionId;
-    }
-    emit statusMessage(QStringLiteral(
-        "Results extraction completed successfully"));
-    return results;
+void ResultsExtractor::clearTerminalExecutionRecords(
+    const QString &executionId)
+{
+    if (!m_terminalClient || executionId.isEmpty())
+        return;
+
+    const int cleared =
+        m_terminalClient->clearTerminalExecutionResults(executionId);
+    qCDebug(lcScenario)
+        << "ResultsExtractor::clearTerminalExecutionRecords:"
+        << "cleared terminal execution records:" << cleared
+        << "for executionId =" << executionId;
 }
 
 // --- Edge-cost math ---
@@ -7,6 +7,8 @@
 #include <QString>
 #include <QVariantMap>
 
+#include <functional>
+
 #include "Backend/Commons/TransportationMode.h"
 #include "Backend/Models/Path.h" // for PathTerminal value type
 #include "PathAllocation.h"
@@ -87,6 +89,28 @@ public:
         const PathAllocation                      *allocation = nullptr,
         const QString                            &executionId = QString());
 
+    using PathResultSink =
+        std::function<void(const PathExecutionResult &)>;
+
+    /**
+     * @brief Computes typed execution results one path at a time and
+     *        hands each to @p sink instead of collecting them.
+     *
+     * Unlike extractExecutionResults() this leaves the terminal execution
+     * records for @p executionId in place, so the executor can extract
+     * paths as they complete mid-run and clear the records once at the
+     * end via clearTerminalExecutionRecords().
+     */
+    void streamExecutionResults(
+        const QList<CargoNetSim::Backend::Path *> &paths,
+        const QVector<QString>                    &executionPathKeys,
+        const PathAllocation                      *allocation,
+        const QString                            &executionId,
+        const PathResultSink                      &sink);
+
+    /** @brief Drops TerminalSim's per-execution records for @p executionId. */
+    void clearTerminalExecutionRecords(const QString &executionId);
+
 signals:
     void statusMessage(const QString &msg);
     void errorMessage(const QString &msg);
@@ -10,6 +10,7 @@
 #include "Backend/Models/TrainSystem.h"
 #include "Backend/Models/Terminal.h"
 #include "InterfaceConversion.h"
+#include "NetworkImageCache.h"
 #include "PropertyKeys.h"
 #include "TerminalTypeDefaults.h"
 
@@ -34,6 +35,7 @@ bool ScenarioApplier::apply(ScenarioDocument &doc,
 {
     qCInfo(lcScenario) << "ScenarioApplier::apply: begin";
     clearAll(controller, registry);
+    registry.setController(&controller);
 
     qCDebug(lcScenario) << "ScenarioApplier::apply: applyRegions";
     if (!applyRegions         (doc, controller, error))          return false;
@@ -158,6 +160,8 @@ bool ScenarioApplier::applyNetworks(const ScenarioDocument &doc,
                         return false;
                     }
                     rd->addTrainNetwork(n.name, nodesPath, linksPath);
+                    if (auto *net = rd->getTrainNetwork(n.name))
+                        NetworkImageCache::attach(n, *net);
                     break;
                 }
                 case NetworkSpec::Type::Truck:
@@ -171,6 +175,8 @@ bool ScenarioApplier::applyNetworks(const ScenarioDocument &doc,
                         return false;
                     }
                     rd->addTruckNetwork(n.name, configPath);
+                    if (auto *cfg = rd->getTruckNetworkConfig(n.name))
+                        NetworkImageCache::attach(n, *cfg);
                     break;
                 }
                 }
@@ -404,6 +410,7 @@ bool ScenarioApplier::applySettings(const ScenarioDocument &doc,
     if (s.shortestPathsN.has_value())        simulation["shortest_paths"]       = s.shortestPathsN.value();
     if (s.timeValueOfMoney.has_value())      simulation["time_value_of_money"]  = s.timeValueOfMoney.value();
     if (s.useSpecificTimeValues.has_value()) simulation["use_mode_specific"]    = s.useSpecificTimeValues.value();
+    if (s.truckBatchTrips.has_value())       simulation[PK::Simulation::TruckBatchTrips] = s.truckBatchTrips.value();
 
     // Overlay carbon taxes.
     if (s.carbonRate.has_value())      carbonTaxes["rate"]             = s.carbonRate.value();
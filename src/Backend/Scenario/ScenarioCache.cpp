@@ -0,0 +1,257 @@
+#include "ScenarioCache.h"
+#include "Backend/Commons/LogCategories.h"
+#include "CacheLocation.h"
+#include "ScenarioSerializer.h"
+
+#include <QCborValue>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonValue>
+#include <QSaveFile>
+#include <algorithm>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+namespace
+{
+
+constexpr int kDigestSize = 32; // SHA-256
+
+void configureStream(QDataStream &ds)
+{
+    ds.setByteOrder(QDataStream::LittleEndian);
+}
+
+const char *stageName(ScenarioCache::Stage stage)
+{
+    switch (stage)
+    {
+    case ScenarioCache::Stage::Parsed:          return "parsed";
+    case ScenarioCache::Stage::PreviewResolved: return "resolved";
+    }
+    return "unknown";
+}
+
+/// SHA-256 of the file contents; all-zero for a missing/unreadable file so
+/// "still missing" compares equal and the validator reports it as usual.
+QByteArray contentDigest(const QString &path)
+{
+    QFile f(path);
+    if (!f.open(QIODevice::ReadOnly))
+        return QByteArray(kDigestSize, '\0');
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    if (!hash.addData(&f))
+        return QByteArray(kDigestSize, '\0');
+    return hash.result();
+}
+
+/// The header's input digest slot; all-zero when the entry is unkeyed.
+QByteArray inputDigestSlot(const QByteArray &inputDigest)
+{
+    return inputDigest.size() == kDigestSize
+        ? inputDigest
+        : QByteArray(kDigestSize, '\0');
+}
+
+void writeUtf8(QDataStream &ds, const QString &value)
+{
+    const QByteArray bytes = value.toUtf8();
+    ds << static_cast<quint32>(bytes.size());
+    ds.writeRawData(bytes.constData(), bytes.size());
+}
+
+bool readUtf8(QDataStream &ds, QString *value)
+{
+    quint32 len = 0;
+    ds >> len;
+    if (ds.status() != QDataStream::Ok)
+        return false;
+    QByteArray bytes(static_cast<qsizetype>(len), Qt::Uninitialized);
+    if (ds.readRawData(bytes.data(), static_cast<int>(len))
+        != static_cast<int>(len))
+        return false;
+    *value = QString::fromUtf8(bytes);
+    return true;
+}
+
+} // namespace
+
+QString ScenarioCache::cachePathFor(const QString &scenarioPath, Stage stage)
+{
+    return CacheLocation::filePathFor(
+        scenarioPath,
+        QStringLiteral("%1.%2.cnscache")
+            .arg(QFileInfo(scenarioPath).fileName(),
+                 QLatin1String(stageName(stage))));
+}
+
+QStringList ScenarioCache::referencedFiles(const ScenarioDocument &doc)
+{
+    QStringList files;
+    auto add = [&files](const QString &p) {
+        if (!p.isEmpty())
+            files.append(QFileInfo(p).absoluteFilePath());
+    };
+    for (const RegionSpec &r : doc.regions)
+        for (const NetworkSpec &n : r.networks)
+            for (const QString &p : n.files)
+                add(p);
+    for (const QString &p : doc.fleet.trainsFiles) add(p);
+    for (const QString &p : doc.fleet.shipsFiles)  add(p);
+    for (const QString &p : doc.fleet.trucksFiles) add(p);
+
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    return files;
+}
+
+QByteArray ScenarioCache::documentDigest(const ScenarioDocument &doc)
+{
+    return QCryptographicHash::hash(
+        QCborValue::fromJsonValue(ScenarioSerializer::toJson(doc)).toCbor(),
+        QCryptographicHash::Sha256);
+}
+
+std::unique_ptr<ScenarioDocument>
+ScenarioCache::load(const QString &scenarioPath, Stage stage, QString *reason,
+                    const QByteArray &inputDigest)
+{
+    auto miss = [reason](const QString &why) {
+        if (reason) *reason = why;
+        return std::unique_ptr<ScenarioDocument>();
+    };
+
+    const QString cachePath = cachePathFor(scenarioPath, stage);
+    QFile f(cachePath);
+    if (!f.exists())
+        return miss(QStringLiteral("no cache entry"));
+    if (!f.open(QIODevice::ReadOnly))
+        return miss(f.errorString());
+
+    const qint64 size   = f.size();
+    uchar       *mapped = size > 0 ? f.map(0, size) : nullptr;
+    if (!mapped)
+        return miss(QStringLiteral("cannot map %1").arg(cachePath));
+
+    // Both the header stream and the CBOR decoder read the mapping in
+    // place; nothing is copied until fromJson builds the document.
+    const QByteArray bytes = QByteArray::fromRawData(
+        reinterpret_cast<const char *>(mapped), static_cast<qsizetype>(size));
+    QDataStream ds(bytes);
+    configureStream(ds);
+
+    quint32 magic = 0;
+    quint16 format = 0, schema = 0;
+    quint8  storedStage = 0;
+    quint32 dependencyCount = 0;
+    QByteArray storedInput(kDigestSize, Qt::Uninitialized);
+    ds >> magic >> format >> schema >> storedStage;
+    if (ds.status() != QDataStream::Ok || magic != kMagic
+        || format != kFormatVersion
+        || schema != ScenarioSerializer::kSchemaVersion
+        || storedStage != static_cast<quint8>(stage)
+        || ds.readRawData(storedInput.data(), kDigestSize) != kDigestSize)
+        return miss(QStringLiteral("incompatible cache header"));
+    ds >> dependencyCount;
+    if (ds.status() != QDataStream::Ok || dependencyCount == 0)
+        return miss(QStringLiteral("incompatible cache header"));
+    if (storedInput != inputDigestSlot(inputDigest))
+        return miss(QStringLiteral("input document differs"));
+
+    const QString yamlPath = QFileInfo(scenarioPath).absoluteFilePath();
+    for (quint32 i = 0; i < dependencyCount; ++i)
+    {
+        QString    path;
+        QByteArray digest(kDigestSize, Qt::Uninitialized);
+        if (!readUtf8(ds, &path)
+            || ds.readRawData(digest.data(), kDigestSize) != kDigestSize)
+            return miss(QStringLiteral("truncated dependency table"));
+        if (i == 0 && path != yamlPath)
+            return miss(QStringLiteral("cache belongs to %1").arg(path));
+        if (contentDigest(path) != digest)
+            return miss(QStringLiteral("%1 changed").arg(path));
+    }
+
+    quint64 payloadSize = 0;
+    ds >> payloadSize;
+    const qint64 offset = ds.device()->pos();
+    if (ds.status() != QDataStream::Ok
+        || payloadSize > static_cast<quint64>(size - offset))
+        return miss(QStringLiteral("truncated payload"));
+
+    QCborParserError cborError;
+    const QCborValue payload = QCborValue::fromCbor(
+        QByteArray::fromRawData(bytes.constData() + offset,
+                                static_cast<qsizetype>(payloadSize)),
+        &cborError);
+    if (cborError.error != QCborError::NoError || !payload.isMap())
+        return miss(QStringLiteral("corrupt payload: %1")
+                        .arg(cborError.errorString()));
+
+    auto doc = ScenarioSerializer::fromJson(payload.toJsonValue().toObject());
+    if (!doc)
+        return miss(QStringLiteral("payload rejected by fromJson"));
+
+    qCInfo(lcScenario) << "ScenarioCache::load: hit" << cachePath
+                       << "(" << stageName(stage) << "," << dependencyCount
+                       << "dependencies )";
+    return doc;
+}
+
+bool ScenarioCache::store(const QString &scenarioPath, Stage stage,
+                          const ScenarioDocument &doc, QString *error,
+                          const QByteArray &inputDigest)
+{
+    const QString cachePath = cachePathFor(scenarioPath, stage);
+    QSaveFile out(cachePath);
+    if (!out.open(QIODevice::WriteOnly))
+    {
+        if (error) *error = out.errorString();
+        return false;
+    }
+
+    QStringList dependencies = referencedFiles(doc);
+    dependencies.prepend(QFileInfo(scenarioPath).absoluteFilePath());
+
+    const QByteArray payload =
+        QCborValue::fromJsonValue(ScenarioSerializer::toJson(doc)).toCbor();
+
+    QDataStream ds(&out);
+    configureStream(ds);
+    ds << kMagic << kFormatVersion
+       << static_cast<quint16>(ScenarioSerializer::kSchemaVersion)
+       << static_cast<quint8>(stage);
+    const QByteArray inputSlot = inputDigestSlot(inputDigest);
+    ds.writeRawData(inputSlot.constData(), inputSlot.size());
+    ds << static_cast<quint32>(dependencies.size());
+    for (const QString &path : std::as_const(dependencies))
+    {
+        writeUtf8(ds, path);
+        const QByteArray digest = contentDigest(path);
+        ds.writeRawData(digest.constData(), digest.size());
+    }
+    ds << static_cast<quint64>(payload.size());
+    ds.writeRawData(payload.constData(), payload.size());
+
+    if (ds.status() != QDataStream::Ok || !out.commit())
+    {
+        if (error) *error = out.errorString();
+        return false;
+    }
+    qCDebug(lcScenario) << "ScenarioCache::store: wrote" << cachePath
+                        << "-" << payload.size() << "payload bytes,"
+                        << dependencies.size() << "dependencies";
+    return true;
+}
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
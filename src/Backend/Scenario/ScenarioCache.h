@@ -0,0 +1,88 @@
+#pragma once
+
+#include "ScenarioDocument.h"
+#include <QString>
+#include <QStringList>
+#include <memory>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+/// Versioned cache of a parsed scenario in the per-user cache directory
+/// (see CacheLocation). The document itself is not encoded field by
+/// field: the entry is a small binary header followed by the CBOR
+/// encoding of ScenarioSerializer::toJson(doc), and a hit runs fromJson
+/// on it. What it saves is the YAML parse and the path resolution.
+///
+/// A cache entry is keyed by the SHA-256 of the scenario YAML and of every
+/// file it references (network inputs, fleet files). Any content change,
+/// a moved YAML, a new schema version or a new cache format version makes
+/// the entry stale; stale or unreadable entries are treated as a miss and
+/// the caller falls back to ScenarioSerializer::fromYaml.
+///
+/// Two stages are cached independently:
+///   Parsed          : the document as returned by fromYaml (relative paths
+///                     already resolved).
+///   PreviewResolved : the document after ScenarioLinker has folded
+///                     auto-rule linkages / connections / global links in,
+///                     so `preview` can skip loading networks altogether.
+///                     Also keyed by documentDigest() of the unresolved
+///                     input, so an edited in-memory document never hits
+///                     an entry resolved from the file on disk.
+///
+/// File layout (little-endian):
+/// @code
+/// u32 magic 'CNSS' (0x53534E43), u16 format version, u16 schema version,
+/// u8 stage, 32 × u8 input digest (zero when unkeyed), u32 dependencyCount,
+/// dependencyCount × { u32 pathLen, pathLen × u8 UTF-8, 32 × u8 sha256 },
+/// u64 payloadSize, payloadSize × u8 CBOR(ScenarioSerializer::toJson(doc))
+/// @endcode
+/// The first dependency is always the scenario YAML itself. On load the
+/// file is memory-mapped and the CBOR payload is decoded straight from the
+/// mapping. Failing to write a cache entry (read-only directory, ...) is
+/// never an error for the caller.
+///
+/// Stateless — all methods are static.
+class ScenarioCache
+{
+public:
+    static constexpr quint32 kMagic         = 0x53534E43u; // "CNSS"
+    static constexpr quint16 kFormatVersion = 2;
+
+    enum class Stage : quint8
+    {
+        Parsed          = 0,
+        PreviewResolved = 1
+    };
+
+    /// `<file name>.<stage>.cnscache` in the CacheLocation directory of
+    /// @p scenarioPath; empty when no cache directory is available.
+    static QString cachePathFor(const QString &scenarioPath, Stage stage);
+
+    /// Absolute paths of every file @p doc references (network inputs and
+    /// fleet files), sorted and de-duplicated.
+    static QStringList referencedFiles(const ScenarioDocument &doc);
+
+    /// SHA-256 of the CBOR-encoded ScenarioSerializer::toJson(@p doc).
+    static QByteArray documentDigest(const ScenarioDocument &doc);
+
+    /// Returns the cached document, or nullptr on a miss. @p reason (if
+    /// given) receives a short explanation of the miss for logging. An
+    /// entry stored with an @p inputDigest only hits the same digest.
+    static std::unique_ptr<ScenarioDocument>
+    load(const QString &scenarioPath, Stage stage, QString *reason = nullptr,
+         const QByteArray &inputDigest = QByteArray());
+
+    /// Writes @p doc atomically. Returns false (with @p error) on failure.
+    static bool store(const QString &scenarioPath, Stage stage,
+                      const ScenarioDocument &doc, QString *error = nullptr,
+                      const QByteArray &inputDigest = QByteArray());
+};
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
@@ -5,8 +5,12 @@
 
 #include <containerLib/container.h>  // ContainerCore::Container full definition
 
+#include <QMutexLocker>
+#include <QPair>
 #include <QtMath>   // qQNaN()
+#include <algorithm>
 #include <cmath>
+#include <utility>
 
 namespace CargoNetSim
 {
@@ -66,39 +70,6 @@ bool terminalBelongsToRegion(const ScenarioDocument &doc,
     return it != doc.terminals.constEnd() && it->region == region;
 }
 
-bool terminalHasRegionScopedDependencies(const ScenarioDocument &doc,
-                                         const QString          &terminalId,
-                                         const QString          &region)
-{
-    for (const NodeLinkage &linkage : doc.linkages)
-    {
-        if (linkage.terminalId == terminalId)
-            return true;
-    }
-
-    for (const Connection &connection : doc.connections)
-    {
-        if (connection.fromTerminalId == terminalId
-            || connection.toTerminalId == terminalId)
-        {
-            return true;
-        }
-    }
-
-    for (const GlobalLink &link : doc.globalLinks)
-    {
-        if (endpointReferencesTerminal(link.fromTerminalId,
-                                       terminalId, region)
-            || endpointReferencesTerminal(link.toTerminalId,
-                                          terminalId, region))
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
-
 bool connectionIdentityMatches(
     const Connection &connection,
     const QString &fromId,
@@ -140,6 +111,55 @@ bool activeLinkageUsesNetworkNode(const NodeLinkage &linkage,
         && linkage.nodeId == nodeId;
 }
 
+// Index keys. The unit separator cannot appear in authored ids.
+constexpr QChar kKeySeparator(0x1f);
+
+QString routeKey(const QString &fromId, const QString &toId,
+                 TransportationTypes::TransportationMode mode)
+{
+    return fromId + kKeySeparator + toId + kKeySeparator
+           + QString::number(static_cast<int>(mode));
+}
+
+QString nodeKey(const QString &networkName, int nodeId)
+{
+    return networkName + kKeySeparator + QString::number(nodeId);
+}
+
+QString linkageKey(const QString &terminalId, const QString &networkName,
+                   int nodeId)
+{
+    return terminalId + kKeySeparator + nodeKey(networkName, nodeId);
+}
+
+void appendPosition(QHash<QString, QList<int>> &table, const QString &key,
+                    int position)
+{
+    table[key].append(position);
+}
+
+/// Removes the ascending @p positions from @p list in one pass.
+template <typename T>
+void removePositions(QList<T> &list, const QList<int> &positions)
+{
+    if (positions.isEmpty())
+        return;
+    int next = 0;
+    int kept = 0;
+    for (int i = 0; i < list.size(); ++i)
+    {
+        if (next < positions.size() && positions.at(next) == i)
+        {
+            ++next;
+            continue;
+        }
+        if (kept != i)
+            list[kept] = std::move(list[i]);
+        ++kept;
+    }
+    list.resize(kept);
+}
+
 QString linkageRegion(const ScenarioDocument &doc,
                       const NodeLinkage      &linkage)
 {
@@ -150,6 +170,200 @@ QString linkageRegion(const ScenarioDocument &doc,
 }
 } // namespace
 
+// ---- Secondary lookup indices ----
+
+bool &ScenarioDocument::indexBuilt(IndexedList which) const
+{
+    return which == IndexedList::Linkages      ? m_index.linkagesBuilt
+           : which == IndexedList::Connections ? m_index.connectionsBuilt
+                                               : m_index.globalLinksBuilt;
+}
+
+QList<int> &ScenarioDocument::removedPositions(IndexedList which) const
+{
+    return which == IndexedList::Linkages      ? m_index.removedLinkages
+           : which == IndexedList::Connections ? m_index.removedConnections
+                                               : m_index.removedGlobalLinks;
+}
+
+int ScenarioDocument::indexedCount(IndexedList which) const
+{
+    return which == IndexedList::Linkages      ? m_linkages.size()
+           : which == IndexedList::Connections ? m_connections.size()
+                                               : m_globalLinks.size();
+}
+
+void ScenarioDocument::indexPosition(IndexedList which, int position,
+                                     int removedBefore) const
+{
+    const int key = position + removedBefore;
+    switch (which)
+    {
+    case IndexedList::Linkages:
+    {
+        const NodeLinkage &l = m_linkages.at(position);
+        appendPosition(m_index.linkageByIdentity,
+                       linkageKey(l.terminalId, l.networkName, l.nodeId),
+                       key);
+        appendPosition(m_index.linkagesByTerminal, l.terminalId, key);
+        appendPosition(m_index.linkagesByNode,
+                       nodeKey(l.networkName, l.nodeId), key);
+        break;
+    }
+    case IndexedList::Connections:
+    {
+        const Connection &c = m_connections.at(position);
+        appendPosition(m_index.connectionByRoute,
+                       routeKey(c.fromTerminalId, c.toTerminalId, c.mode),
+                       key);
+        appendPosition(m_index.connectionsByTerminal, c.fromTerminalId,
+                       key);
+        if (c.toTerminalId != c.fromTerminalId)
+            appendPosition(m_index.connectionsByTerminal, c.toTerminalId,
+                           key);
+        break;
+    }
+    case IndexedList::GlobalLinks:
+    {
+        const GlobalLink &g = m_globalLinks.at(position);
+        appendPosition(m_index.globalLinkByRoute,
+                       routeKey(g.fromTerminalId, g.toTerminalId, g.mode),
+                       key);
+        appendPosition(m_index.globalLinksByEndpoint, g.fromTerminalId,
+                       key);
+        if (g.toTerminalId != g.fromTerminalId)
+            appendPosition(m_index.globalLinksByEndpoint, g.toTerminalId,
+                           key);
+        break;
+    }
+    }
+}
+
+void ScenarioDocument::ensureIndex(IndexedList which) const
+{
+    if (indexBuilt(which))
+        return;
+
+    switch (which)
+    {
+    case IndexedList::Linkages:
+        m_index.linkageByIdentity.clear();
+        m_index.linkagesByTerminal.clear();
+        m_index.linkagesByNode.clear();
+        break;
+    case IndexedList::Connections:
+        m_index.connectionByRoute.clear();
+        m_index.connectionsByTerminal.clear();
+        break;
+    case IndexedList::GlobalLinks:
+        m_index.globalLinkByRoute.clear();
+        m_index.globalLinksByEndpoint.clear();
+        break;
+    }
+    removedPositions(which).clear();
+    const int count = indexedCount(which);
+    for (int i = 0; i < count; ++i)
+        indexPosition(which, i);
+    qCDebug(lcScenario) << "ScenarioDocument::ensureIndex: rebuilt index"
+                        << static_cast<int>(which) << "over" << count
+                        << "records";
+    indexBuilt(which) = true;
+}
+
+void ScenarioDocument::indexAppended(IndexedList which)
+{
+    if (!indexBuilt(which))
+        return;
+    // The new record sits past every removed slot, so its index position
+    // is its list position plus the number of removals since the rebuild.
+    indexPosition(which, indexedCount(which) - 1,
+                  static_cast<int>(removedPositions(which).size()));
+}
+
+void ScenarioDocument::indexRemoved(IndexedList which, int position)
+{
+    if (!indexBuilt(which))
+        return;
+
+    // Map the list position back to its index position: the first k with
+    // removed[k] - k > position has exactly k removals in front of it.
+    QList<int> &removed = removedPositions(which);
+    int lo = 0;
+    int hi = removed.size();
+    while (lo < hi)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        if (removed.at(mid) - mid > position)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    removed.insert(lo, position + lo);
+
+    // Past an eighth of the list, filtering costs more than a rebuild.
+    if (removed.size() * 8 > indexedCount(which))
+        invalidateIndex(which);
+}
+
+void ScenarioDocument::invalidateIndex(IndexedList which)
+{
+    indexBuilt(which) = false;
+}
+
+void ScenarioDocument::invalidateIndices()
+{
+    invalidateIndex(IndexedList::Linkages);
+    invalidateIndex(IndexedList::Connections);
+    invalidateIndex(IndexedList::GlobalLinks);
+}
+
+QList<int> ScenarioDocument::indexedPositions(
+    IndexedList which,
+    const QHash<QString, QList<int>> LookupIndex::*table,
+    const QString &key) const
+{
+    QMutexLocker lock(&m_indexMutex);
+    ensureIndex(which);
+    const QList<int> indexed = (m_index.*table).value(key);
+    const QList<int> &removed = removedPositions(which);
+    if (removed.isEmpty())
+        return indexed;
+
+    // Skip removed records and close the gaps in front of the rest.
+    QList<int> positions;
+    positions.reserve(indexed.size());
+    for (int p : indexed)
+    {
+        const auto it = std::lower_bound(removed.cbegin(), removed.cend(), p);
+        if (it != removed.cend() && *it == p)
+            continue;
+        positions.append(p - static_cast<int>(it - removed.cbegin()));
+    }
+    return positions;
+}
+
+bool ScenarioDocument::hasRegionScopedDependencies(
+    const QString &terminalId, const QString &region) const
+{
+    if (!indexedPositions(IndexedList::Linkages,
+                          &LookupIndex::linkagesByTerminal, terminalId)
+             .isEmpty())
+        return true;
+    if (!indexedPositions(IndexedList::Connections,
+                          &LookupIndex::connectionsByTerminal, terminalId)
+             .isEmpty())
+        return true;
+    if (!indexedPositions(IndexedList::GlobalLinks,
+                          &LookupIndex::globalLinksByEndpoint, terminalId)
+             .isEmpty())
+        return true;
+    return !region.isEmpty()
+           && !indexedPositions(IndexedList::GlobalLinks,
+                                &LookupIndex::globalLinksByEndpoint,
+                                region + QLatin1Char('/') + terminalId)
+                   .isEmpty();
+}
+
 ScenarioDocument::~ScenarioDocument()
 {
     deleteAllContainers(m_containersByTerminal);
@@ -163,9 +377,10 @@ void ScenarioDocument::reset()
     fleet       = FleetSpec{};
     regions.clear();
     terminals.clear();
-    linkages.clear();
-    connections.clear();
-    globalLinks.clear();
+    m_linkages.clear();
+    m_connections.clear();
+    m_globalLinks.clear();
+    invalidateIndices();
     comparisonSnapshots.clear();
     globalLinkStrategy = LinkageStrategy::Manual;
     globalLinkAutoRules.clear();
@@ -174,6 +389,20 @@ void ScenarioDocument::reset()
     emit documentReset();
 }
 
+void ScenarioDocument::replaceRelationships(QList<NodeLinkage> linkages,
+                                            QList<Connection>  connections,
+                                            QList<GlobalLink>  globalLinks)
+{
+    qCDebug(lcScenario) << "ScenarioDocument::replaceRelationships:"
+                        << "linkages=" << linkages.size()
+                        << "connections=" << connections.size()
+                        << "globalLinks=" << globalLinks.size();
+    m_linkages    = std::move(linkages);
+    m_connections = std::move(connections);
+    m_globalLinks = std::move(globalLinks);
+    invalidateIndices();
+}
+
 // ---- Read-only query accessors ----
 
 QList<NodeLinkage>
@@ -198,9 +427,11 @@ ScenarioDocument::linkagesFor(const QString     &terminalId,
         return out;
     }
 
-    for (const NodeLinkage &l : linkages)
+    const QList<int> positions = indexedPositions(
+        IndexedList::Linkages, &LookupIndex::linkagesByTerminal, terminalId);
+    for (int i : positions)
     {
-        if (l.terminalId != terminalId) continue;
+        const NodeLinkage &l = m_linkages.at(i);
 
         // Resolve networkName within the terminal's owning region only.
         // Network names can repeat across regions; using any matching region
@@ -216,6 +447,19 @@ ScenarioDocument::linkagesFor(const QString     &terminalId,
     return out;
 }
 
+QList<NodeLinkage>
+ScenarioDocument::linkagesAtNode(const QString &networkName, int nodeId) const
+{
+    QList<NodeLinkage> out;
+    const QList<int> positions =
+        indexedPositions(IndexedList::Linkages, &LookupIndex::linkagesByNode,
+                         nodeKey(networkName, nodeId));
+    out.reserve(positions.size());
+    for (int i : positions)
+        out.append(m_linkages.at(i));
+    return out;
+}
+
 QPointF ScenarioDocument::globalPositionOf(const QString &terminalId) const
 {
     qCDebug(lcScenario) << "ScenarioDocument::globalPositionOf: terminalId:" << terminalId;
@@ -502,7 +746,7 @@ bool ScenarioDocument::renameRegion(const QString &oldName, const QString &newNa
                         << oldName << "to" << newName;
 
     // Re-anchor connection.region (redundant copy of endpoint regions).
-    for (Connection &c : connections)
+    for (Connection &c : m_connections)
     {
         if (c.region == oldName) c.region = newName;
     }
@@ -510,7 +754,7 @@ bool ScenarioDocument::renameRegion(const QString &oldName, const QString &newNa
     // Re-anchor qualified "<oldName>/<id>" prefixes in global_link endpoints.
     const QString oldPrefix = oldName + QLatin1Char('/');
     const QString newPrefix = newName + QLatin1Char('/');
-    for (GlobalLink &g : globalLinks)
+    for (GlobalLink &g : m_globalLinks)
     {
         if (g.fromTerminalId.startsWith(oldPrefix))
             g.fromTerminalId = newPrefix
@@ -519,6 +763,7 @@ bool ScenarioDocument::renameRegion(const QString &oldName, const QString &newNa
             g.toTerminalId   = newPrefix
                 + g.toTerminalId.mid(oldPrefix.size());
     }
+    invalidateIndex(IndexedList::GlobalLinks);
 
     emit regionRenamed(oldName, newName);
     return true;
@@ -548,64 +793,67 @@ bool ScenarioDocument::removeTerminal(const QString &id)
         ? QString()
         : region + QLatin1Char('/') + id;
 
-    // Cascade: linkages referencing this terminal.
-    int removedLinkages = 0;
-    for (int i = linkages.size() - 1; i >= 0; --i)
-    {
-        if (linkages.at(i).terminalId == id)
-        {
-            const QString nw  = linkages.at(i).networkName;
-            const int     nid = linkages.at(i).nodeId;
-            linkages.removeAt(i);
-            ++removedLinkages;
-            emit linkageRemoved(id, nw, nid);
-        }
-    }
+    // Cascade: linkages referencing this terminal. Each list is
+    // compacted in one pass and its index rebuilt on the next query, so
+    // a large cascade stays linear; signals go out afterwards, last hit
+    // first, as before.
+    const QList<int> linkageHits = indexedPositions(
+        IndexedList::Linkages, &LookupIndex::linkagesByTerminal, id);
+    QList<QPair<QString, int>> removedLinkageNodes;
+    for (int i : linkageHits)
+        removedLinkageNodes.append(
+            {m_linkages.at(i).networkName, m_linkages.at(i).nodeId});
+    removePositions(m_linkages, linkageHits);
+    if (!linkageHits.isEmpty())
+        invalidateIndex(IndexedList::Linkages);
 
     // Cascade: connections referencing this terminal (either endpoint).
-    int removedConnections = 0;
-    for (int i = connections.size() - 1; i >= 0; --i)
-    {
-        const Connection &c = connections.at(i);
-        if (c.fromTerminalId == id || c.toTerminalId == id)
-        {
-            const QString from = c.fromTerminalId;
-            const QString to   = c.toTerminalId;
-            const TransportationTypes::TransportationMode mode =
-                c.mode;
-            connections.removeAt(i);
-            ++removedConnections;
-            emit connectionRemoved(from, to, mode);
-        }
-    }
+    const QList<int> connectionHits = indexedPositions(
+        IndexedList::Connections, &LookupIndex::connectionsByTerminal, id);
+    QList<Connection> removedConnections;
+    for (int i : connectionHits)
+        removedConnections.append(m_connections.at(i));
+    removePositions(m_connections, connectionHits);
+    if (!connectionHits.isEmpty())
+        invalidateIndex(IndexedList::Connections);
 
     // Cascade: global_links referencing this terminal, bare OR qualified.
-    int removedGlobalLinks = 0;
-    for (int i = globalLinks.size() - 1; i >= 0; --i)
+    QList<int> globalLinkHits = indexedPositions(
+        IndexedList::GlobalLinks, &LookupIndex::globalLinksByEndpoint, id);
+    if (!qualified.isEmpty())
     {
-        const GlobalLink &g = globalLinks.at(i);
-        const bool hit =
-               g.fromTerminalId == id || g.toTerminalId == id
-            || (!qualified.isEmpty() &&
-                (g.fromTerminalId == qualified
-                 || g.toTerminalId   == qualified));
-        if (hit)
-        {
-            const QString from = g.fromTerminalId;
-            const QString to   = g.toTerminalId;
-            const TransportationTypes::TransportationMode mode =
-                g.mode;
-            globalLinks.removeAt(i);
-            ++removedGlobalLinks;
-            emit globalLinkRemoved(from, to, mode);
-        }
+        globalLinkHits += indexedPositions(
+            IndexedList::GlobalLinks, &LookupIndex::globalLinksByEndpoint,
+            qualified);
+        std::sort(globalLinkHits.begin(), globalLinkHits.end());
+        globalLinkHits.erase(
+            std::unique(globalLinkHits.begin(), globalLinkHits.end()),
+            globalLinkHits.end());
     }
+    QList<GlobalLink> removedGlobalLinks;
+    for (int i : globalLinkHits)
+        removedGlobalLinks.append(m_globalLinks.at(i));
+    removePositions(m_globalLinks, globalLinkHits);
+    if (!globalLinkHits.isEmpty())
+        invalidateIndex(IndexedList::GlobalLinks);
+
+    for (auto it = removedLinkageNodes.crbegin();
+         it != removedLinkageNodes.crend(); ++it)
+        emit linkageRemoved(id, it->first, it->second);
+    for (auto it = removedConnections.crbegin();
+         it != removedConnections.crend(); ++it)
+        emit connectionRemoved(it->fromTerminalId, it->toTerminalId,
+                               it->mode);
+    for (auto it = removedGlobalLinks.crbegin();
+         it != removedGlobalLinks.crend(); ++it)
+        emit globalLinkRemoved(it->fromTerminalId, it->toTerminalId,
+                               it->mode);
 
     qCDebug(lcScenario) << "ScenarioDocument::removeTerminal:"
                         << "cascaded removals for" << id
-                        << "- linkages=" << removedLinkages
-                        << "connections=" << removedConnections
-                        << "globalLinks=" << removedGlobalLinks;
+                        << "- linkages=" << linkageHits.size()
+                        << "connections=" << connectionHits.size()
+                        << "globalLinks=" << globalLinkHits.size();
 
     deleteContainersForTerminal(m_containersByTerminal, id);
     terminals.remove(id);
@@ -622,8 +870,7 @@ bool ScenarioDocument::updateTerminal(const QString &id, const TerminalPlacement
 
     const TerminalPlacement current = terminals.value(id);
     if (current.region != t.region
-        && terminalHasRegionScopedDependencies(*this, id,
-                                               current.region))
+        && hasRegionScopedDependencies(id, current.region))
     {
         qCWarning(lcScenario)
             << "ScenarioDocument::updateTerminal: region change rejected for"
@@ -659,20 +906,24 @@ bool ScenarioDocument::removeNetwork(const QString &region, const QString &netwo
     auto &r = regions[region];
     if (!r.networks.contains(network))    return false;
 
-    int removedLinkages = 0;
-    for (int i = linkages.size() - 1; i >= 0; --i)
+    QList<int>         hits;
+    QList<NodeLinkage> removed;
+    for (int i = 0; i < m_linkages.size(); ++i)
     {
-        const NodeLinkage &linkage = linkages.at(i);
+        const NodeLinkage &linkage = m_linkages.at(i);
         if (linkage.networkName == network
             && terminalBelongsToRegion(*this, linkage.terminalId, region))
         {
-            const QString terminalId = linkage.terminalId;
-            const int nodeId = linkage.nodeId;
-            linkages.removeAt(i);
-            ++removedLinkages;
-            emit linkageRemoved(terminalId, network, nodeId);
+            hits.append(i);
+            removed.append(linkage);
         }
     }
+    removePositions(m_linkages, hits);
+    if (!hits.isEmpty())
+        invalidateIndex(IndexedList::Linkages);
+    const int removedLinkages = hits.size();
+    for (auto it = removed.crbegin(); it != removed.crend(); ++it)
+        emit linkageRemoved(it->terminalId, network, it->nodeId);
 
     r.networks.remove(network);
     qCDebug(lcScenario)
@@ -699,7 +950,7 @@ bool ScenarioDocument::renameNetwork(const QString &region,
     r.networks.insert(newName, spec);
 
     int reanchoredLinkages = 0;
-    for (NodeLinkage &linkage : linkages)
+    for (NodeLinkage &linkage : m_linkages)
     {
         if (linkage.networkName == oldName
             && terminalBelongsToRegion(*this, linkage.terminalId, region))
@@ -712,6 +963,8 @@ bool ScenarioDocument::renameNetwork(const QString &region,
         }
     }
 
+    if (reanchoredLinkages > 0)
+        invalidateIndex(IndexedList::Linkages);
     qCDebug(lcScenario)
         << "ScenarioDocument::renameNetwork: reanchored"
         << reanchoredLinkages << "linkage(s)";
@@ -725,33 +978,35 @@ bool ScenarioDocument::addLinkage(const NodeLinkage &l)
                         << "network:" << l.networkName << "node:" << l.nodeId;
     if (l.terminalId.isEmpty())                 return false;
     if (!terminals.contains(l.terminalId))      return false;
-    const QString newRegion = terminals.value(l.terminalId).region;
-    for (const NodeLinkage &existing : linkages)
+    if (findLinkageIndex(l.terminalId, l.networkName, l.nodeId) >= 0)
     {
-        if (linkageIdentityMatches(existing, l.terminalId,
-                                   l.networkName, l.nodeId))
-        {
-            qCWarning(lcScenario)
-                << "ScenarioDocument::addLinkage: duplicate linkage rejected"
-                << l.terminalId << l.networkName << "node=" << l.nodeId;
-            return false;
-        }
-        if (!l.excluded
-            && linkageRegion(*this, existing) == newRegion
-            && activeLinkageUsesNetworkNode(existing,
-                                            l.networkName,
-                                            l.nodeId))
+        qCWarning(lcScenario)
+            << "ScenarioDocument::addLinkage: duplicate linkage rejected"
+            << l.terminalId << l.networkName << "node=" << l.nodeId;
+        return false;
+    }
+    if (!l.excluded)
+    {
+        const QString newRegion = terminals.value(l.terminalId).region;
+        for (const NodeLinkage &existing :
+             linkagesAtNode(l.networkName, l.nodeId))
         {
-            qCWarning(lcScenario)
-                << "ScenarioDocument::addLinkage:"
-                << "network node already linked to terminal"
-                << existing.terminalId
-                << "network=" << l.networkName
-                << "node=" << l.nodeId;
-            return false;
+            if (activeLinkageUsesNetworkNode(existing, l.networkName,
+                                             l.nodeId)
+                && linkageRegion(*this, existing) == newRegion)
+            {
+                qCWarning(lcScenario)
+                    << "ScenarioDocument::addLinkage:"
+                    << "network node already linked to terminal"
+                    << existing.terminalId
+                    << "network=" << l.networkName
+                    << "node=" << l.nodeId;
+                return false;
+            }
         }
     }
-    linkages.append(l);
+    m_linkages.append(l);
+    indexAppended(IndexedList::Linkages);
     emit linkageAdded(l);
     return true;
 }
@@ -761,21 +1016,28 @@ bool ScenarioDocument::removeLinkage(const QString &terminalId,
 {
     qCDebug(lcScenario) << "ScenarioDocument::removeLinkage: terminal:" << terminalId
                         << "network:" << networkName << "node:" << nodeId;
-    for (int i = 0; i < linkages.size(); ++i)
+    const int i = findLinkageIndex(terminalId, networkName, nodeId);
+    if (i >= 0)
     {
-        const NodeLinkage &l = linkages.at(i);
-        if (l.terminalId == terminalId &&
-            l.networkName == networkName &&
-            l.nodeId      == nodeId)
-        {
-            linkages.removeAt(i);
-            emit linkageRemoved(terminalId, networkName, nodeId);
-            return true;
-        }
+        m_linkages.removeAt(i);
+        indexRemoved(IndexedList::Linkages, i);
+        emit linkageRemoved(terminalId, networkName, nodeId);
+        return true;
     }
     return false;
 }
 
+int ScenarioDocument::findLinkageIndex(const QString &terminalId,
+                                       const QString &networkName,
+                                       int            nodeId) const
+{
+    const QList<int> positions =
+        indexedPositions(IndexedList::Linkages,
+                         &LookupIndex::linkageByIdentity,
+                         linkageKey(terminalId, networkName, nodeId));
+    return positions.isEmpty() ? -1 : positions.constFirst();
+}
+
 bool ScenarioDocument::addConnection(const Connection &c)
 {
     qCDebug(lcScenario) << "ScenarioDocument::addConnection: from:" << c.fromTerminalId
@@ -791,7 +1053,8 @@ bool ScenarioDocument::addConnection(const Connection &c)
             << "mode=" << static_cast<int>(c.mode);
         return false;
     }
-    connections.append(c);
+    m_connections.append(c);
+    indexAppended(IndexedList::Connections);
     emit connectionAdded(c);
     return true;
 }
@@ -805,7 +1068,8 @@ bool ScenarioDocument::removeConnection(
     const int i = findConnectionIndex(fromId, toId, mode);
     if (i >= 0)
     {
-        connections.removeAt(i);
+        m_connections.removeAt(i);
+        indexRemoved(IndexedList::Connections, i);
         emit connectionRemoved(fromId, toId, mode);
         return true;
     }
@@ -816,23 +1080,11 @@ int ScenarioDocument::findConnectionIndex(
     const QString &fromId, const QString &toId,
     TransportationTypes::TransportationMode mode) const
 {
-    for (int i = 0; i < connections.size(); ++i)
-    {
-        const Connection &c = connections.at(i);
-        if (c.fromTerminalId == fromId
-            && c.toTerminalId == toId
-            && c.mode == mode)
-            return i;
-    }
-    return -1;
-}
-
-Connection *ScenarioDocument::findConnection(
-    const QString &fromId, const QString &toId,
-    TransportationTypes::TransportationMode mode)
-{
-    const int i = findConnectionIndex(fromId, toId, mode);
-    return i >= 0 ? &connections[i] : nullptr;
+    const QList<int> positions =
+        indexedPositions(IndexedList::Connections,
+                         &LookupIndex::connectionByRoute,
+                         routeKey(fromId, toId, mode));
+    return positions.isEmpty() ? -1 : positions.constFirst();
 }
 
 const Connection *ScenarioDocument::findConnection(
@@ -840,7 +1092,7 @@ const Connection *ScenarioDocument::findConnection(
     TransportationTypes::TransportationMode mode) const
 {
     const int i = findConnectionIndex(fromId, toId, mode);
-    return i >= 0 ? &connections.at(i) : nullptr;
+    return i >= 0 ? &m_connections.at(i) : nullptr;
 }
 
 bool ScenarioDocument::addGlobalLink(const GlobalLink &g)
@@ -856,7 +1108,8 @@ bool ScenarioDocument::addGlobalLink(const GlobalLink &g)
             << "mode=" << static_cast<int>(g.mode);
         return false;
     }
-    globalLinks.append(g);
+    m_globalLinks.append(g);
+    indexAppended(IndexedList::GlobalLinks);
     emit globalLinkAdded(g);
     return true;
 }
@@ -870,7 +1123,8 @@ bool ScenarioDocument::removeGlobalLink(
     const int i = findGlobalLinkIndex(fromQual, toQual, mode);
     if (i >= 0)
     {
-        globalLinks.removeAt(i);
+        m_globalLinks.removeAt(i);
+        indexRemoved(IndexedList::GlobalLinks, i);
         emit globalLinkRemoved(fromQual, toQual, mode);
         return true;
     }
@@ -881,23 +1135,11 @@ int ScenarioDocument::findGlobalLinkIndex(
     const QString &fromId, const QString &toId,
     TransportationTypes::TransportationMode mode) const
 {
-    for (int i = 0; i < globalLinks.size(); ++i)
-    {
-        const GlobalLink &g = globalLinks.at(i);
-        if (g.fromTerminalId == fromId
-            && g.toTerminalId == toId
-            && g.mode == mode)
-            return i;
-    }
-    return -1;
-}
-
-GlobalLink *ScenarioDocument::findGlobalLink(
-    const QString &fromId, const QString &toId,
-    TransportationTypes::TransportationMode mode)
-{
-    const int i = findGlobalLinkIndex(fromId, toId, mode);
-    return i >= 0 ? &globalLinks[i] : nullptr;
+    const QList<int> positions =
+        indexedPositions(IndexedList::GlobalLinks,
+                         &LookupIndex::globalLinkByRoute,
+                         routeKey(fromId, toId, mode));
+    return positions.isEmpty() ? -1 : positions.constFirst();
 }
 
 const GlobalLink *ScenarioDocument::findGlobalLink(
@@ -905,7 +1147,7 @@ const GlobalLink *ScenarioDocument::findGlobalLink(
     TransportationTypes::TransportationMode mode) const
 {
     const int i = findGlobalLinkIndex(fromId, toId, mode);
-    return i >= 0 ? &globalLinks.at(i) : nullptr;
+    return i >= 0 ? &m_globalLinks.at(i) : nullptr;
 }
 
 bool ScenarioDocument::updateConnection(
@@ -927,7 +1169,7 @@ bool ScenarioDocument::updateConnection(
                 << "removeConnection/addConnection";
             return false;
         }
-        connections[i] = updated;
+        m_connections[i] = updated;
         emit connectionChanged(fromId, toId, mode);
         return true;
     }
@@ -955,7 +1197,7 @@ bool ScenarioDocument::updateGlobalLink(
                 << "removeGlobalLink/addGlobalLink";
             return false;
         }
-        globalLinks[i] = updated;
+        m_globalLinks[i] = updated;
         emit globalLinkChanged(fromId, toId, mode);
         return true;
     }
@@ -971,49 +1213,47 @@ bool ScenarioDocument::updateLinkage(
     qCDebug(lcScenario)
         << "ScenarioDocument::updateLinkage:"
         << terminalId << networkName << nodeId;
-    for (int i = 0; i < linkages.size(); ++i)
+    const int i = findLinkageIndex(terminalId, networkName, nodeId);
+    if (i >= 0)
     {
-        const NodeLinkage &l = linkages.at(i);
-        if (l.terminalId  == terminalId
-            && l.networkName == networkName
-            && l.nodeId      == nodeId)
+        if (!linkageIdentityMatches(updated, terminalId,
+                                    networkName, nodeId))
         {
-            if (!linkageIdentityMatches(updated, terminalId,
-                                        networkName, nodeId))
-            {
-                qCWarning(lcScenario)
-                    << "ScenarioDocument::updateLinkage:"
-                    << "linkage identity changes are not allowed; use"
-                    << "removeLinkage/addLinkage";
-                return false;
-            }
-            if (!updated.excluded)
+            qCWarning(lcScenario)
+                << "ScenarioDocument::updateLinkage:"
+                << "linkage identity changes are not allowed; use"
+                << "removeLinkage/addLinkage";
+            return false;
+        }
+        if (!updated.excluded)
+        {
+            const QList<int> sameNode = indexedPositions(
+                IndexedList::Linkages, &LookupIndex::linkagesByNode,
+                nodeKey(updated.networkName, updated.nodeId));
+            for (int j : sameNode)
             {
-                for (int j = 0; j < linkages.size(); ++j)
+                if (j == i)
+                    continue;
+                const NodeLinkage &existing = m_linkages.at(j);
+                if (activeLinkageUsesNetworkNode(
+                        existing, updated.networkName,
+                        updated.nodeId)
+                    && linkageRegion(*this, existing)
+                           == linkageRegion(*this, updated))
                 {
-                    if (j == i)
-                        continue;
-                    const NodeLinkage &existing = linkages.at(j);
-                    if (activeLinkageUsesNetworkNode(
-                            existing, updated.networkName,
-                            updated.nodeId)
-                        && linkageRegion(*this, existing)
-                               == linkageRegion(*this, updated))
-                    {
-                        qCWarning(lcScenario)
-                            << "ScenarioDocument::updateLinkage:"
-                            << "network node already linked to terminal"
-                            << existing.terminalId
-                            << "network=" << updated.networkName
-                            << "node=" << updated.nodeId;
-                        return false;
-                    }
+                    qCWarning(lcScenario)
+                        << "ScenarioDocument::updateLinkage:"
+                        << "network node already linked to terminal"
+                        << existing.terminalId
+                        << "network=" << updated.networkName
+                        << "node=" << updated.nodeId;
+                    return false;
                 }
             }
-            linkages[i] = updated;
-            emit linkageChanged(terminalId, networkName, nodeId);
-            return true;
         }
+        m_linkages[i] = updated;
+        emit linkageChanged(terminalId, networkName, nodeId);
+        return true;
     }
     qCWarning(lcScenario)
         << "ScenarioDocument::updateLinkage: not found";
@@ -10,9 +10,11 @@
 #include "SimulationSettings.h"
 #include "TerminalPlacement.h"
 
+#include <QHash>
 #include <QList>
 #include <QMap>
 #include <QJsonObject>
+#include <QMutex>
 #include <QObject>
 #include <QPointF>        // for globalPositionOf() return type
 #include <QString>
@@ -69,7 +71,9 @@ struct DestinationRoute
 ///
 /// Direct mutation of member QMaps outside of the provided methods is a
 /// programmer error (but not enforced at compile time since the maps are
-/// public for read convenience).
+/// public for read convenience). Linkages, connections and global links
+/// are indexed, so they are private: read them through the const
+/// accessors and edit them only through the mutators.
 class ScenarioDocument : public QObject
 {
     Q_OBJECT
@@ -84,9 +88,6 @@ public:
     FleetSpec          fleet;
     QMap<QString, RegionSpec>        regions;
     QMap<QString, TerminalPlacement> terminals;
-    QList<NodeLinkage>               linkages;
-    QList<Connection>                connections;
-    QList<GlobalLink>                globalLinks;
     QList<QJsonObject>               comparisonSnapshots;
 
     // Scenario-scope auto-rules for cross-region links
@@ -100,6 +101,18 @@ public:
     /// Clear all state and emit documentReset().
     void reset();
 
+    const QList<NodeLinkage> &linkages() const { return m_linkages; }
+    const QList<Connection>  &connections() const { return m_connections; }
+    const QList<GlobalLink>  &globalLinks() const { return m_globalLinks; }
+
+    /// Replaces all linkages, connections and global links at once,
+    /// without the per-record invariant checks or signals. For bulk
+    /// loaders that must keep every parsed row for ScenarioValidator and
+    /// for linker resolution; interactive edits use the methods below.
+    void replaceRelationships(QList<NodeLinkage> linkages,
+                              QList<Connection>  connections,
+                              QList<GlobalLink>  globalLinks);
+
     // Region CRUD. Each returns false and is a no-op on invariant violation.
     bool addRegion(const RegionSpec &r);
     bool removeRegion(const QString &name);
@@ -135,6 +148,8 @@ public:
     bool addLinkage(const NodeLinkage &l);
     bool removeLinkage(const QString &terminalId,
                        const QString &networkName, int nodeId);
+    int findLinkageIndex(const QString &terminalId,
+                         const QString &networkName, int nodeId) const;
 
     bool addConnection(const Connection &c);
     bool removeConnection(const QString &fromId, const QString &toId,
@@ -142,9 +157,6 @@ public:
     int findConnectionIndex(
         const QString &fromId, const QString &toId,
         TransportationTypes::TransportationMode mode) const;
-    Connection *findConnection(
-        const QString &fromId, const QString &toId,
-        TransportationTypes::TransportationMode mode);
     const Connection *findConnection(
         const QString &fromId, const QString &toId,
         TransportationTypes::TransportationMode mode) const;
@@ -155,9 +167,6 @@ public:
     int findGlobalLinkIndex(
         const QString &fromId, const QString &toId,
         TransportationTypes::TransportationMode mode) const;
-    GlobalLink *findGlobalLink(
-        const QString &fromId, const QString &toId,
-        TransportationTypes::TransportationMode mode);
     const GlobalLink *findGlobalLink(
         const QString &fromId, const QString &toId,
         TransportationTypes::TransportationMode mode) const;
@@ -188,6 +197,11 @@ public:
     QList<NodeLinkage> linkagesFor(const QString     &terminalId,
                                    NetworkSpec::Type  type) const;
 
+    /// Every linkage (active or excluded, any region) that targets
+    /// @p nodeId on a network named @p networkName, in list order.
+    QList<NodeLinkage> linkagesAtNode(const QString &networkName,
+                                      int            nodeId) const;
+
     /// Computes the terminal's global lat/lon per design spec §4:
     ///   global_lat = region.globalPosition.lat
     ///              + (placement.latLon.latitude  - region.localOrigin.latitude)
@@ -319,6 +333,63 @@ signals:
     void originContainersChanged(const QString &terminalId);
 
 private:
+    /// Secondary lookup indices over `m_linkages`, `m_connections` and
+    /// `m_globalLinks`: by terminal id, by (network, node id) and by
+    /// (from, to, mode) endpoint pair. Values are list positions in
+    /// ascending order, as of the last rebuild.
+    ///
+    /// An index is built lazily on the first query after an
+    /// invalidation. Appends are indexed in place. A single removal only
+    /// records its index position in `removed*`; queries skip those and
+    /// shift the rest by the number of earlier removals, and the index
+    /// is rebuilt once the log outgrows an eighth of the list.
+    /// Multi-record cascades compact the list in one pass and
+    /// invalidate. Const queries take `m_indexMutex`, so concurrent
+    /// readers (e.g. the parallel validator) are safe; mutation stays
+    /// single-threaded as before.
+    enum class IndexedList { Linkages, Connections, GlobalLinks };
+    struct LookupIndex
+    {
+        bool linkagesBuilt    = false;
+        bool connectionsBuilt = false;
+        bool globalLinksBuilt = false;
+        QHash<QString, QList<int>> linkageByIdentity;
+        QHash<QString, QList<int>> linkagesByTerminal;
+        QHash<QString, QList<int>> linkagesByNode;
+        QHash<QString, QList<int>> connectionByRoute;
+        QHash<QString, QList<int>> connectionsByTerminal;
+        QHash<QString, QList<int>> globalLinkByRoute;
+        QHash<QString, QList<int>> globalLinksByEndpoint;
+        QList<int> removedLinkages;    // index positions, ascending
+        QList<int> removedConnections;
+        QList<int> removedGlobalLinks;
+    };
+
+    bool       &indexBuilt(IndexedList which) const;
+    QList<int> &removedPositions(IndexedList which) const;
+    int         indexedCount(IndexedList which) const;
+    void        ensureIndex(IndexedList which) const; // m_indexMutex held
+    void        indexPosition(IndexedList which, int position,
+                              int removedBefore = 0) const;
+    void        indexAppended(IndexedList which);
+    void        indexRemoved(IndexedList which, int position);
+    void        invalidateIndex(IndexedList which);
+    void        invalidateIndices();
+    QList<int>  indexedPositions(IndexedList which,
+                                 const QHash<QString, QList<int>>
+                                     LookupIndex::*table,
+                                 const QString &key) const;
+
+    bool hasRegionScopedDependencies(const QString &terminalId,
+                                     const QString &region) const;
+
+    QList<NodeLinkage> m_linkages;
+    QList<Connection>  m_connections;
+    QList<GlobalLink>  m_globalLinks;
+
+    mutable LookupIndex m_index;
+    mutable QMutex      m_indexMutex;
+
     /// Origin container pools keyed by origin terminal id. Owned: every
     /// `Container*` in every value list is freed in `reset()`, the
     /// destructor, and when `setOriginContainers(id, …)` replaces an
@@ -4,6 +4,7 @@
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QList>
+#include <QMetaType>
 #include <QString>
 
 #include "Backend/Commons/TransportationMode.h"
@@ -118,3 +119,5 @@ private:
 } // namespace Scenario
 } // namespace Backend
 } // namespace CargoNetSim
+
+Q_DECLARE_METATYPE(CargoNetSim::Backend::Scenario::PathExecutionResult)
@@ -1,6 +1,7 @@
 #include "ScenarioExecutor.h"
 
 #include <exception>
+#include <QSet>
 #include <QThread>
 #include <QUuid>
 
@@ -20,6 +21,7 @@
 #include "ExecutionProgressCalculator.h"
 #include "NetworkExecutionSessionManager.h"
 #include "PathExecutionCoordinator.h"
+#include "PropertyKeys.h"
 #include "ResultsExtractor.h"
 #include "ScenarioDocument.h"
 #include "ScenarioRegistry.h"
@@ -641,6 +643,12 @@ ScenarioExecutor::ScenarioExecutor(QObject *parent)
 {
 }
 
+void ScenarioExecutor::setController(
+    CargoNetSim::CargoNetSimController *controller)
+{
+    m_controller = controller;
+}
+
 void ScenarioExecutor::setDocument(const ScenarioDocument *document)
 {
     m_document = document;
@@ -675,6 +683,11 @@ void ScenarioExecutor::setIsolationPolicy(
     m_isolationPolicy = isolationPolicy;
 }
 
+void ScenarioExecutor::setRetainPathResults(bool retain)
+{
+    m_retainPathResults = retain;
+}
+
 void ScenarioExecutor::requestStop()
 {
     m_stopRequested.store(true);
@@ -735,8 +748,7 @@ bool ScenarioExecutor::runIsolatedAlternativeExecutions()
         << "pathCount=" << m_paths.size()
         << "policy=" << isolationPolicyLabel(m_isolationPolicy);
 
-    auto &controller =
-        CargoNetSim::CargoNetSimController::getInstance();
+    auto &controller = *m_controller;
 
     ScenarioExecutionResultSet aggregateResults;
     const int totalAlternatives = m_paths.size();
@@ -934,7 +946,9 @@ bool ScenarioExecutor::runIsolatedAlternativeExecutions()
         for (const auto &pathResult :
              childExecutor.executionResults().pathResults())
         {
-            aggregateResults.addPathResult(pathResult);
+            if (m_retainPathResults)
+                aggregateResults.addPathResult(pathResult);
+            emit pathResultReady(pathResult);
         }
 
         m_dispatchableSegments =
@@ -995,6 +1009,9 @@ bool ScenarioExecutor::run()
     m_stopRequested.store(false);
     m_pauseRequested.store(false);
 
+    if (!m_controller)
+        m_controller = &CargoNetSim::CargoNetSimController::getInstance();
+
     QString err;
     try
     {
@@ -1013,8 +1030,7 @@ bool ScenarioExecutor::run()
             return runIsolatedAlternativeExecutions();
         }
 
-        auto &controller =
-            CargoNetSim::CargoNetSimController::getInstance();
+        auto &controller = *m_controller;
         auto *config     = controller.getConfigController();
         auto *vehicles   = controller.getVehicleController();
         auto *regionData = controller.getRegionDataController();
@@ -1181,10 +1197,17 @@ bool ScenarioExecutor::run()
                 << "dispatchableSegments="
                 << m_dispatchableSegments.size();
 
+            Commons::ChunkedUpload seedUpload;
+            seedUpload.progress = [this](int sent, int total) {
+                emit statusMessage(
+                    QStringLiteral("Seeded %1/%2 terminal containers")
+                        .arg(sent)
+                        .arg(total));
+            };
             if (pickupCoordinator
                 && !pickupCoordinator->seedExecutionInventory(
                     m_executionPlan, allocation,
-                    /*addTimeSeconds=*/0.0, &err))
+                    /*addTimeSeconds=*/0.0, &err, seedUpload))
             {
                 const QString message =
                     err.isEmpty()
@@ -1281,7 +1304,12 @@ bool ScenarioExecutor::run()
         NetworkExecutionSessionManager sessionManager(
             *m_registry, regionData, controller.getTrainClient(),
             controller.getShipClient(), controller.getTruckManager(),
-            controller.truckExecutablePath());
+            controller.truckExecutablePath(),
+            config
+                && config->getSimulationParams()
+                       .value(PropertyKeys::Simulation::TruckBatchTrips,
+                              false)
+                       .toBool());
 
         double currentTimeSeconds = 0.0;
         int waveCounter = 0;
@@ -1522,6 +1550,62 @@ bool ScenarioExecutor::run()
             return true;
         };
 
+        // Paths are extracted as soon as the ledger reports them completed
+        // so pathResultReady() streams during the run instead of after it.
+        // TerminalSim's per-execution records are cleared once at the end.
+        ResultsExtractor extractor(controller.getShipClient(),
+                                   controller.getTrainClient(),
+                                   controller.getTruckManager(),
+                                   terminalClient,
+                                   config, this);
+        connect(&extractor, &ResultsExtractor::statusMessage,
+                this, &ScenarioExecutor::statusMessage);
+        connect(&extractor, &ResultsExtractor::errorMessage,
+                this, &ScenarioExecutor::errorMessage);
+
+        QSet<QString> extractedPathKeys;
+        auto extractCompletedPaths = [&](bool remaining) {
+            QList<CargoNetSim::Backend::Path *> readyPaths;
+            QVector<QString>                    readyKeys;
+            for (int index = 0;
+                 index < executableSelection.paths.size(); ++index)
+            {
+                auto *path = executableSelection.paths[index];
+                if (!path)
+                    continue;
+                const QString executionPathKey =
+                    index < executableSelection.executionPathKeys.size()
+                        && !executableSelection.executionPathKeys[index]
+                                .isEmpty()
+                    ? executableSelection.executionPathKeys[index]
+                    : path->canonicalPathKey();
+                if (extractedPathKeys.contains(executionPathKey))
+                    continue;
+                if (!remaining)
+                {
+                    const auto it = m_executionLedger.pathStates
+                                        .constFind(executionPathKey);
+                    if (it == m_executionLedger.pathStates.constEnd()
+                        || it.value().lifecycle
+                               != PathLifecycleState::Completed)
+                        continue;
+                }
+                extractedPathKeys.insert(executionPathKey);
+                readyPaths.append(path);
+                readyKeys.append(executionPathKey);
+            }
+            if (readyPaths.isEmpty())
+                return;
+
+            extractor.streamExecutionResults(
+                readyPaths, readyKeys, &allocation, executionId,
+                [this](const PathExecutionResult &pathResult) {
+                    if (m_retainPathResults)
+                        m_executionResults.addPathResult(pathResult);
+                    emit pathResultReady(pathResult);
+                });
+        };
+
         while (true)
         {
             if (m_stopRequested.load())
@@ -1554,6 +1638,8 @@ bool ScenarioExecutor::run()
                 return failRun(failureMessage);
             }
 
+            extractCompletedPaths(false);
+
             if (allExecutablePathsCompleted(m_executionPlan,
                                             m_executionLedger))
             {
@@ -1769,25 +1855,17 @@ bool ScenarioExecutor::run()
             }
         }
 
-        // Extract per-path results from simulator state.
+        // Extract whatever the loop has not streamed yet.
         qCDebug(lcScenario) << "ScenarioExecutor::run: extracting results";
-        ResultsExtractor extractor(controller.getShipClient(),
-                                   controller.getTrainClient(),
-                                   controller.getTruckManager(),
-                                   terminalClient,
-                                   config, this);
-        connect(&extractor, &ResultsExtractor::statusMessage,
-                this, &ScenarioExecutor::statusMessage);
-        connect(&extractor, &ResultsExtractor::errorMessage,
-                this, &ScenarioExecutor::errorMessage);
-
-        m_executionResults = extractor.extractExecutionResults(
-            executableSelection.paths,
-            executableSelection.executionPathKeys,
-            &allocation,
-            executionId);
+        emit statusMessage(
+            QStringLiteral("Extracting simulation results..."));
+        extractCompletedPaths(true);
+        extractor.clearTerminalExecutionRecords(executionId);
         qCDebug(lcScenario) << "ScenarioExecutor::run: extracted"
-                            << m_executionResults.size() << "path results";
+                            << extractedPathKeys.size() << "path results"
+                            << "retained=" << m_executionResults.size();
+        emit statusMessage(QStringLiteral(
+            "Results extraction completed successfully"));
 
         emit statusMessage(QStringLiteral(
             "Simulation validation completed successfully"));
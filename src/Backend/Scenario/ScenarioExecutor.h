@@ -12,6 +12,7 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
 namespace Backend
 {
 class Path;
@@ -47,6 +48,13 @@ public:
 
     // --- Input setters (called on the orchestrating thread before run) ---
 
+    /**
+     * @brief Set the runtime context whose clients and stores the run
+     *        uses. Defaults to the default CargoNetSimController
+     *        instance.
+     */
+    void setController(CargoNetSim::CargoNetSimController *controller);
+
     /** @brief Set the scenario document (originContainers, terminals, etc.). */
     void setDocument(const ScenarioDocument *document);
 
@@ -68,6 +76,14 @@ public:
      */
     void setIsolationPolicy(ExecutionIsolationPolicy isolationPolicy);
 
+    /**
+     * @brief Set whether run() keeps every path result in
+     *        executionResults(). Defaults to true; callers that consume
+     *        pathResultReady() exclusively turn it off so memory stays
+     *        bounded by the paths still in flight.
+     */
+    void setRetainPathResults(bool retain);
+
     /**
      * @brief Lifecycle entry point. Validates inputs, runs the
      *        builder/orchestrator/extractor pipeline, emits status,
@@ -115,6 +131,15 @@ signals:
     void progressSnapshotChanged(
         double currentTime,
         const ExecutionProgressSnapshot &snapshot);
+    /**
+     * @brief Emitted once per selected path as soon as its result is
+     *        final — after each isolated alternative, or in shared-state
+     *        runs on the first orchestration step that sees the path
+     *        completed in the ledger. Lets streaming output writers
+     *        consume results while the simulation is still running.
+     */
+    void pathResultReady(
+        const CargoNetSim::Backend::Scenario::PathExecutionResult &result);
     void succeeded();
     void failed(const QString &message);
     void finished();
@@ -128,6 +153,7 @@ private:
     bool validateInputs(QString *err);
     bool runIsolatedAlternativeExecutions();
 
+    CargoNetSim::CargoNetSimController *m_controller = nullptr;
     const ScenarioDocument             *m_document = nullptr;
     const ScenarioRegistry             *m_registry = nullptr;
     QList<CargoNetSim::Backend::Path *> m_paths;
@@ -136,6 +162,7 @@ private:
         ExecutionDemandPolicy::AllocatedOnly;
     ExecutionIsolationPolicy            m_isolationPolicy =
         ExecutionIsolationPolicy::SharedSimulatorState;
+    bool                                m_retainPathResults = true;
     ScenarioExecutionResultSet          m_executionResults;
     ScenarioExecutionPlan               m_executionPlan;
     ExecutionLedger                     m_executionLedger;
@@ -10,6 +10,7 @@
 #include "Backend/Controllers/CargoNetSimController.h"
 #include "Backend/Controllers/ConfigController.h"
 #include "InterfaceConversion.h"
+#include "NetworkImageCache.h"
 #include "NetworkLookup.h"
 #include "PathMetricsCalculator.h"
 #include "PropertyKeys.h"
@@ -314,6 +315,7 @@ std::optional<QPointF> terminalGlobalPositionForRoute(
 
 std::optional<QVariantMap> canonicalPropertiesFromEstimate(
     const ScenarioDocument &doc,
+    const ScenarioRegistry &registry,
     Mode                    mode,
     double                  distanceMeters,
     double                  travelTimeSeconds,
@@ -322,7 +324,7 @@ std::optional<QVariantMap> canonicalPropertiesFromEstimate(
     if (!isPositiveFinite(distanceMeters))
         return std::nullopt;
 
-    auto *controller = CargoNetSim::CargoNetSimController::instance();
+    auto *controller = registry.controller();
     auto *config = controller ? controller->getConfigController()
                               : nullptr;
     if (!config)
@@ -363,6 +365,7 @@ std::optional<QVariantMap> canonicalPropertiesFromEstimate(
 
 std::optional<QVariantMap> approximatePropertiesFromTerminalPositions(
     const ScenarioDocument &doc,
+    const ScenarioRegistry &registry,
     const QString          &fromTerminalId,
     const QString          &toTerminalId,
     Mode                    mode)
@@ -376,7 +379,7 @@ std::optional<QVariantMap> approximatePropertiesFromTerminalPositions(
         Commons::GeoDistance::haversineMeters(
             from->y(), from->x(), to->y(), to->x());
     return canonicalPropertiesFromEstimate(
-        doc, mode, distanceMeters, 0.0, false);
+        doc, registry, mode, distanceMeters, 0.0, false);
 }
 
 std::optional<QVariantMap> networkBackedPropertiesForConnection(
@@ -429,7 +432,7 @@ std::optional<QVariantMap> networkBackedPropertiesForConnection(
             }
 
             auto properties = canonicalPropertiesFromEstimate(
-                doc, connection.mode, path.totalLength,
+                doc, registry, connection.mode, path.totalLength,
                 path.minTravelTime, true);
             if (properties)
                 return properties;
@@ -464,7 +467,7 @@ void enrichConnectionRouteMetrics(Connection             &connection,
     {
         computedProperties =
             approximatePropertiesFromTerminalPositions(
-                doc, connection.fromTerminalId,
+                doc, registry, connection.fromTerminalId,
                 connection.toTerminalId, connection.mode);
     }
 
@@ -483,7 +486,8 @@ void enrichConnectionRouteMetrics(Connection             &connection,
 }
 
 void enrichGlobalLinkRouteMetrics(GlobalLink             &globalLink,
-                                  const ScenarioDocument &doc)
+                                  const ScenarioDocument &doc,
+                                  const ScenarioRegistry &registry)
 {
     if (hasCompleteRouteMetrics(globalLink.properties))
         return;
@@ -497,7 +501,7 @@ void enrichGlobalLinkRouteMetrics(GlobalLink             &globalLink,
 
     const auto computedProperties =
         approximatePropertiesFromTerminalPositions(
-            doc, fromEndpoint.terminalId,
+            doc, registry, fromEndpoint.terminalId,
             toEndpoint.terminalId, globalLink.mode);
     if (!computedProperties)
     {
@@ -522,10 +526,11 @@ void enrichConnectionRouteMetrics(QList<Connection>      &connections,
 }
 
 void enrichGlobalLinkRouteMetrics(QList<GlobalLink>      &globalLinks,
-                                  const ScenarioDocument &doc)
+                                  const ScenarioDocument &doc,
+                                  const ScenarioRegistry &registry)
 {
     for (GlobalLink &globalLink : globalLinks)
-        enrichGlobalLinkRouteMetrics(globalLink, doc);
+        enrichGlobalLinkRouteMetrics(globalLink, doc, registry);
 }
 
 LinkageRuleFn truckParkingToTruckNodeRule()
@@ -682,7 +687,7 @@ ConnectionRuleFn byNetworksRule()
 
         // Group linkages by (terminal, networkName).
         QMap<QString, QSet<QString>> networksPerTerminal;
-        for (const NodeLinkage &l : doc.linkages)
+        for (const NodeLinkage &l : doc.linkages())
         {
             if (!doc.terminals.contains(l.terminalId)) continue;
             if (doc.terminals[l.terminalId].region != region) continue;
@@ -990,7 +995,7 @@ ScenarioLinker::resolveLinkages(const ScenarioDocument &doc,
         const RegionSpec &r   = it.value();
 
         QList<NodeLinkage> manual;
-        for (const NodeLinkage &l : doc.linkages)
+        for (const NodeLinkage &l : doc.linkages())
             if (!l.excluded && doc.terminals.contains(l.terminalId) &&
                 doc.terminals[l.terminalId].region == region)
                 manual.append(l);
@@ -1017,7 +1022,7 @@ ScenarioLinker::resolveLinkages(const ScenarioDocument &doc,
             break;
         case LinkageStrategy::Auto:
             for (const NodeLinkage &l : autoFromRules)
-                if (!isExcluded(doc.linkages, l.terminalId, l.networkName, l.nodeId))
+                if (!isExcluded(doc.linkages(), l.terminalId, l.networkName, l.nodeId))
                     appendIfNetworkNodeAvailable(out, usedNodes, l,
                                                  QStringLiteral("auto"));
             break;
@@ -1026,7 +1031,7 @@ ScenarioLinker::resolveLinkages(const ScenarioDocument &doc,
                 appendIfNetworkNodeAvailable(out, usedNodes, l,
                                              QStringLiteral("hybrid/manual"));
             for (const NodeLinkage &l : autoFromRules)
-                if (!isExcluded(doc.linkages, l.terminalId, l.networkName, l.nodeId))
+                if (!isExcluded(doc.linkages(), l.terminalId, l.networkName, l.nodeId))
                     appendIfNetworkNodeAvailable(out, usedNodes, l,
                                                  QStringLiteral("hybrid/auto"));
             break;
@@ -1054,7 +1059,7 @@ ScenarioLinker::resolveConnections(const ScenarioDocument &doc,
         // Manual set = connections whose region matches AND whose endpoints
         // both belong to this region (defence against stale/malformed entries).
         QList<Connection> manual;
-        for (const Connection &c : doc.connections)
+        for (const Connection &c : doc.connections())
         {
             if (manualConnectionBelongsToRegion(doc, c, region))
                 manual.append(c);
@@ -1091,14 +1096,14 @@ ScenarioLinker::resolveGlobalLinks(const ScenarioDocument &doc,
                                    const ScenarioRegistry &registry)
 {
     qCInfo(lcScenario) << "ScenarioLinker::resolveGlobalLinks: begin,"
-                       << "manual=" << doc.globalLinks.size()
+                       << "manual=" << doc.globalLinks().size()
                        << "autoRules=" << doc.globalLinkAutoRules.size();
     QList<GlobalLink> out;
 
     // Manual set = the document's globalLinks as-is. Endpoints may be bare
     // ids or qualified "region/id" strings; validation owns cross-form
     // consistency checks.
-    const QList<GlobalLink> &manual = doc.globalLinks;
+    const QList<GlobalLink> &manual = doc.globalLinks();
 
     QList<GlobalLink> autoFromRules;
     for (const QString &ruleName : doc.globalLinkAutoRules)
@@ -1120,7 +1125,7 @@ ScenarioLinker::resolveGlobalLinks(const ScenarioDocument &doc,
     case LinkageStrategy::Auto:   out.append(autoFromRules); break;
     case LinkageStrategy::Hybrid: out.append(manual); out.append(autoFromRules); break;
     }
-    enrichGlobalLinkRouteMetrics(out, doc);
+    enrichGlobalLinkRouteMetrics(out, doc, registry);
     qCDebug(lcScenario) << "ScenarioLinker::resolveGlobalLinks: total resolved"
                         << out.size();
     return out;
@@ -1144,6 +1149,10 @@ bool ScenarioLinker::loadNetworksForPreview(const ScenarioDocument &doc,
     // Rail: construct network, then loadNetwork(nodesFile, linksFile).
     // Truck: readConfig(configFile) returns an IntegrationSimulationConfig
     //        that owns a populated IntegrationNetwork. Store the config.
+    //
+    // Both then search a shared NetworkImage (NetworkImageCache), so
+    // repeated previews and concurrent runtimes map one copy of each
+    // network's routing graph.
 
     for (const RegionSpec &r : doc.regions.values())
     {
@@ -1160,7 +1169,9 @@ bool ScenarioLinker::loadNetworksForPreview(const ScenarioDocument &doc,
                             "Rail network requires 'nodes' and 'links' files");
 
                     auto *net = new TrainClient::NeTrainSimNetwork();
-                    net->loadNetwork(nodesFile, linksFile);
+                    net->loadNetwork(nodesFile, linksFile,
+                                     NetworkImageCache::openRail(n));
+                    NetworkImageCache::attach(n, *net);
                     registry.setPreviewRailNetwork(n.name, net);
                     qCDebug(lcScenario) << "ScenarioLinker::loadNetworksForPreview:"
                                         << "loaded rail network" << n.name;
@@ -1178,6 +1189,7 @@ bool ScenarioLinker::loadNetworksForPreview(const ScenarioDocument &doc,
                         throw std::runtime_error(
                             "IntegrationSimulationConfigReader returned null");
 
+                    NetworkImageCache::attach(n, *cfg);
                     registry.setPreviewTruckConfig(n.name, cfg);
                     qCDebug(lcScenario) << "ScenarioLinker::loadNetworksForPreview:"
                                         << "loaded truck network" << n.name;
@@ -1,6 +1,7 @@
 #include "ScenarioRegistry.h"
 
 #include "Backend/Commons/LogCategories.h"
+#include "Backend/Controllers/CargoNetSimController.h"
 #include "Backend/Models/Terminal.h"
 
 namespace CargoNetSim
@@ -146,6 +147,18 @@ bool ScenarioRegistry::hasPreviewNetworks() const
     return !m_previewRail.isEmpty() || !m_previewTruckCfg.isEmpty();
 }
 
+void ScenarioRegistry::setController(
+    CargoNetSim::CargoNetSimController *controller)
+{
+    m_controller = controller;
+}
+
+CargoNetSim::CargoNetSimController *ScenarioRegistry::controller() const
+{
+    return m_controller ? m_controller
+                        : CargoNetSim::CargoNetSimController::instance();
+}
+
 } // namespace Scenario
 } // namespace Backend
 } // namespace CargoNetSim
@@ -11,6 +11,8 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
+
 namespace Backend
 {
 class Terminal;
@@ -70,12 +72,20 @@ public:
 
     bool hasPreviewNetworks() const;
 
+    /// Runtime context whose live networks and settings back this
+    /// registry. ScenarioApplier::apply sets it; until then the default
+    /// CargoNetSimController instance (possibly null) is returned.
+    void setController(CargoNetSim::CargoNetSimController *controller);
+    CargoNetSim::CargoNetSimController *controller() const;
+
 private:
     QMap<QString, Terminal *> m_terminals;
     TruckFleetSpec            m_truckFleet;
 
     QMap<QString, TrainClient::NeTrainSimNetwork           *> m_previewRail;        // owned
     QMap<QString, TruckClient::IntegrationSimulationConfig *> m_previewTruckCfg;    // owned (owns its network)
+
+    CargoNetSim::CargoNetSimController *m_controller = nullptr;
 };
 
 } // namespace Scenario
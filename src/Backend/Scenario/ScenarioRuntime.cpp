@@ -25,8 +25,19 @@ namespace Scenario
 
 ScenarioRuntime::ScenarioRuntime(
     std::unique_ptr<ScenarioDocument> doc, QObject *parent)
+    : ScenarioRuntime(std::move(doc),
+                      CargoNetSim::CargoNetSimController::instance(),
+                      parent)
+{
+}
+
+ScenarioRuntime::ScenarioRuntime(
+    std::unique_ptr<ScenarioDocument>   doc,
+    CargoNetSim::CargoNetSimController *controller,
+    QObject                            *parent)
     : QObject(parent)
     , m_document(std::move(doc))
+    , m_controller(controller)
 {
     attachDocumentInvalidationObservers();
 }
@@ -72,8 +83,13 @@ bool ScenarioRuntime::load()
     }
 
     qCDebug(lcScenario) << "ScenarioRuntime::load: applying scenario to controller";
-    auto &controller =
-        CargoNetSim::CargoNetSimController::getInstance();
+    if (!m_controller)
+    {
+        qCWarning(lcScenario) << "ScenarioRuntime::load: no controller";
+        emit failed(QStringLiteral("No backend controller"));
+        return false;
+    }
+    auto &controller = *m_controller;
     QString err;
     m_applyingDocument = true;
     if (!ScenarioApplier::apply(*m_document, controller,
@@ -274,7 +290,8 @@ void ScenarioRuntime::refreshPreparedPathEligibility()
     m_preparedPathEligibility =
         PreparedPathEligibilityService::evaluateAll(
             m_preparedPaths,
-            PreparedPathEligibilityService::currentAvailability());
+            PreparedPathEligibilityService::currentAvailability(
+                m_controller));
 }
 
 bool ScenarioRuntime::setSelectedPathKeys(
@@ -374,13 +391,17 @@ bool ScenarioRuntime::startSimulation()
 
     qRegisterMetaType<ExecutionProgressSnapshot>(
         "CargoNetSim::Backend::Scenario::ExecutionProgressSnapshot");
+    qRegisterMetaType<PathExecutionResult>(
+        "CargoNetSim::Backend::Scenario::PathExecutionResult");
 
     // The executor receives explicit inputs; runtime owns orchestration state.
+    m_executor->setController(m_controller);
     m_executor->setDocument(m_document.get());
     m_executor->setRegistry(&m_registry);
     m_executor->setPaths(m_paths);
     m_executor->setExecutionPathKeys(m_selectedPathKeys);
     m_executor->setDemandPolicy(m_demandPolicy);
+    m_executor->setRetainPathResults(m_retainPathResults);
     m_executor->setIsolationPolicy(
         m_demandPolicy
                 == ExecutionDemandPolicy::DuplicateDemandPerSelectedPath
@@ -399,6 +420,8 @@ bool ScenarioRuntime::startSimulation()
             this, &ScenarioRuntime::onStepCompleted);
     connect(m_executor, &ScenarioExecutor::progressSnapshotChanged,
             this, &ScenarioRuntime::onProgressSnapshotChanged);
+    connect(m_executor, &ScenarioExecutor::pathResultReady,
+            this, &ScenarioRuntime::pathResultReady);
     connect(m_executor, &ScenarioExecutor::succeeded, this,
             &ScenarioRuntime::onExecutorSucceeded);
     connect(m_executor, &ScenarioExecutor::failed, this,
@@ -415,7 +438,7 @@ bool ScenarioRuntime::validateCurrentSelectionForSimulation(
 {
     return PreparedPathEligibilityService::validateSelection(
         m_preparedPaths, m_selectedPathKeys,
-        PreparedPathEligibilityService::currentAvailability(),
+        PreparedPathEligibilityService::currentAvailability(m_controller),
         err);
 }
 
@@ -550,10 +573,8 @@ bool ScenarioRuntime::isRunning() const
 
 QHash<QString, PathMetrics> ScenarioRuntime::actualPathMetrics() const
 {
-    auto &controller =
-        CargoNetSim::CargoNetSimController::getInstance();
     return m_lastExecutionResults.actualMetricsByExecutionPathKey(
-        controller.getConfigController());
+        m_controller ? m_controller->getConfigController() : nullptr);
 }
 
 const ScenarioDocument &ScenarioRuntime::document() const
@@ -16,6 +16,7 @@ class QThread;
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
 namespace Backend
 {
 class Path;
@@ -43,6 +44,11 @@ class ScenarioExecutor;
  *      thread, return immediately; result arrives via `completed`/`failed`
  *   6. stop()/pause()/resume()            — signal the active executor
  *
+ * Controller: the runtime uses the controller it was constructed with
+ * (the default CargoNetSimController instance unless one is passed) for
+ * apply, execution and metrics, so several runtimes of different
+ * contexts can run side by side in one process.
+ *
  * CLI blocking-wait idiom:
  *     QEventLoop loop;
  *     connect(rt, &ScenarioRuntime::completed, &loop, &QEventLoop::quit);
@@ -56,8 +62,17 @@ class ScenarioRuntime : public QObject
 public:
     explicit ScenarioRuntime(std::unique_ptr<ScenarioDocument> doc,
                              QObject                          *parent = nullptr);
+    ScenarioRuntime(std::unique_ptr<ScenarioDocument>   doc,
+                    CargoNetSim::CargoNetSimController *controller,
+                    QObject                            *parent = nullptr);
     ~ScenarioRuntime() override;
 
+    /** @brief Runtime context this runtime applies to and executes on. */
+    CargoNetSim::CargoNetSimController *controller() const
+    {
+        return m_controller;
+    }
+
     /** @brief Validate then apply the document onto CargoNetSimController.
      *         Populates the registry. Emits `failed` on first error.
      *
@@ -96,6 +111,11 @@ public:
         return m_demandPolicy;
     }
 
+    /** @brief Forwarded to ScenarioExecutor::setRetainPathResults(). When
+     *         off, executionResults()/results() stay empty and callers
+     *         must consume pathResultReady(). */
+    void setRetainPathResults(bool retain) { m_retainPathResults = retain; }
+
     /** @brief Spawn the executor on the worker thread. Returns immediately;
      *         progress via signals. Fails if load() hasn't run, or if a
      *         prior simulation is still active. */
@@ -154,6 +174,9 @@ signals:
     void progressSnapshotChanged(
         double currentTime,
         const ExecutionProgressSnapshot &snapshot);
+    /// Relayed from ScenarioExecutor::pathResultReady (queued onto the
+    /// runtime's thread).
+    void pathResultReady(const PathExecutionResult &result);
     void completed();
     void failed(const QString &message);
     void statusMessage(const QString &msg);
@@ -182,6 +205,7 @@ private:
     void clearPreparedPathState(const QString &reason, bool notify);
 
     std::unique_ptr<ScenarioDocument>   m_document;
+    CargoNetSim::CargoNetSimController *m_controller = nullptr;
     ScenarioRegistry                    m_registry;
     PreparedPathSet                     m_preparedPaths;
     QHash<QString, PreparedPathEligibility> m_preparedPathEligibility;
@@ -189,6 +213,7 @@ private:
     ScenarioExecutor                   *m_executor     = nullptr;
     QList<CargoNetSim::Backend::Path *> m_paths;
     QVector<QString>                    m_selectedPathKeys;
+    bool                                m_retainPathResults = true;
     ExecutionDemandPolicy               m_demandPolicy =
         ExecutionDemandPolicy::AllocatedOnly;
     ScenarioExecutionResultSet          m_lastExecutionResults;
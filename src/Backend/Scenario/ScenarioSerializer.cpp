@@ -10,7 +10,11 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QTextStream>
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
 #include <yaml-cpp/yaml.h>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
 
 namespace CargoNetSim
@@ -111,99 +115,87 @@ interfaceSetFromJsonObject(const QJsonObject &iface)
     return result;
 }
 
-// ----- YAML ↔ QJsonValue bridge -----
+// ----- YAML scalar / emitter helpers -----
 //
-// Strategy: convert YAML ↔ QJsonDocument once, then delegate to toJson/fromJson.
-// Keeps the JSON path as the single source of truth for the schema — YAML
-// support is purely a format translation layer.
-
-QJsonValue yamlNodeToJsonValue(const YAML::Node &node);
-
-QJsonObject yamlMapToJsonObject(const YAML::Node &map)
-{
-    QJsonObject o;
-    for (auto it = map.begin(); it != map.end(); ++it)
-    {
-        const QString key = QString::fromStdString(it->first.as<std::string>());
-        o[key] = yamlNodeToJsonValue(it->second);
-    }
-    return o;
-}
-
-QJsonArray yamlSeqToJsonArray(const YAML::Node &seq)
-{
-    QJsonArray a;
-    for (const YAML::Node &child : seq) a.append(yamlNodeToJsonValue(child));
-    return a;
-}
-
-QJsonValue yamlNodeToJsonValue(const YAML::Node &node)
+// YAML is read and written directly from the event stream (see
+// ScenarioYamlEventReader below and ScenarioSerializer::toYaml); there is
+// no whole-document YAML::Node or QJsonValue tree. Individual records are
+// still mapped through the per-struct JSON mappers so that one schema
+// definition serves both formats, but only one record is materialized at
+// a time.
+
+/// Plain-scalar typing shared by every YAML value: int, then double,
+/// then bool, finally string. Quoting is deliberately ignored, matching
+/// the historical yaml-cpp Node behaviour the scenario files rely on.
+QJsonValue yamlScalarToJsonValue(const std::string &s)
 {
-    switch (node.Type())
+    // Both numeric parses must consume the ENTIRE scalar, otherwise
+    // "0.6" would match std::stoll (returning 0, pos=1) and silently
+    // collapse to integer zero, breaking fractional fields like
+    // destination fractions and fuel rates.
+    try
     {
-    case YAML::NodeType::Null:   return QJsonValue();
-    case YAML::NodeType::Scalar:
+        size_t pos = 0;
+        qint64 i = static_cast<qint64>(std::stoll(s, &pos));
+        if (pos == s.size()) return QJsonValue(i);
+    } catch (...) {}
+    try
     {
-        const std::string s = node.Scalar();
-        // Try int, then double, then bool, finally string.
-        // Both numeric parses must consume the ENTIRE scalar, otherwise
-        // "0.6" would match std::stoll (returning 0, pos=1) and silently
-        // collapse to integer zero, breaking fractional fields like
-        // destination fractions and fuel rates.
-        try
-        {
-            size_t pos = 0;
-            qint64 i = static_cast<qint64>(std::stoll(s, &pos));
-            if (pos == s.size()) return QJsonValue(i);
-        } catch (...) {}
-        try
-        {
-            size_t pos = 0;
-            double d = std::stod(s, &pos);
-            if (pos == s.size()) return QJsonValue(d);
-        } catch (...) {}
-        if (s == "true" || s == "True")  return QJsonValue(true);
-        if (s == "false" || s == "False") return QJsonValue(false);
-        return QJsonValue(QString::fromStdString(s));
-    }
-    case YAML::NodeType::Sequence: return yamlSeqToJsonArray(node);
-    case YAML::NodeType::Map:      return yamlMapToJsonObject(node);
-    case YAML::NodeType::Undefined:
-    default:                       return QJsonValue();
-    }
+        size_t pos = 0;
+        double d = std::stod(s, &pos);
+        if (pos == s.size()) return QJsonValue(d);
+    } catch (...) {}
+    if (s == "true" || s == "True")  return QJsonValue(true);
+    if (s == "false" || s == "False") return QJsonValue(false);
+    return QJsonValue(QString::fromStdString(s));
 }
 
-YAML::Node jsonValueToYamlNode(const QJsonValue &v)
+void emitJsonValue(YAML::Emitter &out, const QJsonValue &v)
 {
-    YAML::Node out;
     switch (v.type())
     {
-    case QJsonValue::Null:   out = YAML::Node(YAML::NodeType::Null); break;
-    case QJsonValue::Bool:   out = v.toBool(); break;
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        out << YAML::Null;
+        break;
+    case QJsonValue::Bool:
+        out << v.toBool();
+        break;
     case QJsonValue::Double:
         if (v.toDouble() == static_cast<double>(v.toInt()))
-            out = v.toInt();
+            out << v.toInt();
         else
-            out = v.toDouble();
+            out << v.toDouble();
+        break;
+    case QJsonValue::String:
+        out << v.toString().toStdString();
         break;
-    case QJsonValue::String: out = v.toString().toStdString(); break;
     case QJsonValue::Array:
-    {
-        out = YAML::Node(YAML::NodeType::Sequence);
-        for (const QJsonValue &child : v.toArray()) out.push_back(jsonValueToYamlNode(child));
+        out << YAML::BeginSeq;
+        for (const QJsonValue &child : v.toArray())
+            emitJsonValue(out, child);
+        out << YAML::EndSeq;
         break;
-    }
     case QJsonValue::Object:
     {
-        out = YAML::Node(YAML::NodeType::Map);
-        QJsonObject o = v.toObject();
+        out << YAML::BeginMap;
+        const QJsonObject o = v.toObject();
         for (auto it = o.constBegin(); it != o.constEnd(); ++it)
-            out[it.key().toStdString()] = jsonValueToYamlNode(it.value());
+        {
+            out << YAML::Key << it.key().toStdString() << YAML::Value;
+            emitJsonValue(out, it.value());
+        }
+        out << YAML::EndMap;
         break;
     }
-    case QJsonValue::Undefined: out = YAML::Node(YAML::NodeType::Null); break;
     }
-    return out;
+}
+
+void emitKeyValue(YAML::Emitter &out, const char *key,
+                  const QJsonValue &value)
+{
+    out << YAML::Key << key << YAML::Value;
+    emitJsonValue(out, value);
 }
 
 // ----- Relative path resolution -----
@@ -555,6 +547,7 @@ QJsonObject simulationSettingsToJson(const SimulationSettings &s)
     if (s.timeValueOfMoney.has_value())      o["time_value_of_money"]      = s.timeValueOfMoney.value();
     if (s.useSpecificTimeValues.has_value()) o["use_specific_time_values"] = s.useSpecificTimeValues.value();
     if (s.carbonRate.has_value())            o["carbon_rate"]              = s.carbonRate.value();
+    if (s.truckBatchTrips.has_value())       o["truck_batch_trips"]        = s.truckBatchTrips.value();
 
     if (s.shipMultiplier.has_value() || s.railMultiplier.has_value() || s.truckMultiplier.has_value()) {
         QJsonObject mult;
@@ -629,6 +622,8 @@ SimulationSettings simulationSettingsFromJson(const QJsonObject &o)
         s.useSpecificTimeValues = o.value("use_specific_time_values").toBool();
     if (o.contains("carbon_rate"))
         s.carbonRate = o.value("carbon_rate").toDouble();
+    if (o.contains("truck_batch_trips"))
+        s.truckBatchTrips = o.value("truck_batch_trips").toBool();
 
     if (o.contains("multipliers")) {
         QJsonObject mult = o.value("multipliers").toObject();
@@ -737,6 +732,190 @@ FleetSpec fleetSpecFromJson(const QJsonObject &j)
     return f;
 }
 
+// ----- Event-driven YAML reader -----
+//
+// Consumes yaml-cpp parser events and assembles values bottom-up. The
+// large top-level record lists (terminals, linkages, connections,
+// global_links, comparison_snapshots) are never collected as arrays:
+// each item is converted to its typed struct as soon as its closing event
+// arrives, so only one record's generic value is alive at a time. The
+// remaining top-level sections are small and are kept as a QJsonObject
+// that fromJson() consumes unchanged.
+class ScenarioYamlEventReader final : public YAML::EventHandler
+{
+public:
+    struct Records
+    {
+        QJsonObject              sections;
+        QList<TerminalPlacement> terminals;
+        QList<NodeLinkage>       linkages;
+        QList<Connection>        connections;
+        QList<GlobalLink>        globalLinks;
+        QList<QJsonObject>       comparisonSnapshots;
+        bool                     rootIsMap = false;
+    };
+
+    Records &records() { return m_records; }
+
+    void OnDocumentStart(const YAML::Mark &) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark &, YAML::anchor_t anchor) override
+    {
+        complete(QJsonValue(), anchor);
+    }
+
+    void OnAlias(const YAML::Mark &, YAML::anchor_t anchor) override
+    {
+        complete(m_anchors.value(anchor), 0);
+    }
+
+    void OnScalar(const YAML::Mark &, const std::string &,
+                  YAML::anchor_t anchor,
+                  const std::string &value) override
+    {
+        // Map keys keep their raw text; only values are typed.
+        if (!m_stack.isEmpty() && m_stack.last().isMap
+            && !m_stack.last().hasKey)
+        {
+            m_stack.last().key    = QString::fromStdString(value);
+            m_stack.last().hasKey = true;
+            return;
+        }
+        complete(yamlScalarToJsonValue(value), anchor);
+    }
+
+    void OnSequenceStart(const YAML::Mark &, const std::string &,
+                         YAML::anchor_t anchor,
+                         YAML::EmitterStyle::value) override
+    {
+        push(/*isMap=*/false, anchor);
+    }
+
+    void OnSequenceEnd() override { pop(); }
+
+    void OnMapStart(const YAML::Mark &, const std::string &,
+                    YAML::anchor_t anchor,
+                    YAML::EmitterStyle::value) override
+    {
+        push(/*isMap=*/true, anchor);
+    }
+
+    void OnMapEnd() override { pop(); }
+
+private:
+    struct Frame
+    {
+        bool           isMap  = false;
+        bool           hasKey = false;
+        QString        key;
+        QString        streamKey; // non-empty → items go to dispatch()
+        QJsonObject    object;
+        QJsonArray     array;
+        YAML::anchor_t anchor = 0;
+    };
+
+    static bool isStreamedKey(const QString &key)
+    {
+        return key == QLatin1String("terminals")
+            || key == QLatin1String("linkages")
+            || key == QLatin1String("connections")
+            || key == QLatin1String("global_links")
+            || key == QLatin1String("comparison_snapshots");
+    }
+
+    void push(bool isMap, YAML::anchor_t anchor)
+    {
+        Frame f;
+        f.isMap  = isMap;
+        f.anchor = anchor;
+        if (m_stack.isEmpty())
+        {
+            m_records.rootIsMap = isMap;
+        }
+        else if (!isMap && m_stack.size() == 1 && m_stack[0].isMap
+                 && m_stack[0].hasKey && isStreamedKey(m_stack[0].key))
+        {
+            f.streamKey = m_stack[0].key;
+        }
+        m_stack.append(f);
+    }
+
+    void pop()
+    {
+        if (m_stack.isEmpty())
+            return;
+        Frame f = m_stack.takeLast();
+        if (m_stack.isEmpty())
+        {
+            if (f.isMap)
+                m_records.sections = f.object;
+            return;
+        }
+        if (!f.streamKey.isEmpty())
+        {
+            // Items were already dispatched; the root keeps no array.
+            m_stack.last().hasKey = false;
+            return;
+        }
+        complete(f.isMap ? QJsonValue(f.object) : QJsonValue(f.array),
+                 f.anchor);
+    }
+
+    void complete(const QJsonValue &value, YAML::anchor_t anchor)
+    {
+        if (anchor)
+            m_anchors.insert(anchor, value);
+        if (m_stack.isEmpty())
+            return; // scalar document — rejected by the caller
+
+        Frame &top = m_stack.last();
+        if (top.isMap)
+        {
+            if (!top.hasKey)
+            {
+                // Null or non-scalar key; mirror the string coercion
+                // yaml-cpp's as<std::string>() would have applied.
+                top.key    = value.toString();
+                top.hasKey = true;
+                return;
+            }
+            top.object.insert(top.key, value);
+            top.hasKey = false;
+        }
+        else if (!top.streamKey.isEmpty())
+        {
+            dispatch(top.streamKey, value);
+        }
+        else
+        {
+            top.array.append(value);
+        }
+    }
+
+    void dispatch(const QString &key, const QJsonValue &item)
+    {
+        if (key == QLatin1String("terminals"))
+            m_records.terminals.append(
+                terminalPlacementFromJson(item.toObject()));
+        else if (key == QLatin1String("linkages"))
+            m_records.linkages.append(nodeLinkageFromJson(item.toObject()));
+        else if (key == QLatin1String("connections"))
+            m_records.connections.append(
+                connectionFromJson(item.toObject()));
+        else if (key == QLatin1String("global_links"))
+            m_records.globalLinks.append(
+                globalLinkFromJson(item.toObject()));
+        else if (key == QLatin1String("comparison_snapshots")
+                 && item.isObject())
+            m_records.comparisonSnapshots.append(item.toObject());
+    }
+
+    QVector<Frame>                     m_stack;
+    QHash<YAML::anchor_t, QJsonValue>  m_anchors;
+    Records                            m_records;
+};
+
 } // namespace
 
 QJsonObject ScenarioSerializer::toJson(const ScenarioDocument &doc)
@@ -763,15 +942,15 @@ QJsonObject ScenarioSerializer::toJson(const ScenarioDocument &doc)
 
     // linkages are stored scenario-wide
     QJsonArray linkages;
-    for (const NodeLinkage &l : doc.linkages) linkages.append(nodeLinkageToJson(l));
+    for (const NodeLinkage &l : doc.linkages()) linkages.append(nodeLinkageToJson(l));
     root["linkages"] = linkages;
 
     QJsonArray connections;
-    for (const Connection &c : doc.connections) connections.append(connectionToJson(c));
+    for (const Connection &c : doc.connections()) connections.append(connectionToJson(c));
     root["connections"] = connections;
 
     QJsonArray globalLinks;
-    for (const GlobalLink &g : doc.globalLinks) globalLinks.append(globalLinkToJson(g));
+    for (const GlobalLink &g : doc.globalLinks()) globalLinks.append(globalLinkToJson(g));
     root["global_links"] = globalLinks;
 
     QJsonArray comparisonSnapshots;
@@ -788,9 +967,9 @@ QJsonObject ScenarioSerializer::toJson(const ScenarioDocument &doc)
     qCDebug(lcScenario) << "ScenarioSerializer::toJson: complete -"
                         << doc.regions.size() << "regions,"
                         << doc.terminals.size() << "terminals,"
-                        << doc.linkages.size() << "linkages,"
-                        << doc.connections.size() << "connections,"
-                        << doc.globalLinks.size() << "global links";
+                        << doc.linkages().size() << "linkages,"
+                        << doc.connections().size() << "connections,"
+                        << doc.globalLinks().size() << "global links";
     return root;
 }
 
@@ -862,17 +1041,25 @@ ScenarioSerializer::fromJson(const QJsonObject &j)
     // authoring invariant, so ScenarioValidator can report the exact invalid
     // row instead of losing user data during deserialization. Interactive
     // editing still goes through ScenarioDocument's strict mutators.
-    QJsonArray linkages = j.value("linkages").toArray();
-    for (const QJsonValue &lv : linkages)
-        doc->linkages.append(nodeLinkageFromJson(lv.toObject()));
-
-    QJsonArray connections = j.value("connections").toArray();
-    for (const QJsonValue &cv : connections)
-        doc->connections.append(connectionFromJson(cv.toObject()));
-
-    QJsonArray globalLinks = j.value("global_links").toArray();
-    for (const QJsonValue &gv : globalLinks)
-        doc->globalLinks.append(globalLinkFromJson(gv.toObject()));
+    const QJsonArray linkagesArr = j.value("linkages").toArray();
+    QList<NodeLinkage> linkages;
+    linkages.reserve(linkagesArr.size());
+    for (const QJsonValue &lv : linkagesArr)
+        linkages.append(nodeLinkageFromJson(lv.toObject()));
+
+    const QJsonArray connectionsArr = j.value("connections").toArray();
+    QList<Connection> connections;
+    connections.reserve(connectionsArr.size());
+    for (const QJsonValue &cv : connectionsArr)
+        connections.append(connectionFromJson(cv.toObject()));
+
+    const QJsonArray globalLinksArr = j.value("global_links").toArray();
+    QList<GlobalLink> globalLinks;
+    globalLinks.reserve(globalLinksArr.size());
+    for (const QJsonValue &gv : globalLinksArr)
+        globalLinks.append(globalLinkFromJson(gv.toObject()));
+    doc->replaceRelationships(std::move(linkages), std::move(connections),
+                              std::move(globalLinks));
 
     const QJsonArray comparisonSnapshots =
         j.value("comparison_snapshots").toArray();
@@ -898,9 +1085,9 @@ ScenarioSerializer::fromJson(const QJsonObject &j)
     qCDebug(lcScenario) << "ScenarioSerializer::fromJson: complete -"
                         << doc->regions.size() << "regions,"
                         << doc->terminals.size() << "terminals,"
-                        << doc->linkages.size() << "linkages,"
-                        << doc->connections.size() << "connections,"
-                        << doc->globalLinks.size() << "global links";
+                        << doc->linkages().size() << "linkages,"
+                        << doc->connections().size() << "connections,"
+                        << doc->globalLinks().size() << "global links";
     return doc;
 }
 
@@ -908,12 +1095,6 @@ bool ScenarioSerializer::toYaml(const ScenarioDocument &doc,
                                 const QString &path, QString *error)
 {
     qCInfo(lcScenario) << "ScenarioSerializer::toYaml: writing to" << path;
-    QJsonObject root = toJson(doc);
-    YAML::Node  yaml = jsonValueToYamlNode(QJsonValue(root));
-
-    std::stringstream buf;
-    buf << yaml;
-
     QFile out(path);
     if (!out.open(QIODevice::WriteOnly | QIODevice::Text))
     {
@@ -922,8 +1103,66 @@ bool ScenarioSerializer::toYaml(const ScenarioDocument &doc,
         if (error) *error = out.errorString();
         return false;
     }
-    const std::string text = buf.str();
-    if (out.write(text.data(), static_cast<qint64>(text.size())) < 0)
+
+    // The emitter writes into a small staging buffer that is drained to
+    // the file every few hundred records, so the emitted text is never
+    // held in memory as a whole.
+    std::stringstream buf;
+    YAML::Emitter     yaml(buf);
+    bool              writeFailed = false;
+    auto drain = [&]() {
+        const std::string chunk = buf.str();
+        buf.str(std::string());
+        buf.clear();
+        if (!chunk.empty()
+            && out.write(chunk.data(), static_cast<qint64>(chunk.size())) < 0)
+            writeFailed = true;
+    };
+    constexpr int kDrainEvery = 256;
+    auto emitRecords = [&](const char *key, const auto &records,
+                           const auto &toJsonFn) {
+        yaml << YAML::Key << key << YAML::Value << YAML::BeginSeq;
+        int emitted = 0;
+        for (const auto &record : records)
+        {
+            emitJsonValue(yaml, toJsonFn(record));
+            if (++emitted % kDrainEvery == 0)
+                drain();
+        }
+        yaml << YAML::EndSeq;
+    };
+
+    yaml << YAML::BeginMap;
+    yaml << YAML::Key << "schema_version" << YAML::Value << kSchemaVersion;
+    emitKeyValue(yaml, "simulation", simulationSettingsToJson(doc.simulation));
+    emitKeyValue(yaml, "output", outputSpecToJson(doc.output));
+    emitKeyValue(yaml, "fleet", fleetSpecToJson(doc.fleet));
+    emitRecords("regions", doc.regions, regionSpecToJson);
+    emitRecords("terminals", doc.terminals, terminalPlacementToJson);
+    emitRecords("linkages", doc.linkages(), nodeLinkageToJson);
+    emitRecords("connections", doc.connections(), connectionToJson);
+    emitRecords("global_links", doc.globalLinks(), globalLinkToJson);
+    emitKeyValue(yaml, "global_link_strategy",
+                 linkageStrategyToString(doc.globalLinkStrategy));
+    emitKeyValue(yaml, "global_link_auto_rules",
+                 stringListToArray(doc.globalLinkAutoRules));
+    emitKeyValue(yaml, "global_link_auto_rule_params",
+                 QJsonObject::fromVariantMap(doc.globalLinkAutoRuleParams));
+    emitRecords("comparison_snapshots", doc.comparisonSnapshots,
+                [](const QJsonObject &snapshot) { return snapshot; });
+    yaml << YAML::EndMap;
+
+    if (!yaml.good())
+    {
+        const QString reason = QString::fromStdString(yaml.GetLastError());
+        qCWarning(lcScenario) << "ScenarioSerializer::toYaml: emitter error -"
+                              << reason;
+        if (error) *error = reason;
+        return false;
+    }
+    yaml << YAML::Newline;
+    drain();
+    if (writeFailed)
     {
         qCWarning(lcScenario) << "ScenarioSerializer::toYaml: write failed -"
                               << out.errorString();
@@ -938,23 +1177,27 @@ std::unique_ptr<ScenarioDocument>
 ScenarioSerializer::fromYaml(const QString &path, QString *error)
 {
     qCInfo(lcScenario) << "ScenarioSerializer::fromYaml: loading" << path;
-    QFile in(path);
-    if (!in.open(QIODevice::ReadOnly | QIODevice::Text))
+    // yaml-cpp reads the file through its own buffered stream, so no
+    // copy of the whole file is held in memory.
+    std::ifstream stream(std::filesystem::path(path.toStdU16String()));
+    if (!stream)
     {
+        const QString reason = QFileInfo::exists(path)
+            ? QStringLiteral("Cannot open file for reading")
+            : QStringLiteral("No such file or directory");
         qCWarning(lcScenario) << "ScenarioSerializer::fromYaml: cannot open file"
-                              << path << "-" << in.errorString();
-        if (error) *error = in.errorString();
+                              << path << "-" << reason;
+        if (error) *error = reason;
         return nullptr;
     }
-    const QByteArray raw = in.readAll();
-    qCDebug(lcScenario) << "ScenarioSerializer::fromYaml: read"
-                        << raw.size() << "bytes";
+    qCDebug(lcScenario) << "ScenarioSerializer::fromYaml: reading"
+                        << QFileInfo(path).size() << "bytes";
 
-    YAML::Node yaml;
+    ScenarioYamlEventReader reader;
     try
     {
-        yaml = YAML::Load(std::string(raw.constData(),
-                                      static_cast<size_t>(raw.size())));
+        YAML::Parser parser(stream);
+        parser.HandleNextDocument(reader);
     }
     catch (const YAML::Exception &e)
     {
@@ -964,31 +1207,53 @@ ScenarioSerializer::fromYaml(const QString &path, QString *error)
         return nullptr;
     }
 
-    qCDebug(lcScenario) << "ScenarioSerializer::fromYaml: YAML parsed, converting to JSON";
-    QJsonValue  asValue = yamlNodeToJsonValue(yaml);
-    if (!asValue.isObject())
+    auto &records = reader.records();
+    if (!records.rootIsMap)
     {
         qCWarning(lcScenario) << "ScenarioSerializer::fromYaml: top-level YAML is not a mapping";
         if (error) *error = QStringLiteral("Top-level YAML must be a mapping.");
         return nullptr;
     }
-
-    std::unique_ptr<ScenarioDocument> doc = fromJson(asValue.toObject());
-    if (!doc)
+    qCDebug(lcScenario) << "ScenarioSerializer::fromYaml: events consumed -"
+                        << records.terminals.size() << "terminals,"
+                        << records.connections.size() << "connections streamed";
+
+    // Small sections (simulation, output, fleet, regions, global-link
+    // metadata) go through the JSON path; the streamed records are then
+    // attached in the same order fromJson() uses.
+    std::unique_ptr<ScenarioDocument> doc = fromJson(records.sections);
+    bool schemaOk = static_cast<bool>(doc);
+    if (schemaOk)
+    {
+        for (const TerminalPlacement &t : std::as_const(records.terminals))
+        {
+            if (!doc->addTerminal(t))
+            {
+                schemaOk = false;
+                break;
+            }
+        }
+    }
+    if (!schemaOk)
     {
-        qCWarning(lcScenario) << "ScenarioSerializer::fromYaml: fromJson returned null";
+        qCWarning(lcScenario) << "ScenarioSerializer::fromYaml: schema mapping failed";
         if (error) *error = QStringLiteral("Schema validation failed during fromJson.");
         return nullptr;
     }
+    records.terminals.clear();
+    doc->replaceRelationships(std::move(records.linkages),
+                              std::move(records.connections),
+                              std::move(records.globalLinks));
+    doc->comparisonSnapshots.append(records.comparisonSnapshots);
 
     const QString yamlDir = QFileInfo(path).absolutePath();
     resolvePathsRelativeTo(*doc, yamlDir);
     qCInfo(lcScenario) << "ScenarioSerializer::fromYaml: complete -"
                        << doc->regions.size() << "regions,"
                        << doc->terminals.size() << "terminals,"
-                       << doc->linkages.size() << "linkages,"
-                       << doc->connections.size() << "connections,"
-                       << doc->globalLinks.size() << "global links";
+                       << doc->linkages().size() << "linkages,"
+                       << doc->connections().size() << "connections,"
+                       << doc->globalLinks().size() << "global links";
     return doc;
 }
 
@@ -30,6 +30,10 @@ public:
     static std::unique_ptr<ScenarioDocument>  fromJson(const QJsonObject &j);
 
     // YAML.
+    // Read and written straight from the yaml-cpp event stream, not via a
+    // toJson()/fromJson() round-trip: record lists (terminals, linkages,
+    // connections, global links, snapshots) are converted one item at a
+    // time, so large scenarios never hold a full YAML or JSON tree.
     // Paths inside YAML are resolved relative to the file's directory after
     // QDir::fromNativeSeparators().
     static bool                               toYaml(const ScenarioDocument &doc,
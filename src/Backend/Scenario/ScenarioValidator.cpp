@@ -7,10 +7,17 @@
 #include "TerminalTypeDefaults.h"
 
 #include <QMap>
+#include <QMutex>
+#include <QSemaphore>
 #include <QSet>
+#include <QThread>
+#include <QThreadPool>
 #include <QVariant>
 
+#include <atomic>
 #include <cmath>
+#include <functional>
+#include <iterator>
 
 namespace CargoNetSim
 {
@@ -102,30 +109,252 @@ void checkCanonicalRouteMetrics(const QVariantMap &properties,
     }
 }
 
+/// Incremental error counter over a growing issue list, so the budget
+/// check inside per-item loops stays O(1) amortized.
+class ErrorBudget
+{
+public:
+    ErrorBudget(const QList<ValidationIssue> &out, int budget)
+        : m_out(out)
+        , m_budget(budget)
+    {
+    }
+
+    bool reached()
+    {
+        if (m_budget <= 0)
+            return false;
+        for (; m_scanned < m_out.size(); ++m_scanned)
+            if (m_out.at(m_scanned).severity == ValidationIssue::Error)
+                ++m_errors;
+        return m_errors >= m_budget;
+    }
+
+private:
+    const QList<ValidationIssue> &m_out;
+    int                           m_budget  = 0;
+    int                           m_scanned = 0;
+    int                           m_errors  = 0;
+};
+
+int countErrors(const QList<ValidationIssue> &issues)
+{
+    int n = 0;
+    for (const auto &i : issues)
+        if (i.severity == ValidationIssue::Error)
+            ++n;
+    return n;
+}
+
+/// Duplicate (from, to, mode) detection is order-dependent (the second
+/// occurrence is the one reported), so it is resolved up front on one
+/// thread and handed to the connection shards as a flag per index.
+QVector<bool> duplicateConnectionFlags(const QList<Connection> &connections)
+{
+    QVector<bool> duplicate(connections.size(), false);
+    QSet<QString> seen;
+    seen.reserve(connections.size());
+    for (int i = 0; i < connections.size(); ++i)
+    {
+        const Connection &c = connections.at(i);
+        const QString key =
+            c.fromTerminalId + QLatin1Char('|')
+            + c.toTerminalId + QLatin1Char('|')
+            + QString::number(static_cast<int>(c.mode));
+        if (seen.contains(key))
+            duplicate[i] = true;
+        else
+            seen.insert(key);
+    }
+    return duplicate;
+}
+
 } // namespace
 
 QList<ValidationIssue> ScenarioValidator::validate(const ScenarioDocument &doc)
+{
+    return validate(doc, ValidationOptions());
+}
+
+QList<ValidationIssue> ScenarioValidator::validate(
+    const ScenarioDocument  &doc,
+    const ValidationOptions &options,
+    bool                    *budgetExhausted)
 {
     qCInfo(lcScenario) << "ScenarioValidator::validate: starting validation";
+    const int budget = qMax(0, options.errorBudget);
+    // Passes look for one error past the budget, so "exhausted" means an
+    // error was actually dropped rather than that the budget was met.
+    const int passBudget = budget > 0 ? budget + 1 : 0;
+    using Pass = std::function<void(QList<ValidationIssue> &)>;
+
+    // Slot order is the historical sequential order; merging slots in
+    // this order reproduces the single-threaded output exactly.
+    QList<Pass> passes;
+    passes.append([&](QList<ValidationIssue> &out) {
+        checkRegions(doc, out);
+    });
+    {
+        auto it = doc.terminals.constBegin();
+        for (int begin = 0; begin < doc.terminals.size();
+             begin += kShardSize)
+        {
+            const int count = qMin(
+                kShardSize, static_cast<int>(doc.terminals.size()) - begin);
+            const TerminalIterator first = it;
+            passes.append([&doc, first, count, passBudget](
+                              QList<ValidationIssue> &out) {
+                checkTerminals(doc, out, first, count, passBudget);
+            });
+            std::advance(it, count);
+        }
+    }
+    passes.append([&](QList<ValidationIssue> &out) {
+        checkLinkages(doc, out);
+    });
+    const QVector<bool> duplicateConnections =
+        duplicateConnectionFlags(doc.connections());
+    for (int begin = 0; begin < doc.connections().size(); begin += kShardSize)
+    {
+        const int end = qMin(begin + kShardSize,
+                             static_cast<int>(doc.connections().size()));
+        passes.append([&doc, &duplicateConnections, begin, end, passBudget](
+                          QList<ValidationIssue> &out) {
+            checkConnections(doc, out, duplicateConnections, begin, end,
+                             passBudget);
+        });
+    }
+    passes.append([&](QList<ValidationIssue> &out) {
+        checkGlobalLinks(doc, out);
+    });
+    passes.append([&](QList<ValidationIssue> &out) {
+        checkSimulation(doc, out);
+    });
+    passes.append([&](QList<ValidationIssue> &out) {
+        checkDwellTime(doc, out);
+    });
+    passes.append([&](QList<ValidationIssue> &out) {
+        checkOriginContainers(doc, out);
+    });
+
+    struct Slot
+    {
+        QList<ValidationIssue> issues;
+        int                    errors = 0;
+        bool                   done   = false;
+    };
+    QVector<Slot>    results(passes.size());
+    QMutex           slotMutex;
+    // Highest slot whose issues can still reach the merged output. Once
+    // the completed prefix 0..k holds more than `budget` errors, every
+    // slot after k is skipped.
+    std::atomic<int> lastNeededSlot(static_cast<int>(passes.size()) - 1);
+
+    auto runSlot = [&](int index) {
+        if (index > lastNeededSlot.load(std::memory_order_relaxed))
+            return;
+        QList<ValidationIssue> issues;
+        passes.at(index)(issues);
+        const int errors = countErrors(issues);
+
+        QMutexLocker lock(&slotMutex);
+        results[index].issues = std::move(issues);
+        results[index].errors = errors;
+        results[index].done   = true;
+        if (budget <= 0)
+            return;
+        int prefixErrors = 0;
+        for (int k = 0; k < results.size() && results.at(k).done; ++k)
+        {
+            prefixErrors += results.at(k).errors;
+            if (prefixErrors > budget)
+            {
+                if (k < lastNeededSlot.load())
+                    lastNeededSlot.store(k);
+                break;
+            }
+        }
+    };
+
+    const int threads = options.maxThreads > 0
+                            ? options.maxThreads
+                            : QThread::idealThreadCount();
+    if (threads <= 1 || passes.size() <= 1)
+    {
+        for (int i = 0; i < passes.size(); ++i)
+            runSlot(i);
+    }
+    else
+    {
+        // Up to `threads` workers pull slots in order; this thread is one
+        // of them. Helpers only join when the shared pool has an idle
+        // thread right now, and only helpers that actually started are
+        // waited for, so a saturated pool (or a caller that is itself a
+        // pool task) degrades to an inline run instead of deadlocking.
+        std::atomic<int> nextSlot(0);
+        auto drain = [&runSlot, &nextSlot, count = int(passes.size())]() {
+            for (int i = nextSlot++; i < count; i = nextSlot++)
+                runSlot(i);
+        };
+        const int  wanted  = qMin(threads, int(passes.size())) - 1;
+        int        started = 0;
+        QSemaphore helpersDone;
+        for (int i = 0; i < wanted; ++i)
+        {
+            if (!QThreadPool::globalInstance()->tryStart(
+                    [&drain, &helpersDone]() {
+                        drain();
+                        helpersDone.release();
+                    }))
+                break;
+            ++started;
+        }
+        qCDebug(lcScenario) << "ScenarioValidator::validate:" << started
+                            << "of" << wanted << "helper threads started";
+        drain();
+        helpersDone.acquire(started);
+    }
+
     QList<ValidationIssue> out;
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkRegions";
-    checkRegions(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkTerminals";
-    checkTerminals(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkLinkages";
-    checkLinkages(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkConnections";
-    checkConnections(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkGlobalLinks";
-    checkGlobalLinks(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkSimulation";
-    checkSimulation(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkDwellTime";
-    checkDwellTime(doc, out);
-    qCDebug(lcScenario) << "ScenarioValidator::validate: checkOriginContainers";
-    checkOriginContainers(doc, out);
+    int  errors    = 0;
+    bool exhausted = false;
+    const int last = lastNeededSlot.load();
+    for (int i = 0; i <= last && !exhausted; ++i)
+    {
+        for (const ValidationIssue &issue : std::as_const(results[i].issues))
+        {
+            const bool isError = issue.severity == ValidationIssue::Error;
+            if (isError && budget > 0 && errors >= budget)
+            {
+                exhausted = true;
+                break;
+            }
+            out.append(issue);
+            if (isError)
+                ++errors;
+        }
+    }
+    if (exhausted)
+    {
+        // Later passes may have been skipped, so neither their errors nor
+        // their warnings are known; say so in the report itself.
+        ValidationIssue truncated;
+        truncated.severity = ValidationIssue::Warning;
+        truncated.path     = QStringLiteral("validation");
+        truncated.message  =
+            QStringLiteral("Stopped after %1 errors (error budget); further "
+                           "errors and warnings were not reported.")
+                .arg(budget);
+        out.append(truncated);
+    }
+    if (budgetExhausted)
+        *budgetExhausted = exhausted;
+
     qCInfo(lcScenario) << "ScenarioValidator::validate: complete,"
-                       << out.size() << "issues found";
+                       << out.size() << "issues found across"
+                       << passes.size() << "passes/shards on"
+                       << qMax(1, threads) << "threads"
+                       << (exhausted ? "(error budget reached)" : "");
     return out;
 }
 
@@ -221,11 +450,16 @@ void ScenarioValidator::checkRegions(const ScenarioDocument &doc,
 }
 
 void ScenarioValidator::checkTerminals(const ScenarioDocument &doc,
-                                       QList<ValidationIssue> &out)
+                                       QList<ValidationIssue> &out,
+                                       TerminalIterator first, int count,
+                                       int errorBudget)
 {
     qCDebug(lcScenario) << "ScenarioValidator::checkTerminals:"
-                        << doc.terminals.size() << "terminals";
-    for (auto it = doc.terminals.constBegin(); it != doc.terminals.constEnd(); ++it)
+                        << count << "of" << doc.terminals.size()
+                        << "terminals";
+    ErrorBudget budget(out, errorBudget);
+    auto it = first;
+    for (int n = 0; n < count && !budget.reached(); ++n, ++it)
     {
         const TerminalPlacement &t = it.value();
 
@@ -281,13 +515,13 @@ void ScenarioValidator::checkLinkages(const ScenarioDocument &doc,
                                       QList<ValidationIssue> &out)
 {
     qCDebug(lcScenario) << "ScenarioValidator::checkLinkages:"
-                        << doc.linkages.size() << "linkages";
+                        << doc.linkages().size() << "linkages";
     QSet<QString> seen;
     QMap<QString, QString> activeNodeOwners;
 
-    for (int i = 0; i < doc.linkages.size(); ++i)
+    for (int i = 0; i < doc.linkages().size(); ++i)
     {
-        const NodeLinkage &l = doc.linkages.at(i);
+        const NodeLinkage &l = doc.linkages().at(i);
         const QString path = QStringLiteral("linkages[%1]").arg(i);
         const QString key =
             l.terminalId + QLatin1Char('|')
@@ -342,25 +576,23 @@ void ScenarioValidator::checkLinkages(const ScenarioDocument &doc,
 }
 
 void ScenarioValidator::checkConnections(const ScenarioDocument &doc,
-                                         QList<ValidationIssue> &out)
+                                         QList<ValidationIssue> &out,
+                                         const QVector<bool> &duplicate,
+                                         int begin, int end,
+                                         int errorBudget)
 {
     qCDebug(lcScenario) << "ScenarioValidator::checkConnections:"
-                        << doc.connections.size() << "connections";
-    QSet<QString> seen;
-    for (int i = 0; i < doc.connections.size(); ++i)
+                        << "connections" << begin << ".." << end
+                        << "of" << doc.connections().size();
+    ErrorBudget budget(out, errorBudget);
+    for (int i = begin; i < end && !budget.reached(); ++i)
     {
-        const Connection &c = doc.connections.at(i);
+        const Connection &c = doc.connections().at(i);
         const QString path = QStringLiteral("connections[%1]").arg(i);
-        const QString key =
-            c.fromTerminalId + QLatin1Char('|')
-            + c.toTerminalId + QLatin1Char('|')
-            + QString::number(static_cast<int>(c.mode));
 
-        if (seen.contains(key))
+        if (duplicate.at(i))
             err(out, path,
                 QStringLiteral("Duplicate connection for the same (from, to, mode) route identity"));
-        else
-            seen.insert(key);
 
         if (!doc.terminals.contains(c.fromTerminalId))
             err(out, path + ".from",
@@ -418,12 +650,12 @@ void ScenarioValidator::checkGlobalLinks(const ScenarioDocument &doc,
                                          QList<ValidationIssue> &out)
 {
     qCDebug(lcScenario) << "ScenarioValidator::checkGlobalLinks:"
-                        << doc.globalLinks.size() << "global links";
+                        << doc.globalLinks().size() << "global links";
     QSet<QString> seen;
 
-    for (int i = 0; i < doc.globalLinks.size(); ++i)
+    for (int i = 0; i < doc.globalLinks().size(); ++i)
     {
-        const GlobalLink &g = doc.globalLinks.at(i);
+        const GlobalLink &g = doc.globalLinks().at(i);
         const QString path = QStringLiteral("global_links[%1]").arg(i);
         const QString key =
             g.fromTerminalId + QLatin1Char('|')
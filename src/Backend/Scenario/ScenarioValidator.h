@@ -3,6 +3,8 @@
 #include "ScenarioDocument.h"
 #include "ValidationIssue.h"
 #include <QList>
+#include <QMap>
+#include <QVector>
 
 namespace CargoNetSim
 {
@@ -11,17 +13,55 @@ namespace Backend
 namespace Scenario
 {
 
+/// Tuning knobs for ScenarioValidator::validate.
+struct ValidationOptions
+{
+    /// Stop once this many Error issues have been found. The result then
+    /// holds exactly the first N errors and every warning before the
+    /// first error left out, in the same order a full run would report
+    /// them, followed by a Warning at path "validation" noting the
+    /// truncation. 0 = no limit.
+    int errorBudget = 0;
+
+    /// Worker threads used for the independent passes and shards.
+    /// 0 = QThread::idealThreadCount(); 1 = run everything inline.
+    int maxThreads = 0;
+};
+
 /// Stateless validator. Returns a list of issues; callers filter by severity.
+///
+/// Independent passes run concurrently on the global thread pool, and the
+/// per-terminal and per-connection checks are further split into fixed-size
+/// shards. Every pass/shard writes into its own slot and slots are merged in
+/// the historical sequential order, so the output is identical regardless
+/// of thread count or scheduling.
 class ScenarioValidator
 {
 public:
     static QList<ValidationIssue> validate(const ScenarioDocument &doc);
 
+    /// @p budgetExhausted (optional) is set to true when at least one error
+    /// beyond the budget was found and left out of the result; the result
+    /// then ends with the truncation warning.
+    static QList<ValidationIssue> validate(const ScenarioDocument  &doc,
+                                           const ValidationOptions &options,
+                                           bool *budgetExhausted = nullptr);
+
+    /// Items per terminal / connection shard.
+    static constexpr int kShardSize = 512;
+
 private:
+    using TerminalIterator =
+        QMap<QString, TerminalPlacement>::const_iterator;
+
     static void checkRegions         (const ScenarioDocument &doc, QList<ValidationIssue> &out);
-    static void checkTerminals       (const ScenarioDocument &doc, QList<ValidationIssue> &out);
+    static void checkTerminals       (const ScenarioDocument &doc, QList<ValidationIssue> &out,
+                                      TerminalIterator first, int count,
+                                      int errorBudget);
     static void checkLinkages        (const ScenarioDocument &doc, QList<ValidationIssue> &out);
-    static void checkConnections     (const ScenarioDocument &doc, QList<ValidationIssue> &out);
+    static void checkConnections     (const ScenarioDocument &doc, QList<ValidationIssue> &out,
+                                      const QVector<bool> &duplicate,
+                                      int begin, int end, int errorBudget);
     static void checkGlobalLinks     (const ScenarioDocument &doc, QList<ValidationIssue> &out);
     static void checkSimulation      (const ScenarioDocument &doc, QList<ValidationIssue> &out);
     static void checkDwellTime       (const ScenarioDocument &doc, QList<ValidationIssue> &out);
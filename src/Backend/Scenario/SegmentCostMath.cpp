@@ -115,6 +115,36 @@ double totalCost(const ComputedSegmentData &data)
     return data.actualCosts.total();
 }
 
+QVariantMap weightsForMode(const QVariantMap &costFunctionWeights,
+                           Mode               mode)
+{
+    const QString modeKey = QString::number(static_cast<int>(mode));
+    return costFunctionWeights.contains(modeKey)
+        ? costFunctionWeights.value(modeKey).toMap()
+        : costFunctionWeights.value(QStringLiteral("default")).toMap();
+}
+
+double defaultRiskFactor(Mode mode)
+{
+    switch (mode)
+    {
+    case Mode::Ship:
+        return 0.025;
+    case Mode::Train:
+        return 0.006;
+    default:
+        return 0.012;
+    }
+}
+
+double riskFactor(const QVariantMap &transportModes, Mode mode)
+{
+    return transportModes.value(transportationModeToString(mode))
+        .toMap()
+        .value(PK::Mode::RiskFactor, defaultRiskFactor(mode))
+        .toDouble();
+}
+
 ComputedSegmentData computeShipSegmentData(
     CargoNetSim::Backend::ShipClient::ShipSimulationClient *shipClient,
     CargoNetSim::Backend::Path                             *path,
@@ -554,6 +584,80 @@ computePathExecutionResult(
     return result;
 }
 
+CargoNetSim::Backend::Scenario::PathExecutionResult
+recostPathExecutionResult(
+    const CargoNetSim::Backend::Scenario::PathExecutionResult &result,
+    const QVariantMap &costFunctionWeights,
+    const QVariantMap &transportModes,
+    const QVariantMap &simulatedTransportModes)
+{
+    PathExecutionResult recosted = result;
+    recosted.edgeCosts = 0.0;
+    for (auto &segmentResult : recosted.segmentResults)
+    {
+        segmentResult.actualCosts = {};
+        if (!segmentResult.actualMetrics.available)
+            continue;
+
+        // Risk is vehicleCount * risk_factor of the simulated run.
+        const double simulatedRisk =
+            riskFactor(simulatedTransportModes, segmentResult.mode);
+        if (simulatedRisk > 0.0)
+        {
+            segmentResult.actualMetrics.risk *=
+                riskFactor(transportModes, segmentResult.mode)
+                / simulatedRisk;
+        }
+
+        VehicleSegmentMetrics metrics;
+        metrics.travelTime = segmentResult.actualMetrics.travelTime;
+        metrics.distance = segmentResult.actualMetrics.distance;
+        metrics.carbonEmissions =
+            segmentResult.actualMetrics.carbonEmissions;
+        metrics.energyConsumption =
+            segmentResult.actualMetrics.energyConsumption;
+        metrics.risk = segmentResult.actualMetrics.risk;
+        // Carbon and energy are already load-scaled, so keep the
+        // container-to-capacity ratio at one.
+        metrics.vehicleCount = 1;
+        const auto computed = computeVehicleSegmentData(
+            metrics,
+            weightsForMode(costFunctionWeights, segmentResult.mode),
+            /*containerCount=*/1, /*vehicleCapacity=*/1);
+        segmentResult.actualCosts = computed.actualCosts;
+        recosted.edgeCosts += totalCost(computed);
+    }
+
+    if (!recosted.terminalResults.isEmpty())
+    {
+        recosted.modeledActualTerminalCosts = 0.0;
+        for (auto &terminalResult : recosted.terminalResults)
+        {
+            const QVariantMap weights = weightsForMode(
+                costFunctionWeights, terminalResult.arrivalMode);
+            terminalResult.actualWeightedDelayContribution =
+                terminalResult.actualTotalHandlingSeconds
+                * weights.value(PK::Segment::TerminalDelay).toDouble();
+            terminalResult.actualWeightedCostContribution =
+                terminalResult.actualDirectCostUsd
+                * weights.value(PK::Segment::TerminalCost).toDouble();
+            terminalResult.actualWeightedTotalContribution =
+                terminalResult.actualWeightedDelayContribution
+                + terminalResult.actualWeightedCostContribution;
+            recosted.modeledActualTerminalCosts +=
+                terminalResult.actualWeightedTotalContribution;
+        }
+        recosted.terminalCosts = recosted.modeledActualTerminalCosts;
+    }
+    recosted.totalCost = recosted.edgeCosts + recosted.terminalCosts;
+
+    qCDebug(lcScenario) << "SegmentCostMath::recostPathExecutionResult:"
+                        << "path" << recosted.executionPathKey
+                        << "totalCost" << result.totalCost << "->"
+                        << recosted.totalCost;
+    return recosted;
+}
+
 } // namespace SegmentCostMath
 } // namespace Scenario
 } // namespace Backend
@@ -150,6 +150,24 @@ computePathExecutionResult(
     int                                                        containerCount,
     bool                                                       emitInfoLog = true);
 
+/**
+ * @brief Re-prices a simulated path with another set of weights.
+ *
+ * Recomputes segment and terminal costs from the actual metrics and
+ * terminal totals already recorded in @p result, using
+ * @p costFunctionWeights. The segment risk metric is vehicle count
+ * times the mode risk_factor of the run, so it is rescaled from
+ * @p simulatedTransportModes to @p transportModes. Without terminal
+ * execution records the predicted terminal costs are kept as-is.
+ * No simulation client is consulted.
+ */
+CargoNetSim::Backend::Scenario::PathExecutionResult
+recostPathExecutionResult(
+    const CargoNetSim::Backend::Scenario::PathExecutionResult &result,
+    const QVariantMap &costFunctionWeights,
+    const QVariantMap &transportModes,
+    const QVariantMap &simulatedTransportModes);
+
 } // namespace SegmentCostMath
 } // namespace Scenario
 } // namespace Backend
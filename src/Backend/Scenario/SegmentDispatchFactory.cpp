@@ -5,6 +5,7 @@
 #include "Backend/Scenario/ExecutionContainerIdentity.h"
 #include "Backend/Scenario/RuntimeArtifactIdentity.h"
 
+#include <QThread>
 #include <QVector>
 
 namespace CargoNetSim
@@ -73,7 +74,8 @@ VehicleContainerSelection takeContainersForVehicle(
     int                                  &containerCounter,
     const QString                        &currentLocation,
     const QString                        &destination,
-    const TerminalHandlingMetadata       &metadata)
+    const TerminalHandlingMetadata       &metadata,
+    QThread                              *containerThread)
 {
     VehicleContainerSelection selection;
     for (int j = 0; j < take && !source.isEmpty(); ++j)
@@ -81,6 +83,10 @@ VehicleContainerSelection takeContainersForVehicle(
         auto *orig = source.takeFirst();
         const QString logicalId = logicalContainerIdFor(orig);
         auto *copy = orig->copy();
+        // Only the creating thread may push an object elsewhere, so a
+        // copy made on a build worker is handed over right away.
+        if (containerThread && copy->thread() != containerThread)
+            copy->moveToThread(containerThread);
         copy->setContainerID(
             RuntimeArtifacts::copiedContainerId(
                 metadata.canonicalPathKey, segmentIndex,
@@ -121,9 +127,34 @@ SegmentDispatchFactory::SegmentDispatchFactory(
     VehicleController *vehicles, const QString &executionId)
     : m_vehicles(vehicles)
     , m_executionId(executionId)
+    , m_templates(vehicles)
 {
 }
 
+void SegmentDispatchFactory::advanceCursor(
+    TransportationTypes::TransportationMode mode, int containerCount,
+    int capacity, SegmentDispatchCursor &cursor)
+{
+    const int vehicles = numVehiclesNeeded(containerCount, capacity);
+    switch (mode)
+    {
+    case TransportationTypes::TransportationMode::Train:
+        cursor.trainCounter += vehicles;
+        break;
+    case TransportationTypes::TransportationMode::Truck:
+        cursor.truckCounter += vehicles;
+        break;
+    case TransportationTypes::TransportationMode::Ship:
+        cursor.shipCounter += vehicles;
+        break;
+    default:
+        return;
+    }
+    // Every vehicle but the last is full, so all containers go out.
+    if (vehicles > 0)
+        cursor.containerCounter += containerCount;
+}
+
 bool SegmentDispatchFactory::appendTrainSegment(
     const TrainSegmentDispatchRequest &request,
     SegmentDispatchCursor            &cursor,
@@ -188,24 +219,21 @@ bool SegmentDispatchFactory::appendTrainSegment(
                 cursor.trainCounter++,
                 QStringLiteral("train"));
 
-        auto *baseTrain = m_vehicles->getRandomTrain();
-        if (!baseTrain)
+        auto trainTemplate = m_templates.randomTrain();
+        if (!trainTemplate)
         {
             if (err)
                 *err = QStringLiteral(
                     "No train available for segment dispatch");
             return false;
         }
-        auto *train = baseTrain->copy();
-        train->setUserId(trainId);
-
-        QVector<int> trainPath;
-        trainPath << request.runtimeStartNodeId << request.runtimeEndNodeId;
-        train->setTrainPathOnNodeIds(trainPath);
-        train->setLoadTime(static_cast<float>(cursor.trainCounter * 100));
 
         TrainSimData td;
-        td.train = train;
+        td.trainTemplate = std::move(trainTemplate);
+        td.trainId = trainId;
+        td.pathNodeIds << request.runtimeStartNodeId
+                       << request.runtimeEndNodeId;
+        td.loadTime = static_cast<float>(cursor.trainCounter * 100);
         const TerminalHandlingMetadata metadata{
             m_executionId,
             request.executionPathKey,
@@ -221,7 +249,8 @@ bool SegmentDispatchFactory::appendTrainSegment(
             containersCopy, request.segmentIndex,
             cursor.containerCounter,
             QString::number(request.runtimeStartNodeId),
-            QString::number(request.runtimeEndNodeId), metadata);
+            QString::number(request.runtimeEndNodeId), metadata,
+            request.containerThread);
         td.containers = selection.dispatchContainers;
         qCInfo(lcScenario)
             << "SegmentDispatchFactory::appendTrainSegment:"
@@ -229,6 +258,7 @@ bool SegmentDispatchFactory::appendTrainSegment(
             << "pathKey=" << request.canonicalPathKey
             << "segment=" << request.segmentIndex
             << "trainId=" << trainId
+            << "template=" << td.trainTemplate->templateId
             << "network=" << request.networkName
             << "scenarioStart=" << request.startTerminalId
             << "scenarioEnd=" << request.endTerminalId
@@ -327,7 +357,7 @@ bool SegmentDispatchFactory::appendTruckSegment(
             cursor.containerCounter,
             request.runtimeStartLocationName,
             request.runtimeEndLocationName,
-            metadata);
+            metadata, request.containerThread);
         td.containers = selection.dispatchContainers;
         qCInfo(lcScenario)
             << "SegmentDispatchFactory::appendTruckSegment:"
@@ -416,23 +446,20 @@ bool SegmentDispatchFactory::appendShipSegment(
                 cursor.shipCounter++,
                 QStringLiteral("ship"));
 
-        auto *baseShip = m_vehicles->getRandomShip();
-        if (!baseShip)
+        auto shipTemplate = m_templates.randomShip();
+        if (!shipTemplate)
         {
             if (err)
                 *err = QStringLiteral(
                     "No ship available for segment dispatch");
             return false;
         }
-        auto *ship = baseShip->copy();
-        ship->setUserId(shipId);
-
-        QVector<QPointF> shipPath;
-        shipPath << request.startGlobalPosition << request.endGlobalPosition;
-        ship->setPathCoordinates(shipPath);
 
         ShipSimData sd;
-        sd.ship = ship;
+        sd.shipTemplate = std::move(shipTemplate);
+        sd.shipId = shipId;
+        sd.pathCoordinates << request.startGlobalPosition
+                           << request.endGlobalPosition;
         sd.destinationTerminal = request.endTerminalId;
         const TerminalHandlingMetadata metadata{
             m_executionId,
@@ -448,7 +475,8 @@ bool SegmentDispatchFactory::appendShipSegment(
             qMin(request.shipContainerCapacity, containersCopy.size()),
             containersCopy, request.segmentIndex,
             cursor.containerCounter,
-            request.startTerminalId, request.endTerminalId, metadata);
+            request.startTerminalId, request.endTerminalId, metadata,
+            request.containerThread);
         sd.containers = selection.dispatchContainers;
         qCInfo(lcScenario)
             << "SegmentDispatchFactory::appendShipSegment:"
@@ -456,6 +484,7 @@ bool SegmentDispatchFactory::appendShipSegment(
             << "pathKey=" << request.canonicalPathKey
             << "segment=" << request.segmentIndex
             << "shipId=" << shipId
+            << "template=" << sd.shipTemplate->templateId
             << "network=" << request.networkName
             << "scenarioStart=" << request.startTerminalId
             << "scenarioEnd=" << request.endTerminalId
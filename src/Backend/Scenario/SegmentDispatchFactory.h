@@ -7,7 +7,11 @@
 
 #include "Backend/Clients/TrainClient/TrainNetwork.h"
 #include "Backend/Clients/TruckClient/TruckNetwork.h"
+#include "Backend/Commons/TransportationMode.h"
 #include "SimulationDispatchTypes.h"
+#include "VehicleTemplateCache.h"
+
+class QThread;
 
 namespace CargoNetSim
 {
@@ -39,6 +43,9 @@ struct TrainSegmentDispatchRequest
     int     runtimeEndNodeId = -1;
     int     trainContainerCapacity = -1;
     QList<ContainerCore::Container *> containersAvailable;
+    /// Thread the dispatch container copies are moved to; null keeps
+    /// them on the calling thread.
+    QThread *containerThread = nullptr;
     CargoNetSim::Backend::TrainClient::NeTrainSimNetwork *network =
         nullptr;
 };
@@ -58,6 +65,9 @@ struct TruckSegmentDispatchRequest
     QString runtimeEndLocationName;
     int     truckContainerCapacity = -1;
     QList<ContainerCore::Container *> containersAvailable;
+    /// Thread the dispatch container copies are moved to; null keeps
+    /// them on the calling thread.
+    QThread *containerThread = nullptr;
     CargoNetSim::Backend::TruckClient::IntegrationNetwork *network =
         nullptr;
 };
@@ -75,6 +85,9 @@ struct ShipSegmentDispatchRequest
     QPointF endGlobalPosition;
     int     shipContainerCapacity = -1;
     QList<ContainerCore::Container *> containersAvailable;
+    /// Thread the dispatch container copies are moved to; null keeps
+    /// them on the calling thread.
+    QThread *containerThread = nullptr;
 };
 
 class SegmentDispatchFactory
@@ -101,9 +114,19 @@ public:
                            QVector<VehicleLoadManifest>   *vehicleLoads,
                            QString                        *err) const;
 
+    /// Moves @p cursor past every id the append call for a
+    /// @p mode segment of @p containerCount containers would take,
+    /// so segments can be built out of order with the ids they get
+    /// when built one after another.
+    static void advanceCursor(
+        TransportationTypes::TransportationMode mode,
+        int containerCount, int capacity,
+        SegmentDispatchCursor &cursor);
+
 private:
-    VehicleController *m_vehicles = nullptr;
-    QString            m_executionId;
+    VehicleController   *m_vehicles = nullptr;
+    QString              m_executionId;
+    VehicleTemplateCache m_templates;
 };
 
 } // namespace Scenario
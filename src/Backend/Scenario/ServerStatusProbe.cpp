@@ -19,8 +19,10 @@ namespace Backend
 namespace Scenario
 {
 
-ServerStatusProbe::ServerStatusProbe(QObject *parent)
+ServerStatusProbe::ServerStatusProbe(
+    CargoNetSim::CargoNetSimController *controller, QObject *parent)
     : QObject(parent)
+    , m_controller(controller)
 {
 }
 
@@ -54,7 +56,8 @@ QList<ServerStatusProbe::ServerStatus> ServerStatusProbe::pollAll()
     // correct semantics in that window, matching the test contract
     // in test_poll_without_controller_returns_disconnected_entries.
     auto *controllerPtr =
-        CargoNetSim::CargoNetSimController::instance();
+        m_controller ? m_controller
+                     : CargoNetSim::CargoNetSimController::instance();
     if (controllerPtr == nullptr)
     {
         qCDebug(lcScenario) << "ServerStatusProbe::pollAll: no controller"
@@ -6,6 +6,8 @@
 
 namespace CargoNetSim
 {
+class CargoNetSimController;
+
 namespace Backend
 {
 namespace Scenario
@@ -34,17 +36,24 @@ public:
         bool    commandAvailable = false;
     };
 
-    explicit ServerStatusProbe(QObject *parent = nullptr);
+    /// Probes the clients of @p controller; null probes the default
+    /// instance.
+    explicit ServerStatusProbe(
+        CargoNetSim::CargoNetSimController *controller = nullptr,
+        QObject                            *parent     = nullptr);
 
     /**
      * @brief Polls all four clients once and returns their status.
      *
-     * Reads CargoNetSimController::getInstance() on the calling thread.
+     * Reads the probed controller on the calling thread.
      * Exceptions are swallowed per-client (mirrors the existing try/catch
      * block in HeartbeatController.cpp:146-238) so a single bad client
      * does not mask the others.
      */
     QList<ServerStatus> pollAll();
+
+private:
+    CargoNetSim::CargoNetSimController *m_controller = nullptr;
 };
 
 } // namespace Scenario
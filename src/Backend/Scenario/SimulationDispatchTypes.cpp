@@ -1,5 +1,8 @@
 #include "SimulationDispatchTypes.h"
 
+#include <QJsonArray>
+#include <QStringList>
+
 namespace CargoNetSim
 {
 namespace Backend
@@ -7,6 +10,41 @@ namespace Backend
 namespace Scenario
 {
 
+QJsonObject ShipSimData::toJson() const
+{
+    // Copy-on-write: only the patched keys are detached from the
+    // template, the rest of the definition stays shared.
+    QJsonObject json =
+        shipTemplate ? shipTemplate->definition : QJsonObject();
+    QStringList points;
+    points.reserve(pathCoordinates.size());
+    for (const QPointF &point : pathCoordinates)
+    {
+        // Ship keeps its path as floats
+        points.append(QString("%1,%2")
+                          .arg(static_cast<float>(point.x()))
+                          .arg(static_cast<float>(point.y())));
+    }
+    json["ID"]   = shipId;
+    json["Path"] = points.join(';');
+    return json;
+}
+
+QJsonObject TrainSimData::toJson() const
+{
+    QJsonObject json =
+        trainTemplate ? trainTemplate->definition : QJsonObject();
+    QJsonArray pathArray;
+    for (int nodeId : pathNodeIds)
+    {
+        pathArray.append(nodeId);
+    }
+    json["UserID"]             = trainId;
+    json["LoadTime"]           = loadTime;
+    json["TrainPathOnNodeIDs"] = pathArray;
+    return json;
+}
+
 void SimulationRequestBundle::merge(const SimulationRequestBundle &other)
 {
     for (auto it = other.shipData.constBegin();
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <QJsonObject>
 #include <QList>
 #include <QMap>
+#include <QPointF>
 #include <QString>
+#include <QVector>
+#include <memory>
 
 #include "Backend/Clients/TrainClient/TrainNetwork.h"
 #include "Backend/Clients/TruckClient/TruckNetwork.h"
@@ -18,17 +22,38 @@ namespace Backend
 namespace Scenario
 {
 
+/// Serialized definition of a catalog vehicle, shared read-only by
+/// every dispatch of that vehicle (see VehicleTemplateCache).
+struct VehicleTemplate
+{
+    QString     templateId; ///< User id of the catalog vehicle
+    QJsonObject definition; ///< Its toJson(), built once
+};
+
+/// One dispatched ship: the shared template plus what differs per trip.
 struct ShipSimData
 {
-    CargoNetSim::Backend::Ship       *ship = nullptr;
+    std::shared_ptr<const VehicleTemplate> shipTemplate;
+    QString                           shipId;
+    QVector<QPointF>                  pathCoordinates; ///< (lon, lat)
     QList<ContainerCore::Container *> containers;
     QString                           destinationTerminal;
+
+    /// Ship::toJson() layout with this trip's id and path.
+    QJsonObject toJson() const;
 };
 
+/// One dispatched train: the shared template plus what differs per trip.
 struct TrainSimData
 {
-    CargoNetSim::Backend::Train      *train = nullptr;
+    std::shared_ptr<const VehicleTemplate> trainTemplate;
+    QString                           trainId;
+    QVector<int>                      pathNodeIds;
+    float                             loadTime = 0.0f;
     QList<ContainerCore::Container *> containers;
+
+    /// Train::toJson() layout with this trip's id, path and load time.
+    QJsonObject toJson() const;
 };
 
 struct TruckSimData
@@ -27,6 +27,9 @@ struct SimulationSettings
     std::optional<double> timeValueOfMoney;     ///< USD/hour
     std::optional<bool>   useSpecificTimeValues;
     std::optional<double> carbonRate;
+    /// Send each truck dispatch wave as one TRIP_CTRL/ADD_TRIPS message.
+    /// Only for INTEGRATION bridges that accept it; off by default.
+    std::optional<bool>   truckBatchTrips;
 
     std::optional<double> shipMultiplier;
     std::optional<double> railMultiplier;
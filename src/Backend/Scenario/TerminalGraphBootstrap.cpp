@@ -1,6 +1,7 @@
 #include "TerminalGraphBootstrap.h"
 
 #include "Backend/Clients/TerminalClient/TerminalSimulationClient.h"
+#include "Backend/Commons/ChunkedUpload.h"
 #include "Backend/Commons/LogCategories.h"
 #include "Backend/Commons/TransportationMode.h"
 #include "Backend/Controllers/CargoNetSimController.h"
@@ -15,7 +16,8 @@
 #include "ScenarioRegistry.h"
 #include "SimulatorCommandAvailability.h"
 
-#include <QtAlgorithms>
+#include <QCryptographicHash>
+#include <QJsonDocument>
 #include <QStringList>
 
 namespace CargoNetSim
@@ -50,6 +52,51 @@ void setError(QString *error, const QString &message)
         *error = message;
 }
 
+/// A route to submit; the PathSegment is built only when its chunk
+/// is encoded.
+struct RouteSpec
+{
+    QString            fromTerminalId;
+    QString            toTerminalId;
+    Mode               mode;
+    const QVariantMap *properties = nullptr;
+};
+
+/// SHA-256 over the submitted payloads, in submission order. Fed by
+/// the chunk encoders, which run one at a time and in order.
+class GraphFingerprint
+{
+public:
+    explicit GraphFingerprint(bool enabled)
+        : m_enabled(enabled)
+    {
+    }
+
+    void add(const QJsonObject &json)
+    {
+        if (!m_enabled)
+            return;
+        m_hash.addData(QJsonDocument(json).toJson(QJsonDocument::Compact));
+        m_hash.addData(QByteArrayView("\0", 1));
+    }
+
+    QByteArray result() const { return m_hash.result(); }
+
+private:
+    bool               m_enabled;
+    QCryptographicHash m_hash{QCryptographicHash::Sha256};
+};
+
+Commons::ChunkedUpload loggedUpload(const QString &op, const char *what)
+{
+    Commons::ChunkedUpload upload;
+    upload.progress = [op, what](int sent, int total) {
+        qCInfo(lcScenario) << op << "submitted" << sent << "/" << total
+                           << what;
+    };
+    return upload;
+}
+
 } // namespace
 
 bool TerminalGraphBootstrap::resetAndLoad(
@@ -57,7 +104,8 @@ bool TerminalGraphBootstrap::resetAndLoad(
     const ScenarioRegistry &registry,
     CargoNetSim::CargoNetSimController &controller,
     QString                *error,
-    const QString          &context)
+    const QString          &context,
+    QByteArray             *graphFingerprintOut)
 {
     const QString op = operationContext(context);
     auto *terminalClient = controller.getTerminalClient();
@@ -98,8 +146,8 @@ bool TerminalGraphBootstrap::resetAndLoad(
         return false;
     }
 
-    if (!terminalClient->setCostFunctionParameters(
-            config->getCostFunctionWeights()))
+    const QVariantMap weights = config->getCostFunctionWeights();
+    if (!terminalClient->setCostFunctionParameters(weights))
     {
         const QString message =
             QStringLiteral("Failed to configure TerminalSim cost weights");
@@ -108,28 +156,20 @@ bool TerminalGraphBootstrap::resetAndLoad(
         return false;
     }
 
-    QList<Terminal *> terminals;
+    QList<const Terminal *> terminals;
     terminals.reserve(document.terminals.size());
     for (auto it = document.terminals.constBegin();
          it != document.terminals.constEnd(); ++it)
     {
-        if (Terminal *terminal = registry.terminal(it.key()))
+        if (const Terminal *terminal = registry.terminal(it.key()))
             terminals.append(terminal);
     }
 
-    if (!terminalClient->addTerminals(terminals))
-    {
-        const QString message =
-            QStringLiteral("Failed to add terminals to TerminalSim");
-        qCWarning(lcScenario) << op << message;
-        setError(error, message);
-        return false;
-    }
-
-    QList<PathSegment *> routes;
-    routes.reserve(document.connections.size()
-                   + document.globalLinks.size());
-    for (const auto &connection : document.connections)
+    // Resolve and check every route before streaming anything
+    QList<RouteSpec> routes;
+    routes.reserve(document.connections().size()
+                   + document.globalLinks().size());
+    for (const auto &connection : document.connections())
     {
         const QStringList missingKeys =
             RouteMetricUnits::missingCanonicalRouteMetricKeys(
@@ -144,17 +184,12 @@ bool TerminalGraphBootstrap::resetAndLoad(
                 << "is missing canonical route metrics"
                 << missingKeys;
         }
-        routes.append(new PathSegment(
-            makeSegmentId(connection.fromTerminalId,
-                          connection.toTerminalId,
-                          connection.mode),
-            connection.fromTerminalId,
-            connection.toTerminalId,
-            connection.mode,
-            RouteMetricUnits::routeAttributesFromCanonical(
-                connection.properties)));
+        routes.append({connection.fromTerminalId,
+                       connection.toTerminalId,
+                       connection.mode,
+                       &connection.properties});
     }
-    for (const auto &globalLink : document.globalLinks)
+    for (const auto &globalLink : document.globalLinks())
     {
         const auto fromEndpoint =
             resolveTerminalEndpoint(document, globalLink.fromTerminalId);
@@ -167,7 +202,6 @@ bool TerminalGraphBootstrap::resetAndLoad(
                     .arg(globalLink.fromTerminalId, globalLink.toTerminalId);
             qCWarning(lcScenario) << op << message;
             setError(error, message);
-            qDeleteAll(routes);
             return false;
         }
 
@@ -188,20 +222,59 @@ bool TerminalGraphBootstrap::resetAndLoad(
                 << "is missing canonical route metrics"
                 << missingKeys;
         }
-        routes.append(new PathSegment(
-            makeSegmentId(fromTerminalId,
-                          toTerminalId,
-                          globalLink.mode),
-            fromTerminalId,
-            toTerminalId,
-            globalLink.mode,
-            RouteMetricUnits::routeAttributesFromCanonical(
-                globalLink.properties)));
+        routes.append({fromTerminalId, toTerminalId, globalLink.mode,
+                       &globalLink.properties});
+    }
+
+    // Stream terminals, then routes, in bounded chunks. Each encoder
+    // runs one chunk ahead of the server and feeds the fingerprint.
+    GraphFingerprint fingerprint(graphFingerprintOut != nullptr);
+    fingerprint.add(QJsonObject::fromVariantMap(weights));
+
+    if (terminals.isEmpty()
+        || !terminalClient->addTerminals(
+            terminals.size(),
+            [&terminals, &fingerprint](int begin, int end) {
+                QJsonArray chunk;
+                for (int i = begin; i < end; ++i)
+                {
+                    const QJsonObject json = terminals[i]->toJson();
+                    fingerprint.add(json);
+                    chunk.append(json);
+                }
+                return chunk;
+            },
+            loggedUpload(op, "terminals")))
+    {
+        const QString message =
+            QStringLiteral("Failed to add terminals to TerminalSim");
+        qCWarning(lcScenario) << op << message;
+        setError(error, message);
+        return false;
     }
 
-    const bool routesOk = terminalClient->addRoutes(routes);
-    qDeleteAll(routes);
-    if (!routesOk)
+    if (routes.isEmpty()
+        || !terminalClient->addRoutes(
+            routes.size(),
+            [&routes, &fingerprint](int begin, int end) {
+                QJsonArray chunk;
+                for (int i = begin; i < end; ++i)
+                {
+                    const RouteSpec  &route = routes[i];
+                    const PathSegment segment(
+                        makeSegmentId(route.fromTerminalId,
+                                      route.toTerminalId, route.mode),
+                        route.fromTerminalId, route.toTerminalId,
+                        route.mode,
+                        RouteMetricUnits::routeAttributesFromCanonical(
+                            *route.properties));
+                    const QJsonObject json = segment.toJson();
+                    fingerprint.add(json);
+                    chunk.append(json);
+                }
+                return chunk;
+            },
+            loggedUpload(op, "routes")))
     {
         const QString message =
             QStringLiteral("Failed to add routes to TerminalSim");
@@ -210,6 +283,9 @@ bool TerminalGraphBootstrap::resetAndLoad(
         return false;
     }
 
+    if (graphFingerprintOut)
+        *graphFingerprintOut = fingerprint.result();
+
     if (error)
         error->clear();
     qCInfo(lcScenario)
@@ -217,7 +293,7 @@ bool TerminalGraphBootstrap::resetAndLoad(
         << "TerminalSim baseline loaded"
         << "terminals=" << terminals.size()
         << "routes="
-        << (document.connections.size() + document.globalLinks.size());
+        << (document.connections().size() + document.globalLinks().size());
     return true;
 }
 
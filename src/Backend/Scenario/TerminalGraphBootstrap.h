@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QByteArray>
 #include <QString>
 
 namespace CargoNetSim
@@ -16,12 +17,16 @@ class ScenarioRegistry;
 class TerminalGraphBootstrap
 {
 public:
+    /// Resets TerminalSim and submits the cost weights, terminals and
+    /// routes of @p document. @p graphFingerprint (if given) receives
+    /// the SHA-256 of everything submitted, for TopPathCache.
     static bool resetAndLoad(
         const ScenarioDocument &document,
         const ScenarioRegistry &registry,
         CargoNetSim::CargoNetSimController &controller,
         QString                *error = nullptr,
-        const QString          &context = QString());
+        const QString          &context = QString(),
+        QByteArray             *graphFingerprint = nullptr);
 };
 
 } // namespace Scenario
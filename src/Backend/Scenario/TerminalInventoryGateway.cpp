@@ -1,6 +1,12 @@
 #include "TerminalInventoryGateway.h"
 
 #include "Backend/Clients/TerminalClient/TerminalSimulationClient.h"
+#include "Backend/Commons/LogCategories.h"
+
+#include <containerLib/container.h>
+
+#include <QHash>
+#include <QJsonArray>
 
 namespace CargoNetSim
 {
@@ -9,6 +15,128 @@ namespace Backend
 namespace Scenario
 {
 
+namespace
+{
+
+QJsonArray toWire(const QVector<TerminalReservationItem> &items,
+                  bool                                    withCriteria)
+{
+    QJsonArray array;
+    for (const auto &item : items)
+    {
+        QJsonObject object;
+        object["terminal_id"] = item.terminalId;
+        object["reservation_id"] = item.reservationId;
+        if (withCriteria)
+            object["criteria"] = item.criteria;
+        array.append(object);
+    }
+    return array;
+}
+
+/// Per-item results in item order, matched by terminal and
+/// reservation id; an item without a successful entry gets an empty
+/// object.
+QVector<QJsonObject> fromWire(
+    const QVector<TerminalReservationItem> &items,
+    const QJsonArray                       &entries)
+{
+    QHash<QString, QJsonObject> byKey;
+    for (const auto &value : entries)
+    {
+        const QJsonObject entry = value.toObject();
+        if (!entry.value(QStringLiteral("success")).toBool(false))
+            continue;
+        byKey.insert(
+            entry.value(QStringLiteral("terminal_id")).toString()
+                + QLatin1Char('\x1f')
+                + entry.value(QStringLiteral("reservation_id"))
+                      .toString(),
+            entry.value(QStringLiteral("result")).toObject());
+    }
+
+    QVector<QJsonObject> results;
+    results.reserve(items.size());
+    for (const auto &item : items)
+    {
+        results.append(byKey.value(item.terminalId + QLatin1Char('\x1f')
+                                   + item.reservationId));
+    }
+    return results;
+}
+
+} // namespace
+
+QVector<QJsonObject> TerminalInventoryGateway::reserveContainers(
+    const QVector<TerminalReservationItem> &items)
+{
+    QVector<QJsonObject> results;
+    results.reserve(items.size());
+    for (const auto &item : items)
+    {
+        results.append(reserveContainers(
+            item.terminalId, item.reservationId, item.criteria));
+    }
+    return results;
+}
+
+QVector<QJsonObject>
+TerminalInventoryGateway::commitContainerReservations(
+    const QVector<TerminalReservationItem> &items,
+    double                                  operationTimeSeconds)
+{
+    QVector<QJsonObject> results;
+    results.reserve(items.size());
+    for (const auto &item : items)
+    {
+        results.append(commitContainerReservation(
+            item.terminalId, item.reservationId,
+            operationTimeSeconds));
+    }
+    return results;
+}
+
+QVector<QJsonObject>
+TerminalInventoryGateway::releaseContainerReservations(
+    const QVector<TerminalReservationItem> &items)
+{
+    QVector<QJsonObject> results;
+    results.reserve(items.size());
+    for (const auto &item : items)
+    {
+        results.append(releaseContainerReservation(
+            item.terminalId, item.reservationId));
+    }
+    return results;
+}
+
+bool TerminalInventoryGateway::addContainers(
+    const QString                    &terminalId,
+    int                               count,
+    const ContainerProducer          &produce,
+    double                            addTimeSeconds,
+    const QString                    &arrivalMode,
+    TerminalInventoryArrivalSemantics arrivalSemantics,
+    const Commons::ChunkedUpload     &upload)
+{
+    const int step = qMax(1, upload.maxItems);
+    for (int begin = 0; begin < count; begin += step)
+    {
+        const int end = qMin(begin + step, count);
+        QList<ContainerCore::Container *> containers =
+            produce(begin, end);
+        const bool added =
+            addContainers(terminalId, containers, addTimeSeconds,
+                          arrivalMode, arrivalSemantics);
+        qDeleteAll(containers);
+        if (!added)
+            return false;
+        if (upload.progress)
+            upload.progress(end, count);
+    }
+    return true;
+}
+
 QString terminalInventoryArrivalSemanticsToWire(
     TerminalInventoryArrivalSemantics semantics)
 {
@@ -47,6 +175,35 @@ bool TerminalSimulationInventoryGateway::addContainers(
                                        arrivalSemantics));
 }
 
+bool TerminalSimulationInventoryGateway::addContainers(
+    const QString                    &terminalId,
+    int                               count,
+    const ContainerProducer          &produce,
+    double                            addTimeSeconds,
+    const QString                    &arrivalMode,
+    TerminalInventoryArrivalSemantics arrivalSemantics,
+    const Commons::ChunkedUpload     &upload)
+{
+    return m_client
+        && m_client->addContainers(
+            terminalId, count,
+            [&produce](int begin, int end) {
+                const QList<ContainerCore::Container *> containers =
+                    produce(begin, end);
+                QJsonArray array;
+                for (const auto *container : containers)
+                {
+                    if (container)
+                        array.append(container->toJson());
+                }
+                qDeleteAll(containers);
+                return array;
+            },
+            addTimeSeconds, arrivalMode,
+            terminalInventoryArrivalSemanticsToWire(arrivalSemantics),
+            upload);
+}
+
 QJsonObject TerminalSimulationInventoryGateway::reserveContainers(
     const QString     &terminalId,
     const QString     &reservationId,
@@ -82,6 +239,71 @@ TerminalSimulationInventoryGateway::releaseContainerReservation(
         : QJsonObject{};
 }
 
+bool TerminalSimulationInventoryGateway::useBatch(
+    const QVector<TerminalReservationItem> &items) const
+{
+    return m_client && items.size() > 1
+        && m_client->supportsReservationBatches();
+}
+
+QVector<QJsonObject> TerminalSimulationInventoryGateway::reserveContainers(
+    const QVector<TerminalReservationItem> &items)
+{
+    if (!useBatch(items))
+        return TerminalInventoryGateway::reserveContainers(items);
+
+    // The server may have acted on a failed batch; never repeat it
+    // item by item.
+    const QJsonArray entries =
+        m_client->reserveContainerBatch(toWire(items, true));
+    if (entries.isEmpty())
+    {
+        qCWarning(lcScenario)
+            << "TerminalSimulationInventoryGateway::reserveContainers:"
+            << "bulk reserve failed for" << items.size() << "item(s)";
+    }
+    return fromWire(items, entries);
+}
+
+QVector<QJsonObject>
+TerminalSimulationInventoryGateway::commitContainerReservations(
+    const QVector<TerminalReservationItem> &items,
+    double                                  operationTimeSeconds)
+{
+    if (!useBatch(items))
+        return TerminalInventoryGateway::commitContainerReservations(
+            items, operationTimeSeconds);
+
+    const QJsonArray entries = m_client->commitContainerReservationBatch(
+        toWire(items, false), operationTimeSeconds);
+    if (entries.isEmpty())
+    {
+        qCWarning(lcScenario)
+            << "TerminalSimulationInventoryGateway::commitContainerReservations:"
+            << "bulk commit failed for" << items.size() << "item(s)";
+    }
+    return fromWire(items, entries);
+}
+
+QVector<QJsonObject>
+TerminalSimulationInventoryGateway::releaseContainerReservations(
+    const QVector<TerminalReservationItem> &items)
+{
+    if (!useBatch(items))
+        return TerminalInventoryGateway::releaseContainerReservations(
+            items);
+
+    const QJsonArray entries =
+        m_client->releaseContainerReservationBatch(toWire(items, false));
+    if (entries.isEmpty())
+    {
+        qCWarning(lcScenario)
+            << "TerminalSimulationInventoryGateway::releaseContainerReservations:"
+            << "bulk release failed for" << items.size() << "item(s)";
+    }
+    return fromWire(items, entries);
+}
+
 } // namespace Scenario
 } // namespace Backend
 } // namespace CargoNetSim
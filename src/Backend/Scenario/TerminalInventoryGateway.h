@@ -1,8 +1,12 @@
 #pragma once
 
+#include "Backend/Commons/ChunkedUpload.h"
+
 #include <QJsonObject>
 #include <QList>
 #include <QString>
+#include <QVector>
+#include <functional>
 
 namespace ContainerCore
 {
@@ -29,6 +33,15 @@ enum class TerminalInventoryArrivalSemantics
 QString terminalInventoryArrivalSemanticsToWire(
     TerminalInventoryArrivalSemantics semantics);
 
+/// One reservation in a wave-level reserve, commit or release call.
+/// criteria is only used when reserving.
+struct TerminalReservationItem
+{
+    QString     terminalId;
+    QString     reservationId;
+    QJsonObject criteria;
+};
+
 class TerminalInventoryGateway
 {
 public:
@@ -55,6 +68,36 @@ public:
     virtual QJsonObject releaseContainerReservation(
         const QString &terminalId,
         const QString &reservationId) = 0;
+
+    // Wave-level variants: one result per item, in item order, each
+    // shaped like the single-item result (empty when that item
+    // failed). The defaults issue one single-item call per item.
+    virtual QVector<QJsonObject> reserveContainers(
+        const QVector<TerminalReservationItem> &items);
+
+    virtual QVector<QJsonObject> commitContainerReservations(
+        const QVector<TerminalReservationItem> &items,
+        double operationTimeSeconds);
+
+    virtual QVector<QJsonObject> releaseContainerReservations(
+        const QVector<TerminalReservationItem> &items);
+
+    /// Produces new containers [begin, end) of a seed list; the
+    /// caller of the producer owns them.
+    using ContainerProducer =
+        std::function<QList<ContainerCore::Container *>(int, int)>;
+
+    // Chunked upload of @p count containers made by @p produce,
+    // one bounded message per chunk. The default produces and
+    // adds one chunk at a time through addContainers().
+    virtual bool addContainers(
+        const QString                     &terminalId,
+        int                                count,
+        const ContainerProducer           &produce,
+        double                             addTimeSeconds,
+        const QString                     &arrivalMode,
+        TerminalInventoryArrivalSemantics  arrivalSemantics,
+        const Commons::ChunkedUpload      &upload);
 };
 
 class TerminalSimulationInventoryGateway final
@@ -86,7 +129,35 @@ public:
         const QString &terminalId,
         const QString &reservationId) override;
 
+    /// One TerminalSim round trip per call when the server
+    /// supports the batch commands (asked once per server session,
+    /// see TerminalSimulationClient::supportsReservationBatches());
+    /// otherwise the single-item commands. A batch the server
+    /// failed is reported as failed items, never retried per item.
+    QVector<QJsonObject> reserveContainers(
+        const QVector<TerminalReservationItem> &items) override;
+
+    QVector<QJsonObject> commitContainerReservations(
+        const QVector<TerminalReservationItem> &items,
+        double operationTimeSeconds) override;
+
+    QVector<QJsonObject> releaseContainerReservations(
+        const QVector<TerminalReservationItem> &items) override;
+
+    /// The next chunk is produced and encoded on a worker
+    /// thread while TerminalSim ingests the previous one.
+    bool addContainers(
+        const QString                     &terminalId,
+        int                                count,
+        const ContainerProducer           &produce,
+        double                             addTimeSeconds,
+        const QString                     &arrivalMode,
+        TerminalInventoryArrivalSemantics  arrivalSemantics,
+        const Commons::ChunkedUpload      &upload) override;
+
 private:
+    bool useBatch(const QVector<TerminalReservationItem> &items) const;
+
     TerminalSimulationClient *m_client = nullptr;
 };
 
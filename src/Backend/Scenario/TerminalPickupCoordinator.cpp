@@ -36,16 +36,13 @@ QString reservationIdFor(const TerminalPickupRequest &request)
         .arg(QString::fromLatin1(digest));
 }
 
-void deleteSeededContainers(
-    QHash<QString, QList<ContainerCore::Container *>> &containersByTerminal)
+/// One seed container, copied for execution only when its chunk is
+/// encoded.
+struct SeedItem
 {
-    for (auto it = containersByTerminal.begin();
-         it != containersByTerminal.end(); ++it)
-    {
-        qDeleteAll(it.value());
-        it.value().clear();
-    }
-}
+    const PathExecutionPlan        *pathPlan  = nullptr;
+    const ContainerCore::Container *container = nullptr;
+};
 
 QList<ContainerCore::Container *> containersFromResponse(
     const QJsonObject &response)
@@ -79,10 +76,11 @@ TerminalPickupCoordinator::TerminalPickupCoordinator(
 }
 
 bool TerminalPickupCoordinator::seedExecutionInventory(
-    const ScenarioExecutionPlan &plan,
-    const PathAllocation        &allocation,
-    double                       addTimeSeconds,
-    QString                     *err) const
+    const ScenarioExecutionPlan  &plan,
+    const PathAllocation         &allocation,
+    double                        addTimeSeconds,
+    QString                      *err,
+    const Commons::ChunkedUpload &upload) const
 {
     if (!m_gateway)
     {
@@ -94,8 +92,9 @@ bool TerminalPickupCoordinator::seedExecutionInventory(
         return false;
     }
 
-    QHash<QString, QList<ContainerCore::Container *>>
-        containersByTerminal;
+    // Validate every path before anything reaches TerminalSim.
+    QHash<QString, QVector<SeedItem>> itemsByTerminal;
+    int                               total = 0;
 
     for (const auto &pathPlan : plan.paths)
     {
@@ -108,7 +107,6 @@ bool TerminalPickupCoordinator::seedExecutionInventory(
         if (allocatedContainers.size()
             != pathPlan.effectiveContainerCount)
         {
-            deleteSeededContainers(containersByTerminal);
             if (err)
             {
                 *err = QStringLiteral(
@@ -120,136 +118,192 @@ bool TerminalPickupCoordinator::seedExecutionInventory(
             return false;
         }
 
+        auto &items = itemsByTerminal[pathPlan.originId];
         for (const auto *container : allocatedContainers)
         {
             if (!container)
                 continue;
-
-            const auto metadata =
-                ExecutionContainers::makeIdentityMetadata(
-                    plan.executionId,
-                    pathPlan.executionPathKey,
-                    pathPlan.canonicalPathKey,
-                    *container,
-                    /*readySegmentIndex=*/0,
-                    /*terminalSequenceIndex=*/0);
-            containersByTerminal[pathPlan.originId].append(
-                ExecutionContainers::makeExecutionContainerCopy(
-                    *container, metadata, pathPlan.originId));
+            items.append({&pathPlan, container});
+            ++total;
         }
     }
 
-    bool ok = true;
-    for (auto it = containersByTerminal.begin();
-         it != containersByTerminal.end(); ++it)
+    int seeded = 0;
+    for (auto it = itemsByTerminal.cbegin();
+         it != itemsByTerminal.cend(); ++it)
     {
-        if (it.value().isEmpty())
+        const QVector<SeedItem> &items = it.value();
+        if (items.isEmpty())
             continue;
 
+        // May run on the upload worker; reads plan and items only
+        const auto produce = [&plan, &items](int begin, int end) {
+            QList<ContainerCore::Container *> copies;
+            copies.reserve(end - begin);
+            for (int i = begin; i < end; ++i)
+            {
+                const SeedItem &item     = items[i];
+                const auto      metadata =
+                    ExecutionContainers::makeIdentityMetadata(
+                        plan.executionId,
+                        item.pathPlan->executionPathKey,
+                        item.pathPlan->canonicalPathKey,
+                        *item.container,
+                        /*readySegmentIndex=*/0,
+                        /*terminalSequenceIndex=*/0);
+                copies.append(
+                    ExecutionContainers::makeExecutionContainerCopy(
+                        *item.container, metadata,
+                        item.pathPlan->originId));
+            }
+            return copies;
+        };
+
+        Commons::ChunkedUpload terminalUpload;
+        terminalUpload.maxItems = upload.maxItems;
+        if (upload.progress)
+        {
+            terminalUpload.progress = [&upload, seeded, total](int sent,
+                                                               int) {
+                upload.progress(seeded + sent, total);
+            };
+        }
+
         if (!m_gateway->addContainers(
-                it.key(),
-                it.value(),
-                addTimeSeconds,
+                it.key(), items.size(), produce, addTimeSeconds,
                 QString(),
-                TerminalInventoryArrivalSemantics::Preload))
+                TerminalInventoryArrivalSemantics::Preload,
+                terminalUpload))
         {
-            ok = false;
             if (err)
             {
                 *err = QStringLiteral(
                     "Failed to seed %1 execution container(s) into terminal %2")
-                           .arg(it.value().size())
+                           .arg(items.size())
                            .arg(it.key());
             }
-            break;
+            return false;
         }
+        seeded += items.size();
     }
 
-    deleteSeededContainers(containersByTerminal);
-    if (ok && err)
+    if (err)
         err->clear();
-    return ok;
+    return true;
 }
 
 TerminalPickupBatch TerminalPickupCoordinator::reserveForDispatch(
     const TerminalPickupRequest &request) const
 {
-    TerminalPickupBatch batch;
+    return reserveForDispatch(
+        QVector<TerminalPickupRequest>{request}).first();
+}
+
+QVector<TerminalPickupBatch> TerminalPickupCoordinator::reserveForDispatch(
+    const QVector<TerminalPickupRequest> &requests) const
+{
+    QVector<TerminalPickupBatch> batches(requests.size());
+    if (requests.isEmpty())
+        return batches;
 
     if (!m_gateway)
     {
-        batch.errorMessage = QStringLiteral(
-            "Terminal pickup coordinator requires a terminal inventory gateway");
-        return batch;
-    }
-    if (request.executionId.isEmpty()
-        || request.executionPathKey.isEmpty()
-        || request.canonicalPathKey.isEmpty()
-        || request.terminalId.isEmpty()
-        || request.segmentIndex < 0
-        || request.containerCount <= 0)
-    {
-        batch.errorMessage = QStringLiteral(
-            "Terminal pickup reservation request is incomplete");
-        return batch;
+        for (auto &batch : batches)
+        {
+            batch.errorMessage = QStringLiteral(
+                "Terminal pickup coordinator requires a terminal inventory gateway");
+        }
+        return batches;
     }
 
-    batch.handle = makeHandle(request);
-    const QJsonObject criteria =
-        ExecutionContainers::terminalPickupCriteria(
-            request.executionId,
-            request.canonicalPathKey,
-            request.segmentIndex,
-            request.containerCount);
-
-    const QJsonObject response = m_gateway->reserveContainers(
-        request.terminalId,
-        batch.handle.reservationId,
-        criteria);
-    if (response.isEmpty())
-    {
-        batch.errorMessage = QStringLiteral(
-            "Terminal %1 did not create reservation %2")
-                                 .arg(request.terminalId,
-                                      batch.handle.reservationId);
-        return batch;
-    }
-    if (responseStateIs(response, QStringLiteral("blocked")))
+    QVector<TerminalReservationItem> items;
+    QVector<int>                     itemRequest;
+    items.reserve(requests.size());
+    itemRequest.reserve(requests.size());
+    for (int i = 0; i < requests.size(); ++i)
     {
-        batch.blocked = true;
-        return batch;
-    }
-    if (!responseStateIs(response, QStringLiteral("active")))
-    {
-        batch.errorMessage = QStringLiteral(
-            "Terminal reservation %1 for %2 segment %3 is not active (state=%4)")
-                                 .arg(batch.handle.reservationId,
-                                      request.executionPathKey)
-                                 .arg(request.segmentIndex)
-                                 .arg(response.value(
-                                          QStringLiteral("state"))
-                                          .toString());
-        return batch;
+        const auto &request = requests[i];
+        if (request.executionId.isEmpty()
+            || request.executionPathKey.isEmpty()
+            || request.canonicalPathKey.isEmpty()
+            || request.terminalId.isEmpty()
+            || request.segmentIndex < 0
+            || request.containerCount <= 0)
+        {
+            batches[i].errorMessage = QStringLiteral(
+                "Terminal pickup reservation request is incomplete");
+            continue;
+        }
+
+        batches[i].handle = makeHandle(request);
+        TerminalReservationItem item;
+        item.terminalId = request.terminalId;
+        item.reservationId = batches[i].handle.reservationId;
+        item.criteria =
+            ExecutionContainers::terminalPickupCriteria(
+                request.executionId,
+                request.canonicalPathKey,
+                request.segmentIndex,
+                request.containerCount);
+        items.append(item);
+        itemRequest.append(i);
     }
+    if (items.isEmpty())
+        return batches;
 
-    batch.containers = containersFromResponse(response);
-    const int responseCount =
-        response.value(QStringLiteral("container_count"))
-            .toInt(batch.containers.size());
-    const int parsedCount = batch.containers.size();
-    if (responseCount != request.containerCount
-        || parsedCount != request.containerCount)
+    const QVector<QJsonObject> responses =
+        m_gateway->reserveContainers(items);
+
+    QVector<TerminalPickupReservationHandle> shortReservations;
+    for (int k = 0; k < itemRequest.size(); ++k)
     {
-        qDeleteAll(batch.containers);
-        batch.containers.clear();
-        QVector<TerminalPickupReservationHandle> handles;
-        handles.append(batch.handle);
-        releaseReservations(handles);
-        batch.blocked = true;
-        return batch;
+        const auto &request = requests[itemRequest[k]];
+        auto       &batch = batches[itemRequest[k]];
+        const QJsonObject response = responses.value(k);
+        if (response.isEmpty())
+        {
+            batch.errorMessage = QStringLiteral(
+                "Terminal %1 did not create reservation %2")
+                                     .arg(request.terminalId,
+                                          batch.handle.reservationId);
+            continue;
+        }
+        if (responseStateIs(response, QStringLiteral("blocked")))
+        {
+            batch.blocked = true;
+            continue;
+        }
+        if (!responseStateIs(response, QStringLiteral("active")))
+        {
+            batch.errorMessage = QStringLiteral(
+                "Terminal reservation %1 for %2 segment %3 is not active (state=%4)")
+                                     .arg(batch.handle.reservationId,
+                                          request.executionPathKey)
+                                     .arg(request.segmentIndex)
+                                     .arg(response.value(
+                                              QStringLiteral("state"))
+                                              .toString());
+            continue;
+        }
+
+        batch.containers = containersFromResponse(response);
+        const int responseCount =
+            response.value(QStringLiteral("container_count"))
+                .toInt(batch.containers.size());
+        const int parsedCount = batch.containers.size();
+        if (responseCount != request.containerCount
+            || parsedCount != request.containerCount)
+        {
+            qDeleteAll(batch.containers);
+            batch.containers.clear();
+            shortReservations.append(batch.handle);
+            batch.blocked = true;
+        }
     }
 
-    return batch;
+    // Give back partial reservations in one call
+    releaseReservations(shortReservations);
+    return batches;
 }
 
 bool TerminalPickupCoordinator::commitReservations(
@@ -273,6 +327,8 @@ bool TerminalPickupCoordinator::commitReservations(
         return false;
     }
 
+    QVector<TerminalReservationItem> items;
+    items.reserve(handles.size());
     for (const auto &handle : handles)
     {
         if (!handle.isValid())
@@ -282,16 +338,20 @@ bool TerminalPickupCoordinator::commitReservations(
                     "Cannot commit an invalid terminal pickup reservation");
             return false;
         }
+        items.append({handle.terminalId, handle.reservationId, {}});
+    }
 
-        const QJsonObject response =
-            m_gateway->commitContainerReservation(
-                handle.terminalId,
-                handle.reservationId,
-                operationTimeSeconds);
+    const QVector<QJsonObject> responses =
+        m_gateway->commitContainerReservations(items,
+                                               operationTimeSeconds);
+    for (int i = 0; i < handles.size(); ++i)
+    {
+        const QJsonObject response = responses.value(i);
         if (response.isEmpty()
             || !responseStateIs(response,
                                 QStringLiteral("committed")))
         {
+            const auto &handle = handles[i];
             if (err)
             {
                 *err = QStringLiteral(
@@ -329,19 +389,26 @@ bool TerminalPickupCoordinator::releaseReservations(
         return false;
     }
 
+    QVector<TerminalPickupReservationHandle> valid;
+    QVector<TerminalReservationItem>         items;
     for (const auto &handle : handles)
     {
         if (!handle.isValid())
             continue;
+        valid.append(handle);
+        items.append({handle.terminalId, handle.reservationId, {}});
+    }
 
-        const QJsonObject response =
-            m_gateway->releaseContainerReservation(
-                handle.terminalId,
-                handle.reservationId);
+    const QVector<QJsonObject> responses =
+        m_gateway->releaseContainerReservations(items);
+    for (int i = 0; i < valid.size(); ++i)
+    {
+        const QJsonObject response = responses.value(i);
         if (response.isEmpty()
             || !responseStateIs(response,
                                 QStringLiteral("released")))
         {
+            const auto &handle = valid[i];
             if (err)
             {
                 *err = QStringLiteral(
@@ -4,6 +4,7 @@
 #include <QVector>
 #include <QString>
 
+#include "Backend/Commons/ChunkedUpload.h"
 #include "ExecutionPlanTypes.h"
 #include "PathAllocation.h"
 
@@ -67,15 +68,26 @@ public:
     explicit TerminalPickupCoordinator(
         TerminalInventoryGateway *gateway);
 
+    // Streams each origin's seed containers to TerminalSim in
+    // bounded chunks; the execution copies of a chunk exist only
+    // while it is encoded. upload.progress sees containers seeded
+    // across all terminals.
     bool seedExecutionInventory(
-        const ScenarioExecutionPlan &plan,
-        const PathAllocation        &allocation,
-        double                       addTimeSeconds,
-        QString                     *err) const;
+        const ScenarioExecutionPlan  &plan,
+        const PathAllocation         &allocation,
+        double                        addTimeSeconds,
+        QString                      *err,
+        const Commons::ChunkedUpload &upload =
+            Commons::ChunkedUpload()) const;
 
     TerminalPickupBatch reserveForDispatch(
         const TerminalPickupRequest &request) const;
 
+    // Reserves every request of a dispatch wave with one gateway call;
+    // one batch per request, in request order.
+    QVector<TerminalPickupBatch> reserveForDispatch(
+        const QVector<TerminalPickupRequest> &requests) const;
+
     bool commitReservations(
         const QVector<TerminalPickupReservationHandle> &handles,
         double operationTimeSeconds,
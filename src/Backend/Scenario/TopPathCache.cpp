@@ -0,0 +1,183 @@
+#include "TopPathCache.h"
+#include "Backend/Commons/LogCategories.h"
+#include "CacheLocation.h"
+
+#include <QCborValue>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+namespace
+{
+
+constexpr int kDigestSize = 32; // SHA-256
+
+const QString kEntrySuffix = QStringLiteral(".paths.cnscache");
+
+void configureStream(QDataStream &ds)
+{
+    ds.setByteOrder(QDataStream::LittleEndian);
+}
+
+} // namespace
+
+TopPathCache::TopPathCache(const QString &directory, int capacity)
+    : m_directory(directory)
+    , m_capacity(qMax(1, capacity))
+{
+}
+
+QString TopPathCache::defaultDirectoryFor(const QString &scenarioPath)
+{
+    return CacheLocation::filePathFor(scenarioPath,
+                                      QStringLiteral("top-paths"));
+}
+
+QString TopPathCache::entryPathFor(const QByteArray &fingerprint,
+                                   const QString    &key) const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(fingerprint);
+    hash.addData(key.toUtf8());
+    return QDir(m_directory).filePath(
+        QString::fromLatin1(hash.result().toHex()) + kEntrySuffix);
+}
+
+bool TopPathCache::load(const QByteArray &fingerprint, const QString &key,
+                        QJsonArray *paths) const
+{
+    if (!isEnabled() || fingerprint.size() != kDigestSize)
+        return false;
+    const QString entryPath = entryPathFor(fingerprint, key);
+    QFile         f(entryPath);
+    if (!f.exists() || !f.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream ds(&f);
+    configureStream(ds);
+    quint32    magic  = 0;
+    quint16    format = 0;
+    QByteArray storedFingerprint(kDigestSize, Qt::Uninitialized);
+    ds >> magic >> format;
+    if (ds.status() != QDataStream::Ok || magic != kMagic
+        || format != kFormatVersion
+        || ds.readRawData(storedFingerprint.data(), kDigestSize)
+               != kDigestSize
+        || storedFingerprint != fingerprint)
+    {
+        qCDebug(lcScenario) << "TopPathCache::load:"
+                            << "stale or incompatible" << entryPath;
+        return false;
+    }
+
+    quint32 keyLen = 0;
+    ds >> keyLen;
+    if (ds.status() != QDataStream::Ok
+        || keyLen > static_cast<quint64>(f.size() - f.pos()))
+        return false; // truncated or corrupt
+    QByteArray storedKey(static_cast<qsizetype>(keyLen), Qt::Uninitialized);
+    if (ds.readRawData(storedKey.data(), static_cast<int>(keyLen))
+            != static_cast<int>(keyLen)
+        || QString::fromUtf8(storedKey) != key)
+        return false;
+
+    quint64 payloadSize = 0;
+    ds >> payloadSize;
+    if (ds.status() != QDataStream::Ok
+        || payloadSize > static_cast<quint64>(f.size() - f.pos()))
+        return false; // truncated
+
+    QCborParserError cborError;
+    const QCborValue payload = QCborValue::fromCbor(
+        f.read(static_cast<qint64>(payloadSize)), &cborError);
+    if (cborError.error != QCborError::NoError || !payload.isArray())
+    {
+        qCDebug(lcScenario) << "TopPathCache::load: corrupt" << entryPath
+                            << "-" << cborError.errorString();
+        return false;
+    }
+
+    // Mark as recently used for trim()
+    f.setFileTime(QDateTime::currentDateTimeUtc(),
+                  QFileDevice::FileModificationTime);
+    if (paths)
+        *paths = payload.toJsonValue().toArray();
+    return true;
+}
+
+bool TopPathCache::store(const QByteArray &fingerprint, const QString &key,
+                         const QJsonArray &paths, QString *error) const
+{
+    if (!isEnabled() || fingerprint.size() != kDigestSize)
+    {
+        if (error) *error = QStringLiteral("cache disabled");
+        return false;
+    }
+    if (!QDir().mkpath(m_directory))
+    {
+        if (error)
+            *error = QStringLiteral("cannot create %1").arg(m_directory);
+        return false;
+    }
+
+    const QString entryPath = entryPathFor(fingerprint, key);
+    QSaveFile     out(entryPath);
+    if (!out.open(QIODevice::WriteOnly))
+    {
+        if (error) *error = out.errorString();
+        return false;
+    }
+
+    const QByteArray keyBytes = key.toUtf8();
+    const QByteArray payload  = QCborValue::fromJsonValue(paths).toCbor();
+
+    QDataStream ds(&out);
+    configureStream(ds);
+    ds << kMagic << kFormatVersion;
+    ds.writeRawData(fingerprint.constData(), fingerprint.size());
+    ds << static_cast<quint32>(keyBytes.size());
+    ds.writeRawData(keyBytes.constData(), keyBytes.size());
+    ds << static_cast<quint64>(payload.size());
+    ds.writeRawData(payload.constData(), payload.size());
+
+    if (ds.status() != QDataStream::Ok || !out.commit())
+    {
+        if (error) *error = out.errorString();
+        return false;
+    }
+    return true;
+}
+
+int TopPathCache::trim() const
+{
+    if (!isEnabled())
+        return 0;
+    // Newest first
+    const QFileInfoList entries = QDir(m_directory).entryInfoList(
+        {QLatin1Char('*') + kEntrySuffix}, QDir::Files, QDir::Time);
+    int removed = 0;
+    for (qsizetype i = m_capacity; i < entries.size(); ++i)
+    {
+        if (QFile::remove(entries.at(i).absoluteFilePath()))
+            ++removed;
+    }
+    if (removed > 0)
+        qCDebug(lcScenario) << "TopPathCache::trim: evicted" << removed
+                            << "entries from" << m_directory;
+    return removed;
+}
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QString>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+/// On-disk cache of TerminalSim `find_top_paths` answers.
+///
+/// An entry holds the raw `paths` array the server returned for one
+/// request, keyed by the graph fingerprint (SHA-256 over the cost
+/// weights, terminals and routes TerminalGraphBootstrap submitted) and
+/// the request key (`TerminalSimulationClient::makeTopPathsCacheKey`).
+/// Any change to the graph or the weights yields a new fingerprint, so
+/// stale answers are never served; they simply age out.
+///
+/// Each entry is one file `<sha256(fingerprint, key)>.paths.cnscache` in
+/// the cache directory. A hit refreshes the file's modification time;
+/// trim() deletes the least recently used files beyond the capacity.
+/// Several processes may share a directory: entries are written
+/// atomically and a vanished file is just a miss.
+///
+/// File layout (little-endian):
+/// @code
+/// u32 magic 'CNSP' (0x50534E43), u16 format version,
+/// 32 × u8 fingerprint, u32 keyLen, keyLen × u8 UTF-8,
+/// u64 payloadSize, payloadSize × u8 CBOR(paths)
+/// @endcode
+/// Failing to read or write an entry is never an error for the caller.
+class TopPathCache
+{
+public:
+    static constexpr quint32 kMagic           = 0x50534E43u; // "CNSP"
+    static constexpr quint16 kFormatVersion   = 1;
+    static constexpr int     kDefaultCapacity = 4096;
+
+    /// Disabled when @p directory is empty.
+    explicit TopPathCache(const QString &directory,
+                          int            capacity = kDefaultCapacity);
+
+    bool           isEnabled() const { return !m_directory.isEmpty(); }
+    const QString &directory() const { return m_directory; }
+    int            capacity() const { return m_capacity; }
+
+    /// `top-paths` in the CacheLocation directory of @p scenarioPath;
+    /// shared by every scenario in the same source directory. Empty when
+    /// no cache directory is available.
+    static QString defaultDirectoryFor(const QString &scenarioPath);
+
+    /// Entry file for (@p fingerprint, @p key).
+    QString entryPathFor(const QByteArray &fingerprint,
+                         const QString    &key) const;
+
+    /// Fills @p paths and returns true on a hit.
+    bool load(const QByteArray &fingerprint, const QString &key,
+              QJsonArray *paths) const;
+
+    /// Writes the entry atomically. Returns false (with @p error) on
+    /// failure.
+    bool store(const QByteArray &fingerprint, const QString &key,
+               const QJsonArray &paths, QString *error = nullptr) const;
+
+    /// Deletes least recently used entries until at most capacity()
+    /// remain. Returns the number deleted.
+    int trim() const;
+
+private:
+    QString m_directory;
+    int     m_capacity = kDefaultCapacity;
+};
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
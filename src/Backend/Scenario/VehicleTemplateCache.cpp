@@ -0,0 +1,72 @@
+#include "VehicleTemplateCache.h"
+
+#include "Backend/Commons/LogCategories.h"
+#include "Backend/Controllers/VehicleController.h"
+#include "Backend/Models/ShipSystem.h"
+#include "Backend/Models/TrainSystem.h"
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+namespace Scenario
+{
+
+VehicleTemplateCache::VehicleTemplateCache(VehicleController *vehicles)
+    : m_vehicles(vehicles)
+{
+}
+
+std::shared_ptr<const VehicleTemplate>
+VehicleTemplateCache::randomTrain() const
+{
+    const Train *train = m_vehicles ? m_vehicles->getRandomTrain() : nullptr;
+    if (!train)
+        return nullptr;
+    return templateFor(train, train->getUserId(),
+                       [train]() { return train->toJson(); });
+}
+
+std::shared_ptr<const VehicleTemplate>
+VehicleTemplateCache::randomShip() const
+{
+    const Ship *ship = m_vehicles ? m_vehicles->getRandomShip() : nullptr;
+    if (!ship)
+        return nullptr;
+    return templateFor(ship, ship->getUserId(),
+                       [ship]() { return ship->toJson(); });
+}
+
+int VehicleTemplateCache::size() const
+{
+    QMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_templates.size());
+}
+
+std::shared_ptr<const VehicleTemplate> VehicleTemplateCache::templateFor(
+    const void *vehicle, const QString &templateId,
+    const std::function<QJsonObject()> &serialize) const
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (auto cached = m_templates.value(vehicle))
+            return cached;
+    }
+
+    // Serialize outside the lock; a racing thread's copy is identical.
+    auto created = std::make_shared<const VehicleTemplate>(
+        VehicleTemplate{templateId, serialize()});
+    qCDebug(lcScenario) << "VehicleTemplateCache: serialized template"
+                        << templateId;
+
+    QMutexLocker locker(&m_mutex);
+    auto it = m_templates.constFind(vehicle);
+    if (it != m_templates.constEnd())
+        return it.value();
+    m_templates.insert(vehicle, created);
+    return created;
+}
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
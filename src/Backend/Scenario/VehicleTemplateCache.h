@@ -0,0 +1,62 @@
+#pragma once
+
+#include "SimulationDispatchTypes.h"
+
+#include <QHash>
+#include <QMutex>
+#include <functional>
+#include <memory>
+
+namespace CargoNetSim
+{
+namespace Backend
+{
+class Ship;
+class Train;
+class VehicleController;
+
+namespace Scenario
+{
+
+/// Serialized templates of a VehicleController's catalog vehicles.
+///
+/// Dispatching used to deep-copy the catalog Train or Ship (locomotives,
+/// cars, tank and engine tables) for every vehicle and serialize each
+/// copy again. A template is serialized once per catalog vehicle and
+/// shared by every TrainSimData / ShipSimData that uses it; those only
+/// carry the per-trip id, path and containers.
+///
+/// Catalog vehicles must not change while the cache is in use.
+/// Thread-safe.
+class VehicleTemplateCache
+{
+public:
+    explicit VehicleTemplateCache(VehicleController *vehicles);
+
+    VehicleTemplateCache(const VehicleTemplateCache &) = delete;
+    VehicleTemplateCache &
+    operator=(const VehicleTemplateCache &) = delete;
+
+    /// Template of a random catalog train, or nullptr if there is none.
+    std::shared_ptr<const VehicleTemplate> randomTrain() const;
+
+    /// Template of a random catalog ship, or nullptr if there is none.
+    std::shared_ptr<const VehicleTemplate> randomShip() const;
+
+    /// Number of templates serialized so far.
+    int size() const;
+
+private:
+    std::shared_ptr<const VehicleTemplate>
+    templateFor(const void *vehicle, const QString &templateId,
+                const std::function<QJsonObject()> &serialize) const;
+
+    VehicleController *m_vehicles = nullptr;
+    mutable QMutex     m_mutex;
+    mutable QHash<const void *, std::shared_ptr<const VehicleTemplate>>
+        m_templates; ///< By catalog vehicle
+};
+
+} // namespace Scenario
+} // namespace Backend
+} // namespace CargoNetSim
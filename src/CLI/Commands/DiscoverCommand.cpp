@@ -22,6 +22,7 @@
 #include "Backend/Scenario/ScenarioRuntime.h"
 #include "CLI/Commands/CommandOutput.h"
 #include "CLI/Commands/IssueFormatter.h"
+#include "CLI/Commands/ScenarioCachePolicy.h"
 #include "CLI/ExitCodes.h"
 
 namespace CargoNetSim {
@@ -674,6 +675,7 @@ int DiscoverCommand::execute(const QStringList &args)
     }
 
     Backend::Application::ScenarioLoadService loadService;
+    loadService.setScenarioCacheEnabled(scenarioCacheEnabled());
     auto parseResult =
         loadService.parseAndValidateYaml(options.scenarioPath);
     if (parseResult.status
@@ -750,6 +752,9 @@ int DiscoverCommand::execute(const QStringList &args)
 
     Backend::Application::PreparedPathService
         preparedPathService(&controller);
+    preparedPathService.setDistanceCacheEnabled(scenarioCacheEnabled());
+    preparedPathService.setPathCacheDirectory(
+        topPathCacheDirectory(options.scenarioPath));
     const auto preparedResult =
         preparedPathService.discoverAndPrepare(runtime, topN);
     if (!preparedResult.succeeded())
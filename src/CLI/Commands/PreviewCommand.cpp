@@ -13,6 +13,7 @@
 #include "Backend/Commons/LogCategories.h"
 #include "CLI/Commands/CommandOutput.h"
 #include "CLI/Commands/IssueFormatter.h"
+#include "CLI/Commands/ScenarioCachePolicy.h"
 #include "CLI/ExitCodes.h"
 
 namespace CargoNetSim {
@@ -93,6 +94,7 @@ int PreviewCommand::execute(const QStringList &args)
     // ---- Parse + validate ------------------------------------------------
     qCDebug(lcCli) << "PreviewCommand::execute: parsing YAML...";
     Backend::Application::ScenarioLoadService loadService;
+    loadService.setScenarioCacheEnabled(scenarioCacheEnabled());
     auto parseResult = loadService.parseAndValidateYaml(path);
     if (parseResult.status
         == Backend::Application::ScenarioLoadServiceStatus::ParseFailed
@@ -138,7 +140,9 @@ int PreviewCommand::execute(const QStringList &args)
         << "PreviewCommand::execute: building preview JSON...";
     Backend::Application::ScenarioPreviewService previewService;
     const auto previewResult =
-        previewService.buildPreviewJson(std::move(doc));
+        previewService.buildPreviewJson(
+            std::move(doc),
+            scenarioCacheEnabled() ? path : QString());
     if (!previewResult.succeeded())
     {
         qCCritical(lcCli)
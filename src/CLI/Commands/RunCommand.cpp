@@ -7,9 +7,11 @@
 #include <QSet>
 #include <QTimer>
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <functional>
+#include <memory>
 
 #include "Backend/Application/PreparedPathService.h"
 #include "Backend/Application/ScenarioLoadService.h"
@@ -23,9 +25,9 @@
 #include "Backend/Scenario/ScenarioRuntime.h"
 #include "CLI/Commands/CommandOutput.h"
 #include "CLI/Commands/IssueFormatter.h"
+#include "CLI/Commands/ScenarioCachePolicy.h"
 #include "CLI/ExitCodes.h"
-#include "CLI/Output/CsvResultsWriter.h"
-#include "CLI/Output/JsonResultsWriter.h"
+#include "CLI/Output/ResultsOutputWriter.h"
 #include "CLI/Progress/ProgressReporter.h"
 
 namespace CargoNetSim {
@@ -278,6 +280,12 @@ bool selectedExecutionPathKeysForIndexes(
     return true;
 }
 
+QString outputDirectoryFor(const Backend::Scenario::ScenarioDocument &doc)
+{
+    return doc.output.directory.isEmpty() ? QDir::currentPath()
+                                          : doc.output.directory;
+}
+
 void emitStatus(QIODevice *sink, const QString &message)
 {
     streamToOr(sink, stderr,
@@ -382,12 +390,10 @@ void emitResultsSummary(
     const Backend::Scenario::ScenarioExecutionResultSet &executionResults,
     const QList<Backend::Path *> &paths,
     const QHash<QString, Backend::Scenario::PathMetrics>
-        &predictedMetricsByCanonicalPath)
+        &predictedMetricsByCanonicalPath,
+    int streamedPathCount = -1)
 {
-    const QString outDir = doc.output.directory.isEmpty()
-        ? QDir::currentPath()
-        : doc.output.directory;
-    const QDir outputDir(outDir);
+    const QDir outputDir(outputDirectoryFor(doc));
 
     streamToOr(sink, stderr,
                QStringLiteral(
@@ -395,22 +401,32 @@ void emitResultsSummary(
                    .arg(outputDir.absolutePath()));
     for (const auto &fmt : doc.output.formats)
     {
-        if (fmt == QLatin1String("json")
-            || fmt == QLatin1String("csv"))
+        const QString fileName =
+            ResultsOutputWriter::fileNameForFormat(fmt);
+        if (!fileName.isEmpty())
         {
             streamToOr(sink, stderr,
                        QStringLiteral("run:   %1: %2\n")
                            .arg(fmt,
-                                outputDir.absoluteFilePath(
-                                    QStringLiteral("results.%1")
-                                        .arg(fmt))));
+                                outputDir.absoluteFilePath(fileName)));
         }
     }
 
+    // A negative streamedPathCount means the runtime kept every result;
+    // otherwise they only exist in the streamed outputs.
+    const bool retained = streamedPathCount < 0;
     streamToOr(sink, stderr,
                QStringLiteral(
                    "run: summary: %1 path(s) simulated\n")
-                   .arg(results.size()));
+                   .arg(retained ? results.size() : streamedPathCount));
+    if (!retained)
+    {
+        streamToOr(sink, stderr,
+                   QStringLiteral(
+                       "run: per-path comparison omitted; results were "
+                       "streamed to the outputs above\n"));
+        return;
+    }
 
     streamToOr(
         sink, stderr,
@@ -518,24 +534,10 @@ RunCommand::RunCommand(QIODevice *errSink)
 
 RunCommand::WriterHooks RunCommand::defaultWriterHooks()
 {
+    const auto writers = ResultsOutputWriter::defaultFinalWriters();
     return WriterHooks{
         [](const QString &path) { return QDir().mkpath(path); },
-        [](const QString &outputPath,
-           const QList<Backend::Scenario::PathSimulationResult> &results,
-           QString *err,
-           const QHash<QString, Backend::Scenario::PathMetrics> &metrics,
-           const QHash<QString, Backend::Scenario::PathKey> &keys,
-           const QList<Backend::Path *> &paths) {
-            JsonResultsWriter writer;
-            return writer.write(outputPath, results, err, metrics,
-                                keys, paths);
-        },
-        [](const QString &outputPath,
-           const QList<Backend::Scenario::PathSimulationResult> &results,
-           QString *err) {
-            CsvResultsWriter writer;
-            return writer.write(outputPath, results, err);
-        }};
+        writers.writeJson, writers.writeCsv};
 }
 
 int RunCommand::writeOutputs(
@@ -548,9 +550,7 @@ int RunCommand::writeOutputs(
         &pathKeysByCanonicalPath,
     const WriterHooks            &hooks) const
 {
-    const QString outDir = doc.output.directory.isEmpty()
-        ? QDir::currentPath()
-        : doc.output.directory;
+    const QString outDir = outputDirectoryFor(doc);
     if (!hooks.mkpath || !hooks.mkpath(outDir))
     {
         streamToOr(m_err, stderr,
@@ -565,33 +565,25 @@ int RunCommand::writeOutputs(
         emitStatus(m_err,
                    QStringLiteral("writing outputs to %1").arg(outDir));
 
+    const ResultsOutputWriter writer(
+        outDir, predictedMetricsByCanonicalPath, pathKeysByCanonicalPath,
+        paths,
+        ResultsOutputWriter::FinalWriters{hooks.writeJson, hooks.writeCsv});
     bool writerFailed = false;
     for (const auto &fmt : doc.output.formats)
     {
         QString werr;
-        bool    okWrite = true;
-        if (fmt == QLatin1String("json"))
-        {
-            const QString filePath =
-                QDir(outDir).filePath(QStringLiteral("results.json"));
-            qCDebug(lcCli) << "RunCommand::writeOutputs: writing JSON results to"
-                           << filePath;
-            okWrite = hooks.writeJson
-                && hooks.writeJson(filePath, results, &werr,
-                                   predictedMetricsByCanonicalPath,
-                                   pathKeysByCanonicalPath, paths);
-        }
-        else if (fmt == QLatin1String("csv"))
-        {
-            const QString filePath =
-                QDir(outDir).filePath(QStringLiteral("results.csv"));
-            qCDebug(lcCli) << "RunCommand::writeOutputs: writing CSV results to"
-                           << filePath;
-            okWrite = hooks.writeCsv
-                && hooks.writeCsv(filePath, results, &werr);
-        }
-        else
+        switch (writer.writeFinal(fmt, results, &werr))
         {
+        case ResultsOutputWriter::WriteStatus::Written:
+            qCInfo(lcCli)
+                << "RunCommand::writeOutputs: results written, format ="
+                << fmt;
+            break;
+        case ResultsOutputWriter::WriteStatus::Streamed:
+            // Already written record-by-record during the run.
+            break;
+        case ResultsOutputWriter::WriteStatus::UnknownFormat:
             qCWarning(lcCli)
                 << "RunCommand::writeOutputs: unknown output format"
                 << fmt;
@@ -599,22 +591,13 @@ int RunCommand::writeOutputs(
                        QStringLiteral(
                            "run: ignoring unknown output format '%1'\n")
                            .arg(fmt));
-            continue;
-        }
-        if (!okWrite)
-        {
+            break;
+        case ResultsOutputWriter::WriteStatus::Failed:
             writerFailed = true;
-            qCCritical(lcCli) << "RunCommand::writeOutputs: writer"
-                              << fmt << "failed —" << werr;
+            qCCritical(lcCli) << "RunCommand::writeOutputs:" << werr;
             streamToOr(m_err, stderr,
-                       QStringLiteral("run: writer '%1': %2\n")
-                           .arg(fmt, werr));
-        }
-        else
-        {
-            qCInfo(lcCli)
-                << "RunCommand::writeOutputs: results written, format ="
-                << fmt;
+                       QStringLiteral("run: %1\n").arg(werr));
+            break;
         }
     }
 
@@ -650,6 +633,7 @@ int RunCommand::execute(const QStringList &args)
     // ---- 2. Parse + validate -------------------------------------------
     qCDebug(lcCli) << "RunCommand::execute: [stage 2] parsing YAML...";
     Backend::Application::ScenarioLoadService loadService;
+    loadService.setScenarioCacheEnabled(scenarioCacheEnabled());
     auto parseResult =
         loadService.parseAndValidateYaml(opt.scenarioPath);
     if (parseResult.status == Backend::Application::ScenarioLoadServiceStatus::ParseFailed
@@ -683,7 +667,7 @@ int RunCommand::execute(const QStringList &args)
     qCDebug(lcCli) << "RunCommand::execute: YAML parsed — regions ="
                    << doc->regions.size()
                    << ", terminals =" << doc->terminals.size()
-                   << ", linkages =" << doc->linkages.size();
+                   << ", linkages =" << doc->linkages().size();
 
     // ---- 3. Bootstrap controller ---------------------------------------
     qCDebug(lcCli) << "RunCommand::execute: [stage 3] bootstrapping controller...";
@@ -739,6 +723,9 @@ int RunCommand::execute(const QStringList &args)
         emitStatus(m_err, QStringLiteral("discovering candidate paths"));
     Backend::Application::PreparedPathService preparedPathService(
         &ctl);
+    preparedPathService.setDistanceCacheEnabled(scenarioCacheEnabled());
+    preparedPathService.setPathCacheDirectory(
+        topPathCacheDirectory(opt.scenarioPath));
     auto preparedResult =
         preparedPathService.discoverAndPrepare(rt, n);
     if (!preparedResult.succeeded())
@@ -854,6 +841,58 @@ int RunCommand::execute(const QStringList &args)
                          });
     }
 
+    // ---- 7b. Streaming writers -----------------------------------------
+    // NDJSON / columnar outputs are opened before the run and fed per
+    // path from ScenarioRuntime::pathResultReady as each path completes.
+    // When no json/csv output needs the final result set, the runtime is
+    // told not to retain results, so memory stays bounded by the paths
+    // still in flight.
+    const QString outDir = outputDirectoryFor(rt.document());
+    ResultsOutputWriter streams(outDir, predictedMetricsByCanonicalPath,
+                                pathKeysByCanonicalPath, simulationSet);
+    QString streamError;
+    int     streamedPathCount = 0;
+    bool    retainResults     = true;
+    {
+        const auto &formats = rt.document().output.formats;
+        const bool wantsStreams =
+            std::any_of(formats.cbegin(), formats.cend(),
+                        &ResultsOutputWriter::isStreamingFormat);
+        if (wantsStreams && !QDir().mkpath(outDir))
+        {
+            streamToOr(m_err, stderr,
+                       QStringLiteral(
+                           "run: failed to create output directory '%1'\n")
+                           .arg(outDir));
+            return static_cast<int>(ExitCode::RunFailed);
+        }
+        if (!streams.openStreams(formats, &streamError))
+        {
+            streamToOr(m_err, stderr,
+                       QStringLiteral("run: %1\n").arg(streamError));
+            return static_cast<int>(ExitCode::RunFailed);
+        }
+    }
+    if (streams.hasStreams())
+    {
+        retainResults = std::any_of(
+            rt.document().output.formats.cbegin(),
+            rt.document().output.formats.cend(),
+            [](const QString &fmt) {
+                return !ResultsOutputWriter::isStreamingFormat(fmt);
+            });
+        rt.setRetainPathResults(retainResults);
+        QObject::connect(
+            &rt, &ScenarioRuntime::pathResultReady,
+            [&](const PathExecutionResult &result) {
+                ++streamedPathCount;
+                QString werr;
+                if (!streams.appendStreamed(result, &werr)
+                    && streamError.isEmpty())
+                    streamError = werr;
+            });
+    }
+
     // ---- 8. Start + block until completed / failed ---------------------
     qCInfo(lcCli) << "RunCommand::execute: [stage 8] starting simulation...";
     if (m_verbose)
@@ -895,6 +934,21 @@ int RunCommand::execute(const QStringList &args)
 
     // ---- 9. Write outputs ----------------------------------------------
     qCDebug(lcCli) << "RunCommand::execute: [stage 9] writing results...";
+    // Streaming writers only get their footer/trailer on success; a run
+    // that failed above leaves them visibly partial.
+    QString finishError;
+    if (!streams.finishStreams(&finishError) && streamError.isEmpty())
+        streamError = finishError;
+    if (!streamError.isEmpty())
+    {
+        qCCritical(lcCli) << "RunCommand::execute: streaming writer failed —"
+                          << streamError;
+        streamToOr(m_err, stderr,
+                   QStringLiteral("run: streaming %1\n")
+                       .arg(streamError));
+        return static_cast<int>(ExitCode::RunFailed);
+    }
+
     const auto results = rt.results();
     const int writeCode =
         writeOutputs(rt.document(), results, rt.paths(),
@@ -905,7 +959,8 @@ int RunCommand::execute(const QStringList &args)
 
     emitResultsSummary(m_err, rt.document(), results,
                        rt.executionResults(), rt.paths(),
-                       predictedMetricsByCanonicalPath);
+                       predictedMetricsByCanonicalPath,
+                       retainResults ? -1 : streamedPathCount);
 
     qCInfo(lcCli) << "RunCommand::execute: finished — exit code = Success";
     return static_cast<int>(ExitCode::Success);
@@ -44,8 +44,11 @@ namespace Cli {
  *   8. `SimulationRunService::validateAndStart`
  *      — preflight + spawn the executor; then block the calling
  *      thread on a local `QEventLoop` until `completed` or `failed`.
- *   9. `JsonResultsWriter` / `CsvResultsWriter` (Tasks 6 + 7) —
- *      emit `results.{json,csv}` under the YAML's `output.directory`.
+ *   9. `ResultsOutputWriter` (shared with `sweep`) — emits
+ *      `results.{json,csv}` under the YAML's `output.directory`.
+ *      Its NDJSON / columnar streams are opened before stage 8
+ *      instead and fed from `ScenarioRuntime::pathResultReady` as
+ *      each path completes (`results.ndjson`, `results.cnscol`).
  *
  * Argument contract: `run` takes exactly one positional scenario YAML
  * file. `--all` selects every prepared candidate path. `--paths`
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Backend/Scenario/TopPathCache.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QtGlobal>
+
+namespace CargoNetSim {
+namespace Cli {
+
+/**
+ * @brief Whether CLI commands should use the parsed-scenario cache
+ *        (`Backend::Scenario::ScenarioCache`) when parsing a scenario,
+ *        and the on-disk network distance and top-path caches when
+ *        preparing paths.
+ *
+ * On by default. Every cache lives under the per-user cache directory
+ * (`Backend::Scenario::CacheLocation`, `CARGONETSIM_CACHE_DIR` to move
+ * it), never beside the scenario or network files. Setting
+ * `CARGONETSIM_SCENARIO_CACHE=0` (or `off`) forces every command to
+ * re-parse the YAML and write no cache entries — useful when bisecting
+ * a parser problem. Inline for the same reason as `streamToOr`.
+ */
+inline bool scenarioCacheEnabled()
+{
+    const QByteArray value =
+        qgetenv("CARGONETSIM_SCENARIO_CACHE").trimmed().toLower();
+    return value != "0" && value != "off" && value != "false";
+}
+
+/**
+ * @brief `TopPathCache` directory for @p scenarioPath, or empty when
+ *        caching is off.
+ */
+inline QString topPathCacheDirectory(const QString &scenarioPath)
+{
+    return scenarioCacheEnabled()
+               ? Backend::Scenario::TopPathCache::defaultDirectoryFor(
+                     scenarioPath)
+               : QString();
+}
+
+} // namespace Cli
+} // namespace CargoNetSim
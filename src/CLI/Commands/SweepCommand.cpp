@@ -0,0 +1,918 @@
+#include "SweepCommand.h"
+
+#include <QDir>
+#include <QEventLoop>
+#include <QFileInfo>
+#include <QIODevice>
+#include <QScopeGuard>
+#include <QSet>
+#include <QThread>
+#include <QTimer>
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Backend/Application/ParameterSweepService.h"
+#include "Backend/Application/PreparedPathService.h"
+#include "Backend/Application/ScenarioLoadService.h"
+#include "Backend/Application/SimulationRunService.h"
+#include "Backend/Bootstrap/BackendBootstrapService.h"
+#include "Backend/CliApi/ResultsApi.h"
+#include "Backend/CliApi/ScenarioDocumentApi.h"
+#include "Backend/Commons/ClientType.h"
+#include "Backend/Commons/LogCategories.h"
+#include "Backend/Controllers/CargoNetSimController.h"
+#include "Backend/Scenario/ScenarioRuntime.h"
+#include "CLI/Commands/CommandOutput.h"
+#include "CLI/Commands/IssueFormatter.h"
+#include "CLI/Commands/ScenarioCachePolicy.h"
+#include "CLI/ExitCodes.h"
+#include "CLI/Output/ResultsOutputWriter.h"
+#include "CLI/Output/SweepTableWriter.h"
+
+namespace CargoNetSim {
+namespace Cli {
+
+namespace {
+
+/// Argument shape for `sweep`. Every positional argument is a
+/// scenario; `--jobs` caps how many run at once and `--top` overrides
+/// each scenario's discovery count like `run --top`.
+/// `--namespace-clients` lists the simulators whose servers follow the
+/// context namespace (truck only by default). Any `--vary` switches to
+/// a parameter sweep of a single scenario, simulating the best
+/// `--select` paths of each OD pair per grid point.
+struct Options
+{
+    QStringList                       scenarioPaths;
+    QString                           namespacePrefix = QStringLiteral("sweep");
+    QList<Backend::ClientType>        namespacedClients{
+        Backend::ClientType::TruckClient};
+    bool                              verbose = false;
+    bool                              hasTopOverride = false;
+    int                               topOverride = 0;
+    int                               jobs = 0;
+    bool                              jobsExplicit = false;
+    int                               selectPerPair = 1;
+    Backend::Scenario::ParameterGrid  grid;
+};
+
+bool parsePositiveIntOption(const QString &optionName,
+                            const QString &value,
+                            int           *parsed,
+                            QString       *err)
+{
+    bool ok = false;
+    const int result = value.toInt(&ok);
+    if (!ok || result <= 0)
+    {
+        *err = QStringLiteral(
+                   "sweep: %1 requires a positive integer\n")
+                   .arg(optionName);
+        return false;
+    }
+
+    *parsed = result;
+    return true;
+}
+
+bool parseNamespacedClients(const QString              &value,
+                            QList<Backend::ClientType> *clients,
+                            QString                    *err)
+{
+    using Backend::ClientType;
+    static const QList<QPair<QString, ClientType>> kNames = {
+        {QStringLiteral("truck"), ClientType::TruckClient},
+        {QStringLiteral("ship"), ClientType::ShipClient},
+        {QStringLiteral("train"), ClientType::TrainClient},
+        {QStringLiteral("terminal"), ClientType::TerminalClient}};
+
+    clients->clear();
+    for (const QString &name :
+         value.split(QLatin1Char(','), Qt::SkipEmptyParts))
+    {
+        const QString key = name.trimmed().toLower();
+        bool known = false;
+        for (const auto &entry : kNames)
+        {
+            if (key == QLatin1String("all") || key == entry.first)
+            {
+                known = true;
+                if (!clients->contains(entry.second))
+                    clients->append(entry.second);
+            }
+        }
+        if (!known)
+        {
+            *err = QStringLiteral(
+                       "sweep: --namespace-clients: unknown client '%1' "
+                       "(expected truck, ship, train, terminal or all)\n")
+                       .arg(name);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parseArgs(const QStringList &args, Options &o, QString *err)
+{
+    for (int i = 0; i < args.size(); ++i)
+    {
+        const QString &arg = args.at(i);
+        if (arg == QLatin1String("--verbose"))
+        {
+            o.verbose = true;
+            continue;
+        }
+        if (arg == QLatin1String("--jobs") || arg == QLatin1String("--top"))
+        {
+            if (i + 1 >= args.size())
+            {
+                *err = QStringLiteral(
+                           "sweep: %1 requires a positive integer\n")
+                           .arg(arg);
+                return false;
+            }
+            const bool isJobs = arg == QLatin1String("--jobs");
+            if (!parsePositiveIntOption(
+                    arg, args.at(++i),
+                    isJobs ? &o.jobs : &o.topOverride, err))
+                return false;
+            if (isJobs)
+                o.jobsExplicit = true;
+            else
+                o.hasTopOverride = true;
+            continue;
+        }
+        if (arg.startsWith(QLatin1String("--jobs=")))
+        {
+            if (!parsePositiveIntOption(
+                    QStringLiteral("--jobs"),
+                    arg.mid(QStringLiteral("--jobs=").size()),
+                    &o.jobs, err))
+                return false;
+            o.jobsExplicit = true;
+            continue;
+        }
+        if (arg.startsWith(QLatin1String("--top=")))
+        {
+            if (!parsePositiveIntOption(
+                    QStringLiteral("--top"),
+                    arg.mid(QStringLiteral("--top=").size()),
+                    &o.topOverride, err))
+                return false;
+            o.hasTopOverride = true;
+            continue;
+        }
+        if (arg == QLatin1String("--select"))
+        {
+            if (i + 1 >= args.size())
+            {
+                *err = QStringLiteral(
+                    "sweep: --select requires a positive integer\n");
+                return false;
+            }
+            if (!parsePositiveIntOption(QStringLiteral("--select"),
+                                        args.at(++i), &o.selectPerPair,
+                                        err))
+                return false;
+            continue;
+        }
+        if (arg == QLatin1String("--vary")
+            || arg.startsWith(QLatin1String("--vary=")))
+        {
+            QString spec;
+            if (arg == QLatin1String("--vary"))
+            {
+                if (i + 1 >= args.size())
+                {
+                    *err = QStringLiteral(
+                        "sweep: --vary requires KEY=V1,V2,... "
+                        "or KEY=START:STOP:STEP\n");
+                    return false;
+                }
+                spec = args.at(++i);
+            }
+            else
+            {
+                spec = arg.mid(QStringLiteral("--vary=").size());
+            }
+            Backend::Scenario::ParameterSweepAxis axis;
+            QString                               axisError;
+            if (!Backend::Scenario::ParameterGrid::parseAxis(
+                    spec, &axis, &axisError)
+                || !o.grid.addAxis(axis, &axisError))
+            {
+                *err = QStringLiteral("sweep: --vary: %1\n").arg(axisError);
+                return false;
+            }
+            continue;
+        }
+        if (arg == QLatin1String("--namespace-prefix"))
+        {
+            if (i + 1 >= args.size() || args.at(i + 1).isEmpty())
+            {
+                *err = QStringLiteral(
+                    "sweep: --namespace-prefix requires a value\n");
+                return false;
+            }
+            o.namespacePrefix = args.at(++i);
+            continue;
+        }
+        if (arg == QLatin1String("--namespace-clients"))
+        {
+            if (i + 1 >= args.size())
+            {
+                *err = QStringLiteral(
+                    "sweep: --namespace-clients requires a list\n");
+                return false;
+            }
+            if (!parseNamespacedClients(args.at(++i),
+                                        &o.namespacedClients, err))
+                return false;
+            continue;
+        }
+        if (arg.startsWith(QLatin1Char('-')))
+        {
+            *err = QStringLiteral(
+                       "sweep: unsupported flag '%1' "
+                       "(supported: --jobs N, --top N, --vary SPEC, "
+                       "--select N, --namespace-prefix P, "
+                       "--namespace-clients LIST, --verbose)\n")
+                       .arg(arg);
+            return false;
+        }
+        o.scenarioPaths.append(arg);
+    }
+
+    if (o.scenarioPaths.isEmpty())
+    {
+        *err = QStringLiteral(
+            "sweep: expected at least one scenario argument\n");
+        return false;
+    }
+    if (!o.grid.isEmpty() && o.scenarioPaths.size() != 1)
+    {
+        *err = QStringLiteral(
+            "sweep: --vary sweeps exactly one scenario\n");
+        return false;
+    }
+    if (o.jobs == 0)
+        o.jobs = std::max(1, QThread::idealThreadCount());
+    return true;
+}
+
+/// Contexts whose clients share un-namespaced queues would consume
+/// each other's replies, so they run one at a time unless every
+/// client is namespaced.
+bool allClientsNamespaced(const Options &o)
+{
+    using Backend::ClientType;
+    for (ClientType type :
+         {ClientType::TruckClient, ClientType::ShipClient,
+          ClientType::TrainClient, ClientType::TerminalClient})
+    {
+        if (!o.namespacedClients.contains(type))
+            return false;
+    }
+    return true;
+}
+
+ExitCode exitCodeForRunServiceFailure(
+    Backend::Application::SimulationRunServiceStatus status)
+{
+    using Status =
+        Backend::Application::SimulationRunServiceStatus;
+
+    switch (status)
+    {
+    case Status::InvalidSelection:
+        return ExitCode::BadArgs;
+    case Status::ValidationFailed:
+        return ExitCode::ConnectTimeout;
+    case Status::StartFailed:
+        return ExitCode::RunFailed;
+    case Status::Success:
+        return ExitCode::Success;
+    }
+
+    return ExitCode::RunFailed;
+}
+
+/// One scenario of the sweep and the runtime context it owns while
+/// it is running. The runtime is destroyed before the controller it
+/// was bound to.
+struct SweepJob
+{
+    enum class State
+    {
+        Pending,
+        Running,
+        Finished
+    };
+
+    QString  scenarioPath;
+    QString  contextName;
+    State    state = State::Pending;
+    ExitCode exitCode = ExitCode::Success;
+    QString  outputDirectory;
+    int      pathCount = 0;
+
+    std::unique_ptr<CargoNetSimController>             controller;
+    std::unique_ptr<Backend::Scenario::ScenarioRuntime> runtime;
+    QHash<QString, Backend::Scenario::PathMetrics>      predictedMetrics;
+    QHash<QString, Backend::Scenario::PathKey>          pathKeys;
+};
+
+/// Drives the jobs: starts pending ones while fewer than `jobs` are
+/// running, collects results as runtimes finish and quits the loop
+/// once nothing is left.
+class SweepSession
+{
+public:
+    SweepSession(const Options &options, QIODevice *err)
+        : m_options(options)
+        , m_err(err)
+    {
+        m_jobs.reserve(options.scenarioPaths.size());
+        for (int i = 0; i < options.scenarioPaths.size(); ++i)
+        {
+            auto job = std::make_unique<SweepJob>();
+            job->scenarioPath = options.scenarioPaths.at(i);
+            job->contextName =
+                QStringLiteral("%1-%2")
+                    .arg(options.namespacePrefix)
+                    .arg(i + 1);
+            m_jobs.push_back(std::move(job));
+        }
+    }
+
+    int exec()
+    {
+        QTimer::singleShot(0, &m_loop, [this] { pump(); });
+        m_loop.exec();
+
+        for (const auto &job : m_jobs)
+        {
+            if (job->exitCode != ExitCode::Success)
+                return static_cast<int>(job->exitCode);
+        }
+        return static_cast<int>(ExitCode::Success);
+    }
+
+private:
+    void status(const SweepJob &job, const QString &message) const
+    {
+        streamToOr(m_err, stderr,
+                   QStringLiteral("sweep: [%1] %2\n")
+                       .arg(job.contextName, message));
+    }
+
+    void fail(SweepJob &job, ExitCode code, const QString &message)
+    {
+        qCWarning(lcCli) << "SweepCommand: scenario" << job.scenarioPath
+                         << "failed —" << message;
+        status(job, QStringLiteral("%1: %2")
+                        .arg(job.scenarioPath, message));
+        job.exitCode = code;
+        job.state = SweepJob::State::Finished;
+    }
+
+    void pump()
+    {
+        // Bootstrapping a context waits for its simulators in a nested
+        // event loop, so other jobs can finish while we are in here.
+        // The loop below re-reads m_running, so the outer call picks
+        // up any slot they free.
+        if (m_pumping)
+            return;
+        m_pumping = true;
+
+        for (auto &job : m_jobs)
+        {
+            if (m_running >= m_options.jobs)
+                break;
+            if (job->state != SweepJob::State::Pending)
+                continue;
+            if (prepare(*job))
+                ++m_running;
+            else
+                release(*job);
+        }
+
+        m_pumping = false;
+        if (m_running == 0
+            && std::none_of(m_jobs.begin(), m_jobs.end(),
+                            [](const auto &job) {
+                                return job->state
+                                    == SweepJob::State::Pending;
+                            }))
+            m_loop.quit();
+    }
+
+    /// Everything up to and including the simulation start, on the
+    /// main thread. Every service is handed the job's controller.
+    bool prepare(SweepJob &job)
+    {
+        using namespace Backend::Scenario;
+
+        job.state = SweepJob::State::Running;
+        job.controller = std::make_unique<CargoNetSimController>(
+            job.contextName, /*logger=*/nullptr);
+        job.controller->setNamespacedClients(m_options.namespacedClients);
+
+        Backend::Application::ScenarioLoadService loadService(
+            job.controller.get());
+        loadService.setScenarioCacheEnabled(scenarioCacheEnabled());
+        auto parseResult =
+            loadService.parseAndValidateYaml(job.scenarioPath);
+        if (!parseResult.succeeded())
+        {
+            bool hasError = false;
+            const QString issues =
+                formatValidationIssues(parseResult.issues, &hasError);
+            if (!issues.isEmpty())
+                streamToOr(m_err, stderr, issues);
+            fail(job, ExitCode::ValidationFailed,
+                 parseResult.message.isEmpty()
+                     ? QStringLiteral("validation failed")
+                     : parseResult.message);
+            return false;
+        }
+
+        Backend::BackendBootstrapService bootstrapService(
+            job.controller.get());
+        const auto bootstrapResult =
+            bootstrapService.initializeAndStartController(QString());
+        if (!bootstrapResult.succeeded())
+        {
+            fail(job, ExitCode::ConnectTimeout,
+                 bootstrapResult.message.isEmpty()
+                     ? QStringLiteral("backend bootstrap failed")
+                     : bootstrapResult.message);
+            return false;
+        }
+
+        auto loadResult = loadService.loadValidatedDocument(
+            std::move(parseResult.document));
+        if (!loadResult.succeeded())
+        {
+            fail(job, ExitCode::RunFailed,
+                 QStringLiteral("scenario apply failed: %1")
+                     .arg(loadResult.message));
+            return false;
+        }
+        job.runtime = std::move(loadResult.runtime);
+        ScenarioRuntime &rt = *job.runtime;
+
+        const int n = m_options.hasTopOverride
+            ? m_options.topOverride
+            : job.controller->getSimulationParams()
+                  .value("shortest_paths", 5).toInt();
+        Backend::Application::PreparedPathService preparedPathService(
+            job.controller.get());
+        preparedPathService.setDistanceCacheEnabled(
+            scenarioCacheEnabled());
+        preparedPathService.setPathCacheDirectory(
+            topPathCacheDirectory(job.scenarioPath));
+        auto preparedResult =
+            preparedPathService.discoverAndPrepare(rt, n);
+        if (!preparedResult.succeeded())
+        {
+            fail(job,
+                 preparedResult.status
+                         == Backend::Application::
+                             PreparedPathServiceStatus::BackendUnavailable
+                     ? ExitCode::ConnectTimeout
+                     : ExitCode::RunFailed,
+                 QStringLiteral("path discovery failed: %1")
+                     .arg(preparedResult.message));
+            return false;
+        }
+
+        auto prepared = std::move(preparedResult.preparedPaths);
+        rt.setPreparedPaths(prepared);
+        job.predictedMetrics = prepared.predictedMetricsByCanonicalPath();
+        job.pathKeys = prepared.pathKeysByCanonicalPath();
+
+        Backend::Application::SimulationRunService runService;
+        const auto selectionResult = runService.selectAndValidate(
+            rt, prepared.executionPathKeys(),
+            ExecutionDemandPolicy::DuplicateDemandPerSelectedPath);
+        if (!selectionResult.succeeded() || rt.paths().isEmpty())
+        {
+            fail(job,
+                 selectionResult.succeeded()
+                     ? ExitCode::RunFailed
+                     : exitCodeForRunServiceFailure(
+                           selectionResult.status),
+                 selectionResult.message.isEmpty()
+                     ? QStringLiteral("no paths selected for simulation")
+                     : selectionResult.message);
+            return false;
+        }
+        job.pathCount = rt.paths().size();
+
+        SweepJob *jobPtr = &job;
+        QObject::connect(&rt, &ScenarioRuntime::completed, &m_loop,
+                         [this, jobPtr] { finish(*jobPtr, QString()); });
+        QObject::connect(&rt, &ScenarioRuntime::failed, &m_loop,
+                         [this, jobPtr](const QString &message) {
+                             finish(*jobPtr,
+                                    message.isEmpty()
+                                        ? QStringLiteral("simulation failed")
+                                        : message);
+                         });
+        if (m_options.verbose)
+        {
+            QObject::connect(&rt, &ScenarioRuntime::statusMessage,
+                             &m_loop, [this, jobPtr](const QString &m) {
+                                 status(*jobPtr, m);
+                             });
+        }
+
+        const auto startResult = runService.validateAndStart(rt);
+        if (!startResult.succeeded())
+        {
+            fail(job, exitCodeForRunServiceFailure(startResult.status),
+                 startResult.message.isEmpty()
+                     ? QStringLiteral("failed to start simulation")
+                     : startResult.message);
+            return false;
+        }
+
+        status(job, QStringLiteral("%1: simulating %2 path(s)")
+                        .arg(job.scenarioPath)
+                        .arg(job.pathCount));
+        return true;
+    }
+
+    void finish(SweepJob &job, const QString &failure)
+    {
+        if (job.state != SweepJob::State::Running)
+            return;
+
+        if (failure.isEmpty())
+        {
+            QString err;
+            if (writeOutputs(job, &err))
+            {
+                job.state = SweepJob::State::Finished;
+                status(job, QStringLiteral("%1: %2 path(s) simulated, "
+                                           "results saved to %3")
+                                .arg(job.scenarioPath)
+                                .arg(job.pathCount)
+                                .arg(job.outputDirectory));
+            }
+            else
+            {
+                fail(job, ExitCode::RunFailed, err);
+            }
+        }
+        else
+        {
+            fail(job, ExitCode::RunFailed, failure);
+        }
+
+        // The runtime is still inside the emit that got us here;
+        // tear the context down once control is back in the loop.
+        --m_running;
+        SweepJob *jobPtr = &job;
+        QTimer::singleShot(0, &m_loop, [this, jobPtr] {
+            release(*jobPtr);
+            pump();
+        });
+    }
+
+    void release(SweepJob &job)
+    {
+        job.runtime.reset();
+        job.controller.reset();
+    }
+
+    /// The scenario's own output directory, unless an earlier job of
+    /// this sweep already wrote there; then a `<context>` subdirectory.
+    QString outputDirectoryFor(const SweepJob &job)
+    {
+        const auto &doc = job.runtime->document();
+        const QString base = QDir(doc.output.directory.isEmpty()
+                                      ? QDir::currentPath()
+                                      : doc.output.directory)
+                                 .absolutePath();
+        if (!m_usedOutputDirectories.contains(base))
+        {
+            m_usedOutputDirectories.insert(base);
+            return base;
+        }
+        return QDir(base).filePath(job.contextName);
+    }
+
+    bool writeOutputs(SweepJob &job, QString *err)
+    {
+        const auto &rt = *job.runtime;
+        const auto &doc = rt.document();
+        job.outputDirectory = outputDirectoryFor(job);
+        if (!QDir().mkpath(job.outputDirectory))
+        {
+            *err = QStringLiteral("failed to create output directory '%1'")
+                       .arg(job.outputDirectory);
+            return false;
+        }
+
+        ResultsOutputWriter writer(job.outputDirectory,
+                                   job.predictedMetrics, job.pathKeys,
+                                   rt.paths());
+        // Streamed formats are written in one pass from the final
+        // result set; a sweep has no single terminal to watch partial
+        // output on.
+        if (!writer.openStreams(doc.output.formats, err))
+            return false;
+        for (const auto &result : rt.executionResults().pathResults())
+        {
+            if (!writer.appendStreamed(result, err))
+                return false;
+        }
+        if (!writer.finishStreams(err))
+            return false;
+
+        const auto results = rt.results();
+        for (const auto &fmt : doc.output.formats)
+        {
+            const auto written = writer.writeFinal(fmt, results, err);
+            if (written == ResultsOutputWriter::WriteStatus::Failed)
+                return false;
+            if (written == ResultsOutputWriter::WriteStatus::UnknownFormat)
+                status(job, QStringLiteral(
+                                "ignoring unknown output format '%1'")
+                                .arg(fmt));
+        }
+        return true;
+    }
+
+    const Options                         &m_options;
+    QIODevice                             *m_err;
+    QEventLoop                             m_loop;
+    std::vector<std::unique_ptr<SweepJob>> m_jobs;
+    QSet<QString>                          m_usedOutputDirectories;
+    int                                    m_running = 0;
+    bool                                   m_pumping = false;
+};
+
+/// Run @p starter and block until @p rt completes or fails; the same
+/// idiom as `run`.
+bool waitForSimulationEnd(Backend::Scenario::ScenarioRuntime &rt,
+                          QString                            *failMsg,
+                          const std::function<bool()>       &starter)
+{
+    QEventLoop loop;
+    bool       completed = false;
+    bool       failed    = false;
+
+    QObject::connect(&rt, &Backend::Scenario::ScenarioRuntime::completed,
+                     &loop, [&] {
+                         completed = true;
+                         loop.quit();
+                     });
+    QObject::connect(&rt, &Backend::Scenario::ScenarioRuntime::failed,
+                     &loop, [&](const QString &m) {
+                         failed = true;
+                         *failMsg = m;
+                         loop.quit();
+                     });
+
+    if (!starter())
+        return false;
+
+    if (!completed && !failed)
+        loop.exec();
+    return completed && !failed;
+}
+
+/// `sweep --vary ...`: one scenario, one discovery, one preparation;
+/// every grid point re-scores the prepared paths and only variants
+/// whose selected path set is new are simulated. Writes `sweep.csv`
+/// into the scenario's output directory.
+int runParameterSweep(const Options &opt, QIODevice *errSink)
+{
+    using namespace Backend::Scenario;
+
+    const auto status = [errSink](const QString &message) {
+        streamToOr(errSink, stderr,
+                   QStringLiteral("sweep: %1\n").arg(message));
+    };
+    const QString scenarioPath = opt.scenarioPaths.first();
+
+    Backend::Application::ScenarioLoadService loadService;
+    loadService.setScenarioCacheEnabled(scenarioCacheEnabled());
+    auto parseResult = loadService.parseAndValidateYaml(scenarioPath);
+    if (!parseResult.succeeded())
+    {
+        bool hasError = false;
+        const QString issues =
+            formatValidationIssues(parseResult.issues, &hasError);
+        if (!issues.isEmpty())
+            streamToOr(errSink, stderr, issues);
+        status(QStringLiteral("failed to validate %1").arg(scenarioPath));
+        return static_cast<int>(ExitCode::ValidationFailed);
+    }
+
+    auto &ctl = CargoNetSim::CargoNetSimController::getInstance();
+    Backend::BackendBootstrapService bootstrapService;
+    const auto bootstrapResult =
+        bootstrapService.initializeAndStartController(QString());
+    if (!bootstrapResult.succeeded())
+    {
+        status(bootstrapResult.message.isEmpty()
+                   ? QStringLiteral("backend bootstrap failed")
+                   : bootstrapResult.message);
+        return static_cast<int>(ExitCode::ConnectTimeout);
+    }
+    auto ctlGuard = qScopeGuard([&ctl] { ctl.stopAll(); });
+
+    auto loadResult =
+        loadService.loadValidatedDocument(std::move(parseResult.document));
+    if (!loadResult.succeeded())
+    {
+        status(QStringLiteral("scenario apply failed: %1")
+                   .arg(loadResult.message));
+        return static_cast<int>(ExitCode::RunFailed);
+    }
+    ScenarioRuntime &rt = *loadResult.runtime;
+
+    // ---- Shared preparation: discovery, distances, physics -----------
+    const int n = opt.hasTopOverride
+        ? opt.topOverride
+        : ctl.getSimulationParams().value("shortest_paths", 5).toInt();
+    Backend::Application::PreparedPathService preparedPathService(&ctl);
+    preparedPathService.setDistanceCacheEnabled(scenarioCacheEnabled());
+    preparedPathService.setPathCacheDirectory(
+        topPathCacheDirectory(scenarioPath));
+    auto preparedResult = preparedPathService.discoverAndPrepare(rt, n);
+    if (!preparedResult.succeeded())
+    {
+        status(QStringLiteral("path discovery failed: %1")
+                   .arg(preparedResult.message));
+        return static_cast<int>(
+            preparedResult.status
+                    == Backend::Application::PreparedPathServiceStatus::
+                        BackendUnavailable
+                ? ExitCode::ConnectTimeout
+                : ExitCode::RunFailed);
+    }
+    rt.setPreparedPaths(preparedResult.preparedPaths);
+
+    // ---- Re-score per grid point ---------------------------------------
+    Backend::Application::ParameterSweepService sweepService(&ctl);
+    auto restoreConfig =
+        qScopeGuard([&sweepService] { sweepService.restoreBaseConfig(); });
+    const auto sweep =
+        sweepService.evaluate(rt, opt.grid, opt.selectPerPair);
+    if (!sweep.succeeded())
+    {
+        status(sweep.message);
+        return static_cast<int>(ExitCode::RunFailed);
+    }
+    status(QStringLiteral("%1 grid point(s) over %2 prepared path(s); "
+                          "%3 distinct selection(s) to simulate")
+               .arg(sweep.variants.size())
+               .arg(preparedResult.preparedPathCount)
+               .arg(sweep.simulatedVariantCount));
+
+    // ---- Simulate each distinct selection once -------------------------
+    Backend::Application::SimulationRunService runService;
+    QHash<int, QList<Backend::Scenario::PathExecutionResult>>
+        simulatedResults;
+    ExitCode exitCode = ExitCode::Success;
+    for (const auto &variant : sweep.variants)
+    {
+        if (!variant.needsSimulation())
+            continue;
+
+        sweepService.applyVariant(variant);
+        const auto selection = runService.selectAndValidate(
+            rt, variant.selectedExecutionPathKeys,
+            ExecutionDemandPolicy::DuplicateDemandPerSelectedPath);
+        QString failMsg = selection.message;
+        const bool ok =
+            selection.succeeded()
+            && waitForSimulationEnd(rt, &failMsg, [&] {
+                   const auto start = runService.validateAndStart(rt);
+                   if (!start.succeeded())
+                       failMsg = start.message;
+                   return start.succeeded();
+               });
+        if (!ok)
+        {
+            status(QStringLiteral("variant %1 failed: %2")
+                       .arg(variant.index)
+                       .arg(failMsg));
+            exitCode = ExitCode::RunFailed;
+            continue;
+        }
+
+        simulatedResults.insert(variant.index,
+                                rt.executionResults().pathResults());
+        if (opt.verbose)
+            status(QStringLiteral("variant %1 simulated (%2 path(s))")
+                       .arg(variant.index)
+                       .arg(variant.selectedExecutionPathKeys.size()));
+    }
+
+    // Variants sharing a run price its actual metrics with their own
+    // weights; variant indices equal their position in the list.
+    QHash<int, QHash<QString, double>> simulatedTotalCosts;
+    for (const auto &variant : sweep.variants)
+    {
+        const auto results =
+            simulatedResults.constFind(variant.simulatedByVariant);
+        if (results == simulatedResults.constEnd())
+            continue;
+        simulatedTotalCosts.insert(
+            variant.index,
+            Backend::Scenario::ParameterSweep::simulatedTotalCosts(
+                variant, sweep.variants.at(variant.simulatedByVariant),
+                results.value()));
+    }
+
+    // ---- Consolidated table --------------------------------------------
+    const auto &doc = rt.document();
+    const QString outDir = doc.output.directory.isEmpty()
+        ? QDir::currentPath()
+        : doc.output.directory;
+    if (!QDir().mkpath(outDir))
+    {
+        status(QStringLiteral("failed to create output directory '%1'")
+                   .arg(outDir));
+        return static_cast<int>(ExitCode::RunFailed);
+    }
+    QStringList parameterKeys;
+    for (const auto &axis : opt.grid.axes())
+        parameterKeys.append(axis.key);
+
+    const QString tablePath =
+        QDir(outDir).filePath(QStringLiteral("sweep.csv"));
+    QString werr;
+    SweepTableWriter writer;
+    if (!writer.write(tablePath, parameterKeys, sweep.variants,
+                      simulatedTotalCosts, &werr))
+    {
+        status(QStringLiteral("writer 'sweep': %1").arg(werr));
+        return static_cast<int>(ExitCode::RunFailed);
+    }
+    status(QStringLiteral("results saved to %1")
+               .arg(QFileInfo(tablePath).absoluteFilePath()));
+    return static_cast<int>(exitCode);
+}
+
+} // namespace
+
+SweepCommand::SweepCommand(QIODevice *errSink)
+    : m_err(errSink)
+{
+}
+
+int SweepCommand::execute(const QStringList &args)
+{
+    qCInfo(lcCli) << "SweepCommand::execute: entry, args =" << args;
+
+    Options opt;
+    QString err;
+    if (!parseArgs(args, opt, &err))
+    {
+        qCWarning(lcCli) << "SweepCommand::execute: bad arguments —"
+                         << err.trimmed();
+        streamToOr(m_err, stderr, err);
+        return static_cast<int>(ExitCode::BadArgs);
+    }
+    qCInfo(lcCli) << "SweepCommand::execute:" << opt.scenarioPaths.size()
+                  << "scenario(s), jobs =" << opt.jobs;
+
+    if (!opt.grid.isEmpty())
+        return runParameterSweep(opt, m_err);
+
+    if (opt.jobs > 1 && !allClientsNamespaced(opt))
+    {
+        if (opt.jobsExplicit)
+        {
+            streamToOr(m_err, stderr,
+                       QStringLiteral(
+                           "sweep: --jobs %1 needs every simulator server "
+                           "to follow the context namespace "
+                           "(--namespace-clients all); running one "
+                           "scenario at a time\n")
+                           .arg(opt.jobs));
+        }
+        opt.jobs = 1;
+    }
+
+    SweepSession session(opt, m_err);
+    const int rc = session.exec();
+    qCInfo(lcCli) << "SweepCommand::execute: finished — exit code =" << rc;
+    return rc;
+}
+
+} // namespace Cli
+} // namespace CargoNetSim
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QString>
+
+#include "CLI/Subcommand.h"
+
+class QIODevice;
+
+namespace CargoNetSim {
+namespace Cli {
+
+/**
+ * @brief `cargonetsim-cli sweep <scenario.yml>...` — run many scenarios
+ *        concurrently inside one process.
+ *
+ * Every scenario gets its own named `CargoNetSimController` runtime
+ * context (`<prefix>-<n>`): its own simulator clients and its own
+ * configuration. Setup — parse, bootstrap, apply, discovery and
+ * selection — runs on the main thread, with the context's controller
+ * passed to every service; the simulations themselves then run side
+ * by side on their runtimes' worker threads. At most `--jobs N`
+ * contexts are alive at a time.
+ *
+ * Only the clients named by `--namespace-clients` (default: truck,
+ * whose simulator is launched with `--amq_namespace`) use
+ * context-namespaced queues and routing keys. Contexts sharing any
+ * un-namespaced client would read each other's replies, so they run
+ * one at a time unless every client is namespaced.
+ *
+ * Each scenario simulates every discovered path (as `run --all`) and
+ * writes the formats listed in its `output.formats`. When two
+ * scenarios share an output directory, each writes into a
+ * `<context>` subdirectory of it instead.
+ *
+ * Exit code is Success only if every scenario succeeded; otherwise
+ * the code of the first failure in argument order.
+ *
+ * Parameter sweep: with one or more `--vary KEY=VALUES` the command
+ * takes a single scenario and sweeps the grid of those values over
+ * it. Discovery, distances and estimated physics run once; each grid
+ * point only re-scores and re-ranks the prepared paths
+ * (`ParameterSweepService`) and selects the best `--select N` per OD
+ * pair. Variants that select a path set already simulated reuse that
+ * run. Every variant and path ends up as one row of `sweep.csv` in
+ * the scenario's output directory (`SweepTableWriter`).
+ */
+class SweepCommand : public Subcommand
+{
+public:
+    explicit SweepCommand(QIODevice *errSink = nullptr);
+
+    int execute(const QStringList &args) override;
+
+private:
+    QIODevice *m_err;  // not owned; nullptr → write to stderr
+};
+
+} // namespace Cli
+} // namespace CargoNetSim
@@ -11,6 +11,7 @@
 #include "Backend/Commons/LogCategories.h"
 #include "CLI/Commands/CommandOutput.h"
 #include "CLI/Commands/IssueFormatter.h"
+#include "CLI/Commands/ScenarioCachePolicy.h"
 #include "CLI/ExitCodes.h"
 
 namespace CargoNetSim {
@@ -18,6 +19,11 @@ namespace Cli {
 
 namespace {
 
+/// Without --all-errors, validation stops after this many errors. The
+/// grouped summary is all a user sees at that point anyway, and CI runs
+/// on broken scenarios finish in a fraction of the time.
+constexpr int kDefaultErrorBudget = 100;
+
 struct ValidateOptions
 {
     QString scenarioPath;
@@ -88,6 +94,9 @@ int ValidateCommand::execute(const QStringList &args)
     qCInfo(lcCli) << "ValidateCommand::execute: scenario path =" << path;
 
     Backend::Application::ScenarioLoadService loadService;
+    loadService.setScenarioCacheEnabled(scenarioCacheEnabled());
+    if (!options.allErrors)
+        loadService.setValidationErrorBudget(kDefaultErrorBudget);
     auto parseResult = loadService.parseAndValidateYaml(path);
     if (parseResult.status
         == Backend::Application::ScenarioLoadServiceStatus::ParseFailed
@@ -110,7 +119,7 @@ int ValidateCommand::execute(const QStringList &args)
         qCDebug(lcCli) << "ValidateCommand::execute: parsed doc — regions ="
                        << parseResult.document->regions.size()
                        << ", terminals =" << parseResult.document->terminals.size()
-                       << ", linkages =" << parseResult.document->linkages.size();
+                       << ", linkages =" << parseResult.document->linkages().size();
     }
 
     // Format issues via the shared helper so validate/preview/run/discover
@@ -123,6 +132,14 @@ int ValidateCommand::execute(const QStringList &args)
             validationIssueFormatOptions(options.allErrors));
     if (!buffer.isEmpty())
         streamToOr(m_err, stderr, buffer);
+    if (parseResult.issuesTruncated)
+    {
+        streamToOr(m_err, stderr,
+                   QStringLiteral(
+                       "Stopped after the first %1 errors; use "
+                       "--all-errors for the complete list.\n")
+                       .arg(kDefaultErrorBudget));
+    }
 
     qCInfo(lcCli) << "ValidateCommand::execute: validation"
                   << (hasError ? "FAILED" : "PASSED")
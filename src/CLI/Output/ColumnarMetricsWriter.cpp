@@ -0,0 +1,353 @@
+#include "ColumnarMetricsWriter.h"
+#include "Backend/Commons/LogCategories.h"
+
+#include <QDataStream>
+#include <QIODevice>
+
+namespace CargoNetSim {
+namespace Cli {
+
+namespace
+{
+
+using Column     = ColumnarMetricsWriter::Column;
+using ColumnType = ColumnarMetricsWriter::ColumnType;
+
+/// Column order is part of the published layout — append only.
+QList<Column> defaultColumns()
+{
+    const QList<QPair<const char *, ColumnType>> spec = {
+        {"path_id", ColumnType::Int32},
+        {"rank", ColumnType::Int32},
+        {"canonical_path_key", ColumnType::Utf8},
+        {"origin", ColumnType::Utf8},
+        {"destination", ColumnType::Utf8},
+        {"effective_container_count", ColumnType::Int32},
+        {"segment_count", ColumnType::Int32},
+        {"total_cost", ColumnType::Float64},
+        {"edge_costs", ColumnType::Float64},
+        {"terminal_costs", ColumnType::Float64},
+        {"modeled_actual_terminal_costs", ColumnType::Float64},
+        {"actual_distance_m", ColumnType::Float64},
+        {"actual_travel_time_s", ColumnType::Float64},
+        {"actual_energy_kwh", ColumnType::Float64},
+        {"actual_carbon_t", ColumnType::Float64},
+        {"actual_risk", ColumnType::Float64},
+        {"predicted_distance_km", ColumnType::Float64},
+        {"predicted_travel_time_h", ColumnType::Float64},
+    };
+
+    QList<Column> columns;
+    columns.reserve(spec.size());
+    for (const auto &entry : spec)
+    {
+        Column c;
+        c.name = QString::fromLatin1(entry.first);
+        c.type = entry.second;
+        columns.append(c);
+    }
+    return columns;
+}
+
+void configureStream(QDataStream &ds)
+{
+    ds.setByteOrder(QDataStream::LittleEndian);
+    ds.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+void writeUtf8(QDataStream &ds, const QString &value)
+{
+    const QByteArray bytes = value.toUtf8();
+    ds << static_cast<quint32>(bytes.size());
+    ds.writeRawData(bytes.constData(), bytes.size());
+}
+
+bool readUtf8(QDataStream &ds, QString *value)
+{
+    quint32 len = 0;
+    ds >> len;
+    if (ds.status() != QDataStream::Ok)
+        return false;
+    // The length comes from the file; never allocate past what is left.
+    if (!ds.device()
+        || static_cast<qint64>(len) > ds.device()->bytesAvailable())
+    {
+        ds.setStatus(QDataStream::ReadCorruptData);
+        return false;
+    }
+    QByteArray bytes(static_cast<qsizetype>(len), Qt::Uninitialized);
+    if (ds.readRawData(bytes.data(), static_cast<int>(len))
+        != static_cast<int>(len))
+        return false;
+    *value = QString::fromUtf8(bytes);
+    return true;
+}
+
+} // namespace
+
+ColumnarMetricsWriter::ColumnarMetricsWriter(
+    const QHash<QString, Backend::Scenario::PathMetrics> &metrics,
+    int                                                   rowGroupSize)
+    : m_columns(defaultColumns())
+    , m_metrics(metrics)
+    , m_rowGroupSize(qMax(1, rowGroupSize))
+{
+}
+
+bool ColumnarMetricsWriter::open(const QString &outputPath, QString *err)
+{
+    qCInfo(lcCli) << "ColumnarMetricsWriter::open: path" << outputPath
+                  << "rowGroupSize:" << m_rowGroupSize;
+    m_file.setFileName(outputPath);
+    m_bufferedRows = 0;
+    m_totalRows    = 0;
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCWarning(lcCli) << "ColumnarMetricsWriter::open: cannot open"
+                         << outputPath << m_file.errorString();
+        if (err)
+            *err = QStringLiteral("Cannot open %1: %2")
+                       .arg(outputPath, m_file.errorString());
+        return false;
+    }
+
+    QDataStream ds(&m_file);
+    configureStream(ds);
+    ds << Magic << Version << static_cast<quint16>(m_columns.size());
+    for (const auto &c : m_columns)
+    {
+        ds << static_cast<quint8>(c.type);
+        writeUtf8(ds, c.name);
+    }
+    if (ds.status() != QDataStream::Ok || !m_file.flush())
+    {
+        if (err)
+            *err = QStringLiteral("Cannot write %1: %2")
+                       .arg(outputPath, m_file.errorString());
+        return false;
+    }
+    return true;
+}
+
+bool ColumnarMetricsWriter::append(
+    const Backend::Scenario::PathExecutionResult &result,
+    QString                                      *err)
+{
+    if (!m_file.isOpen())
+    {
+        if (err)
+            *err = QStringLiteral("Columnar writer is not open");
+        return false;
+    }
+
+    const auto actual = result.totalActualMetrics();
+    const auto predicted =
+        m_metrics.value(result.canonicalPathKey);
+
+    // Indexes follow defaultColumns().
+    m_columns[0].ints.append(result.pathId);
+    m_columns[1].ints.append(result.rank);
+    m_columns[2].strings.append(result.canonicalPathKey);
+    m_columns[3].strings.append(result.originId);
+    m_columns[4].strings.append(result.destinationId);
+    m_columns[5].ints.append(result.effectiveContainerCount);
+    m_columns[6].ints.append(result.segmentResults.size());
+    m_columns[7].doubles.append(result.totalCost);
+    m_columns[8].doubles.append(result.edgeCosts);
+    m_columns[9].doubles.append(result.terminalCosts);
+    m_columns[10].doubles.append(result.modeledActualTerminalCosts);
+    m_columns[11].doubles.append(actual.available ? actual.distance : 0.0);
+    m_columns[12].doubles.append(actual.available ? actual.travelTime
+                                                  : 0.0);
+    m_columns[13].doubles.append(
+        actual.available ? actual.energyConsumption : 0.0);
+    m_columns[14].doubles.append(
+        actual.available ? actual.carbonEmissions : 0.0);
+    m_columns[15].doubles.append(actual.available ? actual.risk : 0.0);
+    m_columns[16].doubles.append(predicted.valid ? predicted.distanceKm
+                                                 : 0.0);
+    m_columns[17].doubles.append(
+        predicted.valid ? predicted.travelTimeHours : 0.0);
+
+    ++m_bufferedRows;
+    if (m_bufferedRows >= m_rowGroupSize)
+        return flushRowGroup(err);
+    return true;
+}
+
+bool ColumnarMetricsWriter::flushRowGroup(QString *err)
+{
+    if (m_bufferedRows == 0)
+        return true;
+
+    QDataStream ds(&m_file);
+    configureStream(ds);
+    ds << static_cast<quint32>(m_bufferedRows);
+    for (auto &c : m_columns)
+    {
+        switch (c.type)
+        {
+        case ColumnType::Float64:
+            for (double v : std::as_const(c.doubles))
+                ds << v;
+            c.doubles.clear();
+            break;
+        case ColumnType::Int32:
+            for (qint32 v : std::as_const(c.ints))
+                ds << v;
+            c.ints.clear();
+            break;
+        case ColumnType::Utf8:
+            for (const auto &v : std::as_const(c.strings))
+                writeUtf8(ds, v);
+            c.strings.clear();
+            break;
+        }
+    }
+
+    m_totalRows += m_bufferedRows;
+    m_bufferedRows = 0;
+    if (ds.status() != QDataStream::Ok || !m_file.flush())
+    {
+        qCWarning(lcCli) << "ColumnarMetricsWriter: write failed on"
+                         << m_file.fileName() << m_file.errorString();
+        if (err)
+            *err = QStringLiteral("Cannot write %1: %2")
+                       .arg(m_file.fileName(), m_file.errorString());
+        return false;
+    }
+    qCDebug(lcCli) << "ColumnarMetricsWriter: flushed row group, total rows"
+                   << m_totalRows;
+    return true;
+}
+
+bool ColumnarMetricsWriter::finish(QString *err)
+{
+    if (!m_file.isOpen())
+    {
+        if (err)
+            *err = QStringLiteral("Columnar writer is not open");
+        return false;
+    }
+    if (!flushRowGroup(err))
+    {
+        m_file.close();
+        return false;
+    }
+
+    QDataStream ds(&m_file);
+    configureStream(ds);
+    ds << static_cast<quint32>(0) << static_cast<quint32>(m_totalRows);
+    const bool ok = ds.status() == QDataStream::Ok && m_file.flush();
+    if (!ok && err)
+        *err = QStringLiteral("Cannot write %1: %2")
+                   .arg(m_file.fileName(), m_file.errorString());
+    m_file.close();
+    qCInfo(lcCli) << "ColumnarMetricsWriter::finish: wrote" << m_totalRows
+                  << "rows to" << m_file.fileName();
+    return ok;
+}
+
+bool ColumnarMetricsWriter::read(const QString &path,
+                                 QList<Column> *columns, QString *err)
+{
+    QFile f(path);
+    if (!f.open(QIODevice::ReadOnly))
+    {
+        if (err)
+            *err = QStringLiteral("Cannot open %1: %2")
+                       .arg(path, f.errorString());
+        return false;
+    }
+
+    QDataStream ds(&f);
+    configureStream(ds);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    quint16 columnCount = 0;
+    ds >> magic >> version >> columnCount;
+    if (ds.status() != QDataStream::Ok || magic != Magic
+        || version != Version)
+    {
+        if (err)
+            *err = QStringLiteral("%1 is not a version %2 columnar results file")
+                       .arg(path)
+                       .arg(Version);
+        return false;
+    }
+
+    QList<Column> decoded;
+    decoded.reserve(columnCount);
+    for (quint16 i = 0; i < columnCount; ++i)
+    {
+        quint8 type = 0;
+        ds >> type;
+        Column c;
+        c.type = static_cast<ColumnType>(type);
+        if (type > static_cast<quint8>(ColumnType::Utf8)
+            || !readUtf8(ds, &c.name))
+        {
+            if (err)
+                *err = QStringLiteral("%1: corrupt column header").arg(path);
+            return false;
+        }
+        decoded.append(c);
+    }
+
+    const QList<Column> descriptors = decoded;
+    while (!ds.atEnd())
+    {
+        quint32 rows = 0;
+        ds >> rows;
+        if (ds.status() != QDataStream::Ok || rows == 0)
+            break; // trailer or truncated tail
+
+        bool complete = true;
+        QList<Column> group = descriptors;
+        for (auto &c : group)
+        {
+            for (quint32 r = 0; r < rows && complete; ++r)
+            {
+                switch (c.type)
+                {
+                case ColumnType::Float64: {
+                    double v = 0.0;
+                    ds >> v;
+                    c.doubles.append(v);
+                    break;
+                }
+                case ColumnType::Int32: {
+                    qint32 v = 0;
+                    ds >> v;
+                    c.ints.append(v);
+                    break;
+                }
+                case ColumnType::Utf8: {
+                    QString v;
+                    complete = readUtf8(ds, &v);
+                    c.strings.append(v);
+                    break;
+                }
+                }
+                complete = complete && ds.status() == QDataStream::Ok;
+            }
+        }
+        if (!complete)
+            break; // partial trailing group from an interrupted run
+
+        for (int i = 0; i < decoded.size(); ++i)
+        {
+            decoded[i].doubles += group[i].doubles;
+            decoded[i].ints    += group[i].ints;
+            decoded[i].strings += group[i].strings;
+        }
+    }
+
+    if (columns)
+        *columns = decoded;
+    return true;
+}
+
+} // namespace Cli
+} // namespace CargoNetSim
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <QFile>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "Backend/CliApi/ResultsApi.h"
+
+namespace CargoNetSim {
+namespace Cli {
+
+/**
+ * @brief Stream per-path metrics into a compact columnar binary file
+ *        (`results.cnscol`).
+ *
+ * Intended for national-scale runs where the JSON output is too large
+ * to load for analysis. Rows are buffered in memory only until a row
+ * group fills up; each full group is written column-by-column and
+ * flushed, so memory stays bounded by `rowGroupSize` regardless of
+ * the number of paths.
+ *
+ * File layout (little-endian, schema frozen — published contract):
+ * @code
+ * header   : u32 magic 'CNSC' (0x43534E43), u16 version (1),
+ *            u16 columnCount,
+ *            columnCount × { u8 type, u32 nameLen, nameLen × u8 UTF-8 }
+ * groups   : repeated { u32 rowCount (> 0),
+ *                       columnCount × rowCount values }
+ * trailer  : u32 0 (end-of-groups marker), u32 totalRows
+ * @endcode
+ *
+ * Value encodings by column type: `Float64` is an IEEE-754 double,
+ * `Int32` a two's-complement int, `Utf8` a u32 byte length followed
+ * by that many UTF-8 bytes. A file without the trailer is a partial
+ * run; every complete row group before the cut is still readable.
+ *
+ * Like `NdjsonResultsWriter`, the file is written in place so it can
+ * be read while the run progresses, and the parent directory must
+ * already exist. Single-threaded.
+ */
+class ColumnarMetricsWriter
+{
+public:
+    enum class ColumnType : quint8
+    {
+        Float64 = 0,
+        Int32   = 1,
+        Utf8    = 2
+    };
+
+    static constexpr quint32 Magic   = 0x43534E43u; // "CNSC"
+    static constexpr quint16 Version = 1;
+
+    /// One decoded column, as returned by `read`.
+    struct Column
+    {
+        QString         name;
+        ColumnType      type = ColumnType::Float64;
+        QVector<double> doubles;
+        QVector<qint32> ints;
+        QStringList     strings;
+    };
+
+    /**
+     * @param metrics       Optional predicted metrics keyed by canonical
+     *                      path key; fills the `predicted_*` columns.
+     * @param rowGroupSize  Rows buffered before a group is written.
+     */
+    explicit ColumnarMetricsWriter(
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics>
+            &metrics      = {},
+        int  rowGroupSize = 1024);
+
+    /// Truncate/create @p outputPath and write the column header.
+    bool open(const QString &outputPath, QString *err);
+
+    /// Buffer one row; writes a row group once the buffer is full.
+    bool append(
+        const CargoNetSim::Backend::Scenario::PathExecutionResult &result,
+        QString *err);
+
+    /// Write any buffered rows plus the trailer and close the file.
+    bool finish(QString *err);
+
+    bool isOpen() const { return m_file.isOpen(); }
+    int  rowCount() const { return m_totalRows + m_bufferedRows; }
+
+    /**
+     * @brief Decode a file written by this class. Tolerates a missing
+     *        trailer (partial run) and returns the complete groups.
+     */
+    static bool read(const QString &path, QList<Column> *columns,
+                     QString *err);
+
+private:
+    bool flushRowGroup(QString *err);
+
+    QFile         m_file;
+    QList<Column> m_columns;
+    QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics> m_metrics;
+    int           m_rowGroupSize = 1024;
+    int           m_bufferedRows = 0;
+    int           m_totalRows    = 0;
+};
+
+} // namespace Cli
+} // namespace CargoNetSim
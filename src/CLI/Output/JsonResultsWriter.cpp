@@ -39,6 +39,137 @@ QJsonArray previewVehicleBreakdownToJson(
 
 } // namespace
 
+QJsonObject JsonResultsWriter::pathObject(
+    const Backend::Scenario::PathSimulationResult    &r,
+    const QHash<QString, Backend::Scenario::PathMetrics> &metrics,
+    const QHash<QString, Backend::Scenario::PathKey>     &keys,
+    const QHash<QString, Backend::Path *>            &pathIndex)
+{
+    QJsonObject p;
+    p[QStringLiteral("path_id")]        = r.pathId;
+    if (!r.pathUid.isEmpty())
+        p[QStringLiteral("path_uid")] = r.pathUid;
+    p[QStringLiteral("total_cost")]     = r.totalCost;
+    p[QStringLiteral("edge_costs")]     = r.edgeCosts;
+    p[QStringLiteral("terminal_costs")] = r.terminalCosts;
+    p[QStringLiteral("effective_container_count")] =
+        r.effectiveContainerCount;
+
+    const QString canonicalKey = !r.canonicalPathKey.isEmpty()
+        ? r.canonicalPathKey
+        : r.pathUid;
+
+    // Optional: (origin, destination, rank) from PathKey. Keys are
+    // pure display metadata — consumers that do not care will see
+    // them as unknown fields and ignore them.
+    if (keys.contains(canonicalKey))
+    {
+        const auto &k = keys.value(canonicalKey);
+        p[QStringLiteral("origin")]      = k.originId;
+        p[QStringLiteral("destination")] = k.destinationId;
+        p[QStringLiteral("rank")]        = k.rank;
+    }
+    else
+    {
+        if (!r.originId.isEmpty())
+            p[QStringLiteral("origin")] = r.originId;
+        if (!r.destinationId.isEmpty())
+            p[QStringLiteral("destination")] = r.destinationId;
+        p[QStringLiteral("rank")] = r.rank;
+    }
+
+    // Optional: per-path metrics block. Only emitted when the
+    // supplied PathMetrics is valid (mode must be supported AND
+    // lookup data available). An invalid entry is equivalent to
+    // the caller not supplying one at all — the block is simply
+    // omitted rather than emitted as null or all-zeros.
+    if (metrics.contains(canonicalKey))
+    {
+        const auto &m = metrics.value(canonicalKey);
+        if (m.valid)
+        {
+            QJsonObject perVeh;
+            perVeh[QStringLiteral("fuel")]       = m.fuelPerVehicle;
+            perVeh[QStringLiteral("energy_kwh")] = m.energyPerVehicle;
+            perVeh[QStringLiteral("carbon_t")]   = m.carbonPerVehicle;
+            perVeh[QStringLiteral("risk")]       = m.riskPerVehicle;
+
+            QJsonObject perCont;
+            perCont[QStringLiteral("fuel")]       = m.fuelPerContainer;
+            perCont[QStringLiteral("energy_kwh")] = m.energyPerContainer;
+            perCont[QStringLiteral("carbon_t")]   = m.carbonPerContainer;
+            perCont[QStringLiteral("risk")]       = m.riskPerContainer;
+
+            QJsonObject mo;
+            mo[QStringLiteral("preview_container_count")] =
+                m.containerCount;
+            mo[QStringLiteral("preview_vehicles_needed")] =
+                m.vehiclesNeeded;
+            mo[QStringLiteral("preview_vehicle_breakdown")] =
+                previewVehicleBreakdownToJson(
+                    m.previewVehicleBreakdown);
+            mo[QStringLiteral("container_count")] = m.containerCount;
+            mo[QStringLiteral("vehicles_needed")] = m.vehiclesNeeded;
+            mo[QStringLiteral("distance_km")]     = m.distanceKm;
+            mo[QStringLiteral("travel_time_h")]   = m.travelTimeHours;
+            mo[PK::Mode::FuelType]                = m.fuelType;
+            mo[QStringLiteral("per_vehicle")]     = perVeh;
+            mo[QStringLiteral("per_container")]   = perCont;
+
+            p[QStringLiteral("metrics")] = mo;
+        }
+    }
+
+    // Optional segments array — emitted when a matching Path* is available.
+    if (pathIndex.contains(canonicalKey))
+    {
+        const auto *path = pathIndex.value(canonicalKey);
+
+        using M = Backend::TransportationTypes::TransportationMode;
+        auto modeStr = [](M m) -> QString {
+            switch (m) {
+                case M::Ship:  return QStringLiteral("ship");
+                case M::Train: return QStringLiteral("rail");
+                case M::Truck: return QStringLiteral("truck");
+                default:       return QStringLiteral("unknown");
+            }
+        };
+
+        QJsonArray segsArr;
+        for (const auto *seg : path->getSegments())
+        {
+            if (!seg) continue;
+            QJsonObject estimated;
+            estimated[QStringLiteral("distance_m")]    = seg->estimatedDistance();
+            estimated[QStringLiteral("travel_time_s")] = seg->estimatedTravelTime();
+            estimated[QStringLiteral("energy_kwh")]    = seg->estimatedEnergyConsumption();
+            estimated[QStringLiteral("carbon_t")]      = seg->estimatedCarbonEmissions();
+            estimated[QStringLiteral("risk")]          = seg->estimatedRisk();
+
+            QJsonObject segObj;
+            segObj[QStringLiteral("segment_id")] = seg->getPathSegmentId();
+            segObj[QStringLiteral("mode")]       = modeStr(seg->getMode());
+            segObj[QStringLiteral("from")]       = seg->getStart();
+            segObj[QStringLiteral("to")]         = seg->getEnd();
+            segObj[QStringLiteral("estimated")]  = estimated;
+            segsArr.append(segObj);
+        }
+        p[QStringLiteral("segments")] = segsArr;
+    }
+
+    return p;
+}
+
+QHash<QString, Backend::Path *> JsonResultsWriter::indexPaths(
+    const QList<Backend::Path *> &paths)
+{
+    QHash<QString, Backend::Path *> pathIndex;
+    pathIndex.reserve(paths.size());
+    for (auto *p : paths)
+        if (p) pathIndex[p->canonicalPathKey()] = p;
+    return pathIndex;
+}
+
 bool JsonResultsWriter::write(
     const QString &outputPath,
     const QList<Backend::Scenario::PathSimulationResult> &results,
@@ -54,137 +185,7 @@ bool JsonResultsWriter::write(
                   << "paths:" << paths.size();
 
     // Build a lookup index for fast O(1) segment lookup inside the loop.
-    QHash<QString, Backend::Path *> pathIndex;
-    for (auto *p : paths)
-        if (p) pathIndex[p->canonicalPathKey()] = p;
-
-    QJsonArray pathsArr;
-    for (const auto &r : results)
-    {
-        QJsonObject p;
-        p[QStringLiteral("path_id")]        = r.pathId;
-        if (!r.pathUid.isEmpty())
-            p[QStringLiteral("path_uid")] = r.pathUid;
-        p[QStringLiteral("total_cost")]     = r.totalCost;
-        p[QStringLiteral("edge_costs")]     = r.edgeCosts;
-        p[QStringLiteral("terminal_costs")] = r.terminalCosts;
-        p[QStringLiteral("effective_container_count")] =
-            r.effectiveContainerCount;
-
-        const QString canonicalKey = !r.canonicalPathKey.isEmpty()
-            ? r.canonicalPathKey
-            : r.pathUid;
-
-        // Optional: (origin, destination, rank) from PathKey. Keys are
-        // pure display metadata — consumers that do not care will see
-        // them as unknown fields and ignore them.
-        if (keys.contains(canonicalKey))
-        {
-            const auto &k = keys.value(canonicalKey);
-            p[QStringLiteral("origin")]      = k.originId;
-            p[QStringLiteral("destination")] = k.destinationId;
-            p[QStringLiteral("rank")]        = k.rank;
-        }
-        else
-        {
-            if (!r.originId.isEmpty())
-                p[QStringLiteral("origin")] = r.originId;
-            if (!r.destinationId.isEmpty())
-                p[QStringLiteral("destination")] = r.destinationId;
-            p[QStringLiteral("rank")] = r.rank;
-        }
-
-        // Optional: per-path metrics block. Only emitted when the
-        // supplied PathMetrics is valid (mode must be supported AND
-        // lookup data available). An invalid entry is equivalent to
-        // the caller not supplying one at all — the block is simply
-        // omitted rather than emitted as null or all-zeros.
-        if (metrics.contains(canonicalKey))
-        {
-            const auto &m = metrics.value(canonicalKey);
-            if (m.valid)
-            {
-                QJsonObject perVeh;
-                perVeh[QStringLiteral("fuel")]       = m.fuelPerVehicle;
-                perVeh[QStringLiteral("energy_kwh")] = m.energyPerVehicle;
-                perVeh[QStringLiteral("carbon_t")]   = m.carbonPerVehicle;
-                perVeh[QStringLiteral("risk")]       = m.riskPerVehicle;
-
-                QJsonObject perCont;
-                perCont[QStringLiteral("fuel")]       = m.fuelPerContainer;
-                perCont[QStringLiteral("energy_kwh")] = m.energyPerContainer;
-                perCont[QStringLiteral("carbon_t")]   = m.carbonPerContainer;
-                perCont[QStringLiteral("risk")]       = m.riskPerContainer;
-
-                QJsonObject mo;
-                mo[QStringLiteral("preview_container_count")] =
-                    m.containerCount;
-                mo[QStringLiteral("preview_vehicles_needed")] =
-                    m.vehiclesNeeded;
-                mo[QStringLiteral("preview_vehicle_breakdown")] =
-                    previewVehicleBreakdownToJson(
-                        m.previewVehicleBreakdown);
-                mo[QStringLiteral("container_count")] = m.containerCount;
-                mo[QStringLiteral("vehicles_needed")] = m.vehiclesNeeded;
-                mo[QStringLiteral("distance_km")]     = m.distanceKm;
-                mo[QStringLiteral("travel_time_h")]   = m.travelTimeHours;
-                mo[PK::Mode::FuelType]                = m.fuelType;
-                mo[QStringLiteral("per_vehicle")]     = perVeh;
-                mo[QStringLiteral("per_container")]   = perCont;
-
-                p[QStringLiteral("metrics")] = mo;
-            }
-        }
-
-        // Optional segments array — emitted when a matching Path* is available.
-        if (pathIndex.contains(canonicalKey))
-        {
-            const auto *path = pathIndex.value(canonicalKey);
-
-            using M = Backend::TransportationTypes::TransportationMode;
-            auto modeStr = [](M m) -> QString {
-                switch (m) {
-                    case M::Ship:  return QStringLiteral("ship");
-                    case M::Train: return QStringLiteral("rail");
-                    case M::Truck: return QStringLiteral("truck");
-                    default:       return QStringLiteral("unknown");
-                }
-            };
-
-            QJsonArray segsArr;
-            for (const auto *seg : path->getSegments())
-            {
-                if (!seg) continue;
-                QJsonObject estimated;
-                estimated[QStringLiteral("distance_m")]    = seg->estimatedDistance();
-                estimated[QStringLiteral("travel_time_s")] = seg->estimatedTravelTime();
-                estimated[QStringLiteral("energy_kwh")]    = seg->estimatedEnergyConsumption();
-                estimated[QStringLiteral("carbon_t")]      = seg->estimatedCarbonEmissions();
-                estimated[QStringLiteral("risk")]          = seg->estimatedRisk();
-
-                QJsonObject segObj;
-                segObj[QStringLiteral("segment_id")] = seg->getPathSegmentId();
-                segObj[QStringLiteral("mode")]       = modeStr(seg->getMode());
-                segObj[QStringLiteral("from")]       = seg->getStart();
-                segObj[QStringLiteral("to")]         = seg->getEnd();
-                segObj[QStringLiteral("estimated")]  = estimated;
-                segsArr.append(segObj);
-            }
-            p[QStringLiteral("segments")] = segsArr;
-        }
-
-        pathsArr.append(p);
-    }
-
-    QJsonObject root;
-    root[QStringLiteral("schema_version")] = 2;
-    // `Qt::ISODate` on a UTC `QDateTime` emits the ISO 8601 UTC form
-    // "yyyy-MM-ddTHH:mm:ssZ" with the `Z` suffix already included —
-    // see the Qt::DateFormat reference. Appending `Z` manually would
-    // produce `ZZ`.
-    root[QStringLiteral("generated_at")] =
-        QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
-    root[QStringLiteral("paths")] = pathsArr;
+    const auto pathIndex = indexPaths(paths);
 
     // Atomic write: QSaveFile stages into a sibling tempfile, commit()
     // renames into place. A crash before commit leaves the previous
@@ -199,7 +200,34 @@ bool JsonResultsWriter::write(
                        .arg(outputPath, f.errorString());
         return false;
     }
-    f.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+
+    // The document envelope is written by hand and each path object is
+    // serialized on its own, so peak memory stays at one path's JSON
+    // tree instead of the whole result set. `Qt::ISODate` on a UTC
+    // `QDateTime` emits the ISO 8601 UTC form "yyyy-MM-ddTHH:mm:ssZ"
+    // with the `Z` suffix already included — see the Qt::DateFormat
+    // reference. Appending `Z` manually would produce `ZZ`.
+    f.write("{\n    \"schema_version\": 2,\n    \"generated_at\": \"");
+    f.write(QDateTime::currentDateTimeUtc()
+                .toString(Qt::ISODate)
+                .toUtf8());
+    f.write("\",\n    \"paths\": [");
+
+    bool first = true;
+    for (const auto &r : results)
+    {
+        QByteArray body =
+            QJsonDocument(pathObject(r, metrics, keys, pathIndex))
+                .toJson(QJsonDocument::Indented)
+                .trimmed();
+        // Re-indent the standalone object so it nests under "paths".
+        body.replace("\n", "\n        ");
+        f.write(first ? "\n        " : ",\n        ");
+        f.write(body);
+        first = false;
+    }
+    f.write(first ? "]\n}\n" : "\n    ]\n}\n");
+
     if (!f.commit())
     {
         qCWarning(lcCli) << "JsonResultsWriter::write: cannot commit" << outputPath
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QHash>
+#include <QJsonObject>
 #include <QList>
 #include <QString>
 
@@ -75,7 +76,9 @@ namespace Cli {
  * previous contents or the new contents; a crash mid-write leaves no
  * partial output. The writer does NOT create the parent directory;
  * that is the caller's responsibility (see `RunCommand` Task 17 which
- * does `QDir().mkpath(outputDir)` before calling here).
+ * does `QDir().mkpath(outputDir)` before calling here). Path objects
+ * are serialized one at a time into the staging file, so the full
+ * document tree is never held in memory at once.
  *
  * The optional `metrics` and `origin`/`destination`/`rank` fields are
  * emitted when the caller passes populated `metrics` / `keys` maps
@@ -123,6 +126,26 @@ public:
                       &keys    = {},
         const QList<CargoNetSim::Backend::Path *>
                       &paths   = {});
+
+    /**
+     * @brief Build the published per-path object for one result.
+     *
+     * Shared with `NdjsonResultsWriter` so the streamed records and
+     * the `paths[]` entries of `results.json` stay field-for-field
+     * identical. @p pathIndex is the canonical-key lookup produced by
+     * `indexPaths`.
+     */
+    static QJsonObject pathObject(
+        const CargoNetSim::Backend::Scenario::PathSimulationResult &r,
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics>
+            &metrics,
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathKey>
+            &keys,
+        const QHash<QString, CargoNetSim::Backend::Path *> &pathIndex);
+
+    /// Index @p paths by canonical path key; null entries are skipped.
+    static QHash<QString, CargoNetSim::Backend::Path *> indexPaths(
+        const QList<CargoNetSim::Backend::Path *> &paths);
 };
 
 } // namespace Cli
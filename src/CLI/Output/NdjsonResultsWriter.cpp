@@ -0,0 +1,117 @@
+#include "NdjsonResultsWriter.h"
+#include "Backend/Commons/LogCategories.h"
+#include "CLI/Output/JsonResultsWriter.h"
+
+#include <QDateTime>
+#include <QJsonDocument>
+
+namespace CargoNetSim {
+namespace Cli {
+
+NdjsonResultsWriter::NdjsonResultsWriter(
+    const QHash<QString, Backend::Scenario::PathMetrics> &metrics,
+    const QHash<QString, Backend::Scenario::PathKey>     &keys,
+    const QList<Backend::Path *>                         &paths)
+    : m_metrics(metrics)
+    , m_keys(keys)
+    , m_pathIndex(JsonResultsWriter::indexPaths(paths))
+{
+}
+
+bool NdjsonResultsWriter::open(const QString &outputPath, QString *err)
+{
+    qCInfo(lcCli) << "NdjsonResultsWriter::open: path" << outputPath;
+    m_file.setFileName(outputPath);
+    m_recordCount = 0;
+    // Binary mode: records are LF-terminated on every platform, same
+    // line-ending contract as the CSV writer.
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCWarning(lcCli) << "NdjsonResultsWriter::open: cannot open"
+                         << outputPath << m_file.errorString();
+        if (err)
+            *err = QStringLiteral("Cannot open %1: %2")
+                       .arg(outputPath, m_file.errorString());
+        return false;
+    }
+
+    QJsonObject header;
+    header[QStringLiteral("record")]         = QStringLiteral("header");
+    header[QStringLiteral("schema_version")] = 1;
+    header[QStringLiteral("generated_at")] =
+        QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    return writeRecord(header, err);
+}
+
+bool NdjsonResultsWriter::append(
+    const Backend::Scenario::PathExecutionResult &result,
+    QString                                      *err)
+{
+    if (!m_file.isOpen())
+    {
+        if (err)
+            *err = QStringLiteral("NDJSON writer is not open");
+        return false;
+    }
+
+    QJsonObject record = JsonResultsWriter::pathObject(
+        result.toSimulationResult(), m_metrics, m_keys, m_pathIndex);
+    record[QStringLiteral("record")] = QStringLiteral("path");
+
+    const auto actual = result.totalActualMetrics();
+    if (actual.available)
+    {
+        QJsonObject a;
+        a[QStringLiteral("distance_m")]    = actual.distance;
+        a[QStringLiteral("travel_time_s")] = actual.travelTime;
+        a[QStringLiteral("energy_kwh")]    = actual.energyConsumption;
+        a[QStringLiteral("carbon_t")]      = actual.carbonEmissions;
+        a[QStringLiteral("risk")]          = actual.risk;
+        record[QStringLiteral("actual")] = a;
+    }
+
+    if (!writeRecord(record, err))
+        return false;
+    ++m_recordCount;
+    return true;
+}
+
+bool NdjsonResultsWriter::finish(QString *err)
+{
+    if (!m_file.isOpen())
+    {
+        if (err)
+            *err = QStringLiteral("NDJSON writer is not open");
+        return false;
+    }
+
+    QJsonObject footer;
+    footer[QStringLiteral("record")]     = QStringLiteral("footer");
+    footer[QStringLiteral("path_count")] = m_recordCount;
+    const bool ok = writeRecord(footer, err);
+    m_file.close();
+    qCInfo(lcCli) << "NdjsonResultsWriter::finish: wrote"
+                  << m_recordCount << "path records to"
+                  << m_file.fileName();
+    return ok;
+}
+
+bool NdjsonResultsWriter::writeRecord(const QJsonObject &record,
+                                      QString           *err)
+{
+    QByteArray line = QJsonDocument(record).toJson(QJsonDocument::Compact);
+    line.append('\n');
+    if (m_file.write(line) != line.size() || !m_file.flush())
+    {
+        qCWarning(lcCli) << "NdjsonResultsWriter: write failed on"
+                         << m_file.fileName() << m_file.errorString();
+        if (err)
+            *err = QStringLiteral("Cannot write %1: %2")
+                       .arg(m_file.fileName(), m_file.errorString());
+        return false;
+    }
+    return true;
+}
+
+} // namespace Cli
+} // namespace CargoNetSim
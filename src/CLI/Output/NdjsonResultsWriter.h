@@ -0,0 +1,88 @@
+#pragma once
+
+#include <QFile>
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+#include "Backend/CliApi/ResultsApi.h"
+
+namespace CargoNetSim {
+namespace Cli {
+
+/**
+ * @brief Stream a `results.ndjson` file one record per completed path.
+ *
+ * Unlike `JsonResultsWriter`, which needs the finished result list,
+ * this writer is opened before the run starts and receives each
+ * `PathExecutionResult` as `ScenarioRuntime::pathResultReady` fires.
+ * Every record is a single UTF-8 JSON object terminated by LF and is
+ * flushed to disk immediately, so `tail -f` and line-oriented tools
+ * can consume results while the run is still going.
+ *
+ * Output shape (schema frozen — published contract):
+ * @code
+ * {"record":"header","schema_version":1,"generated_at":"2026-04-12T14:30:00Z"}
+ * {"record":"path", ...same fields as results.json paths[]..., "actual":{...}}
+ * {"record":"path", ...}
+ * {"record":"footer","path_count":2}
+ * @endcode
+ *
+ * `path` records carry exactly the fields produced by
+ * `JsonResultsWriter::pathObject`, plus an `actual` block with the
+ * simulated distance / time / energy / carbon / risk totals when the
+ * simulators reported them. The `footer` record is written only by a
+ * successful `finish()`; a file without one is a partial run.
+ *
+ * Not atomic by design: the file is written in place so it can be
+ * followed during the run. The writer does NOT create the parent
+ * directory.
+ *
+ * Single-threaded: call every method from the thread that owns the
+ * runtime (the CLI main thread).
+ */
+class NdjsonResultsWriter
+{
+public:
+    /**
+     * @param metrics  Optional per-path predicted metrics keyed by
+     *                 canonical path key (see `JsonResultsWriter`).
+     * @param keys     Optional (origin, destination, rank) tuples keyed
+     *                 by canonical path key.
+     * @param paths    Optional Path pointers used for the `segments`
+     *                 array; must outlive the writer.
+     */
+    explicit NdjsonResultsWriter(
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics>
+            &metrics = {},
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathKey>
+            &keys = {},
+        const QList<CargoNetSim::Backend::Path *> &paths = {});
+
+    /// Truncate/create @p outputPath and emit the header record.
+    bool open(const QString &outputPath, QString *err);
+
+    /// Emit one `path` record and flush it to disk.
+    bool append(
+        const CargoNetSim::Backend::Scenario::PathExecutionResult &result,
+        QString *err);
+
+    /// Emit the `footer` record and close the file.
+    bool finish(QString *err);
+
+    bool isOpen() const { return m_file.isOpen(); }
+    int  recordCount() const { return m_recordCount; }
+
+private:
+    bool writeRecord(const QJsonObject &record, QString *err);
+
+    QFile m_file;
+    QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics> m_metrics;
+    QHash<QString, CargoNetSim::Backend::Scenario::PathKey>     m_keys;
+    QHash<QString, CargoNetSim::Backend::Path *>                m_pathIndex;
+    int m_recordCount = 0;
+};
+
+} // namespace Cli
+} // namespace CargoNetSim
@@ -0,0 +1,192 @@
+#include "ResultsOutputWriter.h"
+#include "Backend/Commons/LogCategories.h"
+#include "CLI/Output/ColumnarMetricsWriter.h"
+#include "CLI/Output/CsvResultsWriter.h"
+#include "CLI/Output/JsonResultsWriter.h"
+#include "CLI/Output/NdjsonResultsWriter.h"
+
+#include <QDir>
+
+namespace CargoNetSim {
+namespace Cli {
+
+namespace {
+
+QString writerError(const QString &fmt, const QString &reason)
+{
+    return QStringLiteral("writer '%1': %2").arg(fmt, reason);
+}
+
+} // namespace
+
+ResultsOutputWriter::FinalWriters ResultsOutputWriter::defaultFinalWriters()
+{
+    return FinalWriters{
+        [](const QString &outputPath,
+           const QList<Backend::Scenario::PathSimulationResult> &results,
+           QString *err,
+           const QHash<QString, Backend::Scenario::PathMetrics> &metrics,
+           const QHash<QString, Backend::Scenario::PathKey> &keys,
+           const QList<Backend::Path *> &paths) {
+            JsonResultsWriter writer;
+            return writer.write(outputPath, results, err, metrics,
+                                keys, paths);
+        },
+        [](const QString &outputPath,
+           const QList<Backend::Scenario::PathSimulationResult> &results,
+           QString *err) {
+            CsvResultsWriter writer;
+            return writer.write(outputPath, results, err);
+        }};
+}
+
+QString ResultsOutputWriter::fileNameForFormat(const QString &fmt)
+{
+    if (fmt == QLatin1String("json"))
+        return QStringLiteral("results.json");
+    if (fmt == QLatin1String("csv"))
+        return QStringLiteral("results.csv");
+    if (fmt == QLatin1String("ndjson"))
+        return QStringLiteral("results.ndjson");
+    if (fmt == QLatin1String("columnar"))
+        return QStringLiteral("results.cnscol");
+    return QString();
+}
+
+bool ResultsOutputWriter::isStreamingFormat(const QString &fmt)
+{
+    return fmt == QLatin1String("ndjson")
+        || fmt == QLatin1String("columnar");
+}
+
+ResultsOutputWriter::ResultsOutputWriter(
+    const QString                                        &directory,
+    const QHash<QString, Backend::Scenario::PathMetrics> &metrics,
+    const QHash<QString, Backend::Scenario::PathKey>     &keys,
+    const QList<Backend::Path *>                         &paths,
+    FinalWriters                                          finalWriters)
+    : m_directory(directory)
+    , m_metrics(metrics)
+    , m_keys(keys)
+    , m_paths(paths)
+    , m_final(std::move(finalWriters))
+{
+}
+
+ResultsOutputWriter::~ResultsOutputWriter() = default;
+
+QString ResultsOutputWriter::filePathForFormat(const QString &fmt) const
+{
+    return QDir(m_directory).filePath(fileNameForFormat(fmt));
+}
+
+bool ResultsOutputWriter::openStreams(const QStringList &formats,
+                                      QString           *err)
+{
+    QString werr;
+    if (formats.contains(QStringLiteral("ndjson")) && !m_ndjson)
+    {
+        m_ndjson = std::make_unique<NdjsonResultsWriter>(m_metrics, m_keys,
+                                                         m_paths);
+        if (!m_ndjson->open(filePathForFormat(QStringLiteral("ndjson")),
+                            &werr))
+        {
+            if (err) *err = writerError(QStringLiteral("ndjson"), werr);
+            return false;
+        }
+    }
+    if (formats.contains(QStringLiteral("columnar")) && !m_columnar)
+    {
+        m_columnar = std::make_unique<ColumnarMetricsWriter>(m_metrics);
+        if (!m_columnar->open(filePathForFormat(QStringLiteral("columnar")),
+                              &werr))
+        {
+            if (err) *err = writerError(QStringLiteral("columnar"), werr);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ResultsOutputWriter::hasStreams() const
+{
+    return m_ndjson || m_columnar;
+}
+
+bool ResultsOutputWriter::appendStreamed(
+    const Backend::Scenario::PathExecutionResult &result, QString *err)
+{
+    QString werr;
+    if (m_ndjson && !m_ndjson->append(result, &werr))
+    {
+        if (err) *err = writerError(QStringLiteral("ndjson"), werr);
+        return false;
+    }
+    if (m_columnar && !m_columnar->append(result, &werr))
+    {
+        if (err) *err = writerError(QStringLiteral("columnar"), werr);
+        return false;
+    }
+    return true;
+}
+
+bool ResultsOutputWriter::finishStreams(QString *err)
+{
+    // Both are finished even if the first fails, so neither is left
+    // open; the first error is reported.
+    QString werr;
+    bool    ok = true;
+    if (m_ndjson && !m_ndjson->finish(&werr))
+    {
+        if (err) *err = writerError(QStringLiteral("ndjson"), werr);
+        ok = false;
+    }
+    if (m_columnar && !m_columnar->finish(&werr) && ok)
+    {
+        if (err) *err = writerError(QStringLiteral("columnar"), werr);
+        ok = false;
+    }
+    return ok;
+}
+
+ResultsOutputWriter::WriteStatus ResultsOutputWriter::writeFinal(
+    const QString                                         &fmt,
+    const QList<Backend::Scenario::PathSimulationResult>  &results,
+    QString                                               *err) const
+{
+    if (isStreamingFormat(fmt))
+        return WriteStatus::Streamed;
+
+    QString werr;
+    bool    ok = false;
+    if (fmt == QLatin1String("json"))
+    {
+        const QString filePath = filePathForFormat(fmt);
+        qCDebug(lcCli) << "ResultsOutputWriter::writeFinal: writing JSON"
+                       << "results to" << filePath;
+        ok = m_final.writeJson
+            && m_final.writeJson(filePath, results, &werr, m_metrics,
+                                 m_keys, m_paths);
+    }
+    else if (fmt == QLatin1String("csv"))
+    {
+        const QString filePath = filePathForFormat(fmt);
+        qCDebug(lcCli) << "ResultsOutputWriter::writeFinal: writing CSV"
+                       << "results to" << filePath;
+        ok = m_final.writeCsv && m_final.writeCsv(filePath, results, &werr);
+    }
+    else
+    {
+        return WriteStatus::UnknownFormat;
+    }
+
+    if (!ok)
+    {
+        if (err) *err = writerError(fmt, werr);
+        return WriteStatus::Failed;
+    }
+    return WriteStatus::Written;
+}
+
+} // namespace Cli
+} // namespace CargoNetSim
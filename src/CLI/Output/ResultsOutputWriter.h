@@ -0,0 +1,122 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+#include <memory>
+
+#include "Backend/CliApi/ResultsApi.h"
+
+namespace CargoNetSim {
+namespace Cli {
+
+class ColumnarMetricsWriter;
+class NdjsonResultsWriter;
+
+/**
+ * @brief Dispatch `output.formats` to the results writers of one
+ *        output directory.
+ *
+ * Shared by `run` and `sweep` so both produce the same files for the
+ * same format list:
+ *
+ *   json      → results.json   (`JsonResultsWriter`, final results)
+ *   csv       → results.csv    (`CsvResultsWriter`, final results)
+ *   ndjson    → results.ndjson (`NdjsonResultsWriter`, streamed)
+ *   columnar  → results.cnscol (`ColumnarMetricsWriter`, streamed)
+ *
+ * Streamed formats are opened with `openStreams()`, fed one
+ * `PathExecutionResult` at a time and closed with `finishStreams()`;
+ * `run` feeds them while paths complete, `sweep` in one pass after the
+ * variant's run. Final formats are written by `writeFinal()`.
+ *
+ * Every error names its format as `writer '<fmt>': <reason>`. The
+ * caller creates the output directory. Single-threaded, like the
+ * writers it drives.
+ */
+class ResultsOutputWriter
+{
+public:
+    /// Writers for the final-result formats; replaceable in tests.
+    struct FinalWriters
+    {
+        std::function<bool(
+            const QString &,
+            const QList<CargoNetSim::Backend::Scenario::PathSimulationResult> &,
+            QString *,
+            const QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics> &,
+            const QHash<QString, CargoNetSim::Backend::Scenario::PathKey> &,
+            const QList<CargoNetSim::Backend::Path *> &)>
+            writeJson;
+        std::function<bool(
+            const QString &,
+            const QList<CargoNetSim::Backend::Scenario::PathSimulationResult> &,
+            QString *)>
+            writeCsv;
+    };
+
+    enum class WriteStatus
+    {
+        Written,       ///< Final format written.
+        Streamed,      ///< Streamed format; handled by the stream calls.
+        UnknownFormat, ///< Not a format this writer knows.
+        Failed         ///< Writer failed; see the error.
+    };
+
+    static FinalWriters defaultFinalWriters();
+
+    /// File name for @p fmt inside the output directory; empty for an
+    /// unknown format.
+    static QString fileNameForFormat(const QString &fmt);
+    static bool    isStreamingFormat(const QString &fmt);
+
+    /**
+     * @param directory  Existing output directory.
+     * @param metrics    Predicted metrics by canonical path key.
+     * @param keys       (origin, destination, rank) by canonical path key.
+     * @param paths      Paths for the `segments` arrays; must outlive
+     *                   the writer.
+     */
+    ResultsOutputWriter(
+        const QString &directory,
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics>
+            &metrics,
+        const QHash<QString, CargoNetSim::Backend::Scenario::PathKey>
+            &keys,
+        const QList<CargoNetSim::Backend::Path *> &paths,
+        FinalWriters finalWriters = defaultFinalWriters());
+    ~ResultsOutputWriter();
+
+    /// Open a writer for every streamed format in @p formats.
+    bool openStreams(const QStringList &formats, QString *err);
+    bool hasStreams() const;
+    bool appendStreamed(
+        const CargoNetSim::Backend::Scenario::PathExecutionResult &result,
+        QString *err);
+    /// Write footers/trailers; call only after a successful run so a
+    /// failed one leaves the files visibly partial.
+    bool finishStreams(QString *err);
+
+    WriteStatus writeFinal(
+        const QString &fmt,
+        const QList<CargoNetSim::Backend::Scenario::PathSimulationResult>
+                &results,
+        QString *err) const;
+
+    QString filePathForFormat(const QString &fmt) const;
+
+private:
+    QString m_directory;
+    QHash<QString, CargoNetSim::Backend::Scenario::PathMetrics> m_metrics;
+    QHash<QString, CargoNetSim::Backend::Scenario::PathKey>     m_keys;
+    QList<CargoNetSim::Backend::Path *>                          m_paths;
+    FinalWriters                                                 m_final;
+    std::unique_ptr<NdjsonResultsWriter>   m_ndjson;
+    std::unique_ptr<ColumnarMetricsWriter> m_columnar;
+};
+
+} // namespace Cli
+} // namespace CargoNetSim
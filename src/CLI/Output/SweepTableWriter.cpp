@@ -0,0 +1,118 @@
+#include "SweepTableWriter.h"
+#include "Backend/Commons/LogCategories.h"
+
+#include <QSaveFile>
+#include <QStringConverter>
+#include <QTextStream>
+
+namespace CargoNetSim {
+namespace Cli {
+
+namespace {
+
+QString csvField(const QString &value)
+{
+    if (!value.contains(QLatin1Char(',')) && !value.contains(QLatin1Char('"'))
+        && !value.contains(QLatin1Char('\n')))
+        return value;
+    QString quoted = value;
+    quoted.replace(QLatin1String("\""), QLatin1String("\"\""));
+    return QLatin1Char('"') + quoted + QLatin1Char('"');
+}
+
+QString fixed(double value)
+{
+    return QString::number(value, 'f', 6);
+}
+
+} // namespace
+
+bool SweepTableWriter::write(
+    const QString     &outputPath,
+    const QStringList &parameterKeys,
+    const QList<Backend::Scenario::ParameterSweepVariant> &variants,
+    const QHash<int, QHash<QString, double>> &simulatedTotalCosts,
+    QString           *err)
+{
+    qCInfo(lcCli) << "SweepTableWriter::write: path" << outputPath
+                  << "variants:" << variants.size();
+    QSaveFile f(outputPath);
+    if (!f.open(QIODevice::WriteOnly))
+    {
+        qCWarning(lcCli) << "SweepTableWriter::write: cannot open"
+                         << outputPath << f.errorString();
+        if (err)
+            *err = QStringLiteral("Cannot open %1: %2")
+                       .arg(outputPath, f.errorString());
+        return false;
+    }
+
+    QTextStream ts(&f);
+    ts.setEncoding(QStringConverter::Utf8);
+    ts.setGenerateByteOrderMark(false);
+
+    const QChar LF(QLatin1Char('\n'));
+    const QChar SEP(QLatin1Char(','));
+
+    ts << QStringLiteral("variant");
+    for (const auto &key : parameterKeys)
+        ts << SEP << csvField(key);
+    ts << QStringLiteral(
+              ",origin,destination,discovery_rank,sweep_rank,selected,"
+              "execution_path_key,predicted_total_cost,"
+              "predicted_edge_cost,predicted_terminal_cost,"
+              "predicted_distance_km,predicted_travel_time_h,"
+              "simulated_by_variant,simulated_total_cost")
+       << LF;
+
+    for (const auto &variant : variants)
+    {
+        QString prefix = QString::number(variant.index);
+        for (const auto &key : parameterKeys)
+            prefix += SEP + csvField(variant.parameters.value(key).toString());
+
+        const auto simulated =
+            simulatedTotalCosts.value(variant.index);
+        for (const auto &path : variant.paths)
+        {
+            const bool selected =
+                variant.selectedExecutionPathKeys.contains(
+                    path.executionPathKey);
+            const auto actual = simulated.constFind(path.executionPathKey);
+            ts << prefix << SEP
+               << csvField(path.key.originId) << SEP
+               << csvField(path.key.destinationId) << SEP
+               << path.key.rank << SEP
+               << path.sweepRank << SEP
+               << (selected ? 1 : 0) << SEP
+               << csvField(path.executionPathKey) << SEP
+               << fixed(path.totalCost) << SEP
+               << fixed(path.edgeCost) << SEP
+               << fixed(path.terminalCost) << SEP
+               << fixed(path.metrics.distanceKm) << SEP
+               << fixed(path.metrics.travelTimeHours) << SEP
+               << (selected ? QString::number(variant.simulatedByVariant)
+                            : QString())
+               << SEP
+               << (selected && actual != simulated.constEnd()
+                       ? fixed(actual.value())
+                       : QString())
+               << LF;
+        }
+    }
+
+    ts.flush();
+    if (!f.commit())
+    {
+        qCWarning(lcCli) << "SweepTableWriter::write: cannot commit"
+                         << outputPath << f.errorString();
+        if (err)
+            *err = QStringLiteral("Cannot commit %1: %2")
+                       .arg(outputPath, f.errorString());
+        return false;
+    }
+    return true;
+}
+
+} // namespace Cli
+} // namespace CargoNetSim
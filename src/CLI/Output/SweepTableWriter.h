@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+#include "Backend/Application/ParameterSweepService.h"
+
+namespace CargoNetSim {
+namespace Cli {
+
+/**
+ * @brief Emit the consolidated `sweep.csv` table of a parameter sweep.
+ *
+ * One row per (variant, prepared path):
+ * @code
+ * variant,<parameter keys...>,origin,destination,discovery_rank,
+ * sweep_rank,selected,execution_path_key,predicted_total_cost,
+ * predicted_edge_cost,predicted_terminal_cost,predicted_distance_km,
+ * predicted_travel_time_h,simulated_by_variant,simulated_total_cost
+ * @endcode
+ *
+ * `simulated_by_variant` names the variant whose simulation produced
+ * the actual metrics; variants with the same selected path set share
+ * one run, but `simulated_total_cost` is always priced with the row's
+ * own weights. It is empty for paths that were not selected or have
+ * no simulated result.
+ *
+ * Same file conventions as `CsvResultsWriter`: LF line endings, UTF-8
+ * without BOM, `%.6f` numbers, atomic write via `QSaveFile`, and the
+ * caller creates the parent directory.
+ */
+class SweepTableWriter
+{
+public:
+    /**
+     * @param simulatedTotalCosts  Per variant index, the simulated
+     *                             total cost by execution path key,
+     *                             re-costed with that variant's
+     *                             weights (see
+     *                             ParameterSweep::simulatedTotalCosts).
+     */
+    bool write(
+        const QString     &outputPath,
+        const QStringList &parameterKeys,
+        const QList<CargoNetSim::Backend::Scenario::ParameterSweepVariant>
+                          &variants,
+        const QHash<int, QHash<QString, double>> &simulatedTotalCosts,
+        QString           *err);
+};
+
+} // namespace Cli
+} // namespace CargoNetSim
@@ -15,11 +15,13 @@
 #include <QLoggingCategory>
 #include <QString>
 #include <QStringList>
+#include <QTextStream>
 
 #include <memory>
 
 #include "Backend/Bootstrap/BackendBootstrapService.h"
 #include "Backend/Commons/LogMessageHandler.h"
+#include "Backend/Commons/Trace.h"
 #include "Backend/Controllers/CargoNetSimController.h"
 #include "SubcommandDispatcher.h"
 
@@ -28,7 +30,9 @@
 #include "Commands/DiscoverCommand.h"
 #include "Commands/PreviewCommand.h"
 #include "Commands/RunCommand.h"
+#include "Commands/SweepCommand.h"
 #include "Commands/ValidateCommand.h"
+#include "ExitCodes.h"
 
 int main(int argc, char *argv[])
 {
@@ -94,6 +98,8 @@ int main(int argc, char *argv[])
 
     d.registerCommand(QStringLiteral("run"),
                       std::make_shared<RunCommand>());
+    d.registerCommand(QStringLiteral("sweep"),
+                      std::make_shared<SweepCommand>());
     d.registerCommand(QStringLiteral("validate"),
                       std::make_shared<ValidateCommand>());
     d.registerCommand(QStringLiteral("preview"),
@@ -118,5 +124,42 @@ int main(int argc, char *argv[])
     for (int i = 1; i < argc; ++i)
         args << QString::fromLocal8Bit(argv[i]);
 
-    return d.run(args);
+    // Global `--trace FILE`: record spans for the whole invocation and
+    // write them as Chrome trace JSON once the subcommand returns.
+    QString tracePath;
+    for (int i = 0; i < args.size(); ++i)
+    {
+        if (args[i] == QLatin1String("--trace"))
+        {
+            if (i + 1 >= args.size())
+            {
+                QTextStream(stderr)
+                    << "cargonetsim-cli: --trace requires a file path\n";
+                return static_cast<int>(ExitCode::BadArgs);
+            }
+            tracePath = args[i + 1];
+            args.remove(i, 2);
+            break;
+        }
+        if (args[i].startsWith(QLatin1String("--trace=")))
+        {
+            tracePath = args[i].mid(8);
+            args.removeAt(i);
+            break;
+        }
+    }
+    if (tracePath.isEmpty())
+        return d.run(args);
+
+    namespace Trace = CargoNetSim::Backend::Trace;
+    Trace::start();
+    const int rc = d.run(args);
+    Trace::stop();
+    QString traceError;
+    if (!Trace::writeChromeTrace(tracePath, &traceError))
+    {
+        QTextStream(stderr)
+            << "cargonetsim-cli: trace not written: " << traceError << "\n";
+    }
+    return rc;
 }
@@ -11,6 +11,7 @@
 
 #include <QColor>
 #include <QFileDialog>
+#include <QHash>
 #include <QInputDialog>
 #include <QMap>
 #include "Backend/Commons/LogCategories.h"
@@ -544,25 +545,22 @@ QList<MapLine *> NetworkController::getShortestPathMapLines(
         return pathMapLines;
     }
 
-    // Get all map lines in the scene
-    QList<MapLine *> allMapLines =
-        mainWindow->regionScene_->getItemsByType<MapLine>();
+    // Index the scene's map lines by referenced link once, then
+    // resolve each path segment with a single lookup.
+    QHash<QString, MapLine *> linesByLink;
+    for (MapLine *mapLine :
+         mainWindow->regionScene_->itemsOfType<MapLine>())
+    {
+        const QString linkId = mapLine->getReferencedNetworkLinkID();
+        if (!linesByLink.contains(linkId))
+            linesByLink.insert(linkId, mapLine);
+    }
 
-    // Find map lines that correspond to segments in the
-    // shortest path
     for (int linkID : result.pathLinks)
     {
-
-        for (MapLine *mapLine : allMapLines)
-        {
-            if (mapLine->getReferencedNetworkLinkID()
-                == QString::number(linkID))
-            {
-                pathMapLines.append(mapLine);
-                break; // Found the line for this segment,
-                       // move to next
-            }
-        }
+        if (MapLine *mapLine =
+                linesByLink.value(QString::number(linkID)))
+            pathMapLines.append(mapLine);
     }
 
     return pathMapLines;
@@ -137,6 +137,7 @@ void NetworkDrawingController::removeNetwork(
                 << "train network not found";
             return;
         }
+        QStringList pointIds;
         for (auto &node : network->getNodes())
         {
             if (!node)
@@ -154,17 +155,18 @@ void NetworkDrawingController::removeNetwork(
             point->setProperty("Show on Global Map", false);
             m_terminalCtrl->updateGlobalMapItem(terminal);
 
-            m_regionScene->removeItemWithId<MapPoint>(
-                node->getInternalUniqueID());
+            pointIds << node->getInternalUniqueID();
         }
+        QStringList lineIds;
         for (auto &link : network->getLinks())
         {
             if (!link)
                 continue;
 
-            m_regionScene->removeItemWithId<MapLine>(
-                link->getInternalUniqueID());
+            lineIds << link->getInternalUniqueID();
         }
+        m_regionScene->removeItemsWithIds<MapPoint>(pointIds);
+        m_regionScene->removeItemsWithIds<MapLine>(lineIds);
     }
     else if (networkType == NetworkType::Truck)
     {
@@ -178,6 +180,7 @@ void NetworkDrawingController::removeNetwork(
                 << "truck network not found";
             return;
         }
+        QStringList pointIds;
         for (auto &node : network->getNodes())
         {
             MapPoint *point =
@@ -192,14 +195,15 @@ void NetworkDrawingController::removeNetwork(
             point->setProperty("Show on Global Map", false);
             m_terminalCtrl->updateGlobalMapItem(terminal);
 
-            m_regionScene->removeItemWithId<MapPoint>(
-                node->getInternalUniqueID());
-        }
-        for (auto &link : network->getLinks())
-        {
-            m_regionScene->removeItemWithId<MapLine>(
-                link->getInternalUniqueID());
+            pointIds << node->getInternalUniqueID();
         }
+        const auto  links = network->getLinks();
+        QStringList lineIds;
+        lineIds.reserve(links.size());
+        for (auto *link : links)
+            lineIds << link->getInternalUniqueID();
+        m_regionScene->removeItemsWithIds<MapPoint>(pointIds);
+        m_regionScene->removeItemsWithIds<MapLine>(lineIds);
     }
 }
 
@@ -225,14 +229,11 @@ bool NetworkDrawingController::moveNetworkItems(
     bool usingProjectedCoords =
         m_regionView->isUsingProjectedCoords();
 
-    QList<MapPoint *> mapPoints =
-        m_regionScene->getItemsByType<MapPoint>();
-    QList<MapLine *> mapLines =
-        m_regionScene->getItemsByType<MapLine>();
-
     int itemsUpdated = 0;
 
-    for (MapPoint *point : mapPoints)
+    // Moving items does not change registry membership, so the
+    // in-place views are safe here.
+    for (MapPoint *point : m_regionScene->itemsOfType<MapPoint>())
     {
         if (point->getRegion() != regionName)
             continue;
@@ -273,7 +274,7 @@ bool NetworkDrawingController::moveNetworkItems(
         itemsUpdated++;
     }
 
-    for (MapLine *line : mapLines)
+    for (MapLine *line : m_regionScene->itemsOfType<MapLine>())
     {
         if (line->getRegion() != regionName)
             continue;
@@ -346,6 +347,10 @@ void NetworkDrawingController::drawTrainNetwork(
     qCDebug(lcRail) << "[RailDraw] drawing nodes, count="
              << nodes.size();
 
+    ItemBatch nodeItems;
+    nodeItems.reserve(nodes.size());
+    QList<QPair<Backend::TrainClient::NeTrainSimNode *, MapPoint *>>
+        terminalNodes;
     int nodeIdx = 0;
     for (auto &node : nodes)
     {
@@ -370,7 +375,7 @@ void NetworkDrawingController::drawTrainNetwork(
         qCDebug(lcRail) << "[RailDraw]   calling drawNode"
                         << "projected=" << projectedPoint;
         MapPoint *point = drawNode(
-            QString::number(node->getUserId()),
+            nodeItems, QString::number(node->getUserId()),
             node->getInternalUniqueID(), projectedPoint,
             regionName, nodesColor, properties);
         qCDebug(lcRail) << "[RailDraw]   drawNode returned"
@@ -385,54 +390,60 @@ void NetworkDrawingController::drawTrainNetwork(
         point->setReferenceNetwork(network);
 
         if (!skipTerminalCreation && point && node->isTerminal())
+            terminalNodes.append({node, point});
+        ++nodeIdx;
+    }
+    m_regionScene->addItemsWithIds(nodeItems);
+    qCDebug(lcRail) << "[RailDraw] nodes drawn";
+
+    // Terminals are created once the nodes are registered, so anything
+    // reacting to the new linkage finds its MapPoint in the scene.
+    for (const auto &[node, point] : terminalNodes)
+    {
+        qCDebug(lcRail)
+            << "[RailDraw]   calling createTerminalAtPoint";
+        auto terminal =
+            m_terminalCtrl->createTerminalAtPoint(
+                regionName,
+                "Intermodal Land Terminal",
+                point->getSceneCoordinate());
+        qCDebug(lcRail)
+            << "[RailDraw]   createTerminalAtPoint returned"
+            << (terminal ? "terminal" : "null");
+
+        if (terminal && m_mainWindow->runtime())
         {
-            qCDebug(lcRail)
-                << "[RailDraw]   calling createTerminalAtPoint";
-            auto terminal =
-                m_terminalCtrl->createTerminalAtPoint(
-                    regionName,
-                    "Intermodal Land Terminal",
-                    point->getSceneCoordinate());
-            qCDebug(lcRail)
-                << "[RailDraw]   createTerminalAtPoint returned"
-                << (terminal ? "terminal" : "null");
-
-            if (terminal && m_mainWindow->runtime())
+            const QString terminalId = terminal->getTerminalId();
+            const bool linked =
+                Backend::Application::ScenarioEditService::
+                    linkTerminalToNode(
+                        &m_mainWindow->runtime()->document(),
+                        terminalId,
+                        networkName,
+                        node->getUserId(),
+                        Backend::Scenario::LinkageSource::Manual);
+            if (linked)
             {
-                const QString terminalId = terminal->getTerminalId();
-                const bool linked =
-                    Backend::Application::ScenarioEditService::
-                        linkTerminalToNode(
-                            &m_mainWindow->runtime()->document(),
-                            terminalId,
-                            networkName,
-                            node->getUserId(),
-                            Backend::Scenario::LinkageSource::Manual);
-                if (linked)
-                {
-                    point->setLinkedTerminal(terminal);
-                    qCDebug(lcRail) << "[RailDraw]   NodeLinkage written"
-                                    << "terminal=" << terminalId
-                                    << "nodeId="   << node->getUserId();
-                }
-                else
-                {
-                    qCWarning(lcRail)
-                        << "[RailDraw]   NodeLinkage creation failed"
-                        << "terminal=" << terminalId
-                        << "nodeId=" << node->getUserId();
-                }
+                point->setLinkedTerminal(terminal);
+                qCDebug(lcRail) << "[RailDraw]   NodeLinkage written"
+                                << "terminal=" << terminalId
+                                << "nodeId="   << node->getUserId();
             }
-            else if (terminal)
+            else
             {
                 qCWarning(lcRail)
-                    << "[RailDraw]   terminal was created without runtime;"
-                    << "refusing view-only node link";
+                    << "[RailDraw]   NodeLinkage creation failed"
+                    << "terminal=" << terminalId
+                    << "nodeId=" << node->getUserId();
             }
         }
-        ++nodeIdx;
+        else if (terminal)
+        {
+            qCWarning(lcRail)
+                << "[RailDraw]   terminal was created without runtime;"
+                << "refusing view-only node link";
+        }
     }
-    qCDebug(lcRail) << "[RailDraw] nodes drawn";
 
     // Process events to keep UI responsive
     QApplication::processEvents();
@@ -440,6 +451,8 @@ void NetworkDrawingController::drawTrainNetwork(
     auto linksVec = network->getLinks();
     qCDebug(lcRail) << "[RailDraw] drawing links, count="
              << linksVec.size();
+    ItemBatch linkItems;
+    linkItems.reserve(linksVec.size());
     int linkIdx = 0;
     for (auto &link : linksVec)
     {
@@ -466,7 +479,7 @@ void NetworkDrawingController::drawTrainNetwork(
              link->scaledMaxSpeedUnits().value()}};
 
         auto line = drawLink(
-            QString::number(link->getUserId()),
+            linkItems, QString::number(link->getUserId()),
             link->getInternalUniqueID(),
             projectedSourcePoint, projectedDestPoint,
             regionName, linksColor, properties);
@@ -480,6 +493,7 @@ void NetworkDrawingController::drawTrainNetwork(
         line->setReferenceNetwork(network);
         ++linkIdx;
     }
+    m_regionScene->addItemsWithIds(linkItems);
     qCDebug(lcRail) << "[RailDraw] links drawn";
 
     // Fit the view to the scene
@@ -521,13 +535,16 @@ void NetworkDrawingController::drawTruckNetwork(
     // set the network Color
     network->setVariable("color", linksColor);
 
-    for (auto &node : network->getNodes())
+    const auto nodes = network->getNodes();
+    ItemBatch  nodeItems;
+    nodeItems.reserve(nodes.size());
+    for (auto &node : nodes)
     {
         QMap<QString, QVariant> properties = {
             {"Description", node->getDescription()}};
 
         auto point = drawNode(
-            QString::number(node->getNodeId()),
+            nodeItems, QString::number(node->getNodeId()),
             node->getInternalUniqueID(),
             QPointF(truckCoordinateMeters(
                         node->getXCoordinate()
@@ -539,11 +556,15 @@ void NetworkDrawingController::drawTruckNetwork(
 
         point->setReferenceNetwork(network);
     }
+    m_regionScene->addItemsWithIds(nodeItems);
 
     // Process events to keep UI responsive
     QApplication::processEvents();
 
-    for (auto &link : network->getLinks())
+    const auto links = network->getLinks();
+    ItemBatch  linkItems;
+    linkItems.reserve(links.size());
+    for (auto &link : links)
     {
         QMap<QString, QVariant> properties = {
             {"ReferenceNetworkID", link->getLinkId()},
@@ -577,13 +598,14 @@ void NetworkDrawingController::drawTruckNetwork(
                         to->getYCoordinate() * to->getYScale()));
 
         auto line = drawLink(
-            QString::number(link->getLinkId()),
+            linkItems, QString::number(link->getLinkId()),
             link->getInternalUniqueID(),
             projectedSourcePoint, projectedDestPoint,
             regionName, linksColor, properties);
 
         line->setReferenceNetwork(network);
     }
+    m_regionScene->addItemsWithIds(linkItems);
 
     // Fit the view to the scene
     m_regionView->fitInView(
@@ -595,6 +617,7 @@ void NetworkDrawingController::drawTruckNetwork(
 }
 
 MapPoint *NetworkDrawingController::drawNode(
+    ItemBatch     &batch,
     const QString &networkNodeID,
     const QString &nodeUniqueID,
     QPointF        projectedPoint,
@@ -626,12 +649,13 @@ MapPoint *NetworkDrawingController::drawNode(
     point->setProperty("NodeID", nodeUniqueID);
     point->setColor(color);
 
-    m_regionScene->addItemWithId(point, nodeUniqueID);
+    batch.append({point, nodeUniqueID});
 
     return point;
 }
 
 MapLine *NetworkDrawingController::drawLink(
+    ItemBatch     &batch,
     const QString &networkNodeID,
     const QString &linkUniqueID,
     QPointF        projectedStartPoint,
@@ -664,7 +688,7 @@ MapLine *NetworkDrawingController::drawLink(
         line->setProperty("LinkID", linkUniqueID);
         line->setColor(color);
 
-        m_regionScene->addItemWithId(line, linkUniqueID);
+        batch.append({line, linkUniqueID});
     }
     catch (const std::exception &e)
     {
@@ -4,7 +4,9 @@
 #include <QColor>
 #include <QPointF>
 #include <QString>
+#include <QList>
 #include <QMap>
+#include <QPair>
 #include <QVariant>
 
 #include "GUI/Commons/NetworkType.h"
@@ -33,6 +35,7 @@ class GraphicsView;
 class TerminalController;
 class MainWindow;
 class StatusReporter;
+class GraphicsObjectBase;
 class MapPoint;
 class MapLine;
 
@@ -78,7 +81,12 @@ private:
                 *networkConfig,
         const QString &regionName, QColor &linksColor);
 
-    MapPoint *drawNode(const QString &networkNodeID,
+    /// Items built by drawNode / drawLink, registered in one
+    /// GraphicsScene::addItemsWithIds call per network.
+    using ItemBatch = QList<QPair<GraphicsObjectBase *, QString>>;
+
+    MapPoint *drawNode(ItemBatch     &batch,
+                       const QString &networkNodeID,
                        const QString &nodeUniqueID,
                        QPointF        projectedPoint,
                        const QString &regionName,
@@ -86,7 +94,8 @@ private:
                        const QMap<QString, QVariant> &properties =
                            QMap<QString, QVariant>());
 
-    MapLine *drawLink(const QString &networkNodeID,
+    MapLine *drawLink(ItemBatch     &batch,
+                      const QString &networkNodeID,
                       const QString &linkUniqueID,
                       QPointF        projectedStartPoint,
                       QPointF        projectedEndPoint,
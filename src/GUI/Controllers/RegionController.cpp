@@ -266,40 +266,30 @@ void RegionController::removeRegion(const QString &name)
 
     // Step 2 — scene-only sweep. MapPoint / MapLine / BackgroundPhotoItem
     // are not tracked by ScenarioDocument, so the cascade above does not
-    // cover them. Snapshot the region-owned items, then delete each
-    // through the registry-aware path (removeItemWithId) so itemsByType
-    // stays consistent — never raw `delete` and never QGraphicsScene::
-    // removeItem directly. Two-pass (collect keys, then remove) avoids
-    // mutating the scene item list while iterating it.
-    QStringList mapPointKeys;
-    QStringList mapLineKeys;
-    QStringList backgroundPhotoKeys;
-    const auto snapshot = m_regionScene->items();
-    for (QGraphicsItem *item : snapshot)
-    {
-        if (auto *p = qgraphicsitem_cast<MapPoint *>(item))
-        {
-            if (p->getRegion() == name)
-                mapPointKeys << p->sceneRegistryKey();
-        }
-        else if (auto *l = qgraphicsitem_cast<MapLine *>(item))
+    // cover them. Collect the region-owned ids from the per-type registry
+    // views, then delete them through the registry-aware bulk path
+    // (removeItemsWithIds) so the registry stays consistent — never raw
+    // `delete` and never QGraphicsScene::removeItem directly. Two-pass
+    // (collect keys, then remove) because removal invalidates the views.
+    auto regionKeys = [&name](const auto &view) {
+        QStringList keys;
+        for (auto it = view.begin(); it != view.end(); ++it)
         {
-            if (l->getRegion() == name)
-                mapLineKeys << l->sceneRegistryKey();
+            if ((*it)->getRegion() == name)
+                keys << it.key();
         }
-        else if (auto *bp =
-                     qgraphicsitem_cast<BackgroundPhotoItem *>(item))
-        {
-            if (bp->getRegion() == name)
-                backgroundPhotoKeys << bp->sceneRegistryKey();
-        }
-    }
-    for (const QString &k : std::as_const(mapPointKeys))
-        m_regionScene->removeItemWithId<MapPoint>(k);
-    for (const QString &k : std::as_const(mapLineKeys))
-        m_regionScene->removeItemWithId<MapLine>(k);
-    for (const QString &k : std::as_const(backgroundPhotoKeys))
-        m_regionScene->removeItemWithId<BackgroundPhotoItem>(k);
+        return keys;
+    };
+    const QStringList mapPointKeys =
+        regionKeys(m_regionScene->itemsOfType<MapPoint>());
+    const QStringList mapLineKeys =
+        regionKeys(m_regionScene->itemsOfType<MapLine>());
+    const QStringList backgroundPhotoKeys =
+        regionKeys(m_regionScene->itemsOfType<BackgroundPhotoItem>());
+    m_regionScene->removeItemsWithIds<MapPoint>(mapPointKeys);
+    m_regionScene->removeItemsWithIds<MapLine>(mapLineKeys);
+    m_regionScene->removeItemsWithIds<BackgroundPhotoItem>(
+        backgroundPhotoKeys);
     qCDebug(lcGuiView)
         << "RegionController::removeRegion: scene-only sweep removed"
         << "mapPoints=" << mapPointKeys.size()
@@ -12,12 +12,49 @@
 #include "GUI/Widgets/GraphicsScene.h"
 #include "StatusReporter.h"
 #include <QApplication>
+#include <QHash>
 
 namespace CargoNetSim
 {
 namespace GUI
 {
 
+namespace
+{
+
+/// Predicate "network object is called @p networkName", memoised per
+/// network object.
+auto makeNetworkMatcher(const QString &networkName)
+{
+    return [networkName,
+            cache = QHash<QObject *, bool>()](QObject *network) mutable {
+        if (!network)
+            return false;
+        auto hit = cache.constFind(network);
+        if (hit != cache.constEnd())
+            return *hit;
+        Backend::Application::NetworkViewService networkView;
+        const bool match =
+            networkView.networkNameOf(network) == networkName;
+        cache.insert(network, match);
+        return match;
+    };
+}
+
+/// Show the registered @p T items of @p region and hide the rest.
+template <typename T>
+void showOnlyRegion(GraphicsScene *scene, const QString &region)
+{
+    scene->setItemsVisible<T>(true, [&region](T *item) {
+        return item->getRegion() == region;
+    });
+    scene->setItemsVisible<T>(false, [&region](T *item) {
+        return item->getRegion() != region;
+    });
+}
+
+} // namespace
+
 SceneVisibilityController::SceneVisibilityController(
     GraphicsScene  *regionScene,
     GraphicsScene  *globalMapScene,
@@ -51,61 +88,14 @@ void SceneVisibilityController::updateSceneVisibility()
     const QString currentRegion =
         networkView.currentRegionName();
 
-    for (auto item : m_regionScene->items())
-    {
-        // Check if item is a terminal
-        TerminalItem *terminal =
-            dynamic_cast<TerminalItem *>(item);
-        if (terminal)
-        {
-            terminal->setVisible(terminal->getRegion()
-                                 == currentRegion);
-        }
-
-        // Check if item is a connection line
-        ConnectionLine *connectionLine =
-            dynamic_cast<ConnectionLine *>(item);
-        if (connectionLine)
-        {
-            connectionLine->setVisible(
-                connectionLine->getRegion()
-                == currentRegion);
-        }
-
-        // Check if item is a region center
-        RegionCenterPoint *regionCenter =
-            dynamic_cast<RegionCenterPoint *>(item);
-        if (regionCenter)
-        {
-            regionCenter->setVisible(
-                regionCenter->getRegion() == currentRegion);
-        }
-
-        // Check if item is a map point
-        MapPoint *mapPoint = dynamic_cast<MapPoint *>(item);
-        if (mapPoint)
-        {
-            mapPoint->setVisible(mapPoint->getRegion()
-                                 == currentRegion);
-        }
-
-        // Check if item is a map line
-        MapLine *mapLine = dynamic_cast<MapLine *>(item);
-        if (mapLine)
-        {
-            mapLine->setVisible(mapLine->getRegion()
-                                == currentRegion);
-        }
-
-        BackgroundPhotoItem *backgroundPhoto =
-            dynamic_cast<BackgroundPhotoItem *>(item);
-        if (backgroundPhoto)
-        {
-            backgroundPhoto->setVisible(
-                backgroundPhoto->getRegion()
-                == currentRegion);
-        }
-    }
+    // Every region-owned item kind is tracked by the scene registry,
+    // so walk the per-type buckets instead of casting every scene item.
+    showOnlyRegion<TerminalItem>(m_regionScene, currentRegion);
+    showOnlyRegion<ConnectionLine>(m_regionScene, currentRegion);
+    showOnlyRegion<RegionCenterPoint>(m_regionScene, currentRegion);
+    showOnlyRegion<MapPoint>(m_regionScene, currentRegion);
+    showOnlyRegion<MapLine>(m_regionScene, currentRegion);
+    showOnlyRegion<BackgroundPhotoItem>(m_regionScene, currentRegion);
 }
 
 // ─── showFilteredConnections ────────────────────────────
@@ -283,40 +273,17 @@ void SceneVisibilityController::changeNetworkVisibility(
         return;
     }
 
-    auto checkNetworkAndSetVisibility =
-        [&networkName,
-         isVisible](const QString &itemNetworkName,
-                    QGraphicsItem *graphicsItem) {
-            if (itemNetworkName == networkName)
-            {
-                graphicsItem->setVisible(isVisible);
-            }
-        };
-
-    auto mapPoints =
-        m_regionScene->getItemsByType<MapPoint>();
-    auto mapLines =
-        m_regionScene->getItemsByType<MapLine>();
-
-    for (auto mapPoint : mapPoints)
-    {
-        Backend::Application::NetworkViewService networkView;
-        const QString name =
-            networkView.networkNameOf(
-                mapPoint->getReferenceNetwork());
-        if (!name.isEmpty())
-            checkNetworkAndSetVisibility(name, mapPoint);
-    }
-
-    for (auto mapLine : mapLines)
-    {
-        Backend::Application::NetworkViewService networkView;
-        const QString name =
-            networkView.networkNameOf(
-                mapLine->getReferenceNetwork());
-        if (!name.isEmpty())
-            checkNetworkAndSetVisibility(name, mapLine);
-    }
+    // Every item of a network shares one reference network, so its
+    // name is resolved once per network rather than once per item.
+    auto isTarget = makeNetworkMatcher(networkName);
+    m_regionScene->setItemsVisible<MapPoint>(
+        isVisible, [&isTarget](MapPoint *point) {
+            return isTarget(point->getReferenceNetwork());
+        });
+    m_regionScene->setItemsVisible<MapLine>(
+        isVisible, [&isTarget](MapLine *line) {
+            return isTarget(line->getReferenceNetwork());
+        });
 }
 
 // ─── changeNetworkColor ─────────────────────────────────
@@ -339,31 +306,17 @@ void SceneVisibilityController::changeNetworkColor(
     QColor newDarkerColor =
         newColor.darker(150); // 150% darker for MapPoints
 
-    auto mapPoints =
-        m_regionScene->getItemsByType<MapPoint>();
-    auto mapLines =
-        m_regionScene->getItemsByType<MapLine>();
-
-    for (auto mapPoint : mapPoints)
+    auto isTarget = makeNetworkMatcher(networkName);
+    for (MapPoint *mapPoint : m_regionScene->itemsOfType<MapPoint>())
     {
-        Backend::Application::NetworkViewService networkView;
-        if (networkView.networkNameOf(
-                mapPoint->getReferenceNetwork())
-            == networkName)
-        {
+        if (isTarget(mapPoint->getReferenceNetwork()))
             mapPoint->setColor(newDarkerColor);
-        }
     }
 
-    for (auto mapLine : mapLines)
+    for (MapLine *mapLine : m_regionScene->itemsOfType<MapLine>())
     {
-        Backend::Application::NetworkViewService networkView;
-        if (networkView.networkNameOf(
-                mapLine->getReferenceNetwork())
-            == networkName)
-        {
+        if (isTarget(mapLine->getReferenceNetwork()))
             mapLine->setColor(newColor);
-        }
     }
 }
 
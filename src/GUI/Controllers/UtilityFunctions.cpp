@@ -916,14 +916,8 @@ void CargoNetSim::GUI::UtilitiesFunctions::
                              ->setExecutionProgress(
                                  rt->progressSnapshot());
 
-                         // Monetary costs — pre-existing behavior.
-                         for (const auto &r : rt->results())
-                             mainWindow->shortestPathTable_
-                                 ->updateSimulationCosts(
-                                     r.canonicalPathKey,
-                                     r.totalCost,
-                                     r.edgeCosts, r.terminalCosts);
-
+                         // Monetary costs ride along with the typed
+                         // results; the table applies them in one batch.
                          mainWindow->shortestPathTable_
                              ->setExecutionResults(
                                  rt->executionResults());
@@ -30,7 +30,7 @@ void UnlinkTerminalCommand::redo()
 {
     if (!m_doc) { setObsolete(true); return; }
     if (!m_captured) {
-        for (const auto &l : m_doc->linkages) {
+        for (const auto &l : m_doc->linkages()) {
             if (l.terminalId  == m_terminalId
              && l.networkName == m_networkName
              && l.nodeId      == m_nodeId) {
@@ -2,6 +2,7 @@
 
 #include "../../Backend/Commons/LogCategories.h"
 #include "../../Backend/Scenario/ScenarioDocument.h"
+#include "../Items/NetworkLayerItem.h"
 #include "../MainWindow.h"
 #include "../Widgets/GraphicsScene.h"
 #include "../Widgets/GraphicsView.h"
@@ -375,6 +376,20 @@ ClickContext InteractionController::buildContext(const InputEvent& event)
         const QTransform dt = m_view ? m_view->viewportTransform() : QTransform();
         QList<QGraphicsItem*> items = m_scene->items(
             ctx.scenePos, Qt::IntersectsItemShape, Qt::DescendingOrder, dt);
+        // Batched network items have no shape of their own; the layer
+        // that draws them answers for them through its spatial index.
+        // Swap it for the item it found so modes and items never see it.
+        for (int i = 0; i < items.size();) {
+            if (auto* layer = qgraphicsitem_cast<NetworkLayerItem*>(items[i])) {
+                if (QGraphicsItem* hit = layer->batchedItemAt(ctx.scenePos)) {
+                    items[i++] = hit;
+                } else {
+                    items.removeAt(i);
+                }
+            } else {
+                ++i;
+            }
+        }
         ctx.itemsUnderCursor = items;
         if (!items.isEmpty()) {
             ctx.target = items.first();
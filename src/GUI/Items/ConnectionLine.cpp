@@ -153,13 +153,13 @@ void ConnectionLine::unbindModel()
     m_binding = BindingKind::Unbound;
 }
 
-Backend::Scenario::Connection *ConnectionLine::connectionModel() const
+const Backend::Scenario::Connection *ConnectionLine::connectionModel() const
 {
     if (m_binding != BindingKind::Connection || !m_doc) return nullptr;
     return m_doc->findConnection(m_fromId, m_toId, m_connectionType);
 }
 
-Backend::Scenario::GlobalLink *ConnectionLine::globalLinkModel() const
+const Backend::Scenario::GlobalLink *ConnectionLine::globalLinkModel() const
 {
     if (m_binding != BindingKind::GlobalLink || !m_doc) return nullptr;
     return m_doc->findGlobalLink(m_fromId, m_toId, m_connectionType);
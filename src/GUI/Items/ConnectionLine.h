@@ -111,7 +111,7 @@ public:
      * @brief Bind this line to a region-level Connection identified by
      *        (fromTerminalId, toTerminalId, mode) in @p doc.
      *
-     * Storage is the key triple — NOT a pointer into `doc->connections`.
+     * Storage is the key triple — NOT a pointer into `doc->connections()`.
      * That QList reshuffles element addresses on every insert/remove, so
      * any raw `Connection*` held across a mutation becomes dangling.
      * `connectionModel()` re-resolves the triple to a live pointer on
@@ -128,7 +128,7 @@ public:
         Backend::TransportationTypes::TransportationMode  mode);
 
     /// GlobalLink counterpart of bindToConnection. Same stable-key
-    /// invariant; resolves against `doc->globalLinks`.
+    /// invariant; resolves against `doc->globalLinks()`.
     void bindToGlobalLink(
         Backend::Scenario::ScenarioDocument              *doc,
         const QString                                    &fromTerminalId,
@@ -143,12 +143,12 @@ public:
     /// document's connections list, returning the current live Connection
     /// pointer or nullptr if the entry has been removed, the binding is a
     /// GlobalLink instead, or the doc is gone.
-    Backend::Scenario::Connection *connectionModel() const;
+    const Backend::Scenario::Connection *connectionModel() const;
 
-    /// Resolve the stored triple against `doc->globalLinks`. Returns
+    /// Resolve the stored triple against `doc->globalLinks()`. Returns
     /// nullptr when the binding is a Connection instead, when the entry
     /// is gone, or when the doc is gone.
-    Backend::Scenario::GlobalLink *globalLinkModel() const;
+    const Backend::Scenario::GlobalLink *globalLinkModel() const;
 
     /// True iff the line is bound as a region Connection view (regardless
     /// of whether the entry currently exists in the doc). Useful for
@@ -270,7 +270,7 @@ private:
     static int CONNECTION_LINE_ID;
 
     /// Stable-key binding to a ScenarioDocument entity. Raw pointers into
-    /// doc->connections / doc->globalLinks are not stored because those
+    /// doc->connections() / doc->globalLinks() are not stored because those
     /// QLists reshuffle element addresses on any mutation. Instead we
     /// keep the natural identity triple and the owning document, and
     /// resolve to a live pointer on demand.
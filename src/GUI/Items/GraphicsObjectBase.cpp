@@ -158,6 +158,12 @@ QVariant GraphicsObjectBase::itemChange(
     case ItemPositionHasChanged:
         m_draggingSincePress = true;
         break;
+    case ItemVisibleHasChanged:
+    case ItemSelectedHasChanged:
+        // Batched network items are drawn by the scene's layer.
+        if (auto* gs = qobject_cast<GraphicsScene*>(scene()))
+            gs->networkItemChanged(this, false);
+        break;
     default:
         break;
     }
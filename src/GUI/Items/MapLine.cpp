@@ -59,6 +59,8 @@ void MapLine::setColor(const QColor &color)
         pen.setColor(color);
         emit colorChanged(color);
         update();
+        if (auto *gs = qobject_cast<GraphicsScene *>(scene()))
+            gs->networkItemChanged(this, false);
     }
 }
 
@@ -79,6 +81,8 @@ void MapLine::setPen(const QPen &newPen)
         }
 
         update();
+        if (auto *gs = qobject_cast<GraphicsScene *>(scene()))
+            gs->networkItemChanged(this, false);
     }
 }
 
@@ -89,9 +93,20 @@ void MapLine::setPoints(const QPointF &newStartPoint,
         << "MapLine::setPoints:"
         << "start=" << newStartPoint
         << "end=" << newEndPoint;
+    prepareGeometryChange();
     startPoint = newStartPoint;
     endPoint   = newEndPoint;
     update();
+    if (auto *gs = qobject_cast<GraphicsScene *>(scene()))
+        gs->networkItemChanged(this, true);
+}
+
+void MapLine::setBatched(bool batched)
+{
+    if (m_batched == batched)
+        return;
+    m_batched = batched;
+    setFlag(QGraphicsItem::ItemHasNoContents, batched);
 }
 
 QRectF MapLine::boundingRect() const
@@ -110,7 +125,11 @@ QPainterPath MapLine::shape() const
     // covers a large rectangular region that steals clicks from items
     // rendered beneath the line (e.g. MapPoint nodes, TerminalItems). We
     // return a narrow stroked path along the line itself so hit-testing
-    // matches what the user sees.
+    // matches what the user sees. Batched lines are hit-tested by the
+    // NetworkLayerItem's index instead.
+    if (m_batched)
+        return QPainterPath();
+
     QPainterPath line;
     line.moveTo(startPoint);
     line.lineTo(endPoint);
@@ -128,23 +147,17 @@ void MapLine::paint(QPainter                       *painter,
                     const QStyleOptionGraphicsItem *option,
                     QWidget                        *widget)
 {
-    qCDebug(lcGuiScene)
-        << "MapLine::paint:"
-        << "start=" << startPoint
-        << "end=" << endPoint;
+    Q_UNUSED(widget);
 
-    // Get the current view scale
-    QGraphicsScene *itemScene = scene();
-    if (!itemScene || itemScene->views().isEmpty())
+    // Scale the pen width inversely to maintain constant
+    // visual thickness. The painter already carries the view
+    // transform, so no view lookup is needed per paint.
+    const qreal viewScale = option->levelOfDetailFromTransform(
+        painter->worldTransform());
+    if (viewScale <= 0.0)
     {
         return;
     }
-
-    QGraphicsView *view      = itemScene->views().first();
-    qreal          viewScale = view->transform().m11();
-
-    // Scale the pen width inversely to maintain constant
-    // visual thickness
     QPen scaledPen(pen);
     scaledPen.setWidth(
         qMax(1, qRound(baseWidth / viewScale)));
@@ -178,16 +191,12 @@ MapLine::onLeftClick(const Input::ClickContext &ctx)
     }
 
     ctx.scene->clearSelection();
-    for (QGraphicsItem *item : ctx.scene->items())
+    for (MapLine *m : ctx.scene->itemsOfType<MapLine>())
     {
-        if (auto *m = dynamic_cast<MapLine *>(item))
+        if (m->getRegion() == regionName
+            && m->getReferencedNetworkLinkID() == networkName)
         {
-            if (m->getRegion() == regionName
-                && m->getReferencedNetworkLinkID()
-                       == networkName)
-            {
-                m->setSelected(true);
-            }
+            m->setSelected(true);
         }
     }
     return Input::Handled::Yes;
@@ -97,6 +97,28 @@ public:
      */
     void setPen(const QPen &pen);
 
+    /**
+     * @brief Get the color of the line
+     */
+    QColor getColor() const
+    {
+        return pen.color();
+    }
+
+    /**
+     * @brief Hands drawing and hit-testing of this line to
+     * the scene's NetworkLayerItem (true) or takes it back
+     * (false). A batched line keeps its registry entry,
+     * selection and animation overlays but paints nothing
+     * and has an empty shape.
+     */
+    void setBatched(bool batched);
+
+    bool isBatched() const
+    {
+        return m_batched;
+    }
+
     /**
      * @brief Sets the region of the line
      */
@@ -214,6 +236,7 @@ private:
     int                     baseWidth;
     QPen                    pen;
     QObject                *m_referenceNetwork;
+    bool                    m_batched = false;
 };
 
 } // namespace GUI
@@ -11,6 +11,7 @@
 #include "GUI/Input/Commands/UnlinkTerminalCommand.h"
 #include "GUI/Input/InteractionController.h"
 #include "GUI/MainWindow.h"
+#include "GUI/Widgets/GraphicsScene.h"
 #include "GUI/Widgets/GraphicsView.h"
 #include "TerminalItem.h"
 
@@ -100,6 +101,20 @@ void MapPoint::setLinkedTerminal(TerminalItem *newTerminal)
 
     // Trigger a repaint
     update();
+    if (auto *gs = qobject_cast<GraphicsScene *>(scene()))
+        gs->networkItemChanged(this, true);
+}
+
+void MapPoint::setBatched(bool batched)
+{
+    if (m_batched == batched)
+        return;
+    m_batched = batched;
+    // Untransformable items bypass the scene's BSP index and are
+    // re-tested on every paint and hit-test; batched points drop the
+    // flag so they cost nothing until the layer hands them back.
+    setFlag(QGraphicsItem::ItemIgnoresTransformations, !batched);
+    setFlag(QGraphicsItem::ItemHasNoContents, batched);
 }
 
 void MapPoint::setColor(const QColor &newColor)
@@ -113,6 +128,8 @@ void MapPoint::setColor(const QColor &newColor)
         m_color = newColor;
         emit colorChanged(m_color);
         update();
+        if (auto *gs = qobject_cast<GraphicsScene *>(scene()))
+            gs->networkItemChanged(this, false);
     }
 }
 
@@ -141,6 +158,8 @@ void MapPoint::setSceneCoordinate(const QPointF &newPos)
     m_sceneCoordinate = newPos;
     setPos(newPos);
     emit positionChanged(newPos);
+    if (auto *gs = qobject_cast<GraphicsScene *>(scene()))
+        gs->networkItemChanged(this, true);
 }
 
 QRectF MapPoint::boundingRect() const
@@ -162,16 +181,18 @@ QRectF MapPoint::boundingRect() const
     return QRectF(-7, -7, 14, 14);
 }
 
+QPainterPath MapPoint::shape() const
+{
+    // Batched points are hit-tested by the NetworkLayerItem's index.
+    if (m_batched)
+        return QPainterPath();
+    return GraphicsObjectBase::shape();
+}
+
 void MapPoint::paint(QPainter *painter,
                      const QStyleOptionGraphicsItem *option,
                      QWidget                        *widget)
 {
-    qCDebug(lcGuiScene)
-        << "MapPoint::paint:"
-        << "id=" << m_id
-        << "shape=" << m_shape
-        << "hasTerminal=" << (m_terminal != nullptr);
-
     if (m_terminal)
     {
         // If linked to a m_terminal, draw m_terminal icon at
@@ -360,7 +381,7 @@ void MapPoint::buildContextMenu(QMenu* menu, const Input::ClickContext& ctx)
         if (!self) return;
 
         // Prefer the bound NodeLinkage which carries the canonical tuple.
-        Backend::Scenario::NodeLinkage *linkage = self->linkageModel();
+        const Backend::Scenario::NodeLinkage *linkage = self->linkageModel();
         if (doc && bus && linkage)
         {
             const bool submitted =
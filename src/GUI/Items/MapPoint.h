@@ -103,7 +103,7 @@ public:
      *
      * Passing nullptr unbinds.
      */
-    void setLinkageModel(Backend::Scenario::NodeLinkage *linkage)
+    void setLinkageModel(const Backend::Scenario::NodeLinkage *linkage)
     {
         m_linkage = linkage;
     }
@@ -111,7 +111,7 @@ public:
     /// Non-owning linkage pointer, or nullptr when no canonical linkage is
     /// bound yet (for example an unlinked network node or a view-only test
     /// fixture).
-    Backend::Scenario::NodeLinkage *linkageModel() const
+    const Backend::Scenario::NodeLinkage *linkageModel() const
     {
         return m_linkage;
     }
@@ -151,6 +151,26 @@ public:
      */
     void setColor(const QColor &color);
 
+    /**
+     * @brief Get the color of the point
+     */
+    QColor getColor() const
+    {
+        return m_color;
+    }
+
+    /**
+     * @brief Hands drawing and hit-testing of this point to
+     * the scene's NetworkLayerItem (true) or takes it back
+     * (false). See MapLine::setBatched.
+     */
+    void setBatched(bool batched);
+
+    bool isBatched() const
+    {
+        return m_batched;
+    }
+
     /**
      * @brief Sets the m_region of the point
      */
@@ -298,10 +318,11 @@ signals:
                          const QVariant &value);
 
 protected:
-    QRectF boundingRect() const override;
-    void   paint(QPainter                       *painter,
-                 const QStyleOptionGraphicsItem *option,
-                 QWidget *widget = nullptr) override;
+    QRectF       boundingRect() const override;
+    QPainterPath shape() const override;
+    void         paint(QPainter                       *painter,
+                       const QStyleOptionGraphicsItem *option,
+                       QWidget *widget = nullptr) override;
 
 private:
     void createTerminalAtPosition(
@@ -324,7 +345,9 @@ private:
     /// Non-owning pointer into ScenarioDocument::linkages. When non-null
     /// this point is a view of that linkage; null means no backend linkage
     /// is currently bound.
-    Backend::Scenario::NodeLinkage *m_linkage = nullptr;
+    const Backend::Scenario::NodeLinkage *m_linkage = nullptr;
+
+    bool m_batched = false;
 };
 
 } // namespace GUI
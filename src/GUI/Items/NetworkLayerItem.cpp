@@ -0,0 +1,530 @@
+#include "NetworkLayerItem.h"
+#include "Backend/Commons/LogCategories.h"
+#include "GUI/Items/MapLine.h"
+#include "GUI/Items/MapPoint.h"
+#include "GUI/Widgets/GraphicsScene.h"
+
+#include <QPainter>
+#include <QPen>
+#include <QStyleOptionGraphicsItem>
+#include <QTimer>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace CargoNetSim
+{
+namespace GUI
+{
+
+namespace
+{
+
+/// Average items per tile the grid aims for.
+constexpr int kItemsPerTile = 64;
+
+/// Cap on the grid's longer side, in tiles.
+constexpr int kMaxTilesPerSide = 128;
+
+/// Zoom levels (log2 of device pixels per scene unit) cached per tile.
+constexpr int kMaxLevel = 24;
+
+/// Hit tolerance around batched items, in device pixels.
+constexpr qreal kHitPixels = 5.0;
+
+/// Node dots are drawn once a tile has this much screen area per node.
+constexpr qreal kMinPixelsPerDot = 64.0;
+
+constexpr qreal kDotPixels = 4.0;
+
+using SnappedPoint = std::pair<qint64, qint64>;
+
+qreal distanceToSegment(const QPointF &p, const QLineF &line)
+{
+    const QPointF d      = line.p2() - line.p1();
+    const qreal   length = d.x() * d.x() + d.y() * d.y();
+    qreal         t      = 0.0;
+    if (length > 0.0)
+    {
+        t = ((p.x() - line.x1()) * d.x()
+             + (p.y() - line.y1()) * d.y())
+            / length;
+        t = qBound(0.0, t, 1.0);
+    }
+    return QLineF(p, line.p1() + t * d).length();
+}
+
+/// Closed-interval overlap; unlike QRectF::intersects it accepts the
+/// zero-width boxes of axis-aligned segments.
+bool overlaps(const QRectF &a, const QRectF &b)
+{
+    return a.left() <= b.right() && b.left() <= a.right()
+           && a.top() <= b.bottom() && b.top() <= a.bottom();
+}
+
+bool isBatched(const GraphicsObjectBase *item)
+{
+    if (auto *line = qgraphicsitem_cast<const MapLine *>(item))
+        return line->isBatched();
+    if (auto *point = qgraphicsitem_cast<const MapPoint *>(item))
+        return point->isBatched();
+    return false;
+}
+
+} // namespace
+
+NetworkLayerItem::NetworkLayerItem(GraphicsScene *scene)
+    : QGraphicsObject(nullptr)
+    , m_scene(scene)
+{
+    // Between the background and the MapLines (3) it stands in for.
+    setZValue(2.5);
+    // exposedRect lets paint() touch only the tiles being repainted.
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
+
+void NetworkLayerItem::invalidate()
+{
+    m_dirty = true;
+    scheduleRebuild();
+}
+
+void NetworkLayerItem::invalidateStyle()
+{
+    m_styleDirty = true;
+    update();
+}
+
+void NetworkLayerItem::scheduleRebuild()
+{
+    if (m_rebuildQueued)
+        return;
+    m_rebuildQueued = true;
+    QTimer::singleShot(0, this, [this]() { rebuild(); });
+}
+
+void NetworkLayerItem::rebuild()
+{
+    m_rebuildQueued = false;
+    if (!m_dirty)
+        return;
+    m_dirty      = false;
+    m_styleDirty = false;
+
+    m_segments.clear();
+    m_nodes.clear();
+    m_tiles.clear();
+    m_detailed.clear();
+
+    qreal minX = std::numeric_limits<qreal>::max();
+    qreal minY = minX;
+    qreal maxX = std::numeric_limits<qreal>::lowest();
+    qreal maxY = maxX;
+    auto grow = [&](const QPointF &p) {
+        minX = qMin(minX, p.x());
+        minY = qMin(minY, p.y());
+        maxX = qMax(maxX, p.x());
+        maxY = qMax(maxY, p.y());
+    };
+
+    for (MapLine *line : m_scene->itemsOfType<MapLine>())
+    {
+        const QLineF segment(line->getStartPoint(),
+                             line->getEndPoint());
+        grow(segment.p1());
+        grow(segment.p2());
+        m_segments.append({segment, line});
+        if (!line->isBatched())
+            m_detailed.insert(line);
+    }
+    for (MapPoint *point : m_scene->itemsOfType<MapPoint>())
+    {
+        // A point standing in for a terminal draws the terminal's
+        // icon; there are few of them, so they always draw themselves.
+        if (point->getLinkedTerminal())
+        {
+            point->setBatched(false);
+            continue;
+        }
+        grow(point->pos());
+        m_nodes.append({point->pos(), point});
+        if (!point->isBatched())
+            m_detailed.insert(point);
+    }
+
+    QRectF bounds;
+    const int count = m_segments.size() + m_nodes.size();
+    if (count > 0)
+    {
+        bounds = QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+        const int side = qBound(
+            1,
+            static_cast<int>(std::ceil(
+                std::sqrt(count / static_cast<double>(kItemsPerTile)))),
+            kMaxTilesPerSide);
+        const qreal extent = qMax(bounds.width(), bounds.height());
+        m_cellSize = extent > 0.0 ? extent / side : 1.0;
+        m_columns  = qMax(1, static_cast<int>(std::ceil(
+                                bounds.width() / m_cellSize)));
+        m_rows     = qMax(1, static_cast<int>(std::ceil(
+                             bounds.height() / m_cellSize)));
+    }
+    else
+    {
+        m_columns = m_rows = 0;
+    }
+
+    if (bounds != m_bounds)
+    {
+        prepareGeometryChange();
+        m_bounds = bounds;
+    }
+    m_tiles.resize(m_columns * m_rows);
+
+    for (int i = 0; i < m_segments.size(); ++i)
+    {
+        const QLineF &l    = m_segments[i].line;
+        const QRect   span = cellSpan(QRectF(l.p1(), l.p2()).normalized());
+        for (int row = span.top(); row <= span.bottom(); ++row)
+            for (int col = span.left(); col <= span.right(); ++col)
+                m_tiles[row * m_columns + col].segments.append(i);
+    }
+    for (int i = 0; i < m_nodes.size(); ++i)
+    {
+        const QRect span =
+            cellSpan(QRectF(m_nodes[i].pos, QSizeF(0.0, 0.0)));
+        m_tiles[span.top() * m_columns + span.left()].nodes.append(i);
+    }
+
+    qCDebug(lcGuiScene) << "NetworkLayerItem::rebuild:"
+                        << "lines=" << m_segments.size()
+                        << "points=" << m_nodes.size()
+                        << "tiles=" << m_columns << "x" << m_rows;
+
+    // New items arrive detailed; hand them over while a view is known.
+    if (m_visibleRect.isValid())
+        applyDetail();
+    update();
+}
+
+QRect NetworkLayerItem::cellSpan(const QRectF &rect) const
+{
+    if (m_columns == 0 || !overlaps(rect, m_bounds))
+        return QRect();
+    auto column = [this](qreal x) {
+        return qBound(0,
+                      static_cast<int>(std::floor(
+                          (x - m_bounds.left()) / m_cellSize)),
+                      m_columns - 1);
+    };
+    auto row = [this](qreal y) {
+        return qBound(0,
+                      static_cast<int>(std::floor(
+                          (y - m_bounds.top()) / m_cellSize)),
+                      m_rows - 1);
+    };
+    QRect span;
+    span.setCoords(column(rect.left()), row(rect.top()),
+                   column(rect.right()), row(rect.bottom()));
+    return span;
+}
+
+void NetworkLayerItem::updateDetail(const QRectF &visibleRect,
+                                    qreal         pixelsPerUnit)
+{
+    if (pixelsPerUnit <= 0.0 || !visibleRect.isValid())
+        return;
+    const qreal tolerance = kHitPixels / pixelsPerUnit;
+    if (tolerance != m_hitTolerance)
+    {
+        prepareGeometryChange();
+        m_hitTolerance = tolerance;
+    }
+    m_visibleRect = visibleRect;
+    if (m_dirty)
+        rebuild();
+    else
+        applyDetail();
+}
+
+void NetworkLayerItem::applyDetail()
+{
+    QSet<GraphicsObjectBase *> wanted;
+    const QRect span       = cellSpan(m_visibleRect);
+    bool        overBudget = false;
+    for (int row = span.top(); row <= span.bottom() && !overBudget; ++row)
+    {
+        for (int col = span.left(); col <= span.right() && !overBudget;
+             ++col)
+        {
+            const Tile &tile = m_tiles[row * m_columns + col];
+            for (int i : tile.segments)
+            {
+                const QLineF &l = m_segments[i].line;
+                if (overlaps(QRectF(l.p1(), l.p2()).normalized(),
+                             m_visibleRect))
+                    wanted.insert(m_segments[i].item);
+            }
+            for (int i : tile.nodes)
+            {
+                if (m_visibleRect.contains(m_nodes[i].pos))
+                    wanted.insert(m_nodes[i].item);
+            }
+            overBudget = wanted.size() > kDetailBudget;
+        }
+    }
+    if (overBudget)
+        wanted.clear();
+
+    int batched = 0, detailed = 0;
+    for (GraphicsObjectBase *item : std::as_const(m_detailed))
+    {
+        if (!wanted.contains(item))
+        {
+            setBatched(item, true);
+            ++batched;
+        }
+    }
+    for (GraphicsObjectBase *item : std::as_const(wanted))
+    {
+        if (!m_detailed.contains(item))
+        {
+            setBatched(item, false);
+            ++detailed;
+        }
+    }
+    m_detailed = std::move(wanted);
+
+    if (batched > 0 || detailed > 0)
+    {
+        qCDebug(lcGuiScene) << "NetworkLayerItem::applyDetail:"
+                            << "batched=" << batched
+                            << "detailed=" << detailed
+                            << "overBudget=" << overBudget;
+    }
+}
+
+void NetworkLayerItem::setBatched(GraphicsObjectBase *item,
+                                  bool                batched) const
+{
+    if (auto *line = qgraphicsitem_cast<MapLine *>(item))
+        line->setBatched(batched);
+    else if (auto *point = qgraphicsitem_cast<MapPoint *>(item))
+        point->setBatched(batched);
+}
+
+GraphicsObjectBase *
+NetworkLayerItem::batchedItemAt(const QPointF &scenePos) const
+{
+    if (m_dirty || m_tiles.isEmpty())
+        return nullptr;
+
+    const qreal  t = m_hitTolerance;
+    const QRectF probe(scenePos - QPointF(t, t), QSizeF(2 * t, 2 * t));
+    const QRect  span = cellSpan(probe);
+
+    GraphicsObjectBase *nearestNode = nullptr;
+    GraphicsObjectBase *nearestLine = nullptr;
+    qreal nodeDistance = t, lineDistance = t;
+    for (int row = span.top(); row <= span.bottom(); ++row)
+    {
+        for (int col = span.left(); col <= span.right(); ++col)
+        {
+            const Tile &tile = m_tiles[row * m_columns + col];
+            for (int i : tile.nodes)
+            {
+                const Node &node = m_nodes[i];
+                const qreal d = QLineF(scenePos, node.pos).length();
+                if (d <= nodeDistance && node.item->isVisible()
+                    && !m_detailed.contains(node.item))
+                {
+                    nodeDistance = d;
+                    nearestNode  = node.item;
+                }
+            }
+            if (nearestNode)
+                continue;
+            for (int i : tile.segments)
+            {
+                const Segment &segment = m_segments[i];
+                const qreal d = distanceToSegment(scenePos, segment.line);
+                if (d <= lineDistance && segment.item->isVisible()
+                    && !m_detailed.contains(segment.item))
+                {
+                    lineDistance = d;
+                    nearestLine  = segment.item;
+                }
+            }
+        }
+    }
+    return nearestNode ? nearestNode : nearestLine;
+}
+
+int NetworkLayerItem::batchedCount() const
+{
+    if (m_dirty)
+        return 0;
+    int count = 0;
+    for (const Segment &segment : m_segments)
+        count += isBatched(segment.item) ? 1 : 0;
+    for (const Node &node : m_nodes)
+        count += isBatched(node.item) ? 1 : 0;
+    return count;
+}
+
+QRectF NetworkLayerItem::boundingRect() const
+{
+    if (m_columns == 0)
+        return QRectF();
+    return m_bounds.adjusted(-m_hitTolerance, -m_hitTolerance,
+                             m_hitTolerance, m_hitTolerance);
+}
+
+bool NetworkLayerItem::contains(const QPointF &point) const
+{
+    return batchedItemAt(point) != nullptr;
+}
+
+bool NetworkLayerItem::collidesWithPath(const QPainterPath &path,
+                                        Qt::ItemSelectionMode) const
+{
+    // Point queries arrive as a tiny rect around the cursor.
+    return batchedItemAt(path.boundingRect().center()) != nullptr;
+}
+
+const QVector<NetworkLayerItem::Batch> &
+NetworkLayerItem::tileBatches(Tile &tile, int level)
+{
+    auto cached = tile.levels.constFind(level);
+    if (cached != tile.levels.constEnd())
+        return *cached;
+
+    QVector<Batch> &batches = tile.levels[level];
+    // The snapshot may point at deleted items until the queued rebuild.
+    if (m_dirty)
+        return batches;
+
+    auto batchFor = [&batches](const QColor &color,
+                               bool          selected) -> Batch & {
+        for (Batch &batch : batches)
+        {
+            if (batch.selected == selected && batch.color == color)
+                return batch;
+        }
+        batches.append(Batch{color, selected, {}, {}});
+        return batches.last();
+    };
+
+    // One grid step is about one device pixel at this level. Segments
+    // whose ends snap together are invisible; duplicates overdraw.
+    const qreal grid = std::ldexp(1.0, -level);
+    auto snap = [grid](const QPointF &p) {
+        return SnappedPoint(qRound64(p.x() / grid),
+                            qRound64(p.y() / grid));
+    };
+    auto unsnap = [grid](const SnappedPoint &p) {
+        return QPointF(p.first * grid, p.second * grid);
+    };
+
+    QSet<std::pair<SnappedPoint, SnappedPoint>> seenLines;
+    for (int i : std::as_const(tile.segments))
+    {
+        auto *line = static_cast<MapLine *>(m_segments[i].item);
+        if (!line->isVisible())
+            continue;
+        SnappedPoint a = snap(m_segments[i].line.p1());
+        SnappedPoint b = snap(m_segments[i].line.p2());
+        if (a == b)
+            continue;
+        if (b < a)
+            std::swap(a, b);
+        if (seenLines.contains({a, b}))
+            continue;
+        seenLines.insert({a, b});
+        batchFor(line->getColor(), line->isSelected())
+            .lines.append(QLineF(unsnap(a), unsnap(b)));
+    }
+
+    const qreal tilePixels = std::ldexp(m_cellSize, level);
+    if (!tile.nodes.isEmpty()
+        && tilePixels * tilePixels / tile.nodes.size()
+               >= kMinPixelsPerDot)
+    {
+        QSet<SnappedPoint> seenDots;
+        for (int i : std::as_const(tile.nodes))
+        {
+            auto *point = static_cast<MapPoint *>(m_nodes[i].item);
+            if (!point->isVisible())
+                continue;
+            const SnappedPoint p = snap(m_nodes[i].pos);
+            if (seenDots.contains(p))
+                continue;
+            seenDots.insert(p);
+            batchFor(point->getColor(), point->isSelected())
+                .dots.append(unsnap(p));
+        }
+    }
+    return batches;
+}
+
+void NetworkLayerItem::paint(QPainter                       *painter,
+                             const QStyleOptionGraphicsItem *option,
+                             QWidget                        *widget)
+{
+    Q_UNUSED(widget);
+    if (m_tiles.isEmpty())
+        return;
+    if (m_styleDirty && !m_dirty)
+    {
+        for (Tile &tile : m_tiles)
+            tile.levels.clear();
+        m_styleDirty = false;
+    }
+
+    const qreal lod = option->levelOfDetailFromTransform(
+        painter->worldTransform());
+    if (lod <= 0.0)
+        return;
+    const int level = qBound(-kMaxLevel,
+                             static_cast<int>(std::floor(std::log2(lod))),
+                             kMaxLevel);
+
+    painter->setRenderHint(QPainter::Antialiasing, false);
+    painter->setBrush(Qt::NoBrush);
+
+    const QRect span = cellSpan(option->exposedRect);
+    for (int row = span.top(); row <= span.bottom(); ++row)
+    {
+        for (int col = span.left(); col <= span.right(); ++col)
+        {
+            for (const Batch &batch :
+                 tileBatches(m_tiles[row * m_columns + col], level))
+            {
+                QPen pen(batch.selected ? QColor(Qt::blue) : batch.color);
+                pen.setCosmetic(true);
+                if (!batch.lines.isEmpty())
+                {
+                    pen.setWidthF(1.0);
+                    pen.setStyle(batch.selected ? Qt::DashLine
+                                                : Qt::SolidLine);
+                    painter->setPen(pen);
+                    painter->drawLines(batch.lines);
+                }
+                if (!batch.dots.isEmpty())
+                {
+                    pen.setWidthF(kDotPixels);
+                    pen.setStyle(Qt::SolidLine);
+                    pen.setCapStyle(Qt::RoundCap);
+                    painter->setPen(pen);
+                    painter->drawPoints(
+                        batch.dots.constData(),
+                        static_cast<int>(batch.dots.size()));
+                }
+            }
+        }
+    }
+}
+
+} // namespace GUI
+} // namespace CargoNetSim
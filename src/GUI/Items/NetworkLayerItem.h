@@ -0,0 +1,164 @@
+#pragma once
+
+#include <QColor>
+#include <QGraphicsObject>
+#include <QHash>
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <QSet>
+#include <QVector>
+
+namespace CargoNetSim
+{
+namespace GUI
+{
+
+class GraphicsObjectBase;
+class GraphicsScene;
+
+/**
+ * @brief Batched, level-of-detail renderer for every drawn
+ * network in a GraphicsScene
+ *
+ * MapLine and MapPoint stay the scene's model of a network:
+ * they own selection, properties, animation overlays and the
+ * registry ids every controller looks up. Painting and
+ * hit-testing them one QGraphicsObject at a time does not
+ * scale, so the scene owns one NetworkLayerItem that draws
+ * all of them instead:
+ *
+ *   - The layer buckets every line and point into a uniform
+ *     grid of tiles. Each tile caches its geometry per zoom
+ *     level (powers of two), simplified by snapping endpoints
+ *     to the on-screen pixel grid and dropping the segments
+ *     that collapse; node dots are only drawn once a tile is
+ *     sparse enough on screen for them to be told apart.
+ *   - updateDetail() hands the items inside the viewport back
+ *     to themselves ("detailed") while there are at most
+ *     kDetailBudget of them; every other item is "batched":
+ *     it keeps its registry entry but has no contents and an
+ *     empty shape, so Qt neither paints nor hit-tests it.
+ *   - The grid doubles as the spatial index for batched
+ *     items. InteractionController swaps the layer for the
+ *     item batchedItemAt() returns, so modes and items still
+ *     see a MapLine or MapPoint under the cursor.
+ *
+ * The layer is not registered in the scene's type registry
+ * and never owns the items it draws. It re-reads them from
+ * the registry after invalidate(), and only dereferences
+ * them while that snapshot is current.
+ */
+class NetworkLayerItem : public QGraphicsObject
+{
+    Q_OBJECT
+
+public:
+    /// Unique graphics-item type id. See TerminalItem::Type for rationale.
+    enum { Type = UserType + 10 };
+    int type() const override { return Type; }
+
+    /// Most items the viewport may hold before they are all batched.
+    static constexpr int kDetailBudget = 2000;
+
+    explicit NetworkLayerItem(GraphicsScene *scene);
+
+    /**
+     * @brief Membership or geometry changed (items added or
+     * removed, moved, linked to a terminal). The index is
+     * rebuilt on the next event-loop turn or query.
+     */
+    void invalidate();
+
+    /**
+     * @brief Only colour, selection or visibility changed;
+     * the index stays and tiles re-batch when next painted.
+     */
+    void invalidateStyle();
+
+    /**
+     * @brief Re-split detailed and batched items for a view
+     * showing @p visibleRect at @p pixelsPerUnit device pixels
+     * per scene unit.
+     */
+    void updateDetail(const QRectF &visibleRect,
+                      qreal         pixelsPerUnit);
+
+    /**
+     * @brief Nearest visible batched item within a few screen
+     * pixels of @p scenePos, points before lines; nullptr when
+     * nothing is there or the index is stale.
+     */
+    GraphicsObjectBase *batchedItemAt(const QPointF &scenePos) const;
+
+    /// Number of network items currently drawn only by the layer.
+    int batchedCount() const;
+
+    QRectF boundingRect() const override;
+    bool   contains(const QPointF &point) const override;
+    bool   collidesWithPath(
+          const QPainterPath   &path,
+          Qt::ItemSelectionMode mode =
+              Qt::IntersectsItemShape) const override;
+    void   paint(QPainter                       *painter,
+                 const QStyleOptionGraphicsItem *option,
+                 QWidget *widget = nullptr) override;
+
+private:
+    struct Segment
+    {
+        QLineF              line;
+        GraphicsObjectBase *item;
+    };
+
+    struct Node
+    {
+        QPointF             pos;
+        GraphicsObjectBase *item;
+    };
+
+    /// One pen's worth of a tile at one zoom level.
+    struct Batch
+    {
+        QColor           color;
+        bool             selected = false;
+        QVector<QLineF>  lines;
+        QVector<QPointF> dots;
+    };
+
+    struct Tile
+    {
+        QVector<int>                 segments;
+        QVector<int>                 nodes;
+        QHash<int, QVector<Batch>>   levels;
+    };
+
+    void rebuild();
+    void scheduleRebuild();
+    void applyDetail();
+    void setBatched(GraphicsObjectBase *item, bool batched) const;
+
+    QRect cellSpan(const QRectF &rect) const;
+    const QVector<Batch> &tileBatches(Tile &tile, int level);
+
+    GraphicsScene *m_scene;
+
+    bool m_dirty         = true;
+    bool m_styleDirty    = false;
+    bool m_rebuildQueued = false;
+
+    QVector<Segment> m_segments;
+    QVector<Node>    m_nodes;
+    QVector<Tile>    m_tiles;
+    QRectF           m_bounds;
+    qreal            m_cellSize = 1.0;
+    int              m_columns  = 0;
+    int              m_rows     = 0;
+
+    QSet<GraphicsObjectBase *> m_detailed;
+    QRectF                     m_visibleRect;
+    qreal                      m_hitTolerance = 4.0;
+};
+
+} // namespace GUI
+} // namespace CargoNetSim
@@ -463,13 +463,21 @@ void MainWindow::setRuntime(
     std::unique_ptr<Backend::Scenario::ScenarioRuntime> rt)
 {
     qCInfo(lcGui) << "MainWindow::setRuntime: begin";
-    // Clear BOTH scenes before swapping — scene items hold non-owning
-    // pointers into the outgoing runtime's ScenarioDocument. Destroying
-    // the old runtime while those pointers are still live would leave
-    // the items dangling. clearAll() drops the type-registry first
-    // (see Task 8's GraphicsScene::clearAll), then deletes items.
-    if (regionScene_)    regionScene_->clearAll();
-    if (globalMapScene_) globalMapScene_->clearAll();
+    // Scene items hold non-owning pointers into the outgoing runtime's
+    // ScenarioDocument. Keep that runtime alive until the end of this
+    // function: SceneRepopulator reconciles the scenes against the new
+    // document below and re-points every item it keeps, so the old
+    // document must not be destroyed before then. Tear-down (no new
+    // runtime) has nothing to reconcile against, so clear both scenes.
+    // clearAll() drops the type-registry first (see Task 8's
+    // GraphicsScene::clearAll), then deletes items.
+    std::unique_ptr<Backend::Scenario::ScenarioRuntime> outgoing =
+        std::move(m_runtime);
+    if (!rt)
+    {
+        if (regionScene_)    regionScene_->clearAll();
+        if (globalMapScene_) globalMapScene_->clearAll();
+    }
 
     m_runtime = std::move(rt);
 
@@ -508,7 +516,7 @@ void MainWindow::setRuntime(
 
     // Initial backfill: subscribe happens AFTER the document was parsed,
     // so the per-item signals (regionAdded, terminalAdded, …) have
-    // already fired with no listener. Do one full rebuild here so the
+    // already fired with no listener. Reconcile once here so the
     // scene reflects the loaded document. No-op when rt is null
     // (tear-down path). Callers are expected to have completed
     // runtime->load() before calling setRuntime so the backend
@@ -539,7 +547,7 @@ void MainWindow::setRuntime(
         qCDebug(lcGui) << "MainWindow::setRuntime:"
                        << "regions=" << doc->regions.size()
                        << "terminals=" << doc->terminals.size()
-                       << "connections=" << doc->connections.size();
+                       << "connections=" << doc->connections().size();
 
         // Auto-select the first loaded region so updateSceneVisibility
         // hides non-current regions. Without this, every region's
@@ -562,7 +570,7 @@ void MainWindow::subscribeDocumentObservers()
     auto *doc = &m_runtime->document();
     auto *regionScene = regionScene_;
 
-    // Full rebuild on documentReset — same entry point used by
+    // Reconcile the scenes on documentReset — same entry point used by
     // File → Open Scenario (Task 19 when that lands).
     connect(doc, &ScenarioDocument::documentReset,
             this, [this, doc] {
@@ -783,19 +791,10 @@ void MainWindow::subscribeDocumentObservers()
             auto *mp = GUI::Scenario::MapPointFactory::
                 findByNetworkAndNode(
                     regionScene, networkName, nodeId);
-            if (mp)
-            {
-                for (auto &l : doc->linkages)
-                {
-                    if (l.terminalId == terminalId
-                        && l.networkName == networkName
-                        && l.nodeId == nodeId)
-                    {
-                        mp->setLinkageModel(&l);
-                        break;
-                    }
-                }
-            }
+            const int i =
+                doc->findLinkageIndex(terminalId, networkName, nodeId);
+            if (mp && i >= 0)
+                mp->setLinkageModel(&doc->linkages().at(i));
         });
 
     // Linkage lifecycle → MapPoint factory / removal. The owning region
@@ -813,17 +812,12 @@ void MainWindow::subscribeDocumentObservers()
                     regionScene, link.networkName, link.nodeId);
                 // Look up the stored linkage pointer (signal delivers a
                 // copy; factory / model binding want a doc-owned ptr).
-                Backend::Scenario::NodeLinkage *stored = nullptr;
-                for (auto &s : m_runtime->document().linkages)
-                {
-                    if (s.terminalId  == link.terminalId
-                     && s.networkName == link.networkName
-                     && s.nodeId      == link.nodeId)
-                    {
-                        stored = &s;
-                        break;
-                    }
-                }
+                auto &document = m_runtime->document();
+                const int storedIndex = document.findLinkageIndex(
+                    link.terminalId, link.networkName, link.nodeId);
+                const Backend::Scenario::NodeLinkage *stored =
+                    storedIndex >= 0 ? &document.linkages().at(storedIndex)
+                                     : nullptr;
                 if (!mp)
                 {
                     if (!regionScene || !stored) return;
@@ -862,7 +856,7 @@ void MainWindow::subscribeDocumentObservers()
 
     // Connection lifecycle (region-local). The signal passes the connection
     // by value; the factory binds the line by key (from/to/mode) against
-    // the doc, so it doesn't need a live pointer into doc->connections.
+    // the doc, so it doesn't need a live pointer into doc->connections().
     connect(doc, &ScenarioDocument::connectionAdded, this,
             [this, doc, regionScene](const Connection &c) {
                 if (!regionScene) return;
@@ -34,7 +34,7 @@ void addAndBindLine(ConnectionLine *line, GraphicsScene *scene,
 
 ConnectionLine *ConnectionLineFactory::fromConnection(
     Backend::Scenario::ScenarioDocument *doc,
-    Backend::Scenario::Connection       *connection,
+    const Backend::Scenario::Connection *connection,
     GraphicsScene                       *regionScene,
     MainWindow                          *mainWindow)
 {
@@ -121,7 +121,7 @@ ConnectionLine *ConnectionLineFactory::findGlobalLink(
 
 ConnectionLine *ConnectionLineFactory::fromGlobalLink(
     Backend::Scenario::ScenarioDocument *doc,
-    Backend::Scenario::GlobalLink       *link,
+    const Backend::Scenario::GlobalLink *link,
     GraphicsScene                       *globalScene,
     MainWindow                          *mainWindow)
 {
@@ -46,7 +46,7 @@ public:
     ///            pointer into the (mutable, reshufflable) connections list.
     static ConnectionLine *
     fromConnection(Backend::Scenario::ScenarioDocument *doc,
-                   Backend::Scenario::Connection       *connection,
+                   const Backend::Scenario::Connection *connection,
                    GraphicsScene                       *regionScene,
                    MainWindow                          *mainWindow);
 
@@ -54,7 +54,7 @@ public:
     ///            fromConnection — bind by key, not by pointer.
     static ConnectionLine *
     fromGlobalLink(Backend::Scenario::ScenarioDocument *doc,
-                   Backend::Scenario::GlobalLink       *link,
+                   const Backend::Scenario::GlobalLink *link,
                    GraphicsScene                       *globalScene,
                    MainWindow                          *mainWindow);
 
@@ -56,10 +56,10 @@ MapPoint *MapPointFactory::findByNetworkAndNode(
 }
 
 MapPoint *MapPointFactory::fromNodeLinkage(
-    Backend::Scenario::NodeLinkage *linkage,
-    const QString                  &regionName,
-    GraphicsScene                  *scene,
-    MainWindow                     *mainWindow)
+    const Backend::Scenario::NodeLinkage *linkage,
+    const QString                        &regionName,
+    GraphicsScene                        *scene,
+    MainWindow                           *mainWindow)
 {
     if (!linkage || regionName.isEmpty() || !scene) return nullptr;
 
@@ -74,8 +74,19 @@ MapPoint *MapPointFactory::fromNodeLinkage(
         return existing;
     }
 
+    return createFromNodeLinkage(linkage, regionName, scene, mainWindow);
+}
+
+MapPoint *MapPointFactory::createFromNodeLinkage(
+    const Backend::Scenario::NodeLinkage *linkage,
+    const QString                        &regionName,
+    GraphicsScene                        *scene,
+    MainWindow                           *mainWindow)
+{
+    if (!linkage || regionName.isEmpty() || !scene) return nullptr;
+
     qCInfo(lcGuiScene)
-        << "MapPointFactory::fromNodeLinkage:"
+        << "MapPointFactory::createFromNodeLinkage:"
         << "network=" << linkage->networkName
         << "nodeId=" << linkage->nodeId
         << "region=" << regionName;
@@ -86,7 +97,7 @@ MapPoint *MapPointFactory::fromNodeLinkage(
     if (!nodeView || !nodeView->isValid())
     {
         qCWarning(lcGuiScene)
-            << "MapPointFactory::fromNodeLinkage:"
+            << "MapPointFactory::createFromNodeLinkage:"
             << "network node not found:" << linkage->networkName
             << linkage->nodeId;
         return nullptr;
@@ -41,10 +41,19 @@ class MapPointFactory
 {
 public:
     static MapPoint *
-    fromNodeLinkage(Backend::Scenario::NodeLinkage *linkage,
-                    const QString                  &regionName,
-                    GraphicsScene                  *scene,
-                    MainWindow                     *mainWindow);
+    fromNodeLinkage(const Backend::Scenario::NodeLinkage *linkage,
+                    const QString                        &regionName,
+                    GraphicsScene                        *scene,
+                    MainWindow                           *mainWindow);
+
+    /// fromNodeLinkage without the reuse lookup: always constructs a new
+    /// MapPoint. For callers (SceneRepopulator) that already know no
+    /// MapPoint exists for the linkage's (networkName, nodeId).
+    static MapPoint *
+    createFromNodeLinkage(const Backend::Scenario::NodeLinkage *linkage,
+                          const QString                        &regionName,
+                          GraphicsScene                        *scene,
+                          MainWindow                           *mainWindow);
 
     /// Locate an existing MapPoint in @p scene that represents the given
     /// (networkName, nodeId) pair. Matching is O(N) over MapPoints in
@@ -88,6 +88,21 @@ RegionCenterPoint *RegionCenterPointFactory::fromRegionSpec(
     return cp;
 }
 
+void RegionCenterPointFactory::rebind(
+    RegionCenterPoint             *cp,
+    Backend::Scenario::RegionSpec *region,
+    MainWindow                    *mainWindow)
+{
+    if (!cp || !region) return;
+    Backend::Scenario::ScenarioDocument *doc =
+        (mainWindow && mainWindow->runtime())
+            ? &mainWindow->runtime()->document()
+            : nullptr;
+    cp->setRegionBinding(doc, region->name);
+    cp->refreshFromSpec(region);
+    publishToControllerLegacyKey(cp, region->name);
+}
+
 RegionCenterPoint *RegionCenterPointFactory::findByName(
     GraphicsScene *scene, const QString &regionName)
 {
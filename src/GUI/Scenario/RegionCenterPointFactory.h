@@ -44,6 +44,14 @@ public:
                    GraphicsScene                 *scene,
                    MainWindow                    *mainWindow);
 
+    /// Re-point an existing center at @p region: refreshes the document
+    /// binding and display properties, and republishes the GUI-runtime
+    /// key. No scene insertion and no signal wiring — the item already
+    /// has both. Used by SceneRepopulator for items it keeps.
+    static void rebind(RegionCenterPoint             *cp,
+                       Backend::Scenario::RegionSpec *region,
+                       MainWindow                    *mainWindow);
+
     /// Locate the RegionCenterPoint bound to @p regionName. The scene
     /// keys items by stable UUID (so rename doesn't break the
     /// registry); this is the correct entry point for callers that
@@ -3,7 +3,11 @@
 #include "Backend/Application/NetworkViewService.h"
 #include "Backend/Commons/LogCategories.h"
 #include "Backend/GuiApi/ScenarioDocumentApi.h"
+#include "GUI/Items/ConnectionLine.h"
+#include "GUI/Items/GlobalTerminalItem.h"
+#include "GUI/Items/MapLine.h"
 #include "GUI/Items/MapPoint.h"
+#include "GUI/Items/RegionCenterPoint.h"
 #include "GUI/Items/TerminalItem.h"
 #include "GUI/MainWindow.h"
 #include "GUI/Commons/NetworkType.h"
@@ -15,7 +19,9 @@
 #include "GUI/Scenario/TerminalItemFactory.h"
 #include "GUI/Widgets/GraphicsScene.h"
 
+#include <QDebug>
 #include <QHash>
+#include <QSet>
 #include <QString>
 
 namespace CargoNetSim {
@@ -24,74 +30,176 @@ namespace Scenario {
 
 namespace {
 
-using Doc = Backend::Scenario::ScenarioDocument;
+using Doc  = Backend::Scenario::ScenarioDocument;
+using Mode = Backend::TransportationTypes::TransportationMode;
 
-/// (networkName, nodeId) → composite key for the MapPoint lookup index
-/// built in step 3 and consumed in step 5. Kept file-local so the format
-/// is in one place; the index is discarded at end of repopulate so key
-/// shape doesn't leak to the rest of the codebase.
-QString linkageKey(const QString &networkName, int nodeId)
+/// Per-kind counts for the end-of-run summary log.
+struct Tally
 {
-    return networkName + QLatin1Char(':') + QString::number(nodeId);
+    int created = 0;
+    int updated = 0;
+    int removed = 0;
+};
+
+QDebug operator<<(QDebug dbg, const Tally &t)
+{
+    QDebugStateSaver saver(dbg);
+    dbg.nospace() << "+" << t.created << " ~" << t.updated << " -"
+                  << t.removed;
+    return dbg;
 }
 
-void rebuildRegionCenters(Doc *doc, GraphicsScene *scene, MainWindow *mw)
+/// (networkName, nodeId) → composite key for the MapPoint lookup index.
+/// Kept file-local so the format is in one place; the index is discarded
+/// at end of repopulate so key shape doesn't leak to the rest of the
+/// codebase.
+QString linkageKey(const QString &networkName, const QString &nodeId)
 {
-    for (auto it = doc->regions.begin(); it != doc->regions.end(); ++it)
-        RegionCenterPointFactory::fromRegionSpec(&it.value(), scene, mw);
+    return networkName + QLatin1Char(':') + nodeId;
 }
 
-QHash<QString, MapPoint *>
-rebuildMapPoints(Doc *doc, GraphicsScene *scene, MainWindow *mw)
+/// (from, to, mode) identity shared by a Connection / GlobalLink and the
+/// ConnectionLine bound to it.
+QString lineKey(const QString &from, const QString &to, Mode mode)
 {
-    QHash<QString, MapPoint *> index;
+    return from + QLatin1Char('\x1f') + to + QLatin1Char('\x1f')
+           + QString::number(static_cast<int>(mode));
+}
+
+/// Same rule TerminalController::updateGlobalMapItem applies to decide
+/// whether a terminal keeps a GlobalTerminalItem mirror.
+bool showsOnGlobalMap(const Backend::Scenario::TerminalPlacement &placement)
+{
+    return placement.properties
+        .value(QStringLiteral("Show on Global Map"), true)
+        .toBool();
+}
+
+/// Network objects the document refers to, resolved once per run.
+struct NetworkPlan
+{
+    /// Every live backend network the document's regions or linkages use.
+    /// Scene items referencing anything else are stale.
+    QSet<QObject *> live;
+    /// Linkage networkName → first region (document order) owning it.
+    /// Replaces a regions × linkages scan with one lookup per linkage.
+    QHash<QString, QString> ownerByNetwork;
+};
+
+NetworkPlan planNetworks(Doc *doc)
+{
+    NetworkPlan plan;
     Backend::Application::NetworkViewService networkView;
 
-    for (auto it = doc->regions.begin(); it != doc->regions.end(); ++it)
+    for (auto it = doc->regions.constBegin();
+         it != doc->regions.constEnd(); ++it)
     {
-        for (auto &link : doc->linkages)
+        for (const auto &spec : it.value().networks)
         {
-            if (!networkView.regionOwnsNetwork(
-                    it.key(), link.networkName))
-            {
+            if (const auto view =
+                    networkView.resolveNetworkView(it.key(), spec.name))
+                plan.live.insert(view->networkObject);
+        }
+    }
+
+    QSet<QString> linkageNetworks;
+    for (const auto &link : doc->linkages())
+        linkageNetworks.insert(link.networkName);
+    for (const QString &name : linkageNetworks)
+    {
+        for (auto it = doc->regions.constBegin();
+             it != doc->regions.constEnd(); ++it)
+        {
+            if (!networkView.regionOwnsNetwork(it.key(), name))
                 continue;
-            }
-            if (auto *mp = MapPointFactory::fromNodeLinkage(
-                    &link, it.key(), scene, mw))
-                index.insert(linkageKey(link.networkName, link.nodeId), mp);
+            plan.ownerByNetwork.insert(name, it.key());
+            if (const auto view =
+                    networkView.resolveNetworkView(it.key(), name))
+                plan.live.insert(view->networkObject);
+            break;
         }
     }
-    return index;
+    return plan;
 }
 
-void rebuildTerminals(Doc *doc, GraphicsScene *scene, MainWindow *mw)
+void reconcileRegionCenters(Doc *doc, GraphicsScene *scene, MainWindow *mw)
 {
-    for (auto it = doc->terminals.begin(); it != doc->terminals.end(); ++it)
+    Tally         tally;
+    QSet<QString> kept;
+    const auto existing = scene->getItemsByTypeWithIds<RegionCenterPoint>();
+    for (auto it = existing.constBegin(); it != existing.constEnd(); ++it)
     {
-        auto *item = TerminalItemFactory::fromPlacement(&it.value(), scene, mw);
-        if (item && mw && mw->terminalCtrl())
-            mw->terminalCtrl()->updateGlobalMapItem(item);
+        const QString name = it.value()->getRegionName();
+        auto spec = doc->regions.find(name);
+        if (spec == doc->regions.end() || kept.contains(name))
+        {
+            scene->removeItemWithId<RegionCenterPoint>(it.key());
+            ++tally.removed;
+            continue;
+        }
+        kept.insert(name);
+        RegionCenterPointFactory::rebind(it.value(), &spec.value(), mw);
+        ++tally.updated;
     }
+    for (auto it = doc->regions.begin(); it != doc->regions.end(); ++it)
+    {
+        if (kept.contains(it.key())) continue;
+        if (RegionCenterPointFactory::fromRegionSpec(&it.value(), scene, mw))
+            ++tally.created;
+    }
+    qCDebug(lcGuiScene) << "SceneRepopulator::repopulate: regions" << tally;
 }
 
-void relinkMapPointsToTerminals(
-    Doc *doc, GraphicsScene *scene,
-    const QHash<QString, MapPoint *> &index)
+/// Removes network items whose backend network is no longer referenced
+/// (never dereferencing the possibly-freed network pointer), then draws
+/// the document's networks that have no items yet.
+void reconcileNetworks(Doc *doc, const NetworkPlan &plan,
+                       GraphicsScene *scene, MainWindow *mw)
 {
-    for (auto &link : doc->linkages)
+    Tally tally;
+    // drawNetwork registers its points under the network node's unique
+    // id; linkage-only points (MapPointFactory) use their own UUID. Only
+    // the former, and MapLines, mean "this network is drawn".
+    QSet<QObject *> drawn;
+    QStringList staleLines;
+    const auto lines = scene->itemsOfType<MapLine>();
+    for (auto it = lines.begin(); it != lines.end(); ++it)
     {
-        if (link.excluded) continue;
-        auto *mp = index.value(
-            linkageKey(link.networkName, link.nodeId), nullptr);
-        auto *term = scene->getItemById<TerminalItem>(link.terminalId);
-        if (mp && term) mp->setLinkedTerminal(term);
+        if (!plan.live.contains((*it)->getReferenceNetwork()))
+        {
+            staleLines << it.key();
+            continue;
+        }
+        drawn.insert((*it)->getReferenceNetwork());
     }
-}
+    QStringList stalePoints;
+    // Surviving points by network, so a network about to be drawn can
+    // drop its linkage-only points without rescanning the scene.
+    QHash<QObject *, QStringList> pointsByNetwork;
+    const auto points = scene->itemsOfType<MapPoint>();
+    for (auto it = points.begin(); it != points.end(); ++it)
+    {
+        QObject *network = (*it)->getReferenceNetwork();
+        if (!plan.live.contains(network))
+        {
+            stalePoints << it.key();
+            continue;
+        }
+        if (it.key() != (*it)->getID())
+            drawn.insert(network);
+        pointsByNetwork[network] << it.key();
+    }
+    tally.removed += scene->removeItemsWithIds<MapLine>(staleLines);
+    tally.removed += scene->removeItemsWithIds<MapPoint>(stalePoints);
 
-void rebuildNetworks(Doc *doc, MainWindow *mw)
-{
-    if (!mw || !mw->networkDrawing()) return;
+    if (!mw || !mw->networkDrawing())
+    {
+        qCDebug(lcGuiScene) << "SceneRepopulator::repopulate: network items"
+                            << tally;
+        return;
+    }
 
+    Backend::Application::NetworkViewService networkView;
     for (auto it = doc->regions.constBegin();
          it != doc->regions.constEnd(); ++it)
     {
@@ -99,7 +207,6 @@ void rebuildNetworks(Doc *doc, MainWindow *mw)
              nit != it.value().networks.constEnd(); ++nit)
         {
             const auto &spec = nit.value();
-            QString name = spec.name;
             NetworkType type;
             switch (spec.type) {
             case Backend::NetworkKind::Rail:
@@ -109,11 +216,59 @@ void rebuildNetworks(Doc *doc, MainWindow *mw)
             default:
                 continue;
             }
+            const auto view =
+                networkView.resolveNetworkView(it.key(), spec.name);
+            if (view && drawn.contains(view->networkObject))
+            {
+                ++tally.updated;
+                continue;
+            }
+            // Linkage-only points for a network about to be drawn would
+            // duplicate the drawn nodes; the linkage pass reuses those.
+            if (view)
+                scene->removeItemsWithIds<MapPoint>(
+                    pointsByNetwork.take(view->networkObject));
             // Terminals are restored separately; skip duplicate creation.
-            mw->networkDrawing()->drawNetwork(
-                it.key(), type, name, true);
+            mw->networkDrawing()->drawNetwork(it.key(), type, spec.name,
+                                              true);
+            if (view) drawn.insert(view->networkObject);
+            ++tally.created;
+        }
+    }
+    qCDebug(lcGuiScene) << "SceneRepopulator::repopulate: networks" << tally;
+}
+
+/// Removes every ConnectionLine in @p scene that will not survive the
+/// run: unbound or wrongly-bound lines, lines whose key the document no
+/// longer has, duplicates, and lines touching an endpoint item that is
+/// about to be deleted (the line holds raw endpoint pointers). Returns the
+/// surviving lines by key.
+QHash<QString, ConnectionLine *>
+pruneLines(GraphicsScene *scene, const QSet<QString> &wanted,
+           bool globalLinks, const QSet<QGraphicsItem *> &doomedEndpoints,
+           Tally &tally)
+{
+    QHash<QString, ConnectionLine *> kept;
+    const auto existing = scene->getItemsByTypeWithIds<ConnectionLine>();
+    for (auto it = existing.constBegin(); it != existing.constEnd(); ++it)
+    {
+        ConnectionLine *line = it.value();
+        const bool bound = globalLinks ? line->isGlobalLinkBinding()
+                                       : line->isConnectionBinding();
+        const QString key =
+            lineKey(line->boundFromTerminalId(), line->boundToTerminalId(),
+                    line->connectionType());
+        if (!bound || !wanted.contains(key) || kept.contains(key)
+            || doomedEndpoints.contains(line->startItem())
+            || doomedEndpoints.contains(line->endItem()))
+        {
+            scene->removeItemWithId<ConnectionLine>(it.key());
+            ++tally.removed;
+            continue;
         }
+        kept.insert(key, line);
     }
+    return kept;
 }
 
 } // namespace
@@ -134,41 +289,211 @@ void SceneRepopulator::repopulate(Doc           *doc,
     qCInfo(lcGuiScene) << "SceneRepopulator::repopulate: (4-arg) begin";
     if (!doc || !regionScene) return;
 
-    // 1. Tear down. clearAll() keeps the type-registry consistent with the
-    //    underlying Qt scene; QGraphicsScene::clear() alone would leak
-    //    dangling pointers via itemsByType.
-    regionScene->clearAll();
-    if (globalScene) globalScene->clearAll();
-
-    // 2-5. Rebuild region scene in layered passes. Each helper is
-    //      file-local (anonymous namespace) so the public interface
-    //      remains a single entry point.
-    rebuildRegionCenters(doc, regionScene, mainWindow);
-    qCDebug(lcGuiScene) << "SceneRepopulator::repopulate:"
-                        << "regions=" << doc->regions.size();
-    rebuildNetworks(doc, mainWindow);
-    const auto mapPointIndex =
-        rebuildMapPoints(doc, regionScene, mainWindow);
-    rebuildTerminals(doc, regionScene, mainWindow);
-    qCDebug(lcGuiScene) << "SceneRepopulator::repopulate:"
-                        << "terminals=" << doc->terminals.size();
-    relinkMapPointsToTerminals(doc, regionScene, mapPointIndex);
-
-    // 6. Connection → ConnectionLine on the region scene.
-    for (auto &conn : doc->connections)
-        ConnectionLineFactory::fromConnection(doc, &conn, regionScene,
-                                              mainWindow);
-
-    qCDebug(lcGuiScene) << "SceneRepopulator::repopulate:"
-                        << "connections=" << doc->connections.size();
-
-    // 7. GlobalLink → ConnectionLine on the global scene.
+    // 1. Drop tracked items of kinds the document does not describe.
+    //    Everything else is diffed below and kept where possible.
+    regionScene->removeItemsNotOfType(
+        {TerminalItem::Type, MapPoint::Type, MapLine::Type,
+         ConnectionLine::Type, RegionCenterPoint::Type});
+    if (globalScene)
+        globalScene->removeItemsNotOfType(
+            {GlobalTerminalItem::Type, ConnectionLine::Type});
+
+    // 2. Regions and networks.
+    reconcileRegionCenters(doc, regionScene, mainWindow);
+    const NetworkPlan networks = planNetworks(doc);
+    reconcileNetworks(doc, networks, regionScene, mainWindow);
+
+    // 3. Decide which terminals and global mirrors go away. Existing
+    //    items are addressed by registry key only: their placement
+    //    pointers may already dangle (the document was reset or is
+    //    being replaced), so nothing below dereferences them until
+    //    TerminalItemFactory::rebind has re-pointed them.
+    const auto terminals = regionScene->getItemsByTypeWithIds<TerminalItem>();
+    QSet<QGraphicsItem *> doomedTerminals;
+    for (auto it = terminals.constBegin(); it != terminals.constEnd(); ++it)
+        if (!doc->terminals.contains(it.key()))
+            doomedTerminals.insert(it.value());
+
+    QMap<QString, GlobalTerminalItem *> mirrors;
+    QSet<QGraphicsItem *>               doomedMirrors;
+    if (globalScene)
+    {
+        mirrors = globalScene->getItemsByTypeWithIds<GlobalTerminalItem>();
+        for (auto it = mirrors.constBegin(); it != mirrors.constEnd(); ++it)
+        {
+            auto placement = doc->terminals.constFind(it.key());
+            TerminalItem *owner = terminals.value(it.key(), nullptr);
+            if (placement == doc->terminals.constEnd() || !owner
+                || doomedTerminals.contains(owner)
+                || owner->getGlobalTerminalItem() != it.value()
+                || !showsOnGlobalMap(placement.value()))
+                doomedMirrors.insert(it.value());
+        }
+    }
+
+    // 4. Lines touching doomed endpoints go first, while the endpoints
+    //    are still alive.
+    Tally connTally, linkTally;
+    QSet<QString> wantedConnections;
+    for (const auto &conn : doc->connections())
+        wantedConnections.insert(
+            lineKey(conn.fromTerminalId, conn.toTerminalId, conn.mode));
+    auto keptConnections = pruneLines(regionScene, wantedConnections,
+                                      /*globalLinks=*/false,
+                                      doomedTerminals, connTally);
+    QHash<QString, ConnectionLine *> keptLinks;
     if (globalScene)
-        for (auto &gl : doc->globalLinks)
-            ConnectionLineFactory::fromGlobalLink(doc, &gl, globalScene,
-                                                  mainWindow);
+    {
+        QSet<QString> wantedLinks;
+        for (const auto &gl : doc->globalLinks())
+            wantedLinks.insert(
+                lineKey(gl.fromTerminalId, gl.toTerminalId, gl.mode));
+        keptLinks = pruneLines(globalScene, wantedLinks,
+                               /*globalLinks=*/true, doomedMirrors,
+                               linkTally);
+    }
+
+    // 5. MapPoints hold a raw pointer to their linked terminal.
+    for (MapPoint *mp : regionScene->getItemsByType<MapPoint>())
+        if (doomedTerminals.contains(mp->getLinkedTerminal()))
+            mp->setLinkedTerminal(nullptr);
+
+    // 6. Terminals: delete, re-point, create. Event wiring happens only
+    //    in the factory, i.e. only for new items.
+    Tally termTally;
+    for (auto it = mirrors.constBegin(); it != mirrors.constEnd(); ++it)
+        if (doomedMirrors.contains(it.value()))
+            globalScene->removeItemWithId<GlobalTerminalItem>(it.key());
+    for (auto it = terminals.constBegin(); it != terminals.constEnd(); ++it)
+    {
+        if (!doomedTerminals.contains(it.value())) continue;
+        regionScene->removeItemWithId<TerminalItem>(it.key());
+        ++termTally.removed;
+    }
+    TerminalController *terminalCtrl =
+        mainWindow ? mainWindow->terminalCtrl() : nullptr;
+    for (auto it = doc->terminals.begin(); it != doc->terminals.end(); ++it)
+    {
+        TerminalItem *item = terminals.value(it.key(), nullptr);
+        if (item)
+        {
+            TerminalItemFactory::rebind(item, &it.value(), mainWindow);
+            ++termTally.updated;
+        }
+        else
+        {
+            item = TerminalItemFactory::fromPlacement(&it.value(),
+                                                      regionScene,
+                                                      mainWindow);
+            if (item) ++termTally.created;
+        }
+        if (item && terminalCtrl)
+            terminalCtrl->updateGlobalMapItem(item);
+    }
+
+    // 7. NodeLinkage → MapPoint through a per-run index instead of a
+    //    scene scan per linkage, then link each MapPoint to its
+    //    terminal. Every surviving MapPoint is re-pointed: the
+    //    linkages list may have been rebuilt.
+    Tally pointTally;
+    {
+        Backend::Application::NetworkViewService networkView;
+        QHash<QObject *, QString>  networkNames;
+        QHash<QString, MapPoint *> index;
+        for (MapPoint *mp : regionScene->getItemsByType<MapPoint>())
+        {
+            mp->setLinkageModel(nullptr);
+            QObject *network = mp->getReferenceNetwork();
+            auto name = networkNames.find(network);
+            if (name == networkNames.end())
+                name = networkNames.insert(
+                    network, networkView.networkNameOf(network));
+            index.insert(
+                linkageKey(name.value(), mp->getReferencedNetworkNodeID()),
+                mp);
+        }
+
+        QHash<MapPoint *, TerminalItem *> links;
+        for (const auto &link : doc->linkages())
+        {
+            const QString region =
+                networks.ownerByNetwork.value(link.networkName);
+            if (region.isEmpty()) continue;
+            const QString key =
+                linkageKey(link.networkName, QString::number(link.nodeId));
+            MapPoint *mp = index.value(key, nullptr);
+            if (mp)
+            {
+                mp->setLinkageModel(&link);
+                ++pointTally.updated;
+            }
+            else if ((mp = MapPointFactory::createFromNodeLinkage(
+                          &link, region, regionScene, mainWindow)))
+            {
+                index.insert(key, mp);
+                ++pointTally.created;
+            }
+            if (!mp || link.excluded) continue;
+            if (auto *term =
+                    regionScene->getItemById<TerminalItem>(link.terminalId))
+                links.insert(mp, term);
+        }
+        for (MapPoint *mp : regionScene->getItemsByType<MapPoint>())
+        {
+            TerminalItem *term = links.value(mp, nullptr);
+            if (mp->getLinkedTerminal() != term)
+                mp->setLinkedTerminal(term);
+        }
+    }
+
+    // 8. Connection → ConnectionLine on the region scene.
+    for (const auto &conn : doc->connections())
+    {
+        const QString key =
+            lineKey(conn.fromTerminalId, conn.toTerminalId, conn.mode);
+        if (auto *line = keptConnections.take(key))
+        {
+            line->bindToConnection(doc, conn.fromTerminalId,
+                                   conn.toTerminalId, conn.mode);
+            line->refreshFromModel();
+            ++connTally.updated;
+        }
+        else if (ConnectionLineFactory::fromConnection(doc, &conn,
+                                                       regionScene,
+                                                       mainWindow))
+        {
+            ++connTally.created;
+        }
+    }
+
+    // 9. GlobalLink → ConnectionLine on the global scene.
+    if (globalScene)
+    {
+        for (const auto &gl : doc->globalLinks())
+        {
+            const QString key =
+                lineKey(gl.fromTerminalId, gl.toTerminalId, gl.mode);
+            if (auto *line = keptLinks.take(key))
+            {
+                line->bindToGlobalLink(doc, gl.fromTerminalId,
+                                       gl.toTerminalId, gl.mode);
+                line->refreshFromModel();
+                ++linkTally.updated;
+            }
+            else if (ConnectionLineFactory::fromGlobalLink(doc, &gl,
+                                                           globalScene,
+                                                           mainWindow))
+            {
+                ++linkTally.created;
+            }
+        }
+    }
 
-    qCInfo(lcGuiScene) << "SceneRepopulator::repopulate: complete";
+    qCInfo(lcGuiScene) << "SceneRepopulator::repopulate: complete"
+                       << "terminals" << termTally
+                       << "mapPoints" << pointTally
+                       << "connections" << connTally
+                       << "globalLinks" << linkTally;
 }
 
 } // namespace Scenario
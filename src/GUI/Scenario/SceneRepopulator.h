@@ -15,20 +15,34 @@ class GraphicsScene;
 namespace Scenario {
 
 /**
- * @brief Tear down the region / global scenes and rebuild them as views
- *        over the given ScenarioDocument.
+ * @brief Reconcile the region / global scenes with the given
+ *        ScenarioDocument.
  *
- * Rebuild order:
- *   1. Both scenes are cleared via GraphicsScene::clearAll (registry-safe).
- *   2. RegionSpec → RegionCenterPoint via RegionCenterPointFactory.
- *   3. NodeLinkage → MapPoint via MapPointFactory (per owning region's
- *      live RegionData).
- *   4. TerminalPlacement → TerminalItem via TerminalItemFactory.
- *   5. Link each MapPoint back to its TerminalItem by looking up the
- *      linkage's (networkName, nodeId) in a per-run QHash index.
- *   6. Connection / GlobalLink → ConnectionLine (Task 4 — deferred).
+ * Items are matched to document entities by stable id and only the
+ * difference is applied: missing views are created through the
+ * factories (which bind events via ItemEventBinder), surviving views are
+ * re-pointed at the current document entries and refreshed, and views
+ * with no entity are deleted. Re-running on an unchanged document
+ * creates and deletes nothing.
  *
- * Idempotent. Null-safe (null doc or null scenes → no-op early return).
+ * Identity per kind:
+ *   - RegionSpec → RegionCenterPoint by region name.
+ *   - Region network → MapLine / MapPoint items by backend network
+ *     object; items of networks the document no longer references are
+ *     removed, networks without items are drawn.
+ *   - TerminalPlacement → TerminalItem by terminal id (registry key);
+ *     GlobalTerminalItem mirrors follow via TerminalController.
+ *   - NodeLinkage → MapPoint by (networkName, nodeId), through a per-run
+ *     QHash index; each MapPoint is then linked to its terminal.
+ *   - Connection / GlobalLink → ConnectionLine by (from, to, mode).
+ *
+ * Lines are pruned before terminals and mirrors are deleted, since they
+ * hold raw endpoint pointers. Tracked items of any other kind are
+ * removed. Surviving items may carry pointers into a reset or outgoing
+ * document, so existing items are addressed by registry key and not
+ * dereferenced through their old bindings.
+ *
+ * Null-safe (null doc or null region scene → no-op early return).
  */
 class SceneRepopulator
 {
@@ -89,6 +89,18 @@ TerminalItem *TerminalItemFactory::fromPlacement(
     return item;
 }
 
+void TerminalItemFactory::rebind(
+    TerminalItem                         *item,
+    Backend::Scenario::TerminalPlacement *placement,
+    MainWindow                           *mainWindow)
+{
+    if (!item || !placement) return;
+    item->setPlacement(placement);
+    const QPointF pos = scenePositionFor(*placement, mainWindow);
+    if (item->pos() != pos)
+        item->setPos(pos);
+}
+
 } // namespace Scenario
 } // namespace GUI
 } // namespace CargoNetSim
@@ -43,6 +43,14 @@ public:
     fromPlacement(Backend::Scenario::TerminalPlacement *placement,
                   GraphicsScene                         *scene,
                   MainWindow                            *mainWindow);
+
+    /// Re-point an existing item at @p placement (setPlacement + position
+    /// from the placement's PositionMode). Leaves scene membership and
+    /// event wiring untouched. Used by SceneRepopulator for items it
+    /// keeps across a rebuild.
+    static void rebind(TerminalItem                         *item,
+                       Backend::Scenario::TerminalPlacement *placement,
+                       MainWindow                           *mainWindow);
 };
 
 } // namespace Scenario
@@ -11,13 +11,98 @@ PathComparisonViewModel::PathComparisonViewModel(
 {
 }
 
+std::shared_ptr<PathComparisonViewModel>
+PathComparisonViewModel::snapshot(
+    const QList<const PathData *> &paths)
+{
+    std::shared_ptr<PathComparisonViewModel> viewModel(
+        new PathComparisonViewModel());
+    viewModel->m_ownedRecords.reserve(paths.size());
+    for (const PathData *pathData : paths)
+    {
+        if (pathData)
+            viewModel->m_ownedRecords.push_back(*pathData);
+    }
+    // Pointers are taken only after the vector stops growing.
+    viewModel->m_paths.reserve(
+        static_cast<qsizetype>(viewModel->m_ownedRecords.size()));
+    for (const PathData &record : viewModel->m_ownedRecords)
+        viewModel->m_paths.append(&record);
+    return viewModel;
+}
+
+void PathComparisonViewModel::precompute()
+{
+    m_aggregates.clear();
+    m_aggregates.reserve(m_paths.size());
+    m_maxSegments  = m_service.maxSegments(m_paths);
+    m_maxTerminals = m_service.maxTerminals(m_paths);
+
+    for (const PathData *pathData : m_paths)
+    {
+        if (!pathData || m_aggregates.contains(pathData))
+            continue;
+
+        PathAggregates aggregates;
+        aggregates.summary   = m_service.summary(*pathData);
+        aggregates.terminals = m_service.terminalEntries(*pathData);
+        aggregates.segments  = m_service.segmentEntries(*pathData);
+        aggregates.totals    = m_service.pathCostTotals(*pathData);
+
+        const int terminalCount =
+            pathData->path
+                ? static_cast<int>(
+                      pathData->path->getTerminalsInPath().size())
+                : 0;
+        const int segmentCount =
+            pathData->path
+                ? static_cast<int>(
+                      pathData->path->getSegments().size())
+                : 0;
+
+        aggregates.terminalValues.reserve(terminalCount);
+        for (int i = 0; i < terminalCount; ++i)
+            aggregates.terminalValues.append(
+                m_service.terminalValues(*pathData, i));
+
+        aggregates.segmentValues.reserve(segmentCount);
+        aggregates.segmentPredictedCosts.reserve(segmentCount);
+        aggregates.segmentActualCosts.reserve(segmentCount);
+        for (int i = 0; i < segmentCount; ++i)
+        {
+            aggregates.segmentValues.append(
+                m_service.segmentValues(*pathData, i));
+            aggregates.segmentPredictedCosts.append(
+                m_service.segmentPredictedCosts(*pathData, i));
+            aggregates.segmentActualCosts.append(
+                m_service.segmentActualCosts(*pathData, i));
+        }
+
+        m_aggregates.insert(pathData, std::move(aggregates));
+    }
+    m_precomputed = true;
+}
+
+const PathComparisonViewModel::PathAggregates *
+PathComparisonViewModel::aggregates(const PathData *pathData) const
+{
+    if (!m_precomputed || !pathData)
+        return nullptr;
+    const auto it = m_aggregates.constFind(pathData);
+    return it == m_aggregates.constEnd() ? nullptr : &it.value();
+}
+
 int PathComparisonViewModel::maxSegments() const
 {
+    if (m_precomputed)
+        return m_maxSegments;
     return m_service.maxSegments(m_paths);
 }
 
 int PathComparisonViewModel::maxTerminals() const
 {
+    if (m_precomputed)
+        return m_maxTerminals;
     return m_service.maxTerminals(m_paths);
 }
 
@@ -33,6 +118,8 @@ PathComparisonViewModel::pathSummary(
         out.endTerminalName = QObject::tr("Unknown");
         return out;
     }
+    if (const PathAggregates *cached = aggregates(pathData))
+        return cached->summary;
     return m_service.summary(*pathData);
 }
 
@@ -42,6 +129,8 @@ PathComparisonViewModel::terminalEntries(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData))
+        return cached->terminals;
     return m_service.terminalEntries(*pathData);
 }
 
@@ -51,6 +140,8 @@ PathComparisonViewModel::segmentEntries(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData))
+        return cached->segments;
     return m_service.segmentEntries(*pathData);
 }
 
@@ -82,6 +173,12 @@ PathComparisonViewModel::terminalValues(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData);
+        cached && terminalIndex >= 0
+        && terminalIndex < cached->terminalValues.size())
+    {
+        return cached->terminalValues.at(terminalIndex);
+    }
     return m_service.terminalValues(*pathData, terminalIndex);
 }
 
@@ -99,6 +196,12 @@ PathComparisonViewModel::segmentValues(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData);
+        cached && segmentIndex >= 0
+        && segmentIndex < cached->segmentValues.size())
+    {
+        return cached->segmentValues.at(segmentIndex);
+    }
     return m_service.segmentValues(*pathData, segmentIndex);
 }
 
@@ -108,6 +211,12 @@ PathComparisonViewModel::segmentPredictedCosts(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData);
+        cached && segmentIndex >= 0
+        && segmentIndex < cached->segmentPredictedCosts.size())
+    {
+        return cached->segmentPredictedCosts.at(segmentIndex);
+    }
     return m_service.segmentPredictedCosts(*pathData,
                                            segmentIndex);
 }
@@ -118,6 +227,12 @@ PathComparisonViewModel::segmentActualCosts(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData);
+        cached && segmentIndex >= 0
+        && segmentIndex < cached->segmentActualCosts.size())
+    {
+        return cached->segmentActualCosts.at(segmentIndex);
+    }
     return m_service.segmentActualCosts(*pathData,
                                         segmentIndex);
 }
@@ -128,6 +243,8 @@ PathComparisonViewModel::pathCostTotals(
 {
     if (!pathData)
         return {};
+    if (const PathAggregates *cached = aggregates(pathData))
+        return cached->totals;
     return m_service.pathCostTotals(*pathData);
 }
 
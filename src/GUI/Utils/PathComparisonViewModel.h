@@ -2,11 +2,32 @@
 
 #include "Backend/Application/PathPresentationService.h"
 
+#include <QHash>
+#include <QVector>
+
+#include <memory>
+#include <vector>
+
 namespace CargoNetSim
 {
 namespace GUI
 {
 
+/**
+ * @brief Presentation values for a set of compared paths
+ *
+ * Every comparison tab, the CSV export and the PDF report ask
+ * for the same summaries, terminal/segment values and cost
+ * totals many times over. precompute() derives all of them
+ * once per path; afterwards the getters are plain lookups and
+ * the object is safe to read from any thread. Getters for
+ * values that were not precomputed fall back to the
+ * presentation service.
+ *
+ * snapshot() copies the records, so the result stays valid
+ * after the table that owned them is cleared, and can be
+ * shared between a dialog, a report job and its preview.
+ */
 class PathComparisonViewModel
 {
 public:
@@ -26,9 +47,21 @@ public:
     using SegmentEntry =
         Backend::Application::PathPresentationSegmentEntry;
 
+    /// Non-owning view; the records must outlive the view model.
     explicit PathComparisonViewModel(
         const QList<const PathData *> &paths);
 
+    /// Owning copy of @p paths, not yet precomputed.
+    static std::shared_ptr<PathComparisonViewModel>
+    snapshot(const QList<const PathData *> &paths);
+
+    /// Derive every per-path value once. Not thread-safe itself;
+    /// run it before sharing the view model.
+    void precompute();
+    bool isPrecomputed() const { return m_precomputed; }
+
+    const QList<const PathData *> &paths() const { return m_paths; }
+
     int maxSegments() const;
     int maxTerminals() const;
 
@@ -66,8 +99,32 @@ public:
     QString costDifferenceText(const PathData *pathData) const;
 
 private:
-    const QList<const PathData *> &m_paths;
+    struct PathAggregates
+    {
+        PathSummary                    summary;
+        QList<TerminalEntry>           terminals;
+        QList<SegmentEntry>            segments;
+        PathCostTotals                 totals;
+        QVector<TerminalDisplayValues> terminalValues;
+        QVector<SegmentDisplayValues>  segmentValues;
+        QVector<CostSnapshot>          segmentPredictedCosts;
+        QVector<CostSnapshot>          segmentActualCosts;
+    };
+
+    PathComparisonViewModel() = default;
+
+    const PathAggregates *aggregates(const PathData *pathData) const;
+
+    /// Backing store for snapshot(); m_paths points into it.
+    std::vector<PathData> m_ownedRecords;
+
+    QList<const PathData *> m_paths;
     Backend::Application::PathPresentationService m_service;
+
+    bool m_precomputed  = false;
+    int  m_maxSegments  = 0;
+    int  m_maxTerminals = 0;
+    QHash<const PathData *, PathAggregates> m_aggregates;
 };
 
 } // namespace GUI
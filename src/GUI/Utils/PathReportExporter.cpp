@@ -15,20 +15,162 @@
 #include <QApplication>
 #include <QDir>
 #include <QFileDialog>
+#include <QEventLoop>
 #include <QMessageBox>
+#include <QProgressDialog>
+#include <QThread>
 #include <QtCore/QtCore>
 #include "Backend/Commons/LogCategories.h"
+#include "GUI/Utils/PathComparisonViewModel.h"
+#include "GUI/Utils/PathReportWorker.h"
 
 namespace CargoNetSim
 {
 namespace GUI
 {
 
+namespace
+{
+
+/// Identity of a report: the paths in order plus every value that
+/// changes once a path is simulated or executed.
+QByteArray reportKey(
+    const QList<const PathReportExporter::PathData *> &pathData)
+{
+    QByteArray key;
+    for (const auto *record : pathData)
+    {
+        if (!record)
+            continue;
+        key += record->executionPathKey.toUtf8();
+        key += '|';
+        key += QByteArray::number(
+            record->path ? record->path->getTotalPathCost() : -1.0,
+            'g', 17);
+        key += '|';
+        key += QByteArray::number(record->simulationTotalCost, 'g', 17);
+        key += '|';
+        key += QByteArray::number(record->simulationEdgeCosts, 'g', 17);
+        key += '|';
+        key += QByteArray::number(record->simulationTerminalCosts,
+                                  'g', 17);
+        key += record->executionResult.has_value() ? "|r;" : "|-;";
+    }
+    return key;
+}
+
+} // namespace
+
 PathReportExporter::PathReportExporter(QObject *parent)
     : QObject(parent)
 {
 }
 
+void PathReportExporter::clearCache()
+{
+    m_cachedReportKey.clear();
+    m_cachedReport.reset();
+}
+
+std::shared_ptr<KDReports::Report> PathReportExporter::reportFor(
+    const QList<const PathData *> &pathData, QWidget *parent,
+    bool *cancelled)
+{
+    if (cancelled)
+        *cancelled = false;
+
+    const QByteArray key = reportKey(pathData);
+    if (m_cachedReport && key == m_cachedReportKey)
+    {
+        qCDebug(lcGuiUtil) << "PathReportExporter::reportFor:"
+                           << "reusing cached report";
+        return m_cachedReport;
+    }
+    clearCache();
+
+    // The worker reads its own copy of the records, so the table
+    // may change while the nested event loop below is running.
+    auto viewModel = PathComparisonViewModel::snapshot(pathData);
+
+    QThread          thread;
+    PathReportWorker worker;
+    worker.initialize(viewModel, QThread::currentThread());
+    worker.moveToThread(&thread);
+
+    QProgressDialog progress(tr("Generating path report..."),
+                             tr("Cancel"), 0, 0, parent);
+    progress.setWindowTitle(tr("Path Report"));
+    progress.setWindowModality(Qt::WindowModal);
+    progress.setMinimumDuration(300);
+    progress.setAutoReset(false);
+    progress.setAutoClose(false);
+
+    std::shared_ptr<KDReports::Report> report;
+    bool                               wasCancelled = false;
+    QString                            errorMessage;
+    QEventLoop                         loop;
+
+    connect(&thread, &QThread::started, &worker,
+            &PathReportWorker::process);
+    connect(&worker, &PathReportWorker::progressChanged, &progress,
+            [&progress](int completed, int total) {
+                progress.setMaximum(total);
+                progress.setValue(completed);
+            });
+    connect(&worker, &PathReportWorker::resultReady, &loop,
+            [&report](KDReports::Report *result) {
+                report.reset(result);
+            });
+    connect(&worker, &PathReportWorker::cancelled, &loop,
+            [&wasCancelled]() { wasCancelled = true; });
+    connect(&worker, &PathReportWorker::error, &loop,
+            [&errorMessage](const QString &message) {
+                errorMessage = message;
+            });
+    connect(&worker, &PathReportWorker::finished, &thread,
+            &QThread::quit);
+    connect(&thread, &QThread::finished, &loop, &QEventLoop::quit);
+    // Direct: the worker thread is busy generating, cancel() only
+    // flips an atomic flag.
+    connect(
+        &progress, &QProgressDialog::canceled, &worker,
+        [&worker]() { worker.cancel(); }, Qt::DirectConnection);
+
+    thread.start();
+    loop.exec();
+    thread.wait();
+    progress.close();
+
+    if (!errorMessage.isEmpty())
+    {
+        qCWarning(lcGuiUtil) << "PathReportExporter::reportFor:"
+                             << errorMessage;
+    }
+    if (cancelled)
+        *cancelled = wasCancelled;
+    if (!report)
+        return nullptr;
+
+    m_cachedReportKey = key;
+    m_cachedReport    = report;
+    return report;
+}
+
+bool PathReportExporter::writeReport(KDReports::Report &report,
+                                     const QString     &filePath)
+{
+    try
+    {
+        return report.exportToFile(filePath);
+    }
+    catch (const std::exception &e)
+    {
+        qCWarning(lcGuiUtil)
+            << "Failed to export report:" << e.what();
+        return false;
+    }
+}
+
 bool PathReportExporter::exportSinglePath(
     const PathData *pathData, const QString &filePath)
 {
@@ -42,33 +184,7 @@ bool PathReportExporter::exportSinglePath(
     // Create a list with just the one path
     QList<const PathData *> pathList;
     pathList.append(pathData);
-
-    // Create the report generator
-    PathReportGenerator generator(pathList);
-
-    // Generate the report
-    auto report = generator.generateReport();
-
-    if (report)
-    {
-        // Export to PDF
-        try
-        {
-            report->exportToFile(filePath);
-            return true;
-        }
-        catch (const std::exception &e)
-        {
-            qCWarning(lcGuiUtil)
-                << "Failed to export report:" << e.what();
-            return false;
-        }
-    }
-    else
-    {
-        qCWarning(lcGuiUtil) << "Failed to export report:";
-        return false;
-    }
+    return exportMultiplePaths(pathList, filePath);
 }
 
 bool PathReportExporter::exportMultiplePaths(
@@ -82,32 +198,14 @@ bool PathReportExporter::exportMultiplePaths(
         return false;
     }
 
-    // Create the report generator
-    PathReportGenerator generator(pathData);
-
-    // Generate the report
-    auto report = generator.generateReport();
-
-    if (report)
+    const auto report = reportFor(pathData, nullptr);
+    if (!report)
     {
-        // Export to PDF
-        try
-        {
-            report->exportToFile(filePath);
-            return true;
-        }
-        catch (const std::exception &e)
-        {
-            qCWarning(lcGuiUtil)
-                << "Failed to export report:" << e.what();
-            return false;
-        }
-    }
-    else
-    {
-        qCWarning(lcGuiUtil) << "Failed to export report:";
+        qCWarning(lcGuiUtil) << "PathReportExporter::exportMultiplePaths:"
+                             << "no report generated";
         return false;
     }
+    return writeReport(*report, filePath);
 }
 
 bool PathReportExporter::exportPathsWithDialog(
@@ -142,8 +240,12 @@ bool PathReportExporter::exportPathsWithDialog(
         filePath += ".pdf";
     }
 
-    // Export the report
-    bool result = exportMultiplePaths(pathData, filePath);
+    // Generate (or reuse) the report, then write it
+    bool       cancelled = false;
+    const auto report    = reportFor(pathData, parent, &cancelled);
+    if (cancelled)
+        return false;
+    const bool result = report && writeReport(*report, filePath);
 
     if (result)
     {
@@ -180,26 +282,11 @@ bool PathReportExporter::previewReport(
 
     try
     {
-        // Create a temporary file
-        QTemporaryFile tempFile;
-        tempFile.setAutoRemove(
-            false); // Keep the file until we're done with
-                    // it
-
-        if (!tempFile.open())
-        {
-            qCWarning(lcGuiUtil) << "PathReportExporter::previewReport:"
-                                 << "failed to create temp file";
-            QMessageBox::critical(
-                parent, tr("Preview Error"),
-                tr("Failed to create temporary file for "
-                   "report preview."));
+        // Generate (or reuse) the report
+        bool       cancelled = false;
+        const auto report    = reportFor(pathData, parent, &cancelled);
+        if (cancelled)
             return false;
-        }
-
-        // Generate the report
-        PathReportGenerator generator(pathData);
-        auto report = generator.generateReport();
         if (!report)
         {
             qCWarning(lcGuiUtil) << "PathReportExporter::previewReport:"
@@ -212,7 +299,7 @@ bool PathReportExporter::previewReport(
         }
 
         // Create and show the preview dialog
-        KDReports::PreviewDialog previewDialog(report,
+        KDReports::PreviewDialog previewDialog(report.get(),
                                                parent);
         previewDialog.setWindowTitle(
             tr("Path Report Preview"));
@@ -14,9 +14,12 @@
 
 #include "Backend/Application/PathPresentationService.h"
 #include "PathReportGenerator.h"
+#include <QByteArray>
 #include <QObject>
 #include <QString>
 
+#include <memory>
+
 namespace CargoNetSim
 {
 namespace GUI
@@ -29,6 +32,12 @@ namespace GUI
  * This class provides methods for creating comprehensive
  * PDF reports of path data, including individual path
  * details and comparisons between multiple paths.
+ *
+ * Reports are generated by a PathReportWorker on a background
+ * thread behind a cancellable progress dialog. The last report
+ * is kept and reused while the same paths (with the same
+ * predicted and simulated costs) are requested again, so
+ * previewing and then saving generates it only once.
  */
 class PathReportExporter : public QObject
 {
@@ -96,6 +105,30 @@ public:
     bool previewReport(
         const QList<const PathData *> &pathData,
         QWidget *parent = nullptr);
+
+    /**
+     * @brief Drops the cached report
+     */
+    void clearCache();
+
+private:
+    /**
+     * @brief Returns the report for @p pathData, generating it
+     * on a worker thread unless the cached one still matches
+     * @param pathData Paths to include
+     * @param parent Parent widget for the progress dialog
+     * @param cancelled Set to true if the user cancelled
+     * @return The report, or nullptr on failure or cancel
+     */
+    std::shared_ptr<KDReports::Report>
+    reportFor(const QList<const PathData *> &pathData,
+              QWidget *parent, bool *cancelled = nullptr);
+
+    bool writeReport(KDReports::Report &report,
+                     const QString     &filePath);
+
+    QByteArray                         m_cachedReportKey;
+    std::shared_ptr<KDReports::Report> m_cachedReport;
 };
 
 } // namespace GUI
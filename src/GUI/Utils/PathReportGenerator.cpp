@@ -166,17 +166,33 @@ QString yesNo(bool value)
     return value ? QObject::tr("Yes") : QObject::tr("No");
 }
 
+std::shared_ptr<const PathComparisonViewModel> precomputedViewModel(
+    const QList<const PathReportGenerator::PathData *> &pathData)
+{
+    auto viewModel =
+        std::make_shared<PathComparisonViewModel>(pathData);
+    viewModel->precompute();
+    return viewModel;
+}
+
 } // namespace
 
 PathReportGenerator::PathReportGenerator(
     const QList<const PathData *> &pathData,
     QObject *parent)
+    : PathReportGenerator(precomputedViewModel(pathData), parent)
+{
+}
+
+PathReportGenerator::PathReportGenerator(
+    std::shared_ptr<const PathComparisonViewModel> viewModel,
+    QObject *parent)
     : QObject(parent)
-    , m_pathData(pathData)
-    , m_viewModel(pathData)
+    , m_pathData(viewModel->paths())
+    , m_viewModel(std::move(viewModel))
 {
     qCDebug(lcGuiUtil) << "PathReportGenerator::PathReportGenerator: pathData count"
-                       << pathData.size();
+                       << m_pathData.size();
     // Initialize fonts
     m_pageTitleFont     = QFont("Arial", 18, QFont::Bold);
     m_sectionTitleFont  = QFont("Arial", 14, QFont::Bold);
@@ -209,6 +225,9 @@ KDReports::Report *PathReportGenerator::generateReport()
 {
     qCInfo(lcGuiUtil) << "PathReportGenerator::generateReport: generating for"
                       << m_pathData.size() << "paths";
+    m_completedSteps = 0;
+    emit progressChanged(0, totalSteps());
+
     // Create the report
     KDReports::Report *report = new KDReports::Report();
 
@@ -243,18 +262,35 @@ KDReports::Report *PathReportGenerator::generateReport()
     // Set default title
     // report.setReportTitle(tr("Path Analysis Report"));
 
+    // Each section is one progress step; a cancel request is
+    // honoured between steps and discards the partial report.
+    const auto abandon = [report]() -> KDReports::Report * {
+        qCInfo(lcGuiUtil)
+            << "PathReportGenerator::generateReport: cancelled";
+        delete report;
+        return nullptr;
+    };
+
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: adding report header";
     addReportHeader(report);
+    if (!advance())
+        return abandon();
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: adding executive summary";
     addExecutiveSummary(report);
+    if (!advance())
+        return abandon();
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: adding report notes";
     addReportNotes(report);
+    if (!advance())
+        return abandon();
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: adding table of contents";
     addTableOfContents(report);
+    if (!advance())
+        return abandon();
 
     // Start a new page for path details
     report->addPageBreak();
@@ -262,6 +298,8 @@ KDReports::Report *PathReportGenerator::generateReport()
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: adding comparative analysis";
     addComparativeAnalysis(report);
+    if (isCancelRequested())
+        return abandon();
 
     // Start a new page for comparative analysis
     report->addPageBreak();
@@ -269,12 +307,38 @@ KDReports::Report *PathReportGenerator::generateReport()
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: adding individual path sections";
     addIndividualPathSections(report);
+    if (isCancelRequested())
+        return abandon();
 
     qCInfo(lcGuiUtil)
         << "PathReportGenerator::generateReport: completed";
     return report;
 }
 
+void PathReportGenerator::requestCancel()
+{
+    m_cancelRequested.store(true, std::memory_order_relaxed);
+}
+
+bool PathReportGenerator::isCancelRequested() const
+{
+    return m_cancelRequested.load(std::memory_order_relaxed);
+}
+
+int PathReportGenerator::totalSteps() const
+{
+    // Header, summary, notes, contents, the seven comparative
+    // tables and one step per path.
+    return 11 + static_cast<int>(m_pathData.size());
+}
+
+bool PathReportGenerator::advance()
+{
+    ++m_completedSteps;
+    emit progressChanged(m_completedSteps, totalSteps());
+    return !isCancelRequested();
+}
+
 void PathReportGenerator::addReportHeader(
     KDReports::Report *report)
 {
@@ -338,7 +402,7 @@ void PathReportGenerator::addExecutiveSummary(
             continue;
 
         ++validPathCount;
-        const auto summary = m_viewModel.pathSummary(pathData);
+        const auto summary = m_viewModel->pathSummary(pathData);
         if (summary.predictedTotalCost < bestPredictedCost)
         {
             bestPredictedCost = summary.predictedTotalCost;
@@ -382,7 +446,7 @@ void PathReportGenerator::addExecutiveSummary(
     styleTableCell(
         keyTable, row, 1,
         bestPredicted
-            ? m_viewModel.pathSummary(bestPredicted).pathLabel
+            ? m_viewModel->pathSummary(bestPredicted).pathLabel
             : tr("N/A"));
     ++row;
 
@@ -397,7 +461,7 @@ void PathReportGenerator::addExecutiveSummary(
                    tr("Best Simulated Path"), false, true);
     styleTableCell(
         keyTable, row, 1,
-        bestActual ? m_viewModel.pathSummary(bestActual).pathLabel
+        bestActual ? m_viewModel->pathSummary(bestActual).pathLabel
                    : tr("Not simulated"));
     ++row;
 
@@ -439,9 +503,9 @@ void PathReportGenerator::addExecutiveSummary(
         if (!(pathData && pathData->path))
             continue;
 
-        const auto summary = m_viewModel.pathSummary(pathData);
+        const auto summary = m_viewModel->pathSummary(pathData);
         const auto segments =
-            m_viewModel.segmentEntries(pathData);
+            m_viewModel->segmentEntries(pathData);
         const auto predictedMetrics = pathData->predictedMetrics;
         const bool hasActual = pathData->actualMetrics.valid;
 
@@ -602,7 +666,7 @@ void PathReportGenerator::addTableOfContents(
     {
         if (pathData && pathData->path)
         {
-            const auto summary = m_viewModel.pathSummary(pathData);
+            const auto summary = m_viewModel->pathSummary(pathData);
             int     pathId = summary.pathId;
 
             // Create TOC entry with link to the bookmark
@@ -646,6 +710,8 @@ void PathReportGenerator::addIndividualPathSections(
             // Add path details
             addPathDetails(report, pathData);
         }
+        if (!advance())
+            return;
     }
 }
 
@@ -657,7 +723,7 @@ void PathReportGenerator::addPathDetails(
     if (!pathData || !pathData->path)
         return;
 
-    const auto summary = m_viewModel.pathSummary(pathData);
+    const auto summary = m_viewModel->pathSummary(pathData);
     int pathId = summary.pathId;
 
     // Path title
@@ -732,8 +798,8 @@ QImage PathReportGenerator::createPathVisualizationImage(
     if (!pathData || !pathData->path)
         return QImage();
 
-    const auto terminals = m_viewModel.terminalEntries(pathData);
-    const auto segments = m_viewModel.segmentEntries(pathData);
+    const auto terminals = m_viewModel->terminalEntries(pathData);
+    const auto segments = m_viewModel->segmentEntries(pathData);
 
     const int terminalCount = terminals.size();
     const int segmentCount = segments.size();
@@ -883,8 +949,8 @@ void PathReportGenerator::addPathSummary(
     // Path ID
     styleTableCell(table, row, 0, tr("Path ID"), false,
                    true);
-    const auto summary = m_viewModel.pathSummary(pathData);
-    const auto segments = m_viewModel.segmentEntries(pathData);
+    const auto summary = m_viewModel->pathSummary(pathData);
+    const auto segments = m_viewModel->segmentEntries(pathData);
     styleTableCell(
         table, row, 1, QString::number(summary.pathId));
     row++;
@@ -1008,7 +1074,7 @@ void PathReportGenerator::addPathMetricsOverview(
 
     const auto &predicted = pathData->predictedMetrics;
     const auto &actual    = pathData->actualMetrics;
-    const auto segments   = m_viewModel.segmentEntries(pathData);
+    const auto segments   = m_viewModel->segmentEntries(pathData);
     bool   hasPredictedAllocated = false;
     double predictedAllocatedEnergy = 0.0;
     double predictedAllocatedCarbon = 0.0;
@@ -1141,7 +1207,7 @@ void PathReportGenerator::addPathTerminals(
 
     report->addVerticalSpacing(5);
 
-    const auto terminals = m_viewModel.terminalEntries(pathData);
+    const auto terminals = m_viewModel->terminalEntries(pathData);
 
     if (terminals.isEmpty())
     {
@@ -1231,7 +1297,7 @@ void PathReportGenerator::addPathTerminalDetails(
 {
     qCDebug(lcGuiUtil)
         << "PathReportGenerator::addPathTerminalDetails";
-    const auto terminals = m_viewModel.terminalEntries(pathData);
+    const auto terminals = m_viewModel->terminalEntries(pathData);
     if (terminals.isEmpty())
         return;
 
@@ -1449,7 +1515,7 @@ void PathReportGenerator::addPathSegments(
 
     report->addVerticalSpacing(5);
 
-    const auto segments = m_viewModel.segmentEntries(pathData);
+    const auto segments = m_viewModel->segmentEntries(pathData);
 
     if (segments.isEmpty())
     {
@@ -1703,7 +1769,7 @@ void PathReportGenerator::addPathCosts(
 
     // Add data rows
     int rowIndex = 1;
-    const auto summary = m_viewModel.pathSummary(pathData);
+    const auto summary = m_viewModel->pathSummary(pathData);
 
     // Total costs
     styleTableCell(table, rowIndex, 0, tr("Total Cost"),
@@ -1929,7 +1995,7 @@ void PathReportGenerator::addPathCosts(
 
     report->addVerticalSpacing(5);
 
-    const auto segments = m_viewModel.segmentEntries(pathData);
+    const auto segments = m_viewModel->segmentEntries(pathData);
 
     if (segments.isEmpty())
     {
@@ -2636,24 +2702,37 @@ void PathReportGenerator::addComparativeAnalysis(
     // Add each comparison section
     addSummaryComparisonTable(report);
     report->addPageBreak();
+    if (!advance())
+        return;
 
     addTerminalComparisonTable(report);
     report->addPageBreak();
+    if (!advance())
+        return;
 
     addTerminalAttributeComparisonTables(report);
     report->addPageBreak();
+    if (!advance())
+        return;
 
     addSegmentComparisonTable(report);
     report->addPageBreak();
+    if (!advance())
+        return;
 
     addCostComparisonTable(report);
     report->addPageBreak();
+    if (!advance())
+        return;
 
     addSegmentAttributeComparisonTables(report);
     report->addPageBreak();
+    if (!advance())
+        return;
 
     addSegmentCostComparisonTables(report);
     report->addPageBreak();
+    advance();
 }
 
 void PathReportGenerator::addSummaryComparisonTable(
@@ -2677,7 +2756,7 @@ void PathReportGenerator::addSummaryComparisonTable(
     {
         if (path && path->path)
         {
-            headers.append(m_viewModel.pathSummary(path).pathLabel);
+            headers.append(m_viewModel->pathSummary(path).pathLabel);
         }
         else
         {
@@ -2731,7 +2810,7 @@ void PathReportGenerator::addSummaryComparisonTable(
 
             if (path && path->path)
             {
-                const auto summary = m_viewModel.pathSummary(path);
+                const auto summary = m_viewModel->pathSummary(path);
                 switch (row)
                 {
                 case 0: // Path ID
@@ -2755,7 +2834,7 @@ void PathReportGenerator::addSummaryComparisonTable(
                     styleTableCell(
                         table, tableRow, tableCol,
                         modeSequenceFor(
-                            m_viewModel.segmentEntries(path)));
+                            m_viewModel->segmentEntries(path)));
                     break;
                 case 4: // Total terminals
                     styleTableCell(
@@ -2867,7 +2946,7 @@ void PathReportGenerator::addTerminalComparisonTable(
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             headers.append(
                 tr("Path %1").arg(summary.pathId));
         }
@@ -2878,7 +2957,7 @@ void PathReportGenerator::addTerminalComparisonTable(
     }
 
     // Find the maximum number of terminals across all paths
-    const int maxTerminals = m_viewModel.maxTerminals();
+    const int maxTerminals = m_viewModel->maxTerminals();
 
     if (maxTerminals == 0)
     {
@@ -2921,7 +3000,7 @@ void PathReportGenerator::addTerminalComparisonTable(
             if (path && path->path)
             {
                 const auto terminals =
-                    m_viewModel.terminalEntries(path);
+                    m_viewModel->terminalEntries(path);
 
                 if (i < terminals.size())
                 {
@@ -2962,7 +3041,7 @@ void PathReportGenerator::addTerminalAttributeComparisonTables(
     report->addElement(sectionTitle);
     report->addVerticalSpacing(5);
 
-    const int maxTerminals = m_viewModel.maxTerminals();
+    const int maxTerminals = m_viewModel->maxTerminals();
     if (maxTerminals == 0)
     {
         KDReports::TextElement noData(
@@ -3000,11 +3079,11 @@ void PathReportGenerator::addTerminalAttributeComparisonTables(
                 continue;
 
             const auto terminals =
-                m_viewModel.terminalEntries(path);
+                m_viewModel->terminalEntries(path);
             if (terminalIdx >= terminals.size())
                 continue;
 
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             const auto &terminal = terminals[terminalIdx];
             if (!terminalDescText.isEmpty())
                 terminalDescText += tr("\n");
@@ -3057,7 +3136,7 @@ void PathReportGenerator::addTerminalPositionAttributeTable(
     for (const auto *path : m_pathData)
     {
         if (path && path->path)
-            headers.append(m_viewModel.pathSummary(path)
+            headers.append(m_viewModel->pathSummary(path)
                                .pathLabel);
         else
             headers.append(tr("Unknown Path"));
@@ -3110,7 +3189,7 @@ void PathReportGenerator::addTerminalPositionAttributeTable(
             }
 
             const auto terminals =
-                m_viewModel.terminalEntries(path);
+                m_viewModel->terminalEntries(path);
             if (terminalIdx >= terminals.size())
             {
                 styleTableCell(table, tableRow, tableCol,
@@ -3248,7 +3327,7 @@ void PathReportGenerator::addSegmentComparisonTable(
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             headers.append(
                 tr("Path %1").arg(summary.pathId));
         }
@@ -3259,7 +3338,7 @@ void PathReportGenerator::addSegmentComparisonTable(
     }
 
     // Find the maximum number of segments across all paths
-    const int maxSegments = m_viewModel.maxSegments();
+    const int maxSegments = m_viewModel->maxSegments();
 
     if (maxSegments == 0)
     {
@@ -3302,7 +3381,7 @@ void PathReportGenerator::addSegmentComparisonTable(
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
 
                 if (i < segments.size())
                 {
@@ -3354,7 +3433,7 @@ void PathReportGenerator::addCostComparisonTable(
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             headers.append(
                 tr("Path %1").arg(summary.pathId));
         }
@@ -3401,7 +3480,7 @@ void PathReportGenerator::addCostComparisonTable(
             if (path && path->path)
             {
                 const auto summary =
-                    m_viewModel.pathSummary(path);
+                    m_viewModel->pathSummary(path);
                 // Handle different cost categories
                 switch (row)
                 {
@@ -3556,7 +3635,7 @@ void PathReportGenerator::
     report->addVerticalSpacing(5);
 
     // Find the maximum number of segments across all paths
-    const int maxSegments = m_viewModel.maxSegments();
+    const int maxSegments = m_viewModel->maxSegments();
 
     if (maxSegments == 0)
     {
@@ -3591,9 +3670,9 @@ void PathReportGenerator::
             if (path && path->path)
             {
                 const auto summary =
-                    m_viewModel.pathSummary(path);
+                    m_viewModel->pathSummary(path);
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
                 if (segmentIdx < segments.size())
                 {
                     if (!segmentDescText.isEmpty())
@@ -3656,7 +3735,7 @@ void PathReportGenerator::addSegmentPositionAttributeTable(
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             headers.append(
                 tr("Path %1").arg(summary.pathId));
         }
@@ -3716,17 +3795,17 @@ void PathReportGenerator::addSegmentPositionAttributeTable(
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
 
                 if (segmentIdx < segments.size())
                 {
                     const auto values =
-                        m_viewModel.segmentValues(path, segmentIdx);
+                        m_viewModel->segmentValues(path, segmentIdx);
                     const auto predictedCosts =
-                        m_viewModel.segmentPredictedCosts(
+                        m_viewModel->segmentPredictedCosts(
                             path, segmentIdx);
                     const auto actualCosts =
-                        m_viewModel.segmentActualCosts(
+                        m_viewModel->segmentActualCosts(
                             path, segmentIdx);
 
                     QString valueText = tr("N/A");
@@ -3847,7 +3926,7 @@ void PathReportGenerator::addSegmentCostComparisonTables(
     report->addVerticalSpacing(5);
 
     // Find the maximum number of segments across all paths
-    const int maxSegments = m_viewModel.maxSegments();
+    const int maxSegments = m_viewModel->maxSegments();
 
     if (maxSegments == 0)
     {
@@ -3883,9 +3962,9 @@ void PathReportGenerator::addSegmentCostComparisonTables(
             if (path && path->path)
             {
                 const auto summary =
-                    m_viewModel.pathSummary(path);
+                    m_viewModel->pathSummary(path);
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
                 if (segmentIdx < segments.size())
                 {
                     if (!segmentDescText.isEmpty())
@@ -3947,7 +4026,7 @@ void PathReportGenerator::addSegmentPositionCostTable(
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             headers.append(
                 tr("Path %1").arg(summary.pathId));
         }
@@ -4004,15 +4083,15 @@ void PathReportGenerator::addSegmentPositionCostTable(
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
 
                 if (segmentIdx < segments.size())
                 {
                     const auto estimatedCostObj =
-                        m_viewModel.segmentPredictedCosts(
+                        m_viewModel->segmentPredictedCosts(
                             path, segmentIdx);
                     const auto actualCostObj =
-                        m_viewModel.segmentActualCosts(
+                        m_viewModel->segmentActualCosts(
                             path, segmentIdx);
 
                     // Handle different cost categories
@@ -4137,15 +4216,15 @@ void PathReportGenerator::addSegmentPositionCostTable(
         if (path && path->path)
         {
             const auto segments =
-                m_viewModel.segmentEntries(path);
+                m_viewModel->segmentEntries(path);
 
             if (segmentIdx < segments.size())
             {
                 const auto estimatedCostObj =
-                    m_viewModel.segmentPredictedCosts(
+                    m_viewModel->segmentPredictedCosts(
                         path, segmentIdx);
                 const auto actualCostObj =
-                    m_viewModel.segmentActualCosts(
+                    m_viewModel->segmentActualCosts(
                         path, segmentIdx);
                 const double predictedTotal =
                     costSnapshotTotal(estimatedCostObj);
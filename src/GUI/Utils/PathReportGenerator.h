@@ -28,6 +28,9 @@
 #include <QDateTime>
 #include <QFileInfo>
 
+#include <atomic>
+#include <memory>
+
 namespace CargoNetSim
 {
 namespace GUI
@@ -60,6 +63,17 @@ public:
         const QList<const PathData *> &pathData,
         QObject *parent = nullptr);
 
+    /**
+     * @brief Constructor reusing an already precomputed view
+     * model, e.g. one shared with a comparison dialog or a
+     * report job running on a worker thread
+     * @param viewModel Paths and their presentation values
+     * @param parent Parent QObject
+     */
+    explicit PathReportGenerator(
+        std::shared_ptr<const PathComparisonViewModel> viewModel,
+        QObject *parent = nullptr);
+
     /**
      * @brief Destructor
      */
@@ -68,10 +82,27 @@ public:
     /**
      * @brief Generates and saves the PDF report to the
      * specified file
-     * @return Report pointer
+     * @return Report pointer owned by the caller, or nullptr
+     * if the generation was cancelled
      */
     KDReports::Report *generateReport();
 
+    /**
+     * @brief Asks a running generateReport() to stop at the
+     * next section boundary. Safe to call from any thread.
+     */
+    void requestCancel();
+
+    bool isCancelRequested() const;
+
+signals:
+    /**
+     * @brief Emitted after every report section
+     * @param completed Sections finished so far
+     * @param total Sections in the whole report
+     */
+    void progressChanged(int completed, int total);
+
 private:
     // Report sections
     /**
@@ -227,6 +258,14 @@ private:
                                 int segmentIdx);
 
     // Helper methods
+    int totalSteps() const;
+
+    /**
+     * @brief Counts one finished section and reports progress
+     * @return false once a cancel has been requested
+     */
+    bool advance();
+
     /**
      * @brief Creates a transportation mode image for
      * visualization
@@ -261,9 +300,11 @@ private:
                         bool           rowLabel = false);
 
     // Data members
-    const QList<const PathData *>
-         &m_pathData; ///< Path data to include in report
-    PathComparisonViewModel m_viewModel;
+    QList<const PathData *>
+        m_pathData; ///< Path data to include in report
+    std::shared_ptr<const PathComparisonViewModel> m_viewModel;
+    std::atomic<bool> m_cancelRequested{false};
+    int               m_completedSteps = 0;
     QFont m_pageTitleFont;    ///< Font for page titles
     QFont m_sectionTitleFont; ///< Font for section titles
     QFont m_normalTextFont;   ///< Font for normal text
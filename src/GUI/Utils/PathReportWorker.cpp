@@ -0,0 +1,114 @@
+#include "GUI/Utils/PathReportWorker.h"
+
+#include <QThread>
+
+#include "Backend/Commons/LogCategories.h"
+#include "GUI/Utils/PathComparisonViewModel.h"
+#include "GUI/Utils/PathReportGenerator.h"
+
+namespace CargoNetSim
+{
+namespace GUI
+{
+
+PathReportWorker::PathReportWorker()
+    : QObject(nullptr)
+{
+    qCDebug(lcGuiUtil) << "PathReportWorker::PathReportWorker: created";
+}
+
+PathReportWorker::~PathReportWorker() = default;
+
+void PathReportWorker::initialize(
+    std::shared_ptr<PathComparisonViewModel> viewModel,
+    QThread                                 *resultThread)
+{
+    qCDebug(lcGuiUtil) << "PathReportWorker::initialize: paths"
+                       << (viewModel ? viewModel->paths().size() : 0);
+    m_viewModel    = std::move(viewModel);
+    m_resultThread = resultThread;
+}
+
+void PathReportWorker::cancel()
+{
+    m_cancelRequested.store(true);
+    QMutexLocker locker(&m_generatorMutex);
+    if (m_generator)
+        m_generator->requestCancel();
+}
+
+void PathReportWorker::process()
+{
+    if (!m_viewModel || m_viewModel->paths().isEmpty())
+    {
+        qCWarning(lcGuiUtil) << "PathReportWorker::process: no paths";
+        emit error(tr("No path data available for the report."));
+        emit finished();
+        return;
+    }
+
+    if (!m_viewModel->isPrecomputed())
+        m_viewModel->precompute();
+
+    KDReports::Report *report = nullptr;
+    try
+    {
+        PathReportGenerator generator(
+            std::shared_ptr<const PathComparisonViewModel>(
+                m_viewModel));
+        connect(&generator, &PathReportGenerator::progressChanged,
+                this, &PathReportWorker::progressChanged);
+
+        // Publish the generator before re-checking the flag so a
+        // cancel() racing with this point is never lost.
+        {
+            QMutexLocker locker(&m_generatorMutex);
+            m_generator = &generator;
+        }
+        if (m_cancelRequested.load())
+            generator.requestCancel();
+
+        report = generator.generateReport();
+
+        QMutexLocker locker(&m_generatorMutex);
+        m_generator = nullptr;
+    }
+    catch (const std::exception &e)
+    {
+        {
+            QMutexLocker locker(&m_generatorMutex);
+            m_generator = nullptr;
+        }
+        qCWarning(lcGuiUtil) << "PathReportWorker::process: failed -"
+                             << e.what();
+        emit error(QString::fromUtf8(e.what()));
+        emit finished();
+        return;
+    }
+
+    if (!report)
+    {
+        if (m_cancelRequested.load())
+        {
+            qCInfo(lcGuiUtil) << "PathReportWorker::process: cancelled";
+            emit cancelled();
+        }
+        else
+        {
+            qCWarning(lcGuiUtil)
+                << "PathReportWorker::process: generator returned null";
+            emit error(tr("Failed to generate the path report."));
+        }
+        emit finished();
+        return;
+    }
+
+    if (m_resultThread)
+        report->moveToThread(m_resultThread);
+    qCInfo(lcGuiUtil) << "PathReportWorker::process: report ready";
+    emit resultReady(report);
+    emit finished();
+}
+
+} // namespace GUI
+} // namespace CargoNetSim
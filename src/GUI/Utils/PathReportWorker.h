@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QMutex>
+#include <QObject>
+#include <QString>
+
+#include <atomic>
+#include <memory>
+
+class QThread;
+
+namespace KDReports
+{
+class Report;
+} // namespace KDReports
+
+namespace CargoNetSim
+{
+namespace GUI
+{
+
+class PathComparisonViewModel;
+class PathReportGenerator;
+
+/**
+ * @brief Worker-thread wrapper that builds a path report off the
+ *        GUI thread.
+ *
+ * The worker receives an owning view-model snapshot at
+ * initialize-time, precomputes it and runs PathReportGenerator
+ * on the worker thread, forwarding the generator's progress.
+ * cancel() may be called from any thread; the generator stops
+ * at the next section boundary.
+ *
+ * Lifecycle mirrors PathFindingWorker: the consumer calls
+ * `initialize()`, moves the worker to a QThread, connects
+ * signals and starts the thread, which triggers `process()`.
+ * Exactly one of `resultReady()`, `cancelled()` or `error()` is
+ * emitted, followed by `finished()`. The report handed to
+ * `resultReady()` has already been moved to the result thread
+ * and is owned by the receiver.
+ */
+class PathReportWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    PathReportWorker();
+    ~PathReportWorker() override;
+
+    /// Bind the worker to the paths to report on. @p resultThread
+    /// receives ownership of the finished report. Must be called
+    /// before `process()`.
+    void initialize(
+        std::shared_ptr<PathComparisonViewModel> viewModel,
+        QThread                                 *resultThread);
+
+    /// Request cancellation; thread-safe.
+    void cancel();
+
+public slots:
+    /// Entry point on the worker thread.
+    void process();
+
+signals:
+    void progressChanged(int completed, int total);
+    void resultReady(KDReports::Report *report);
+    void cancelled();
+    void error(const QString &message);
+    void finished();
+
+private:
+    std::shared_ptr<PathComparisonViewModel> m_viewModel;
+    QThread                                 *m_resultThread = nullptr;
+    std::atomic<bool>                        m_cancelRequested{false};
+    QMutex                                   m_generatorMutex;
+    PathReportGenerator                     *m_generator = nullptr;
+};
+
+} // namespace GUI
+} // namespace CargoNetSim
@@ -5,8 +5,11 @@
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsSceneWheelEvent>
 #include <QKeyEvent>
+#include <QPointer>
 
 #include "Backend/Commons/LogCategories.h"
+#include "GUI/Items/MapLine.h"
+#include "GUI/Items/MapPoint.h"
 
 #include "../Input/Handled.h"
 #include "../Input/InputEvent.h"
@@ -31,50 +34,219 @@ GraphicsScene::~GraphicsScene()
     clearAll();
 }
 
+const GraphicsScene::TypeBucket &GraphicsScene::emptyBucket()
+{
+    static const TypeBucket empty;
+    return empty;
+}
+
 void GraphicsScene::addItemWithId(GraphicsObjectBase *item,
                                   const QString      &id)
 {
     qCDebug(lcGuiScene) << "GraphicsScene::addItemWithId:"
-                        << "id=" << id
-                        << "type=" << typeid(*item).name();
+                        << "id=" << id << "type=" << item->type();
+    registerItem(item, id);
+}
+
+void GraphicsScene::addItemsWithIds(
+    const QList<QPair<GraphicsObjectBase *, QString>> &items)
+{
+    if (items.isEmpty())
+        return;
+    qCDebug(lcGuiScene) << "GraphicsScene::addItemsWithIds:"
+                        << "count=" << items.size();
+    // Batches are almost always one type (a network's links, its
+    // nodes), so reserve for the first item's bucket up front.
+    TypeBucket &first = m_itemsByType[items.first().first->type()];
+    first.reserve(first.size() + items.size());
+
+    beginBulkUpdate();
+    for (const auto &entry : items)
+        registerItem(entry.first, entry.second);
+    endBulkUpdate();
+}
+
+void GraphicsScene::registerItem(GraphicsObjectBase *item,
+                                 const QString      &id)
+{
     QGraphicsScene::addItem(item);
 
-    const QString className = QString(typeid(*item).name());
-    itemsByType[className][id] = item;
+    const int type = item->type();
+    m_itemsByType[type].insert(id, item);
+
+    if (!m_networkLayer
+        && (type == MapLine::Type || type == MapPoint::Type))
+    {
+        m_networkLayer = new NetworkLayerItem(this);
+        QGraphicsScene::addItem(m_networkLayer);
+    }
+    invalidateNetworkLayer(type);
 
     // Self-healing registry invariant. Without this, any code path that
     // destroys the item without calling removeItemWithId (raw `delete`,
     // parent destruction, QGraphicsScene::clear(), re-entrant teardown)
-    // leaves a dangling pointer in itemsByType. Later observers — which
+    // leaves a dangling pointer in m_itemsByType. Later observers — which
     // lookup by (type, id) and then dereference — would crash on stale
     // pointers. Connecting destroyed() makes the registry self-pruning:
     // no matter who or how an item is deleted, its entry is erased
     // synchronously during ~QObject, before anyone can observe the
-    // dangling state. className/id captured by value so the lambda
-    // remains valid past `item`'s destruction. Qt::DirectConnection
-    // (implicit — same thread) ensures synchronous execution.
+    // dangling state. type/id captured by value so the lambda remains
+    // valid past `item`'s destruction; the pointer is only compared, so
+    // an id since re-registered to another item is left alone.
+    // Qt::DirectConnection (implicit — same thread) ensures synchronous
+    // execution.
     connect(item, &QObject::destroyed, this,
-            [this, className, id](QObject *) {
-                auto bucket = itemsByType.find(className);
-                if (bucket == itemsByType.end())
+            [this, type, id, item](QObject *) {
+                auto bucket = m_itemsByType.find(type);
+                if (bucket == m_itemsByType.end())
+                    return;
+                auto entry = bucket->find(id);
+                if (entry == bucket->end() || entry.value() != item)
                     return;
-                bucket->remove(id);
+                bucket->erase(entry);
                 if (bucket->isEmpty())
-                    itemsByType.erase(bucket);
+                    m_itemsByType.erase(bucket);
+                invalidateNetworkLayer(type);
             });
 }
 
+int GraphicsScene::removeRegisteredItems(int type, const QStringList &ids)
+{
+    auto bucket = m_itemsByType.find(type);
+    if (bucket == m_itemsByType.end())
+        return 0;
+
+    // Prune the registry FIRST so the destroyed() auto-prune wired in
+    // registerItem finds nothing to do during the items' teardown.
+    // QPointer: one doomed item may own another as a child, in which
+    // case deleting the parent already deleted the child.
+    QList<QPointer<GraphicsObjectBase>> doomed;
+    doomed.reserve(ids.size());
+    for (const QString &id : ids)
+    {
+        auto entry = bucket->find(id);
+        if (entry == bucket->end())
+            continue;
+        doomed.append(entry.value());
+        bucket->erase(entry);
+    }
+    if (bucket->isEmpty())
+        m_itemsByType.erase(bucket);
+    if (doomed.isEmpty())
+        return 0;
+    invalidateNetworkLayer(type);
+
+    for (const auto &item : doomed)
+    {
+        if (!item)
+            continue;
+        // Disconnect outgoing signals so half-destroyed controllers
+        // can't receive callbacks mid-teardown.
+        QObject::disconnect(item.data());
+        QGraphicsScene::removeItem(item.data());
+        delete item.data();
+    }
+    return doomed.size();
+}
+
+void GraphicsScene::invalidateNetworkLayer(int type)
+{
+    if (!m_networkLayer
+        || (type != MapLine::Type && type != MapPoint::Type))
+        return;
+    if (m_bulkDepth > 0)
+        m_pendingNetworkIndex = true;
+    else
+        m_networkLayer->invalidate();
+}
+
+void GraphicsScene::beginBulkUpdate()
+{
+    ++m_bulkDepth;
+}
+
+void GraphicsScene::endBulkUpdate()
+{
+    if (--m_bulkDepth > 0)
+        return;
+    if (m_networkLayer)
+    {
+        if (m_pendingNetworkIndex)
+            m_networkLayer->invalidate();
+        else if (m_pendingNetworkStyle)
+            m_networkLayer->invalidateStyle();
+    }
+    m_pendingNetworkIndex = false;
+    m_pendingNetworkStyle = false;
+}
+
+void GraphicsScene::networkItemChanged(QGraphicsItem *item, bool geometry)
+{
+    if (!m_networkLayer || !item
+        || (item->type() != MapLine::Type
+            && item->type() != MapPoint::Type))
+        return;
+    if (m_bulkDepth > 0)
+    {
+        (geometry ? m_pendingNetworkIndex : m_pendingNetworkStyle) = true;
+        return;
+    }
+    if (geometry)
+        m_networkLayer->invalidate();
+    else
+        m_networkLayer->invalidateStyle();
+}
+
+void GraphicsScene::updateNetworkDetail(const QRectF &visibleRect,
+                                        qreal         pixelsPerUnit)
+{
+    if (m_networkLayer)
+        m_networkLayer->updateDetail(visibleRect, pixelsPerUnit);
+}
+
 void GraphicsScene::clearAll()
 {
     qCInfo(lcGuiScene) << "GraphicsScene::clearAll:"
-                       << "typeCount=" << itemsByType.size()
+                       << "typeCount=" << m_itemsByType.size()
                        << "sceneItemCount=" << items().size();
     // Drop registry references FIRST so the subsequent delete in
     // QGraphicsScene::clear() cannot leave us with dangling pointers.
-    itemsByType.clear();
+    m_itemsByType.clear();
     QGraphicsScene::clear();
 }
 
+void GraphicsScene::removeItemsNotOfType(const QSet<int> &keepTypes)
+{
+    // QPointer: a doomed item may own another doomed item as a child, in
+    // which case deleting the parent already deleted the child.
+    QList<QPointer<GraphicsObjectBase>> doomed;
+    for (auto bucket = m_itemsByType.begin();
+         bucket != m_itemsByType.end();)
+    {
+        if (keepTypes.contains(bucket.key()))
+        {
+            ++bucket;
+            continue;
+        }
+        doomed.reserve(doomed.size() + bucket->size());
+        for (GraphicsObjectBase *item : std::as_const(*bucket))
+            doomed.append(item);
+        invalidateNetworkLayer(bucket.key());
+        bucket = m_itemsByType.erase(bucket);
+    }
+    qCInfo(lcGuiScene) << "GraphicsScene::removeItemsNotOfType:"
+                       << "removed=" << doomed.size();
+    // Registry entries are gone, so the destroyed() auto-prune no-ops.
+    for (const auto &item : doomed)
+    {
+        if (!item)
+            continue;
+        QObject::disconnect(item.data());
+        QGraphicsScene::removeItem(item.data());
+        delete item.data();
+    }
+}
+
 void GraphicsScene::mousePressEvent(
     QGraphicsSceneMouseEvent *event)
 {
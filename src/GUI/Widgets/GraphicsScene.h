@@ -1,10 +1,20 @@
 #pragma once
 
 #include "GUI/Items/GraphicsObjectBase.h"
+#include "GUI/Items/NetworkLayerItem.h"
 #include <QGraphicsScene>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QPair>
 #include <QPointF>
+#include <QPointer>
+#include <QSet>
+#include <QStringList>
 #include <QVariant>
 
+#include <iterator>
+
 namespace CargoNetSim
 {
 namespace GUI
@@ -34,96 +44,190 @@ public:
     explicit GraphicsScene(QObject *parent = nullptr);
     ~GraphicsScene() override;
 
+    /// Registered items of one graphics-item type, keyed by id.
+    using TypeBucket = QHash<QString, GraphicsObjectBase *>;
+
+    /**
+     * @brief Non-allocating range over the registered items of type
+     *        @p T, iterated in place in the registry's bucket.
+     *
+     * Dereferencing yields `T *`; `it.key()` is the registry id. Like
+     * any QHash iteration, a view is invalidated by adding or removing
+     * items of type T while it is in use; loops that do either should
+     * snapshot with getItemsByType / getItemsByTypeWithIds instead.
+     */
+    template <typename T> class ItemsView
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T *;
+            using difference_type   = qptrdiff;
+            using pointer           = T **;
+            using reference         = T *;
+
+            explicit const_iterator(TypeBucket::const_iterator it)
+                : m_it(it)
+            {
+            }
+            T *operator*() const
+            {
+                return static_cast<T *>(m_it.value());
+            }
+            const QString &key() const { return m_it.key(); }
+            const_iterator &operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+            bool operator==(const const_iterator &other) const
+            {
+                return m_it == other.m_it;
+            }
+            bool operator!=(const const_iterator &other) const
+            {
+                return m_it != other.m_it;
+            }
+
+        private:
+            TypeBucket::const_iterator m_it;
+        };
+
+        explicit ItemsView(const TypeBucket &bucket)
+            : m_bucket(bucket)
+        {
+        }
+        const_iterator begin() const
+        {
+            return const_iterator(m_bucket.constBegin());
+        }
+        const_iterator end() const
+        {
+            return const_iterator(m_bucket.constEnd());
+        }
+        qsizetype size() const { return m_bucket.size(); }
+        bool      isEmpty() const { return m_bucket.isEmpty(); }
+
+    private:
+        const TypeBucket &m_bucket;
+    };
+
+    /**
+     * @brief Add @p item to the scene and register it under its
+     *        graphics-item type (`item->type()`, i.e. T::Type) and @p id.
+     */
     void addItemWithId(GraphicsObjectBase *item,
                        const QString      &id);
 
     /**
-     * @brief Remove every tracked item: clears the `itemsByType` registry
-     *        then delegates to QGraphicsScene::clear() which deletes the
+     * @brief addItemWithId for many items at once: one bucket reserve
+     *        and one network-layer re-index instead of one per item.
+     */
+    void addItemsWithIds(
+        const QList<QPair<GraphicsObjectBase *, QString>> &items);
+
+    /**
+     * @brief Remove every tracked item: clears the registry then
+     *        delegates to QGraphicsScene::clear() which deletes the
      *        items themselves. Use this (not QGraphicsScene::clear()) on
      *        teardown, otherwise the type-indexed registry retains
      *        dangling pointers. Consumed by GUI::Scenario::SceneRepopulator.
      */
     void clearAll();
 
-    // Get item by type and ID
-    template <typename T> T *getItemById(const QString &id)
+    /// Registered item of type @p T with @p id, or nullptr. One hash
+    /// lookup per level; no allocation.
+    template <typename T> T *getItemById(const QString &id) const
     {
-        // Get the class key
-        QString className = QString(typeid(T).name());
+        const TypeBucket *bucket = bucketFor(T::Type);
+        return bucket ? static_cast<T *>(bucket->value(id, nullptr))
+                      : nullptr;
+    }
 
-        // Check if this type and ID exist
-        if (itemsByType.contains(className)
-            && itemsByType[className].contains(id))
-        {
-            // Return the item if it's of the correct type
-            return qgraphicsitem_cast<T *>(
-                itemsByType[className][id]);
-        }
-        return nullptr;
+    /// In-place view over the registered items of type @p T.
+    template <typename T> ItemsView<T> itemsOfType() const
+    {
+        const TypeBucket *bucket = bucketFor(T::Type);
+        return ItemsView<T>(bucket ? *bucket : emptyBucket());
     }
 
-    // Get all items of a specific type
-    template <typename T> QList<T *> getItemsByType()
+    template <typename T> qsizetype countOfType() const
+    {
+        const TypeBucket *bucket = bucketFor(T::Type);
+        return bucket ? bucket->size() : 0;
+    }
+
+    /// Snapshot of the registered items of type @p T, for loops that
+    /// add or remove items while iterating. Prefer itemsOfType<T>().
+    template <typename T> QList<T *> getItemsByType() const
     {
         QList<T *> result;
-        QString    className = QString(typeid(T).name());
+        const ItemsView<T> view = itemsOfType<T>();
+        result.reserve(view.size());
+        for (T *item : view)
+            result.append(item);
+        return result;
+    }
 
-        // Check if this type exists
-        if (itemsByType.contains(className))
-        {
-            // Iterate through all items of this type and
-            // them to result
-            for (auto item :
-                 itemsByType[className].values())
-            {
-                // Check if the item is of the correct type
-                T *typedItem =
-                    qgraphicsitem_cast<T *>(item);
-                if (typedItem)
-                {
-                    // Append to the result list
-                    result.append(typedItem);
-                }
-            }
-        }
+    /// Like getItemsByType, keyed by the id each item was registered
+    /// under. Reading the key from the registry instead of the item means
+    /// callers never dereference an item's (possibly stale) model binding
+    /// just to learn its id.
+    template <typename T> QMap<QString, T *> getItemsByTypeWithIds() const
+    {
+        QMap<QString, T *> result;
+        const ItemsView<T> view = itemsOfType<T>();
+        for (auto it = view.begin(); it != view.end(); ++it)
+            result.insert(it.key(), *it);
         return result;
     }
 
-    // Handle item removal
+    /**
+     * @brief Remove every tracked item whose graphics-item type is not
+     *        in @p keepTypes (T::Type values). Untracked items are left
+     *        alone. Used by SceneRepopulator to drop items a
+     *        ScenarioDocument does not describe without clearing the
+     *        items it reconciles.
+     */
+    void removeItemsNotOfType(const QSet<int> &keepTypes);
+
+    /// Unregister, remove from the scene and delete the item of type
+    /// @p T registered under @p id. Returns false when there is none.
+    template <typename T> bool removeItemWithId(const QString &id)
+    {
+        return removeRegisteredItems(T::Type, QStringList{id}) == 1;
+    }
+
+    /// removeItemWithId for many ids of one type; unknown ids are
+    /// skipped. Returns the number of items removed.
     template <typename T>
-    bool removeItemWithId(const QString &id)
+    int removeItemsWithIds(const QStringList &ids)
     {
-        QString className = QString(typeid(T).name());
+        return removeRegisteredItems(T::Type, ids);
+    }
 
-        // Check if this type and ID exist
-        if (!itemsByType.contains(className)
-            || !itemsByType[className].contains(id))
+    /**
+     * @brief Set the visibility of every registered @p T for which
+     *        @p pred(T *) is true. Network-layer notifications are
+     *        coalesced into one. Returns the number of items changed.
+     */
+    template <typename T, typename Pred>
+    int setItemsVisible(bool visible, Pred pred)
+    {
+        beginBulkUpdate();
+        int changed = 0;
+        for (T *item : itemsOfType<T>())
         {
-            return false;
+            if (item->isVisible() != visible && pred(item))
+            {
+                item->setVisible(visible);
+                ++changed;
+            }
         }
-
-        // Every registered item is a GraphicsObjectBase (enforced by
-        // addItemWithId's signature), which is a QObject. No dynamic_cast
-        // needed — the registry invariant guarantees the conversion.
-        QGraphicsItem *item = itemsByType[className][id];
-
-        // Prune the registry FIRST. The destroyed() auto-prune wired in
-        // addItemWithId provides defense against callers that bypass this
-        // path; removing here up front means that auto-prune sees an
-        // empty bucket and no-ops, avoiding redundant work during the
-        // object's teardown.
-        itemsByType[className].remove(id);
-        if (itemsByType[className].isEmpty())
-            itemsByType.remove(className);
-
-        // Disconnect outgoing signals so half-destroyed controllers can't
-        // receive callbacks mid-teardown.
-        QObject::disconnect(static_cast<GraphicsObjectBase *>(item));
-
-        QGraphicsScene::removeItem(item);
-        delete item;
-        return true;
+        endBulkUpdate();
+        return changed;
     }
 
     void setInputController(Input::InteractionController* ctrl)
@@ -136,6 +240,31 @@ public:
         return m_inputController;
     }
 
+    /**
+     * @brief The layer that draws every MapLine / MapPoint in
+     *        batches (see NetworkLayerItem), or nullptr while no
+     *        network item has been added.
+     */
+    NetworkLayerItem *networkLayer() const
+    {
+        return m_networkLayer;
+    }
+
+    /**
+     * @brief Tell the network layer that @p item changed. Geometry
+     *        changes (points moved, terminal linked) re-index; others
+     *        (colour, selection, visibility) only re-batch. No-op for
+     *        items that are not MapLine / MapPoint.
+     */
+    void networkItemChanged(QGraphicsItem *item, bool geometry);
+
+    /**
+     * @brief Called by the view whenever its visible scene rect or
+     *        scale changes; see NetworkLayerItem::updateDetail.
+     */
+    void updateNetworkDetail(const QRectF &visibleRect,
+                             qreal         pixelsPerUnit);
+
 protected:
     void mousePressEvent(
         QGraphicsSceneMouseEvent *event) override;
@@ -172,12 +301,37 @@ protected:
         QGraphicsSceneDragDropEvent *event) override;
 
 private:
-    // Nested map structure: outer key is class name, inner
-    // key is item ID
-    QMap<QString, QMap<QString, QGraphicsItem *>>
-        itemsByType;
+    const TypeBucket *bucketFor(int type) const
+    {
+        auto bucket = m_itemsByType.constFind(type);
+        return bucket == m_itemsByType.constEnd() ? nullptr : &*bucket;
+    }
+    static const TypeBucket &emptyBucket();
+
+    /// Shared body of addItemWithId / addItemsWithIds.
+    void registerItem(GraphicsObjectBase *item, const QString &id);
+    int  removeRegisteredItems(int type, const QStringList &ids);
+
+    /// Re-index the network layer if @p type is MapLine / MapPoint.
+    void invalidateNetworkLayer(int type);
+
+    /// Between these, network-layer notifications are only recorded
+    /// and then delivered once. Calls nest.
+    void beginBulkUpdate();
+    void endBulkUpdate();
+
+    /// Outer key is the graphics-item type (T::Type), inner key the
+    /// registry id.
+    QHash<int, TypeBucket> m_itemsByType;
+
+    int  m_bulkDepth            = 0;
+    bool m_pendingNetworkIndex  = false;
+    bool m_pendingNetworkStyle  = false;
 
     Input::InteractionController *m_inputController = nullptr;
+
+    /// Created with the first network item; deleted by clear().
+    QPointer<NetworkLayerItem> m_networkLayer;
 };
 
 } // namespace GUI
@@ -83,6 +83,23 @@ GraphicsView::GraphicsView(QGraphicsScene *scene,
     horizontalScrollBar()->setRange(-100000000, 100000000);
     verticalScrollBar()->setRange(-100000000, 100000000);
 
+    // Coalesce the per-step viewport changes of a pan or zoom
+    // gesture into one level-of-detail pass over the networks
+    _networkDetailTimer.setSingleShot(true);
+    _networkDetailTimer.setInterval(30);
+    connect(&_networkDetailTimer, &QTimer::timeout, this,
+            [this]() {
+                GraphicsScene *graphicsScene = getScene();
+                if (!graphicsScene)
+                {
+                    return;
+                }
+                graphicsScene->updateNetworkDetail(
+                    mapToScene(viewport()->rect())
+                        .boundingRect(),
+                    transform().m11());
+            });
+
     // Update scrollbar ranges based on initial zoom
     updateScrollBarRanges();
 }
@@ -881,6 +898,18 @@ void GraphicsView::leaveEvent(QEvent *event)
 void GraphicsView::resizeEvent(QResizeEvent *event)
 {
     QGraphicsView::resizeEvent(event);
+    scheduleNetworkDetailUpdate();
+}
+
+void GraphicsView::scrollContentsBy(int dx, int dy)
+{
+    QGraphicsView::scrollContentsBy(dx, dy);
+    scheduleNetworkDetailUpdate();
+}
+
+void GraphicsView::scheduleNetworkDetailUpdate()
+{
+    _networkDetailTimer.start();
 }
 
 bool GraphicsView::eventFilter(QObject *obj, QEvent *event)
@@ -1034,6 +1063,9 @@ void GraphicsView::updateScrollBarRanges()
                                         adjustedRange);
         verticalScrollBar()->setRange(-adjustedRange,
                                       adjustedRange);
+
+        // Every zoom path ends here
+        scheduleNetworkDetailUpdate();
     }
     catch (const std::exception &e)
     {
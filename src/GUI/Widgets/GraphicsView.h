@@ -191,6 +191,11 @@ protected:
      */
     void resizeEvent(QResizeEvent *event) override;
 
+    /**
+     * @brief Handle scrolling (panning) of the viewport
+     */
+    void scrollContentsBy(int dx, int dy) override;
+
     /**
      * @brief Filter events
      * @param obj Object receiving the event
@@ -315,6 +320,14 @@ private:
     bool useProjectedCoords;
 
     Input::InteractionController *m_inputController = nullptr;
+
+    /**
+     * @brief Re-split detailed and batched network items (see
+     * NetworkLayerItem) once panning / zooming pauses
+     */
+    void scheduleNetworkDetailUpdate();
+
+    QTimer _networkDetailTimer;
 };
 
 } // namespace GUI
@@ -34,8 +34,7 @@ PathComparisonDialog::PathComparisonDialog(
     const QList<const PathData *> &pathData,
     QWidget *parent)
     : QDialog(parent)
-    , m_pathData(pathData)
-    , m_viewModel(pathData)
+    , m_viewModel(PathComparisonViewModel::snapshot(pathData))
     , m_tabWidget(nullptr)
     , m_exportButton(nullptr)
 {
@@ -47,6 +46,12 @@ PathComparisonDialog::PathComparisonDialog(
                        : tr("Path Details"));
     setMinimumSize(800, 600);
 
+    // Every tab and the CSV export read the same aggregates, so
+    // derive them once. Lookups are keyed by the snapshot's own
+    // records, hence m_pathData comes from the view model.
+    m_viewModel->precompute();
+    m_pathData = m_viewModel->paths();
+
     // Initialize the UI
     initUI();
 }
@@ -66,13 +71,22 @@ void PathComparisonDialog::initUI()
     // Create tab widget for organizing comparison views
     m_tabWidget = new QTabWidget(this);
 
-    // Add tabs for different comparison aspects
-    m_tabWidget->addTab(createSummaryTab(), tr("Summary"));
-    m_tabWidget->addTab(createTerminalsTab(),
-                        tr("Terminals"));
-    m_tabWidget->addTab(createSegmentsTab(),
-                        tr("Segments"));
-    m_tabWidget->addTab(createCostsTab(), tr("Costs"));
+    // Add tabs for different comparison aspects. Each tab is an
+    // empty page until it is first shown; only the summary is
+    // built up front.
+    const QStringList tabTitles = {tr("Summary"), tr("Terminals"),
+                                   tr("Segments"), tr("Costs")};
+    for (const QString &title : tabTitles)
+    {
+        auto *page = new QWidget(m_tabWidget);
+        auto *pageLayout = new QVBoxLayout(page);
+        pageLayout->setContentsMargins(0, 0, 0, 0);
+        m_tabWidget->addTab(page, title);
+    }
+    m_builtTabs.fill(false, tabTitles.size());
+    ensureTabBuilt(SummaryTab);
+    connect(m_tabWidget, &QTabWidget::currentChanged, this,
+            &PathComparisonDialog::ensureTabBuilt);
 
     mainLayout->addWidget(m_tabWidget);
 
@@ -99,6 +113,38 @@ void PathComparisonDialog::initUI()
     mainLayout->addLayout(buttonLayout);
 }
 
+void PathComparisonDialog::ensureTabBuilt(int index)
+{
+    if (index < 0 || index >= m_builtTabs.size()
+        || m_builtTabs.at(index))
+    {
+        return;
+    }
+    m_builtTabs[index] = true;
+
+    qCDebug(lcGuiPathTable) << "PathComparisonDialog::ensureTabBuilt:"
+                            << "index=" << index;
+    QWidget *content = nullptr;
+    switch (index)
+    {
+    case SummaryTab:
+        content = createSummaryTab();
+        break;
+    case TerminalsTab:
+        content = createTerminalsTab();
+        break;
+    case SegmentsTab:
+        content = createSegmentsTab();
+        break;
+    case CostsTab:
+        content = createCostsTab();
+        break;
+    default:
+        return;
+    }
+    m_tabWidget->widget(index)->layout()->addWidget(content);
+}
+
 QWidget *PathComparisonDialog::createSummaryTab()
 {
     qCDebug(lcGuiPathTable) << "PathComparisonDialog::createSummaryTab:"
@@ -125,7 +171,7 @@ QWidget *PathComparisonDialog::createSummaryTab()
     {
         if (path && path->path)
         {
-            headers << m_viewModel.pathSummary(path).pathLabel;
+            headers << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -148,7 +194,7 @@ QWidget *PathComparisonDialog::createSummaryTab()
 
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
 
             // Path ID
             pathData << QString::number(summary.pathId);
@@ -287,7 +333,7 @@ QWidget *PathComparisonDialog::createTerminalsTab()
     {
         if (path && path->path)
         {
-            headers << m_viewModel.pathSummary(path).pathLabel;
+            headers << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -295,7 +341,7 @@ QWidget *PathComparisonDialog::createTerminalsTab()
         }
     }
 
-    const int maxTerminals = m_viewModel.maxTerminals();
+    const int maxTerminals = m_viewModel->maxTerminals();
 
     QStringList rowLabels;
     for (int i = 0; i < maxTerminals; ++i)
@@ -311,7 +357,7 @@ QWidget *PathComparisonDialog::createTerminalsTab()
         if (path && path->path)
         {
             const auto terminals =
-                m_viewModel.terminalEntries(path);
+                m_viewModel->terminalEntries(path);
 
             // Add terminal information
             for (int i = 0; i < maxTerminals; ++i)
@@ -388,7 +434,7 @@ QWidget *PathComparisonDialog::createTerminalsTab()
                 continue;
 
             const auto terminals =
-                m_viewModel.terminalEntries(path);
+                m_viewModel->terminalEntries(path);
             if (terminalIdx >= terminals.size())
                 continue;
 
@@ -404,7 +450,7 @@ QWidget *PathComparisonDialog::createTerminalsTab()
 
             terminalInfoText +=
                 QStringLiteral("<p><b>%1:</b> %2%3</p>")
-                    .arg(m_viewModel.pathLabel(path),
+                    .arg(m_viewModel->pathLabel(path),
                          terminal.displayName.toHtmlEscaped(),
                          predictedNote);
         }
@@ -441,7 +487,7 @@ QWidget *PathComparisonDialog::createTerminalsTab()
         {
             QStringList pathAttributeData;
             const auto terminals =
-                path ? m_viewModel.terminalEntries(path)
+                path ? m_viewModel->terminalEntries(path)
                      : QList<PathComparisonViewModel::TerminalEntry>{};
             if (path && terminalIdx < terminals.size())
             {
@@ -638,7 +684,7 @@ QWidget *PathComparisonDialog::createSegmentsTab()
     {
         if (path && path->path)
         {
-            headers << m_viewModel.pathSummary(path).pathLabel;
+            headers << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -647,7 +693,7 @@ QWidget *PathComparisonDialog::createSegmentsTab()
     }
 
     // Find the maximum number of segments across all paths
-    const int maxSegments = m_viewModel.maxSegments();
+    const int maxSegments = m_viewModel->maxSegments();
 
     // Create tab container for segments with attributes
     auto segmentTabWidget = new QTabWidget(this);
@@ -672,7 +718,7 @@ QWidget *PathComparisonDialog::createSegmentsTab()
         if (path && path->path)
         {
             const auto segments =
-                m_viewModel.segmentEntries(path);
+                m_viewModel->segmentEntries(path);
 
             // Add segment information
             for (int i = 0; i < maxSegments; ++i)
@@ -756,14 +802,14 @@ QWidget *PathComparisonDialog::createSegmentsTab()
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
                 if (segmentIdx < segments.size())
                 {
                     const auto &segment = segments[segmentIdx];
                     QString segmentInfo =
                         QString("<p><b>Path %1:</b> %2 → "
                                 "%3 (%4)</p>")
-                            .arg(m_viewModel.pathSummary(path).pathId)
+                            .arg(m_viewModel->pathSummary(path).pathId)
                             .arg(segment.startTerminalName)
                             .arg(segment.endTerminalName)
                             .arg(segment.modeName);
@@ -811,7 +857,7 @@ QWidget *PathComparisonDialog::createSegmentsTab()
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
 
                 if (segmentIdx < segments.size())
                 {
@@ -1035,7 +1081,7 @@ QWidget *PathComparisonDialog::createCostsTab()
     {
         if (path && path->path)
         {
-            headers << m_viewModel.pathSummary(path).pathLabel;
+            headers << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -1064,7 +1110,7 @@ QWidget *PathComparisonDialog::createCostsTab()
 
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             // Add predicted costs
             costData << QString::number(
                 summary.predictedTotalCost, 'f', 2);
@@ -1209,7 +1255,7 @@ QWidget *PathComparisonDialog::createCostsTab()
 
         if (path && path->path)
         {
-            const auto totals = m_viewModel.pathCostTotals(path);
+            const auto totals = m_viewModel->pathCostTotals(path);
             const auto &predicted = totals.predicted;
             const auto &actual = totals.actual;
             const bool hasPredictedData = predicted.available;
@@ -1325,7 +1371,7 @@ QWidget *PathComparisonDialog::createCostsTab()
 
     // --- Create segment-level cost breakdown tabs ---
     // Find the maximum number of segments across all paths
-    const int maxSegments = m_viewModel.maxSegments();
+    const int maxSegments = m_viewModel->maxSegments();
 
     // Create a tab for each segment
     for (int segmentIdx = 0; segmentIdx < maxSegments;
@@ -1352,9 +1398,9 @@ QWidget *PathComparisonDialog::createCostsTab()
             if (path && path->path)
             {
                 const auto summary =
-                    m_viewModel.pathSummary(path);
+                    m_viewModel->pathSummary(path);
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
                 if (segmentIdx < segments.size())
                 {
                     QString segmentInfo =
@@ -1404,15 +1450,15 @@ QWidget *PathComparisonDialog::createCostsTab()
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
 
                 if (segmentIdx < segments.size())
                 {
                     const auto estimatedCostObj =
-                        m_viewModel.segmentPredictedCosts(
+                        m_viewModel->segmentPredictedCosts(
                             path, segmentIdx);
                     const auto actualCostObj =
-                        m_viewModel.segmentActualCosts(
+                        m_viewModel->segmentActualCosts(
                             path, segmentIdx);
 
                     // Carbon Emissions Cost
@@ -1719,11 +1765,11 @@ void PathComparisonDialog::createPathVisualization(
 
         if (pathData && pathData->path)
         {
-            const auto summary = m_viewModel.pathSummary(pathData);
+            const auto summary = m_viewModel->pathSummary(pathData);
             const auto terminals =
-                m_viewModel.terminalEntries(pathData);
+                m_viewModel->terminalEntries(pathData);
             const auto segments =
-                m_viewModel.segmentEntries(pathData);
+                m_viewModel->segmentEntries(pathData);
             // Create a container for this path
             auto pathContainer = new QWidget(container);
             auto pathLayout =
@@ -1992,7 +2038,7 @@ void PathComparisonDialog::onExportButtonClicked()
                     continue;
 
                 const auto totals =
-                    m_viewModel.pathCostTotals(path);
+                    m_viewModel->pathCostTotals(path);
                 out << ","
                     << QString::number(
                            valueAccessor(totals.predicted),
@@ -2030,7 +2076,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).pathLabel;
+            out << "," << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -2046,7 +2092,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).pathId;
+            out << "," << m_viewModel->pathSummary(path).pathId;
         }
         else
         {
@@ -2061,7 +2107,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).terminalCount;
+            out << "," << m_viewModel->pathSummary(path).terminalCount;
         }
         else
         {
@@ -2076,7 +2122,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).segmentCount;
+            out << "," << m_viewModel->pathSummary(path).segmentCount;
         }
         else
         {
@@ -2093,7 +2139,7 @@ void PathComparisonDialog::onExportButtonClicked()
         {
             out << ","
                 << QString::number(
-                       m_viewModel.pathSummary(path)
+                       m_viewModel->pathSummary(path)
                            .predictedTotalCost,
                        'f', 2);
         }
@@ -2129,7 +2175,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << ","
                 << (summary.startTerminalName.isEmpty()
                         ? tr("Unknown")
@@ -2148,7 +2194,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << ","
                 << (summary.endTerminalName.isEmpty()
                         ? tr("Unknown")
@@ -2167,16 +2213,16 @@ void PathComparisonDialog::onExportButtonClicked()
     out << "================\n\n";
 
     // Find the maximum number of terminals across all paths
-    const int maxTerminals = m_viewModel.maxTerminals();
+    const int maxTerminals = m_viewModel->maxTerminals();
 
     // For each path, list all terminal details
     for (const auto &path : m_pathData)
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             const auto terminals =
-                m_viewModel.terminalEntries(path);
+                m_viewModel->terminalEntries(path);
             out << "Path " << summary.pathId << " Terminals:\n";
             out << "Index,Terminal Name,Terminal ID\n";
 
@@ -2201,7 +2247,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).pathLabel;
+            out << "," << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -2221,7 +2267,7 @@ void PathComparisonDialog::onExportButtonClicked()
             if (path && path->path)
             {
                 const auto terminals =
-                    m_viewModel.terminalEntries(path);
+                    m_viewModel->terminalEntries(path);
                 if (i < terminals.size())
                 {
                     out << ","
@@ -2249,16 +2295,16 @@ void PathComparisonDialog::onExportButtonClicked()
     out << "===============\n\n";
 
     // Find the maximum number of segments across all paths
-    const int maxSegments = m_viewModel.maxSegments();
+    const int maxSegments = m_viewModel->maxSegments();
 
     // For each path, list detailed segment information
     for (const auto &path : m_pathData)
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             const auto segments =
-                m_viewModel.segmentEntries(path);
+                m_viewModel->segmentEntries(path);
             int pathId = summary.pathId;
             out << "Path " << pathId << " Segments:\n";
             for (int i = 0; i < segments.size(); ++i)
@@ -2427,7 +2473,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).pathLabel;
+            out << "," << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -2447,7 +2493,7 @@ void PathComparisonDialog::onExportButtonClicked()
             if (path && path->path)
             {
                 const auto segments =
-                    m_viewModel.segmentEntries(path);
+                    m_viewModel->segmentEntries(path);
                 if (i < segments.size())
                 {
                     QString segmentInfo =
@@ -2483,7 +2529,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            out << "," << m_viewModel.pathSummary(path).pathLabel;
+            out << "," << m_viewModel->pathSummary(path).pathLabel;
         }
         else
         {
@@ -2498,7 +2544,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << ","
                 << QString::number(summary.predictedTotalCost, 'f',
                                    2);
@@ -2515,7 +2561,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << ","
                 << QString::number(summary.predictedEdgeCost, 'f',
                                    2);
@@ -2532,7 +2578,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << ","
                 << QString::number(summary.predictedTerminalCost,
                                    'f', 2);
@@ -2605,9 +2651,9 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path
             && path->hasSimulationTotalCost()
-            && m_viewModel.pathSummary(path).predictedTotalCost > 0)
+            && m_viewModel->pathSummary(path).predictedTotalCost > 0)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             double predictedCost =
                 summary.predictedTotalCost;
             double simulatedCost =
@@ -2643,7 +2689,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             int pathId = summary.pathId;
             out << "Path " << pathId
                 << " Detailed Cost Breakdown:\n";
@@ -2653,7 +2699,7 @@ void PathComparisonDialog::onExportButtonClicked()
 
             // Initialize cost accumulators
             const auto totals =
-                m_viewModel.pathCostTotals(path);
+                m_viewModel->pathCostTotals(path);
             const double predictedCarbonEmissionsCost =
                 totals.predicted.carbonEmissions;
             const double actualCarbonEmissionsCost =
@@ -2858,7 +2904,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << "," << summary.pathLabel
                 << " Predicted"
                 << "," << summary.pathLabel
@@ -2921,7 +2967,7 @@ void PathComparisonDialog::onExportButtonClicked()
     {
         if (path && path->path)
         {
-            const auto summary = m_viewModel.pathSummary(path);
+            const auto summary = m_viewModel->pathSummary(path);
             out << ","
                 << QString::number(summary.predictedTotalCost, 'f',
                                    2);
@@ -22,8 +22,11 @@
 #include <QTabWidget>
 #include <QTableWidget>
 #include <QVBoxLayout>
+#include <QVector>
 #include <QWidget>
 
+#include <memory>
+
 namespace CargoNetSim
 {
 namespace GUI
@@ -37,6 +40,10 @@ namespace GUI
  * This class provides a specialized dialog for comparing
  * multiple paths side-by-side, including their terminals,
  * costs, and transportation modes.
+ *
+ * The dialog works on a precomputed snapshot of the records,
+ * shared by all tabs and the CSV export. Tabs other than the
+ * summary are built the first time they are shown.
  */
 class PathComparisonDialog : public QDialog
 {
@@ -68,7 +75,21 @@ private slots:
      */
     void onExportButtonClicked();
 
+    /**
+     * @brief Builds the content of tab @p index if it has not
+     * been built yet
+     */
+    void ensureTabBuilt(int index);
+
 private:
+    enum Tab : int
+    {
+        SummaryTab = 0,
+        TerminalsTab,
+        SegmentsTab,
+        CostsTab
+    };
+
     /**
      * @brief Initializes the UI components
      */
@@ -127,7 +148,12 @@ private:
      * @brief List of PathData objects being compared
      */
     QList<const PathData *> m_pathData;
-    PathComparisonViewModel m_viewModel;
+    std::shared_ptr<PathComparisonViewModel> m_viewModel;
+
+    /**
+     * @brief Whether each tab's content has been built
+     */
+    QVector<bool> m_builtTabs;
 
     /**
      * @brief Tab widget for organizing comparison views
@@ -21,24 +21,22 @@
 #include "GUI/Widgets/PathComparisonDialog.h"
 #include <QApplication>
 #include <QFileDialog>
+#include <QFontMetrics>
 #include <QIcon>
+#include <QItemSelectionModel>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QMessageBox>
+#include <QMouseEvent>
 #include <QPainter>
-#include <QPainterPath>
-#include <QProgressBar>
-#include <QScrollBar>
 #include <QSet>
+#include <QStyle>
+#include <QStyleOptionProgressBar>
 #include <QVariant>
-#include <QtWidgets/qscrollarea.h>
 #include <stdexcept>
 #include "Backend/Commons/LogCategories.h"
 
-// Register meta-type for storing widgets in QVariant
-Q_DECLARE_METATYPE(QWidget *)
-
 namespace CargoNetSim
 {
 namespace GUI
@@ -48,218 +46,21 @@ namespace
 {
 
 using ExecutionPathKey = ShortestPathsTable::ExecutionPathKey;
+using PathData         = ShortestPathsTable::PathData;
 
-enum TableColumn : int
-{
-    ColumnSelect = 0,
-    ColumnPathId,
-    ColumnStatus,
-    ColumnExecutionProgress,
-    ColumnTerminalPath,
-    ColumnPredictedCost,
-    ColumnActualCost,
-    ColumnPredictedDistance,
-    ColumnPredictedTime,
-    ColumnPredictedFuelPerVehicle,
-    ColumnPredictedEnergyPerVehicle,
-    ColumnPredictedCarbonPerVehicle,
-    ColumnPredictedRiskPerVehicle,
-    ColumnActualDistance,
-    ColumnActualTime,
-    ColumnActualEnergyPerVehicle,
-    ColumnActualCarbonPerVehicle,
-    ColumnActualRiskPerVehicle,
-    ColumnContainers,
-    ColumnVehicles,
-    ColumnPredictedFuelPerContainer,
-    ColumnPredictedEnergyPerContainer,
-    ColumnPredictedCarbonPerContainer,
-    ColumnActualEnergyPerContainer,
-    ColumnActualCarbonPerContainer,
-    ColumnCount
-};
-
-ExecutionPathKey makeUniquePathKey(
-    const ExecutionPathKey &baseKey,
-    const QMap<ExecutionPathKey, ShortestPathsTable::PathData *> &existing)
-{
-    const QString normalizedBase =
-        baseKey.isEmpty() ? QStringLiteral("path") : baseKey;
-    QString candidate = normalizedBase;
-    int     suffix    = 2;
-    while (existing.contains(candidate))
-    {
-        candidate = QStringLiteral("%1#%2")
-                        .arg(normalizedBase)
-                        .arg(suffix++);
-    }
-    return candidate;
-}
-
-QString vehicleBreakdownLabel(
-    const Backend::Scenario::PathMetrics &metrics)
-{
-    if (metrics.previewVehicleBreakdown.isEmpty())
-    {
-        return metrics.valid
-            ? QString::number(metrics.vehiclesNeeded)
-            : QStringLiteral("—");
-    }
-
-    QStringList parts;
-    parts.reserve(metrics.previewVehicleBreakdown.size());
-    for (const auto &requirement : metrics.previewVehicleBreakdown)
-    {
-        parts.append(QStringLiteral("%1 x%2")
-                         .arg(Backend::TransportationTypes::toString(
-                             requirement.mode))
-                         .arg(requirement.vehiclesNeeded));
-    }
-    return parts.join(QStringLiteral(" | "));
-}
-
-QString pathLifecycleLabel(
-    Backend::Scenario::PathLifecycleState lifecycle)
-{
-    using Backend::Scenario::PathLifecycleState;
-    switch (lifecycle)
-    {
-    case PathLifecycleState::Pending:
-        return QObject::tr("pending");
-    case PathLifecycleState::Running:
-        return QObject::tr("running");
-    case PathLifecycleState::WaitingForTerminalHandoff:
-        return QObject::tr("terminal handoff");
-    case PathLifecycleState::WaitingForTerminalProcessing:
-        return QObject::tr("terminal processing");
-    case PathLifecycleState::ReadyForNextSegment:
-        return QObject::tr("ready for next segment");
-    case PathLifecycleState::Paused:
-        return QObject::tr("paused");
-    case PathLifecycleState::Skipped:
-        return QObject::tr("skipped");
-    case PathLifecycleState::Completed:
-        return QObject::tr("completed");
-    case PathLifecycleState::Failed:
-        return QObject::tr("failed");
-    }
-    return QObject::tr("unknown");
-}
-
-QString segmentLifecycleLabel(
-    Backend::Scenario::SegmentLifecycleState lifecycle)
-{
-    using Backend::Scenario::SegmentLifecycleState;
-    switch (lifecycle)
-    {
-    case SegmentLifecycleState::Pending:
-        return QObject::tr("pending");
-    case SegmentLifecycleState::Dispatched:
-        return QObject::tr("dispatched");
-    case SegmentLifecycleState::VehicleRunning:
-        return QObject::tr("running");
-    case SegmentLifecycleState::VehicleArrived:
-        return QObject::tr("arrived");
-    case SegmentLifecycleState::UnloadCompleted:
-        return QObject::tr("unloaded");
-    case SegmentLifecycleState::TerminalHandoffCompleted:
-        return QObject::tr("handoff complete");
-    case SegmentLifecycleState::TerminalProcessing:
-        return QObject::tr("terminal processing");
-    case SegmentLifecycleState::ReadyForPickup:
-        return QObject::tr("ready");
-    case SegmentLifecycleState::Skipped:
-        return QObject::tr("skipped");
-    case SegmentLifecycleState::Completed:
-        return QObject::tr("completed");
-    case SegmentLifecycleState::Failed:
-        return QObject::tr("failed");
-    }
-    return QObject::tr("unknown");
-}
-
-QString modeLabel(
-    Backend::TransportationTypes::TransportationMode mode)
-{
-    if (mode == Backend::TransportationTypes::TransportationMode::Any)
-        return QObject::tr("No mode");
-    return Backend::TransportationTypes::toString(mode);
-}
-
-const Backend::Scenario::SegmentProgressSnapshot *
-activeSegmentFor(
-    const Backend::Scenario::PathProgressSnapshot &progress)
-{
-    for (const auto &segment : progress.segments)
-    {
-        if (segment.segmentIndex == progress.activeSegmentIndex)
-            return &segment;
-    }
-    return nullptr;
-}
-
-QString statusMessage(
-    const Backend::Scenario::PreparedPathEligibility &eligibility)
-{
-    if (!eligibility.simulatable)
-        return QObject::tr("Simulation unavailable");
-
-    if (!eligibility.warningReason.isEmpty())
-        return QObject::tr("Ready with warning");
+/// Size of the "show on map" eye drawn at the start of a path.
+constexpr int kEyeSize     = 24;
+/// Gap between the parts of a painted terminal path.
+constexpr int kCellSpacing = 4;
+/// Rows sampled when sizing content-driven columns after a load.
+constexpr int kColumnSizingSampleRows = 200;
 
-    return QObject::tr("Ready");
-}
-
-QPixmap statusIcon(
-    const Backend::Scenario::PreparedPathEligibility &eligibility)
+QString terminalName(const QList<Backend::PathTerminal> &terminals,
+                     int                                 index)
 {
-    constexpr int kStatusIconSize = 16;
-
-    if (!eligibility.simulatable)
-    {
-        return IconFactory::createStatusUnavailableIcon(
-            kStatusIconSize);
-    }
-
-    if (!eligibility.warningReason.isEmpty())
-    {
-        return IconFactory::createStatusWarningIcon(
-            kStatusIconSize);
-    }
-
-    return IconFactory::createStatusReadyIcon(kStatusIconSize);
-}
-
-void styleStatusItem(
-    QTableWidgetItem                                 *item,
-    const Backend::Scenario::PreparedPathEligibility &eligibility)
-{
-    if (!item)
-        return;
-
-    item->setTextAlignment(Qt::AlignCenter);
-    item->setText(QString());
-    item->setIcon(QIcon(statusIcon(eligibility)));
-
-    if (!eligibility.simulatable)
-    {
-        item->setBackground(QColor(253, 236, 234));
-        item->setForeground(QBrush(QColor(145, 33, 54)));
-        QFont font = item->font();
-        font.setBold(true);
-        item->setFont(font);
-        return;
-    }
-
-    if (!eligibility.warningReason.isEmpty())
-    {
-        item->setBackground(QColor(255, 245, 224));
-        item->setForeground(QBrush(QColor(133, 87, 0)));
-        return;
-    }
-
-    item->setBackground(QColor(232, 245, 236));
-    item->setForeground(QBrush(QColor(31, 101, 58)));
+    return terminals[index].displayName.isEmpty()
+               ? QObject::tr("Terminal %1").arg(index + 1)
+               : terminals[index].displayName;
 }
 
 QString compactJsonObject(const QJsonObject &object)
@@ -279,10 +80,15 @@ double costSnapshotTotal(
 }
 
 void logPredictedPathDiagnostics(
-    const QMap<ExecutionPathKey, ShortestPathsTable::PathData *> &paths,
-    const QVector<ExecutionPathKey>                              &displayOrder,
-    const QString                                                &source)
+    const ShortestPathsModel        &model,
+    const QVector<ExecutionPathKey> &displayOrder,
+    const QString                   &source)
 {
+    // The presenter values below are computed outside the log
+    // macros; skip the walk entirely unless it will be printed.
+    if (!lcGuiPathTable().isInfoEnabled())
+        return;
+
     Backend::Application::PathPresentationService presenter;
 
     qCInfo(lcGuiPathTable)
@@ -292,7 +98,7 @@ void logPredictedPathDiagnostics(
 
     for (const auto &pathKey : displayOrder)
     {
-        const auto *record = paths.value(pathKey, nullptr);
+        const auto *record = model.record(pathKey);
         if (!record || !record->path)
         {
             qCWarning(lcGuiPathTable)
@@ -494,65 +300,123 @@ void logPredictedPathDiagnostics(
  * @brief Custom paint implementation for the terminal path
  * delegate
  *
- * Renders the custom widget in the terminal path column, or
- * falls back to standard delegate rendering for other
- * columns.
+ * Paints the terminal path and progress columns from the
+ * model's roles, or falls back to standard delegate
+ * rendering for other columns.
  */
 void TerminalPathDelegate::paint(
     QPainter *painter, const QStyleOptionViewItem &option,
     const QModelIndex &index) const
 {
-    // Check if we're in the terminals column (column index
-    // 2)
-    if (index.column() == ColumnTerminalPath)
+    const int column = index.column();
+    if (column != ShortestPathsModel::ColumnExecutionProgress
+        && column != ShortestPathsModel::ColumnTerminalPath)
+    {
+        QStyledItemDelegate::paint(painter, option, index);
+        return;
+    }
+
+    const QWidget *widget = option.widget;
+    QStyle *style = widget ? widget->style() : QApplication::style();
+
+    // Cell background and selection highlight without any text.
+    QStyleOptionViewItem background = option;
+    initStyleOption(&background, index);
+    background.text.clear();
+    style->drawControl(QStyle::CE_ItemViewItem, &background, painter,
+                       widget);
+
+    if (column == ShortestPathsModel::ColumnExecutionProgress)
+    {
+        QStyleOptionProgressBar bar;
+        bar.state       = option.state;
+        bar.direction   = option.direction;
+        bar.palette     = option.palette;
+        bar.fontMetrics = option.fontMetrics;
+        bar.rect          = option.rect.adjusted(2, 2, -2, -2);
+        bar.minimum       = 0;
+        bar.maximum       = 100;
+        bar.progress      =
+            index.data(ShortestPathsModel::ProgressRole).toInt();
+        bar.text          = index.data(Qt::DisplayRole).toString();
+        bar.textVisible   = true;
+        bar.textAlignment = Qt::AlignCenter;
+        if (!index.data(ShortestPathsModel::ProgressEnabledRole)
+                 .toBool())
+            bar.state &= ~QStyle::State_Enabled;
+        style->drawControl(QStyle::CE_ProgressBar, &bar, painter,
+                           widget);
+        return;
+    }
+
+    const auto *record =
+        index.data(ShortestPathsModel::RecordRole)
+            .value<const ShortestPathsModel::PathData *>();
+    if (!record || !record->path)
+        return;
+
+    painter->save();
+    painter->setClipRect(option.rect);
+
+    if (m_eyePixmap.isNull())
+        m_eyePixmap = IconFactory::createShowEyeIcon(kEyeSize);
+    const QRect eye = eyeRect(option.rect);
+    painter->drawPixmap(eye, m_eyePixmap);
+
+    painter->setFont(option.font);
+    painter->setPen(option.palette.color(
+        option.state & QStyle::State_Selected ? QPalette::HighlightedText
+                                              : QPalette::Text));
+
+    const QFontMetrics metrics(option.font);
+    const auto &terminals = record->path->getTerminalsInPath();
+    const QList<Backend::PathSegment *> segments =
+        record->path->getSegments();
+    int x = eye.right() + 1 + kCellSpacing;
+
+    if (terminals.isEmpty())
+    {
+        painter->drawText(
+            QRect(x, option.rect.top(), option.rect.right() - x,
+                  option.rect.height()),
+            Qt::AlignVCenter | Qt::AlignLeft,
+            QObject::tr("No terminal data"));
+    }
+
+    // Stop once past the cell; the full sequence is in the tooltip.
+    for (int i = 0; i < terminals.size() && x < option.rect.right();
+         ++i)
     {
-        // Try to extract the widget from user data
-        QWidget *widget = qvariant_cast<QWidget *>(
-            index.data(Qt::UserRole));
+        const QString name  = terminalName(terminals, i);
+        const int     width = metrics.horizontalAdvance(name);
+        painter->drawText(QRect(x, option.rect.top(), width,
+                                option.rect.height()),
+                          Qt::AlignVCenter | Qt::AlignLeft, name);
+        x += width + kCellSpacing;
 
-        if (widget)
+        if (i < terminals.size() - 1 && i < segments.size()
+            && segments[i])
         {
-            // Calculate paint rect to avoid scrollbars
-            // overlapping other cells
-            QRect paintRect = option.rect;
-
-            // Check if the widget is a QScrollArea
-            QScrollArea *scrollArea =
-                qobject_cast<QScrollArea *>(widget);
-            if (scrollArea)
-            {
-                // Render the scroll area widget
-                scrollArea->setFixedHeight(
-                    option.rect.height());
-                QPixmap pixmap(scrollArea->size());
-                pixmap.fill(Qt::transparent);
-                scrollArea->render(&pixmap);
-                painter->drawPixmap(paintRect.topLeft(),
-                                    pixmap);
-                return;
-            }
-            else
-            {
-                // Render the widget directly to the cell
-                QPixmap pixmap(widget->size());
-                widget->render(&pixmap);
-                painter->drawPixmap(paintRect.topLeft(),
-                                    pixmap);
-                return;
-            }
+            const QPixmap &arrow =
+                modePixmap(Backend::TransportationTypes::toString(
+                    segments[i]->getMode()));
+            const QSize size =
+                arrow.deviceIndependentSize().toSize();
+            painter->drawPixmap(
+                x, option.rect.center().y() - size.height() / 2,
+                arrow);
+            x += size.width() + kCellSpacing;
         }
     }
 
-    // Fall back to default rendering for other columns or
-    // if widget extraction failed
-    QStyledItemDelegate::paint(painter, option, index);
+    painter->restore();
 }
 
 /**
  * @brief Size hint implementation for the terminal path
  * delegate
  *
- * Returns the size of the custom widget for the terminal
+ * Measures the painted terminal sequence for the terminal
  * path column, or falls back to standard delegate size for
  * other columns.
  */
@@ -560,36 +424,81 @@ QSize TerminalPathDelegate::sizeHint(
     const QStyleOptionViewItem &option,
     const QModelIndex          &index) const
 {
-    // Check if we're in the terminals column
-    if (index.column() == ColumnTerminalPath)
-    {
-        // Try to extract the widget from user data
-        QWidget *widget = qvariant_cast<QWidget *>(
-            index.data(Qt::UserRole));
+    const QSize base = QStyledItemDelegate::sizeHint(option, index);
+    if (index.column() != ShortestPathsModel::ColumnTerminalPath)
+        return base;
+
+    const auto *record =
+        index.data(ShortestPathsModel::RecordRole)
+            .value<const ShortestPathsModel::PathData *>();
+    if (!record || !record->path)
+        return base;
+
+    const QFontMetrics metrics(option.font);
+    const auto &terminals = record->path->getTerminalsInPath();
+    const QList<Backend::PathSegment *> segments =
+        record->path->getSegments();
 
-        if (widget)
+    int width = kCellSpacing + kEyeSize + kCellSpacing;
+    for (int i = 0; i < terminals.size(); ++i)
+    {
+        width += metrics.horizontalAdvance(terminalName(terminals, i))
+                 + kCellSpacing;
+        if (i < terminals.size() - 1 && i < segments.size()
+            && segments[i])
         {
-            // For QScrollArea, use the widget's viewport
-            // width
-            QScrollArea *scrollArea =
-                qobject_cast<QScrollArea *>(widget);
-            if (scrollArea && scrollArea->widget())
-            {
-                // Return size that accounts for the scroll
-                // area's content
-                return QSize(scrollArea->widget()
-                                 ->sizeHint()
-                                 .width(),
-                             option.rect.height());
-            }
+            width += modePixmap(Backend::TransportationTypes::toString(
+                                    segments[i]->getMode()))
+                         .deviceIndependentSize()
+                         .toSize()
+                         .width()
+                     + kCellSpacing;
+        }
+    }
+    return QSize(width, qMax(base.height(), kEyeSize));
+}
 
-            // Use the widget's size for the cell
-            return widget->size();
+bool TerminalPathDelegate::editorEvent(
+    QEvent *event, QAbstractItemModel *model,
+    const QStyleOptionViewItem &option, const QModelIndex &index)
+{
+    if (index.column() == ShortestPathsModel::ColumnTerminalPath
+        && event->type() == QEvent::MouseButtonRelease)
+    {
+        auto *mouseEvent = static_cast<QMouseEvent *>(event);
+        if (mouseEvent->button() == Qt::LeftButton
+            && eyeRect(option.rect)
+                   .contains(mouseEvent->position().toPoint()))
+        {
+            emit showPathRequested(
+                index.data(ShortestPathsModel::PathKeyRole)
+                    .toString());
+            return true;
         }
     }
 
-    // Fall back to default size hint for other columns
-    return QStyledItemDelegate::sizeHint(option, index);
+    // The base class toggles the Select column's check state.
+    return QStyledItemDelegate::editorEvent(event, model, option,
+                                            index);
+}
+
+QRect TerminalPathDelegate::eyeRect(const QRect &cellRect) const
+{
+    return QRect(cellRect.left() + kCellSpacing,
+                 cellRect.center().y() - kEyeSize / 2, kEyeSize,
+                 kEyeSize);
+}
+
+const QPixmap &
+TerminalPathDelegate::modePixmap(const QString &mode) const
+{
+    auto it = m_modePixmaps.find(mode);
+    if (it == m_modePixmaps.end())
+    {
+        it = m_modePixmaps.insert(
+            mode, IconFactory::createTransportationModePixmap(mode));
+    }
+    return it.value();
 }
 
 //------------------------------------------------------------------------------
@@ -605,13 +514,18 @@ QSize TerminalPathDelegate::sizeHint(
  */
 ShortestPathsTable::ShortestPathsTable(QWidget *parent)
     : QWidget(parent)
-    , m_updatingUI(false) // Initialize to prevent recursive
-                          // UI updates during setup
-    , m_scrollEventFilter(new PathScrollEventFilter())
+    , m_model(new ShortestPathsModel(this))
+    , m_proxy(new ShortestPathsFilterModel(this))
+    , m_reportExporter(new PathReportExporter(this))
 {
+    m_proxy->setSourceModel(m_model);
+
     // Set up the user interface components
     initUI();
 
+    connect(m_model, &ShortestPathsModel::checkStateChanged, this,
+            &ShortestPathsTable::onCheckStateChanged);
+
     MainWindow *mainWindow =
         qobject_cast<MainWindow *>(parent);
 
@@ -625,21 +539,7 @@ ShortestPathsTable::ShortestPathsTable(QWidget *parent)
     }
 }
 
-ShortestPathsTable::~ShortestPathsTable()
-{
-    // Clean up all PathData objects
-    for (auto &pathDataPtr : m_pathData)
-    {
-        delete pathDataPtr;
-    }
-    m_pathData.clear();
-
-    // Clean up event filter
-    if (m_scrollEventFilter)
-    {
-        delete m_scrollEventFilter;
-    }
-}
+ShortestPathsTable::~ShortestPathsTable() = default;
 
 /**
  * @brief Initializes the UI components
@@ -655,6 +555,16 @@ void ShortestPathsTable::initUI()
     layout->setSpacing(
         2); // Compact spacing between elements
 
+    // Filter applied by the proxy to path id and terminal names
+    m_filterEdit = new QLineEdit(this);
+    m_filterEdit->setObjectName(QStringLiteral("pathFilterEdit"));
+    m_filterEdit->setPlaceholderText(
+        tr("Filter by path ID or terminal"));
+    m_filterEdit->setClearButtonEnabled(true);
+    connect(m_filterEdit, &QLineEdit::textChanged, m_proxy,
+            &QSortFilterProxyModel::setFilterFixedString);
+    layout->addWidget(m_filterEdit);
+
     // Create and add the table widget
     createTableWidget();
     layout->addWidget(m_table);
@@ -698,92 +608,68 @@ void ShortestPathsTable::initUI()
 }
 
 /**
- * @brief Creates and configures the table widget
+ * @brief Creates and configures the table view
  *
  * Sets up columns, headers, and behavior for the path
  * table.
  */
 void ShortestPathsTable::createTableWidget()
 {
-    // Create table widget
-    m_table = new QTableWidget(this);
-
-    // Configure table structure.
-    //
-    // Plan 8.2/A2: add a dedicated status column near the front of
-    // the table so backend eligibility is visible without drowning the
-    // metric columns in warning colors.
-    m_table->setColumnCount(ColumnCount);
-    m_table->setHorizontalHeaderLabels({
-        tr("Select"),                tr("Path ID"),
-        tr("Status"),                tr("Progress"),
-        tr("Terminal Path"),
-        tr("Predicted Cost"),        tr("Actual Cost"),
-        // Predicted per-vehicle.
-        tr("P. Distance (km)"),      tr("P. Time (h)"),
-        tr("P. Fuel/Veh"),           tr("P. Energy/Veh (kWh)"),
-        tr("P. CO₂/Veh (t)"),        tr("P. Risk/Veh"),
-        // Actual per-vehicle; no fuel key from
-        // SegmentCostMath)
-        tr("A. Distance (km)"),      tr("A. Time (h)"),
-        tr("A. Energy/Veh (kWh)"),   tr("A. CO₂/Veh (t)"),
-        tr("A. Risk/Veh"),
-        // Preview-demand counts and per-container metrics.
-        tr("OD Containers"),         tr("Preview Vehicle Plan"),
-        tr("P. Fuel/Cont"),          tr("P. Energy/Cont (kWh)"),
-        tr("P. CO₂/Cont (t)"),
-        tr("A. Energy/Cont (kWh)"),  tr("A. CO₂/Cont (t)"),
-    });
+    // Create table view over the sort/filter proxy. Headers,
+    // cells and the status column all come from the model.
+    m_table = new QTableView(this);
+    m_table->setModel(m_proxy);
 
     // Configure selection behavior
-    m_table->setSelectionBehavior(QTableWidget::SelectRows);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_table->setSelectionMode(
-        QTableWidget::SingleSelection);
+        QAbstractItemView::SingleSelection);
     m_table->setEditTriggers(
-        QTableWidget::NoEditTriggers); // Read-only table
+        QAbstractItemView::NoEditTriggers); // Read-only table
+    m_table->setWordWrap(false);
+
+    // Fixed-height rows let the view lay out any number of
+    // rows without measuring them.
+    m_table->verticalHeader()->setSectionResizeMode(
+        QHeaderView::Fixed);
     m_table->verticalHeader()->setDefaultSectionSize(
         50); // 50 pixels high rows
 
     // Configure header appearance and behavior
     auto header = m_table->horizontalHeader();
+    header->setSectionResizeMode(QHeaderView::Interactive);
+    header->setResizeContentsPrecision(kColumnSizingSampleRows);
 
     // Set column sizing policies
     header->setSectionResizeMode(
-        ColumnSelect, QHeaderView::Fixed); // Fixed width for checkbox
+        ShortestPathsModel::ColumnSelect,
+        QHeaderView::Fixed); // Fixed width for checkbox
     m_table->setColumnWidth(
-        ColumnSelect, 50); // 50 pixels for checkbox column
-
-    header->setSectionResizeMode(
-        ColumnPathId, QHeaderView::ResizeToContents);
-    header->setSectionResizeMode(
-        ColumnStatus, QHeaderView::ResizeToContents);
-    header->setSectionResizeMode(
-        ColumnExecutionProgress, QHeaderView::Interactive);
-    m_table->setColumnWidth(ColumnExecutionProgress, 260);
-    header->setSectionResizeMode(
-        ColumnTerminalPath, QHeaderView::Interactive);
+        ShortestPathsModel::ColumnSelect,
+        50); // 50 pixels for checkbox column
+    m_table->setColumnWidth(
+        ShortestPathsModel::ColumnExecutionProgress, 260);
     // The terminal sequence is the most scan-heavy field in the table.
     // Give it a wide default so it does not collapse behind the metric
     // columns, while still letting users resize it manually.
-    m_table->setColumnWidth(ColumnTerminalPath, 520);
-    header->setSectionResizeMode(
-        ColumnPredictedCost, QHeaderView::ResizeToContents);
-    header->setSectionResizeMode(
-        ColumnActualCost, QHeaderView::ResizeToContents);
+    m_table->setColumnWidth(ShortestPathsModel::ColumnTerminalPath,
+                            520);
 
-    // Plan 8.2 + Plan 10: auto-size the metric columns.
-    for (int c = ColumnPredictedDistance; c < ColumnCount; ++c)
-        header->setSectionResizeMode(
-            c, QHeaderView::ResizeToContents);
+    // Start in insertion (rank) order; clicking a header sorts.
+    header->setSortIndicator(-1, Qt::AscendingOrder);
+    m_table->setSortingEnabled(true);
 
     // Set custom delegate for terminal path visualization
-    m_table->setItemDelegate(
-        new TerminalPathDelegate(m_table));
+    auto *delegate = new TerminalPathDelegate(m_table);
+    m_table->setItemDelegate(delegate);
+    connect(delegate, &TerminalPathDelegate::showPathRequested,
+            this, &ShortestPathsTable::showPathSignal);
 
     // Connect selection signal to update UI state when
     // selection changes
-    connect(m_table, &QTableWidget::itemSelectionChanged,
-            this, &ShortestPathsTable::onSelectionChanged);
+    connect(m_table->selectionModel(),
+            &QItemSelectionModel::selectionChanged, this,
+            &ShortestPathsTable::onSelectionChanged);
 }
 
 /**
@@ -864,8 +750,8 @@ void ShortestPathsTable::createSelectionPanel()
  * @brief Adds multiple paths to the table
  * @param paths List of Path pointers to add
  *
- * Processes each Path in the list, creating a PathData
- * object and adding it to the internal data structure.
+ * Converts each Path in the list to a presentation record
+ * and appends them to the model in one insert.
  */
 void ShortestPathsTable::addPaths(
     const QList<Backend::Path *>                              &paths,
@@ -874,21 +760,9 @@ void ShortestPathsTable::addPaths(
 {
     qCDebug(lcGuiPathTable) << "ShortestPathsTable::addPaths:"
                             << "pathCount=" << paths.size();
-    const auto records =
-        Backend::Application::PathPresentationService()
-            .recordsFromRawPaths(paths, predicted, actual);
-    for (auto record : records)
-    {
-        appendPathRecord(std::move(record));
-    }
-    logPredictedPathDiagnostics(m_pathData, m_displayOrder,
-                                QStringLiteral("addPaths"));
-
-    // Refresh the table with the new paths
-    refreshTable();
-
-    // Enable export all button if we have data
-    m_exportButton->setEnabled(!m_pathData.isEmpty());
+    appendRecords(Backend::Application::PathPresentationService()
+                      .recordsFromRawPaths(paths, predicted, actual),
+                  QStringLiteral("addPaths"));
 }
 
 void ShortestPathsTable::setPreparedPaths(
@@ -899,80 +773,75 @@ void ShortestPathsTable::setPreparedPaths(
 {
     clear();
 
-    const auto records =
-        Backend::Application::PathPresentationService()
-            .recordsFromPreparedPaths(prepared, actual,
-                                      eligibility);
-    for (auto record : records)
-    {
-        appendPathRecord(std::move(record));
-    }
-    logPredictedPathDiagnostics(m_pathData, m_displayOrder,
-                                QStringLiteral("setPreparedPaths"));
-
-    refreshTable();
-    m_exportButton->setEnabled(!m_pathData.isEmpty());
+    appendRecords(Backend::Application::PathPresentationService()
+                      .recordsFromPreparedPaths(prepared, actual,
+                                                eligibility),
+                  QStringLiteral("setPreparedPaths"));
 }
 
-void ShortestPathsTable::setPathEligibility(
-    const QHash<ExecutionPathKey, Backend::Scenario::PreparedPathEligibility>
-        &eligibility)
+QVector<ShortestPathsTable::ExecutionPathKey>
+ShortestPathsTable::appendRecords(QList<PathData> records,
+                                  const QString  &source)
 {
-    for (auto it = m_pathData.begin(); it != m_pathData.end(); ++it)
+    const QVector<ExecutionPathKey> keys =
+        m_model->appendRecords(std::move(records));
+
+    QVector<ExecutionPathKey> storedKeys;
+    storedKeys.reserve(keys.size());
+    for (const auto &pathKey : keys)
     {
-        if (!it.value())
-            continue;
-        it.value()->eligibility =
-            eligibility.value(it.key(),
-                              Backend::Scenario::
-                                  PreparedPathEligibility{});
+        if (!pathKey.isEmpty())
+            storedKeys.append(pathKey);
     }
+    logPredictedPathDiagnostics(*m_model, storedKeys, source);
 
-    refreshTable();
+    resizeColumnsToSample();
+    updateButtonStates();
+    updateAvailabilityBanner();
+    return keys;
 }
 
-bool ShortestPathsTable::isSelectable(const PathData *pathData) const
+void ShortestPathsTable::resizeColumnsToSample()
 {
-    return pathData && pathData->eligibility.selectable;
+    if (m_model->rowCount() == 0)
+        return;
+
+    m_table->resizeColumnToContents(ShortestPathsModel::ColumnPathId);
+    m_table->resizeColumnToContents(ShortestPathsModel::ColumnStatus);
+    m_table->resizeColumnToContents(
+        ShortestPathsModel::ColumnPredictedCost);
+    m_table->resizeColumnToContents(
+        ShortestPathsModel::ColumnActualCost);
+    for (int c = ShortestPathsModel::ColumnPredictedDistance;
+         c < ShortestPathsModel::ColumnCount; ++c)
+        m_table->resizeColumnToContents(c);
 }
 
-int ShortestPathsTable::selectablePathCount() const
+void ShortestPathsTable::setPathEligibility(
+    const QHash<ExecutionPathKey, Backend::Scenario::PreparedPathEligibility>
+        &eligibility)
 {
-    int count = 0;
-    for (const auto *pathData : m_pathData)
-    {
-        if (pathData && pathData->isVisible && pathData->path
-            && isSelectable(pathData))
-        {
-            ++count;
-        }
-    }
-    return count;
+    m_model->setEligibility(eligibility);
+    updateButtonStates();
+    updateAvailabilityBanner();
 }
 
-QString ShortestPathsTable::eligibilityTooltip(
-    const PathData *pathData) const
+void ShortestPathsTable::updateButtonStates()
 {
-    if (!pathData)
-        return QString();
+    const int  checkedCount = m_model->checkedCount();
+    const bool hasChecked   = checkedCount > 0;
 
-    if (!pathData->eligibility.simulatable
-        && !pathData->eligibility.blockingReason.isEmpty())
-    {
-        return tr("Simulation unavailable: %1")
-            .arg(pathData->eligibility.blockingReason);
-    }
+    // Enable compare button if at least 1 path is checked
+    m_compareButton->setEnabled(hasChecked);
 
-    if (!pathData->eligibility.simulatable)
-        return tr("Simulation unavailable.");
-
-    if (!pathData->eligibility.warningReason.isEmpty())
-    {
-        return tr("Ready for simulation with warning: %1")
-            .arg(pathData->eligibility.warningReason);
-    }
+    // Enable export button if there are any paths in the table
+    m_exportButton->setEnabled(m_model->rowCount() > 0);
 
-    return tr("Ready for simulation.");
+    // Enable select all button only if not all paths are
+    // already selected
+    m_selectAllButton->setEnabled(m_model->selectableCount()
+                                  > checkedCount);
+    m_unselectAllButton->setEnabled(hasChecked);
 }
 
 QString ShortestPathsTable::availabilityBannerText() const
@@ -980,9 +849,9 @@ QString ShortestPathsTable::availabilityBannerText() const
     int           unavailableCount = 0;
     QSet<QString> affectedDependencies;
 
-    for (const auto *pathData : m_pathData)
+    for (const auto &pathData : m_model->records())
     {
-        if (!pathData || !pathData->path || !pathData->isVisible
+        if (!pathData->path || !pathData->isVisible
             || pathData->eligibility.simulatable)
         {
             continue;
@@ -1040,20 +909,21 @@ void ShortestPathsTable::updateAvailabilityBanner()
     m_availabilityBanner->setVisible(!text.isEmpty());
 }
 
+
 int ShortestPathsTable::pathsSize() const
 {
-    return m_pathData.size();
+    return m_model->rowCount();
 }
 
 /**
  * @brief Updates the prediction costs for an existing path
- * @param pathId The ID of the path to update
+ * @param pathKey The execution path key of the path to update
  * @param totalCost New predicted total cost
  * @param edgeCost New predicted edge cost
  * @param terminalCost New predicted terminal cost
  *
  * Updates the Path object's cost fields if the path exists
- * and refreshes the table display.
+ * and refreshes the affected cell.
  */
 void ShortestPathsTable::updatePredictionCosts(
     const ExecutionPathKey &pathKey, double totalCost, double edgeCost,
@@ -1061,668 +931,97 @@ void ShortestPathsTable::updatePredictionCosts(
 {
     qCDebug(lcGuiPathTable) << "ShortestPathTable: updating cost field:"
                             << "pathKey=" << pathKey;
-    // Check if the path exists in our data
-    if (!m_pathData.contains(pathKey))
+    if (!m_model->updatePredictionCosts(pathKey, totalCost, edgeCost,
+                                        terminalCost))
     {
         qCWarning(lcGuiPathTable)
             << "Path key" << pathKey
             << "not found for prediction cost update";
-        return;
-    }
-
-    // Get reference to the path data
-    PathData *pathData = m_pathData[pathKey];
-
-    // Validate path pointer
-    if (!pathData->path)
-    {
-        qCWarning(lcGuiPathTable)
-            << "Path object is null for path"
-            << pathKey;
-        return;
-    }
-
-    // Update costs if values are valid (>= 0)
-    try
-    {
-        // Use the new setter methods to update the Path
-        // object
-        if (totalCost >= 0)
-        {
-            pathData->path->setTotalPathCost(totalCost);
-        }
-
-        if (edgeCost >= 0)
-        {
-            pathData->path->setTotalEdgeCosts(edgeCost);
-        }
-
-        if (terminalCost >= 0)
-        {
-            pathData->path->setTotalTerminalCosts(
-                terminalCost);
-        }
-
-        // Update the table display
-        for (int row = 0; row < m_table->rowCount(); ++row)
-        {
-            // Get the path ID for this row
-            auto idItem = m_table->item(row, ColumnPathId);
-            if (idItem
-                && idItem->data(Qt::UserRole).toString()
-                       == pathKey)
-            {
-                // Update the predicted cost cell if total
-                // cost was updated
-                if (totalCost >= 0)
-                {
-                    m_table->item(row, ColumnPredictedCost)->setText(
-                        QString::number(totalCost, 'f', 2));
-                }
-                break;
-            }
-        }
-    }
-    catch (const std::exception &ex)
-    {
-        qCWarning(lcGuiPathTable)
-            << "Error updating prediction costs for path"
-            << pathKey << ":" << ex.what();
     }
 }
 
 /**
  * @brief Updates the simulation costs for an existing path
- * @param pathId The ID of the path to update
+ * @param pathKey The execution path key of the path to update
  * @param simulationTotalCost New simulation total cost
  * @param simulationEdgeCost New simulation edge cost
  * @param simulationTerminalCost New simulation terminal
  * cost
  *
  * Updates the PathData's simulation cost fields if the path
- * exists and refreshes the table display.
+ * exists and refreshes the affected cell.
  */
 void ShortestPathsTable::updateSimulationCosts(
     const ExecutionPathKey &pathKey, double simulationTotalCost,
     double simulationEdgeCost,
     double simulationTerminalCost)
 {
-    // Check if the path exists in our data
-    if (!m_pathData.contains(pathKey))
+    if (!m_model->updateSimulationCosts(pathKey, simulationTotalCost,
+                                        simulationEdgeCost,
+                                        simulationTerminalCost))
     {
         qCWarning(lcGuiPathTable)
             << "Path key" << pathKey
             << "not found for simulation cost update";
-        return;
-    }
-
-    // Get reference to the path data
-    PathData *pathData = m_pathData[pathKey];
-
-    // Update simulation costs if values are valid (>= 0)
-    if (simulationTotalCost >= 0)
-    {
-        pathData->simulationTotalCost =
-            simulationTotalCost;
-    }
-
-    if (simulationEdgeCost >= 0)
-    {
-        pathData->simulationEdgeCosts =
-            simulationEdgeCost;
-    }
-
-    if (simulationTerminalCost >= 0)
-    {
-        pathData->simulationTerminalCosts =
-            simulationTerminalCost;
-    }
-
-    // Update the table display for this path
-    for (int row = 0; row < m_table->rowCount(); ++row)
-    {
-        // Get the path ID for this row
-        auto idItem = m_table->item(row, ColumnPathId);
-        if (idItem
-            && idItem->data(Qt::UserRole).toString()
-                   == pathKey)
-        {
-            // Update the actual cost cell if simulation
-            // total cost was updated
-            if (simulationTotalCost >= 0)
-            {
-                m_table->item(row, ColumnActualCost)->setText(
-                    QString::number(simulationTotalCost,
-                                    'f', 2));
-            }
-            break;
-        }
     }
 }
 
 /**
- * @brief Creates a visualization widget for a path
- * @param pathId ID of the path to visualize
- * @param pathData PathData object containing path details
- * @return Widget containing visual representation of the
- * path
- *
- * Generates a custom widget showing terminals and
- * transportation modes for a path, including a button to
- * show it on the map.
- */
-QWidget *
-ShortestPathsTable::createPathRow(
-    const ExecutionPathKey &pathKey, const PathData *pathData)
-{
-    // Check if path pointer is valid
-    if (!pathData->path)
-    {
-        qCWarning(lcGuiPathTable)
-            << "Cannot create path row: path is null for ID"
-            << pathKey;
-        return new QWidget(); // Return empty widget on
-                              // error
-    }
-
-    // Create container widget for the path visualization
-    auto contentWidget = new QWidget();
-    auto contentLayout = new QHBoxLayout(contentWidget);
-    contentLayout->setContentsMargins(0, 0, 0, 0);
-    contentLayout->setSpacing(
-        4); // Compact spacing between elements
-
-    // Create show button to visualize the path on the map
-    auto showButton = new QPushButton();
-    showButton->setIcon(IconFactory::createShowEyeIcon());
-    showButton->setFixedSize(24, 24);
-    showButton->setToolTip(tr("Show this path on the map"));
-
-    // Connect button to show path signal
-    connect(
-        showButton, &QPushButton::clicked, this,
-        [this, pathKey]() { emit showPathSignal(pathKey); });
-
-    contentLayout->addWidget(showButton);
-
-    // Get terminals and segments from the path
-    const QList<Backend::PathTerminal> &terminals =
-        pathData->path->getTerminalsInPath();
-    const QList<Backend::PathSegment *> segments =
-        pathData->path->getSegments();
-
-    // Validate terminal and segment data
-    if (terminals.isEmpty())
-    {
-        qCWarning(lcGuiPathTable) << "No terminals for path"
-                                  << pathKey;
-        contentLayout->addWidget(
-            new QLabel(tr("No terminal data")));
-        contentLayout->addStretch();
-
-        // Create and configure scroll area
-        auto scrollArea = new QScrollArea();
-        scrollArea->setWidgetResizable(true);
-        scrollArea->setHorizontalScrollBarPolicy(
-            Qt::ScrollBarAsNeeded);
-        scrollArea->setVerticalScrollBarPolicy(
-            Qt::ScrollBarAlwaysOff);
-        scrollArea->setFrameShape(
-            QFrame::NoFrame); // Hide the frame
-        scrollArea->setWidget(contentWidget);
-        scrollArea->viewport()->installEventFilter(
-            m_scrollEventFilter);
-
-        return scrollArea;
-    }
-
-    // Add terminal names and transportation mode indicators
-    for (int i = 0; i < terminals.size(); ++i)
-    {
-        // Extract terminal name from the snapshot
-        QString terminalName = terminals[i].displayName;
-        if (terminalName.isEmpty())
-        {
-            terminalName = tr("Terminal %1")
-                               .arg(i + 1); // Fallback name
-        }
-
-        // Add terminal name label
-        auto nameLabel = new QLabel(terminalName);
-        nameLabel->setAlignment(Qt::AlignCenter);
-        contentLayout->addWidget(nameLabel);
-
-        // Add transportation mode arrow for all but the
-        // last terminal
-        if (i < terminals.size() - 1 && i < segments.size())
-        {
-            auto modeLabel = new QLabel();
-            modeLabel->setAlignment(Qt::AlignCenter);
-
-            // Get transportation mode from the segment
-            Backend::TransportationTypes::TransportationMode
-                    mode = segments[i]->getMode();
-            QString modeText =
-                Backend::TransportationTypes::toString(
-                    mode);
-
-            // Create transportation mode pixmap
-            QPixmap modePixmap =
-                IconFactory::createTransportationModePixmap(
-                    modeText);
-
-            modeLabel->setPixmap(modePixmap);
-            modeLabel->setToolTip(
-                modeText); // Show mode name on hover
-            contentLayout->addWidget(modeLabel);
-        }
-    }
-
-    // Add stretch to ensure left alignment of path
-    // visualization
-    contentLayout->addStretch();
-
-    // Create and configure scroll area
-    auto scrollArea = new QScrollArea();
-    scrollArea->setWidgetResizable(true);
-    scrollArea->setHorizontalScrollBarPolicy(
-        Qt::ScrollBarAsNeeded);
-    scrollArea->setVerticalScrollBarPolicy(
-        Qt::ScrollBarAlwaysOff);
-    scrollArea->setFrameShape(
-        QFrame::NoFrame); // Hide the frame
-    scrollArea->setWidget(contentWidget);
-
-    return scrollArea;
-}
-
-/**
- * @brief Creates a transportation mode arrow pixmap
- * @param mode Transportation mode text
- * @return Pixmap containing the arrow and mode
- * visualization
- *
- * Generates a visual representation of a transportation
- * mode with appropriate coloring and labeling.
- */
-QPixmap ShortestPathsTable::createArrowPixmap(
-    const QString &mode) const
-{
-    // Create a pixmap for the arrow with the mode text
-    QPixmap pixmap(64, 40); // Fixed size for consistency
-    pixmap.fill(Qt::transparent); // Start with transparent
-                                  // background
-
-    QPainter painter(&pixmap);
-    painter.setRenderHint(
-        QPainter::Antialiasing); // Smooth rendering
-
-    // Set color based on transportation mode
-    QColor arrowColor = Qt::black; // Default color
-
-    // Choose color based on transportation mode
-    if (mode.contains("Truck", Qt::CaseInsensitive))
-    {
-        arrowColor =
-            QColor(Qt::magenta); // Magenta for truck
-    }
-    else if (mode.contains("Rail", Qt::CaseInsensitive)
-             || mode.contains("Train", Qt::CaseInsensitive))
-    {
-        arrowColor =
-            QColor(Qt::darkGray); // Dark gray for rail
-    }
-    else if (mode.contains("Ship", Qt::CaseInsensitive)
-             || mode.contains("Water", Qt::CaseInsensitive))
-    {
-        arrowColor = QColor(Qt::blue); // Blue for ship
-    }
-
-    // Draw the mode text
-    painter.setPen(arrowColor);
-    QFont font = painter.font();
-    font.setBold(true);
-    painter.setFont(font);
-    painter.drawText(QRect(0, 0, pixmap.width(), 15),
-                     Qt::AlignCenter, mode);
-
-    // Draw the arrow
-    QPen pen(arrowColor, 2); // 2 pixel width
-    painter.setPen(pen);
-
-    // Draw arrow shaft
-    painter.drawLine(10, 25, 54, 25);
-
-    // Draw arrow head
-    QPolygon arrowHead;
-    arrowHead << QPoint(48, 20) << QPoint(54, 25)
-              << QPoint(48, 30);
-    painter.setBrush(arrowColor);
-    painter.drawPolygon(arrowHead);
-
-    return pixmap;
-}
-
-/**
- * @brief Refreshes the table display with current path data
- *
- * Rebuilds the table contents based on the current state of
- * the PathData objects.
- */
-void ShortestPathsTable::refreshTable()
-{
-    qCDebug(lcGuiPathTable) << "ShortestPathsTable::refreshTable:"
-                            << "pathCount=" << m_pathData.size();
-    // Set flag to prevent recursive UI updates during
-    // refresh
-    m_updatingUI = true;
-
-    const QVector<ExecutionPathKey> checkedPathKeys =
-        getCheckedPathKeys();
-    QSet<ExecutionPathKey> checkedSet;
-    for (const auto &pathKey : checkedPathKeys)
-        checkedSet.insert(pathKey);
-
-    // Clear the table while preserving header
-    m_table->setRowCount(0);
-    // Plan 8.2: row indices are rebuilt below; reset the map.
-    m_rowByPathKey.clear();
-
-    // Add rows for each visible path
-    for (const auto &pathKey : std::as_const(m_displayOrder))
-    {
-        const PathData *pathData =
-            m_pathData.value(pathKey, nullptr);
-
-        // Skip paths marked as not visible
-        if (!pathData->isVisible || !pathData->path)
-        {
-            continue;
-        }
-
-        // Add a new row at the end of the table
-        int row = m_table->rowCount();
-        m_table->insertRow(row);
-        // Plan 8.2: remember row index for refreshRow updates.
-        m_rowByPathKey.insert(pathKey, row);
-
-        // Create checkbox widget for the select column
-        auto checkboxWidget = new QWidget();
-        auto checkboxLayout =
-            new QHBoxLayout(checkboxWidget);
-        checkboxLayout->setAlignment(Qt::AlignCenter);
-        checkboxLayout->setContentsMargins(0, 0, 0, 0);
-
-        auto checkbox = new QCheckBox();
-        checkboxLayout->addWidget(checkbox);
-        m_table->setCellWidget(row, ColumnSelect, checkboxWidget);
-        checkbox->setEnabled(isSelectable(pathData));
-        const QString rowTooltip = eligibilityTooltip(pathData);
-        checkbox->setToolTip(rowTooltip);
-        checkboxWidget->setToolTip(rowTooltip);
-
-        // Connect checkbox state change to update
-        // compare button state
-#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
-        // Qt 6.7+ version with checkStateChanged signal
-        connect(checkbox, &QCheckBox::checkStateChanged,
-                this, [this, pathKey](Qt::CheckState state) {
-                    // Emit signal that checkbox state changed
-                    emit checkboxChanged(pathKey, state == Qt::Checked);
-
-                    // Get all checked paths
-                    QVector<ExecutionPathKey> checkedPaths =
-                        getCheckedPathKeys();
-                    bool hasCheckedPaths =
-                        !checkedPaths.isEmpty();
-
-                           // Enable compare button if at least 1 path is checked
-                    m_compareButton->setEnabled(hasCheckedPaths);
-
-                           // Enable export button if there are any paths in the table (checked or not)
-                    m_exportButton->setEnabled(!m_pathData.isEmpty());
-
-                           // Update select/unselect buttons state
-                    m_unselectAllButton->setEnabled(hasCheckedPaths);
-
-                           // Enable select all button only if not all paths are already selected
-                    m_selectAllButton->setEnabled(
-                        selectablePathCount() > checkedPaths.size());
-                });
-#else
-      // Qt 6.4-6.6 version with stateChanged signal
-        connect(checkbox, &QCheckBox::stateChanged,
-                this, [this, pathKey](int state) {
-                    // Convert int to Qt::CheckState for consistency
-                    Qt::CheckState checkState = static_cast<Qt::CheckState>(state);
-
-                    // Emit signal that checkbox state changed
-                    emit checkboxChanged(pathKey,
-                                         checkState == Qt::Checked);
-
-                    // Get all checked paths
-                    QVector<ExecutionPathKey> checkedPaths =
-                        getCheckedPathKeys();
-                    bool hasCheckedPaths =
-                        !checkedPaths.isEmpty();
-
-                           // Enable compare button if at least 1 path is checked
-                    m_compareButton->setEnabled(hasCheckedPaths);
-
-                           // Enable export button if there are any paths in the table (checked or not)
-                    m_exportButton->setEnabled(!m_pathData.isEmpty());
-
-                           // Update select/unselect buttons state
-                    m_unselectAllButton->setEnabled(hasCheckedPaths);
-
-                           // Enable select all button only if not all paths are already selected
-                    m_selectAllButton->setEnabled(
-                        selectablePathCount() > checkedPaths.size());
-                });
-#endif
-
-        if (isSelectable(pathData)
-            && checkedSet.contains(pathKey))
-        {
-            checkbox->setChecked(true);
-        }
-
-        auto *statusItem = new QTableWidgetItem();
-        statusItem->setData(Qt::AccessibleTextRole,
-                            statusMessage(pathData->eligibility));
-        statusItem->setData(Qt::AccessibleDescriptionRole,
-                            rowTooltip);
-        statusItem->setToolTip(rowTooltip);
-        styleStatusItem(statusItem, pathData->eligibility);
-        m_table->setItem(row, ColumnStatus, statusItem);
-
-        // Add Path ID cell
-        auto pathItem = new QTableWidgetItem(
-            QString::number(pathData->path->getPathId()));
-        pathItem->setData(Qt::UserRole, pathKey);
-        pathItem->setToolTip(rowTooltip);
-        if (!isSelectable(pathData))
-            pathItem->setForeground(QBrush(Qt::gray));
-        m_table->setItem(row, ColumnPathId, pathItem);
-
-        // Create and add terminal path visualization
-        auto pathWidget = createPathRow(pathKey, pathData);
-        pathWidget->setToolTip(rowTooltip);
-        m_table->setCellWidget(row, ColumnTerminalPath, pathWidget);
-
-        // Store widget pointer in user role for custom
-        // delegate
-        QVariant widgetPtr;
-        widgetPtr.setValue(pathWidget);
-        m_table->model()->setData(
-            m_table->model()->index(row, ColumnTerminalPath), widgetPtr,
-            Qt::UserRole);
-
-        // Add Predicted Cost cell
-        QString predictedCostText;
-        if (pathData->path->getTotalPathCost() >= 0)
-        {
-            predictedCostText = QString::number(
-                pathData->path->getTotalPathCost(), 'f', 2);
-        }
-        else
-        {
-            predictedCostText = tr("Waiting analysis");
-        }
-        auto predictedItem =
-            new QTableWidgetItem(predictedCostText);
-        predictedItem->setToolTip(rowTooltip);
-        if (!isSelectable(pathData))
-            predictedItem->setForeground(QBrush(Qt::gray));
-        m_table->setItem(row, ColumnPredictedCost, predictedItem);
-
-        // Add Actual Cost cell
-        QString actualCostText;
-        if (pathData->hasSimulationTotalCost())
-        {
-            actualCostText = QString::number(
-                pathData->simulationTotalCost, 'f',
-                2);
-        }
-        else
-        {
-            actualCostText = tr("Waiting simulation");
-        }
-        auto actualItem =
-            new QTableWidgetItem(actualCostText);
-        actualItem->setToolTip(rowTooltip);
-        if (!isSelectable(pathData))
-            actualItem->setForeground(QBrush(Qt::gray));
-        m_table->setItem(row, ColumnActualCost, actualItem);
-
-        // Plan 8.2: populate per-vehicle metric columns.
-        refreshRow(pathKey);
-    }
-
-    // Clear UI update flag
-    m_updatingUI = false;
-
-    // Update button states
-    m_exportButton->setEnabled(!m_pathData.isEmpty());
-
-    // Update selection button states
-    m_selectAllButton->setEnabled(
-        selectablePathCount() > getCheckedPathKeys().size());
-    m_unselectAllButton->setEnabled(
-        !getCheckedPathKeys().isEmpty());
-    updateAvailabilityBanner();
-}
-
-/**
- * @brief Retrieves path data for a specific path ID
- * @param pathId The ID of the path to retrieve
+ * @brief Retrieves path data for a specific path key
+ * @param pathKey The execution path key of the path
  * @return Pointer to the path data or nullptr if not found
  */
 const ShortestPathsTable::PathData *
 ShortestPathsTable::getDataByPathKey(
     const ExecutionPathKey &pathKey) const
 {
-    // Look up the path in the map
-    auto it = m_pathData.find(pathKey);
-    if (it == m_pathData.end())
-    {
-        return nullptr; // Path not found
-    }
-
-    // Return pointer to the found path data
-    return it.value();
+    return m_model->record(pathKey);
 }
 
 const QList<const ShortestPathsTable::PathData *>
 ShortestPathsTable::getCheckedPathData() const
 {
     QList<const ShortestPathsTable::PathData *> result;
-    auto checkedPaths = getCheckedPathKeys();
-    if (checkedPaths.isEmpty())
-    {
-        return QList<const PathData *>();
-    }
-
-    for (const auto &pathKey : std::as_const(checkedPaths))
+    const auto checkedPaths = getCheckedPathKeys();
+    result.reserve(checkedPaths.size());
+    for (const auto &pathKey : checkedPaths)
     {
-        auto pathData = getDataByPathKey(pathKey);
-        if (pathData)
-        {
+        if (const auto *pathData = m_model->record(pathKey))
             result.append(pathData);
-        }
     }
-    result.removeAll(nullptr);
     return result;
 }
 
 /**
- * @brief Gets the currently selected path ID
- * @return The selected path ID or -1 if none selected
+ * @brief Gets the currently selected path key
+ * @return The selected path key or an empty string if none
+ * selected
  */
 ShortestPathsTable::ExecutionPathKey
 ShortestPathsTable::getSelectedPathKey() const
 {
-    // Get all selected items
-    QList<QTableWidgetItem *> selectedItems =
-        m_table->selectedItems();
-    if (selectedItems.isEmpty())
+    const QModelIndexList selectedRows =
+        m_table->selectionModel()->selectedRows();
+    if (selectedRows.isEmpty())
     {
         return QString(); // No selection
     }
 
-    // Get the row of the first selected item
-    int row = selectedItems.first()->row();
-
-    // Get the Path ID from column 1
-    auto idItem = m_table->item(row, ColumnPathId);
-    return idItem ? idItem->data(Qt::UserRole).toString()
-                  : QString();
+    // Every column carries the row's key, so the proxy index
+    // can be read directly without mapping it to the source.
+    return selectedRows.first()
+        .data(ShortestPathsModel::PathKeyRole)
+        .toString();
 }
 
 /**
- * @brief Gets all path IDs that are currently checked
- * @return Vector of checked path IDs
+ * @brief Gets all path keys that are currently checked
+ * @return Vector of checked path keys
  */
 QVector<ExecutionPathKey>
 ShortestPathsTable::getCheckedPathKeys() const
 {
-    QVector<ExecutionPathKey> checkedPaths;
-
-    // Iterate through all rows in the table
-    for (int row = 0; row < m_table->rowCount(); ++row)
-    {
-        // Get the checkbox widget in the first column
-        auto checkboxWidget = m_table->cellWidget(row, ColumnSelect);
-        if (!checkboxWidget)
-        {
-            continue; // Skip rows without checkbox widget
-        }
-
-        // Get the layout from the widget
-        auto layout = checkboxWidget->layout();
-        if (!layout)
-        {
-            continue; // Skip if no layout
-        }
-
-        // Get the checkbox from the layout
-        auto checkBox = qobject_cast<QCheckBox *>(
-            layout->itemAt(0)->widget());
-        if (checkBox && checkBox->isEnabled()
-            && checkBox->isChecked())
-        {
-            // If checkbox exists and is checked, add the
-            // path ID
-            auto idItem = m_table->item(row, ColumnPathId);
-            if (idItem)
-            {
-                checkedPaths.append(
-                    idItem->data(Qt::UserRole).toString());
-            }
-        }
-    }
-
-    return checkedPaths;
+    return m_model->checkedPathKeys();
 }
 
 /**
@@ -1732,22 +1031,9 @@ ShortestPathsTable::getCheckedPathKeys() const
  */
 void ShortestPathsTable::clear()
 {
-    // Clear all path data, which will delete the owned Path
-    // pointers
-    qDeleteAll(m_pathData);
-    m_pathData.clear();
-    m_displayOrder.clear();
-
-    // Clear the table
-    m_table->setRowCount(0);
-
-    // Disable buttons that require paths
-    m_compareButton->setEnabled(false);
-    m_exportButton->setEnabled(false);
-    m_predicted.clear();
-    m_actual.clear();
-    m_progressByPathKey.clear();
-    m_rowByPathKey.clear();
+    m_model->clear();
+    m_reportExporter->clearCache();
+    updateButtonStates();
     updateAvailabilityBanner();
 }
 
@@ -1758,30 +1044,20 @@ QList<QJsonObject> ShortestPathsTable::buildComparisonSnapshots(
     auto &ctl = CargoNetSim::CargoNetSimController::getInstance();
     costWeights = ctl.getCostFunctionWeights();
 
-    const QVector<ExecutionPathKey> checkedPathKeys =
-        getCheckedPathKeys();
-    QSet<ExecutionPathKey> checkedSet;
-    for (const auto &pathKey : checkedPathKeys)
-        checkedSet.insert(pathKey);
-
     QList<Backend::Application::PathPresentationRecord>
         records;
-    records.reserve(m_displayOrder.size());
-    for (const auto &pathKey : std::as_const(m_displayOrder))
+    records.reserve(static_cast<qsizetype>(m_model->records().size()));
+    for (const auto &pathData : m_model->records())
     {
-        const PathData *pathData =
-            m_pathData.value(pathKey, nullptr);
-        if (!pathData || !pathData->path)
+        if (!pathData->path)
             continue;
 
         Backend::Application::PathPresentationRecord
             record = *pathData;
         record.executionPathKey = pathData->pathKey;
-        record.pathKey = pathData->pathKey;
-        record.isSelected =
-            checkedSet.contains(pathKey);
-        record.predictedMetrics = m_predicted.value(pathKey);
-        record.actualMetrics = m_actual.value(pathKey);
+        record.isSelected = pathData->isVisible
+                            && pathData->isSelected
+                            && pathData->eligibility.selectable;
         records.append(std::move(record));
     }
 
@@ -1794,47 +1070,32 @@ void ShortestPathsTable::loadComparisonSnapshots(
 {
     clear();
 
-    QSet<ExecutionPathKey> selectedPathKeys;
-    const auto records =
+    auto records =
         Backend::Application::PathPresentationService()
             .loadComparisonSnapshots(snapshots);
-    for (const auto &record : records)
-    {
-        if (!record.path)
-            continue;
+    records.removeIf(
+        [](const PathData &record) { return !record.path; });
 
-        const ExecutionPathKey storedKey =
-            appendPathRecord(record);
-        if (record.isSelected)
-            selectedPathKeys.insert(storedKey);
+    // Checks are re-applied through the model so they only stick
+    // on selectable rows and reach checkboxChanged listeners.
+    QList<bool> wasSelected;
+    wasSelected.reserve(records.size());
+    for (auto &record : records)
+    {
+        wasSelected.append(record.isSelected);
+        record.isSelected = false;
     }
-    logPredictedPathDiagnostics(m_pathData, m_displayOrder,
-                                QStringLiteral("loadComparisonSnapshots"));
 
-    refreshTable();
-    m_exportButton->setEnabled(!m_pathData.isEmpty());
-    m_selectAllButton->setEnabled(!m_pathData.isEmpty());
+    const QVector<ExecutionPathKey> storedKeys = appendRecords(
+        std::move(records), QStringLiteral("loadComparisonSnapshots"));
 
-    for (int row = 0; row < m_table->rowCount(); ++row)
+    QSet<ExecutionPathKey> selectedPathKeys;
+    for (int i = 0; i < storedKeys.size(); ++i)
     {
-        auto *idItem = m_table->item(row, ColumnPathId);
-        if (!idItem)
-            continue;
-        const QString pathKey =
-            idItem->data(Qt::UserRole).toString();
-        if (!selectedPathKeys.contains(pathKey))
-            continue;
-        auto *checkboxWidget = m_table->cellWidget(row, ColumnSelect);
-        if (!checkboxWidget || !checkboxWidget->layout())
-            continue;
-        auto *checkBox = qobject_cast<QCheckBox *>(
-            checkboxWidget->layout()->itemAt(0)->widget());
-        if (checkBox)
-            checkBox->setChecked(true);
+        if (wasSelected[i] && !storedKeys[i].isEmpty())
+            selectedPathKeys.insert(storedKeys[i]);
     }
-
-    m_compareButton->setEnabled(!selectedPathKeys.isEmpty());
-    m_unselectAllButton->setEnabled(!selectedPathKeys.isEmpty());
+    m_model->setChecked(selectedPathKeys, true);
 }
 
 /**
@@ -1845,12 +1106,6 @@ void ShortestPathsTable::loadComparisonSnapshots(
  */
 void ShortestPathsTable::onSelectionChanged()
 {
-    // Ignore selection changes during UI updates
-    if (m_updatingUI)
-    {
-        return;
-    }
-
     // Get the currently selected path ID
     const ExecutionPathKey pathKey = getSelectedPathKey();
     qCDebug(lcGuiPathTable) << "ShortestPathsTable::onSelectionChanged:"
@@ -1858,7 +1113,7 @@ void ShortestPathsTable::onSelectionChanged()
 
     // Enable export button if either a path is selected or
     // any path is checked
-    bool hasCheckedPaths = !getCheckedPathKeys().isEmpty();
+    const bool hasCheckedPaths = m_model->checkedCount() > 0;
     m_exportButton->setEnabled(!pathKey.isEmpty()
                                || hasCheckedPaths);
 
@@ -1870,18 +1125,20 @@ void ShortestPathsTable::onSelectionChanged()
 }
 
 /**
- * @brief Slot called when an item's checked state changes
- * @param row The row of the changed item
- * @param column The column of the changed item
+ * @brief Slot called when check states change in the model
+ * @param pathKeys Keys of the paths whose check state changed
+ * @param checked The new check state
  *
- * Note: This slot is not directly connected but is provided
- * for completeness and potential future use.
+ * Forwards each change to checkboxChanged listeners and
+ * refreshes the button states once.
  */
-void ShortestPathsTable::onItemCheckedChanged(int row,
-                                              int column)
+void ShortestPathsTable::onCheckStateChanged(
+    const QVector<ExecutionPathKey> &pathKeys, bool checked)
 {
-    // This functionality is handled by the checkbox state
-    // change connections established during table refresh
+    for (const auto &pathKey : pathKeys)
+        emit checkboxChanged(pathKey, checked);
+
+    updateButtonStates();
 }
 
 /**
@@ -1969,101 +1226,22 @@ void ShortestPathsTable::onExportAllButtonClicked()
 /**
  * @brief Slot called when the select all button is clicked
  *
- * Checks all checkboxes in the table.
+ * Checks every selectable path in one model update.
  */
 void ShortestPathsTable::onSelectAllButtonClicked()
 {
-    // Set flag to prevent recursive UI updates
-    m_updatingUI = true;
-
-    // Iterate through all rows in the table
-    for (int row = 0; row < m_table->rowCount(); ++row)
-    {
-        // Get the checkbox widget in the first column
-        auto checkboxWidget = m_table->cellWidget(row, ColumnSelect);
-        if (!checkboxWidget)
-        {
-            continue; // Skip rows without checkbox widget
-        }
-
-        // Get the layout from the widget
-        auto layout = checkboxWidget->layout();
-        if (!layout)
-        {
-            continue; // Skip if no layout
-        }
-
-        // Get the checkbox from the layout
-        auto checkBox = qobject_cast<QCheckBox *>(
-            layout->itemAt(0)->widget());
-        if (checkBox && checkBox->isEnabled())
-        {
-            // Check the checkbox
-            checkBox->setChecked(true);
-        }
-    }
-
-    // Clear UI update flag
-    m_updatingUI = false;
-
-    // Enable compare button if paths are checked
-    m_compareButton->setEnabled(
-        !getCheckedPathKeys().isEmpty());
-
-    // Enable/disable selection buttons based on state
-    m_selectAllButton->setEnabled(
-        selectablePathCount() > getCheckedPathKeys().size());
-    m_unselectAllButton->setEnabled(
-        !getCheckedPathKeys().isEmpty());
+    m_model->setAllChecked(true);
 }
 
 /**
  * @brief Slot called when the unselect all button is
  * clicked
  *
- * Unchecks all checkboxes in the table.
+ * Unchecks every path in one model update.
  */
 void ShortestPathsTable::onUnselectAllButtonClicked()
 {
-    // Set flag to prevent recursive UI updates
-    m_updatingUI = true;
-
-    // Iterate through all rows in the table
-    for (int row = 0; row < m_table->rowCount(); ++row)
-    {
-        // Get the checkbox widget in the first column
-        auto checkboxWidget = m_table->cellWidget(row, ColumnSelect);
-        if (!checkboxWidget)
-        {
-            continue; // Skip rows without checkbox widget
-        }
-
-        // Get the layout from the widget
-        auto layout = checkboxWidget->layout();
-        if (!layout)
-        {
-            continue; // Skip if no layout
-        }
-
-        // Get the checkbox from the layout
-        auto checkBox = qobject_cast<QCheckBox *>(
-            layout->itemAt(0)->widget());
-        if (checkBox)
-        {
-            // Uncheck the checkbox
-            checkBox->setChecked(false);
-        }
-    }
-
-    // Clear UI update flag
-    m_updatingUI = false;
-
-    // Disable compare button as no paths are checked
-    m_compareButton->setEnabled(false);
-
-    // Enable/disable selection buttons based on state
-    m_selectAllButton->setEnabled(selectablePathCount() > 0);
-    m_unselectAllButton->setEnabled(false);
+    m_model->setAllChecked(false);
 }
 
 void ShortestPathsTable::exportPathsToPdf(
@@ -2077,13 +1255,11 @@ void ShortestPathsTable::exportPathsToPdf(
     if (pathKeys.isEmpty())
     {
         // If no IDs specified, export all visible paths
-        for (const auto &pathKey : std::as_const(m_displayOrder))
+        for (const auto &pathData : m_model->records())
         {
-            const auto *pathData =
-                m_pathData.value(pathKey, nullptr);
-            if (pathData && pathData->isVisible)
+            if (pathData->isVisible)
             {
-                pathsToExport.append(pathData);
+                pathsToExport.append(pathData.get());
             }
         }
     }
@@ -2092,11 +1268,10 @@ void ShortestPathsTable::exportPathsToPdf(
         // Export only the specified paths
         for (const auto &pathKey : pathKeys)
         {
-            auto it = m_pathData.find(pathKey);
-            if (it != m_pathData.end()
-                && it.value()->isVisible)
+            const auto *pathData = m_model->record(pathKey);
+            if (pathData && pathData->isVisible)
             {
-                pathsToExport.append(it.value());
+                pathsToExport.append(pathData);
             }
         }
     }
@@ -2122,9 +1297,6 @@ void ShortestPathsTable::exportPathsToPdf(
         defaultFilename = tr("paths_report.pdf");
     }
 
-    // Create exporter
-    PathReportExporter exporter;
-
     // Ask user if they want to preview or directly export
     QMessageBox msgBox(this);
     msgBox.setWindowTitle(tr("Export PDF Report"));
@@ -2142,16 +1314,17 @@ void ShortestPathsTable::exportPathsToPdf(
     if (msgBox.clickedButton() == previewButton)
     {
         // Show preview dialog
-        exporter.previewReport(pathsToExport, this);
+        m_reportExporter->previewReport(pathsToExport, this);
     }
     else if (msgBox.clickedButton() == exportButton)
     {
         // Show file dialog and export
-        exporter.exportPathsWithDialog(pathsToExport, this,
-                                       defaultFilename);
+        m_reportExporter->exportPathsWithDialog(
+            pathsToExport, this, defaultFilename);
     }
 }
 
+
 // ---------------------------------------------------------------
 // Plan 8.2: per-path predicted/actual metric column support.
 // ---------------------------------------------------------------
@@ -2159,292 +1332,24 @@ void ShortestPathsTable::exportPathsToPdf(
 void ShortestPathsTable::setActualMetrics(
     const QHash<ExecutionPathKey, Backend::Scenario::PathMetrics> &actual)
 {
-    for (auto it = actual.constBegin();
-         it != actual.constEnd(); ++it)
-    {
-        m_actual.insert(it.key(), it.value());
-        if (auto *pathData = m_pathData.value(it.key(), nullptr))
-            pathData->actualMetrics = it.value();
-        refreshRow(it.key());
-    }
+    m_model->setActualMetrics(actual);
 }
 
 void ShortestPathsTable::setExecutionResults(
     const Backend::Scenario::ScenarioExecutionResultSet &results)
 {
-    for (const auto &result : results.pathResults())
-    {
-        PathData *pathData =
-            m_pathData.value(result.executionPathKey, nullptr);
-        if (!pathData && !result.canonicalPathKey.isEmpty())
-        {
-            pathData = m_pathData.value(result.canonicalPathKey, nullptr);
-        }
-        if (!pathData)
-        {
-            qCWarning(lcGuiPathTable)
-                << "Path key" << result.executionPathKey
-                << "not found for execution result update";
-            continue;
-        }
-
-        pathData->executionResult = result;
-        updateSimulationCosts(pathData->pathKey,
-                              result.totalCost,
-                              result.edgeCosts,
-                              result.terminalCosts);
-    }
+    m_model->setExecutionResults(results);
 }
 
 void ShortestPathsTable::setExecutionProgress(
     const Backend::Scenario::ExecutionProgressSnapshot &snapshot)
 {
-    m_progressByPathKey.clear();
-
-    for (const auto &progress : snapshot.paths)
-    {
-        ExecutionPathKey pathKey;
-        if (m_pathData.contains(progress.executionPathKey))
-        {
-            pathKey = progress.executionPathKey;
-        }
-        else if (!progress.canonicalPathKey.isEmpty()
-                 && m_pathData.contains(progress.canonicalPathKey))
-        {
-            pathKey = progress.canonicalPathKey;
-        }
-
-        if (pathKey.isEmpty())
-        {
-            qCDebug(lcGuiPathTable)
-                << "Ignoring execution progress for unknown path"
-                << progress.executionPathKey
-                << "canonicalPathKey=" << progress.canonicalPathKey;
-            continue;
-        }
-
-        m_progressByPathKey.insert(pathKey, progress);
-    }
-
-    for (const auto &pathKey : std::as_const(m_displayOrder))
-        refreshProgressCell(pathKey);
+    m_model->setExecutionProgress(snapshot);
 }
 
 void ShortestPathsTable::clearExecutionProgress()
 {
-    if (m_progressByPathKey.isEmpty())
-        return;
-
-    m_progressByPathKey.clear();
-    for (const auto &pathKey : std::as_const(m_displayOrder))
-        refreshProgressCell(pathKey);
-}
-
-ShortestPathsTable::ExecutionPathKey
-ShortestPathsTable::appendPathRecord(PathData record)
-{
-    if (!record.path)
-    {
-        qCWarning(lcGuiPathTable)
-            << "Skipping null path presentation record";
-        return {};
-    }
-
-    const ExecutionPathKey preferredKey =
-        record.executionPathKey.isEmpty()
-            ? record.path->canonicalPathKey().isEmpty()
-                  ? QStringLiteral("path_id|%1")
-                        .arg(record.path->getPathId())
-                  : record.path->canonicalPathKey()
-            : record.executionPathKey;
-    const ExecutionPathKey resolvedKey =
-        makeUniquePathKey(preferredKey, m_pathData);
-
-    record.executionPathKey = resolvedKey;
-    record.pathKey = resolvedKey;
-
-    m_predicted.insert(resolvedKey, record.predictedMetrics);
-    m_actual.insert(resolvedKey, record.actualMetrics);
-
-    auto *pathData = new PathData(std::move(record));
-    m_pathData.insert(resolvedKey, pathData);
-    m_displayOrder.append(resolvedKey);
-
-    if (resolvedKey != preferredKey)
-    {
-        qCWarning(lcGuiPathTable)
-            << "Execution path key collision detected;"
-            << "using compatibility key" << resolvedKey
-            << "for preferred execution path key" << preferredKey;
-    }
-
-    return resolvedKey;
-}
-
-void ShortestPathsTable::refreshProgressCell(
-    const ExecutionPathKey &pathKey)
-{
-    const int row = m_rowByPathKey.value(pathKey, -1);
-    if (row < 0)
-        return;
-
-    auto *progressBar = qobject_cast<QProgressBar *>(
-        m_table->cellWidget(row, ColumnExecutionProgress));
-    if (!progressBar)
-    {
-        progressBar = new QProgressBar(m_table);
-        progressBar->setRange(0, 100);
-        progressBar->setTextVisible(true);
-        progressBar->setAlignment(Qt::AlignCenter);
-        m_table->setCellWidget(row, ColumnExecutionProgress,
-                               progressBar);
-    }
-
-    const auto it = m_progressByPathKey.constFind(pathKey);
-    if (it == m_progressByPathKey.constEnd())
-    {
-        progressBar->setValue(0);
-        progressBar->setFormat(tr("Waiting simulation"));
-        progressBar->setToolTip(
-            tr("No execution progress has been reported for this path yet."));
-        progressBar->setEnabled(false);
-        return;
-    }
-
-    const auto &progress = it.value();
-    progressBar->setEnabled(progress.executable);
-    progressBar->setValue(qBound(0, qRound(progress.percent), 100));
-
-    QString phase = pathLifecycleLabel(progress.lifecycle);
-    if (const auto *activeSegment = activeSegmentFor(progress))
-    {
-        phase = segmentLifecycleLabel(activeSegment->lifecycle);
-    }
-
-    QString summary = phase;
-    if (progress.activeSegmentIndex >= 0
-        && progress.totalSegments > 0)
-    {
-        summary = tr("%1 seg %2/%3 %4")
-                      .arg(modeLabel(progress.activeMode))
-                      .arg(progress.activeSegmentIndex + 1)
-                      .arg(progress.totalSegments)
-                      .arg(phase);
-    }
-    else if (!progress.message.isEmpty())
-    {
-        summary = progress.message;
-    }
-
-    progressBar->setFormat(QStringLiteral("%p%  %1").arg(summary));
-
-    QStringList tooltip;
-    tooltip << tr("Path progress: %1%")
-                   .arg(progress.percent, 0, 'f', 1)
-            << tr("Path state: %1")
-                   .arg(pathLifecycleLabel(progress.lifecycle));
-    if (progress.activeSegmentIndex >= 0)
-    {
-        tooltip << tr("Active segment: %1 of %2")
-                       .arg(progress.activeSegmentIndex + 1)
-                       .arg(progress.totalSegments)
-                << tr("Mode: %1").arg(modeLabel(progress.activeMode))
-                << tr("Network: %1").arg(progress.activeNetworkName)
-                << tr("From: %1").arg(progress.activeStartTerminalId)
-                << tr("To: %1").arg(progress.activeEndTerminalId);
-    }
-    if (!progress.message.isEmpty())
-        tooltip << tr("Message: %1").arg(progress.message);
-
-    if (!progress.segments.isEmpty())
-    {
-        tooltip << tr("Segments:");
-        for (const auto &segment : progress.segments)
-        {
-            tooltip << tr("%1. %2 %3 -> %4: %5 (%6%)")
-                           .arg(segment.segmentIndex + 1)
-                           .arg(modeLabel(segment.mode))
-                           .arg(segment.startTerminalId,
-                                segment.endTerminalId,
-                                segmentLifecycleLabel(
-                                    segment.lifecycle))
-                           .arg(segment.percent, 0, 'f', 1);
-        }
-    }
-
-    progressBar->setToolTip(tooltip.join(QLatin1Char('\n')));
-}
-
-void ShortestPathsTable::refreshRow(
-    const ExecutionPathKey &pathKey)
-{
-    const int row = m_rowByPathKey.value(pathKey, -1);
-    if (row < 0)
-        return;
-
-    auto          fmt  = [](double v) {
-        return QString::number(v, 'f', 2);
-    };
-    const QString dash = QStringLiteral("—");
-    auto          cell = [&](bool valid, double v) {
-        return new QTableWidgetItem(valid ? fmt(v) : dash);
-    };
-
-    const auto &p = m_predicted.value(pathKey);
-    const auto &a = m_actual.value(pathKey);
-
-    refreshProgressCell(pathKey);
-
-    // Predicted per-vehicle.
-    m_table->setItem(row, ColumnPredictedDistance,
-                     cell(p.valid, p.distanceKm));
-    m_table->setItem(row, ColumnPredictedTime,
-                     cell(p.valid, p.travelTimeHours));
-    m_table->setItem(row, ColumnPredictedFuelPerVehicle,
-                     cell(p.valid, p.fuelPerVehicle));
-    m_table->setItem(row, ColumnPredictedEnergyPerVehicle,
-                     cell(p.valid, p.energyPerVehicle));
-    m_table->setItem(row, ColumnPredictedCarbonPerVehicle,
-                     cell(p.valid, p.carbonPerVehicle));
-    m_table->setItem(row, ColumnPredictedRiskPerVehicle,
-                     cell(p.valid, p.riskPerVehicle));
-
-    // Actual per-vehicle; no fuel column, see createTableWidget note.
-    m_table->setItem(row, ColumnActualDistance,
-                     cell(a.valid, a.distanceKm));
-    m_table->setItem(row, ColumnActualTime,
-                     cell(a.valid, a.travelTimeHours));
-    m_table->setItem(row, ColumnActualEnergyPerVehicle,
-                     cell(a.valid, a.energyPerVehicle));
-    m_table->setItem(row, ColumnActualCarbonPerVehicle,
-                     cell(a.valid, a.carbonPerVehicle));
-    m_table->setItem(row, ColumnActualRiskPerVehicle,
-                     cell(a.valid, a.riskPerVehicle));
-
-    // Preview-demand counts and per-container metrics.
-    m_table->setItem(row, ColumnContainers, new QTableWidgetItem(
-        p.valid ? QString::number(p.containerCount) : dash));
-    auto *vehicleItem = new QTableWidgetItem(
-        p.valid ? vehicleBreakdownLabel(p) : dash);
-    if (p.valid && !p.previewVehicleBreakdown.isEmpty())
-    {
-        vehicleItem->setToolTip(
-            tr("Per-segment preview vehicle requirements for the path: %1")
-                .arg(vehicleBreakdownLabel(p)));
-    }
-    m_table->setItem(row, ColumnVehicles, vehicleItem);
-
-    m_table->setItem(row, ColumnPredictedFuelPerContainer,
-                     cell(p.valid, p.fuelPerContainer));
-    m_table->setItem(row, ColumnPredictedEnergyPerContainer,
-                     cell(p.valid, p.energyPerContainer));
-    m_table->setItem(row, ColumnPredictedCarbonPerContainer,
-                     cell(p.valid, p.carbonPerContainer));
-
-    m_table->setItem(row, ColumnActualEnergyPerContainer,
-                     cell(a.valid, a.energyPerContainer));
-    m_table->setItem(row, ColumnActualCarbonPerContainer,
-                     cell(a.valid, a.carbonPerContainer));
+    m_model->clearExecutionProgress();
 }
 
 } // namespace GUI
@@ -15,22 +15,19 @@
 #pragma once
 #include "Backend/Application/PathPresentationService.h"
 #include "Backend/GuiApi/ScenarioContractsApi.h"
-#include <QBrush>
-#include <QCheckBox>
+#include "GUI/Widgets/ShortestPathsModel.h"
 #include <QHBoxLayout>
 #include <QHash>
 #include <QHeaderView>
 #include <QLabel>
-#include <QMap>
-#include <QPainterPath>
+#include <QLineEdit>
+#include <QPixmap>
 #include <QPushButton>
 #include <QStyledItemDelegate>
-#include <QTableWidget>
+#include <QTableView>
 #include <QVBoxLayout>
 #include <QVector>
 #include <QWidget>
-#include <QtCore/qcoreevent.h>
-#include <QtGui/qevent.h>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -50,18 +47,25 @@ class ScenarioExecutionResultSet;
 namespace GUI
 {
 
+class PathReportExporter;
+
 /**
  * @class TerminalPathDelegate
  * @brief Custom delegate for rendering complex terminal
  * path visualizations in table cells
  *
- * This delegate class provides specialized rendering for
- * the terminal path column in the ShortestPathsTable,
- * allowing rich visual representations of paths including
- * terminals and transportation modes between them.
+ * This delegate paints the terminal path column of the
+ * ShortestPathsTable straight from the row's record: a
+ * "show on map" eye, the terminal names and a transport
+ * mode arrow between each pair. It also draws the
+ * execution progress column as a progress bar. Nothing is
+ * backed by a widget, so only the rows on screen cost
+ * anything to draw.
  */
 class TerminalPathDelegate : public QStyledItemDelegate
 {
+    Q_OBJECT
+
 public:
     /**
      * @brief Constructs a TerminalPathDelegate instance
@@ -78,9 +82,9 @@ public:
      * @param option The style options for the item
      * @param index The model index of the item to render
      *
-     * Overrides the default painting behavior to display a
-     * custom widget stored in the item's UserRole data if
-     * available.
+     * Paints the terminal path and progress columns from
+     * ShortestPathsModel roles and falls back to the
+     * standard rendering for every other column.
      */
     void paint(QPainter                   *painter,
                const QStyleOptionViewItem &option,
@@ -93,12 +97,28 @@ public:
      * @param index The model index of the item
      * @return The preferred size for the item
      *
-     * Returns the size of the custom widget if available,
-     * otherwise defaults to the standard item delegate
-     * size.
+     * Measures the terminal sequence with the cell font;
+     * other columns use the standard size hint.
      */
     QSize sizeHint(const QStyleOptionViewItem &option,
                    const QModelIndex &index) const override;
+
+signals:
+    /// The eye button of the row for @p pathKey was clicked.
+    void showPathRequested(const QString &pathKey);
+
+protected:
+    bool editorEvent(QEvent *event, QAbstractItemModel *model,
+                     const QStyleOptionViewItem &option,
+                     const QModelIndex          &index) override;
+
+private:
+    QRect          eyeRect(const QRect &cellRect) const;
+    const QPixmap &modePixmap(const QString &mode) const;
+
+    /// Mode arrows are identical for every row; render each once.
+    mutable QHash<QString, QPixmap> m_modePixmaps;
+    mutable QPixmap                 m_eyePixmap;
 };
 
 /**
@@ -171,7 +191,8 @@ public:
         const QHash<ExecutionPathKey, Backend::Scenario::PreparedPathEligibility>
             &eligibility);
 
-    /// Post-run update. Calls refreshRow for each execution path key present.
+    /// Post-run update of the actual-metric columns, batched per
+    /// contiguous run of rows.
     void setActualMetrics(
         const QHash<ExecutionPathKey, Backend::Scenario::PathMetrics> &actual);
 
@@ -364,15 +385,17 @@ private slots:
     void onSelectionChanged();
 
     /**
-     * @brief Slot called when an item's checked state
-     * changes
-     * @param row The row of the changed item
-     * @param column The column of the changed item
+     * @brief Slot called when the model's check states
+     * change
+     * @param pathKeys Execution path keys whose check state
+     * changed
+     * @param checked New check state of those paths
      *
-     * Updates the UI state when a checkbox is toggled in
-     * the table.
+     * Emits checkboxChanged per path and updates the button
+     * states once for the whole batch.
      */
-    void onItemCheckedChanged(int row, int column);
+    void onCheckStateChanged(
+        const QVector<ExecutionPathKey> &pathKeys, bool checked);
 
     /**
      * @brief Slot called when the compare button is clicked
@@ -412,52 +435,21 @@ private slots:
         const QVector<ExecutionPathKey> &pathKeys);
 
 private:
-    class PathScrollEventFilter : public QObject
-    {
-    protected:
-        bool eventFilter(QObject *watched,
-                         QEvent  *event) override
-        {
-            if (event->type() == QEvent::Wheel)
-            {
-                // Convert to wheel event
-                QWheelEvent *wheelEvent =
-                    static_cast<QWheelEvent *>(event);
-
-                // Check if shift is pressed or if this is a
-                // horizontal wheel event
-                if (wheelEvent->modifiers()
-                        & Qt::ShiftModifier
-                    || wheelEvent->angleDelta().x() != 0)
-                {
-                    // Let the scroll area handle horizontal
-                    // scrolling
-                    return false;
-                }
-
-                // Ignore vertical wheel events to allow the
-                // table to scroll
-                return true;
-            }
-
-            return QObject::eventFilter(watched, event);
-        }
-    };
-
     /**
      * @brief Initializes the UI components
      *
      * Sets up the layout and creates all UI components
-     * needed for the table, including the table widget and
+     * needed for the table, including the table view and
      * control buttons.
      */
     void initUI();
 
     /**
-     * @brief Creates and configures the table widget
+     * @brief Creates and configures the table view
      *
-     * Initializes the QTableWidget with appropriate
-     * columns, headers, and delegate for custom rendering.
+     * Wires the view to the path model through the sort and
+     * filter proxy, sets column sizing and installs the
+     * delegate for custom rendering.
      */
     void createTableWidget();
 
@@ -476,76 +468,54 @@ private:
      * both for individual paths and for all paths.
      */
     void createExportPanel();
-    bool isSelectable(const PathData *pathData) const;
-    int  selectablePathCount() const;
-    QString eligibilityTooltip(const PathData *pathData) const;
     QString availabilityBannerText() const;
     void updateAvailabilityBanner();
 
     /**
-     * @brief Refreshes the table display with current path
-     * data
+     * @brief Appends presentation records to the model
+     * @param records Records to append, in display order
+     * @param source Label for the diagnostics log
+     * @return The stored execution path keys, in input order
      *
-     * Updates the table view to reflect the current state
-     * of path data, applying visibility filters and
-     * formatting as needed.
+     * Inserts every record in one model transaction, sizes
+     * the columns once and refreshes the button states.
      */
-    void refreshTable();
+    QVector<ExecutionPathKey> appendRecords(
+        QList<PathData> records, const QString &source);
 
-    /**
-     * @brief Creates a widget containing the terminal path
-     * visualization
-     * @param pathKey Stable backend-derived execution path key
-     * @param pathData The PathData object containing path
-     * details
-     * @return A widget representing the path with terminals
-     * and transportation modes
-     *
-     * Generates a custom widget for visualizing a path,
-     * including terminals, transportation modes, and a
-     * button to show the path on a map.
-     */
-    QWidget *createPathRow(const ExecutionPathKey &pathKey,
-                           const PathData     *pathData);
+    /// Enable/disable the selection, compare and export buttons.
+    void updateButtonStates();
 
     /**
-     * @brief Creates an arrow pixmap with a label for a
-     * transportation mode
-     * @param mode The transportation mode to represent
-     * @return A pixmap containing an arrow and the mode
-     * label
+     * @brief Sizes the content-driven columns from a sample
+     * of rows
      *
-     * Generates a visual representation of a transportation
-     * mode, color-coded and labeled for clear
-     * identification.
+     * ResizeToContents would measure every row on each
+     * change; the view instead measures a bounded number of
+     * rows once after a load and leaves the columns
+     * interactive.
      */
-    QPixmap createArrowPixmap(const QString &mode) const;
-
-    // Function to handle the showPath signal and flash path
-    // map lines
-    void flashPathMapLines(const ExecutionPathKey &pathKey);
+    void resizeColumnsToSample();
 
     void createSelectionPanel();
 
     /**
-     * @brief Table widget for displaying path data
+     * @brief Table view for displaying path data
      *
      * The main UI component that shows paths, their
      * terminals, transportation modes, and associated
-     * costs.
+     * costs. Rows are rendered lazily from m_model.
      */
-    QTableWidget *m_table;
-    QLabel       *m_availabilityBanner = nullptr;
+    QTableView *m_table;
+    QLineEdit  *m_filterEdit         = nullptr;
+    QLabel     *m_availabilityBanner = nullptr;
 
     /**
-     * @brief Storage for path data indexed by stable execution path key
-     *
-     * Maps execution path keys to their corresponding PathData
-     * objects, allowing efficient lookup and update
-     * operations.
+     * @brief Storage for path data keyed by stable execution
+     * path key, in display order
      */
-    QMap<ExecutionPathKey, PathData *> m_pathData;
-    QVector<ExecutionPathKey>          m_displayOrder;
+    ShortestPathsModel       *m_model;
+    ShortestPathsFilterModel *m_proxy;
 
     /**
      * @brief Button to compare selected paths
@@ -563,33 +533,14 @@ private:
      */
     QPushButton *m_exportButton;
 
-    /**
-     * @brief Flag to prevent recursive UI updates
-     *
-     * Used to avoid infinite loops when updating the UI in
-     * response to events that could trigger further
-     * updates.
-     */
-    bool m_updatingUI;
-
     QPushButton *m_selectAllButton;
     QPushButton *m_unselectAllButton;
 
-    PathScrollEventFilter *m_scrollEventFilter;
-
-    /// Plan 8.2/A2: per-path predicted/actual metrics and row mapping
-    /// keyed by backend execution path key rather than local path_id.
-    QHash<ExecutionPathKey, Backend::Scenario::PathMetrics> m_predicted;
-    QHash<ExecutionPathKey, Backend::Scenario::PathMetrics> m_actual;
-    QHash<ExecutionPathKey, Backend::Scenario::PathProgressSnapshot>
-        m_progressByPathKey;
-    QHash<ExecutionPathKey /*pathKey*/, int /*row*/>        m_rowByPathKey;
-
-    ExecutionPathKey appendPathRecord(PathData record);
-
-    /// Plan 8.2/A2: rewrite metric columns for a given canonical path.
-    void refreshRow(const ExecutionPathKey &pathKey);
-    void refreshProgressCell(const ExecutionPathKey &pathKey);
+    /**
+     * @brief Report exporter kept across export requests so a
+     * previewed report is reused when it is saved
+     */
+    PathReportExporter *m_reportExporter;
 };
 
 } // namespace GUI
@@ -0,0 +1,1108 @@
+/**
+ * @file ShortestPathsModel.cpp
+ * @brief Implementation of the ShortestPathsModel item model
+ */
+
+#include "ShortestPathsModel.h"
+
+#include "Backend/Commons/LogCategories.h"
+#include "GUI/Utils/IconCreator.h"
+
+#include <QBrush>
+#include <QColor>
+#include <QFont>
+#include <QIcon>
+
+#include <algorithm>
+#include <limits>
+
+namespace CargoNetSim
+{
+namespace GUI
+{
+
+namespace
+{
+
+using ExecutionPathKey = ShortestPathsModel::ExecutionPathKey;
+using PathData         = ShortestPathsModel::PathData;
+
+ExecutionPathKey makeUniquePathKey(
+    const ExecutionPathKey             &baseKey,
+    const QHash<ExecutionPathKey, int> &existing)
+{
+    const QString normalizedBase =
+        baseKey.isEmpty() ? QStringLiteral("path") : baseKey;
+    QString candidate = normalizedBase;
+    int     suffix    = 2;
+    while (existing.contains(candidate))
+    {
+        candidate = QStringLiteral("%1#%2")
+                        .arg(normalizedBase)
+                        .arg(suffix++);
+    }
+    return candidate;
+}
+
+QString vehicleBreakdownLabel(
+    const Backend::Scenario::PathMetrics &metrics)
+{
+    if (metrics.previewVehicleBreakdown.isEmpty())
+    {
+        return metrics.valid
+            ? QString::number(metrics.vehiclesNeeded)
+            : QStringLiteral("—");
+    }
+
+    QStringList parts;
+    parts.reserve(metrics.previewVehicleBreakdown.size());
+    for (const auto &requirement : metrics.previewVehicleBreakdown)
+    {
+        parts.append(QStringLiteral("%1 x%2")
+                         .arg(Backend::TransportationTypes::toString(
+                             requirement.mode))
+                         .arg(requirement.vehiclesNeeded));
+    }
+    return parts.join(QStringLiteral(" | "));
+}
+
+QString pathLifecycleLabel(
+    Backend::Scenario::PathLifecycleState lifecycle)
+{
+    using Backend::Scenario::PathLifecycleState;
+    switch (lifecycle)
+    {
+    case PathLifecycleState::Pending:
+        return QObject::tr("pending");
+    case PathLifecycleState::Running:
+        return QObject::tr("running");
+    case PathLifecycleState::WaitingForTerminalHandoff:
+        return QObject::tr("terminal handoff");
+    case PathLifecycleState::WaitingForTerminalProcessing:
+        return QObject::tr("terminal processing");
+    case PathLifecycleState::ReadyForNextSegment:
+        return QObject::tr("ready for next segment");
+    case PathLifecycleState::Paused:
+        return QObject::tr("paused");
+    case PathLifecycleState::Skipped:
+        return QObject::tr("skipped");
+    case PathLifecycleState::Completed:
+        return QObject::tr("completed");
+    case PathLifecycleState::Failed:
+        return QObject::tr("failed");
+    }
+    return QObject::tr("unknown");
+}
+
+QString segmentLifecycleLabel(
+    Backend::Scenario::SegmentLifecycleState lifecycle)
+{
+    using Backend::Scenario::SegmentLifecycleState;
+    switch (lifecycle)
+    {
+    case SegmentLifecycleState::Pending:
+        return QObject::tr("pending");
+    case SegmentLifecycleState::Dispatched:
+        return QObject::tr("dispatched");
+    case SegmentLifecycleState::VehicleRunning:
+        return QObject::tr("running");
+    case SegmentLifecycleState::VehicleArrived:
+        return QObject::tr("arrived");
+    case SegmentLifecycleState::UnloadCompleted:
+        return QObject::tr("unloaded");
+    case SegmentLifecycleState::TerminalHandoffCompleted:
+        return QObject::tr("handoff complete");
+    case SegmentLifecycleState::TerminalProcessing:
+        return QObject::tr("terminal processing");
+    case SegmentLifecycleState::ReadyForPickup:
+        return QObject::tr("ready");
+    case SegmentLifecycleState::Skipped:
+        return QObject::tr("skipped");
+    case SegmentLifecycleState::Completed:
+        return QObject::tr("completed");
+    case SegmentLifecycleState::Failed:
+        return QObject::tr("failed");
+    }
+    return QObject::tr("unknown");
+}
+
+QString modeLabel(
+    Backend::TransportationTypes::TransportationMode mode)
+{
+    if (mode == Backend::TransportationTypes::TransportationMode::Any)
+        return QObject::tr("No mode");
+    return Backend::TransportationTypes::toString(mode);
+}
+
+const Backend::Scenario::SegmentProgressSnapshot *
+activeSegmentFor(
+    const Backend::Scenario::PathProgressSnapshot &progress)
+{
+    for (const auto &segment : progress.segments)
+    {
+        if (segment.segmentIndex == progress.activeSegmentIndex)
+            return &segment;
+    }
+    return nullptr;
+}
+
+QString statusMessage(
+    const Backend::Scenario::PreparedPathEligibility &eligibility)
+{
+    if (!eligibility.simulatable)
+        return QObject::tr("Simulation unavailable");
+
+    if (!eligibility.warningReason.isEmpty())
+        return QObject::tr("Ready with warning");
+
+    return QObject::tr("Ready");
+}
+
+/// 0 ready, 1 ready with warning, 2 unavailable.
+int statusRank(
+    const Backend::Scenario::PreparedPathEligibility &eligibility)
+{
+    if (!eligibility.simulatable)
+        return 2;
+    return eligibility.warningReason.isEmpty() ? 0 : 1;
+}
+
+/// Status icons are painted for every visible row on every
+/// repaint; build each once.
+QIcon statusIcon(
+    const Backend::Scenario::PreparedPathEligibility &eligibility)
+{
+    constexpr int kStatusIconSize = 16;
+    static const QIcon ready(
+        IconFactory::createStatusReadyIcon(kStatusIconSize));
+    static const QIcon warning(
+        IconFactory::createStatusWarningIcon(kStatusIconSize));
+    static const QIcon unavailable(
+        IconFactory::createStatusUnavailableIcon(kStatusIconSize));
+
+    switch (statusRank(eligibility))
+    {
+    case 2:
+        return unavailable;
+    case 1:
+        return warning;
+    default:
+        return ready;
+    }
+}
+
+QString eligibilityTooltip(const PathData &pathData)
+{
+    if (!pathData.eligibility.simulatable
+        && !pathData.eligibility.blockingReason.isEmpty())
+    {
+        return QObject::tr("Simulation unavailable: %1")
+            .arg(pathData.eligibility.blockingReason);
+    }
+
+    if (!pathData.eligibility.simulatable)
+        return QObject::tr("Simulation unavailable.");
+
+    if (!pathData.eligibility.warningReason.isEmpty())
+    {
+        return QObject::tr("Ready for simulation with warning: %1")
+            .arg(pathData.eligibility.warningReason);
+    }
+
+    return QObject::tr("Ready for simulation.");
+}
+
+bool isSelectable(const PathData &pathData)
+{
+    return pathData.eligibility.selectable;
+}
+
+QString terminalSequence(const PathData &pathData)
+{
+    if (!pathData.path)
+        return QString();
+    const auto &terminals = pathData.path->getTerminalsInPath();
+    QStringList names;
+    names.reserve(terminals.size());
+    for (int i = 0; i < terminals.size(); ++i)
+    {
+        names << (terminals[i].displayName.isEmpty()
+                      ? QObject::tr("Terminal %1").arg(i + 1)
+                      : terminals[i].displayName);
+    }
+    return names.join(QStringLiteral(" → "));
+}
+
+QString terminalSequenceToolTip(const PathData &pathData)
+{
+    if (!pathData.path)
+        return QString();
+    const auto &terminals = pathData.path->getTerminalsInPath();
+    if (terminals.isEmpty())
+        return QObject::tr("No terminal data");
+
+    const QList<Backend::PathSegment *> segments =
+        pathData.path->getSegments();
+    QString text;
+    for (int i = 0; i < terminals.size(); ++i)
+    {
+        text += terminals[i].displayName.isEmpty()
+                    ? QObject::tr("Terminal %1").arg(i + 1)
+                    : terminals[i].displayName;
+        if (i < terminals.size() - 1 && i < segments.size()
+            && segments[i])
+        {
+            text += QStringLiteral(" —%1→ ").arg(
+                Backend::TransportationTypes::toString(
+                    segments[i]->getMode()));
+        }
+    }
+    return text;
+}
+
+bool isActualColumn(int column)
+{
+    switch (column)
+    {
+    case ShortestPathsModel::ColumnActualDistance:
+    case ShortestPathsModel::ColumnActualTime:
+    case ShortestPathsModel::ColumnActualEnergyPerVehicle:
+    case ShortestPathsModel::ColumnActualCarbonPerVehicle:
+    case ShortestPathsModel::ColumnActualRiskPerVehicle:
+    case ShortestPathsModel::ColumnActualEnergyPerContainer:
+    case ShortestPathsModel::ColumnActualCarbonPerContainer:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Metric value behind a numeric metric column; `valid` is false
+/// when the column shows a dash.
+double metricValue(const PathData &pathData, int column, bool *valid)
+{
+    const auto &p = pathData.predictedMetrics;
+    const auto &a = pathData.actualMetrics;
+    *valid = isActualColumn(column) ? a.valid : p.valid;
+    switch (column)
+    {
+    case ShortestPathsModel::ColumnPredictedDistance:
+        return p.distanceKm;
+    case ShortestPathsModel::ColumnPredictedTime:
+        return p.travelTimeHours;
+    case ShortestPathsModel::ColumnPredictedFuelPerVehicle:
+        return p.fuelPerVehicle;
+    case ShortestPathsModel::ColumnPredictedEnergyPerVehicle:
+        return p.energyPerVehicle;
+    case ShortestPathsModel::ColumnPredictedCarbonPerVehicle:
+        return p.carbonPerVehicle;
+    case ShortestPathsModel::ColumnPredictedRiskPerVehicle:
+        return p.riskPerVehicle;
+    case ShortestPathsModel::ColumnActualDistance:
+        return a.distanceKm;
+    case ShortestPathsModel::ColumnActualTime:
+        return a.travelTimeHours;
+    case ShortestPathsModel::ColumnActualEnergyPerVehicle:
+        return a.energyPerVehicle;
+    case ShortestPathsModel::ColumnActualCarbonPerVehicle:
+        return a.carbonPerVehicle;
+    case ShortestPathsModel::ColumnActualRiskPerVehicle:
+        return a.riskPerVehicle;
+    case ShortestPathsModel::ColumnContainers:
+        return p.containerCount;
+    case ShortestPathsModel::ColumnVehicles:
+        return p.vehiclesNeeded;
+    case ShortestPathsModel::ColumnPredictedFuelPerContainer:
+        return p.fuelPerContainer;
+    case ShortestPathsModel::ColumnPredictedEnergyPerContainer:
+        return p.energyPerContainer;
+    case ShortestPathsModel::ColumnPredictedCarbonPerContainer:
+        return p.carbonPerContainer;
+    case ShortestPathsModel::ColumnActualEnergyPerContainer:
+        return a.energyPerContainer;
+    case ShortestPathsModel::ColumnActualCarbonPerContainer:
+        return a.carbonPerContainer;
+    default:
+        *valid = false;
+        return 0.0;
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+// ShortestPathsModel
+//------------------------------------------------------------------------------
+
+ShortestPathsModel::ShortestPathsModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+ShortestPathsModel::~ShortestPathsModel() = default;
+
+int ShortestPathsModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_rows.size());
+}
+
+int ShortestPathsModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant ShortestPathsModel::headerData(int             section,
+                                        Qt::Orientation orientation,
+                                        int             role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation,
+                                               role);
+
+    switch (section)
+    {
+    case ColumnSelect:                      return tr("Select");
+    case ColumnPathId:                      return tr("Path ID");
+    case ColumnStatus:                      return tr("Status");
+    case ColumnExecutionProgress:           return tr("Progress");
+    case ColumnTerminalPath:                return tr("Terminal Path");
+    case ColumnPredictedCost:               return tr("Predicted Cost");
+    case ColumnActualCost:                  return tr("Actual Cost");
+    // Predicted per-vehicle.
+    case ColumnPredictedDistance:           return tr("P. Distance (km)");
+    case ColumnPredictedTime:               return tr("P. Time (h)");
+    case ColumnPredictedFuelPerVehicle:     return tr("P. Fuel/Veh");
+    case ColumnPredictedEnergyPerVehicle:   return tr("P. Energy/Veh (kWh)");
+    case ColumnPredictedCarbonPerVehicle:   return tr("P. CO₂/Veh (t)");
+    case ColumnPredictedRiskPerVehicle:     return tr("P. Risk/Veh");
+    // Actual per-vehicle; no fuel key from SegmentCostMath.
+    case ColumnActualDistance:              return tr("A. Distance (km)");
+    case ColumnActualTime:                  return tr("A. Time (h)");
+    case ColumnActualEnergyPerVehicle:      return tr("A. Energy/Veh (kWh)");
+    case ColumnActualCarbonPerVehicle:      return tr("A. CO₂/Veh (t)");
+    case ColumnActualRiskPerVehicle:        return tr("A. Risk/Veh");
+    // Preview-demand counts and per-container metrics.
+    case ColumnContainers:                  return tr("OD Containers");
+    case ColumnVehicles:                    return tr("Preview Vehicle Plan");
+    case ColumnPredictedFuelPerContainer:   return tr("P. Fuel/Cont");
+    case ColumnPredictedEnergyPerContainer: return tr("P. Energy/Cont (kWh)");
+    case ColumnPredictedCarbonPerContainer: return tr("P. CO₂/Cont (t)");
+    case ColumnActualEnergyPerContainer:    return tr("A. Energy/Cont (kWh)");
+    case ColumnActualCarbonPerContainer:    return tr("A. CO₂/Cont (t)");
+    default:                                return QVariant();
+    }
+}
+
+Qt::ItemFlags ShortestPathsModel::flags(const QModelIndex &index) const
+{
+    const PathData *pathData = record(index.row());
+    if (!index.isValid() || !pathData)
+        return Qt::NoItemFlags;
+
+    if (index.column() == ColumnSelect)
+    {
+        // Unselectable rows draw a disabled checkbox, as the table
+        // always has.
+        return isSelectable(*pathData)
+                   ? Qt::ItemIsEnabled | Qt::ItemIsSelectable
+                         | Qt::ItemIsUserCheckable
+                   : Qt::ItemIsSelectable;
+    }
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+QVariant ShortestPathsModel::data(const QModelIndex &index,
+                                  int                role) const
+{
+    const PathData *pathData = record(index.row());
+    if (!index.isValid() || !pathData)
+        return QVariant();
+
+    const int column = index.column();
+    switch (role)
+    {
+    case Qt::DisplayRole:
+        return displayData(*pathData, column);
+
+    case PathKeyRole:
+        return pathData->pathKey;
+
+    case RecordRole:
+        return QVariant::fromValue(pathData);
+
+    case SortRole:
+        return sortData(*pathData, column);
+
+    case FilterRole:
+        return filterText(*pathData);
+
+    case VisibleRole:
+        return pathData->isVisible;
+
+    case Qt::CheckStateRole:
+        if (column != ColumnSelect)
+            return QVariant();
+        return pathData->isSelected && isSelectable(*pathData)
+                   ? Qt::Checked
+                   : Qt::Unchecked;
+
+    case Qt::DecorationRole:
+        if (column == ColumnStatus)
+            return statusIcon(pathData->eligibility);
+        return QVariant();
+
+    case Qt::TextAlignmentRole:
+        if (column == ColumnStatus)
+            return int(Qt::AlignCenter);
+        return QVariant();
+
+    case Qt::ToolTipRole:
+        switch (column)
+        {
+        case ColumnExecutionProgress:
+            return progressToolTip(pathData->pathKey);
+        case ColumnTerminalPath:
+            return terminalSequenceToolTip(*pathData);
+        case ColumnVehicles:
+            if (pathData->predictedMetrics.valid
+                && !pathData->predictedMetrics.previewVehicleBreakdown
+                        .isEmpty())
+            {
+                return tr("Per-segment preview vehicle requirements "
+                          "for the path: %1")
+                    .arg(vehicleBreakdownLabel(
+                        pathData->predictedMetrics));
+            }
+            return QVariant();
+        case ColumnSelect:
+        case ColumnPathId:
+        case ColumnStatus:
+        case ColumnPredictedCost:
+        case ColumnActualCost:
+            return eligibilityTooltip(*pathData);
+        default:
+            return QVariant();
+        }
+
+    case Qt::AccessibleTextRole:
+        if (column == ColumnStatus)
+            return statusMessage(pathData->eligibility);
+        return QVariant();
+
+    case Qt::AccessibleDescriptionRole:
+        if (column == ColumnStatus)
+            return eligibilityTooltip(*pathData);
+        return QVariant();
+
+    case Qt::BackgroundRole:
+        if (column != ColumnStatus)
+            return QVariant();
+        switch (statusRank(pathData->eligibility))
+        {
+        case 2:
+            return QBrush(QColor(253, 236, 234));
+        case 1:
+            return QBrush(QColor(255, 245, 224));
+        default:
+            return QBrush(QColor(232, 245, 236));
+        }
+
+    case Qt::ForegroundRole:
+        if (column == ColumnStatus)
+        {
+            switch (statusRank(pathData->eligibility))
+            {
+            case 2:
+                return QBrush(QColor(145, 33, 54));
+            case 1:
+                return QBrush(QColor(133, 87, 0));
+            default:
+                return QBrush(QColor(31, 101, 58));
+            }
+        }
+        if (!isSelectable(*pathData)
+            && (column == ColumnPathId || column == ColumnPredictedCost
+                || column == ColumnActualCost))
+        {
+            return QBrush(Qt::gray);
+        }
+        return QVariant();
+
+    case Qt::FontRole:
+        if (column == ColumnStatus && !pathData->eligibility.simulatable)
+        {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+
+    case ProgressRole:
+    {
+        const auto it = m_progressByPathKey.constFind(pathData->pathKey);
+        return it == m_progressByPathKey.constEnd()
+                   ? 0
+                   : qBound(0, qRound(it->percent), 100);
+    }
+
+    case ProgressEnabledRole:
+    {
+        const auto it = m_progressByPathKey.constFind(pathData->pathKey);
+        return it != m_progressByPathKey.constEnd() && it->executable;
+    }
+
+    default:
+        return QVariant();
+    }
+}
+
+QVariant ShortestPathsModel::displayData(const PathData &pathData,
+                                         int             column) const
+{
+    const QString dash = QStringLiteral("—");
+    switch (column)
+    {
+    case ColumnSelect:
+    case ColumnStatus:
+        return QVariant();
+    case ColumnPathId:
+        return pathData.path ? QString::number(pathData.path->getPathId())
+                             : QString();
+    case ColumnExecutionProgress:
+        return progressText(pathData.pathKey);
+    case ColumnTerminalPath:
+        return terminalSequence(pathData);
+    case ColumnPredictedCost:
+        return pathData.path && pathData.path->getTotalPathCost() >= 0
+                   ? QString::number(pathData.path->getTotalPathCost(),
+                                     'f', 2)
+                   : tr("Waiting analysis");
+    case ColumnActualCost:
+        return pathData.hasSimulationTotalCost()
+                   ? QString::number(pathData.simulationTotalCost, 'f', 2)
+                   : tr("Waiting simulation");
+    case ColumnContainers:
+        return pathData.predictedMetrics.valid
+                   ? QString::number(
+                         pathData.predictedMetrics.containerCount)
+                   : dash;
+    case ColumnVehicles:
+        return pathData.predictedMetrics.valid
+                   ? vehicleBreakdownLabel(pathData.predictedMetrics)
+                   : dash;
+    default:
+    {
+        bool         valid = false;
+        const double value = metricValue(pathData, column, &valid);
+        return valid ? QString::number(value, 'f', 2) : dash;
+    }
+    }
+}
+
+QVariant ShortestPathsModel::sortData(const PathData &pathData,
+                                      int             column) const
+{
+    // Missing values are returned invalid rather than as 0 so they
+    // never sort as a real (and cheapest) value.
+    switch (column)
+    {
+    case ColumnSelect:
+        return pathData.isSelected && isSelectable(pathData) ? 1 : 0;
+    case ColumnPathId:
+        return pathData.path ? QVariant(pathData.path->getPathId())
+                             : QVariant();
+    case ColumnStatus:
+        return statusRank(pathData.eligibility);
+    case ColumnExecutionProgress:
+    {
+        const auto it = m_progressByPathKey.constFind(pathData.pathKey);
+        return it == m_progressByPathKey.constEnd() ? QVariant()
+                                                     : QVariant(it->percent);
+    }
+    case ColumnTerminalPath:
+        return terminalSequence(pathData).toCaseFolded();
+    case ColumnPredictedCost:
+        return pathData.path && pathData.path->getTotalPathCost() >= 0
+                   ? QVariant(pathData.path->getTotalPathCost())
+                   : QVariant();
+    case ColumnActualCost:
+        return pathData.hasSimulationTotalCost()
+                   ? QVariant(pathData.simulationTotalCost)
+                   : QVariant();
+    default:
+    {
+        bool         valid = false;
+        const double value = metricValue(pathData, column, &valid);
+        return valid ? QVariant(value) : QVariant();
+    }
+    }
+}
+
+QString ShortestPathsModel::filterText(const PathData &pathData) const
+{
+    if (!pathData.path)
+        return QString();
+    return QString::number(pathData.path->getPathId())
+           + QLatin1Char(' ') + terminalSequence(pathData);
+}
+
+QString ShortestPathsModel::progressText(
+    const ExecutionPathKey &pathKey) const
+{
+    const auto it = m_progressByPathKey.constFind(pathKey);
+    if (it == m_progressByPathKey.constEnd())
+        return tr("Waiting simulation");
+
+    const auto &progress = it.value();
+    QString     phase    = pathLifecycleLabel(progress.lifecycle);
+    if (const auto *activeSegment = activeSegmentFor(progress))
+        phase = segmentLifecycleLabel(activeSegment->lifecycle);
+
+    QString summary = phase;
+    if (progress.activeSegmentIndex >= 0 && progress.totalSegments > 0)
+    {
+        summary = tr("%1 seg %2/%3 %4")
+                      .arg(modeLabel(progress.activeMode))
+                      .arg(progress.activeSegmentIndex + 1)
+                      .arg(progress.totalSegments)
+                      .arg(phase);
+    }
+    else if (!progress.message.isEmpty())
+    {
+        summary = progress.message;
+    }
+
+    return QStringLiteral("%1%  %2")
+        .arg(qBound(0, qRound(progress.percent), 100))
+        .arg(summary);
+}
+
+QString ShortestPathsModel::progressToolTip(
+    const ExecutionPathKey &pathKey) const
+{
+    const auto it = m_progressByPathKey.constFind(pathKey);
+    if (it == m_progressByPathKey.constEnd())
+        return tr("No execution progress has been reported for this "
+                  "path yet.");
+
+    const auto &progress = it.value();
+    QStringList tooltip;
+    tooltip << tr("Path progress: %1%").arg(progress.percent, 0, 'f', 1)
+            << tr("Path state: %1")
+                   .arg(pathLifecycleLabel(progress.lifecycle));
+    if (progress.activeSegmentIndex >= 0)
+    {
+        tooltip << tr("Active segment: %1 of %2")
+                       .arg(progress.activeSegmentIndex + 1)
+                       .arg(progress.totalSegments)
+                << tr("Mode: %1").arg(modeLabel(progress.activeMode))
+                << tr("Network: %1").arg(progress.activeNetworkName)
+                << tr("From: %1").arg(progress.activeStartTerminalId)
+                << tr("To: %1").arg(progress.activeEndTerminalId);
+    }
+    if (!progress.message.isEmpty())
+        tooltip << tr("Message: %1").arg(progress.message);
+
+    if (!progress.segments.isEmpty())
+    {
+        tooltip << tr("Segments:");
+        for (const auto &segment : progress.segments)
+        {
+            tooltip << tr("%1. %2 %3 -> %4: %5 (%6%)")
+                           .arg(segment.segmentIndex + 1)
+                           .arg(modeLabel(segment.mode))
+                           .arg(segment.startTerminalId,
+                                segment.endTerminalId,
+                                segmentLifecycleLabel(segment.lifecycle))
+                           .arg(segment.percent, 0, 'f', 1);
+        }
+    }
+    return tooltip.join(QLatin1Char('\n'));
+}
+
+bool ShortestPathsModel::setData(const QModelIndex &index,
+                                 const QVariant    &value,
+                                 int                role)
+{
+    if (role != Qt::CheckStateRole || index.column() != ColumnSelect)
+        return false;
+    if (index.row() < 0 || index.row() >= rowCount())
+        return false;
+
+    PathData &pathData = *m_rows[index.row()];
+    if (!isSelectable(pathData))
+        return false;
+
+    const bool checked =
+        static_cast<Qt::CheckState>(value.toInt()) == Qt::Checked;
+    if (pathData.isSelected == checked)
+        return true;
+
+    pathData.isSelected = checked;
+    emit dataChanged(index, index, {Qt::CheckStateRole, SortRole});
+    emit checkStateChanged({pathData.pathKey}, checked);
+    return true;
+}
+
+QVector<ExecutionPathKey>
+ShortestPathsModel::appendRecords(QList<PathData> records)
+{
+    QVector<ExecutionPathKey> keys;
+    keys.reserve(records.size());
+
+    std::vector<std::unique_ptr<PathData>> incoming;
+    incoming.reserve(static_cast<size_t>(records.size()));
+    QHash<ExecutionPathKey, int> taken = m_rowByKey;
+    taken.reserve(m_rowByKey.size() + records.size());
+
+    for (auto &record : records)
+    {
+        if (!record.path)
+        {
+            qCWarning(lcGuiPathTable)
+                << "Skipping null path presentation record";
+            keys.append(QString());
+            continue;
+        }
+
+        const ExecutionPathKey preferredKey =
+            record.executionPathKey.isEmpty()
+                ? record.path->canonicalPathKey().isEmpty()
+                      ? QStringLiteral("path_id|%1")
+                            .arg(record.path->getPathId())
+                      : record.path->canonicalPathKey()
+                : record.executionPathKey;
+        const ExecutionPathKey resolvedKey =
+            makeUniquePathKey(preferredKey, taken);
+        if (resolvedKey != preferredKey)
+        {
+            qCWarning(lcGuiPathTable)
+                << "Execution path key collision detected;"
+                << "using compatibility key" << resolvedKey
+                << "for preferred execution path key" << preferredKey;
+        }
+
+        record.executionPathKey = resolvedKey;
+        record.pathKey          = resolvedKey;
+        taken.insert(resolvedKey,
+                     static_cast<int>(m_rows.size() + incoming.size()));
+        keys.append(resolvedKey);
+        incoming.push_back(std::make_unique<PathData>(std::move(record)));
+    }
+
+    if (incoming.empty())
+        return keys;
+
+    const int first = rowCount();
+    beginInsertRows(QModelIndex(), first,
+                    first + static_cast<int>(incoming.size()) - 1);
+    m_rows.reserve(m_rows.size() + incoming.size());
+    for (auto &pathData : incoming)
+        m_rows.push_back(std::move(pathData));
+    m_rowByKey = std::move(taken);
+    endInsertRows();
+    return keys;
+}
+
+void ShortestPathsModel::clear()
+{
+    beginResetModel();
+    m_rows.clear();
+    m_rowByKey.clear();
+    m_progressByPathKey.clear();
+    endResetModel();
+}
+
+const PathData *ShortestPathsModel::record(int row) const
+{
+    if (row < 0 || row >= static_cast<int>(m_rows.size()))
+        return nullptr;
+    return m_rows[row].get();
+}
+
+const PathData *
+ShortestPathsModel::record(const ExecutionPathKey &pathKey) const
+{
+    return record(rowOf(pathKey));
+}
+
+int ShortestPathsModel::rowOf(const ExecutionPathKey &pathKey) const
+{
+    return m_rowByKey.value(pathKey, -1);
+}
+
+ExecutionPathKey ShortestPathsModel::pathKey(int row) const
+{
+    const PathData *pathData = record(row);
+    return pathData ? pathData->pathKey : ExecutionPathKey();
+}
+
+QVector<ExecutionPathKey> ShortestPathsModel::checkedPathKeys() const
+{
+    QVector<ExecutionPathKey> keys;
+    for (const auto &pathData : m_rows)
+    {
+        if (pathData->isVisible && pathData->isSelected
+            && isSelectable(*pathData))
+            keys.append(pathData->pathKey);
+    }
+    return keys;
+}
+
+int ShortestPathsModel::checkedCount() const
+{
+    return static_cast<int>(std::count_if(
+        m_rows.begin(), m_rows.end(), [](const auto &pathData) {
+            return pathData->isVisible && pathData->isSelected
+                   && isSelectable(*pathData);
+        }));
+}
+
+int ShortestPathsModel::selectableCount() const
+{
+    return static_cast<int>(std::count_if(
+        m_rows.begin(), m_rows.end(), [](const auto &pathData) {
+            return pathData->isVisible && isSelectable(*pathData);
+        }));
+}
+
+void ShortestPathsModel::setAllChecked(bool checked)
+{
+    QSet<ExecutionPathKey> keys;
+    keys.reserve(static_cast<qsizetype>(m_rows.size()));
+    for (const auto &pathData : m_rows)
+        keys.insert(pathData->pathKey);
+    setChecked(keys, checked);
+}
+
+void ShortestPathsModel::setChecked(const QSet<ExecutionPathKey> &pathKeys,
+                                    bool                          checked)
+{
+    QVector<int>              rows;
+    QVector<ExecutionPathKey> changed;
+    for (const auto &pathKey : pathKeys)
+    {
+        const int row = rowOf(pathKey);
+        if (row < 0)
+            continue;
+        PathData &pathData = *m_rows[row];
+        if (!pathData.isVisible || !isSelectable(pathData)
+            || pathData.isSelected == checked)
+            continue;
+        pathData.isSelected = checked;
+        rows.append(row);
+        changed.append(pathKey);
+    }
+    if (changed.isEmpty())
+        return;
+
+    emitRowsChanged(rows, ColumnSelect, ColumnSelect,
+                    {Qt::CheckStateRole, SortRole});
+    emit checkStateChanged(changed, checked);
+}
+
+void ShortestPathsModel::setEligibility(
+    const QHash<ExecutionPathKey,
+                Backend::Scenario::PreparedPathEligibility> &eligibility)
+{
+    if (m_rows.empty())
+        return;
+
+    for (const auto &pathData : m_rows)
+    {
+        pathData->eligibility = eligibility.value(
+            pathData->pathKey,
+            Backend::Scenario::PreparedPathEligibility{});
+        // A row that can no longer be selected drops its check, like
+        // the disabled checkbox it is drawn as.
+        if (!isSelectable(*pathData))
+            pathData->isSelected = false;
+    }
+    emit dataChanged(index(0, 0),
+                     index(rowCount() - 1, ColumnCount - 1));
+}
+
+void ShortestPathsModel::setActualMetrics(
+    const QHash<ExecutionPathKey, Backend::Scenario::PathMetrics> &actual)
+{
+    QVector<int> rows;
+    rows.reserve(actual.size());
+    for (auto it = actual.constBegin(); it != actual.constEnd(); ++it)
+    {
+        const int row = rowOf(it.key());
+        if (row < 0)
+            continue;
+        m_rows[row]->actualMetrics = it.value();
+        rows.append(row);
+    }
+    emitRowsChanged(rows, ColumnActualCost, ColumnActualCarbonPerContainer);
+}
+
+ShortestPathsModel::PathData *
+ShortestPathsModel::resolve(const QString &executionPathKey,
+                            const QString &canonicalPathKey)
+{
+    int row = rowOf(executionPathKey);
+    if (row < 0 && !canonicalPathKey.isEmpty())
+        row = rowOf(canonicalPathKey);
+    return row < 0 ? nullptr : m_rows[row].get();
+}
+
+void ShortestPathsModel::setExecutionResults(
+    const Backend::Scenario::ScenarioExecutionResultSet &results)
+{
+    QVector<int> rows;
+    rows.reserve(results.size());
+    for (const auto &result : results.pathResults())
+    {
+        PathData *pathData =
+            resolve(result.executionPathKey, result.canonicalPathKey);
+        if (!pathData)
+        {
+            qCWarning(lcGuiPathTable)
+                << "Path key" << result.executionPathKey
+                << "not found for execution result update";
+            continue;
+        }
+
+        pathData->executionResult = result;
+        if (result.totalCost >= 0)
+            pathData->simulationTotalCost = result.totalCost;
+        if (result.edgeCosts >= 0)
+            pathData->simulationEdgeCosts = result.edgeCosts;
+        if (result.terminalCosts >= 0)
+            pathData->simulationTerminalCosts = result.terminalCosts;
+        rows.append(rowOf(pathData->pathKey));
+    }
+    emitRowsChanged(rows, ColumnActualCost, ColumnActualCost);
+}
+
+void ShortestPathsModel::setExecutionProgress(
+    const Backend::Scenario::ExecutionProgressSnapshot &snapshot)
+{
+    m_progressByPathKey.clear();
+    m_progressByPathKey.reserve(snapshot.paths.size());
+
+    for (const auto &progress : snapshot.paths)
+    {
+        const PathData *pathData = resolve(progress.executionPathKey,
+                                           progress.canonicalPathKey);
+        if (!pathData)
+        {
+            qCDebug(lcGuiPathTable)
+                << "Ignoring execution progress for unknown path"
+                << progress.executionPathKey
+                << "canonicalPathKey=" << progress.canonicalPathKey;
+            continue;
+        }
+        m_progressByPathKey.insert(pathData->pathKey, progress);
+    }
+
+    // Snapshots arrive many times a second while a run is live; one
+    // column-wide change lets the view repaint only what it shows.
+    if (!m_rows.empty())
+        emit dataChanged(index(0, ColumnExecutionProgress),
+                         index(rowCount() - 1, ColumnExecutionProgress));
+}
+
+void ShortestPathsModel::clearExecutionProgress()
+{
+    if (m_progressByPathKey.isEmpty())
+        return;
+
+    m_progressByPathKey.clear();
+    emit dataChanged(index(0, ColumnExecutionProgress),
+                     index(rowCount() - 1, ColumnExecutionProgress));
+}
+
+bool ShortestPathsModel::updatePredictionCosts(
+    const ExecutionPathKey &pathKey, double totalCost, double edgeCost,
+    double terminalCost)
+{
+    const int row = rowOf(pathKey);
+    if (row < 0)
+        return false;
+
+    PathData &pathData = *m_rows[row];
+    if (totalCost >= 0)
+        pathData.path->setTotalPathCost(totalCost);
+    if (edgeCost >= 0)
+        pathData.path->setTotalEdgeCosts(edgeCost);
+    if (terminalCost >= 0)
+        pathData.path->setTotalTerminalCosts(terminalCost);
+    emitRowsChanged({row}, ColumnPredictedCost, ColumnPredictedCost);
+    return true;
+}
+
+bool ShortestPathsModel::updateSimulationCosts(
+    const ExecutionPathKey &pathKey, double totalCost, double edgeCost,
+    double terminalCost)
+{
+    const int row = rowOf(pathKey);
+    if (row < 0)
+        return false;
+
+    PathData &pathData = *m_rows[row];
+    if (totalCost >= 0)
+        pathData.simulationTotalCost = totalCost;
+    if (edgeCost >= 0)
+        pathData.simulationEdgeCosts = edgeCost;
+    if (terminalCost >= 0)
+        pathData.simulationTerminalCosts = terminalCost;
+    emitRowsChanged({row}, ColumnActualCost, ColumnActualCost);
+    return true;
+}
+
+void ShortestPathsModel::emitRowsChanged(QVector<int> rows, int first,
+                                         int last,
+                                         const QList<int> &roles)
+{
+    if (rows.isEmpty())
+        return;
+    std::sort(rows.begin(), rows.end());
+    int runStart = rows.first();
+    int previous = runStart;
+    for (int i = 1; i <= rows.size(); ++i)
+    {
+        if (i < rows.size() && rows[i] <= previous + 1)
+        {
+            previous = rows[i];
+            continue;
+        }
+        emit dataChanged(index(runStart, first), index(previous, last),
+                         roles);
+        if (i < rows.size())
+            runStart = previous = rows[i];
+    }
+}
+
+//------------------------------------------------------------------------------
+// ShortestPathsFilterModel
+//------------------------------------------------------------------------------
+
+ShortestPathsFilterModel::ShortestPathsFilterModel(QObject *parent)
+    : QSortFilterProxyModel(parent)
+{
+    setSortRole(ShortestPathsModel::SortRole);
+    setFilterRole(ShortestPathsModel::FilterRole);
+    setFilterKeyColumn(ShortestPathsModel::ColumnTerminalPath);
+    setFilterCaseSensitivity(Qt::CaseInsensitive);
+    setDynamicSortFilter(true);
+}
+
+bool ShortestPathsFilterModel::filterAcceptsRow(
+    int sourceRow, const QModelIndex &sourceParent) const
+{
+    const QModelIndex source =
+        sourceModel()->index(sourceRow, 0, sourceParent);
+    if (!source.data(ShortestPathsModel::VisibleRole).toBool())
+        return false;
+    // Building the filter text is only worth it with a filter set.
+    if (filterRegularExpression().pattern().isEmpty())
+        return true;
+    return QSortFilterProxyModel::filterAcceptsRow(sourceRow,
+                                                   sourceParent);
+}
+
+} // namespace GUI
+} // namespace CargoNetSim
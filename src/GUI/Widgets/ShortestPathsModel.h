@@ -0,0 +1,202 @@
+/**
+ * @file ShortestPathsModel.h
+ * @brief Item model behind the ShortestPathsTable widget
+ *
+ * ShortestPathsModel holds one PathPresentationRecord per
+ * discovered path and renders every cell on demand from the
+ * record, its PathMetrics and the latest execution progress.
+ * Nothing per cell is materialised up front, so the table
+ * stays cheap with tens of thousands of alternatives; views
+ * only ask for the rows they paint.
+ */
+#pragma once
+
+#include "Backend/Application/PathPresentationService.h"
+#include "Backend/GuiApi/ScenarioContractsApi.h"
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QSet>
+#include <QSortFilterProxyModel>
+#include <QVector>
+
+#include <memory>
+#include <vector>
+
+namespace CargoNetSim
+{
+namespace GUI
+{
+
+class ShortestPathsModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    using ExecutionPathKey = QString;
+    using PathData = Backend::Application::PathPresentationRecord;
+
+    enum Column : int
+    {
+        ColumnSelect = 0,
+        ColumnPathId,
+        ColumnStatus,
+        ColumnExecutionProgress,
+        ColumnTerminalPath,
+        ColumnPredictedCost,
+        ColumnActualCost,
+        ColumnPredictedDistance,
+        ColumnPredictedTime,
+        ColumnPredictedFuelPerVehicle,
+        ColumnPredictedEnergyPerVehicle,
+        ColumnPredictedCarbonPerVehicle,
+        ColumnPredictedRiskPerVehicle,
+        ColumnActualDistance,
+        ColumnActualTime,
+        ColumnActualEnergyPerVehicle,
+        ColumnActualCarbonPerVehicle,
+        ColumnActualRiskPerVehicle,
+        ColumnContainers,
+        ColumnVehicles,
+        ColumnPredictedFuelPerContainer,
+        ColumnPredictedEnergyPerContainer,
+        ColumnPredictedCarbonPerContainer,
+        ColumnActualEnergyPerContainer,
+        ColumnActualCarbonPerContainer,
+        ColumnCount
+    };
+
+    enum Role : int
+    {
+        /// ExecutionPathKey of the row, on every column.
+        PathKeyRole = Qt::UserRole + 1,
+        /// `const PathData *` of the row, for delegates.
+        RecordRole,
+        /// Numeric (or case-folded text) value used for sorting.
+        SortRole,
+        /// Text the filter proxy matches against.
+        FilterRole,
+        /// Whether the row is shown at all (PathData::isVisible).
+        VisibleRole,
+        /// Progress percentage 0..100 (0 until progress is reported).
+        ProgressRole,
+        /// Whether the progress bar should be drawn enabled.
+        ProgressEnabledRole
+    };
+
+    explicit ShortestPathsModel(QObject *parent = nullptr);
+    ~ShortestPathsModel() override;
+
+    int      rowCount(const QModelIndex &parent = {}) const override;
+    int      columnCount(const QModelIndex &parent = {}) const override;
+    QVariant data(const QModelIndex &index,
+                  int role = Qt::DisplayRole) const override;
+    bool     setData(const QModelIndex &index, const QVariant &value,
+                     int role = Qt::EditRole) override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    /**
+     * @brief Append @p records in one insert. Keys are made unique
+     *        against rows already present; returns the stored keys in
+     *        input order (empty for records without a path).
+     */
+    QVector<ExecutionPathKey> appendRecords(QList<PathData> records);
+
+    /// Drop every row and all execution progress.
+    void clear();
+
+    const PathData *record(int row) const;
+    const PathData *record(const ExecutionPathKey &pathKey) const;
+    int             rowOf(const ExecutionPathKey &pathKey) const;
+    ExecutionPathKey pathKey(int row) const;
+
+    /// Rows in insertion order; stable until clear().
+    const std::vector<std::unique_ptr<PathData>> &records() const
+    {
+        return m_rows;
+    }
+
+    /// Checked, selectable, visible rows in insertion order.
+    QVector<ExecutionPathKey> checkedPathKeys() const;
+    int                       checkedCount() const;
+    int                       selectableCount() const;
+
+    /// Check (or uncheck) every selectable row; one change signal.
+    void setAllChecked(bool checked);
+    void setChecked(const QSet<ExecutionPathKey> &pathKeys, bool checked);
+
+    void setEligibility(
+        const QHash<ExecutionPathKey,
+                    Backend::Scenario::PreparedPathEligibility>
+            &eligibility);
+    void setActualMetrics(
+        const QHash<ExecutionPathKey, Backend::Scenario::PathMetrics>
+            &actual);
+    void setExecutionResults(
+        const Backend::Scenario::ScenarioExecutionResultSet &results);
+    void setExecutionProgress(
+        const Backend::Scenario::ExecutionProgressSnapshot &snapshot);
+    void clearExecutionProgress();
+
+    /// Apply costs that are >= 0; returns false for an unknown key.
+    bool updatePredictionCosts(const ExecutionPathKey &pathKey,
+                               double totalCost, double edgeCost,
+                               double terminalCost);
+    bool updateSimulationCosts(const ExecutionPathKey &pathKey,
+                               double totalCost, double edgeCost,
+                               double terminalCost);
+
+signals:
+    /// Check state of @p pathKeys changed to @p checked, by the user or
+    /// by setAllChecked / setChecked.
+    void checkStateChanged(const QVector<QString> &pathKeys,
+                           bool                    checked);
+
+private:
+    QVariant displayData(const PathData &record, int column) const;
+    QVariant sortData(const PathData &record, int column) const;
+    QString  progressText(const ExecutionPathKey &pathKey) const;
+    QString  progressToolTip(const ExecutionPathKey &pathKey) const;
+    QString  filterText(const PathData &record) const;
+
+    /// Emit one dataChanged per contiguous run of @p rows, limited to
+    /// the columns [@p first, @p last].
+    void emitRowsChanged(QVector<int> rows, int first, int last,
+                         const QList<int> &roles = {});
+    PathData *resolve(const QString &executionPathKey,
+                      const QString &canonicalPathKey);
+
+    std::vector<std::unique_ptr<PathData>> m_rows;
+    QHash<ExecutionPathKey, int>           m_rowByKey;
+    QHash<ExecutionPathKey, Backend::Scenario::PathProgressSnapshot>
+        m_progressByPathKey;
+};
+
+/**
+ * @brief Sort/filter proxy over ShortestPathsModel
+ *
+ * Hides rows whose record is not visible and matches the
+ * filter string against the row's path id and terminal
+ * sequence. Sorting uses ShortestPathsModel::SortRole so
+ * numeric columns order numerically; with dynamic sorting
+ * on, rows re-sort incrementally as results arrive.
+ */
+class ShortestPathsFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    explicit ShortestPathsFilterModel(QObject *parent = nullptr);
+
+protected:
+    bool filterAcceptsRow(int                sourceRow,
+                          const QModelIndex &sourceParent) const override;
+};
+
+} // namespace GUI
+} // namespace CargoNetSim
+
+Q_DECLARE_METATYPE(
+    const CargoNetSim::Backend::Application::PathPresentationRecord *)
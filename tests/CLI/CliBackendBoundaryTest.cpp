@@ -20,6 +20,7 @@ QSet<QString> allowedBackendIncludes()
 {
     return {
         QStringLiteral("Backend/Application/AvailabilityService.h"),
+        QStringLiteral("Backend/Application/ParameterSweepService.h"),
         QStringLiteral("Backend/Application/PreparedPathService.h"),
         QStringLiteral("Backend/Application/ScenarioLoadService.h"),
         QStringLiteral("Backend/Application/ScenarioPreviewService.h"),
@@ -31,6 +32,7 @@ QSet<QString> allowedBackendIncludes()
         QStringLiteral("Backend/CliApi/ValidationApi.h"),
         QStringLiteral("Backend/Commons/LogCategories.h"),
         QStringLiteral("Backend/Commons/LogMessageHandler.h"),
+        QStringLiteral("Backend/Commons/Trace.h"),
         QStringLiteral("Backend/Commons/TransportationMode.h"),
         QStringLiteral("Backend/Controllers/CargoNetSimController.h"),
         QStringLiteral("Backend/Scenario/ScenarioRuntime.h"),
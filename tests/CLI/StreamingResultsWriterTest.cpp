@@ -0,0 +1,214 @@
+#include <QDataStream>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "Backend/Scenario/ScenarioExecutionResult.h"
+#include "CLI/Output/ColumnarMetricsWriter.h"
+#include "CLI/Output/NdjsonResultsWriter.h"
+
+// Contract lock-tests for the streaming result writers
+// (NdjsonResultsWriter + ColumnarMetricsWriter). Both formats are
+// published contracts consumed while a run is still in progress, so
+// the tests cover the record framing and the partial-file behaviour
+// as well as the happy path.
+
+class StreamingResultsWriterTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    using PER = CargoNetSim::Backend::Scenario::PathExecutionResult;
+    using ColumnarWriter = CargoNetSim::Cli::ColumnarMetricsWriter;
+
+    static PER makeResult(int id)
+    {
+        PER r;
+        r.pathId           = id;
+        r.canonicalPathKey = QStringLiteral("key-%1").arg(id);
+        r.pathUid          = r.canonicalPathKey;
+        r.originId         = QStringLiteral("O1");
+        r.destinationId    = QStringLiteral("D%1").arg(id);
+        r.rank             = id;
+        r.totalCost        = 100.0 + id;
+        r.edgeCosts        = 80.0;
+        r.terminalCosts    = 20.0 + id;
+        return r;
+    }
+
+    static QList<QJsonObject> readRecords(const QString &path)
+    {
+        QList<QJsonObject> records;
+        QFile f(path);
+        if (!f.open(QIODevice::ReadOnly))
+            return records;
+        for (const QByteArray &line : f.readAll().split('\n'))
+        {
+            if (line.isEmpty())
+                continue;
+            records.append(QJsonDocument::fromJson(line).object());
+        }
+        return records;
+    }
+
+    static const ColumnarWriter::Column *
+    findColumn(const QList<ColumnarWriter::Column> &columns,
+               const QString                      &name)
+    {
+        for (const auto &c : columns)
+            if (c.name == name)
+                return &c;
+        return nullptr;
+    }
+
+private slots:
+    void test_ndjson_emits_header_one_record_per_path_and_footer()
+    {
+        using namespace CargoNetSim;
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString out = dir.filePath(QStringLiteral("results.ndjson"));
+
+        Cli::NdjsonResultsWriter w;
+        QString                  err;
+        QVERIFY2(w.open(out, &err), qPrintable(err));
+        QVERIFY2(w.append(makeResult(1), &err), qPrintable(err));
+        QVERIFY2(w.append(makeResult(2), &err), qPrintable(err));
+        QVERIFY2(w.finish(&err), qPrintable(err));
+
+        const auto records = readRecords(out);
+        QCOMPARE(records.size(), 4);
+        QCOMPARE(records[0].value(QStringLiteral("record")).toString(),
+                 QStringLiteral("header"));
+        QCOMPARE(records[1].value(QStringLiteral("record")).toString(),
+                 QStringLiteral("path"));
+        QCOMPARE(records[1].value(QStringLiteral("path_id")).toInt(), 1);
+        QCOMPARE(records[2].value(QStringLiteral("total_cost")).toDouble(),
+                 102.0);
+        QCOMPARE(records[3].value(QStringLiteral("record")).toString(),
+                 QStringLiteral("footer"));
+        QCOMPARE(records[3].value(QStringLiteral("path_count")).toInt(), 2);
+    }
+
+    void test_ndjson_records_are_readable_before_finish()
+    {
+        using namespace CargoNetSim;
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString out = dir.filePath(QStringLiteral("results.ndjson"));
+
+        Cli::NdjsonResultsWriter w;
+        QString                  err;
+        QVERIFY2(w.open(out, &err), qPrintable(err));
+        QVERIFY2(w.append(makeResult(7), &err), qPrintable(err));
+
+        // No footer yet: the file is a valid prefix of the final output.
+        const auto records = readRecords(out);
+        QCOMPARE(records.size(), 2);
+        QCOMPARE(records[1].value(QStringLiteral("path_id")).toInt(), 7);
+    }
+
+    void test_columnar_round_trips_across_row_groups()
+    {
+        using namespace CargoNetSim;
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString out = dir.filePath(QStringLiteral("results.cnscol"));
+
+        Cli::ColumnarMetricsWriter w({}, /*rowGroupSize=*/2);
+        QString                    err;
+        QVERIFY2(w.open(out, &err), qPrintable(err));
+        for (int i = 0; i < 5; ++i)
+            QVERIFY2(w.append(makeResult(i), &err), qPrintable(err));
+        QVERIFY2(w.finish(&err), qPrintable(err));
+
+        QList<ColumnarWriter::Column> columns;
+        QVERIFY2(ColumnarWriter::read(out, &columns, &err),
+                 qPrintable(err));
+
+        const auto *ids = findColumn(columns, QStringLiteral("path_id"));
+        QVERIFY(ids);
+        QCOMPARE(ids->ints, (QVector<qint32>{0, 1, 2, 3, 4}));
+
+        const auto *costs =
+            findColumn(columns, QStringLiteral("total_cost"));
+        QVERIFY(costs);
+        QCOMPARE(costs->doubles.size(), 5);
+        QCOMPARE(costs->doubles[4], 104.0);
+
+        const auto *dest =
+            findColumn(columns, QStringLiteral("destination"));
+        QVERIFY(dest);
+        QCOMPARE(dest->strings.last(), QStringLiteral("D4"));
+    }
+
+    void test_columnar_partial_file_keeps_complete_row_groups()
+    {
+        using namespace CargoNetSim;
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString out = dir.filePath(QStringLiteral("results.cnscol"));
+
+        QString err;
+        {
+            Cli::ColumnarMetricsWriter w({}, /*rowGroupSize=*/2);
+            QVERIFY2(w.open(out, &err), qPrintable(err));
+            for (int i = 0; i < 3; ++i)
+                QVERIFY2(w.append(makeResult(i), &err), qPrintable(err));
+            // Destroyed without finish(): the third row is still buffered.
+        }
+
+        QList<ColumnarWriter::Column> columns;
+        QVERIFY2(ColumnarWriter::read(out, &columns, &err),
+                 qPrintable(err));
+        const auto *ids = findColumn(columns, QStringLiteral("path_id"));
+        QVERIFY(ids);
+        QCOMPARE(ids->ints, (QVector<qint32>{0, 1}));
+    }
+
+    void test_columnar_rejects_foreign_file()
+    {
+        using namespace CargoNetSim;
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString out = dir.filePath(QStringLiteral("bogus.cnscol"));
+        QFile f(out);
+        QVERIFY(f.open(QIODevice::WriteOnly));
+        f.write("not a columnar file");
+        f.close();
+
+        QList<ColumnarWriter::Column> columns;
+        QString err;
+        QVERIFY(!ColumnarWriter::read(out, &columns, &err));
+        QVERIFY(!err.isEmpty());
+    }
+
+    void test_columnar_rejects_string_length_past_end_of_file()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString out = dir.filePath(QStringLiteral("huge.cnscol"));
+        QFile f(out);
+        QVERIFY(f.open(QIODevice::WriteOnly));
+        {
+            QDataStream ds(&f);
+            ds.setByteOrder(QDataStream::LittleEndian);
+            ds << ColumnarWriter::Magic << ColumnarWriter::Version
+               << quint16(1)
+               << static_cast<quint8>(ColumnarWriter::ColumnType::Utf8)
+               << quint32(0xFFFFFFF0u);
+            ds.writeRawData("abc", 3);
+        }
+        f.close();
+
+        QList<ColumnarWriter::Column> columns;
+        QString err;
+        QVERIFY(!ColumnarWriter::read(out, &columns, &err));
+        QVERIFY(err.contains(QStringLiteral("corrupt column header")));
+    }
+};
+
+QTEST_MAIN(StreamingResultsWriterTest)
+#include "StreamingResultsWriterTest.moc"
@@ -0,0 +1,82 @@
+#include <QList>
+#include <QPair>
+#include <QTest>
+
+#include "Backend/Commons/ChunkedUpload.h"
+
+using namespace CargoNetSim::Backend::Commons;
+
+namespace
+{
+
+using Range = QPair<int, int>;
+
+} // namespace
+
+class ChunkedUploadTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sendsBoundedChunksInOrder()
+    {
+        ChunkedUpload upload;
+        upload.maxItems = 3;
+        QList<Range> progress;
+        upload.progress = [&progress](int sent, int total) {
+            progress.append({sent, total});
+        };
+
+        QList<Range> sent;
+        const bool   ok = runChunkedUpload<Range>(
+            7, upload, [](int begin, int end) { return Range(begin, end); },
+            [&sent](Range chunk, int begin, int end) {
+                // The chunk was encoded for exactly this range
+                if (chunk != Range(begin, end))
+                    return false;
+                sent.append(chunk);
+                return true;
+            });
+
+        QVERIFY(ok);
+        QCOMPARE(sent, (QList<Range>{{0, 3}, {3, 6}, {6, 7}}));
+        QCOMPARE(progress, (QList<Range>{{3, 7}, {6, 7}, {7, 7}}));
+    }
+
+    void stopsAtFirstFailedChunk()
+    {
+        ChunkedUpload upload;
+        upload.maxItems = 2;
+        int reported    = 0;
+        upload.progress = [&reported](int sent, int) { reported = sent; };
+
+        int        attempts = 0;
+        const bool ok       = runChunkedUpload<Range>(
+            10, upload, [](int begin, int end) { return Range(begin, end); },
+            [&attempts](Range, int begin, int) {
+                ++attempts;
+                return begin < 4;
+            });
+
+        QVERIFY(!ok);
+        QCOMPARE(attempts, 3);
+        QCOMPARE(reported, 4);
+    }
+
+    void emptyUploadSendsNothing()
+    {
+        int        encoded = 0;
+        const bool ok      = runChunkedUpload<Range>(
+            0, ChunkedUpload(),
+            [&encoded](int begin, int end) {
+                ++encoded;
+                return Range(begin, end);
+            },
+            [](Range, int, int) { return false; });
+        QVERIFY(ok);
+        QCOMPARE(encoded, 0);
+    }
+};
+
+QTEST_MAIN(ChunkedUploadTest)
+#include "ChunkedUploadTest.moc"
@@ -92,14 +92,14 @@ private slots:
         c.toTerminalId   = "B";
         c.mode           = Mode::Truck;
         c.region         = "R";
-        doc.connections.append(c);
+        doc.replaceRelationships({}, {c}, {});
 
         auto *line = Scenario::ConnectionLineFactory::fromConnection(
-            &doc, &doc.connections.first(), &scene, nullptr);
+            &doc, &doc.connections().first(), &scene, nullptr);
 
         QVERIFY(line != nullptr);
         QVERIFY(line->isConnectionBinding());
-        QCOMPARE(line->connectionModel(), &doc.connections.first());
+        QCOMPARE(line->connectionModel(), &doc.connections().first());
         QCOMPARE(line->globalLinkModel(),
                  static_cast<GlobalLink *>(nullptr));
         QVERIFY(scene.items().contains(line));
@@ -135,14 +135,14 @@ private slots:
         g.fromTerminalId = "A";  // same string as the registry key
         g.toTerminalId   = "B";
         g.mode           = Mode::Ship;
-        doc.globalLinks.append(g);
+        doc.replaceRelationships({}, {}, {g});
 
         auto *line = Scenario::ConnectionLineFactory::fromGlobalLink(
-            &doc, &doc.globalLinks.first(), &scene, nullptr);
+            &doc, &doc.globalLinks().first(), &scene, nullptr);
 
         QVERIFY(line != nullptr);
         QVERIFY(line->isGlobalLinkBinding());
-        QCOMPARE(line->globalLinkModel(), &doc.globalLinks.first());
+        QCOMPARE(line->globalLinkModel(), &doc.globalLinks().first());
         QCOMPARE(line->connectionModel(),
                  static_cast<Connection *>(nullptr));
     }
@@ -47,7 +47,10 @@ void seedConnection(ScenarioDocument *doc,
     c.toTerminalId   = to;
     c.mode           = mode;
     c.region         = region;
-    doc->connections.append(c);
+    QList<Connection> connections = doc->connections();
+    connections.append(c);
+    doc->replaceRelationships(doc->linkages(), connections,
+                              doc->globalLinks());
 }
 
 void seedGlobalLink(ScenarioDocument *doc,
@@ -57,7 +60,10 @@ void seedGlobalLink(ScenarioDocument *doc,
     g.fromTerminalId = from;
     g.toTerminalId   = to;
     g.mode           = mode;
-    doc->globalLinks.append(g);
+    QList<GlobalLink> globalLinks = doc->globalLinks();
+    globalLinks.append(g);
+    doc->replaceRelationships(doc->linkages(), doc->connections(),
+                              globalLinks);
 }
 
 } // namespace
@@ -87,7 +93,7 @@ private slots:
 
         line.bindToConnection(&doc, "A", "B", Mode::Truck);
         QVERIFY(line.isConnectionBinding());
-        QCOMPARE(line.connectionModel(), &doc.connections.first());
+        QCOMPARE(line.connectionModel(), &doc.connections().first());
         QVERIFY(line.globalLinkModel() == nullptr);
     }
 
@@ -99,7 +105,7 @@ private slots:
         seedConnection(&doc, "A", "B", Mode::Truck, "R");
         line.bindToConnection(&doc, "A", "B", Mode::Truck);
 
-        doc.connections.clear();
+        doc.replaceRelationships(doc.linkages(), {}, doc.globalLinks());
 
         // The stored key still claims a Connection binding, but the lookup
         // returns nullptr cleanly — no dangling pointer, no UB.
@@ -118,13 +124,13 @@ private slots:
 
         line.bindToConnection(&doc, "A", "B", Mode::Truck);
         QVERIFY(line.isConnectionBinding());
-        QCOMPARE(line.connectionModel(), &doc.connections.first());
+        QCOMPARE(line.connectionModel(), &doc.connections().first());
 
         // Switch to GlobalLink — connection binding must clear.
         line.bindToGlobalLink(&doc, "R1/A", "R2/B", Mode::Ship);
         QVERIFY(line.isGlobalLinkBinding());
         QVERIFY(!line.isConnectionBinding());
-        QCOMPARE(line.globalLinkModel(), &doc.globalLinks.first());
+        QCOMPARE(line.globalLinkModel(), &doc.globalLinks().first());
         QCOMPARE(line.connectionModel(),
                  static_cast<Connection *>(nullptr));
 
@@ -132,7 +138,7 @@ private slots:
         line.bindToConnection(&doc, "A", "B", Mode::Truck);
         QVERIFY(line.isConnectionBinding());
         QVERIFY(!line.isGlobalLinkBinding());
-        QCOMPARE(line.connectionModel(), &doc.connections.first());
+        QCOMPARE(line.connectionModel(), &doc.connections().first());
         QCOMPARE(line.globalLinkModel(),
                  static_cast<GlobalLink *>(nullptr));
     }
@@ -162,7 +168,7 @@ private slots:
         seedGlobalLink(&doc, "R1/A", "R2/B", Mode::Ship);
 
         line.bindToGlobalLink(&doc, "R1/A", "R2/B", Mode::Ship);
-        QCOMPARE(line.globalLinkModel(), &doc.globalLinks.first());
+        QCOMPARE(line.globalLinkModel(), &doc.globalLinks().first());
         QVERIFY(line.connectionModel() == nullptr);
     }
 };
@@ -0,0 +1,129 @@
+#include <QPointer>
+#include <QTest>
+
+#include "GUI/Items/MapLine.h"
+#include "GUI/Items/TerminalItem.h"
+#include "GUI/Widgets/GraphicsScene.h"
+
+using namespace CargoNetSim::GUI;
+
+namespace {
+
+MapLine *makeLine(int n)
+{
+    const QPointF start(n * 10.0, 0.0);
+    return new MapLine(QString::number(n), start,
+                       start + QPointF(5.0, 0.0), "R");
+}
+
+/// Registers lines "l0".."l<count-1>" in one bulk call.
+void addLines(GraphicsScene &scene, int count)
+{
+    QList<QPair<GraphicsObjectBase *, QString>> batch;
+    for (int n = 0; n < count; ++n)
+        batch.append({makeLine(n), QStringLiteral("l%1").arg(n)});
+    scene.addItemsWithIds(batch);
+}
+
+} // namespace
+
+class GraphicsSceneRegistryTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_views_iterate_registered_items_with_ids()
+    {
+        GraphicsScene scene;
+        addLines(scene, 5);
+
+        QCOMPARE(scene.countOfType<MapLine>(), 5);
+        QCOMPARE(scene.items().size(), 5 + 1); // + network layer
+
+        QSet<QString> keys;
+        const auto view = scene.itemsOfType<MapLine>();
+        for (auto it = view.begin(); it != view.end(); ++it)
+        {
+            QCOMPARE(*it, scene.getItemById<MapLine>(it.key()));
+            keys.insert(it.key());
+        }
+        QCOMPARE(keys.size(), 5);
+        QVERIFY(keys.contains(QStringLiteral("l3")));
+
+        QVERIFY(scene.itemsOfType<TerminalItem>().isEmpty());
+        QVERIFY(!scene.getItemById<TerminalItem>(QStringLiteral("l3")));
+    }
+
+    void test_bulk_remove_skips_unknown_ids()
+    {
+        GraphicsScene scene;
+        addLines(scene, 4);
+        QPointer<MapLine> doomed =
+            scene.getItemById<MapLine>(QStringLiteral("l1"));
+
+        const int removed = scene.removeItemsWithIds<MapLine>(
+            {QStringLiteral("l1"), QStringLiteral("l2"),
+             QStringLiteral("missing")});
+        QCOMPARE(removed, 2);
+        QVERIFY(doomed.isNull());
+        QCOMPARE(scene.countOfType<MapLine>(), 2);
+        QVERIFY(!scene.removeItemWithId<MapLine>(QStringLiteral("l1")));
+        QVERIFY(scene.removeItemWithId<MapLine>(QStringLiteral("l0")));
+        QCOMPARE(scene.countOfType<MapLine>(), 1);
+    }
+
+    void test_destroyed_prunes_only_its_own_entry()
+    {
+        GraphicsScene scene;
+        MapLine *first = makeLine(0);
+        scene.addItemWithId(first, QStringLiteral("same"));
+        MapLine *second = makeLine(1);
+        scene.addItemWithId(second, QStringLiteral("same"));
+
+        // The id now names `second`; destroying the item it replaced
+        // must not unregister it.
+        delete first;
+        QCOMPARE(scene.getItemById<MapLine>(QStringLiteral("same")),
+                 second);
+
+        delete second;
+        QCOMPARE(scene.countOfType<MapLine>(), 0);
+    }
+
+    void test_set_items_visible_applies_predicate()
+    {
+        GraphicsScene scene;
+        addLines(scene, 6);
+
+        const int hidden = scene.setItemsVisible<MapLine>(
+            false, [](MapLine *line) {
+                return line->getReferencedNetworkLinkID().toInt() % 2
+                       == 0;
+            });
+        QCOMPARE(hidden, 3);
+        QVERIFY(!scene.getItemById<MapLine>(QStringLiteral("l2"))
+                     ->isVisible());
+        QVERIFY(scene.getItemById<MapLine>(QStringLiteral("l3"))
+                    ->isVisible());
+
+        // Already hidden items are not counted again.
+        QCOMPARE(scene.setItemsVisible<MapLine>(
+                     false, [](MapLine *) { return true; }),
+                 3);
+    }
+
+    void test_remove_items_not_of_type_keeps_listed_types()
+    {
+        GraphicsScene scene;
+        addLines(scene, 3);
+
+        scene.removeItemsNotOfType({MapLine::Type});
+        QCOMPARE(scene.countOfType<MapLine>(), 3);
+
+        scene.removeItemsNotOfType({TerminalItem::Type});
+        QCOMPARE(scene.countOfType<MapLine>(), 0);
+        QCOMPARE(scene.items().size(), 1); // network layer only
+    }
+};
+
+QTEST_MAIN(GraphicsSceneRegistryTest)
+#include "GraphicsSceneRegistryTest.moc"
@@ -0,0 +1,118 @@
+#include <QTest>
+
+#include "GUI/Items/MapLine.h"
+#include "GUI/Items/NetworkLayerItem.h"
+#include "GUI/Widgets/GraphicsScene.h"
+
+using namespace CargoNetSim::GUI;
+
+namespace {
+
+constexpr int kColumns = 60;
+constexpr int kRows    = 50;
+
+QString lineId(int row, int col)
+{
+    return QStringLiteral("link-%1-%2").arg(row).arg(col);
+}
+
+/// kRows x kColumns short horizontal links, 10 units apart.
+void addGrid(GraphicsScene &scene)
+{
+    for (int row = 0; row < kRows; ++row)
+        for (int col = 0; col < kColumns; ++col)
+        {
+            const QPointF start(col * 10.0, row * 10.0);
+            scene.addItemWithId(
+                new MapLine(QString::number(row * kColumns + col),
+                            start, start + QPointF(5.0, 0.0), "R"),
+                lineId(row, col));
+        }
+}
+
+const QRectF kEverything(-10.0, -10.0, 700.0, 600.0);
+
+} // namespace
+
+class NetworkLayerItemTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_full_viewport_over_budget_batches_every_item()
+    {
+        GraphicsScene scene;
+        addGrid(scene);
+        NetworkLayerItem *layer = scene.networkLayer();
+        QVERIFY(layer);
+        QVERIFY(kRows * kColumns > NetworkLayerItem::kDetailBudget);
+
+        scene.updateNetworkDetail(kEverything, 1.0);
+        QCOMPARE(layer->batchedCount(), kRows * kColumns);
+
+        MapLine *line = scene.getItemById<MapLine>(lineId(10, 10));
+        QVERIFY(line->isBatched());
+        QVERIFY(!line->contains(QPointF(102.5, 100.0)));
+        QVERIFY(line->flags() & QGraphicsItem::ItemHasNoContents);
+    }
+
+    void test_small_viewport_hands_items_back()
+    {
+        GraphicsScene scene;
+        addGrid(scene);
+        NetworkLayerItem *layer = scene.networkLayer();
+        scene.updateNetworkDetail(kEverything, 1.0);
+
+        // Row 0, columns 0..2 only.
+        scene.updateNetworkDetail(QRectF(-1.0, -1.0, 27.0, 2.0), 1.0);
+        QCOMPARE(layer->batchedCount(), kRows * kColumns - 3);
+        QVERIFY(!scene.getItemById<MapLine>(lineId(0, 2))->isBatched());
+        QVERIFY(scene.getItemById<MapLine>(lineId(0, 3))->isBatched());
+        QVERIFY(scene.getItemById<MapLine>(lineId(0, 0))
+                    ->contains(QPointF(2.5, 0.0)));
+    }
+
+    void test_spatial_index_hit_tests_batched_items_only()
+    {
+        GraphicsScene scene;
+        addGrid(scene);
+        NetworkLayerItem *layer = scene.networkLayer();
+        scene.updateNetworkDetail(QRectF(-1.0, -1.0, 27.0, 2.0), 1.0);
+
+        QCOMPARE(layer->batchedItemAt(QPointF(102.5, 101.0)),
+                 scene.getItemById<MapLine>(lineId(10, 10)));
+        // Detailed items answer for themselves.
+        QVERIFY(layer->batchedItemAt(QPointF(2.5, 0.0)) == nullptr);
+        QVERIFY(layer->batchedItemAt(QPointF(-500.0, -500.0))
+                == nullptr);
+
+        const QList<QGraphicsItem *> hits =
+            scene.items(QPointF(102.5, 101.0));
+        QVERIFY(hits.contains(layer));
+        QVERIFY(!hits.contains(
+            scene.getItemById<MapLine>(lineId(10, 10))));
+    }
+
+    void test_registry_changes_reindex_the_layer()
+    {
+        GraphicsScene scene;
+        addGrid(scene);
+        NetworkLayerItem *layer = scene.networkLayer();
+        scene.updateNetworkDetail(kEverything, 1.0);
+
+        QVERIFY(scene.removeItemWithId<MapLine>(lineId(10, 10)));
+        // The snapshot is stale until the next rebuild.
+        QVERIFY(layer->batchedItemAt(QPointF(102.5, 101.0)) == nullptr);
+        scene.updateNetworkDetail(kEverything, 1.0);
+        QCOMPARE(layer->batchedCount(), kRows * kColumns - 1);
+        QVERIFY(layer->batchedItemAt(QPointF(102.5, 101.0)) == nullptr);
+
+        scene.getItemById<MapLine>(lineId(20, 20))
+            ->setPoints(QPointF(1000.0, 1000.0), QPointF(1005.0, 1000.0));
+        scene.updateNetworkDetail(kEverything, 1.0);
+        QCOMPARE(layer->batchedItemAt(QPointF(1002.5, 1000.0)),
+                 scene.getItemById<MapLine>(lineId(20, 20)));
+    }
+};
+
+QTEST_MAIN(NetworkLayerItemTest)
+#include "NetworkLayerItemTest.moc"
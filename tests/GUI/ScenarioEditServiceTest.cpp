@@ -132,9 +132,9 @@ private slots:
 
         QVERIFY(ok);
         QCOMPARE(linkSpy.count(), 1);
-        QCOMPARE(doc.linkages.size(), 1);
-        QCOMPARE(doc.linkages.first().networkName, QString("rail_net_a"));
-        QCOMPARE(doc.linkages.first().nodeId, 42);
+        QCOMPARE(doc.linkages().size(), 1);
+        QCOMPARE(doc.linkages().first().networkName, QString("rail_net_a"));
+        QCOMPARE(doc.linkages().first().nodeId, 42);
     }
 
     void test_create_connection_fills_region_from_endpoints()
@@ -153,9 +153,9 @@ private slots:
 
         QVERIFY(ok);
         QCOMPARE(connSpy.count(), 1);
-        QCOMPARE(doc.connections.size(), 1);
+        QCOMPARE(doc.connections().size(), 1);
         // Invariant: region is derived from endpoints, not passed by caller.
-        QCOMPARE(doc.connections.first().region, QString("R"));
+        QCOMPARE(doc.connections().first().region, QString("R"));
     }
 
     void test_create_connection_rejects_cross_region_endpoints()
@@ -169,7 +169,7 @@ private slots:
             &doc, "Sea Port Terminal", "R2", QPointF(1, 1));
 
         QVERIFY(!ScenarioEditService::createConnection(&doc, a, b, Mode::Ship));
-        QVERIFY(doc.connections.isEmpty());
+        QVERIFY(doc.connections().isEmpty());
     }
 
     void test_update_region_local_origin_emits_region_changed()
@@ -200,16 +200,16 @@ private slots:
         // Missing terminal → reject.
         QVERIFY(!ScenarioEditService::createGlobalLink(
             &doc, "does-not-exist", b, Mode::Ship));
-        QVERIFY(doc.globalLinks.isEmpty());
+        QVERIFY(doc.globalLinks().isEmpty());
 
         // Both present → accept, emit globalLinkAdded.
         QSignalSpy spy(&doc, &ScenarioDocument::globalLinkAdded);
         QVERIFY(ScenarioEditService::createGlobalLink(&doc, a, b, Mode::Ship));
         QCOMPARE(spy.count(), 1);
-        QCOMPARE(doc.globalLinks.size(), 1);
-        QCOMPARE(doc.globalLinks.first().fromTerminalId, a);
-        QCOMPARE(doc.globalLinks.first().toTerminalId, b);
-        QCOMPARE(doc.globalLinks.first().mode, Mode::Ship);
+        QCOMPARE(doc.globalLinks().size(), 1);
+        QCOMPARE(doc.globalLinks().first().fromTerminalId, a);
+        QCOMPARE(doc.globalLinks().first().toTerminalId, b);
+        QCOMPARE(doc.globalLinks().first().mode, Mode::Ship);
     }
 
     void test_remove_global_link_drops_from_document()
@@ -225,7 +225,7 @@ private slots:
 
         QSignalSpy spy(&doc, &ScenarioDocument::globalLinkRemoved);
         QVERIFY(ScenarioEditService::removeGlobalLink(&doc, a, b, Mode::Ship));
-        QVERIFY(doc.globalLinks.isEmpty());
+        QVERIFY(doc.globalLinks().isEmpty());
         QCOMPARE(spy.count(), 1);
     }
 
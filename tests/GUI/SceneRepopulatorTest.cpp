@@ -10,6 +10,7 @@
 #include "GUI/Items/ConnectionLine.h"
 #include "GUI/Items/RegionCenterPoint.h"
 #include "GUI/Items/TerminalItem.h"
+#include "GUI/Scenario/ConnectionLineFactory.h"
 #include "GUI/Scenario/SceneRepopulator.h"
 #include "GUI/Widgets/GraphicsScene.h"
 
@@ -166,7 +167,7 @@ private slots:
         }
 
         // Each ConnectionLine carries a non-null Connection* pointing into
-        // doc.connections — observer round-trip wired model to view.
+        // doc.connections() — observer round-trip wired model to view.
         const auto lines = region.getItemsByType<ConnectionLine>();
         QCOMPARE(lines.size(), 2);
         QSet<const Connection *> seen;
@@ -174,7 +175,7 @@ private slots:
         {
             auto *m = line->connectionModel();
             QVERIFY(m != nullptr);
-            QVERIFY(m == &doc.connections[0] || m == &doc.connections[1]);
+            QVERIFY(m == &doc.connections()[0] || m == &doc.connections()[1]);
             seen.insert(m);
         }
         QCOMPARE(seen.size(), 2);
@@ -183,7 +184,7 @@ private slots:
     void test_repopulate_is_idempotent()
     {
         // Running repopulate twice must produce the same scene as running
-        // it once — tears down via clearAll first.
+        // it once — the second run finds nothing to create or delete.
         ScenarioDocument doc;
         RegionSpec r; r.name = "R"; r.color = "#888888";
         doc.addRegion(r);
@@ -201,6 +202,69 @@ private slots:
             &doc, &region, &global, nullptr);
         QCOMPARE(region.items().count(), firstCount);
     }
+
+    void test_repopulate_reconciles_instead_of_rebuilding()
+    {
+        // Items whose entity survives keep their identity; only the
+        // difference is created or deleted.
+        using Mode = CargoNetSim::Backend::TransportationTypes::TransportationMode;
+        ScenarioDocument doc;
+        RegionSpec r; r.name = "R"; r.color = "#888888";
+        QVERIFY(doc.addRegion(r));
+        auto makeTerm = [](const QString &id, double lat) {
+            TerminalPlacement t;
+            t.id = id; t.type = "Sea Port Terminal"; t.region = "R";
+            t.mode = TerminalPlacement::PositionMode::LatLon;
+            t.latLon = { lat, 20.0 };
+            return t;
+        };
+        QVERIFY(doc.addTerminal(makeTerm("A", 10.0)));
+        QVERIFY(doc.addTerminal(makeTerm("B", 11.0)));
+        QVERIFY(doc.addTerminal(makeTerm("C", 12.0)));
+        Connection ab;
+        ab.fromTerminalId = "A"; ab.toTerminalId = "B";
+        ab.mode = Mode::Ship; ab.region = "R";
+        Connection bc;
+        bc.fromTerminalId = "B"; bc.toTerminalId = "C";
+        bc.mode = Mode::Ship; bc.region = "R";
+        QVERIFY(doc.addConnection(ab));
+        QVERIFY(doc.addConnection(bc));
+
+        GraphicsScene region, global;
+        Scenario::SceneRepopulator::repopulate(
+            &doc, &region, &global, nullptr);
+        auto *center = region.getItemsByType<RegionCenterPoint>().value(0);
+        auto *termA  = region.getItemById<TerminalItem>("A");
+        auto *lineAB = Scenario::ConnectionLineFactory::findRegionConnection(
+            &region, "A", "B", Mode::Ship);
+        QVERIFY(center && termA && lineAB);
+
+        // C goes (and with it B→C), D arrives, A moves.
+        QVERIFY(doc.removeTerminal("C"));
+        QVERIFY(doc.addTerminal(makeTerm("D", 13.0)));
+        auto movedA = makeTerm("A", 15.0);
+        QVERIFY(doc.updateTerminal("A", movedA));
+        const QPointF oldPosA = termA->pos();
+
+        Scenario::SceneRepopulator::repopulate(
+            &doc, &region, &global, nullptr);
+
+        QCOMPARE(countOfType(region, typeid(RegionCenterPoint).name()), 1);
+        QCOMPARE(countOfType(region, typeid(TerminalItem).name()),      3);
+        QCOMPARE(countOfType(region, typeid(ConnectionLine).name()),    1);
+        QCOMPARE(region.getItemsByType<RegionCenterPoint>().value(0),
+                 center);
+        QCOMPARE(region.getItemById<TerminalItem>("A"), termA);
+        QCOMPARE(termA->placement(), &doc.terminals["A"]);
+        QVERIFY(termA->pos() != oldPosA);
+        QVERIFY(region.getItemById<TerminalItem>("C") == nullptr);
+        QVERIFY(region.getItemById<TerminalItem>("D") != nullptr);
+        QCOMPARE(Scenario::ConnectionLineFactory::findRegionConnection(
+                     &region, "A", "B", Mode::Ship),
+                 lineAB);
+        QVERIFY(Scenario::ConnectionLineFactory::findRegionConnection(
+                    &region, "B", "C", Mode::Ship) == nullptr);
+    }
 };
 
 QTEST_MAIN(SceneRepopulatorTest)
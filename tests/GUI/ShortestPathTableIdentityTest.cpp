@@ -1,9 +1,12 @@
 #include <QApplication>
-#include <QCheckBox>
 #include <QCoreApplication>
+#include <QIcon>
 #include <QJsonArray>
 #include <QJsonObject>
-#include <QTableWidget>
+#include <QLineEdit>
+#include <QSignalSpy>
+#include <QSortFilterProxyModel>
+#include <QTableView>
 #include <QTest>
 
 #include "Backend/Controllers/CargoNetSimController.h"
@@ -13,6 +16,7 @@
 #include "Backend/Scenario/ScenarioExecutionResult.h"
 #include "Backend/Scenario/ScenarioDocument.h"
 #include "GUI/Widgets/ShortestPathTable.h"
+#include "GUI/Widgets/ShortestPathsModel.h"
 
 using CargoNetSim::Backend::Path;
 using CargoNetSim::Backend::Scenario::PathMetrics;
@@ -22,6 +26,7 @@ using CargoNetSim::Backend::Scenario::PathExecutionResult;
 using CargoNetSim::Backend::Scenario::SegmentExecutionResult;
 using CargoNetSim::Backend::Scenario::TerminalExecutionResult;
 using CargoNetSim::Backend::Scenario::ScenarioDocument;
+using CargoNetSim::GUI::ShortestPathsModel;
 using CargoNetSim::GUI::ShortestPathsTable;
 
 namespace
@@ -99,18 +104,24 @@ PathMetrics predictedMetricWithBreakdown(
     return m;
 }
 
-QCheckBox *rowCheckbox(ShortestPathsTable &table, int row)
+QModelIndex viewCell(ShortestPathsTable &table, int row, int column)
 {
-    auto *tableWidget = table.findChild<QTableWidget *>();
-    if (!tableWidget)
-        return nullptr;
-
-    auto *checkboxWidget = tableWidget->cellWidget(row, 0);
-    if (!checkboxWidget || !checkboxWidget->layout())
-        return nullptr;
+    auto *view = table.findChild<QTableView *>();
+    if (!view || !view->model())
+        return {};
+    return view->model()->index(row, column);
+}
 
-    return qobject_cast<QCheckBox *>(
-        checkboxWidget->layout()->itemAt(0)->widget());
+PathExecutionResult costResult(const QString &pathKey, double total)
+{
+    PathExecutionResult result;
+    result.executionPathKey = pathKey;
+    result.canonicalPathKey = pathKey;
+    result.pathIdentity     = pathKey;
+    result.totalCost        = total;
+    result.edgeCosts        = total;
+    result.terminalCosts    = 0.0;
+    return result;
 }
 
 } // namespace
@@ -151,18 +162,19 @@ private slots:
         QVERIFY(table.getDataByPathKey(firstKey) != nullptr);
         QVERIFY(table.getDataByPathKey(secondKey) != nullptr);
 
-        auto *tableWidget = table.findChild<QTableWidget *>();
-        QVERIFY(tableWidget != nullptr);
-        QCOMPARE(tableWidget->rowCount(), 2);
+        auto *view = table.findChild<QTableView *>();
+        QVERIFY(view != nullptr);
+        QCOMPARE(view->model()->rowCount(), 2);
 
-        tableWidget->selectRow(1);
+        view->selectRow(1);
         QCoreApplication::processEvents();
         QCOMPARE(table.getSelectedPathKey(), secondKey);
 
-        auto *firstCheckbox = rowCheckbox(table, 0);
-        QVERIFY(firstCheckbox != nullptr);
-        firstCheckbox->setChecked(true);
-        QCoreApplication::processEvents();
+        const QModelIndex firstCheckbox =
+            viewCell(table, 0, ShortestPathsModel::ColumnSelect);
+        QVERIFY(firstCheckbox.isValid());
+        QVERIFY(view->model()->setData(firstCheckbox, Qt::Checked,
+                                       Qt::CheckStateRole));
         QCOMPARE(table.getCheckedPathKeys(),
                  QVector<QString>{firstKey});
 
@@ -225,16 +237,22 @@ private slots:
 
         table.setPathEligibility({{pathKey, blocked}});
 
-        auto *checkbox = rowCheckbox(table, 0);
-        QVERIFY(checkbox != nullptr);
-        QVERIFY(!checkbox->isEnabled());
-
-        auto *tableWidget = table.findChild<QTableWidget *>();
-        QVERIFY(tableWidget != nullptr);
-        QVERIFY(!tableWidget->item(0, 2)->icon().isNull());
-        QVERIFY(tableWidget->item(0, 2)->toolTip().contains(
+        const QModelIndex checkbox =
+            viewCell(table, 0, ShortestPathsModel::ColumnSelect);
+        QVERIFY(checkbox.isValid());
+        QVERIFY(!(checkbox.flags() & Qt::ItemIsEnabled));
+        QVERIFY(!checkbox.model()->setData(
+            checkbox, Qt::Checked, Qt::CheckStateRole));
+
+        const QModelIndex status =
+            viewCell(table, 0, ShortestPathsModel::ColumnStatus);
+        QVERIFY(status.isValid());
+        QVERIFY(!qvariant_cast<QIcon>(status.data(Qt::DecorationRole))
+                     .isNull());
+        const QString statusTip = status.data(Qt::ToolTipRole).toString();
+        QVERIFY(statusTip.contains(
             QStringLiteral("Simulation unavailable")));
-        QVERIFY(!tableWidget->item(0, 2)->toolTip().contains(pathKey));
+        QVERIFY(!statusTip.contains(pathKey));
         QVERIFY(table.getCheckedPathKeys().isEmpty());
 
         auto *banner = table.findChild<QLabel *>(
@@ -369,11 +387,12 @@ private slots:
                        {{pathKey, predictedMetricWithBreakdown(
                                       10.0, 3, breakdown)}});
 
-        auto *tableWidget = table.findChild<QTableWidget *>();
-        QVERIFY(tableWidget != nullptr);
-        QCOMPARE(tableWidget->item(0, 18)->text(),
+        const QModelIndex vehicles =
+            viewCell(table, 0, ShortestPathsModel::ColumnVehicles);
+        QVERIFY(vehicles.isValid());
+        QCOMPARE(vehicles.data().toString(),
                  QStringLiteral("Truck x3 | Train x1"));
-        QVERIFY(tableWidget->item(0, 18)->toolTip().contains(
+        QVERIFY(vehicles.data(Qt::ToolTipRole).toString().contains(
             QStringLiteral("Truck x3 | Train x1")));
 
         ScenarioDocument doc;
@@ -413,6 +432,75 @@ private slots:
                      CargoNetSim::Backend::TransportationTypes::
                          TransportationMode::Train));
     }
+
+    void test_sort_filter_and_batched_result_updates()
+    {
+        ShortestPathsTable table;
+
+        const QString firstKey = QStringLiteral("uid-A-B-r0");
+        const QString secondKey = QStringLiteral("uid-C-D-r0");
+        const QString thirdKey = QStringLiteral("uid-E-F-r0");
+        table.addPaths(
+            {makePath(1, firstKey, QStringLiteral("A"),
+                      QStringLiteral("B"), 30.0),
+             makePath(2, secondKey, QStringLiteral("C"),
+                      QStringLiteral("D"), 10.0),
+             makePath(3, thirdKey, QStringLiteral("E"),
+                      QStringLiteral("F"), 20.0)});
+
+        auto *view = table.findChild<QTableView *>();
+        QVERIFY(view != nullptr);
+        auto *proxy =
+            qobject_cast<QSortFilterProxyModel *>(view->model());
+        QVERIFY(proxy != nullptr);
+        auto *source = proxy->sourceModel();
+
+        // Insertion order until a header is clicked.
+        QCOMPARE(proxy->index(0, 0)
+                     .data(ShortestPathsModel::PathKeyRole)
+                     .toString(),
+                 firstKey);
+
+        view->sortByColumn(ShortestPathsModel::ColumnPredictedCost,
+                           Qt::AscendingOrder);
+        QCOMPARE(proxy->index(0, 0)
+                     .data(ShortestPathsModel::PathKeyRole)
+                     .toString(),
+                 secondKey);
+        QCOMPARE(proxy->index(2, 0)
+                     .data(ShortestPathsModel::PathKeyRole)
+                     .toString(),
+                 firstKey);
+
+        auto *filter = table.findChild<QLineEdit *>(
+            QStringLiteral("pathFilterEdit"));
+        QVERIFY(filter != nullptr);
+        filter->setText(QStringLiteral("f"));
+        QCOMPARE(proxy->rowCount(), 1);
+        QCOMPARE(proxy->index(0, 0)
+                     .data(ShortestPathsModel::PathKeyRole)
+                     .toString(),
+                 thirdKey);
+        filter->clear();
+        QCOMPARE(proxy->rowCount(), 3);
+
+        // Results for every row land as one contiguous change.
+        QSignalSpy changed(source, &QAbstractItemModel::dataChanged);
+        ScenarioExecutionResultSet results;
+        results.addPathResult(costResult(firstKey, 33.0));
+        results.addPathResult(costResult(secondKey, 11.0));
+        results.addPathResult(costResult(thirdKey, 22.0));
+        table.setExecutionResults(results);
+
+        QCOMPARE(changed.count(), 1);
+        QCOMPARE(source
+                     ->index(0, ShortestPathsModel::ColumnActualCost)
+                     .data()
+                     .toString(),
+                 QStringLiteral("33.00"));
+        QCOMPARE(table.getDataByPathKey(thirdKey)->simulationTotalCost,
+                 22.0);
+    }
 };
 
 QTEST_MAIN(ShortestPathTableIdentityTest)
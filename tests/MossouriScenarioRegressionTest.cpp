@@ -220,9 +220,9 @@ private:
             }
         };
 
-        for (const auto &connection : doc.connections)
+        for (const auto &connection : doc.connections())
             addModeServer(connection.mode);
-        for (const auto &globalLink : doc.globalLinks)
+        for (const auto &globalLink : doc.globalLinks())
             addModeServer(globalLink.mode);
 
         return QStringList(servers.begin(), servers.end());
@@ -395,11 +395,11 @@ private slots:
         QCOMPARE(jsonContainerSize(root.value(QStringLiteral("terminals"))),
                  scenarioDoc->terminals.size());
         QCOMPARE(jsonContainerSize(root.value(QStringLiteral("linkages"))),
-                 scenarioDoc->linkages.size());
+                 scenarioDoc->linkages().size());
         QCOMPARE(jsonContainerSize(root.value(QStringLiteral("connections"))),
-                 scenarioDoc->connections.size());
+                 scenarioDoc->connections().size());
         QCOMPARE(jsonContainerSize(root.value(QStringLiteral("global_links"))),
-                 scenarioDoc->globalLinks.size());
+                 scenarioDoc->globalLinks().size());
 
         const QJsonObject outputObject =
             root.value(QStringLiteral("output")).toObject();
@@ -0,0 +1,158 @@
+#include <QCryptographicHash>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "Backend/Commons/DirectedGraph.h"
+#include "Backend/Commons/NetworkImage.h"
+
+using namespace CargoNetSim::Backend;
+
+namespace
+{
+
+QByteArray digestOf(const QByteArray &seed)
+{
+    return QCryptographicHash::hash(seed, QCryptographicHash::Sha256);
+}
+
+/// Diamond with a tie: 1 -> {2, 3} -> 4 cost 20 either way, plus a
+/// slower shortcut 1 -> 4 and an isolated node 5.
+void addEdge(DirectedGraph<int> &graph, NetworkImage::Builder &builder,
+             int from, int to, float metres, float speed, int linkId)
+{
+    QMap<QString, QVariant> attributes;
+    attributes["max_speed"] = speed;
+    graph.addEdge(from, to, metres, attributes);
+    builder.addEdge(from, to, metres, speed, linkId, metres,
+                    metres / speed);
+}
+
+void buildDiamond(DirectedGraph<int> &graph, NetworkImage::Builder &builder)
+{
+    for (int id : {4, 2, 5, 1, 3})
+    {
+        graph.addNode(id);
+        builder.addNode(id, id * 10.0, -id * 10.0);
+    }
+    builder.addLink(12, 1, 2, 10.0, 1.0);
+    builder.addLink(13, 1, 3, 10.0, 2.0);
+    builder.addLink(24, 2, 4, 10.0, 1.0);
+    builder.addLink(34, 3, 4, 10.0, 2.0);
+    builder.addLink(14, 1, 4, 25.0, 5.0);
+    addEdge(graph, builder, 1, 3, 10.0f, 2.0f, 13);
+    addEdge(graph, builder, 1, 2, 10.0f, 1.0f, 12);
+    addEdge(graph, builder, 2, 4, 10.0f, 1.0f, 24);
+    addEdge(graph, builder, 3, 4, 10.0f, 2.0f, 34);
+    addEdge(graph, builder, 1, 4, 25.0f, 5.0f, 14);
+    builder.addAttribute(NetworkImage::Scope::Link, QStringLiteral("grade"),
+                         {0.1, 0.2, 0.3, 0.4, 0.5});
+}
+
+} // namespace
+
+class NetworkImageTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void searchesMatchDirectedGraph()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        DirectedGraph<int>    graph;
+        NetworkImage::Builder builder;
+        buildDiamond(graph, builder);
+        const QString    path   = dir.filePath(QStringLiteral("net.img"));
+        const QByteArray digest = digestOf("diamond");
+        QVERIFY(NetworkImage::store(path, builder, digest));
+
+        auto image = NetworkImage::open(path, digest);
+        QVERIFY(image);
+        QCOMPARE(image->nodeCount(), 5);
+        QCOMPARE(image->linkCount(), 5);
+        QCOMPARE(image->edgeCount(), 5);
+        QCOMPARE(image->nodeId(0), 1);
+        QCOMPARE(image->nodeX(image->nodeIndex(3)), 30.0);
+        QVERIFY(!image->hasNode(9));
+
+        const double *grade =
+            image->attribute(NetworkImage::Scope::Link,
+                             QStringLiteral("grade"));
+        QVERIFY(grade);
+        QCOMPARE(grade[4], 0.5);
+
+        for (const auto &[metric, name] :
+             {std::pair{NetworkImage::Metric::Distance, "distance"},
+              std::pair{NetworkImage::Metric::Time, "time"}})
+        {
+            const auto results = image->findShortestPaths(
+                1, {4, 3, 5, 9}, metric);
+            const auto expected = graph.findShortestPaths(
+                1, {4, 3, 5, 9}, QString::fromLatin1(name));
+            QCOMPARE(results.size(), 4);
+            for (auto it = expected.constBegin(); it != expected.constEnd();
+                 ++it)
+                QCOMPARE(results.value(it.key()).pathNodes, it.value());
+        }
+
+        const ShortestPathResult byTime =
+            image->findShortestPath(1, 4, NetworkImage::Metric::Time);
+        QCOMPARE(byTime.pathNodes, (QVector<int>{1, 4}));
+        QCOMPARE(byTime.pathLinks, (QVector<int>{14}));
+        QCOMPARE(byTime.totalLength, 25.0);
+        QCOMPARE(byTime.minTravelTime, 5.0);
+
+        const ShortestPathResult none =
+            image->findShortestPath(1, 5, NetworkImage::Metric::Distance);
+        QVERIFY(none.pathNodes.isEmpty());
+        QVERIFY(qIsInf(none.totalLength));
+    }
+
+    void openSharesOneMapping()
+    {
+        QTemporaryDir dir;
+        DirectedGraph<int>    graph;
+        NetworkImage::Builder builder;
+        buildDiamond(graph, builder);
+        const QString    path   = dir.filePath(QStringLiteral("net.img"));
+        const QByteArray digest = digestOf("diamond");
+        QVERIFY(NetworkImage::store(path, builder, digest));
+
+        auto first  = NetworkImage::open(path, digest);
+        auto second = NetworkImage::open(path, digest);
+        QVERIFY(first);
+        QCOMPARE(first.get(), second.get());
+
+        QString reason;
+        QVERIFY(!NetworkImage::open(path, digestOf("other"), &reason));
+        QVERIFY(!reason.isEmpty());
+    }
+
+    void rejectsCorruptImages()
+    {
+        QTemporaryDir dir;
+        DirectedGraph<int>    graph;
+        NetworkImage::Builder builder;
+        buildDiamond(graph, builder);
+        const QString    path   = dir.filePath(QStringLiteral("net.img"));
+        const QByteArray digest = digestOf("diamond");
+        QVERIFY(NetworkImage::store(path, builder, digest));
+
+        QFile f(path);
+        QVERIFY(f.open(QIODevice::ReadWrite));
+        QVERIFY(f.resize(f.size() - 8)); // drop part of edgeOffset
+        f.close();
+        QVERIFY(!NetworkImage::open(path, digest));
+
+        NetworkImage::Builder dangling;
+        dangling.addNode(1, 0.0, 0.0);
+        dangling.addEdge(1, 2, 1.0f, 0.0f, -1, 0.0, 0.0);
+        QString error;
+        QVERIFY(!NetworkImage::store(path, dangling, digest, &error));
+        QVERIFY(error.contains(QStringLiteral("unknown node")));
+    }
+};
+
+QTEST_MAIN(NetworkImageTest)
+#include "NetworkImageTest.moc"
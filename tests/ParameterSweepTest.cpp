@@ -0,0 +1,251 @@
+#include <QCoreApplication>
+#include <QTest>
+
+#include <memory>
+
+#include "Backend/Controllers/CargoNetSimController.h"
+#include "Backend/Controllers/ConfigController.h"
+#include "Backend/Models/Path.h"
+#include "Backend/Models/PathSegment.h"
+#include "Backend/Scenario/ParameterSweep.h"
+#include "Backend/Scenario/PathPreparationService.h"
+#include "Backend/Scenario/PropertyKeys.h"
+#include "Backend/Scenario/RegionSpec.h"
+#include "Backend/Scenario/ScenarioDocument.h"
+#include "Backend/Scenario/TerminalPlacement.h"
+
+#include <containerLib/container.h>
+
+using namespace CargoNetSim::Backend;
+using namespace CargoNetSim::Backend::Scenario;
+using Mode = TransportationTypes::TransportationMode;
+
+namespace
+{
+
+std::unique_ptr<ScenarioDocument> makeDoc()
+{
+    auto doc = std::make_unique<ScenarioDocument>();
+
+    RegionSpec r;
+    r.name = QStringLiteral("R1");
+    doc->addRegion(r);
+
+    TerminalPlacement origin;
+    origin.id = QStringLiteral("T1");
+    origin.type = QStringLiteral("port");
+    origin.region = QStringLiteral("R1");
+    origin.properties[QStringLiteral("initial_container_count")] = 10;
+    origin.properties[QStringLiteral("destination_terminal")] =
+        QStringLiteral("T2");
+    doc->addTerminal(origin);
+
+    QList<ContainerCore::Container *> pool;
+    for (int i = 0; i < 10; ++i)
+    {
+        auto *c = new ContainerCore::Container();
+        c->setContainerID(QStringLiteral("T1_%1").arg(i));
+        c->setContainerCurrentLocation(QStringLiteral("T1"));
+        pool.append(c);
+    }
+    doc->setOriginContainers(QStringLiteral("T1"), std::move(pool));
+
+    TerminalPlacement destination;
+    destination.id = QStringLiteral("T2");
+    destination.type = QStringLiteral("port");
+    destination.region = QStringLiteral("R1");
+    doc->addTerminal(destination);
+    return doc;
+}
+
+Path *makeDirectPath(int id, Mode mode, double meters, double seconds)
+{
+    auto *segment = new PathSegment(QStringLiteral("s_%1").arg(id),
+                                    QStringLiteral("T1"),
+                                    QStringLiteral("T2"), mode);
+    segment->setEstimatedDistanceAndTravelTime(meters, seconds);
+    return new Path(id, 0.0, 0.0, 0.0, {}, {segment});
+}
+
+} // namespace
+
+class ParameterSweepTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+        if (!CargoNetSim::CargoNetSimController::instance())
+        {
+            new CargoNetSim::CargoNetSimController(
+                nullptr, QCoreApplication::instance());
+        }
+    }
+
+    void test_parse_axis_lists_and_ranges()
+    {
+        ParameterSweepAxis axis;
+        QVERIFY(ParameterGrid::parseAxis(
+            QStringLiteral("carbon_taxes.rate=0, 65,130"), &axis));
+        QCOMPARE(axis.key, QStringLiteral("carbon_taxes.rate"));
+        QCOMPARE(axis.values.size(), 3);
+        QCOMPARE(axis.values.at(1).toDouble(), 65.0);
+
+        QVERIFY(ParameterGrid::parseAxis(
+            QStringLiteral("fuel_prices.diesel_2=1:2:0.25"), &axis));
+        QCOMPARE(axis.values.size(), 5);
+        QCOMPARE(axis.values.last().toDouble(), 2.0);
+
+        QString err;
+        QVERIFY(!ParameterGrid::parseAxis(QStringLiteral("=1,2"), &axis,
+                                          &err));
+        QVERIFY(!ParameterGrid::parseAxis(
+            QStringLiteral("carbon_taxes.rate=5:1:1"), &axis, &err));
+    }
+
+    void test_only_cost_keys_are_sweepable()
+    {
+        ParameterGrid grid;
+        QVERIFY(grid.addAxis({QStringLiteral("carbon_taxes.rate"), {1.0}}));
+        QVERIFY(grid.addAxis(
+            {QStringLiteral("transport_modes.truck.risk_factor"), {0.1}}));
+        QVERIFY(!grid.addAxis(
+            {QStringLiteral("transport_modes.truck.average_speed"), {1.0}}));
+        QVERIFY(!grid.addAxis({QStringLiteral("fuel_energy.HFO"), {1.0}}));
+        QVERIFY(!grid.addAxis({QStringLiteral("carbon_taxes.rate"), {2.0}}));
+    }
+
+    void test_points_are_row_major_and_applied_by_path()
+    {
+        ParameterGrid grid;
+        QVERIFY(grid.addAxis({QStringLiteral("carbon_taxes.rate"),
+                              {1.0, 2.0}}));
+        QVERIFY(grid.addAxis({QStringLiteral("fuel_prices.HFO"),
+                              {10.0, 20.0, 30.0}}));
+        QCOMPARE(grid.pointCount(), 6);
+
+        const QVariantMap point = grid.pointAt(4);
+        QCOMPARE(point.value(QStringLiteral("carbon_taxes.rate")).toDouble(),
+                 2.0);
+        QCOMPARE(point.value(QStringLiteral("fuel_prices.HFO")).toDouble(),
+                 20.0);
+
+        QVariantMap base;
+        base[QStringLiteral("carbon_taxes")] =
+            QVariantMap{{QStringLiteral("rate"), 65.0},
+                        {QStringLiteral("ship_multiplier"), 1.5}};
+        const QVariantMap applied = ParameterGrid::applyPoint(base, point);
+        const QVariantMap taxes =
+            applied.value(QStringLiteral("carbon_taxes")).toMap();
+        QCOMPARE(taxes.value(QStringLiteral("rate")).toDouble(), 2.0);
+        QCOMPARE(taxes.value(QStringLiteral("ship_multiplier")).toDouble(),
+                 1.5);
+        QCOMPARE(applied.value(QStringLiteral("fuel_prices"))
+                     .toMap()
+                     .value(QStringLiteral("HFO"))
+                     .toDouble(),
+                 20.0);
+    }
+
+    void test_evaluate_reranks_without_touching_prepared_paths()
+    {
+        auto  doc = makeDoc();
+        auto *config =
+            CargoNetSim::CargoNetSimController::getInstance()
+                .getConfigController();
+        const QVariantMap configBefore = config->getAllParams();
+
+        PreparedPathSet prepared =
+            PathPreparationService::prepareDiscoveredPaths(
+                {makeDirectPath(1, Mode::Train, 50000.0, 3600.0),
+                 makeDirectPath(2, Mode::Truck, 40000.0, 1800.0)},
+                *doc, config, /*networks=*/nullptr,
+                /*regionData=*/nullptr);
+        QCOMPARE(prepared.size(), 2);
+        const double costBefore =
+            prepared.records().front().path->getTotalPathCost();
+
+        ParameterGrid grid;
+        QVERIFY(grid.addAxis({QStringLiteral("carbon_taxes.rate"),
+                              {0.0, 65.0, 130.0}}));
+
+        const auto variants = ParameterSweep::evaluate(
+            prepared, *doc, *config, grid, /*selectPerPair=*/2);
+        QCOMPARE(variants.size(), 3);
+        for (const auto &variant : variants)
+        {
+            QCOMPARE(variant.paths.size(), 2);
+            QCOMPARE(variant.paths.at(0).sweepRank, 0);
+            QCOMPARE(variant.paths.at(1).sweepRank, 1);
+            QVERIFY(variant.paths.at(0).totalCost
+                    <= variant.paths.at(1).totalCost);
+            QCOMPARE(variant.selectedExecutionPathKeys.size(), 2);
+            // Both paths are always selected, so one run covers all.
+            QCOMPARE(variant.simulatedByVariant, 0);
+        }
+        QVERIFY(variants.at(0).needsSimulation());
+        QVERIFY(!variants.at(2).needsSimulation());
+
+        QCOMPARE(prepared.records().front().path->getTotalPathCost(),
+                 costBefore);
+        QCOMPARE(config->getAllParams(), configBefore);
+    }
+
+    void test_shared_run_is_recosted_with_variant_weights()
+    {
+        namespace PK = PropertyKeys;
+        const QString truckKey =
+            QString::number(static_cast<int>(Mode::Truck));
+
+        ParameterSweepVariant simulated;
+        simulated.index = 0;
+        simulated.costFunctionWeights[truckKey] = QVariantMap{
+            {PK::Segment::TravelTime, 1.0},
+            {PK::Segment::Risk, 10.0},
+            {PK::Segment::TerminalDelay, 1.0},
+            {PK::Segment::TerminalCost, 1.0}};
+        simulated.transportModes[QStringLiteral("truck")] =
+            QVariantMap{{PK::Mode::RiskFactor, 0.5}};
+
+        ParameterSweepVariant shared;
+        shared.index = 1;
+        shared.simulatedByVariant = 0;
+        shared.costFunctionWeights[truckKey] = QVariantMap{
+            {PK::Segment::TravelTime, 2.0},
+            {PK::Segment::Risk, 10.0},
+            {PK::Segment::TerminalDelay, 0.5},
+            {PK::Segment::TerminalCost, 3.0}};
+        shared.transportModes[QStringLiteral("truck")] =
+            QVariantMap{{PK::Mode::RiskFactor, 1.0}};
+
+        PathExecutionResult result;
+        result.executionPathKey = QStringLiteral("p1");
+        SegmentExecutionResult segment;
+        segment.mode = Mode::Truck;
+        segment.actualMetrics.available = true;
+        segment.actualMetrics.travelTime = 100.0;
+        segment.actualMetrics.risk = 1.0; // 2 trucks * 0.5
+        result.segmentResults.append(segment);
+        TerminalExecutionResult terminal;
+        terminal.arrivalMode = Mode::Truck;
+        terminal.actualTotalHandlingSeconds = 20.0;
+        terminal.actualDirectCostUsd = 4.0;
+        result.terminalResults.append(terminal);
+        result.edgeCosts = 110.0;
+        result.terminalCosts = 24.0;
+        result.totalCost = 134.0;
+
+        const auto own = ParameterSweep::simulatedTotalCosts(
+            simulated, simulated, {result});
+        QCOMPARE(own.value(QStringLiteral("p1")), 134.0);
+
+        // 100*2 + (1.0 * 1.0/0.5)*10 + 20*0.5 + 4*3
+        const auto recosted = ParameterSweep::simulatedTotalCosts(
+            shared, simulated, {result});
+        QCOMPARE(recosted.value(QStringLiteral("p1")), 242.0);
+    }
+};
+
+QTEST_MAIN(ParameterSweepTest)
+#include "ParameterSweepTest.moc"
@@ -257,23 +257,20 @@ private slots:
         QVERIFY(bundle.trainData.contains(QStringLiteral("USA_rail")));
         const auto trains = bundle.trainData.value(QStringLiteral("USA_rail"));
         QCOMPARE(trains.size(), 2);
-        QVERIFY(trains[0].train != nullptr);
-        QVERIFY(trains[1].train != nullptr);
-        QVERIFY2(trains[0].train->getUserId() != trains[1].train->getUserId(),
+        QVERIFY(trains[0].trainTemplate != nullptr);
+        QVERIFY(trains[1].trainTemplate != nullptr);
+        QVERIFY2(trains[0].trainId != trains[1].trainId,
                  "duplicate runtime artifact IDs still collide when two paths share a local path_id");
         RuntimeArtifactIdentity firstId;
         RuntimeArtifactIdentity secondId;
-        QVERIFY(RuntimeArtifacts::decode(trains[0].train->getUserId(), firstId));
-        QVERIFY(RuntimeArtifacts::decode(trains[1].train->getUserId(), secondId));
+        QVERIFY(RuntimeArtifacts::decode(trains[0].trainId, firstId));
+        QVERIFY(RuntimeArtifacts::decode(trains[1].trainId, secondId));
         QVERIFY(firstId.pathKey != secondId.pathKey);
 
         qDeleteAll(firstPool);
         qDeleteAll(secondPool);
         for (const auto &trainData : trains)
-        {
-            delete trainData.train;
             qDeleteAll(trainData.containers);
-        }
     }
 
     void test_save_reopen_round_trip_must_preserve_comparison_snapshots()
@@ -1,4 +1,5 @@
 #include <QtTest>
+#include <memory>
 #include "Backend/Models/PathSegment.h"
 #include "Backend/Models/Path.h"
 #include "Backend/Commons/TransportationMode.h"
@@ -46,6 +47,44 @@ private slots:
         QCOMPARE(seg.estimatedRisk(),              0.0);
     }
 
+    // Typed estimate records hand back the wire attributes key-for-key,
+    // keep the keys they do not model, and normalize estimated_values.
+    void attributesRoundTripThroughTypedRecords()
+    {
+        const QJsonObject wire{
+            {"from", "T1"},
+            {"to", "T2"},
+            {"mode", 1},
+            {"weight", 2.5},
+            {"attributes",
+             QJsonObject{
+                 {"estimated_values",
+                  QJsonObject{{"distance", 900.0}, {"note", "raw"}}},
+                 {"estimated_cost",
+                  QJsonObject{{"cost", 12.0}, {"risk", "n/a"}}},
+                 {"operator", "ACME"}}}};
+        PathSegment seg(wire);
+
+        QCOMPARE(seg.estimatedDistance(), 900.0);
+        QVERIFY(seg.estimatedValues().available);
+        QVERIFY(!seg.estimatedAllocatedValues().available);
+        QCOMPARE(seg.estimatedCosts().directCost, 12.0);
+        QCOMPARE(seg.estimatedCosts().risk, 0.0);
+
+        const QJsonObject attributes = seg.getAttributes();
+        QVERIFY(!attributes.contains("estimated_values"));
+        QCOMPARE(attributes.value("estimated").toObject(),
+                 (QJsonObject{{"distance", 900.0}, {"note", "raw"}}));
+        QCOMPARE(attributes.value("estimated_cost").toObject(),
+                 (QJsonObject{{"cost", 12.0}, {"risk", "n/a"}}));
+        QCOMPARE(attributes.value("operator").toString(),
+                 QStringLiteral("ACME"));
+        QCOMPARE(attributes.value("weight").toDouble(), 2.5);
+
+        std::unique_ptr<PathSegment> copy(seg.clone());
+        QCOMPARE(copy->getAttributes(), attributes);
+    }
+
     // Path::totalEstimated* must sum across all segments.
     void pathTotalEstimatedMetrics()
     {
@@ -588,6 +588,7 @@ private slots:
         doc.simulation.shipMultiplier        = 1.25;
         doc.simulation.railMultiplier        = 1.15;
         doc.simulation.truckMultiplier       = 1.05;
+        doc.simulation.truckBatchTrips       = true;
 
         doc.simulation.ship.speed      = 22.0;
         doc.simulation.ship.fuelRate   = 55.0;
@@ -606,6 +607,7 @@ private slots:
         auto sim = ctl.getConfigController()->getSimulationParams();
         QCOMPARE(sim.value("shortest_paths").toInt(),         7);
         QCOMPARE(sim.value("use_mode_specific").toBool(),  true);
+        QCOMPARE(sim.value("truck_batch_trips").toBool(),  true);
         QVERIFY(!sim.contains("shortest_paths_n"));         // scenario short-form must NOT leak through
         QVERIFY(!sim.contains("use_specific_time_values"));
 
@@ -1,8 +1,11 @@
 #include <QCoreApplication>
 #include <QDir>
+#include <QFile>
+#include <QFileInfo>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QScopeGuard>
 #include <QSignalSpy>
 #include <QTemporaryDir>
 #include <QTest>
@@ -21,6 +24,7 @@
 #include "Backend/Scenario/OutputSpec.h"
 #include "Backend/Scenario/Point2D.h"
 #include "Backend/Scenario/RegionSpec.h"
+#include "Backend/Scenario/ScenarioCache.h"
 #include "Backend/Scenario/ScenarioDocument.h"
 #include "Backend/Scenario/ScenarioSerializer.h"
 #include "Backend/Scenario/ScenarioValidator.h"
@@ -283,6 +287,7 @@ private slots:
         QVERIFY(!s.timeValueOfMoney.has_value());
         QVERIFY(!s.useSpecificTimeValues.has_value());
         QVERIFY(!s.carbonRate.has_value());
+        QVERIFY(!s.truckBatchTrips.has_value());
         QVERIFY(!s.shipMultiplier.has_value());
         QVERIFY(!s.railMultiplier.has_value());
         QVERIFY(!s.truckMultiplier.has_value());
@@ -600,7 +605,7 @@ private slots:
         doc.addConnection(c);
 
         QVERIFY(doc.renameRegion("USA", "US"));
-        QCOMPARE(doc.connections.at(0).region, QStringLiteral("US"));
+        QCOMPARE(doc.connections().at(0).region, QStringLiteral("US"));
     }
 
     void test_scenario_document_rename_region_reanchors_qualified_global_link_ids()
@@ -621,8 +626,8 @@ private slots:
         doc.addGlobalLink(g);
 
         QVERIFY(doc.renameRegion("USA", "US"));
-        QCOMPARE(doc.globalLinks.at(0).fromTerminalId, QStringLiteral("US/T1"));
-        QCOMPARE(doc.globalLinks.at(0).toTerminalId,   QStringLiteral("CAN/C1"));
+        QCOMPARE(doc.globalLinks().at(0).fromTerminalId, QStringLiteral("US/T1"));
+        QCOMPARE(doc.globalLinks().at(0).toTerminalId,   QStringLiteral("CAN/C1"));
     }
 
     void test_scenario_document_remove_region_cascades_into_terminals()
@@ -657,7 +662,7 @@ private slots:
 
         QSignalSpy linkageRemovedSpy(&doc, &ScenarioDocument::linkageRemoved);
         QVERIFY(doc.removeTerminal("T1"));
-        QVERIFY(doc.linkages.isEmpty());
+        QVERIFY(doc.linkages().isEmpty());
         QCOMPARE(linkageRemovedSpy.count(), 1);
     }
 
@@ -678,7 +683,7 @@ private slots:
 
         QSignalSpy connectionRemovedSpy(&doc, &ScenarioDocument::connectionRemoved);
         QVERIFY(doc.removeTerminal("A"));
-        QVERIFY(doc.connections.isEmpty());
+        QVERIFY(doc.connections().isEmpty());
         QCOMPARE(connectionRemovedSpy.count(), 1);
     }
 
@@ -701,10 +706,104 @@ private slots:
 
         QSignalSpy globalLinkRemovedSpy(&doc, &ScenarioDocument::globalLinkRemoved);
         QVERIFY(doc.removeTerminal("T1"));
-        QVERIFY(doc.globalLinks.isEmpty());
+        QVERIFY(doc.globalLinks().isEmpty());
         QCOMPARE(globalLinkRemovedSpy.count(), 1);
     }
 
+    void test_scenario_document_lookup_indices_follow_mutations_and_bulk_replace()
+    {
+        using namespace CargoNetSim::Backend::Scenario;
+        using Mode = CargoNetSim::Backend::TransportationTypes::TransportationMode;
+        ScenarioDocument doc;
+        RegionSpec r; r.name = "USA"; doc.addRegion(r);
+        for (const char *id : {"A", "B", "C"})
+        {
+            TerminalPlacement t; t.id = id; t.type = "Sea Port Terminal"; t.region = "USA";
+            doc.addTerminal(t);
+        }
+
+        NodeLinkage la; la.terminalId = "A"; la.networkName = "USA_rail"; la.nodeId = 1;
+        NodeLinkage lb; lb.terminalId = "B"; lb.networkName = "USA_rail"; lb.nodeId = 2;
+        QVERIFY(doc.addLinkage(la));
+        QVERIFY(doc.addLinkage(lb));
+        NodeLinkage clash = lb; clash.terminalId = "C";
+        QVERIFY(!doc.addLinkage(clash));          // node 2 already owned by B
+        QCOMPARE(doc.linkagesAtNode("USA_rail", 2).size(), 1);
+
+        QVERIFY(doc.removeLinkage("A", "USA_rail", 1));
+        QCOMPARE(doc.findLinkageIndex("A", "USA_rail", 1), -1);
+        QCOMPARE(doc.findLinkageIndex("B", "USA_rail", 2), 0);
+
+        Connection ab; ab.fromTerminalId = "A"; ab.toTerminalId = "B"; ab.mode = Mode::Truck;
+        Connection bc; bc.fromTerminalId = "B"; bc.toTerminalId = "C"; bc.mode = Mode::Truck;
+        QVERIFY(doc.addConnection(ab));
+        QVERIFY(doc.addConnection(bc));
+        QVERIFY(doc.removeConnection("A", "B", Mode::Truck));
+        QCOMPARE(doc.findConnectionIndex("B", "C", Mode::Truck), 0);
+
+        // Bulk loaders replace the lists wholesale; the indices follow.
+        Connection ca; ca.fromTerminalId = "C"; ca.toTerminalId = "A"; ca.mode = Mode::Rail;
+        QList<Connection> withCa = doc.connections();
+        withCa.append(ca);
+        doc.replaceRelationships(doc.linkages(), withCa, doc.globalLinks());
+        QCOMPARE(doc.findConnectionIndex("C", "A", Mode::Rail), 1);
+        QVERIFY(!doc.addConnection(ca));
+
+        QVERIFY(doc.removeTerminal("C"));
+        QVERIFY(doc.connections().isEmpty());
+        QCOMPARE(doc.linkages().size(), 1);
+    }
+
+    void test_scenario_document_single_removals_keep_indices_exact()
+    {
+        using namespace CargoNetSim::Backend::Scenario;
+        using Mode = CargoNetSim::Backend::TransportationTypes::TransportationMode;
+        ScenarioDocument doc;
+        RegionSpec r; r.name = "USA"; doc.addRegion(r);
+        const int count = 64;
+        for (int i = 0; i < count; ++i)
+        {
+            TerminalPlacement t;
+            t.id = QStringLiteral("T%1").arg(i);
+            t.type = "Sea Port Terminal";
+            t.region = "USA";
+            QVERIFY(doc.addTerminal(t));
+        }
+        for (int i = 0; i + 1 < count; ++i)
+        {
+            Connection c;
+            c.fromTerminalId = QStringLiteral("T%1").arg(i);
+            c.toTerminalId   = QStringLiteral("T%1").arg(i + 1);
+            c.mode           = Mode::Truck;
+            QVERIFY(doc.addConnection(c));
+        }
+
+        // Interleave removals (recorded, not shifted) with appends so
+        // appended records are indexed past the removed slots.
+        for (int i : {40, 3, 17, 4, 0, 61})
+        {
+            QVERIFY(doc.removeConnection(QStringLiteral("T%1").arg(i),
+                                         QStringLiteral("T%1").arg(i + 1),
+                                         Mode::Truck));
+            Connection back;
+            back.fromTerminalId = QStringLiteral("T%1").arg(i + 1);
+            back.toTerminalId   = QStringLiteral("T%1").arg(i);
+            back.mode           = Mode::Rail;
+            QVERIFY(doc.addConnection(back));
+        }
+
+        const QList<Connection> &connections = doc.connections();
+        for (int i = 0; i < connections.size(); ++i)
+        {
+            const Connection &c = connections.at(i);
+            QCOMPARE(doc.findConnectionIndex(c.fromTerminalId,
+                                             c.toTerminalId, c.mode),
+                     i);
+        }
+        QCOMPARE(doc.findConnectionIndex("T40", "T41", Mode::Truck), -1);
+        QVERIFY(!doc.addConnection(connections.constLast()));
+    }
+
     void test_scenario_document_add_terminal_requires_existing_region()
     {
         using namespace CargoNetSim::Backend::Scenario;
@@ -1332,17 +1431,17 @@ private slots:
 
         auto back = ScenarioSerializer::fromJson(j);
         QVERIFY(back);
-        QCOMPARE(back->connections.at(0).properties.value("distance").toDouble(),
+        QCOMPARE(back->connections().at(0).properties.value("distance").toDouble(),
                  120000.0);
-        QCOMPARE(back->connections.at(0).properties.value("travelTime").toDouble(),
+        QCOMPARE(back->connections().at(0).properties.value("travelTime").toDouble(),
                  7200.0);
-        QCOMPARE(back->connections.at(0).properties.value("risk").toDouble(),
+        QCOMPARE(back->connections().at(0).properties.value("risk").toDouble(),
                  0.25);
-        QCOMPARE(back->globalLinks.at(0).properties.value("distance").toDouble(),
+        QCOMPARE(back->globalLinks().at(0).properties.value("distance").toDouble(),
                  500000.0);
-        QCOMPARE(back->globalLinks.at(0).properties.value("travelTime").toDouble(),
+        QCOMPARE(back->globalLinks().at(0).properties.value("travelTime").toDouble(),
                  18000.0);
-        QCOMPARE(back->globalLinks.at(0).properties.value("risk").toDouble(),
+        QCOMPARE(back->globalLinks().at(0).properties.value("risk").toDouble(),
                  0.4);
     }
 
@@ -1523,7 +1622,7 @@ private slots:
         QCOMPARE(doc->regions.size(), 1);
         QCOMPARE(doc->regions["USA"].networks.size(), 2);
         QCOMPARE(doc->terminals.size(), 1);
-        QCOMPARE(doc->linkages.size(), 1);
+        QCOMPARE(doc->linkages().size(), 1);
     }
 
     void test_serializer_yaml_roundtrip_to_tmp_file_and_back()
@@ -1572,6 +1671,116 @@ private slots:
         QVERIFY(trainsNodes.startsWith(expectedDir));
     }
 
+    void test_serializer_yaml_streamed_records_accept_any_key_order_and_aliases()
+    {
+        using namespace CargoNetSim::Backend::Scenario;
+        // Records are streamed as they are parsed, so terminals may appear
+        // before the region they reference, and anchored records may be
+        // reused through aliases.
+        QTemporaryDir tmp;
+        QVERIFY(tmp.isValid());
+        const QString path = tmp.filePath("reordered.yml");
+        QFile f(path);
+        QVERIFY(f.open(QIODevice::WriteOnly | QIODevice::Text));
+        f.write(
+            "schema_version: 1\n"
+            "terminals:\n"
+            "  - { id: T1, type: \"Intermodal Land Terminal\", region: USA }\n"
+            "linkages:\n"
+            "  - &link { terminal: T1, network: USA_rail, node_id: 7,\n"
+            "            source: manual, excluded: false }\n"
+            "  - *link\n"
+            "regions:\n"
+            "  - name: USA\n"
+            "    networks:\n"
+            "      - { name: USA_rail, type: rail }\n");
+        f.close();
+
+        QString err;
+        auto doc = ScenarioSerializer::fromYaml(path, &err);
+        QVERIFY2(doc != nullptr, qPrintable(err));
+        QCOMPARE(doc->regions.size(), 1);
+        QCOMPARE(doc->terminals.size(), 1);
+        QCOMPARE(doc->linkages().size(), 2);
+        QCOMPARE(doc->linkages()[1].terminalId, QStringLiteral("T1"));
+        QCOMPARE(doc->linkages()[1].nodeId, 7);
+    }
+
+    // ---- ScenarioCache ----
+
+    void test_scenario_cache_hits_until_yaml_or_referenced_file_changes()
+    {
+        using namespace CargoNetSim::Backend::Scenario;
+        QTemporaryDir tmp;
+        QVERIFY(tmp.isValid());
+        const QString cacheRoot = tmp.filePath("cache");
+        qputenv("CARGONETSIM_CACHE_DIR", cacheRoot.toLocal8Bit());
+        const auto restoreCacheDir = qScopeGuard(
+            [] { qunsetenv("CARGONETSIM_CACHE_DIR"); });
+        QVERIFY(QDir().mkpath(tmp.filePath("inputs")));
+        const QString nodesPath = tmp.filePath("inputs/nodes.dat");
+        const QString yamlPath  = tmp.filePath("inputs/cached.yml");
+        auto writeFile = [](const QString &p, const QByteArray &content) {
+            QFile f(p);
+            QVERIFY(f.open(QIODevice::WriteOnly | QIODevice::Truncate));
+            f.write(content);
+        };
+        writeFile(nodesPath, "1 0 0\n");
+        writeFile(yamlPath,
+                  "schema_version: 1\n"
+                  "regions:\n"
+                  "  - name: USA\n"
+                  "    networks:\n"
+                  "      - { name: USA_rail, type: rail,\n"
+                  "          files: { nodes: nodes.dat } }\n"
+                  "terminals:\n"
+                  "  - { id: T1, type: \"Intermodal Land Terminal\", region: USA }\n");
+
+        const auto stage = ScenarioCache::Stage::Parsed;
+        QString reason;
+        QVERIFY(ScenarioCache::load(yamlPath, stage, &reason) == nullptr);
+
+        auto parsed = ScenarioSerializer::fromYaml(yamlPath);
+        QVERIFY(parsed);
+        QCOMPARE(ScenarioCache::referencedFiles(*parsed),
+                 QStringList{QFileInfo(nodesPath).absoluteFilePath()});
+        QString err;
+        QVERIFY2(ScenarioCache::store(yamlPath, stage, *parsed, &err),
+                 qPrintable(err));
+        // The entry goes under the cache root, never beside the inputs.
+        QVERIFY(ScenarioCache::cachePathFor(yamlPath, stage)
+                    .startsWith(cacheRoot));
+        QCOMPARE(QDir(tmp.filePath("inputs"))
+                     .entryList(QDir::Files | QDir::Hidden, QDir::Name),
+                 (QStringList{"cached.yml", "nodes.dat"}));
+
+        auto cached = ScenarioCache::load(yamlPath, stage, &reason);
+        QVERIFY2(cached != nullptr, qPrintable(reason));
+        QCOMPARE(cached->terminals.size(), 1);
+        QCOMPARE(cached->regions["USA"].networks["USA_rail"].files.value("nodes"),
+                 parsed->regions["USA"].networks["USA_rail"].files.value("nodes"));
+
+        // A stage is keyed on its own file.
+        QVERIFY(ScenarioCache::load(
+                    yamlPath, ScenarioCache::Stage::PreviewResolved) == nullptr);
+
+        // A keyed entry only hits the same input document.
+        const auto resolved = ScenarioCache::Stage::PreviewResolved;
+        const QByteArray input = ScenarioCache::documentDigest(*parsed);
+        QVERIFY(ScenarioCache::store(yamlPath, resolved, *parsed, &err, input));
+        QVERIFY(ScenarioCache::load(yamlPath, resolved, &reason, input));
+        auto edited = ScenarioSerializer::fromYaml(yamlPath);
+        edited->terminals.clear();
+        QVERIFY(ScenarioCache::load(yamlPath, resolved, &reason,
+                                    ScenarioCache::documentDigest(*edited))
+                == nullptr);
+        QCOMPARE(reason, QStringLiteral("input document differs"));
+
+        writeFile(nodesPath, "1 0 0\n2 1 1\n");
+        QVERIFY(ScenarioCache::load(yamlPath, stage, &reason) == nullptr);
+        QVERIFY(reason.contains("nodes.dat"));
+    }
+
     // ---- ScenarioValidator (structural) ----
 
     void test_validator_clean_full_fixture_has_no_errors()
@@ -1800,7 +2009,7 @@ private slots:
 
         QVERIFY(doc.addConnection(c));
         QVERIFY(!doc.addConnection(c));
-        QCOMPARE(doc.connections.size(), 1);
+        QCOMPARE(doc.connections().size(), 1);
         QVERIFY(doc.findConnection("A", "B",
             CargoNetSim::Backend::TransportationTypes::TransportationMode::Truck) != nullptr);
     }
@@ -1823,7 +2032,7 @@ private slots:
 
         QVERIFY(doc.addGlobalLink(g));
         QVERIFY(!doc.addGlobalLink(g));
-        QCOMPARE(doc.globalLinks.size(), 1);
+        QCOMPARE(doc.globalLinks().size(), 1);
         QVERIFY(doc.findGlobalLink("A", "B",
             CargoNetSim::Backend::TransportationTypes::TransportationMode::Ship) != nullptr);
     }
@@ -1845,8 +2054,7 @@ private slots:
         c1.properties["distance"] = 120000.0;
         Connection c2 = c1;
         c2.properties["distance"] = 0.0;
-        doc.connections.append(c1);
-        doc.connections.append(c2);
+        doc.replaceRelationships({}, {c1, c2}, {});
 
         auto issues = ScenarioValidator::validate(doc);
         bool sawDuplicate = false;
@@ -1882,6 +2090,79 @@ private slots:
                       && i.path.endsWith(".region")));
     }
 
+    void test_validator_parallel_shards_match_inline_order_and_honor_budget()
+    {
+        using namespace CargoNetSim::Backend::Scenario;
+        using Mode = CargoNetSim::Backend::TransportationTypes::TransportationMode;
+        ScenarioDocument doc;
+        RegionSpec usa; usa.name = "USA"; doc.addRegion(usa);
+
+        // Enough records to span several terminal and connection shards,
+        // with a bad type every terminal and a dangling endpoint on every
+        // connection so each shard reports errors.
+        const int count = ScenarioValidator::kShardSize * 2 + 7;
+        QList<Connection> connections;
+        for (int i = 0; i < count; ++i)
+        {
+            TerminalPlacement t;
+            t.id     = QStringLiteral("T%1").arg(i, 5, 10, QLatin1Char('0'));
+            t.type   = QStringLiteral("Not A Type");
+            t.region = QStringLiteral("USA");
+            QVERIFY(doc.addTerminal(t));
+
+            Connection c;
+            c.fromTerminalId = t.id;
+            c.toTerminalId   = QStringLiteral("missing");
+            c.mode           = Mode::Truck;
+            connections.append(c);
+        }
+        connections.append(connections.first());
+        doc.replaceRelationships({}, connections, {});
+
+        ValidationOptions inlineRun;
+        inlineRun.maxThreads = 1;
+        ValidationOptions pooled;
+        pooled.maxThreads = 4;
+        const auto expected = ScenarioValidator::validate(doc, inlineRun);
+        const auto actual   = ScenarioValidator::validate(doc, pooled);
+        QCOMPARE(actual.size(), expected.size());
+        for (int i = 0; i < expected.size(); ++i)
+        {
+            QCOMPARE(actual[i].path, expected[i].path);
+            QCOMPARE(actual[i].message, expected[i].message);
+        }
+
+        pooled.errorBudget = 10;
+        bool exhausted = false;
+        const auto budgeted =
+            ScenarioValidator::validate(doc, pooled, &exhausted);
+        QVERIFY(exhausted);
+        int budgetedErrors = 0;
+        for (int i = 0; i + 1 < budgeted.size(); ++i)
+        {
+            QCOMPARE(budgeted[i].path, expected[i].path);
+            if (budgeted[i].severity == ValidationIssue::Error)
+                ++budgetedErrors;
+        }
+        QCOMPARE(budgetedErrors, 10);
+        QCOMPARE(budgeted.constLast().severity, ValidationIssue::Warning);
+        QCOMPARE(budgeted.constLast().path, QStringLiteral("validation"));
+
+        // A budget the scenario meets exactly drops nothing
+        int totalErrors = 0;
+        for (const auto &issue : expected)
+            if (issue.severity == ValidationIssue::Error)
+                ++totalErrors;
+        pooled.errorBudget = totalErrors;
+        const auto exact = ScenarioValidator::validate(doc, pooled, &exhausted);
+        QVERIFY(!exhausted);
+        int exactErrors = 0;
+        for (const auto &issue : exact)
+            if (issue.severity == ValidationIssue::Error)
+                ++exactErrors;
+        QCOMPARE(exactErrors, totalErrors);
+    }
+
     // ---- Golden round-trip integration ----
 
     void test_integration_full_fixture_validates_and_round_trips()
@@ -1936,9 +2217,9 @@ private slots:
 
         QCOMPARE(doc2->regions.size(),     doc1->regions.size());
         QCOMPARE(doc2->terminals.size(),   doc1->terminals.size());
-        QCOMPARE(doc2->linkages.size(),    doc1->linkages.size());
-        QCOMPARE(doc2->connections.size(), doc1->connections.size());
-        QCOMPARE(doc2->globalLinks.size(), doc1->globalLinks.size());
+        QCOMPARE(doc2->linkages().size(),    doc1->linkages().size());
+        QCOMPARE(doc2->connections().size(), doc1->connections().size());
+        QCOMPARE(doc2->globalLinks().size(), doc1->globalLinks().size());
 
         // Spot-check that scenario-relative paths stayed absolute after the
         // second pass (because out.yml now lives in tmp, its rel paths would
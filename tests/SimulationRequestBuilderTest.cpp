@@ -1,5 +1,6 @@
 #include <QCoreApplication>
 #include <QDir>
+#include <QJsonObject>
 #include <QTest>
 
 #include "Backend/Commons/TransportationMode.h"
@@ -131,9 +132,9 @@ private slots:
         QCOMPARE(bundle.trainData["USA_rail"].size(), 1);
         const auto &td = bundle.trainData["USA_rail"].first();
         QCOMPARE(td.containers.size(), 5);
-        QVERIFY(td.train != nullptr);
+        QVERIFY(td.trainTemplate != nullptr);
         RuntimeArtifactIdentity trainId;
-        QVERIFY(RuntimeArtifacts::decode(td.train->getUserId(), trainId));
+        QVERIFY(RuntimeArtifacts::decode(td.trainId, trainId));
         QCOMPARE(trainId.artifactType, QStringLiteral("train"));
         QCOMPARE(trainId.segmentIndex, 0);
         QCOMPARE(trainId.artifactIndex, 0);
@@ -179,17 +180,14 @@ private slots:
                      Hauler::noHauler,
                      QStringLiteral("vehicle_id"))
                      .toString(),
-                 td.train->getUserId());
+                 td.trainId);
 
         // --- Cleanup ---
         qDeleteAll(originContainers);
         delete path;  // owns segments
         for (auto &list : bundle.trainData)
             for (auto &item : list)
-            {
-                delete item.train;
                 qDeleteAll(item.containers);
-            }
     }
 
     void test_truck_segment_builds_trip_per_truck()
@@ -364,33 +362,31 @@ private slots:
         QVERIFY(bundle.shipData.contains("USA"));
         QCOMPARE(bundle.shipData["USA"].size(), 1);
         const auto &sd = bundle.shipData["USA"].first();
-        QVERIFY(sd.ship != nullptr);
+        QVERIFY(sd.shipTemplate != nullptr);
         RuntimeArtifactIdentity shipId;
-        QVERIFY(RuntimeArtifacts::decode(sd.ship->getUserId(), shipId));
+        QVERIFY(RuntimeArtifacts::decode(sd.shipId, shipId));
         QCOMPARE(shipId.artifactType, QStringLiteral("ship"));
         QCOMPARE(shipId.segmentIndex, 0);
         QCOMPARE(shipId.artifactIndex, 0);
         QCOMPARE(sd.destinationTerminal,        QString("SP_B"));
         QCOMPARE(sd.containers.size(),          5);
 
-        // Ship stores coordinates as QVector<QVector<float>> [[x=lon, y=lat], ...].
-        const auto pathCoords = sd.ship->getPathCoordinates();
+        // Path coordinates are (x=lon, y=lat).
+        const auto &pathCoords = sd.pathCoordinates;
         QCOMPARE(pathCoords.size(), 2);
-        QCOMPARE(pathCoords[0].size(), 2);
-        QCOMPARE(pathCoords[1].size(), 2);
-        QVERIFY(qFuzzyCompare(pathCoords[0][0], -74.0f));  // SP_A lon
-        QVERIFY(qFuzzyCompare(pathCoords[0][1],  40.7f));  // SP_A lat
-        QVERIFY(qFuzzyCompare(pathCoords[1][0], -73.5f));  // SP_B lon
-        QVERIFY(qFuzzyCompare(pathCoords[1][1],  41.0f));  // SP_B lat
+        QVERIFY(qFuzzyCompare(pathCoords[0].x(), -74.0));  // SP_A lon
+        QVERIFY(qFuzzyCompare(pathCoords[0].y(),  40.7));  // SP_A lat
+        QVERIFY(qFuzzyCompare(pathCoords[1].x(), -73.5));  // SP_B lon
+        QVERIFY(qFuzzyCompare(pathCoords[1].y(),  41.0));  // SP_B lat
+        const QJsonObject shipJson = sd.toJson();
+        QCOMPARE(shipJson.value("ID").toString(), sd.shipId);
+        QCOMPARE(shipJson.value("Path").toString().count(';'), 1);
 
         qDeleteAll(originContainers);
         delete path;
         for (auto &list : bundle.shipData)
             for (auto &item : list)
-            {
-                delete item.ship;
                 qDeleteAll(item.containers);
-            }
     }
 
     void test_build_merges_multiple_paths_on_same_network()
@@ -485,7 +481,7 @@ private slots:
 
         QStringList userIds;
         for (const auto &td : bundle.trainData["USA_rail"])
-            userIds << td.train->getUserId();
+            userIds << td.trainId;
         QCOMPARE(userIds.size(), 2);
         QVERIFY(userIds[0] != userIds[1]);
 
@@ -497,10 +493,7 @@ private slots:
         delete p2;
         for (auto &list : bundle.trainData)
             for (auto &item : list)
-            {
-                delete item.train;
                 qDeleteAll(item.containers);
-            }
     }
 };
 
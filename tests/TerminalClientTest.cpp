@@ -460,6 +460,25 @@ private slots:
             return count;
         });
         QCOMPARE(topPathCount, 2);
+
+        const QList<int> viewPathIds = callOnClientThread([this]() {
+            QList<int> ids;
+            const auto views = client->findTopPathViews(
+                "TerminalA", "TerminalC", 2,
+                TransportationTypes::TransportationMode::
+                    Train);
+            for (const auto &view : views)
+            {
+                std::unique_ptr<Path> path(
+                    client->materializeTopPath(view));
+                ids.append(path && path->getPathId() == view.pathId
+                               ? view.pathId
+                               : -1);
+            }
+            return ids;
+        });
+        QCOMPARE(viewPathIds.size(), 2);
+        QVERIFY(!viewPathIds.contains(-1));
     }
     
     /**
@@ -0,0 +1,149 @@
+#include <QHash>
+#include <QJsonArray>
+#include <QTest>
+
+#include "Backend/Scenario/TerminalInventoryGateway.h"
+#include "Backend/Scenario/TerminalPickupCoordinator.h"
+
+using namespace CargoNetSim::Backend::Scenario;
+
+namespace
+{
+
+/// Answers reservations by terminal id and counts round trips.
+class FakeGateway final : public TerminalInventoryGateway
+{
+public:
+    QHash<QString, QJsonObject> reserveByTerminal;
+    int                         reserveCalls = 0;
+    int                         commitCalls  = 0;
+    int                         releaseCalls = 0;
+    QStringList                 released;
+
+    bool addContainers(const QString &, QList<ContainerCore::Container *> &,
+                       double, const QString &,
+                       TerminalInventoryArrivalSemantics) override
+    {
+        return true;
+    }
+
+    QJsonObject reserveContainers(const QString &terminalId, const QString &,
+                                  const QJsonObject &) override
+    {
+        return reserveByTerminal.value(terminalId);
+    }
+
+    QJsonObject commitContainerReservation(const QString &, const QString &,
+                                           double) override
+    {
+        return {{"state", "committed"}};
+    }
+
+    QJsonObject releaseContainerReservation(const QString &,
+                                            const QString &reservationId) override
+    {
+        released.append(reservationId);
+        return {{"state", "released"}};
+    }
+
+    QVector<QJsonObject>
+    reserveContainers(const QVector<TerminalReservationItem> &items) override
+    {
+        ++reserveCalls;
+        return TerminalInventoryGateway::reserveContainers(items);
+    }
+
+    QVector<QJsonObject>
+    commitContainerReservations(const QVector<TerminalReservationItem> &items,
+                                double time) override
+    {
+        ++commitCalls;
+        return TerminalInventoryGateway::commitContainerReservations(items,
+                                                                     time);
+    }
+
+    QVector<QJsonObject> releaseContainerReservations(
+        const QVector<TerminalReservationItem> &items) override
+    {
+        ++releaseCalls;
+        return TerminalInventoryGateway::releaseContainerReservations(items);
+    }
+};
+
+TerminalPickupRequest requestAt(const QString &terminalId, int segmentIndex)
+{
+    TerminalPickupRequest request;
+    request.executionId      = QStringLiteral("exec");
+    request.executionPathKey = QStringLiteral("exec|path");
+    request.canonicalPathKey = QStringLiteral("path");
+    request.terminalId       = terminalId;
+    request.segmentIndex     = segmentIndex;
+    request.containerCount   = 2;
+    return request;
+}
+
+} // namespace
+
+class TerminalPickupCoordinatorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void waveIsReservedWithOneCall()
+    {
+        FakeGateway gateway;
+        gateway.reserveByTerminal["blocked"] = {{"state", "blocked"}};
+        gateway.reserveByTerminal["short"] = {
+            {"state", "active"}, {"container_count", 1},
+            {"containers", QJsonArray()}};
+        // "missing" has no answer at all
+
+        TerminalPickupCoordinator coordinator(&gateway);
+        const auto batches = coordinator.reserveForDispatch(
+            QVector<TerminalPickupRequest>{requestAt("blocked", 0),
+                                           requestAt("short", 1),
+                                           requestAt("missing", 2),
+                                           requestAt(QString(), 3)});
+
+        QCOMPARE(gateway.reserveCalls, 1);
+        QCOMPARE(batches.size(), 4);
+        QVERIFY(batches[0].blocked);
+        QVERIFY(batches[1].blocked);
+        QVERIFY(batches[2].errorMessage.contains("did not create"));
+        QVERIFY(batches[3].errorMessage.contains("incomplete"));
+
+        // Only the short reservation is handed back, in one call
+        QCOMPARE(gateway.releaseCalls, 1);
+        QCOMPARE(gateway.released,
+                 QStringList{batches[1].handle.reservationId});
+    }
+
+    void commitAndReleaseAreBatched()
+    {
+        FakeGateway               gateway;
+        TerminalPickupCoordinator coordinator(&gateway);
+
+        QVector<TerminalPickupReservationHandle> handles;
+        for (int i = 0; i < 3; ++i)
+        {
+            TerminalPickupReservationHandle handle;
+            handle.terminalId    = QStringLiteral("T");
+            handle.reservationId = QStringLiteral("r%1").arg(i);
+            handle.segmentIndex  = i;
+            handles.append(handle);
+        }
+
+        QString err;
+        QVERIFY(coordinator.commitReservations(handles, 10.0, &err));
+        QVERIFY(err.isEmpty());
+        QCOMPARE(gateway.commitCalls, 1);
+
+        handles.append(TerminalPickupReservationHandle()); // skipped
+        QVERIFY(coordinator.releaseReservations(handles, &err));
+        QCOMPARE(gateway.releaseCalls, 1);
+        QCOMPARE(gateway.released.size(), 3);
+    }
+};
+
+QTEST_MAIN(TerminalPickupCoordinatorTest)
+#include "TerminalPickupCoordinatorTest.moc"
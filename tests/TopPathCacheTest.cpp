@@ -0,0 +1,137 @@
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "Backend/Scenario/TopPathCache.h"
+
+using namespace CargoNetSim::Backend::Scenario;
+
+namespace
+{
+
+QByteArray fingerprintOf(const QByteArray &seed)
+{
+    return QCryptographicHash::hash(seed, QCryptographicHash::Sha256);
+}
+
+QJsonArray twoPaths()
+{
+    QJsonArray paths;
+    for (int id : {1, 2})
+    {
+        QJsonObject path;
+        path["path_id"]         = id;
+        path["total_path_cost"] = 10.0 * id;
+        path["segments"]        = QJsonArray{QJsonObject{{"from", "A"}}};
+        paths.append(path);
+    }
+    return paths;
+}
+
+/// Backdates @p path so trim() sees it as used @p secondsAgo.
+void age(const QString &path, int secondsAgo)
+{
+    QFile f(path);
+    QVERIFY(f.open(QIODevice::ReadWrite));
+    QVERIFY(f.setFileTime(
+        QDateTime::currentDateTimeUtc().addSecs(-secondsAgo),
+        QFileDevice::FileModificationTime));
+}
+
+} // namespace
+
+class TopPathCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTripsPathsForSameGraph()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const TopPathCache cache(dir.filePath(QStringLiteral("paths")));
+        const QByteArray   graph = fingerprintOf("graph");
+        const QString      key   = QStringLiteral("A|B|mode=0|top=2|skip=1");
+
+        QJsonArray loaded;
+        QVERIFY(!cache.load(graph, key, &loaded));
+        QVERIFY(cache.store(graph, key, twoPaths()));
+        QVERIFY(cache.load(graph, key, &loaded));
+        QCOMPARE(loaded, twoPaths());
+
+        QVERIFY(!cache.load(fingerprintOf("edited graph"), key, &loaded));
+        QVERIFY(!cache.load(graph, QStringLiteral("A|B|mode=0|top=3|skip=1"),
+                            &loaded));
+    }
+
+    void rejectsCorruptEntries()
+    {
+        QTemporaryDir      dir;
+        const TopPathCache cache(dir.path());
+        const QByteArray   graph = fingerprintOf("graph");
+        const QString      key   = QStringLiteral("A|B");
+        QVERIFY(cache.store(graph, key, twoPaths()));
+
+        QFile f(cache.entryPathFor(graph, key));
+        QVERIFY(f.open(QIODevice::ReadWrite));
+        QVERIFY(f.resize(f.size() - 4)); // cut into the payload
+        f.close();
+        QVERIFY(!cache.load(graph, key, nullptr));
+    }
+
+    void rejectsKeyLengthPastEndOfFile()
+    {
+        QTemporaryDir      dir;
+        const TopPathCache cache(dir.path());
+        const QByteArray   graph = fingerprintOf("graph");
+        const QString      key   = QStringLiteral("A|B");
+        QVERIFY(cache.store(graph, key, twoPaths()));
+
+        // magic (4) + format (2) + fingerprint (32), then the key length
+        QFile f(cache.entryPathFor(graph, key));
+        QVERIFY(f.open(QIODevice::ReadWrite));
+        QVERIFY(f.seek(4 + 2 + graph.size()));
+        QCOMPARE(f.write(QByteArray(4, '\xff')), qint64(4));
+        f.close();
+        QVERIFY(!cache.load(graph, key, nullptr));
+    }
+
+    void trimEvictsLeastRecentlyUsed()
+    {
+        QTemporaryDir      dir;
+        const TopPathCache cache(dir.path(), /*capacity=*/2);
+        const QByteArray   graph = fingerprintOf("graph");
+        const QStringList  keys  = {QStringLiteral("A|B"),
+                                    QStringLiteral("A|C"),
+                                    QStringLiteral("A|D")};
+        for (int i = 0; i < keys.size(); ++i)
+        {
+            QVERIFY(cache.store(graph, keys[i], twoPaths()));
+            age(cache.entryPathFor(graph, keys[i]), 300 - 100 * i);
+        }
+
+        // A hit makes the oldest entry the most recently used
+        QVERIFY(cache.load(graph, keys[0], nullptr));
+        QCOMPARE(cache.trim(), 1);
+        QVERIFY(cache.load(graph, keys[0], nullptr));
+        QVERIFY(!cache.load(graph, keys[1], nullptr));
+        QVERIFY(cache.load(graph, keys[2], nullptr));
+    }
+
+    void disabledWithoutDirectory()
+    {
+        const TopPathCache cache{QString()};
+        QVERIFY(!cache.isEnabled());
+        QVERIFY(!cache.store(fingerprintOf("graph"), QStringLiteral("A|B"),
+                             twoPaths()));
+        QCOMPARE(cache.trim(), 0);
+        QVERIFY(TopPathCache::defaultDirectoryFor(QString()).isEmpty());
+    }
+};
+
+QTEST_MAIN(TopPathCacheTest)
+#include "TopPathCacheTest.moc"
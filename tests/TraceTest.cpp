@@ -0,0 +1,180 @@
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSet>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QThread>
+
+#include "Backend/Commons/Trace.h"
+
+using namespace CargoNetSim::Backend;
+
+class TraceTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_spans_are_not_recorded_while_stopped()
+    {
+        Trace::start();
+        Trace::stop();
+        bool detailEvaluated = false;
+        {
+            CNS_TRACE_SCOPE(Execution, "stopped");
+            CNS_TRACE_SCOPE_DETAIL(Execution, "stopped.detail",
+                                   (detailEvaluated = true, QString()));
+        }
+        QCOMPARE(Trace::recordedSpanCount(), 0);
+        QVERIFY(!detailEvaluated);
+    }
+
+    void test_threads_export_as_chrome_trace()
+    {
+        Trace::start();
+        {
+            CNS_TRACE_SCOPE_DETAIL(Messaging, "main.span",
+                                   QStringLiteral("say \"hi\""));
+        }
+        QThread *worker = QThread::create([]() {
+            for (int i = 0; i < 3; ++i)
+            {
+                CNS_TRACE_SCOPE(Discovery, "worker.span");
+            }
+        });
+        worker->setObjectName(QStringLiteral("trace-worker"));
+        worker->start();
+        QVERIFY(worker->wait(5000));
+        delete worker;
+        Trace::stop();
+
+        QCOMPARE(Trace::recordedSpanCount(), 4);
+
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString path = dir.filePath(QStringLiteral("trace.json"));
+        QString error;
+        QVERIFY2(Trace::writeChromeTrace(path, &error), qPrintable(error));
+
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        QJsonParseError parseError;
+        const QJsonDocument doc =
+            QJsonDocument::fromJson(file.readAll(), &parseError);
+        QCOMPARE(parseError.error, QJsonParseError::NoError);
+
+        int mainSpans = 0, workerSpans = 0;
+        QSet<int> spanTids;
+        QStringList threadNames;
+        for (const QJsonValue &v : doc.object()[QStringLiteral("traceEvents")]
+                                       .toArray())
+        {
+            const QJsonObject e = v.toObject();
+            const QString ph = e[QStringLiteral("ph")].toString();
+            if (ph == QLatin1String("M"))
+            {
+                threadNames << e[QStringLiteral("args")]
+                                   .toObject()[QStringLiteral("name")]
+                                   .toString();
+                continue;
+            }
+            QCOMPARE(ph, QStringLiteral("X"));
+            QVERIFY(e[QStringLiteral("dur")].toDouble() >= 0.0);
+            spanTids.insert(e[QStringLiteral("tid")].toInt());
+            const QString name = e[QStringLiteral("name")].toString();
+            if (name == QLatin1String("main.span"))
+            {
+                ++mainSpans;
+                QCOMPARE(e[QStringLiteral("cat")].toString(),
+                         QStringLiteral("messaging"));
+                QCOMPARE(e[QStringLiteral("args")]
+                             .toObject()[QStringLiteral("detail")]
+                             .toString(),
+                         QStringLiteral("say \"hi\""));
+            }
+            else if (name == QLatin1String("worker.span"))
+            {
+                ++workerSpans;
+            }
+        }
+        QCOMPARE(mainSpans, 1);
+        QCOMPARE(workerSpans, 3);
+        QCOMPARE(spanTids.size(), 2);
+        QVERIFY(threadNames.contains(QStringLiteral("trace-worker")));
+    }
+
+    void test_detail_is_cut_at_a_code_point()
+    {
+        // One byte short of fitting the two-byte 'é' after the padding
+        const QString padding(Trace::kDetailCapacity - 1, QLatin1Char('a'));
+        Trace::start();
+        {
+            CNS_TRACE_SCOPE_DETAIL(Scenario, "utf8.span",
+                                   padding + QStringLiteral("éz"));
+        }
+        Trace::stop();
+
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString path = dir.filePath(QStringLiteral("trace.json"));
+        QString error;
+        QVERIFY2(Trace::writeChromeTrace(path, &error), qPrintable(error));
+
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        const QByteArray json = file.readAll();
+        QCOMPARE(QString::fromUtf8(json).toUtf8(), json);
+        const auto events = QJsonDocument::fromJson(json)
+                                .object()[QStringLiteral("traceEvents")]
+                                .toArray();
+        QString detail;
+        for (const QJsonValue &v : events)
+        {
+            const QJsonObject e = v.toObject();
+            if (e[QStringLiteral("name")].toString()
+                == QLatin1String("utf8.span"))
+                detail = e[QStringLiteral("args")]
+                             .toObject()[QStringLiteral("detail")]
+                             .toString();
+        }
+        QCOMPARE(detail, padding);
+    }
+
+    void test_exited_threads_keep_their_spans()
+    {
+        Trace::start();
+        // More short-lived threads than spare rings, so buffers are both
+        // recycled and freed along the way.
+        for (int t = 0; t < 8; ++t)
+        {
+            QThread *worker = QThread::create([]() {
+                CNS_TRACE_SCOPE(Execution, "short.a");
+                CNS_TRACE_SCOPE(Execution, "short.b");
+            });
+            worker->start();
+            QVERIFY(worker->wait(5000));
+            delete worker;
+        }
+        Trace::stop();
+        QCOMPARE(Trace::recordedSpanCount(), 16);
+
+        Trace::start();
+        QCOMPARE(Trace::recordedSpanCount(), 0);
+        Trace::stop();
+    }
+
+    void test_start_clears_previous_spans()
+    {
+        Trace::start();
+        {
+            CNS_TRACE_SCOPE(Results, "first");
+        }
+        QCOMPARE(Trace::recordedSpanCount(), 1);
+        Trace::start();
+        QCOMPARE(Trace::recordedSpanCount(), 0);
+        Trace::stop();
+    }
+};
+
+QTEST_MAIN(TraceTest)
+#include "TraceTest.moc"
@@ -84,6 +84,38 @@ private slots:
         QVERIFY(qAbs(result.minTravelTimeUnits().value()
                      - expectedTravelTimeSeconds) < 0.1);
     }
+
+    void test_one_to_many_search_matches_point_to_point()
+    {
+        const QString nodesFile =
+            QFINDTESTDATA("fixtures/scenario/rail_nodes.dat");
+        const QString linksFile =
+            QFINDTESTDATA("fixtures/scenario/rail_links.dat");
+        QVERIFY2(!nodesFile.isEmpty(), "nodes fixture must resolve");
+        QVERIFY2(!linksFile.isEmpty(), "links fixture must resolve");
+
+        NeTrainSimNetwork network;
+        network.loadNetwork(nodesFile, linksFile);
+
+        const QVector<int> targets = {1, 3, 5, 7, 9, 16, 999999};
+        for (const QString criterion : {QStringLiteral("distance"),
+                                        QStringLiteral("time")})
+        {
+            const auto batched =
+                network.findShortestPaths(1, targets, criterion);
+            QCOMPARE(batched.size(), targets.size());
+            for (int target : targets)
+            {
+                const ShortestPathResult single =
+                    network.findShortestPath(1, target, criterion);
+                const ShortestPathResult many = batched.value(target);
+                QCOMPARE(many.pathNodes, single.pathNodes);
+                QCOMPARE(many.pathLinks, single.pathLinks);
+                QCOMPARE(many.totalLength, single.totalLength);
+                QCOMPARE(many.minTravelTime, single.minTravelTime);
+            }
+        }
+    }
 };
 
 QTEST_MAIN(TrainNetworkUnitsTest)
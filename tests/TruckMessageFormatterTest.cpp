@@ -0,0 +1,50 @@
+#include <QTest>
+
+#include "Backend/Clients/TruckClient/MessageFormatter.h"
+
+using namespace CargoNetSim::Backend::TruckClient;
+
+class TruckMessageFormatterTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void addTripsPacksEveryTrip()
+    {
+        MessageFormatter::TripSpec first;
+        first.tripId        = 10000;
+        first.originId      = 4;
+        first.destinationId = 9;
+        first.startTime     = 120.7;
+        first.linkIds       = {11, 12};
+
+        MessageFormatter::TripSpec second;
+        second.tripId        = 10001;
+        second.originId      = 9;
+        second.destinationId = 4;
+        second.startTime     = 120.7;
+        second.linkIds       = {21};
+
+        QCOMPARE(MessageFormatter::formatAddTrips(7, {first, second}),
+                 QStringLiteral("7/0/1001/2/00/00/00/00/"
+                                "2/10000/4/9/120/2/11/12/"
+                                "10001/9/4/120/1/21/-1"));
+    }
+
+    void singleTripIsPlainAddTrip()
+    {
+        MessageFormatter::TripSpec trip;
+        trip.tripId        = 10000;
+        trip.originId      = 4;
+        trip.destinationId = 9;
+        trip.startTime     = 0.0;
+        trip.linkIds       = {11, 12};
+
+        QCOMPARE(MessageFormatter::formatAddTrips(3, {trip}),
+                 MessageFormatter::formatAddTrip(3, 10000, 4, 9, 0.0,
+                                                 {11, 12}));
+    }
+};
+
+QTEST_MAIN(TruckMessageFormatterTest)
+#include "TruckMessageFormatterTest.moc"
@@ -0,0 +1,147 @@
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QThread>
+
+#include "Backend/Clients/TruckClient/TruckSimulatorPool.h"
+
+using namespace CargoNetSim::Backend::TruckClient;
+
+namespace
+{
+
+/// Stand-in simulator that just waits to be terminated.
+QString writeSimulator(const QTemporaryDir &dir)
+{
+    const QString path = dir.filePath(QStringLiteral("bin/fake_sim"));
+    QDir().mkpath(dir.filePath(QStringLiteral("bin")));
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly))
+        return QString();
+    f.write("#!/bin/sh\nexec sleep 30\n");
+    f.close();
+    f.setPermissions(QFile::ExeUser | QFile::ReadUser | QFile::WriteUser);
+    return path;
+}
+
+QString writeMaster(const QTemporaryDir &dir, const QString &name,
+                    const QByteArray &contents)
+{
+    const QString path = dir.filePath(name);
+    QFile         f(path);
+    if (!f.open(QIODevice::WriteOnly))
+        return QString();
+    f.write(contents);
+    return path;
+}
+
+} // namespace
+
+class TruckSimulatorPoolTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+#ifdef Q_OS_WIN
+        QSKIP("Needs a POSIX shell for the stand-in simulator");
+#endif
+    }
+
+    void launchKeyFollowsMasterContents()
+    {
+        QTemporaryDir dir;
+        const QString exe    = writeSimulator(dir);
+        const QString master = writeMaster(dir, "a.dat", "v1");
+        const QByteArray key =
+            TruckSimulatorPool::launchKey(exe, master, {"--x"});
+        QCOMPARE(key.size(), 32);
+        QVERIFY(key != TruckSimulatorPool::launchKey(exe, master, {"--y"}));
+
+        writeMaster(dir, "a.dat", "v2");
+        QVERIFY(key != TruckSimulatorPool::launchKey(exe, master, {"--x"}));
+        QVERIFY(TruckSimulatorPool::launchKey(exe, dir.filePath("none"), {})
+                    .isEmpty());
+    }
+
+    void untouchedProcessIsReused()
+    {
+        QTemporaryDir dir;
+        const QString exe    = writeSimulator(dir);
+        const QString master = writeMaster(dir, "a.dat", "master");
+
+        TruckSimulatorPool pool(2);
+        QProcess *first = pool.acquire(exe, master, {});
+        QVERIFY(first);
+        QCOMPARE(first->state(), QProcess::Running);
+        QVERIFY(QFile::exists(dir.filePath("fake_sim"))); // staged
+
+        TruckSimulatorPool::SyncPoint point;
+        point.valid   = true;
+        point.simTime = 0.0;
+        point.horizon   = 60.0;
+        point.requestId = 7;
+        pool.release(first, true, point);
+        QCOMPARE(pool.idleCount(), 1);
+
+        TruckSimulatorPool::SyncPoint handedOver;
+        QProcess *again = pool.acquire(exe, master, {}, &handedOver);
+        QCOMPARE(again, first);
+        QVERIFY(handedOver.valid);
+        QCOMPARE(handedOver.horizon, 60.0);
+        QCOMPARE(handedOver.requestId, 7);
+
+        // Used: retired and replaced in the background
+        pool.release(again, false);
+        QCOMPARE(pool.leasedCount(), 0);
+        QCOMPARE(pool.idleCount(), 1);
+    }
+
+    void capEvictsIdleOfOtherLaunches()
+    {
+        QTemporaryDir dir;
+        const QString exe = writeSimulator(dir);
+        const QString a   = writeMaster(dir, "a.dat", "a");
+        const QString b   = writeMaster(dir, "b.dat", "b");
+
+        TruckSimulatorPool pool(1);
+        QCOMPARE(pool.prewarm(exe, a, {}, 3), 1);
+
+        QProcess *leased = pool.acquire(exe, b, {});
+        QVERIFY(leased); // evicted the idle "a" process
+        QCOMPARE(pool.idleCount(), 0);
+
+        QString error;
+        QVERIFY(!pool.acquire(exe, a, {}, nullptr, &error));
+        QVERIFY(!error.isEmpty());
+        pool.release(leased, true);
+    }
+
+    void defaultPoolIsUnboundedAndOwnsItsProcesses()
+    {
+        QTemporaryDir dir;
+        const QString exe    = writeSimulator(dir);
+        const QString master = writeMaster(dir, "a.dat", "master");
+
+        TruckSimulatorPool pool;
+        QCOMPARE(pool.maxProcesses(), 0);
+        QList<QProcess *> leased;
+        for (int i = 0; i < QThread::idealThreadCount() + 1; ++i)
+        {
+            QProcess *process = pool.acquire(exe, master, {});
+            QVERIFY(process);
+            QVERIFY(process->thread() != QThread::currentThread());
+            leased.append(process);
+        }
+
+        // Lessee going away: retire without replacement
+        for (QProcess *process : leased)
+            pool.release(process, false, {}, /*replenish=*/false);
+        QCOMPARE(pool.leasedCount(), 0);
+        QCOMPARE(pool.idleCount(), 0);
+    }
+};
+
+QTEST_MAIN(TruckSimulatorPoolTest)
+#include "TruckSimulatorPoolTest.moc"
@@ -0,0 +1,61 @@
+#include <QJsonArray>
+#include <QTest>
+
+#include "Backend/Controllers/VehicleController.h"
+#include "Backend/Models/TrainSystem.h"
+#include "Backend/Scenario/VehicleTemplateCache.h"
+
+using namespace CargoNetSim::Backend;
+using namespace CargoNetSim::Backend::Scenario;
+
+class VehicleTemplateCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void serializesEachCatalogVehicleOnce()
+    {
+        VehicleController vehicles;
+        QVERIFY(vehicles.addTrain(
+            new Train(QStringLiteral("catalog"), {1, 2}, 0.0f, 0.9f,
+                      {}, {})));
+        VehicleTemplateCache cache(&vehicles);
+
+        const auto first  = cache.randomTrain();
+        const auto second = cache.randomTrain();
+        QVERIFY(first);
+        QCOMPARE(first.get(), second.get());
+        QCOMPARE(cache.size(), 1);
+        QCOMPARE(first->templateId, QStringLiteral("catalog"));
+        QVERIFY(!cache.randomShip());
+    }
+
+    void instanceOverridesOnlyTripFields()
+    {
+        VehicleController vehicles;
+        QVERIFY(vehicles.addTrain(
+            new Train(QStringLiteral("catalog"), {1, 2}, 0.0f, 0.5f,
+                      {}, {})));
+        VehicleTemplateCache cache(&vehicles);
+
+        TrainSimData td;
+        td.trainTemplate = cache.randomTrain();
+        td.trainId       = QStringLiteral("trip-1");
+        td.pathNodeIds   = {7, 9};
+        td.loadTime      = 200.0f;
+
+        const QJsonObject json = td.toJson();
+        QCOMPARE(json.value("UserID").toString(), QStringLiteral("trip-1"));
+        QCOMPARE(json.value("LoadTime").toDouble(), 200.0);
+        QCOMPARE(json.value("TrainPathOnNodeIDs").toArray(),
+                 (QJsonArray{7, 9}));
+        QCOMPARE(json.value("FrictionCoef").toDouble(), 0.5);
+
+        // The shared definition is untouched.
+        QCOMPARE(td.trainTemplate->definition.value("UserID").toString(),
+                 QStringLiteral("catalog"));
+    }
+};
+
+QTEST_MAIN(VehicleTemplateCacheTest)
+#include "VehicleTemplateCacheTest.moc"